@@ -0,0 +1,116 @@
+#!/bin/sh
+#
+# Monit check cycle benchmark
+#
+# Generates a control file with SERVICES services of each type (process,
+# file, directory, filesystem, host and program) and a fake /proc tree with
+# PROCESSES processes, then runs "monit benchmark" which prints the time
+# spent in each phase of the check cycle. The system files of the fake
+# /proc tree (stat, meminfo, loadavg, uptime) are copied from /proc.
+# The http allow list gets ALLOWS networks, the lookup rate of random
+# addresses in the list is printed after the cycles, followed by the
+# throughput of the checksum algorithms and the time to release and parse
+# the configuration as done on reload.
+#
+# Usage: benchmark.sh [path to monit]
+#
+#   SERVICES   number of services of each type (default 100)
+#   PROCESSES  number of processes in the fake /proc tree (default 1000)
+#   CYCLES     number of check cycles (default 10)
+#   ALLOWS     number of IPv4 and of IPv6 networks in the allow list (default 500)
+#
+# The process services need live pids for the existence test, a sleep
+# process is started for each of them and stopped at the end.
+#
+
+MONIT=${1:-./monit}
+SERVICES=${SERVICES:-100}
+PROCESSES=${PROCESSES:-1000}
+CYCLES=${CYCLES:-10}
+ALLOWS=${ALLOWS:-500}
+
+if [ `uname` != "Linux" ]; then
+        echo "The benchmark requires Linux"
+        exit 1
+fi
+if [ $PROCESSES -lt $SERVICES ]; then
+        PROCESSES=$SERVICES
+fi
+
+DIR=`mktemp -d /tmp/monit-bench.XXXXXX` || exit 1
+PIDS=""
+
+cleanup() {
+        [ -n "$PIDS" ] && kill $PIDS 2>/dev/null
+        rm -rf $DIR
+}
+trap cleanup 0 1 2 15
+
+mkdir $DIR/proc $DIR/files $DIR/run
+for f in stat meminfo loadavg uptime; do
+        cat /proc/$f > $DIR/proc/$f
+done
+
+# /proc/<pid>/stat and cmdline in the kernel format, the parent of every
+# process is one of the preceding ones so the tree has some depth
+procentry() {
+        mkdir $DIR/proc/$1
+        printf "%d (%s) S %d %d %d 0 -1 4194304 100 0 0 0 %d %d 0 0 20 0 1 0 %d 10485760 %d 18446744073709551615 1 1 0 0 0 0 0 0 0 0 0 0 17 0 0 0 0 0 0\n" \
+                $1 $2 $3 $1 $1 $(($1 % 97)) $(($1 % 89)) $(($1 % 1000)) $(($1 % 5000 + 100)) > $DIR/proc/$1/stat
+        printf "/usr/sbin/%s\000--instance\000%d\000" $2 $1 > $DIR/proc/$1/cmdline
+}
+
+procentry 1 init 0
+i=1
+while [ $i -le $SERVICES ]; do
+        sleep 3600 &
+        PIDS="$PIDS $!"
+        procentry $! daemon$i 1
+        echo $! > $DIR/run/p$i.pid
+        i=$((i + 1))
+done
+while [ $i -le $PROCESSES ]; do
+        ppid=$((3000000 + i / 4))
+        [ $((i / 4)) -le $SERVICES ] && ppid=1
+        procentry $((3000000 + i)) worker$i $ppid
+        i=$((i + 1))
+done
+
+CONTROL=$DIR/monitrc
+cat > $CONTROL <<EOF
+set logfile $DIR/monit.log
+set idfile $DIR/monit.id
+set httpd port 2812
+EOF
+i=1
+while [ $i -le $ALLOWS ]; do
+        echo "  allow 10.$((i % 256)).$((i / 256 * 7 % 256)).0/$((16 + i % 3 * 4))" >> $CONTROL
+        echo "  allow \"2001:db8:$i::/48\"" >> $CONTROL
+        i=$((i + 1))
+done
+echo "check system localhost" >> $CONTROL
+i=1
+while [ $i -le $SERVICES ]; do
+        echo "$i" > $DIR/files/f$i
+        cat >> $CONTROL <<EOF
+check process p$i with pidfile $DIR/run/p$i.pid
+  if cpu > 90% then alert
+  if totalmem > 90% then alert
+  if children > 1000 then alert
+check file f$i with path $DIR/files/f$i
+  if timestamp > 1 day then alert
+  if size > 1 MB then alert
+check directory d$i with path $DIR/files
+  if timestamp > 1 day then alert
+check filesystem fs$i with path /
+  if space usage > 99% then alert
+check host h$i with address 127.0.0.1
+  if failed port 1 type tcp with timeout 1 seconds then alert
+check program x$i with path /bin/true
+  if status != 0 then alert
+EOF
+        i=$((i + 1))
+done
+chmod 600 $CONTROL
+
+$MONIT -c $CONTROL -p $DIR/monit.pid benchmark $CYCLES $DIR/proc
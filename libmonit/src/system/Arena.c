@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+
+#include "Config.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "System.h"
+#include "Thread.h"
+#include "MemoryException.h"
+#include "Arena.h"
+
+
+/**
+ * Implementation of the Arena interface. An Arena is a list of chunks
+ * taken from the heap, the most recent chunk first. Allocations are cut
+ * from the head of the current chunk and are prefixed with a header
+ * holding the requested size. The chunk size doubles up to MAX_CHUNK as
+ * the Arena grows. A request larger than a quarter of the chunk size
+ * gets a chunk of its own so the current chunk is not abandoned.
+ *
+ * As Mem_free() asks Arena_owns() for every pointer, the test must be
+ * cheap for heap memory. Chunks are aligned to PAGE_SIZE and span whole
+ * pages, so a page holds either Arena or heap memory only. A page map
+ * with one bit per page, a root table of leaf bitmaps which cover 4GB
+ * each, marks the pages of all chunks. Arena_owns() is thus two loads
+ * and a bit test without a lock, from any thread. A leaf is never freed,
+ * the bits of a chunk are set before it is used and cleared before it is
+ * released. This module allocates with posix_memalign() and free()
+ * directly, as the Mem interface would allocate from the current Arena.
+ *
+ * @author http://www.tildeslash.com/
+ * @see http://www.mmonit.com/
+ * @file
+ */
+
+
+/* ----------------------------------------------------------- Definitions */
+
+
+#define T Arena_T
+
+#define MIN_CHUNK 65536
+#define MAX_CHUNK 4194304
+
+#define PAGE_SHIFT 16
+#define PAGE_SIZE (1L << PAGE_SHIFT)
+#define LEAF_PAGES 65536
+#if UINTPTR_MAX > 0xFFFFFFFFUL
+#define ROOT_SIZE 65536 // 48 bit address space
+#else
+#define ROOT_SIZE 1
+#endif
+
+union align {
+        long l;
+        double d;
+        long double ld;
+        void *p;
+        void (*f)(void);
+};
+
+#define ROUND(n) (((n) + (long)sizeof(union align) - 1) & ~((long)sizeof(union align) - 1))
+#define HEADER ROUND((long)sizeof(long))
+
+typedef struct chunk_t {
+        char *avail;
+        char *limit;
+        struct chunk_t *next;
+} *chunk_t;
+
+struct T {
+        long bytes;
+        long chunkSize;
+        chunk_t chunks;
+};
+
+typedef struct leaf_t {
+        unsigned long bits[LEAF_PAGES / (8 * sizeof(unsigned long))];
+} *leaf_t;
+
+static leaf_t pagemap[ROOT_SIZE];
+
+static Mutex_T mutex = PTHREAD_MUTEX_INITIALIZER;
+static int users = 0;
+static ThreadData_T current;
+static pthread_once_t once_control = PTHREAD_ONCE_INIT;
+
+
+/* --------------------------------------------------------------- Private */
+
+
+static void init_once(void) { ThreadData_create(current); }
+
+
+static inline char *chunk_data(chunk_t c) {
+        return (char *)c + ROUND((long)sizeof(struct chunk_t));
+}
+
+
+/* Set or clear the page map bits of a chunk, the mutex must be held */
+static int mark(chunk_t c, int owned) {
+        for (uintptr_t page = (uintptr_t)c >> PAGE_SHIFT; page < (uintptr_t)c->limit >> PAGE_SHIFT; page++) {
+                uintptr_t root = page / LEAF_PAGES;
+                unsigned long bit = 1UL << (page % (8 * sizeof(unsigned long)));
+                if (root >= ROOT_SIZE)
+                        return false;
+                if (! pagemap[root]) {
+                        if (! owned)
+                                continue;
+                        leaf_t leaf = calloc(1, sizeof *leaf);
+                        if (leaf == NULL)
+                                return false;
+                        __atomic_store_n(&pagemap[root], leaf, __ATOMIC_RELEASE);
+                }
+                unsigned long *word = &pagemap[root]->bits[(page % LEAF_PAGES) / (8 * sizeof(unsigned long))];
+                if (owned)
+                        __atomic_fetch_or(word, bit, __ATOMIC_RELEASE);
+                else
+                        __atomic_fetch_and(word, ~bit, __ATOMIC_RELEASE);
+        }
+        return true;
+}
+
+
+/* Allocate a chunk with at least size bytes of data, the chunk spans whole pages */
+static chunk_t new_chunk(T A, long size, int large, const char *func, const char *file, int line) {
+        void *p;
+        long total = (ROUND((long)sizeof(struct chunk_t)) + size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+        if (posix_memalign(&p, PAGE_SIZE, total) != 0)
+                Exception_throw(&(MemoryException), func, file, line, System_getLastError());
+        chunk_t c = p;
+        c->avail = chunk_data(c);
+        c->limit = (char *)c + total;
+        int marked;
+        LOCK(mutex)
+        {
+                if (! (marked = mark(c, true)))
+                        mark(c, false);
+        }
+        END_LOCK;
+        if (! marked) {
+                free(c);
+                Exception_throw(&(MemoryException), func, file, line, "Arena page map cannot map the chunk");
+        }
+        if (A->chunks && large) {
+                /* A large allocation, keep the current chunk */
+                c->next = A->chunks->next;
+                A->chunks->next = c;
+        } else {
+                c->next = A->chunks;
+                A->chunks = c;
+        }
+        return c;
+}
+
+
+/* ---------------------------------------------------------------- Public */
+
+
+T Arena_new(void) {
+        T A = calloc(1, sizeof *A);
+        if (A == NULL)
+                THROW(MemoryException, "%s", System_getLastError());
+        A->chunkSize = MIN_CHUNK;
+        return A;
+}
+
+
+void Arena_free(T *A) {
+        assert(A && *A);
+        if (Arena_current() == *A)
+                Arena_use(NULL);
+        LOCK(mutex)
+        {
+                for (chunk_t c = (*A)->chunks; c; c = c->next)
+                        mark(c, false);
+        }
+        END_LOCK;
+        for (chunk_t c = (*A)->chunks, next; c; c = next) {
+                next = c->next;
+                free(c);
+        }
+        free(*A);
+        *A = NULL;
+}
+
+
+T Arena_use(T A) {
+        pthread_once(&once_control, init_once);
+        T previous = ThreadData_get(current);
+        ThreadData_set(current, A);
+        if (A && ! previous)
+                __atomic_add_fetch(&users, 1, __ATOMIC_RELEASE);
+        else if (! A && previous)
+                __atomic_sub_fetch(&users, 1, __ATOMIC_RELEASE);
+        return previous;
+}
+
+
+T Arena_current(void) {
+        /* Fast path, no thread has a current Arena */
+        if (! __atomic_load_n(&users, __ATOMIC_ACQUIRE))
+                return NULL;
+        return ThreadData_get(current);
+}
+
+
+void *Arena_alloc(T A, long size, const char *func, const char *file, int line) {
+        assert(A);
+        assert(size > 0);
+        long n = HEADER + ROUND(size);
+        chunk_t c = A->chunks;
+        if (! c || c->limit - c->avail < n) {
+                if (n > A->chunkSize / 4) {
+                        c = new_chunk(A, n, true, func, file, line);
+                } else {
+                        if (c && A->chunkSize < MAX_CHUNK)
+                                A->chunkSize *= 2;
+                        c = new_chunk(A, A->chunkSize - ROUND((long)sizeof(struct chunk_t)), false, func, file, line);
+                }
+        }
+        char *p = c->avail + HEADER;
+        c->avail += n;
+        *(long *)(p - HEADER) = size;
+        A->bytes += size;
+        return p;
+}
+
+
+void *Arena_resize(T A, void *p, long size, const char *func, const char *file, int line) {
+        assert(A);
+        assert(p);
+        assert(size > 0);
+        long old = Arena_sizeOf(p);
+        chunk_t c = A->chunks;
+        if (c && (char *)p + ROUND(old) == c->avail && (char *)p + ROUND(size) <= c->limit) {
+                /* The last allocation of the current chunk, grow or shrink in place */
+                c->avail = (char *)p + ROUND(size);
+                *(long *)((char *)p - HEADER) = size;
+                A->bytes += size - old;
+                return p;
+        }
+        void *q = Arena_alloc(A, size, func, file, line);
+        memcpy(q, p, old < size ? old : size);
+        return q;
+}
+
+
+int Arena_owns(const void *p) {
+        uintptr_t page = (uintptr_t)p >> PAGE_SHIFT, root = page / LEAF_PAGES;
+        if (root >= ROOT_SIZE)
+                return false;
+        leaf_t leaf = __atomic_load_n(&pagemap[root], __ATOMIC_ACQUIRE);
+        if (! leaf)
+                return false;
+        unsigned long word = __atomic_load_n(&leaf->bits[(page % LEAF_PAGES) / (8 * sizeof(unsigned long))], __ATOMIC_ACQUIRE);
+        return (word >> (page % (8 * sizeof(unsigned long)))) & 1;
+}
+
+
+long Arena_sizeOf(const void *p) {
+        assert(p);
+        return *(const long *)((const char *)p - HEADER);
+}
+
+
+long Arena_bytes(T A) {
+        assert(A);
+        return A->bytes;
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+
+#ifndef ARENA_INCLUDED
+#define ARENA_INCLUDED
+
+
+/**
+ * An <b>Arena</b> is a region of memory for objects which share the same
+ * lifetime. Objects are carved out of large chunks and are released all
+ * at once by Arena_free() instead of one by one.
+ *
+ * A thread can make an Arena <i>current</i> with Arena_use(). While an
+ * Arena is current, all memory allocated by the thread with the Mem
+ * interface (ALLOC, CALLOC, NEW, RESIZE and functions using them, such as
+ * Str_dup()) comes from the Arena. Mem_free() is a no-op for Arena
+ * memory and Mem_resize() copies Arena memory which is resized while
+ * the Arena is not current. This means that code which allocates and
+ * frees objects with the Mem interface can be run with an Arena without
+ * changes.
+ *
+ * Memory allocated from an Arena must not be used after the Arena was
+ * freed. The Arena_free() method must not be called while another
+ * thread uses the Arena.
+ *
+ * @author http://www.tildeslash.com/
+ * @see http://www.mmonit.com/
+ * @file
+ */
+
+
+#define T Arena_T
+typedef struct T *T;
+
+
+/**
+ * Create a new Arena object.
+ * @return An Arena object
+ * @exception MemoryException if allocation failed
+ */
+T Arena_new(void);
+
+
+/**
+ * Destroy an Arena object and release all memory allocated from it
+ * @param A An Arena object reference
+ */
+void Arena_free(T *A);
+
+
+/**
+ * Make <code>A</code> the current Arena of the calling thread. Memory
+ * allocated by this thread with the Mem interface is taken from the
+ * current Arena. Use NULL to allocate from the heap again.
+ * @param A An Arena object or NULL
+ * @return The previous current Arena of the thread or NULL
+ */
+T Arena_use(T A);
+
+
+/**
+ * Returns the current Arena of the calling thread
+ * @return The current Arena or NULL if the thread allocates from the heap
+ */
+T Arena_current(void);
+
+
+/**
+ * Allocate <code>size</code> bytes from the Arena. The memory is aligned
+ * for any type and is not cleared.
+ * @param A An Arena object
+ * @param size The number of bytes to allocate
+ * @param func the callee
+ * @param file location of caller
+ * @param line location of caller
+ * @return A pointer to the allocated memory
+ * @exception MemoryException if allocation failed
+ */
+void *Arena_alloc(T A, long size, const char *func, const char *file, int line);
+
+
+/**
+ * Change the size of <code>p</code> which was allocated from the Arena.
+ * The memory is extended in place if <code>p</code> is the last allocation
+ * of the Arena, otherwise it is copied to a new allocation.
+ * @param A An Arena object
+ * @param p A pointer to memory allocated from <code>A</code>
+ * @param size The new size in bytes
+ * @param func the callee
+ * @param file location of caller
+ * @param line location of caller
+ * @return A pointer to the resized memory
+ * @exception MemoryException if allocation failed
+ */
+void *Arena_resize(T A, void *p, long size, const char *func, const char *file, int line);
+
+
+/**
+ * Test if <code>p</code> points to memory allocated from an Arena. The
+ * test is a lookup in a page map and takes constant time, it is safe to
+ * call from any thread.
+ * @param p A pointer
+ * @return true if <code>p</code> is Arena memory, otherwise false
+ */
+int Arena_owns(const void *p);
+
+
+/**
+ * Returns the size of an Arena allocation
+ * @param p A pointer to memory allocated from an Arena
+ * @return The number of bytes requested for <code>p</code>
+ */
+long Arena_sizeOf(const void *p);
+
+
+/**
+ * Returns the number of bytes allocated from the Arena
+ * @param A An Arena object
+ * @return The sum of the sizes of all allocations from <code>A</code>
+ */
+long Arena_bytes(T A);
+
+
+#undef T
+#endif
@@ -32,6 +32,9 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #include "Str.h"
 #include "Dir.h"
@@ -188,6 +191,20 @@ static void closeStreams(Process_T P) {
 }
 
 
+/* Close all descriptors from lowfd and up in the subprocess. close_range(2)
+ (Linux 5.9) does it in one call instead of one close(2) per possible
+ descriptor, which matters when the descriptor limit is high */
+static void closeDescriptors(int lowfd) {
+#ifdef SYS_close_range
+        if (syscall(SYS_close_range, (unsigned)lowfd, ~0U, 0) == 0)
+                return;
+#endif
+        int descriptors = getdtablesize();
+        for (int i = lowfd; i < descriptors; i++)
+                close(i);
+}
+
+
 /* -------------------------------------------------------------- Process_T */
 
 
@@ -488,9 +505,7 @@ Process_T Command_execute(T C) {
                 setsid(); // Loose controlling terminal
                 setupChildPipes(P);
                 // Close all descriptors except stdio
-                int descriptors = getdtablesize();
-                for (int i = 3; i < descriptors; i++)
-                        close(i);
+                closeDescriptors(3);
                 // Unblock any signals and reset signal handlers
                 sigset_t mask;
                 sigemptyset(&mask);
@@ -32,10 +32,12 @@
 #include "assert.h"
 #include "System.h"
 #include "MemoryException.h"
+#include "Arena.h"
 
 
 /**
- * Implementation of the Mem interface
+ * Implementation of the Mem interface. Memory is taken from the current
+ * Arena of the calling thread if it has one, otherwise from the heap.
  *
  * @author http://www.tildeslash.com/
  * @see http://www.mmonit.com/
@@ -48,7 +50,10 @@
 
 void *Mem_alloc(long nbytes, const char *func, const char *file, int line){
 	void *ptr;
+        Arena_T arena;
 	assert(nbytes > 0);
+        if ((arena = Arena_current()))
+                return Arena_alloc(arena, nbytes, func, file, line);
 	ptr = malloc(nbytes);
 	if (ptr == NULL)
                 Exception_throw(&(MemoryException), func, file, line, System_getLastError());
@@ -58,8 +63,11 @@ void *Mem_alloc(long nbytes, const char *func, const char *file, int line){
 
 void *Mem_calloc(long count, long nbytes, const char *func, const char *file, int line) {
 	void *ptr;
+        Arena_T arena;
 	assert(count > 0);
 	assert(nbytes > 0);
+        if ((arena = Arena_current()))
+                return memset(Arena_alloc(arena, count * nbytes, func, file, line), 0, count * nbytes);
 	ptr = calloc(count, nbytes);
 	if (ptr == NULL)
                 Exception_throw(&(MemoryException), func, file, line, System_getLastError());
@@ -68,7 +76,7 @@ void *Mem_calloc(long count, long nbytes, const char *func, const char *file, in
 
 
 void Mem_free(void *ptr, const char *func, const char *file, int line) {
-	if (ptr)
+	if (ptr && ! Arena_owns(ptr))
 		free(ptr);
 }
 
@@ -77,6 +85,15 @@ void *Mem_resize(void *ptr, long nbytes, const char *func, const char *file, int
 	assert(nbytes > 0);
         if (! ptr)
                 return Mem_alloc(nbytes, func, file, line); 
+        if (Arena_owns(ptr)) {
+                Arena_T arena = Arena_current();
+                if (arena)
+                        return Arena_resize(arena, ptr, nbytes, func, file, line);
+                /* Arena memory resized outside of the Arena is moved to the heap */
+                long size = Arena_sizeOf(ptr);
+                void *p = Mem_alloc(nbytes, func, file, line);
+                return memcpy(p, ptr, size < nbytes ? size : nbytes);
+        }
 	ptr = realloc(ptr, nbytes);
 	if (ptr == NULL)
                 Exception_throw(&(MemoryException), func, file, line, System_getLastError());
@@ -28,7 +28,8 @@
 
 
 /**
- * General purpose <b>memory allocation</b> methods.
+ * General purpose <b>memory allocation</b> methods. If the calling thread
+ * has a current Arena, memory is allocated from the Arena (see Arena.h).
  *
  * @author http://www.tildeslash.com/
  * @see http://www.mmonit.com/
@@ -0,0 +1,147 @@
+#include "Config.h"
+
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "Bootstrap.h"
+#include "Str.h"
+#include "Thread.h"
+#include "system/Arena.h"
+
+/**
+ * Arena.c unity tests.
+ */
+
+
+static void *worker(void *arena) {
+        char *s = Str_dup("heap");
+        assert(Arena_current() == NULL);
+        assert(! Arena_owns(s));
+        FREE(s);
+        return NULL;
+}
+
+
+int main(void) {
+        Arena_T A = NULL;
+
+        Bootstrap(); // Need to initialize library
+
+        printf("============> Start Arena Tests\n\n");
+
+        printf("=> Test0: create and free\n");
+        {
+                A = Arena_new();
+                assert(A);
+                assert(Arena_bytes(A) == 0);
+                Arena_free(&A);
+                assert(A == NULL);
+        }
+        printf("=> Test0: OK\n\n");
+
+        printf("=> Test1: Arena_alloc() alignment and size\n");
+        {
+                A = Arena_new();
+                for (int i = 1; i < 100; i++) {
+                        char *p = Arena_alloc(A, i, __func__, __FILE__, __LINE__);
+                        assert(((unsigned long)p % sizeof(double)) == 0);
+                        assert(Arena_sizeOf(p) == i);
+                        assert(Arena_owns(p));
+                        memset(p, 'x', i);
+                }
+                assert(Arena_bytes(A) == 99 * 100 / 2);
+                Arena_free(&A);
+        }
+        printf("=> Test1: OK\n\n");
+
+        printf("=> Test2: Mem allocations from the current Arena\n");
+        {
+                char *s, *h;
+                int *n;
+                A = Arena_new();
+                h = Str_dup("heap");
+                assert(! Arena_owns(h));
+                assert(Arena_use(A) == NULL);
+                assert(Arena_current() == A);
+                s = Str_dup("arena");
+                NEW(n);
+                assert(*n == 0);
+                assert(Arena_owns(s));
+                assert(Arena_owns(n));
+                assert(! Arena_owns(h));
+                FREE(s); // no-op
+                assert(Arena_use(NULL) == A);
+                assert(Arena_current() == NULL);
+                s = Str_dup("heap again");
+                assert(! Arena_owns(s));
+                FREE(s);
+                FREE(h);
+                Arena_free(&A);
+        }
+        printf("=> Test2: OK\n\n");
+
+        printf("=> Test3: RESIZE\n");
+        {
+                char *p, *q;
+                A = Arena_new();
+                Arena_use(A);
+                p = ALLOC(10);
+                Str_copy(p, "123456789", 9);
+                q = p;
+                RESIZE(p, 100);
+                assert(p == q); // last allocation, extended in place
+                assert(Arena_sizeOf(p) == 100);
+                q = ALLOC(10);
+                RESIZE(p, 200);
+                assert(p != q);
+                assert(Str_isEqual(p, "123456789"));
+                assert(Arena_owns(p));
+                Arena_use(NULL);
+                // Resized outside of the Arena, the memory is moved to the heap
+                q = p;
+                RESIZE(p, 300);
+                assert(p != q);
+                assert(! Arena_owns(p));
+                assert(Str_isEqual(p, "123456789"));
+                FREE(p);
+                Arena_free(&A);
+        }
+        printf("=> Test3: OK\n\n");
+
+        printf("=> Test4: many and large allocations\n");
+        {
+                char *big, *first;
+                A = Arena_new();
+                Arena_use(A);
+                first = ALLOC(16);
+                for (int i = 0; i < 100000; i++)
+                        assert(Arena_owns(Str_cat("%d", i)));
+                big = CALLOC(1, 8 * 1024 * 1024);
+                assert(Arena_owns(big));
+                assert(Arena_owns(big + 8 * 1024 * 1024 - 1));
+                assert(big[4096] == 0);
+                assert(Arena_owns(first));
+                Arena_free(&A);
+                assert(Arena_current() == NULL);
+                assert(! Arena_owns(first));
+        }
+        printf("=> Test4: OK\n\n");
+
+        printf("=> Test5: the current Arena is per thread\n");
+        {
+                Thread_T t;
+                A = Arena_new();
+                Arena_use(A);
+                Thread_create(t, worker, A);
+                Thread_join(t);
+                Arena_use(NULL);
+                Arena_free(&A);
+        }
+        printf("=> Test5: OK\n\n");
+
+        printf("============> Arena Tests: OK\n\n");
+
+        return 0;
+}
@@ -220,6 +220,23 @@ int main(void) {
         }
         printf("=> Test7: OK\n\n");
 
+        printf("=> Test8: descriptors are not inherited\n");
+        {
+                int fd = dup(STDOUT_FILENO);
+                assert(fd > 2);
+                char script[STRLEN];
+                snprintf(script, STRLEN, "echo test >&%d", fd);
+                Command_T c = Command_new("/bin/sh", "-c", script, NULL);
+                assert(c);
+                Process_T P = Command_execute(c);
+                assert(P);
+                assert(Process_waitFor(P) != 0);
+                Process_free(&P);
+                Command_free(&c);
+                close(fd);
+        }
+        printf("=> Test8: OK\n\n");
+
         printf("============> Command Tests: OK\n\n");
 
         return 0;
@@ -13,4 +13,5 @@ OutputStreamTest && \
 FileTest && \
 ExceptionTest && \
 NetTest && \
-CommandTest
+CommandTest && \
+ArenaTest
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_STRINGS_H
+#include <strings.h>
+#endif
+
+#include "monit.h"
+#include "batch.h"
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+Job_T Batch_getJob(Batch_T batch, const char *name) {
+        ASSERT(batch);
+        for (int i = 0; i < batch->count; i++)
+                if (IS(batch->jobs[i].s->name, name))
+                        return &batch->jobs[i];
+        return NULL;
+}
+
+
+int Batch_getDepth(Batch_T batch, Job_T j) {
+        ASSERT(batch);
+        ASSERT(j);
+        if (j->depth < 0) {
+                Dependant_T d;
+                j->depth = 0;
+                for (d = j->s->dependantlist; d; d = d->next) {
+                        Job_T parent = Batch_getJob(batch, d->dependant);
+                        if (parent && Batch_getDepth(batch, parent) >= j->depth)
+                                j->depth = parent->depth + 1;
+                }
+        }
+        return j->depth;
+}
+
+
+void Batch_markStart(Batch_T batch, Job_T j) {
+        Dependant_T d;
+        ASSERT(batch);
+        ASSERT(j);
+        if (j->start || j->s->visited)
+                return;
+        j->start = TRUE;
+        for (d = j->s->dependantlist; d; d = d->next) {
+                Job_T parent = Batch_getJob(batch, d->dependant);
+                ASSERT(parent);
+                Batch_markStart(batch, parent);
+        }
+}
+
+
+void Batch_markDependants(Batch_T batch, Job_T j, int stop, int start) {
+        ASSERT(batch);
+        ASSERT(j);
+        if (stop && j->expanded)
+                return;
+        j->expanded = TRUE;
+        for (int i = 0; i < batch->count; i++) {
+                Job_T child = &batch->jobs[i];
+                Dependant_T d;
+                for (d = child->s->dependantlist; d; d = d->next) {
+                        if (IS(d->dependant, j->s->name)) {
+                                if (! stop) {
+                                        child->start = FALSE;
+                                } else {
+                                        if (! child->stop && ! child->s->depend_visited)
+                                                child->stop = stop;
+                                        if (start)
+                                                Batch_markStart(batch, child);
+                                }
+                                Batch_markDependants(batch, child, stop, start);
+                                break;
+                        }
+                }
+        }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+
+#ifndef MONIT_BATCH_H
+#define MONIT_BATCH_H
+
+#include "monit.h"
+
+
+/**
+ * Dependency order of a batch of service actions.
+ *
+ * A batch holds one job per service. The jobs affected by a start, stop
+ * or restart action are marked as control_service() would handle the
+ * services one by one, then the marked jobs are grouped in waves by their
+ * depth in the dependency graph: a service is stopped after every service
+ * which depends on it and started after every service it depends on. The
+ * waves are executed by control_batch().
+ *
+ *  @file
+ */
+
+
+typedef enum {
+        Process_Stopped = 0,
+        Process_Started
+} Process_Status;
+
+
+/** Start and/or stop of a service in a batch */
+typedef struct myjob {
+        Service_T s;
+        int depth;               /**< Longest chain of services s depends on */
+        int stop;  /**< The action causing the stop (ACTION_STOP unmonitors) or 0 */
+        int start;                             /**< TRUE if s has to be started */
+        int expanded;              /**< TRUE if the dependants were marked */
+        int wait;                /**< TRUE if the worker called wait_process() */
+        Process_Status status;                   /**< The wait_process() result */
+} *Job_T;
+
+
+typedef struct mybatch {
+        Job_T jobs;                                    /**< One job per service */
+        int count;
+} *Batch_T;
+
+
+/**
+ * Get the job of the service with the given name
+ * @param batch The batch
+ * @param name A service name
+ * @return The job or NULL if there is no such service
+ */
+Job_T Batch_getJob(Batch_T batch, const char *name);
+
+
+/**
+ * Get the depth of the service in the dependency graph, 0 if it does not
+ * depend on other services, otherwise the depth of its deepest dependency
+ * plus one. The depth of a job has to be initialized to -1. The graph has
+ * no cycles, this was verified by the parser.
+ * @param batch The batch
+ * @param j A job
+ * @return The depth
+ */
+int Batch_getDepth(Batch_T batch, Job_T j);
+
+
+/**
+ * Mark the service and every service it depends on for start, see
+ * do_start() in control.c
+ * @param batch The batch
+ * @param j A job
+ */
+void Batch_markStart(Batch_T batch, Job_T j);
+
+
+/**
+ * Mark every service which depends on the service, see do_depend() in
+ * control.c. If stop is 0, the marks are cleared instead.
+ * @param batch The batch
+ * @param j A job
+ * @param stop The action causing the stop or 0
+ * @param start TRUE if the services have to be started again
+ */
+void Batch_markDependants(Batch_T batch, Job_T j, int stop, int start);
+
+
+#endif
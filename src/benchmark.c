@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+#include "monit.h"
+#include "process.h"
+#include "state.h"
+#include "engine.h"
+#include "digest.h"
+
+// libmonit
+#include "util/StringBuffer.h"
+
+
+/**
+ * Measure the duration of the check cycle phases. The services of the
+ * control file are validated the given number of times and the minimum,
+ * average and maximum duration of each phase is printed. Afterwards the
+ * build of a synthetic tree of 100000 processes is timed, the throughput
+ * of the checksum algorithms is measured, as well as the teardown and
+ * parsing of the configuration as done on reload. Together
+ * with a synthetic control file and /proc tree (see contrib/benchmark.sh)
+ * it allows to compare the performance of Monit versions reproducibly.
+ *
+ * @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+typedef enum {
+        Phase_Prepare = 0,
+        Phase_Collect,
+        Phase_Check,
+        Phase_Event,
+        Phase_State,
+        Phase_Status,
+        Phase_Total
+} Phase_Type;
+
+
+static const char *phasenames[] = {"preparation", "process tree", "checks", "events", "state save", "status", "total"};
+
+
+static struct {
+        long long min;
+        long long max;
+        long long sum;
+} phases[Phase_Total + 1];
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static void record(Phase_Type phase, long long duration) {
+        if (duration < phases[phase].min)
+                phases[phase].min = duration;
+        if (duration > phases[phase].max)
+                phases[phase].max = duration;
+        phases[phase].sum += duration;
+}
+
+
+/* Look up pseudo random IPv4 addresses in the http allow list for about a second */
+static void benchmark_allow() {
+        unsigned int x = 2463534242U;
+        long long lookups = 0, allowed = 0, elapsed;
+        long long start;
+        compile_hosts_allow();
+        start = Util_monotonic();
+        do {
+                for (int i = 0; i < 65536; i++, lookups++) {
+                        x ^= x << 13;
+                        x ^= x >> 17;
+                        x ^= x << 5;
+                        allowed += match_host_allow(AF_INET, &x);
+                }
+        } while ((elapsed = Util_monotonic() - start) < 1000000);
+        printf("Allow list: %.0f lookups/s, %.1f%% allowed\n", lookups * 1000000. / elapsed, allowed * 100. / lookups);
+}
+
+
+/* Build and sum up a synthetic process tree with a deep fork chain, the best of 10 runs */
+static void benchmark_processtree(int processes) {
+        unsigned int x = 2463534242U;
+        long long best = LLONG_MAX;
+        for (int n = 0; n < 10; n++) {
+                int size = processes;
+                long long start;
+                ProcessTree_T *pt = CALLOC(size, sizeof(ProcessTree_T));
+                for (int i = 0; i < size; i++) {
+                        x ^= x << 13;
+                        x ^= x >> 17;
+                        x ^= x << 5;
+                        pt[i].pid = i + 1;
+                        pt[i].ppid = i < size / 10 ? i : (int)(x % i) + 1;
+                        pt[i].mem_kbyte = x % 100000;
+                }
+                start = Util_monotonic();
+                buildprocesstree(&pt, &size, NULL, 0);
+                long long elapsed = Util_monotonic() - start;
+                if (elapsed < best)
+                        best = elapsed;
+                delprocesstree(&pt, &size);
+        }
+        printf("Process tree: %d processes linked and summed up in %.3f ms\n", processes, best / 1000.);
+}
+
+
+/* Hash a 16MB buffer with each checksum algorithm, the best of 5 runs */
+static void benchmark_checksum() {
+        int size = 16 * 1024 * 1024;
+        unsigned char *buffer = ALLOC(size);
+        unsigned int x = 2463534242U;
+        for (int i = 0; i < size; i++) {
+                x ^= x << 13;
+                x ^= x >> 17;
+                x ^= x << 5;
+                buffer[i] = (unsigned char)x;
+        }
+        for (int type = HASH_MD5; type <= HASH_XXH64; type++) {
+                long long best = LLONG_MAX;
+                for (int n = 0; n < 5; n++) {
+                        Digest_T digest;
+                        unsigned char hash[MD_SIZE];
+                        long long start = Util_monotonic();
+                        Digest_init(&digest, type);
+                        for (int i = 0; i < size; i += 32768)
+                                Digest_append(&digest, buffer + i, 32768);
+                        Digest_finish(&digest, hash);
+                        long long elapsed = Util_monotonic() - start;
+                        if (elapsed < best)
+                                best = elapsed;
+                }
+                printf("Checksum %-6s %8.0f MB/s\n", Digest_name(type), size / (double)(best > 0 ? best : 1));
+        }
+        FREE(buffer);
+}
+
+
+/* Release and parse the configuration like a reload does */
+static void benchmark_reload(int reloads) {
+        long long teardown = 0, parsing = 0;
+        long long start;
+        for (int i = 0; i < reloads; i++) {
+                start = Util_monotonic();
+                gc();
+                teardown += Util_monotonic() - start;
+                start = Util_monotonic();
+                if (! parse(Run.controlfile)) {
+                        LogError("%s: cannot parse the control file '%s'\n", prog, Run.controlfile);
+                        exit(1);
+                }
+                parsing += Util_monotonic() - start;
+        }
+        printf("Reload: teardown %.3f ms, parse %.3f ms (average of %d, configuration %ld bytes)\n", teardown / 1000. / reloads, parsing / 1000. / reloads, reloads, Arena_bytes(Run.arena));
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void benchmark(int cycles, const char *procfs) {
+        int services = 0;
+        char *savedstatefile = Run.statefile;
+        char statefile[] = "/tmp/monit.benchmark.XXXXXX";
+        long long start;
+
+        if (cycles <= 0) {
+                printf("Invalid syntax - usage: benchmark [cycles [procdir]]\n");
+                exit(1);
+        }
+        if (procfs) {
+                Run.procfs = (char *)procfs;
+                Run.doprocess = init_process_info();
+        }
+        int fd = mkstemp(statefile);
+        if (fd == -1) {
+                LogError("%s: cannot create the benchmark state file -- %s\n", prog, STRERROR);
+                exit(1);
+        }
+        close(fd);
+        Run.statefile = statefile;
+        if (! State_open())
+                exit(1);
+        for (Service_T s = servicelist; s; s = s->next)
+                services++;
+        for (int i = 0; i <= Phase_Total; i++)
+                phases[i].min = LLONG_MAX;
+        for (int i = 0; i < cycles && ! Run.stopped; i++) {
+                long long cycle = Util_monotonic();
+                validate();
+                record(Phase_Prepare, Run.cycle.prepare);
+                record(Phase_Collect, Run.cycle.collect);
+                record(Phase_Check, Run.cycle.check);
+                record(Phase_Event, Run.cycle.event);
+                start = Util_monotonic();
+                State_save();
+                record(Phase_State, Util_monotonic() - start);
+                start = Util_monotonic();
+                StringBuffer_T B = StringBuffer_create(65536);
+                status_xml(B, NULL, LEVEL_FULL, 2, "localhost");
+                StringBuffer_free(&B);
+                record(Phase_Status, Util_monotonic() - start);
+                record(Phase_Total, Util_monotonic() - cycle);
+        }
+        State_close();
+        unlink(statefile);
+        Run.statefile = savedstatefile;
+        printf("Benchmark: %d cycles, %d services, %d processes (%s)\n", cycles, services, ptreesize, Run.procfs);
+        printf("%-14s %12s %12s %12s\n", "Phase", "min [ms]", "avg [ms]", "max [ms]");
+        for (int i = 0; i <= Phase_Total; i++)
+                printf("%-14s %12.3f %12.3f %12.3f\n", phasenames[i], phases[i].min / 1000., phases[i].sum / 1000. / cycles, phases[i].max / 1000.);
+        printf("The checks include the events posted by the checks\n");
+        if (has_hosts_allow())
+                benchmark_allow();
+        benchmark_processtree(100000);
+        benchmark_checksum();
+        benchmark_reload(cycles);
+}
+
@@ -52,10 +52,16 @@
 #include <unistd.h>
 #endif
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
 #include "monit.h"
 #include "net.h"
 #include "socket.h"
 #include "event.h"
+#include "process.h"
+#include "batch.h"
 #include "system/Time.h"
 
 
@@ -69,10 +75,22 @@
 /* ------------------------------------------------------------- Definitions */
 
 
-typedef enum {
-        Process_Stopped = 0,
-        Process_Started
-} Process_Status;
+/* Longest delay in milliseconds between two liveness tests in wait_process() */
+#define WAIT_MAX 250
+
+
+/* The jobs of one wave, the worker threads take them in turn */
+typedef struct mywave {
+        Job_T *jobs;
+        int count;
+        int next;                                     /**< The next job to take */
+        int start;                   /**< TRUE for the start wave, FALSE for stop */
+        pthread_mutex_t mutex;
+} *Wave_T;
+
+
+/* The batch workers rebuild the global process tree in turn, see is_running() */
+static pthread_mutex_t ptree_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 
 /* -------------------------------------------------------------- Prototypes */
@@ -83,7 +101,16 @@ static int  do_stop(Service_T, int);
 static void do_monitor(Service_T, int);
 static void do_unmonitor(Service_T, int);
 static void do_depend(Service_T, int, int);
-static Process_Status wait_process(Service_T, Process_Status expect);
+static int  exec_start(Service_T);
+static int  exec_stop(Service_T, int *);
+static pid_t is_running(Service_T, int quiet);
+static Process_Status wait_process(Service_T, Process_Status expect, int watch);
+static Process_Status confirm_process(Service_T, Process_Status expect, Process_Status status);
+static void run_batch(Batch_T, int);
+static void run_wave(Batch_T, int, int);
+static void *do_wave(void *);
+static Socket_T connect_daemon();
+static int  post_daemon(const char *, const char *);
 
 
 /* ------------------------------------------------------------------ Public */
@@ -96,82 +123,42 @@ static Process_Status wait_process(Service_T, Process_Status expect);
  * @return FALSE for error, otherwise TRUE
  */
 int control_service_daemon(const char *S, const char *action) {
-        int rv = FALSE;
-        int status, content_length = 0;
-        Socket_T socket;
-        char *auth;
-        char buf[STRLEN];
+        char form[STRLEN];
         ASSERT(S);
         ASSERT(action);
         if (Util_getAction(action) == ACTION_IGNORE) {
                 LogError("%s: Cannot %s service '%s' -- invalid action %s\n", prog, action, S, action);
                 return FALSE;
         }
-        socket = socket_create_t(Run.bind_addr ? Run.bind_addr : "localhost", Run.httpdport, SOCKET_TCP, 
-                            (Ssl_T){.use_ssl = Run.httpdssl, .clientpemfile = Run.httpsslclientpem}, NET_TIMEOUT);
-        if (! socket) {
-                LogError("%s: Cannot connect to the monit daemon. Did you start it with http support?\n", prog);
-                return FALSE;
-        }
+        snprintf(form, sizeof(form), "action=%s", action);
+        return post_daemon(S, form);
+}
 
-        /* Send request */
-        auth = Util_getBasicAuthHeaderMonit();
-        if (socket_print(socket,
-                "POST /%s HTTP/1.0\r\n"
-                "Content-Type: application/x-www-form-urlencoded\r\n"
-                "Content-Length: %d\r\n"
-                "%s"
-                "\r\n"
-                "action=%s",
-                S,
-                strlen("action=") + strlen(action),
-                auth ? auth : "",
-                action) < 0)
-        {
-                LogError("%s: Cannot send the command '%s' to the monit daemon -- %s", prog, action ? action : "null", STRERROR);
-                goto err1;
-        }
 
-        /* Process response */
-        if (! socket_readln(socket, buf, STRLEN)) {
-                LogError("%s: error receiving data -- %s\n", prog, STRERROR);
-                goto err1;
+/**
+ * Pass an action for all services or all members of a service group to
+ * the monit daemon in one request, see handle_do_action() in cervlet.c
+ * @param G A service group name or NULL for all services
+ * @param action A string describing the action to execute
+ * @return FALSE for error, otherwise TRUE
+ */
+int control_group_daemon(const char *G, const char *action) {
+        int rv;
+        char *form;
+        ASSERT(action);
+        if (Util_getAction(action) == ACTION_IGNORE) {
+                LogError("%s: Cannot %s services -- invalid action %s\n", prog, action, action);
+                return FALSE;
         }
-        Str_chomp(buf);
-        if (! sscanf(buf, "%*s %d", &status)) {
-                LogError("%s: cannot parse status in response: %s\n", prog, buf);
-                goto err1;
+        if (G) {
+                char *group = Util_urlEncode((char *)G);
+                form = Str_cat("action=%s&group=%s", action, group);
+                FREE(group);
+        } else {
+                form = Str_cat("action=%s&service=all", action);
         }
-        if (status >= 300) {
-                char *message = NULL;
-
-                /* Skip headers */
-                while (socket_readln(socket, buf, STRLEN)) {
-                        if (! strncmp(buf, "\r\n", sizeof(buf)))
-                                break;
-                        if (Str_startsWith(buf, "Content-Length") && ! sscanf(buf, "%*s%*[: ]%d", &content_length))
-                                goto err1;
-                }
-                if (content_length > 0 && content_length < 1024 && socket_readln(socket, buf, STRLEN)) {
-                        char token[] = "</h2>";
-                        char *p = strstr(buf, token);
-                        if (strlen(p) <= strlen(token))
-                                goto err2;
-                        p += strlen(token);
-                        message = CALLOC(1, content_length + 1);
-                        snprintf(message, content_length + 1, "%s", p);
-                        p = strstr(message, "<p>");
-                        if (p)
-                                *p = 0;
-                }
-err2:
-                LogError("%s: action failed -- %s\n", prog, message ? message : "unable to parse response");
-                FREE(message);
-        } else
-                rv = TRUE;
-err1:
-        FREE(auth);
-        socket_free(&socket);
+        rv = post_daemon("_doaction", form);
+        FREE(form);
         return rv;
 }
 
@@ -273,6 +260,40 @@ int control_service(const char *S, int A) {
 }
 
 
+/**
+ * Execute the scheduled start, stop and restart actions of the services
+ * (Service_T.doaction) in parallel. The services are started and stopped
+ * in waves following the dependency graph: services are stopped before
+ * the services they depend on and started after them. Up to Run.concurrency
+ * services of a wave are handled at once, so the time for a group or all
+ * services action scales with the depth of the dependencies rather than
+ * with the number of services. Handled actions are reset, the remaining
+ * ones are left for control_service().
+ */
+void control_batch() {
+        int count = 0, scheduled = 0;
+        Service_T s;
+        struct mybatch batch;
+        if (Run.concurrency < 2)
+                return;
+        for (s = servicelist; s; s = s->next, count++)
+                if (s->doaction == ACTION_START || s->doaction == ACTION_STOP || s->doaction == ACTION_RESTART)
+                        scheduled++;
+        if (scheduled < 2)
+                return;
+        batch.count = count;
+        batch.jobs = CALLOC(count, sizeof(struct myjob));
+        for (s = servicelist, count = 0; s; s = s->next, count++) {
+                batch.jobs[count].s = s;
+                batch.jobs[count].depth = -1;
+        }
+        run_batch(&batch, ACTION_STOP);
+        run_batch(&batch, ACTION_RESTART);
+        run_batch(&batch, ACTION_START);
+        FREE(batch.jobs);
+}
+
+
 /*
  * Reset the visited flags used when handling dependencies
  */
@@ -288,6 +309,102 @@ void reset_depend() {
 /* ----------------------------------------------------------------- Private */
 
 
+/**
+ * Connect to the monit daemon http server, using the local control
+ * socket if configured, otherwise the TCP port
+ * @return The socket or NULL if the connection failed
+ */
+static Socket_T connect_daemon() {
+        Socket_T socket;
+        if (Run.httpdsocket) {
+                if ((socket = socket_create_u(Run.httpdsocket, NET_TIMEOUT)))
+                        return socket;
+                DEBUG("%s: Cannot connect to the control socket %s -- using port %d\n", prog, Run.httpdsocket, Run.httpdport);
+        }
+        return socket_create_t(Run.bind_addr ? Run.bind_addr : "localhost", Run.httpdport, SOCKET_TCP,
+                            (Ssl_T){.use_ssl = Run.httpdssl, .clientpemfile = Run.httpsslclientpem}, NET_TIMEOUT);
+}
+
+
+/**
+ * Post a form to the monit daemon http server
+ * @param path The request path (without the leading slash)
+ * @param form The urlencoded form
+ * @return FALSE for error, otherwise TRUE
+ */
+static int post_daemon(const char *path, const char *form) {
+        int rv = FALSE;
+        int status, content_length = 0;
+        Socket_T socket;
+        char *auth;
+        char buf[STRLEN];
+        if (! (socket = connect_daemon())) {
+                LogError("%s: Cannot connect to the monit daemon. Did you start it with http support?\n", prog);
+                return FALSE;
+        }
+
+        /* Send request */
+        auth = Util_getBasicAuthHeaderMonit();
+        if (socket_print(socket,
+                "POST /%s HTTP/1.0\r\n"
+                "Content-Type: application/x-www-form-urlencoded\r\n"
+                "Content-Length: %d\r\n"
+                "%s"
+                "\r\n"
+                "%s",
+                path,
+                strlen(form),
+                auth ? auth : "",
+                form) < 0)
+        {
+                LogError("%s: Cannot send the command '%s' to the monit daemon -- %s", prog, form, STRERROR);
+                goto err1;
+        }
+
+        /* Process response */
+        if (! socket_readln(socket, buf, STRLEN)) {
+                LogError("%s: error receiving data -- %s\n", prog, STRERROR);
+                goto err1;
+        }
+        Str_chomp(buf);
+        if (! sscanf(buf, "%*s %d", &status)) {
+                LogError("%s: cannot parse status in response: %s\n", prog, buf);
+                goto err1;
+        }
+        if (status >= 300) {
+                char *message = NULL;
+
+                /* Skip headers */
+                while (socket_readln(socket, buf, STRLEN)) {
+                        if (! strncmp(buf, "\r\n", sizeof(buf)))
+                                break;
+                        if (Str_startsWith(buf, "Content-Length") && ! sscanf(buf, "%*s%*[: ]%d", &content_length))
+                                goto err1;
+                }
+                if (content_length > 0 && content_length < 1024 && socket_readln(socket, buf, STRLEN)) {
+                        char token[] = "</h2>";
+                        char *p = strstr(buf, token);
+                        if (strlen(p) <= strlen(token))
+                                goto err2;
+                        p += strlen(token);
+                        message = CALLOC(1, content_length + 1);
+                        snprintf(message, content_length + 1, "%s", p);
+                        p = strstr(message, "<p>");
+                        if (p)
+                                *p = 0;
+                }
+err2:
+                LogError("%s: action failed -- %s\n", prog, message ? message : "unable to parse response");
+                FREE(message);
+        } else
+                rv = TRUE;
+err1:
+        FREE(auth);
+        socket_free(&socket);
+        return rv;
+}
+
+
 /*
  * This is a post- fix recursive function for starting every service
  * that s depends on before starting s.
@@ -307,14 +424,25 @@ static void do_start(Service_T s, int flag) {
                         do_start(parent, flag);
                 }
         }
-        if (s->start && (s->type != TYPE_PROCESS || !Util_isProcessRunning(s, FALSE))) {
+        if (exec_start(s))
+                confirm_process(s, Process_Started, wait_process(s, Process_Started, -1));
+        Util_monitorSet(s);
+}
+
+
+/*
+ * Execute the start method of the service unless the process is running
+ * @param s A Service_T object
+ * @return TRUE if the start of a process has to be waited for
+ */
+static int exec_start(Service_T s) {
+        if (s->start && (s->type != TYPE_PROCESS || ! is_running(s, FALSE))) {
                 LogInfo("'%s' start: %s\n", s->name, s->start->arg[0]);
                 spawn(s, s->start, NULL);
                 /* We only wait for a process type, other service types does not have a pid file to watch */
-                if (s->type == TYPE_PROCESS)
-                        wait_process(s, Process_Started);
+                return s->type == TYPE_PROCESS;
         }
-        Util_monitorSet(s);
+        return FALSE;
 }
 
 
@@ -325,17 +453,13 @@ static void do_start(Service_T s, int flag) {
  * @return TRUE if the service was stopped otherwise FALSE
  */
 static int do_stop(Service_T s, int flag) {
-        int rv = TRUE;
+        int rv = TRUE, watch;
         ASSERT(s);
         if (s->depend_visited)
                 return rv;
         s->depend_visited = TRUE;
-        if (s->stop && (s->type != TYPE_PROCESS || Util_isProcessRunning(s, FALSE))) {
-                LogInfo("'%s' stop: %s\n", s->name, s->stop->arg[0]);
-                spawn(s, s->stop, NULL);
-                if (s->type == TYPE_PROCESS && (wait_process(s, Process_Stopped) != Process_Stopped)) // Only wait for process service types stop
-                        rv = FALSE;
-        }
+        if (exec_stop(s, &watch) && confirm_process(s, Process_Stopped, wait_process(s, Process_Stopped, watch)) != Process_Stopped)
+                rv = FALSE;
         if (flag)
                 Util_monitorUnset(s);
         else
@@ -345,6 +469,28 @@ static int do_stop(Service_T s, int flag) {
 }
 
 
+/*
+ * Execute the stop method of the service if it is running
+ * @param s A Service_T object
+ * @param watch Set to a process_watch() descriptor for the process or -1
+ * @return TRUE if the stop of a process has to be waited for
+ */
+static int exec_stop(Service_T s, int *watch) {
+        pid_t pid = 0;
+        *watch = -1;
+        if (s->stop && (s->type != TYPE_PROCESS || (pid = is_running(s, FALSE)))) {
+                /* Watch the process before the stop method runs, so its pid cannot be reused before we look */
+                if (s->type == TYPE_PROCESS)
+                        *watch = process_watch(pid);
+                LogInfo("'%s' stop: %s\n", s->name, s->stop->arg[0]);
+                spawn(s, s->stop, NULL);
+                /* Only wait for process service types stop */
+                return s->type == TYPE_PROCESS;
+        }
+        return FALSE;
+}
+
+
 /*
  * This is a post- fix recursive function for enabling monitoring every service
  * that s depends on before monitor s.
@@ -417,41 +563,288 @@ static void do_depend(Service_T s, int action, int flag) {
 }
 
 
+/*
+ * Test if the process of the service is running without rebuilding the
+ * process tree. The pid is read from the pidfile or found by reading
+ * just the command lines from /proc and then tested directly. Only if
+ * the command lines are not available the process tree is rebuilt, one
+ * worker at a time.
+ * @param s A Service_T object
+ * @param quiet TRUE to skip the debug message for a missing pidfile
+ * @return The pid of the process if it is running otherwise 0
+ */
+static pid_t is_running(Service_T s, int quiet) {
+        pid_t pid;
+        if (s->matchlist) {
+                if ((pid = process_findmatch(s->matchlist)) < 0) {
+                        /* No command lines in /proc, scan the process table */
+                        LOCK(ptree_mutex)
+                        {
+                                pid = Util_isProcessRunning(s, TRUE);
+                        }
+                        END_LOCK;
+                        return pid;
+                }
+        } else {
+                if (quiet && ! file_exist(s->path))
+                        return 0;
+                pid = Util_getPid(s->path);
+        }
+        return process_isalive(pid) ? pid : 0;
+}
+
+
 /*
  * This function waits for the process to change state. If the process state doesn't match the expectation,
  * a failed event is posted to notify the user. The time is saved on enter so in the case that the time steps
  * backwards/forwards, the wait_process will wait for absolute time and not stall or prematurely exit.
+ * While waiting for a stop, the process exit is noticed immediately if a
+ * process_watch() descriptor is given, otherwise the process is tested
+ * with a growing delay of up to WAIT_MAX milliseconds. The result has to
+ * be passed to confirm_process(), which posts the event.
  * @param service A Service to wait for
  * @param expect A expected state (see Process_Status)
+ * @param watch A descriptor from process_watch() or -1, it is closed
  * @return Either Process_Started if the process is running or Process_Stopped if it's not running
  */
-static Process_Status wait_process(Service_T s, Process_Status expect) {
-        int debug = Run.debug, isrunning = FALSE;
-        unsigned long now = time(NULL) * 1000, wait = 50;
-        unsigned long timeout = now + s->start->timeout * 1000;
+static Process_Status wait_process(Service_T s, Process_Status expect, int watch) {
+        int quiet = FALSE, isrunning = FALSE;
+        command_t C;
+        unsigned long now = time(NULL) * 1000, wait = 10;
+        unsigned long timeout;
         ASSERT(s);
+        C = expect == Process_Started ? s->start : s->stop;
+        timeout = now + C->timeout * 1000;
         do {
-                Time_usleep(wait * USEC_PER_MSEC);
-                now += wait ;
-                wait = wait < 1000 ? wait * 2 : 1000; // double the wait during each cycle until 1s is reached
-                isrunning = Util_isProcessRunning(s, TRUE);
+#ifdef HAVE_POLL_H
+                if (watch >= 0) {
+                        /* The descriptor becomes readable when the process exits */
+                        struct pollfd fds[1] = {{.fd = watch, .events = POLLIN}};
+                        int r;
+                        wait = 1000;
+                        while ((r = poll(fds, 1, (int)wait)) < 0 && errno == EINTR)
+                                ; // interrupted by a signal, the process didn't exit
+                        if (r != 0) {
+                                close(watch);
+                                watch = -1;
+                                wait = 10;
+                        }
+                } else
+#endif
+                {
+                        Time_usleep(wait * USEC_PER_MSEC);
+                        wait = wait < WAIT_MAX ? wait * 2 : WAIT_MAX; // double the wait during each cycle until WAIT_MAX is reached
+                }
+                now += wait;
+                isrunning = is_running(s, quiet) ? TRUE : FALSE;
                 if ((expect == Process_Stopped && ! isrunning) || (expect == Process_Started && isrunning))
                         break;
-                Run.debug = FALSE; // Turn off debug second time through to avoid flooding the log with pid file does not exist. This poll stuff here _will_ be refactored away
+                quiet = TRUE; // Be quiet second time through to avoid flooding the log with pid file does not exist
         } while (now < timeout && ! Run.stopped);
-        Run.debug = debug; // restore the debug state
-        if (isrunning) {
+        if (watch >= 0)
+                close(watch);
+        return isrunning ? Process_Started : Process_Stopped;
+}
+
+
+/*
+ * Post the event for the result of wait_process(): the process state matches
+ * the expectation or the start/stop failed
+ * @param service A Service waited for
+ * @param expect A expected state (see Process_Status)
+ * @param status The state returned by wait_process()
+ * @return The status
+ */
+static Process_Status confirm_process(Service_T s, Process_Status expect, Process_Status status) {
+        if (status == Process_Started) {
                 if (expect == Process_Started)
                         Event_post(s, Event_Exec, STATE_SUCCEEDED, s->action_EXEC, "started");
                 else
                         Event_post(s, Event_Exec, STATE_FAILED, s->action_EXEC, "failed to stop");
-                return Process_Started;
         } else {
                 if (expect == Process_Started)
                         Event_post(s, Event_Exec, STATE_FAILED, s->action_EXEC, "failed to start");
                 else
                         Event_post(s, Event_Exec, STATE_SUCCEEDED, s->action_EXEC, "stopped");
-                return Process_Stopped;
         }
+        return status;
+}
+
+
+
+/*
+ * Execute the scheduled action for all services in the batch. The services
+ * affected by the action are marked as control_service() would handle them
+ * one by one, then the marked services are stopped and started in waves.
+ * @param batch The batch
+ * @param action The scheduled action to execute
+ */
+static void run_batch(Batch_T batch, int action) {
+        int i, depth, max = 0, scheduled = 0;
+        for (i = 0; i < batch->count; i++) {
+                Job_T j = &batch->jobs[i];
+                Service_T s = j->s;
+                j->stop = j->start = j->expanded = j->wait = FALSE;
+                if (s->doaction != action)
+                        continue;
+                scheduled++;
+                switch (action) {
+                        case ACTION_START:
+                                if (s->type == TYPE_PROCESS) {
+                                        if (Util_isProcessRunning(s, FALSE)) {
+                                                DEBUG("%s: Process already running -- process %s\n", prog, s->name);
+                                                Util_monitorSet(s);
+                                                continue;
+                                        }
+                                        if (!s->start) {
+                                                LogError("%s: Start method not defined -- process %s\n", prog, s->name);
+                                                Util_monitorSet(s);
+                                                continue;
+                                        }
+                                }
+                                Batch_markDependants(batch, j, ACTION_START, TRUE);
+                                Batch_markStart(batch, j);
+                                break;
+
+                        case ACTION_STOP:
+                                if (s->type == TYPE_PROCESS && !s->stop) {
+                                        LogError("%s: Stop method not defined -- process %s\n", prog, s->name);
+                                        Util_monitorUnset(s);
+                                        continue;
+                                }
+                                Batch_markDependants(batch, j, ACTION_STOP, FALSE);
+                                if (! s->depend_visited)
+                                        j->stop = ACTION_STOP;
+                                break;
+
+                        case ACTION_RESTART:
+                                if (s->type == TYPE_PROCESS && (!s->start || !s->stop)) {
+                                        LogError("%s: Start or stop method not defined -- process %s\n", prog, s->name);
+                                        Util_monitorSet(s);
+                                        continue;
+                                }
+                                LogInfo("'%s' trying to restart\n", s->name);
+                                Batch_markDependants(batch, j, ACTION_RESTART, TRUE);
+                                if (! s->depend_visited)
+                                        j->stop = ACTION_RESTART;
+                                Batch_markStart(batch, j);
+                                break;
+                }
+        }
+        if (! scheduled)
+                return;
+        for (i = 0; i < batch->count; i++) {
+                Job_T j = &batch->jobs[i];
+                if (j->stop)
+                        j->s->depend_visited = TRUE;
+                if (j->start)
+                        j->s->visited = TRUE;
+                if ((j->stop || j->start) && Batch_getDepth(batch, j) > max)
+                        max = j->depth;
+        }
+        /* Stop the services which depend on others first */
+        for (depth = max; depth >= 0 && ! Run.stopped; depth--)
+                run_wave(batch, depth, FALSE);
+        /* Only start if stop succeeded, the services depending on a service which failed to stop are left stopped */
+        for (i = 0; i < batch->count; i++) {
+                Job_T j = &batch->jobs[i];
+                if (j->s->doaction == ACTION_RESTART && j->stop && j->wait && j->status != Process_Stopped) {
+                        /* enable monitoring of this service again to allow the restart retry in the next cycle up to timeout limit */
+                        Util_monitorSet(j->s);
+                        j->start = FALSE;
+                        Batch_markDependants(batch, j, 0, FALSE);
+                }
+        }
+        for (depth = 0; depth <= max && ! Run.stopped; depth++)
+                run_wave(batch, depth, TRUE);
+        for (i = 0; i < batch->count; i++) {
+                Service_T s = batch->jobs[i].s;
+                if (s->doaction == action) {
+                        Event_post(s, Event_Action, STATE_CHANGED, s->action_ACTION, "%s action done", actionnames[action]);
+                        s->doaction = ACTION_IGNORE;
+                        FREE(s->token);
+                }
+        }
+}
+
+
+/*
+ * Start or stop the marked services of the given depth on up to
+ * Run.concurrency threads and post the events when all are done
+ * @param batch The batch
+ * @param depth The depth of the services in the wave
+ * @param start TRUE to start the services, FALSE to stop them
+ */
+static void run_wave(Batch_T batch, int depth, int start) {
+        int i, workers = 0;
+        struct mywave wave = {.start = start};
+        wave.jobs = CALLOC(batch->count, sizeof(Job_T));
+        for (i = 0; i < batch->count; i++) {
+                Job_T j = &batch->jobs[i];
+                if ((start ? j->start : j->stop) && j->depth == depth) {
+                        j->wait = FALSE;
+                        wave.jobs[wave.count++] = j;
+                }
+        }
+        if (wave.count) {
+                pthread_t *threads = CALLOC(MIN(Run.concurrency, wave.count), sizeof(pthread_t));
+                pthread_mutex_init(&wave.mutex, NULL);
+                /* This thread is one of the workers */
+                for (i = 1; i < Run.concurrency && i < wave.count; i++, workers++) {
+                        if (pthread_create(&threads[workers], NULL, do_wave, &wave) != 0) {
+                                LogError("%s: Cannot create a worker thread -- %s\n", prog, STRERROR);
+                                break;
+                        }
+                }
+                do_wave(&wave);
+                for (i = 0; i < workers; i++)
+                        pthread_join(threads[i], NULL);
+                FREE(threads);
+                pthread_mutex_destroy(&wave.mutex);
+                for (i = 0; i < wave.count; i++) {
+                        Job_T j = wave.jobs[i];
+                        if (start) {
+                                if (j->wait)
+                                        confirm_process(j->s, Process_Started, j->status);
+                                Util_monitorSet(j->s);
+                        } else {
+                                if (j->wait)
+                                        confirm_process(j->s, Process_Stopped, j->status);
+                                if (j->stop == ACTION_STOP)
+                                        Util_monitorUnset(j->s);
+                                else
+                                        Util_resetInfo(j->s);
+                        }
+                }
+        }
+        FREE(wave.jobs);
+}
+
+
+/*
+ * Worker thread: start or stop the services of the wave until all are taken.
+ * The events are posted by run_wave() when the wave is done.
+ * @param wave The wave
+ */
+static void *do_wave(void *wave) {
+        Wave_T w = wave;
+        while (TRUE) {
+                Job_T j = NULL;
+                LOCK(w->mutex)
+                        if (w->next < w->count)
+                                j = w->jobs[w->next++];
+                END_LOCK;
+                if (! j)
+                        break;
+                if (w->start) {
+                        if ((j->wait = exec_start(j->s)))
+                                j->status = wait_process(j->s, Process_Started, -1);
+                } else {
+                        int watch;
+                        if ((j->wait = exec_stop(j->s, &watch)))
+                                j->status = wait_process(j->s, Process_Stopped, watch);
+                }
+        }
+        return NULL;
 }
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_OPENSSL
+#include <openssl/evp.h>
+#endif
+
+#include "monit.h"
+#include "digest.h"
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+/* Length of the raw digest in bytes, indexed by the hash type */
+static const int lengths[] = {0, 16, 20, 32, 8};
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+#ifdef HAVE_OPENSSL
+static const EVP_MD *evp_md(int type) {
+        switch (type) {
+                case HASH_MD5:
+                        return EVP_md5();
+                case HASH_SHA1:
+                        return EVP_sha1();
+                case HASH_SHA256:
+                        return EVP_sha256();
+                default:
+                        return NULL;
+        }
+}
+#endif
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+int Digest_length(int type) {
+        return (type > HASH_UNKNOWN && type <= HASH_XXH64) ? lengths[type] : 0;
+}
+
+
+const char *Digest_name(int type) {
+        return checksumnames[Digest_length(type) ? type : HASH_UNKNOWN];
+}
+
+
+int Digest_typeOf(int length) {
+        for (int type = HASH_MD5; type <= HASH_XXH64; type++)
+                if (lengths[type] * 2 == length)
+                        return type;
+        return HASH_UNKNOWN;
+}
+
+
+int Digest_init(Digest_T *d, int type) {
+        ASSERT(d);
+        d->type = type;
+        d->evp = NULL;
+#ifdef HAVE_OPENSSL
+        const EVP_MD *md = evp_md(type);
+        if (md) {
+                EVP_MD_CTX *ctx = EVP_MD_CTX_create();
+                if (ctx && EVP_DigestInit_ex(ctx, md, NULL)) {
+                        d->evp = ctx;
+                        return TRUE;
+                }
+                if (ctx)
+                        EVP_MD_CTX_destroy(ctx);
+                /* The digest may be disabled, for example MD5 in FIPS mode, fall back to the bundled implementation */
+        }
+#endif
+        switch (type) {
+                case HASH_MD5:
+                        md5_init(&d->ctx.md5);
+                        return TRUE;
+                case HASH_SHA1:
+                        sha1_init(&d->ctx.sha1);
+                        return TRUE;
+                case HASH_SHA256:
+                        sha256_init(&d->ctx.sha256);
+                        return TRUE;
+                case HASH_XXH64:
+                        xxh64_init(&d->ctx.xxh64);
+                        return TRUE;
+                default:
+                        return FALSE;
+        }
+}
+
+
+void Digest_append(Digest_T *d, const void *data, size_t length) {
+        ASSERT(d);
+#ifdef HAVE_OPENSSL
+        if (d->evp) {
+                EVP_DigestUpdate(d->evp, data, length);
+                return;
+        }
+#endif
+        switch (d->type) {
+                case HASH_MD5:
+                        md5_append(&d->ctx.md5, (const md5_byte_t *)data, (int)length);
+                        break;
+                case HASH_SHA1:
+                        sha1_append(&d->ctx.sha1, data, length);
+                        break;
+                case HASH_SHA256:
+                        sha256_append(&d->ctx.sha256, data, length);
+                        break;
+                case HASH_XXH64:
+                        xxh64_append(&d->ctx.xxh64, data, length);
+                        break;
+        }
+}
+
+
+int Digest_finish(Digest_T *d, unsigned char *digest) {
+        ASSERT(d);
+        ASSERT(digest);
+#ifdef HAVE_OPENSSL
+        if (d->evp) {
+                unsigned int length = 0;
+                EVP_DigestFinal_ex(d->evp, digest, &length);
+                EVP_MD_CTX_destroy((EVP_MD_CTX *)d->evp);
+                d->evp = NULL;
+                return (int)length;
+        }
+#endif
+        switch (d->type) {
+                case HASH_MD5:
+                        md5_finish(&d->ctx.md5, (md5_byte_t *)digest);
+                        break;
+                case HASH_SHA1:
+                        sha1_finish(&d->ctx.sha1, digest);
+                        break;
+                case HASH_SHA256:
+                        sha256_finish(&d->ctx.sha256, digest);
+                        break;
+                case HASH_XXH64:
+                        xxh64_finish(&d->ctx.xxh64, digest);
+                        break;
+        }
+        return Digest_length(d->type);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef MONIT_DIGEST_H
+#define MONIT_DIGEST_H
+
+#include "monit.h"
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "xxhash.h"
+
+
+/**
+ * Message digest engine of the checksum tests.
+ *
+ * MD5, SHA1 and SHA256 are computed with OpenSSL EVP if Monit is linked
+ * with OpenSSL, which selects the fastest implementation for the CPU at
+ * runtime (SHA extensions, AVX2 and so on). Otherwise and for XXH64, a
+ * fast non-cryptographic hash, the bundled portable implementations are
+ * used.
+ *
+ *  @file
+ */
+
+
+typedef struct mydigest {
+        int type;                                         /**< HASH_* type */
+        void *evp;                        /**< OpenSSL context, if used */
+        union {
+                md5_context_t md5;
+                sha1_context_t sha1;
+                sha256_context_t sha256;
+                xxh64_context_t xxh64;
+        } ctx;
+} Digest_T;
+
+
+/**
+ * Get the length of a digest
+ * @param type The hash type (HASH_*)
+ * @return The length of the raw digest in bytes or 0 if the type is unknown
+ */
+int Digest_length(int type);
+
+
+/**
+ * Get the name of a hash type
+ * @param type The hash type (HASH_*)
+ * @return The name, for example "SHA256"
+ */
+const char *Digest_name(int type);
+
+
+/**
+ * Get the hash type of a hexadecimal digest string by its length
+ * @param length The length of the string
+ * @return The hash type or HASH_UNKNOWN
+ */
+int Digest_typeOf(int length);
+
+
+/**
+ * Start a digest computation
+ * @param d A Digest object
+ * @param type The hash type (HASH_*)
+ * @return TRUE if succeeded, FALSE if the type is unknown
+ */
+int Digest_init(Digest_T *d, int type);
+
+
+/**
+ * Add data to the digest
+ * @param d A Digest object
+ * @param data The data
+ * @param length The length of the data
+ */
+void Digest_append(Digest_T *d, const void *data, size_t length);
+
+
+/**
+ * Finish the computation and release the context
+ * @param d A Digest object
+ * @param digest Output of the raw digest, at least Digest_length() bytes
+ * @return The length of the digest in bytes
+ */
+int Digest_finish(Digest_T *d, unsigned char *digest);
+
+
+#endif
@@ -0,0 +1,442 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#include "config.h"
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef HAVE_ERRNO_H
+#include <errno.h>
+#endif
+
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+
+#ifdef LINUX
+#include <stdint.h>
+#include <sys/syscall.h>
+#endif
+
+#include <fnmatch.h>
+
+#include "monit.h"
+#include "dirtree.h"
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+
+#ifdef DT_UNKNOWN
+#define ENTRY_TYPE(e) ((e)->d_type)
+#else
+#define ENTRY_TYPE(e) DT_UNKNOWN
+#define DT_UNKNOWN 0
+#define DT_DIR     4
+#define DT_REG     8
+#endif
+
+#define DIRTREE_BUFSIZE 65536
+
+
+/* A directory of the tree with the aggregate of its own files */
+typedef struct mynode {
+        char *name;                          /* Name relative to the parent */
+        ino_t ino;
+        time_t mtime;
+        time_t ctime;
+        int stable;       /* FALSE if the directory must be read in the next scan */
+        unsigned int seen;       /* The last scan which found the directory */
+        int count;                                /* Number of subdirectories */
+        int size;                         /* Size of the subdirectories array */
+        struct mynode **children;         /* Subdirectories, sorted by name */
+        TreeStat_T own[];                           /* Aggregate per filter */
+} *Node_T;
+
+
+struct mydirtree {
+        int filters;                       /* Number of filters, 0 = all files */
+        const char **patterns;                 /* Shell pattern of each filter */
+        unsigned int scans;                                /* Number of scans */
+        int refresh;                 /* Every n-th scan reads all directories */
+        int full;                     /* TRUE if all directories are read again */
+        time_t now;                                /* Start of the current scan */
+        dev_t dev;                                  /* Filesystem of the tree */
+        unsigned long directories;          /* Directories found in the scan */
+        unsigned long reread;                /* Directories read in the scan */
+        char *buf;                                  /* Directory read buffer */
+        TreeStat_T *total;                                /* Total per filter */
+        Node_T root;
+};
+
+
+#ifdef LINUX
+struct linux_dirent64 {
+        uint64_t       d_ino;
+        int64_t        d_off;
+        unsigned short d_reclen;
+        unsigned char  d_type;
+        char           d_name[];
+};
+#endif
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static Node_T node_new(Dirtree_T t, const char *name) {
+        Node_T n = CALLOC(1, sizeof(struct mynode) + t->filters * sizeof(TreeStat_T));
+        n->name = Str_dup(name);
+        return n;
+}
+
+
+static void node_free(Node_T *n) {
+        for (int i = 0; i < (*n)->count; i++)
+                node_free(&(*n)->children[i]);
+        FREE((*n)->children);
+        FREE((*n)->name);
+        FREE(*n);
+}
+
+
+static int compare_nodes(const void *a, const void *b) {
+        return strcmp((*(Node_T *)a)->name, (*(Node_T *)b)->name);
+}
+
+
+static Node_T find_node(Node_T *nodes, int count, const char *name) {
+        int low = 0, high = count - 1;
+        while (low <= high) {
+                int middle = (low + high) / 2;
+                int c = strcmp(name, nodes[middle]->name);
+                if (c == 0)
+                        return nodes[middle];
+                if (c < 0)
+                        high = middle - 1;
+                else
+                        low = middle + 1;
+        }
+        return NULL;
+}
+
+
+static void add_stat(TreeStat_T *to, const TreeStat_T *from) {
+        if (from->files) {
+                if (! to->files || from->oldest < to->oldest)
+                        to->oldest = from->oldest;
+                if (! to->files || from->newest > to->newest)
+                        to->newest = from->newest;
+                to->files += from->files;
+                to->size += from->size;
+        }
+}
+
+
+static void add_file(Dirtree_T t, Node_T n, const char *name, struct stat *st) {
+        for (int i = 0; i < t->filters; i++) {
+                if (i && fnmatch(t->patterns[i], name, 0) != 0)
+                        continue;
+                TreeStat_T *ts = &n->own[i];
+                if (! ts->files || st->st_mtime < ts->oldest)
+                        ts->oldest = st->st_mtime;
+                if (! ts->files || st->st_mtime > ts->newest)
+                        ts->newest = st->st_mtime;
+                ts->files++;
+                ts->size += st->st_size;
+        }
+}
+
+
+/* Add a directory entry, subdirectories keep their cache if they were found in the previous read */
+static void add_entry(Dirtree_T t, Node_T n, int fd, const char *name, int type, Node_T *previous, int count) {
+        if (*name == '.' && (! name[1] || (name[1] == '.' && ! name[2])))
+                return;
+        if (type == DT_UNKNOWN || type == DT_REG) {
+                struct stat st;
+                if (fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+                        return; // Removed meanwhile
+                if (S_ISREG(st.st_mode)) {
+                        add_file(t, n, name, &st);
+                        return;
+                }
+                if (! S_ISDIR(st.st_mode))
+                        return;
+        } else if (type != DT_DIR) {
+                return;
+        }
+        Node_T child = find_node(previous, count, name);
+        if (! child)
+                child = node_new(t, name);
+        child->seen = t->scans;
+        if (n->count == n->size) {
+                n->size = n->size ? n->size * 2 : 8;
+                RESIZE(n->children, n->size * sizeof(Node_T));
+        }
+        n->children[n->count++] = child;
+}
+
+
+#ifdef LINUX
+static int read_entries(Dirtree_T t, Node_T n, int fd, Node_T *previous, int count) {
+        long length;
+        while ((length = syscall(SYS_getdents64, fd, t->buf, DIRTREE_BUFSIZE)) > 0) {
+                for (long offset = 0; offset < length;) {
+                        struct linux_dirent64 *e = (struct linux_dirent64 *)(t->buf + offset);
+                        add_entry(t, n, fd, e->d_name, e->d_type, previous, count);
+                        offset += e->d_reclen;
+                }
+        }
+        return length == 0;
+}
+#else
+static int read_entries(Dirtree_T t, Node_T n, int fd, Node_T *previous, int count) {
+        int rv = TRUE;
+        int dfd = dup(fd);
+        DIR *dir = dfd >= 0 ? fdopendir(dfd) : NULL;
+        if (! dir) {
+                if (dfd >= 0)
+                        close(dfd);
+                return FALSE;
+        }
+        while (TRUE) {
+                errno = 0;
+                struct dirent *e = readdir(dir);
+                if (! e) {
+                        rv = errno == 0;
+                        break;
+                }
+                add_entry(t, n, fd, e->d_name, ENTRY_TYPE(e), previous, count);
+        }
+        closedir(dir);
+        return rv;
+}
+#endif
+
+
+/* Read the directory entries again and rebuild the aggregate of its own files */
+static int read_directory(Dirtree_T t, Node_T n, int fd) {
+        Node_T *previous = n->children;
+        int count = n->count;
+        n->children = NULL;
+        n->count = n->size = 0;
+        memset(n->own, 0, t->filters * sizeof(TreeStat_T));
+        int rv = read_entries(t, n, fd, previous, count);
+        if (! rv)
+                DEBUG("Cannot read directory %s -- %s\n", n->name, STRERROR);
+        for (int i = 0; i < count; i++)
+                if (previous[i]->seen != t->scans)
+                        node_free(&previous[i]);
+        FREE(previous);
+        if (n->count > 1)
+                qsort(n->children, n->count, sizeof(Node_T), compare_nodes);
+        t->reread++;
+        return rv;
+}
+
+
+static int unchanged(Dirtree_T t, Node_T n, struct stat *st) {
+        return ! t->full && n->stable && n->ino == st->st_ino && n->mtime == st->st_mtime && n->ctime == st->st_ctime;
+}
+
+
+/* Read the directory again if it changed and add its own files to the totals */
+static void scan_node(Dirtree_T t, Node_T n, int fd, struct stat *st) {
+        if (! unchanged(t, n, st)) {
+                n->ino = st->st_ino;
+                n->mtime = st->st_mtime;
+                n->ctime = st->st_ctime;
+                /* A change in the same second would not change the modification time, such a directory is read again */
+                n->stable = read_directory(t, n, fd) && st->st_mtime < t->now;
+        }
+        t->directories++;
+        for (int i = 0; i < t->filters; i++)
+                add_stat(&t->total[i], &n->own[i]);
+}
+
+
+/*
+ * Walk the tree depth first with an explicit stack. Only the descriptor of
+ * the current directory is open: a subdirectory is opened relative to its
+ * parent before the parent is closed, and the parent is opened again by
+ * ".." when the subdirectory is done. If the parent is not the same
+ * directory anymore (it was moved meanwhile), the rest of the tree is not
+ * scanned in this cycle. The descriptor fd is closed.
+ */
+static void scan_tree(Dirtree_T t, int fd, struct stat *st) {
+        struct frame {
+                Node_T node;
+                int next;                            /* Next subdirectory to visit */
+        } *stack = NULL;
+        int depth = 0, size = 0;
+        Node_T n = t->root;
+        scan_node(t, n, fd, st);
+        while (n) {
+                if (depth == size) {
+                        size = size ? size * 2 : 16;
+                        RESIZE(stack, size * sizeof(struct frame));
+                }
+                stack[depth].node = n;
+                stack[depth++].next = 0;
+                n = NULL;
+                while (depth && ! n) {
+                        struct frame *f = &stack[depth - 1];
+                        if (f->next < f->node->count) {
+                                Node_T child = f->node->children[f->next++];
+                                struct stat cst;
+                                if (fstatat(fd, child->name, &cst, AT_SYMLINK_NOFOLLOW) != 0 || ! S_ISDIR(cst.st_mode) || cst.st_dev != t->dev)
+                                        continue; // Removed meanwhile (the parent changed) or a mountpoint
+                                if (child->count == 0 && unchanged(t, child, &cst)) {
+                                        /* Unchanged leaf, no need to open it */
+                                        t->directories++;
+                                        for (int j = 0; j < t->filters; j++)
+                                                add_stat(&t->total[j], &child->own[j]);
+                                        continue;
+                                }
+                                int cfd = openat(fd, child->name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+                                if (cfd < 0) {
+                                        DEBUG("Cannot open directory %s -- %s\n", child->name, STRERROR);
+                                        continue;
+                                }
+                                close(fd);
+                                fd = cfd;
+                                scan_node(t, child, fd, &cst);
+                                n = child;
+                        } else if (--depth) {
+                                struct stat pst;
+                                int pfd = openat(fd, "..", O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+                                close(fd);
+                                fd = pfd;
+                                if (fd < 0 || fstat(fd, &pst) != 0 || pst.st_ino != stack[depth - 1].node->ino || pst.st_dev != t->dev) {
+                                        DEBUG("Directory %s was moved during the scan -- skipping the rest of the tree\n", stack[depth - 1].node->name);
+                                        depth = 0;
+                                }
+                        }
+                }
+        }
+        if (fd >= 0)
+                close(fd);
+        FREE(stack);
+}
+
+
+static Dirtree_T dirtree_new(Tree_T rules, int refresh) {
+        Dirtree_T t;
+        NEW(t);
+        t->refresh = refresh > 0 ? refresh : DIRTREE_REFRESH;
+        t->filters = 1;
+        for (Tree_T r = rules; r; r = r->next)
+                if (r->filter >= t->filters)
+                        t->filters = r->filter + 1;
+        t->patterns = CALLOC(t->filters, sizeof(char *));
+        for (Tree_T r = rules; r; r = r->next)
+                t->patterns[r->filter] = r->pattern;
+        t->total = CALLOC(t->filters, sizeof(TreeStat_T));
+#ifdef LINUX
+        t->buf = ALLOC(DIRTREE_BUFSIZE);
+#endif
+        return t;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+int Dirtree_scan(Service_T s) {
+        struct stat st;
+
+        ASSERT(s);
+        ASSERT(s->path);
+
+        if (! s->dirtree)
+                s->dirtree = dirtree_new(s->treelist, s->treerefresh);
+        Dirtree_T t = s->dirtree;
+        int fd = open(s->path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0)
+                return FALSE;
+        if (fstat(fd, &st) != 0) {
+                int e = errno;
+                close(fd);
+                errno = e;
+                return FALSE;
+        }
+        t->scans++;
+        t->full = t->scans % t->refresh == 0;
+        t->now = time(NULL);
+        t->dev = st.st_dev;
+        t->directories = t->reread = 0;
+        memset(t->total, 0, t->filters * sizeof(TreeStat_T));
+        if (! t->root)
+                t->root = node_new(t, s->path);
+        scan_tree(t, fd, &st);
+        s->inf->priv.directory.tree = t->total[0];
+        s->inf->priv.directory.directories = t->directories;
+        s->inf->priv.directory.reread = t->reread;
+        return TRUE;
+}
+
+
+const TreeStat_T *Dirtree_get(Dirtree_T t, int filter) {
+        ASSERT(t);
+        ASSERT(filter >= 0 && filter < t->filters);
+        return &t->total[filter];
+}
+
+
+void Dirtree_free(Dirtree_T *t) {
+        ASSERT(t && *t);
+        if ((*t)->root)
+                node_free(&(*t)->root);
+        FREE((*t)->patterns);
+        FREE((*t)->total);
+        FREE((*t)->buf);
+        FREE(*t);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef MONIT_DIRTREE_H
+#define MONIT_DIRTREE_H
+
+#include "monit.h"
+
+
+/**
+ * Recursive scan of a directory service.
+ *
+ * The scan counts the regular files below the directory and sums up their
+ * size and modification times in one pass, each directory is read with
+ * getdents64() on Linux (readdir() elsewhere) and its entries are stat'ed
+ * relative to the directory descriptor. Files matching the shell patterns
+ * of the tree rules are counted separately.
+ *
+ * The aggregate of each directory's own files is cached between cycles.
+ * A directory whose modification time did not change since it was read
+ * is not read again, only its subdirectories are visited, so an unchanged
+ * tree costs one stat() per directory. Files changed in place without
+ * changing their directory are picked up when all directories are read
+ * again, every DIRTREE_REFRESH scans or as set by the "refresh" statement
+ * of the service (Service_T.treerefresh). The scan does not follow
+ * symbolic links and stays on the filesystem of the directory. The walk
+ * keeps only the descriptor of the current directory open, so the depth
+ * of the tree is not limited by the descriptor limit.
+ *
+ *  @file
+ */
+
+
+/** Every n-th scan reads all directories again, unless configured */
+#define DIRTREE_REFRESH 10
+
+
+/**
+ * Scan the directory tree of the service. The tree cache is created on
+ * the first scan. The totals are stored in the directory data of the
+ * service (Info_T.priv.directory).
+ * @param s A directory Service object with tree rules
+ * @return TRUE if succeeded, FALSE if the directory cannot be read (errno
+ * is set)
+ */
+int Dirtree_scan(Service_T s);
+
+
+/**
+ * Get the aggregate of the files matching a tree rule pattern
+ * @param t A Dirtree object
+ * @param filter The pattern index of the rule (Tree_T.filter)
+ * @return The aggregate of the last scan
+ */
+const TreeStat_T *Dirtree_get(Dirtree_T t, int filter);
+
+
+/**
+ * Free the tree cache
+ * @param t A Dirtree object reference
+ */
+void Dirtree_free(Dirtree_T *t);
+
+
+#endif
@@ -220,7 +220,9 @@ void Event_post(Service_T service, long id, short state, EventAction_T action, c
   } else
     e->count++;
 
+  long long start = Util_monotonic();
   handle_event(e);
+  Run.cycle.event += Util_monotonic() - start;
 }
 
 
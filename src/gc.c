@@ -37,6 +37,11 @@
 #include "process.h"
 #include "ssl.h"
 #include "engine.h"
+#include "history.h"
+#include "profile.h"
+#include "dirtree.h"
+#include "resolver.h"
+#include "socket.h"
 
 
 /* Private prototypes */
@@ -49,6 +54,9 @@ static void _gcppl(Port_T *);
 static void _gcfilesystem(Filesystem_T *);
 static void _gcicmp(Icmp_T *);
 static void _gcpql(Resource_T *);
+static void _gctrend(Trend_T *);
+static void _gctiming(Timing_T *);
+static void _gctree(Tree_T *);
 static void _gcptl(Timestamp_T *);
 static void _gcparl(ActionRate_T *);
 static void _gc_action(Action_T *);
@@ -72,6 +80,12 @@ static void _gc_request(Request_T *);
 /**
  *  Release allocated memory.
  *
+ *  The configuration objects are allocated from the arena of the
+ *  configuration generation (see parse()). Freeing them is a no-op, the
+ *  lists are still walked to release the resources held outside of the
+ *  arena (regular expressions, programs and the runtime state allocated
+ *  on the heap, such as events). The arena is dropped at the end.
+ *
  *  @file
  */
 
@@ -83,6 +97,12 @@ void gc() {
 
         destroy_hosts_allow();
 
+        Resolver_free();
+
+        socket_pool_flush(TRUE);
+
+        free_ssl_client_contexts();
+
         if(Run.doprocess) {
                 delprocesstree(&oldptree, &oldptreesize);
                 delprocesstree(&ptree, &ptreesize);
@@ -114,11 +134,15 @@ void gc() {
         FREE(Run.httpsslpem);
         FREE(Run.httpsslclientpem);
         FREE(Run.bind_addr);
+        FREE(Run.httpdsocket);
         FREE(Run.MailFormat.from);
         FREE(Run.MailFormat.subject);
         FREE(Run.MailFormat.message);
         FREE(Run.mail_hostname);
 
+        if(Run.arena)
+                Arena_free(&Run.arena);
+
 }
 
 
@@ -126,16 +150,17 @@ void gc_mail_list(Mail_T *m) {
 
         ASSERT(m);
 
-        if((*m)->next)
-                gc_mail_list(&(*m)->next);
-
-        FREE((*m)->to);
-        FREE((*m)->from);
-        FREE((*m)->replyto);
-        FREE((*m)->subject);
-        FREE((*m)->message);
-        FREE(*m);
+        while (*m) {
+                Mail_T next = (*m)->next;
 
+                FREE((*m)->to);
+                FREE((*m)->from);
+                FREE((*m)->replyto);
+                FREE((*m)->subject);
+                FREE((*m)->message);
+                FREE(*m);
+                *m = next;
+        }
 }
 
 
@@ -156,14 +181,15 @@ void gc_event(Event_T *e) {
 
         ASSERT(e&&*e);
 
-        if((*e)->next)
-                gc_event(&(*e)->next);
-
-        (*e)->action= NULL;
-        FREE((*e)->source);
-        FREE((*e)->message);
-        FREE(*e);
+        while (*e) {
+                Event_T next = (*e)->next;
 
+                (*e)->action= NULL;
+                FREE((*e)->source);
+                FREE((*e)->message);
+                FREE(*e);
+                *e = next;
+        }
 }
 
 
@@ -174,11 +200,12 @@ static void _gc_service_list(Service_T *s) {
 
         ASSERT(s&&*s);
 
-        if((*s)->next)
-                _gc_service_list(&(*s)->next);
-
-        _gc_service(&(*s));
+        while (*s) {
+                Service_T next = (*s)->next;
 
+                _gc_service(&(*s));
+                *s = next;
+        }
 }
 
 
@@ -208,9 +235,30 @@ static void _gc_service(Service_T *s) {
         if((*s)->resourcelist)
                 _gcpql(&(*s)->resourcelist);
 
+        if((*s)->trendlist)
+                _gctrend(&(*s)->trendlist);
+
+        if((*s)->timinglist)
+                _gctiming(&(*s)->timinglist);
+
+        if((*s)->treelist)
+                _gctree(&(*s)->treelist);
+
+        if((*s)->dirtree)
+                Dirtree_free(&(*s)->dirtree);
+
+        if((*s)->history)
+                History_free(&(*s)->history);
+
+        if((*s)->profile)
+                Profile_free(&(*s)->profile);
+
         if((*s)->inf)
                 _gc_inf(&(*s)->inf);
 
+        FREE((*s)->published.port);
+        FREE((*s)->published.icmp);
+
         if((*s)->timestamplist)
                 _gcptl(&(*s)->timestamplist);
 
@@ -291,6 +339,7 @@ static void _gc_service(Service_T *s) {
 
         FREE((*s)->name);
         FREE((*s)->path);
+        FREE((*s)->cgroup);
 
         (*s)->next= NULL;
 
@@ -302,24 +351,28 @@ static void _gc_service(Service_T *s) {
 static void _gc_servicegroup(ServiceGroup_T *sg) {
         ASSERT(sg && *sg);
 
-        if((*sg)->next)
-                _gc_servicegroup(&(*sg)->next);
+        while (*sg) {
+                ServiceGroup_T next = (*sg)->next;
 
-        if((*sg)->members)
-                _gc_servicegroup_member(&(*sg)->members);
-        FREE((*sg)->name);
-        FREE(*sg);
+                if((*sg)->members)
+                        _gc_servicegroup_member(&(*sg)->members);
+                FREE((*sg)->name);
+                FREE(*sg);
+                *sg = next;
+        }
 }
 
 
 static void _gc_servicegroup_member(ServiceGroupMember_T *m) {
         ASSERT(m && *m);
 
-        if((*m)->next)
-                _gc_servicegroup_member(&(*m)->next);
+        while (*m) {
+                ServiceGroupMember_T next = (*m)->next;
 
-        FREE((*m)->name);
-        FREE(*m);
+                FREE((*m)->name);
+                FREE(*m);
+                *m = next;
+        }
 }
 
 
@@ -360,16 +413,17 @@ static void _gc_mail_server(MailServer_T *s) {
         if (! s || ! *s)
                 return;
 
-        if ((*s)->next)
-                _gc_mail_server(&(*s)->next);
-
-        FREE((*s)->host);
-        FREE((*s)->username);
-        FREE((*s)->password);
-        FREE((*s)->ssl.certmd5);
-        FREE((*s)->ssl.clientpemfile);
-        FREE(*s);
+        while (*s) {
+                MailServer_T next = (*s)->next;
 
+                FREE((*s)->host);
+                FREE((*s)->username);
+                FREE((*s)->password);
+                FREE((*s)->ssl.certmd5);
+                FREE((*s)->ssl.clientpemfile);
+                FREE(*s);
+                *s = next;
+        }
 }
 
 
@@ -399,24 +453,26 @@ static void _gcppl(Port_T *p) {
 
         ASSERT(p&&*p);
 
-        if((*p)->next)
-                _gcppl(&(*p)->next);
-
-        if((*p)->action)
-                _gc_eventaction(&(*p)->action);
-        if((*p)->generic)
-                _gcgrc(&(*p)->generic);
-        if((*p)->url_request)
-                _gc_request(&(*p)->url_request);
-
-        FREE((*p)->request);
-        FREE((*p)->hostname);
-        FREE((*p)->pathname);
-        FREE((*p)->SSL.certmd5);
-        FREE((*p)->SSL.clientpemfile);
-        FREE((*p)->request_checksum);
-        FREE((*p)->request_hostheader);
-        FREE(*p);
+        while (*p) {
+                Port_T next = (*p)->next;
+
+                if((*p)->action)
+                        _gc_eventaction(&(*p)->action);
+                if((*p)->generic)
+                        _gcgrc(&(*p)->generic);
+                if((*p)->url_request)
+                        _gc_request(&(*p)->url_request);
+
+                FREE((*p)->request);
+                FREE((*p)->hostname);
+                FREE((*p)->pathname);
+                FREE((*p)->SSL.certmd5);
+                FREE((*p)->SSL.clientpemfile);
+                FREE((*p)->request_checksum);
+                FREE((*p)->request_hostheader);
+                FREE(*p);
+                *p = next;
+        }
 }
 
 
@@ -424,14 +480,15 @@ static void _gcfilesystem(Filesystem_T *d) {
 
         ASSERT(d&&*d);
 
-        if((*d)->next)
-                _gcfilesystem(&(*d)->next);
+        while (*d) {
+                Filesystem_T next = (*d)->next;
 
-        if((*d)->action)
-                _gc_eventaction(&(*d)->action);
-
-        FREE(*d);
+                if((*d)->action)
+                        _gc_eventaction(&(*d)->action);
 
+                FREE(*d);
+                *d = next;
+        }
 }
 
 
@@ -439,14 +496,15 @@ static void _gcicmp(Icmp_T *i) {
 
         ASSERT(i&&*i);
 
-        if((*i)->next)
-                _gcicmp(&(*i)->next);
+        while (*i) {
+                Icmp_T next = (*i)->next;
 
-        if((*i)->action)
-                _gc_eventaction(&(*i)->action);
-
-        FREE(*i);
+                if((*i)->action)
+                        _gc_eventaction(&(*i)->action);
 
+                FREE(*i);
+                *i = next;
+        }
 }
 
 
@@ -454,14 +512,64 @@ static void _gcpql(Resource_T *q) {
 
         ASSERT(q);
 
-        if((*q)->next)
-                _gcpql(&(*q)->next);
+        while (*q) {
+                Resource_T next = (*q)->next;
 
-        if((*q)->action)
-                _gc_eventaction(&(*q)->action);
+                if((*q)->action)
+                        _gc_eventaction(&(*q)->action);
 
-        FREE(*q);
+                FREE(*q);
+                *q = next;
+        }
+}
+
+
+static void _gctrend(Trend_T *t) {
+
+        ASSERT(t);
 
+        while (*t) {
+                Trend_T next = (*t)->next;
+
+                if((*t)->action)
+                        _gc_eventaction(&(*t)->action);
+
+                FREE(*t);
+                *t = next;
+        }
+}
+
+
+static void _gctiming(Timing_T *t) {
+
+        ASSERT(t);
+
+        while (*t) {
+                Timing_T next = (*t)->next;
+
+                if((*t)->action)
+                        _gc_eventaction(&(*t)->action);
+
+                FREE(*t);
+                *t = next;
+        }
+}
+
+
+static void _gctree(Tree_T *t) {
+
+        ASSERT(t);
+
+        while (*t) {
+                Tree_T next = (*t)->next;
+
+                if((*t)->action)
+                        _gc_eventaction(&(*t)->action);
+
+                FREE((*t)->pattern);
+                FREE(*t);
+                *t = next;
+        }
 }
 
 
@@ -474,26 +582,30 @@ static void _gc_inf(Info_T *i) {
 static void _gcptl(Timestamp_T *p) {
         ASSERT(p);
 
-        if((*p)->next)
-                _gcptl(&(*p)->next);
+        while (*p) {
+                Timestamp_T next = (*p)->next;
 
-        if((*p)->action)
-                _gc_eventaction(&(*p)->action);
+                if((*p)->action)
+                        _gc_eventaction(&(*p)->action);
 
-        FREE(*p);
+                FREE(*p);
+                *p = next;
+        }
 }
 
 
 static void _gcparl(ActionRate_T *ar) {
         ASSERT(ar);
 
-        if((*ar)->next)
-                _gcparl(&(*ar)->next);
+        while (*ar) {
+                ActionRate_T next = (*ar)->next;
 
-        if((*ar)->action)
-                _gc_eventaction(&(*ar)->action);
+                if((*ar)->action)
+                        _gc_eventaction(&(*ar)->action);
 
-        FREE(*ar);
+                FREE(*ar);
+                *ar = next;
+        }
 }
 
 
@@ -501,38 +613,40 @@ static void _gcso(Size_T *s) {
 
         ASSERT(s);
 
-        if((*s)->next)
-                _gcso(&(*s)->next);
+        while (*s) {
+                Size_T next = (*s)->next;
 
-        if((*s)->action)
-                _gc_eventaction(&(*s)->action);
-
-        FREE(*s);
+                if((*s)->action)
+                        _gc_eventaction(&(*s)->action);
 
+                FREE(*s);
+                *s = next;
+        }
 }
 
 static void _gcmatch(Match_T *s) {
 
         ASSERT(s);
 
-        if((*s)->next)
-                _gcmatch(&(*s)->next);
+        while (*s) {
+                Match_T next = (*s)->next;
 
-        if((*s)->action)
-                _gc_eventaction(&(*s)->action);
+                if((*s)->action)
+                        _gc_eventaction(&(*s)->action);
 
-        FREE((*s)->match_path);
-        FREE((*s)->match_string);
+                FREE((*s)->match_path);
+                FREE((*s)->match_string);
 
 #ifdef HAVE_REGEX_H
-        if((*s)->regex_comp) {
-                regfree((*s)->regex_comp);
-                FREE((*s)->regex_comp);
-        }
+                if((*s)->regex_comp) {
+                        regfree((*s)->regex_comp);
+                        FREE((*s)->regex_comp);
+                }
 #endif
 
-        FREE(*s);
-
+                FREE(*s);
+                *s = next;
+        }
 }
 
 
@@ -562,11 +676,14 @@ static void _gcstatus(Status_T *s) {
 
         ASSERT(s);
 
-        if((*s)->next)
-                _gcstatus(&(*s)->next);
-        if((*s)->action)
-                _gc_eventaction(&(*s)->action);
-        FREE(*s);
+        while (*s) {
+                Status_T next = (*s)->next;
+
+                if((*s)->action)
+                        _gc_eventaction(&(*s)->action);
+                FREE(*s);
+                *s = next;
+        }
 }
 
 
@@ -598,12 +715,13 @@ static void _gcpdl(Dependant_T *d) {
 
         ASSERT(d);
 
-        if((*d)->next)
-                _gcpdl(&(*d)->next);
-
-        FREE((*d)->dependant);
-        FREE(*d);
+        while (*d) {
+                Dependant_T next = (*d)->next;
 
+                FREE((*d)->dependant);
+                FREE(*d);
+                *d = next;
+        }
 }
 
 
@@ -611,17 +729,18 @@ static void _gcgrc(Generic_T *g) {
 
         ASSERT(g);
 
-        if((*g)->next)
-                _gcgrc(&(*g)->next);
+        while (*g) {
+                Generic_T next = (*g)->next;
 
-        FREE((*g)->send);
+                FREE((*g)->send);
 #ifdef HAVE_REGEX_H
-        if ((*g)->expect!=NULL)
-                regfree((*g)->expect);
+                if ((*g)->expect!=NULL)
+                        regfree((*g)->expect);
 #endif
-        FREE((*g)->expect);
-        FREE(*g);
-
+                FREE((*g)->expect);
+                FREE(*g);
+                *g = next;
+        }
 }
 
 
@@ -629,14 +748,15 @@ static void _gcath(Auth_T *c) {
 
         ASSERT(c);
 
-        if((*c)->next)
-                _gcath(&(*c)->next);
-
-        FREE((*c)->uname);
-        FREE((*c)->passwd);
-        FREE((*c)->groupname);
-        FREE(*c);
+        while (*c) {
+                Auth_T next = (*c)->next;
 
+                FREE((*c)->uname);
+                FREE((*c)->passwd);
+                FREE((*c)->groupname);
+                FREE(*c);
+                *c = next;
+        }
 }
 
 
@@ -644,15 +764,16 @@ static void _gc_mmonit(Mmonit_T *recv) {
 
         ASSERT(recv);
 
-        if((*recv)->next)
-                _gc_mmonit(&(*recv)->next);
+        while (*recv) {
+                Mmonit_T next = (*recv)->next;
 
-        _gc_url(&(*recv)->url);
-
-        FREE((*recv)->ssl.certmd5);
-        FREE((*recv)->ssl.clientpemfile);
-        FREE(*recv);
+                _gc_url(&(*recv)->url);
 
+                FREE((*recv)->ssl.certmd5);
+                FREE((*recv)->ssl.clientpemfile);
+                FREE(*recv);
+                *recv = next;
+        }
 }
 
 
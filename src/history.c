@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+#include "config.h"
+
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h>
+#endif
+
+#include "monit.h"
+#include "history.h"
+
+// libmonit
+#include "system/Time.h"
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+struct myhistory {
+        int       head;                          /**< Slot of the latest sample */
+        int       count[HISTORY_METRICS];   /**< Consecutive samples per metric */
+        long long last[HISTORY_METRICS];         /**< Latest value per metric */
+        time_t    timestamp[HISTORY_SIZE];                 /**< Sample times */
+        int32_t   delta[HISTORY_METRICS][HISTORY_SIZE]; /**< Change to previous */
+};
+
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+/**
+ * Collect the current metrics of the service
+ * @param s A Service object
+ * @param value Output array of HISTORY_METRICS values
+ * @return Bitmap of the collected metrics
+ */
+static int collect(Service_T s, long long value[HISTORY_METRICS]) {
+        int metrics = 0;
+
+        if (s->type == TYPE_PROCESS && Run.doprocess && s->inf->priv.process.pid > 0) {
+                value[HISTORY_CPU]         = s->inf->priv.process.cpu_percent;
+                value[HISTORY_TOTALCPU]    = s->inf->priv.process.total_cpu_percent;
+                value[HISTORY_MEMORY]      = s->inf->priv.process.mem_kbyte;
+                value[HISTORY_TOTALMEMORY] = s->inf->priv.process.total_mem_kbyte;
+                value[HISTORY_CHILDREN]    = s->inf->priv.process.children;
+                metrics |= 1 << HISTORY_CPU | 1 << HISTORY_TOTALCPU | 1 << HISTORY_MEMORY | 1 << HISTORY_TOTALMEMORY | 1 << HISTORY_CHILDREN;
+        } else if (s->type == TYPE_SYSTEM && Run.doprocess) {
+                value[HISTORY_CPU]     = (systeminfo.total_cpu_user_percent > 0 ? systeminfo.total_cpu_user_percent : 0) + (systeminfo.total_cpu_syst_percent > 0 ? systeminfo.total_cpu_syst_percent : 0);
+                value[HISTORY_MEMORY]  = systeminfo.total_mem_kbyte;
+                value[HISTORY_SWAP]    = systeminfo.total_swap_kbyte;
+                value[HISTORY_LOADAVG] = (long long)(systeminfo.loadavg[0] * 10.);
+                metrics |= 1 << HISTORY_CPU | 1 << HISTORY_MEMORY | 1 << HISTORY_SWAP | 1 << HISTORY_LOADAVG;
+        }
+        if ((s->type == TYPE_PROCESS || s->type == TYPE_HOST) && s->portlist) {
+                /* The slowest port counts, a failed port counts as timeout */
+                value[HISTORY_RESPONSE] = 0;
+                for (Port_T p = s->portlist; p; p = p->next) {
+                        long long response = (p->is_available && p->response >= 0) ? (long long)(p->response * 1000000.) : p->timeout * 1000000LL;
+                        if (response > value[HISTORY_RESPONSE])
+                                value[HISTORY_RESPONSE] = response;
+                }
+                metrics |= 1 << HISTORY_RESPONSE;
+        }
+        return metrics;
+}
+
+
+static int compare(const void *a, const void *b) {
+        long long x = *(const long long *)a, y = *(const long long *)b;
+        return x < y ? -1 : x > y;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void History_record(Service_T s) {
+        long long value[HISTORY_METRICS];
+        History_T h;
+        int metrics;
+
+        ASSERT(s);
+
+        if (! (metrics = collect(s, value)))
+                return;
+        LOCK(mutex)
+        {
+                if (! s->history)
+                        NEW(s->history);
+                h = s->history;
+                h->head = (h->head + 1) % HISTORY_SIZE;
+                h->timestamp[h->head] = Time_now();
+                for (int m = 0; m < HISTORY_METRICS; m++) {
+                        if (! (metrics & (1 << m))) {
+                                h->count[m] = 0;
+                        } else if (h->count[m] == 0) {
+                                h->delta[m][h->head] = 0;
+                                h->last[m] = value[m];
+                                h->count[m] = 1;
+                        } else {
+                                long long delta = value[m] - h->last[m];
+                                /* Keep the decoded series consistent if a jump doesn't fit */
+                                if (delta > INT32_MAX)
+                                        delta = INT32_MAX;
+                                else if (delta < INT32_MIN)
+                                        delta = INT32_MIN;
+                                h->delta[m][h->head] = (int32_t)delta;
+                                h->last[m] += delta;
+                                if (h->count[m] < HISTORY_SIZE)
+                                        h->count[m]++;
+                        }
+                }
+        }
+        END_LOCK;
+}
+
+
+int History_samples(History_T h, int metric, long long *values, time_t *timestamps, int n) {
+        ASSERT(values);
+        ASSERT(metric >= 0 && metric < HISTORY_METRICS);
+
+        if (! h)
+                return 0;
+        if (n > h->count[metric])
+                n = h->count[metric];
+        long long v = h->last[metric];
+        for (int k = n - 1, slot = h->head; k >= 0; k--) {
+                values[k] = v;
+                if (timestamps)
+                        timestamps[k] = h->timestamp[slot];
+                v -= h->delta[metric][slot];
+                slot = (slot + HISTORY_SIZE - 1) % HISTORY_SIZE;
+        }
+        return n;
+}
+
+
+History_T History_copy(Service_T s) {
+        History_T h = NULL;
+
+        ASSERT(s);
+
+        LOCK(mutex)
+        {
+                if (s->history) {
+                        h = ALLOC(sizeof(*h));
+                        *h = *s->history;
+                }
+        }
+        END_LOCK;
+        return h;
+}
+
+
+int History_evaluate(History_T h, Trend_T t, long long *value) {
+        long long sample[HISTORY_SIZE];
+        int n;
+
+        ASSERT(t);
+        ASSERT(value);
+
+        if ((n = History_samples(h, t->metric, sample, NULL, t->cycles)) < t->cycles || n == 0)
+                return FALSE;
+        switch (t->function) {
+                case TREND_AVERAGE:
+                        {
+                                long long sum = 0;
+                                for (int i = 0; i < n; i++)
+                                        sum += sample[i];
+                                *value = sum / n;
+                        }
+                        break;
+                case TREND_PERCENTILE:
+                        {
+                                /* Nearest rank */
+                                int rank = (t->percentile * n + 99) / 100;
+                                qsort(sample, n, sizeof(long long), compare);
+                                *value = sample[rank > 0 ? rank - 1 : 0];
+                        }
+                        break;
+                case TREND_SLOPE:
+                        {
+                                /* Least squares fit, the change across the window relative to the fitted start value */
+                                double xmean = (n - 1) / 2., ymean = 0., sxy = 0., sxx = 0.;
+                                for (int i = 0; i < n; i++)
+                                        ymean += sample[i];
+                                ymean /= n;
+                                for (int i = 0; i < n; i++) {
+                                        sxy += (i - xmean) * (sample[i] - ymean);
+                                        sxx += (i - xmean) * (i - xmean);
+                                }
+                                double slope = sxx > 0. ? sxy / sxx : 0.;
+                                double start = ymean - slope * xmean;
+                                if (start <= 0.)
+                                        start = ymean;
+                                *value = start > 0. ? (long long)(slope * (n - 1) * 1000. / start) : 0;
+                        }
+                        break;
+                default:
+                        return FALSE;
+        }
+        return TRUE;
+}
+
+
+void History_free(History_T *h) {
+        ASSERT(h);
+        FREE(*h);
+}
+
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+
+#ifndef MONIT_HISTORY_H
+#define MONIT_HISTORY_H
+
+#include "monit.h"
+
+
+/**
+ * Short-term metrics history of a service.
+ *
+ * Every poll cycle the collected metrics of process, system and remote
+ * host services are appended to a fixed size ring of HISTORY_SIZE samples
+ * per service. The ring is allocated on the first sample and never grows;
+ * samples are stored as 32 bit deltas to the previous sample, so the most
+ * recent N values are decoded by walking the ring backward from the last
+ * value. Trend rules (averages, percentiles and slopes over the last N
+ * cycles) are evaluated on this history and it is exported over HTTP.
+ * The validator appends under a lock, other threads must read the history
+ * through a copy made with History_copy().
+ *
+ *  @file
+ */
+
+
+/**
+ * Append the metrics collected in this cycle to the service history.
+ * Services which don't collect any metrics are ignored.
+ * @param s A Service object
+ */
+void History_record(Service_T s);
+
+
+/**
+ * Get the most recent samples of a metric
+ * @param h A History object
+ * @param metric The metric (HISTORY_*)
+ * @param values Output array, values[0] is the oldest sample
+ * @param timestamps Output array of the sample times or NULL
+ * @param n Maximum number of samples to get
+ * @return The number of samples stored in the arrays
+ */
+int History_samples(History_T h, int metric, long long *values, time_t *timestamps, int n);
+
+
+/**
+ * Get a copy of the service history which is consistent with regard to
+ * a concurrent History_record() call
+ * @param s A Service object
+ * @return The history copy which must be freed with History_free() or
+ * NULL if the service has no history yet
+ */
+History_T History_copy(Service_T s);
+
+
+/**
+ * Evaluate the trend function over the history
+ * @param h A History object
+ * @param t The trend to evaluate
+ * @param value Output of the aggregated value in the unit of the trend limit
+ * @return TRUE if the value was computed, FALSE if there are not enough
+ * samples yet
+ */
+int History_evaluate(History_T h, Trend_T t, long long *value);
+
+
+/**
+ * Free the history object
+ * @param h A History object reference
+ */
+void History_free(History_T *h);
+
+
+#endif
@@ -73,6 +73,9 @@
 #include "alert.h"
 #include "process.h"
 #include "device.h"
+#include "resolver.h"
+#include "profile.h"
+#include "snapshot.h"
 
 // libmonit
 #include "system/Time.h"
@@ -91,6 +94,9 @@
 #define VIEWLOG     "/_viewlog"
 #define DOACTION    "/_doaction"
 #define FAVICON     "/favicon.ico"
+#define HISTORY     "/_history"
+#define PROFILE     "/_profile"
+#define METRICS     "/metrics"
 
 /* Private prototypes */
 static int is_readonly(HttpRequest);
@@ -114,6 +120,7 @@ static void do_getid(HttpRequest, HttpResponse);
 static void do_runtime(HttpRequest, HttpResponse);
 static void do_viewlog(HttpRequest, HttpResponse);
 static void handle_action(HttpRequest, HttpResponse);
+static int  schedule_action(HttpResponse, Service_T, int, const char *, int);
 static void handle_do_action(HttpRequest, HttpResponse);
 static void handle_run(HttpRequest, HttpResponse);
 static void is_monit_running(HttpRequest, HttpResponse);
@@ -134,6 +141,9 @@ static void print_service_rules_checksum(HttpResponse, Service_T);
 static void print_service_rules_process(HttpResponse, Service_T);
 static void print_service_rules_program(HttpResponse, Service_T);
 static void print_service_rules_resource(HttpResponse, Service_T);
+static void print_service_rules_trend(HttpResponse, Service_T);
+static void print_service_rules_timing(HttpResponse, Service_T);
+static void print_service_rules_tree(HttpResponse, Service_T);
 static void print_service_params_port(HttpResponse, Service_T);
 static void print_service_params_icmp(HttpResponse, Service_T);
 static void print_service_params_perm(HttpResponse, Service_T);
@@ -142,12 +152,17 @@ static void print_service_params_gid(HttpResponse, Service_T);
 static void print_service_params_timestamp(HttpResponse, Service_T);
 static void print_service_params_filesystem(HttpResponse, Service_T);
 static void print_service_params_size(HttpResponse, Service_T);
+static void print_service_params_tree(HttpResponse, Service_T);
 static void print_service_params_match(HttpResponse, Service_T);
 static void print_service_params_checksum(HttpResponse, Service_T);
 static void print_service_params_process(HttpResponse, Service_T);
+static void print_pressure_html(HttpResponse, Service_T, const char *, Pressure_T *);
 static void print_service_params_resource(HttpResponse, Service_T);
 static void print_service_params_program(HttpResponse, Service_T);
 static void print_status(HttpRequest, HttpResponse, int);
+static void print_history(HttpRequest, HttpResponse);
+static void print_profile(HttpRequest, HttpResponse);
+static void print_metrics(HttpRequest, HttpResponse);
 static void status_service_txt(Service_T, HttpResponse, short);
 static char *get_monitoring_status(Service_T s, char *, int);
 static char *get_service_status(Service_T, char *, int);
@@ -230,6 +245,12 @@ static void doGet(HttpRequest req, HttpResponse res) {
                 print_status(req, res, 1);
         } else if(ACTION(STATUS2)) {
                 print_status(req, res, 2);
+        } else if(ACTION(HISTORY)) {
+                print_history(req, res);
+        } else if(ACTION(PROFILE)) {
+                print_profile(req, res);
+        } else if(ACTION(METRICS)) {
+                print_metrics(req, res);
         } else if(ACTION(DOACTION)) {
                 handle_do_action(req, res);
         } else {
@@ -415,6 +436,9 @@ static void do_getid(HttpRequest req, HttpResponse res) {
 static void do_runtime(HttpRequest req, HttpResponse res) {
 
         int pid=  exist_daemon();
+        ResolverStatistics_T resolver;
+        unsigned long long cycles, overruns;
+        struct myhistogram cycle;
 
         do_head(res, "_runtime", "Runtime", 1000);
         StringBuffer_append(res->outputbuffer,
@@ -446,6 +470,21 @@ static void do_runtime(HttpRequest req, HttpResponse res) {
         StringBuffer_append(res->outputbuffer,
                   "<tr><td>Use syslog</td><td>%s</td></tr>",
                   Run.use_syslog?"True":"False");
+        Resolver_statistics(&resolver);
+        StringBuffer_append(res->outputbuffer,
+                  "<tr><td>Resolver cache</td>"
+                  "<td>%d hosts, %llu hits, %llu misses, %llu stale, %llu failed, %llu renewed</td></tr>",
+                  resolver.entries, resolver.hits, resolver.misses, resolver.stale, resolver.failures, resolver.refreshes);
+        Profile_cycles(&cycles, &overruns);
+        if (! Profile_phase(Profile_Cycle, &cycle))
+                memset(&cycle, 0, sizeof(cycle));
+        StringBuffer_append(res->outputbuffer,
+                  "<tr><td>Check cycles</td>"
+                  "<td>%llu cycles, %llu longer than the poll interval, p95 %.3fs, max %.3fs</td></tr>"
+                  "<tr><td>Last cycle</td>"
+                  "<td>collect %.3fs, checks %.3fs, events %.3fs (<a href='%s'>profile</a>)</td></tr>",
+                  cycles, overruns, Histogram_percentile(&cycle, 95) / 1000000., cycle.max / 1000000.,
+                  (Run.cycle.prepare + Run.cycle.collect) / 1000000., Run.cycle.check / 1000000., Run.cycle.event / 1000000., PROFILE);
 
         if(Run.eventlist_dir) {
                 char slots[STRLEN];
@@ -665,6 +704,24 @@ static void handle_action(HttpRequest req, HttpResponse res) {
 }
 
 
+/**
+ * Check if the action can be scheduled for the service or schedule it
+ * @return FALSE if another action is pending (the error was sent), otherwise TRUE
+ */
+static int schedule_action(HttpResponse res, Service_T s, int doaction, const char *action, int apply) {
+        if(! apply) {
+                if(s->doaction != ACTION_IGNORE) {
+                        send_error(res, SC_SERVICE_UNAVAILABLE, "Other action already in progress -- please try again later");
+                        return FALSE;
+                }
+        } else if(s->doaction != doaction) {
+                s->doaction = doaction;
+                LogInfo("'%s' %s on user request\n", s->name, action);
+        }
+        return TRUE;
+}
+
+
 static void handle_do_action(HttpRequest req, HttpResponse res) {
         Service_T s;
         int doaction = ACTION_IGNORE;
@@ -683,21 +740,40 @@ static void handle_do_action(HttpRequest req, HttpResponse res) {
                         return;
                 }
 
-                for(p= req->params; p; p= p->next) {
-
-                        if(!strcasecmp(p->name, "service")) {
-                                s  = Util_getService(p->value);
+                /* The services are given by one or more "service" parameters ("all" selects
+                 * all services) and "group" parameters. All services are checked first, so the
+                 * action is scheduled either for all of them or for none */
+                for(int apply= FALSE; apply <= TRUE; apply++) {
+                        for(p= req->params; p; p= p->next) {
+
+                                if(!strcasecmp(p->name, "service")) {
+                                        if(IS(p->value, "all")) {
+                                                for(s= servicelist; s; s= s->next)
+                                                        if(! schedule_action(res, s, doaction, action, apply))
+                                                                return;
+                                                continue;
+                                        }
+                                        s  = Util_getService(p->value);
 
-                                if(!s) {
-                                        send_error(res, SC_BAD_REQUEST, "There is no service by that name");
-                                        return;
-                                }
-                                if(s->doaction != ACTION_IGNORE) {
-                                        send_error(res, SC_SERVICE_UNAVAILABLE, "Other action already in progress -- please try again later");
-                                        return;
+                                        if(!s) {
+                                                send_error(res, SC_BAD_REQUEST, "There is no service by that name");
+                                                return;
+                                        }
+                                        if(! schedule_action(res, s, doaction, action, apply))
+                                                return;
+                                } else if(!strcasecmp(p->name, "group")) {
+                                        ServiceGroup_T sg;
+                                        for(sg= servicegrouplist; sg; sg= sg->next)
+                                                if(IS(p->value, sg->name))
+                                                        break;
+                                        if(!sg) {
+                                                send_error(res, SC_BAD_REQUEST, "There is no group by that name");
+                                                return;
+                                        }
+                                        for(ServiceGroupMember_T m= sg->members; m; m= m->next)
+                                                if((s= Util_getService(m->name)) && ! schedule_action(res, s, doaction, action, apply))
+                                                        return;
                                 }
-                                s->doaction = doaction;
-                                LogInfo("'%s' %s on user request\n", s->name, action);
                         }
                 }
 
@@ -754,9 +830,11 @@ static void do_service(HttpRequest req, HttpResponse res, Service_T s) {
         ServiceGroup_T sg;
         ServiceGroupMember_T sgm;
         char buf[STRLEN];
+        Snapshot_T snapshot;
 
         ASSERT(s);
 
+        s = Snapshot_service(s, &snapshot);
         do_head(res, s->name, s->name, Run.polltime);
 
         StringBuffer_append(res->outputbuffer,
@@ -864,6 +942,7 @@ static void do_service(HttpRequest req, HttpResponse res, Service_T s) {
         print_service_params_timestamp(res, s);
         print_service_params_filesystem(res, s);
         print_service_params_size(res, s);
+        print_service_params_tree(res, s);
         print_service_params_match(res, s);
         print_service_params_checksum(res, s);
         print_service_params_process(res, s);
@@ -885,6 +964,9 @@ static void do_service(HttpRequest req, HttpResponse res, Service_T s) {
         print_service_rules_process(res, s);
         print_service_rules_program(res, s);
         print_service_rules_resource(res, s);
+        print_service_rules_trend(res, s);
+        print_service_rules_timing(res, s);
+        print_service_rules_tree(res, s);
 
         print_alerts(res, s->maillist);
 
@@ -893,13 +975,19 @@ static void do_service(HttpRequest req, HttpResponse res, Service_T s) {
         print_buttons(req, res, s);
 
         do_foot(res);
+
+        Snapshot_free(&snapshot);
 }
 
 
 static void do_home_system(HttpRequest req, HttpResponse res) {
-        Service_T s = Run.system;
+        Snapshot_T snapshot;
+        SystemInfo_T si;
+        Service_T s = Snapshot_service(Run.system, &snapshot);
         char buf[STRLEN];
 
+        Snapshot_system(&si);
+
         StringBuffer_append(res->outputbuffer,
                   "<table id='header-row'>"
                   "<tr>"
@@ -932,25 +1020,28 @@ static void do_home_system(HttpRequest req, HttpResponse res) {
                           "</td>"
                           "<td align='right'>%.1f%% [%ld&nbsp;kB]</td>"
                           "<td align='right'>%.1f%% [%ld&nbsp;kB]</td>",
-                          systeminfo.loadavg[0], systeminfo.loadavg[1], systeminfo.loadavg[2],
-                          systeminfo.total_cpu_user_percent > 0 ? systeminfo.total_cpu_user_percent/10. : 0,
-                          systeminfo.total_cpu_syst_percent > 0 ? systeminfo.total_cpu_syst_percent/10. : 0,
+                          si.loadavg[0], si.loadavg[1], si.loadavg[2],
+                          si.total_cpu_user_percent > 0 ? si.total_cpu_user_percent/10. : 0,
+                          si.total_cpu_syst_percent > 0 ? si.total_cpu_syst_percent/10. : 0,
 #ifdef HAVE_CPU_WAIT
-                          systeminfo.total_cpu_wait_percent > 0 ? systeminfo.total_cpu_wait_percent/10. : 0,
+                          si.total_cpu_wait_percent > 0 ? si.total_cpu_wait_percent/10. : 0,
 #endif
-                          systeminfo.total_mem_percent/10., systeminfo.total_mem_kbyte,
-                          systeminfo.total_swap_percent/10., systeminfo.total_swap_kbyte);
+                          si.total_mem_percent/10., si.total_mem_kbyte,
+                          si.total_swap_percent/10., si.total_swap_kbyte);
         }
 
         StringBuffer_append(res->outputbuffer,
                   "</tr>"
                   "</table>");
+        FREE(si.cpu_percent);
+        Snapshot_free(&snapshot);
 }
 
 
 static void do_home_process(HttpRequest req, HttpResponse res) {
 
         Service_T      s;
+        Snapshot_T     snapshot;
         char           buf[STRLEN];
         int            on= TRUE;
         int            header= TRUE;
@@ -959,6 +1050,8 @@ static void do_home_process(HttpRequest req, HttpResponse res) {
 
                 if(s->type != TYPE_PROCESS) continue;
 
+                s= Snapshot_service(s, &snapshot);
+
                 if(header) {
 
                         StringBuffer_append(res->outputbuffer,
@@ -1023,6 +1116,8 @@ static void do_home_process(HttpRequest req, HttpResponse res) {
 
                 on= on?FALSE:TRUE;
 
+                Snapshot_free(&snapshot);
+
         }
 
         if(!header)
@@ -1034,6 +1129,7 @@ static void do_home_process(HttpRequest req, HttpResponse res) {
 static void do_home_program(HttpRequest req, HttpResponse res) {
 
         Service_T      s;
+        Snapshot_T     snapshot;
         char           buf[STRLEN];
         int            on= TRUE;
         int            header= TRUE;
@@ -1042,6 +1138,8 @@ static void do_home_program(HttpRequest req, HttpResponse res) {
 
                 if(s->type != TYPE_PROGRAM) continue;
 
+                s= Snapshot_service(s, &snapshot);
+
                 if(header) {
 
                         StringBuffer_append(res->outputbuffer,
@@ -1083,6 +1181,8 @@ static void do_home_program(HttpRequest req, HttpResponse res) {
 
                 on= on?FALSE:TRUE;
 
+                Snapshot_free(&snapshot);
+
         }
 
         if(!header)
@@ -1093,6 +1193,7 @@ static void do_home_program(HttpRequest req, HttpResponse res) {
 
 static void do_home_filesystem(HttpRequest req, HttpResponse res) {
         Service_T     s;
+        Snapshot_T    snapshot;
         char          buf[STRLEN];
         int           on= TRUE;
         int           header= TRUE;
@@ -1101,6 +1202,8 @@ static void do_home_filesystem(HttpRequest req, HttpResponse res) {
 
                 if(s->type != TYPE_FILESYSTEM) continue;
 
+                s= Snapshot_service(s, &snapshot);
+
                 if(header) {
 
                         StringBuffer_append(res->outputbuffer,
@@ -1156,6 +1259,8 @@ static void do_home_filesystem(HttpRequest req, HttpResponse res) {
 
                 on= on?FALSE:TRUE;
 
+                Snapshot_free(&snapshot);
+
         }
 
         if(!header)
@@ -1167,6 +1272,7 @@ static void do_home_filesystem(HttpRequest req, HttpResponse res) {
 static void do_home_file(HttpRequest req, HttpResponse res) {
 
         Service_T  s;
+        Snapshot_T snapshot;
         char       buf[STRLEN];
         int        on= TRUE;
         int        header= TRUE;
@@ -1175,6 +1281,8 @@ static void do_home_file(HttpRequest req, HttpResponse res) {
 
                 if(s->type != TYPE_FILE) continue;
 
+                s= Snapshot_service(s, &snapshot);
+
                 if(header) {
 
                         StringBuffer_append(res->outputbuffer,
@@ -1225,6 +1333,8 @@ static void do_home_file(HttpRequest req, HttpResponse res) {
 
                 on= on?FALSE:TRUE;
 
+                Snapshot_free(&snapshot);
+
         }
 
         if(!header)
@@ -1236,6 +1346,7 @@ static void do_home_file(HttpRequest req, HttpResponse res) {
 static void do_home_fifo(HttpRequest req, HttpResponse res) {
 
         Service_T  s;
+        Snapshot_T snapshot;
         char       buf[STRLEN];
         int        on= TRUE;
         int        header= TRUE;
@@ -1244,6 +1355,8 @@ static void do_home_fifo(HttpRequest req, HttpResponse res) {
 
                 if(s->type != TYPE_FIFO) continue;
 
+                s= Snapshot_service(s, &snapshot);
+
                 if(header) {
 
                         StringBuffer_append(res->outputbuffer,
@@ -1290,6 +1403,8 @@ static void do_home_fifo(HttpRequest req, HttpResponse res) {
 
                 on= on?FALSE:TRUE;
 
+                Snapshot_free(&snapshot);
+
         }
 
         if(!header)
@@ -1301,6 +1416,7 @@ static void do_home_fifo(HttpRequest req, HttpResponse res) {
 static void do_home_directory(HttpRequest req, HttpResponse res) {
 
         Service_T        s;
+        Snapshot_T       snapshot;
         char             buf[STRLEN];
         int              on= TRUE;
         int              header= TRUE;
@@ -1309,6 +1425,8 @@ static void do_home_directory(HttpRequest req, HttpResponse res) {
 
                 if(s->type != TYPE_DIRECTORY) continue;
 
+                s= Snapshot_service(s, &snapshot);
+
                 if(header) {
 
                         StringBuffer_append(res->outputbuffer,
@@ -1355,6 +1473,8 @@ static void do_home_directory(HttpRequest req, HttpResponse res) {
 
                 on= on?FALSE:TRUE;
 
+                Snapshot_free(&snapshot);
+
         }
 
         if(!header)
@@ -1366,6 +1486,7 @@ static void do_home_directory(HttpRequest req, HttpResponse res) {
 static void do_home_host(HttpRequest req, HttpResponse res) {
 
         Service_T  s;
+        Snapshot_T snapshot;
         Icmp_T     icmp;
         Port_T     port;
         char       buf[STRLEN];
@@ -1376,6 +1497,8 @@ static void do_home_host(HttpRequest req, HttpResponse res) {
 
                 if(s->type != TYPE_HOST) continue;
 
+                s= Snapshot_service(s, &snapshot);
+
                 if(header) {
 
                         StringBuffer_append(res->outputbuffer,
@@ -1438,6 +1561,8 @@ static void do_home_host(HttpRequest req, HttpResponse res) {
 
                 on= on?FALSE:TRUE;
 
+                Snapshot_free(&snapshot);
+
         }
 
         if(!header)
@@ -1820,6 +1945,47 @@ static void print_service_rules_program(HttpResponse res, Service_T s) {
 }
 
 
+static void print_service_rules_trend(HttpResponse res, Service_T s) {
+        char buf[STRLEN], limit[STRLEN];
+        for (Trend_T t = s->trendlist; t; t = t->next) {
+                EventAction_T a = t->action;
+                StringBuffer_append(res->outputbuffer, "<tr><td>Trend</td><td>If %s ", Util_trendDescription(t, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "%s %s %s ", operatornames[t->operator], Util_trendValue(t, t->limit, limit, sizeof(limit)), Util_getEventratio(a->failed, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "then %s ", Util_describeAction(a->failed, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "else if succeeded %s ", Util_getEventratio(a->succeeded, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "then %s</td></tr>", Util_describeAction(a->succeeded, buf, sizeof(buf)));
+        }
+}
+
+
+static void print_service_rules_timing(HttpResponse res, Service_T s) {
+        char buf[STRLEN], limit[STRLEN];
+        for (Timing_T t = s->timinglist; t; t = t->next) {
+                EventAction_T a = t->action;
+                StringBuffer_append(res->outputbuffer, "<tr><td>Timing</td><td>If %s time ", timingnames[t->phase]);
+                StringBuffer_append(res->outputbuffer, "%s %s %s ", operatornames[t->operator], Util_timingValue(t->limit, limit, sizeof(limit)), Util_getEventratio(a->failed, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "then %s ", Util_describeAction(a->failed, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "else if succeeded %s ", Util_getEventratio(a->succeeded, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "then %s</td></tr>", Util_describeAction(a->succeeded, buf, sizeof(buf)));
+        }
+}
+
+
+static void print_service_rules_tree(HttpResponse res, Service_T s) {
+        char buf[STRLEN], limit[STRLEN];
+        for (Tree_T t = s->treelist; t; t = t->next) {
+                EventAction_T a = t->action;
+                StringBuffer_append(res->outputbuffer, "<tr><td>Directory tree</td><td>If %s ", Util_treeDescription(t, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "%s %s %s ", operatornames[t->operator], Util_treeValue(t, t->limit, limit, sizeof(limit)), Util_getEventratio(a->failed, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "then %s ", Util_describeAction(a->failed, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "else if succeeded %s ", Util_getEventratio(a->succeeded, buf, sizeof(buf)));
+                StringBuffer_append(res->outputbuffer, "then %s</td></tr>", Util_describeAction(a->succeeded, buf, sizeof(buf)));
+        }
+        if (s->treerefresh)
+                StringBuffer_append(res->outputbuffer, "<tr><td>Directory tree refresh</td><td>Read all directories every %d cycles</td></tr>", s->treerefresh);
+}
+
+
 static void print_service_rules_resource(HttpResponse res, Service_T s) {
         if(s->resourcelist) {
                 char buf[STRLEN];
@@ -1850,6 +2016,26 @@ static void print_service_rules_resource(HttpResponse res, Service_T s) {
                                         StringBuffer_append(res->outputbuffer, "CPU wait limit");
                                         break;
 
+                                case RESOURCE_ID_CPUSTEAL:
+                                        StringBuffer_append(res->outputbuffer, "CPU steal limit");
+                                        break;
+
+                                case RESOURCE_ID_CPUIRQ:
+                                        StringBuffer_append(res->outputbuffer, "CPU irq limit");
+                                        break;
+
+                                case RESOURCE_ID_PRESSURE_CPU:
+                                        StringBuffer_append(res->outputbuffer, "CPU pressure limit");
+                                        break;
+
+                                case RESOURCE_ID_PRESSURE_MEMORY:
+                                        StringBuffer_append(res->outputbuffer, "Memory pressure limit");
+                                        break;
+
+                                case RESOURCE_ID_PRESSURE_IO:
+                                        StringBuffer_append(res->outputbuffer, "I/O pressure limit");
+                                        break;
+
                                 case RESOURCE_ID_MEM_PERCENT: 
                                         StringBuffer_append(res->outputbuffer, "Memory usage limit");
                                         break;
@@ -1898,6 +2084,11 @@ static void print_service_rules_resource(HttpResponse res, Service_T s) {
                                 case RESOURCE_ID_CPUUSER:
                                 case RESOURCE_ID_CPUSYSTEM:
                                 case RESOURCE_ID_CPUWAIT:
+                                case RESOURCE_ID_CPUSTEAL:
+                                case RESOURCE_ID_CPUIRQ:
+                                case RESOURCE_ID_PRESSURE_CPU:
+                                case RESOURCE_ID_PRESSURE_MEMORY:
+                                case RESOURCE_ID_PRESSURE_IO:
                                 case RESOURCE_ID_MEM_PERCENT:
                                 case RESOURCE_ID_SWAP_PERCENT:
                                         StringBuffer_append(res->outputbuffer, "If %s %.1f%% %s ", operatornames[q->operator], q->limit / 10., Util_getEventratio(a->failed, buf, sizeof(buf)));
@@ -1944,6 +2135,7 @@ static void print_service_params_port(HttpResponse res, Service_T s) {
            s-> portlist) {
 
                 Port_T p;
+                char buf[STRLEN];
 
                 if(!Util_hasServiceStatus(s)) {
 
@@ -1971,6 +2163,9 @@ static void print_service_params_port(HttpResponse res, Service_T s) {
                                                           "<td>%.3fs to %s:%d%s [%s via %s]</td></tr>",
                                                           p->response, p->hostname, p->port, p->request?p->request:"",
                                                           p->protocol->name, Util_portTypeDescription(p));
+                                                StringBuffer_append(res->outputbuffer,
+                                                          "<tr><td>Port Response timing</td><td>%s</td></tr>",
+                                                          Util_portTiming(p, buf, sizeof(buf)));
                                         }
                                 } else if(p->family == AF_UNIX) {
                                         if(!p->is_available) {
@@ -1984,6 +2179,9 @@ static void print_service_params_port(HttpResponse res, Service_T s) {
                                                           "<tr><td>Unix Socket Response time</td>"
                                                           "<td>%.3fs to %s [%s]</td></tr>",
                                                           p->response, p->pathname, p->protocol->name);
+                                                StringBuffer_append(res->outputbuffer,
+                                                          "<tr><td>Unix Socket Response timing</td><td>%s</td></tr>",
+                                                          Util_portTiming(p, buf, sizeof(buf)));
                                         }
                                 }
                         }
@@ -2188,6 +2386,35 @@ static void print_service_params_size(HttpResponse res, Service_T s) {
         }
 }
 
+static void print_service_params_tree(HttpResponse res, Service_T s) {
+
+        if(s->type == TYPE_DIRECTORY && s->treelist) {
+
+                if(!Util_hasServiceStatus(s)) {
+
+                        StringBuffer_append(res->outputbuffer,
+                                  "<tr><td>Files</td><td>-</td></tr>"
+                                  "<tr><td>Size of files</td><td>-</td></tr>");
+
+                } else {
+                        char oldest[32], newest[32];
+                        TreeStat_T *ts = &s->inf->priv.directory.tree;
+
+                        StringBuffer_append(res->outputbuffer,
+                                  "<tr><td>Files</td><td class='%s'>%llu</td></tr>"
+                                  "<tr><td>Size of files</td><td class='%s'>%llu B</td></tr>"
+                                  "<tr><td>Oldest file</td><td class='%s'>%s</td></tr>"
+                                  "<tr><td>Newest file</td><td class='%s'>%s</td></tr>"
+                                  "<tr><td>Directories</td><td>%lu (%lu read in the last cycle)</td></tr>",
+                                  (s->error & Event_Resource)?"red-text":"", ts->files,
+                                  (s->error & Event_Size)?"red-text":"", ts->size,
+                                  (s->error & Event_Timestamp)?"red-text":"", ts->files ? Time_string(ts->oldest, oldest) : "-",
+                                  (s->error & Event_Timestamp)?"red-text":"", ts->files ? Time_string(ts->newest, newest) : "-",
+                                  s->inf->priv.directory.directories, s->inf->priv.directory.reread);
+                }
+        }
+}
+
 static void print_service_params_match(HttpResponse res, Service_T s) {
 
         if(s->type == TYPE_FILE) {
@@ -2260,9 +2487,26 @@ static void print_service_params_process(HttpResponse res, Service_T s) {
 }
 
 
+static void print_pressure_html(HttpResponse res, Service_T s, const char *name, Pressure_T *p) {
+        if(p->some_avg10 >= 0) {
+                StringBuffer_append(res->outputbuffer,
+                          "<tr><td>%s</td><td class='%s'>some %.1f%% [10s] %.1f%% [60s]",
+                          name,
+                          (s->error & Event_Resource)?"red-text":"",
+                          p->some_avg10/10., p->some_avg60/10.);
+                if(p->full_avg10 >= 0)
+                        StringBuffer_append(res->outputbuffer, ", full %.1f%% [10s] %.1f%% [60s]", p->full_avg10/10., p->full_avg60/10.);
+                StringBuffer_append(res->outputbuffer, "</td></tr>");
+        }
+}
+
+
 static void print_service_params_resource(HttpResponse res, Service_T s) {
 
         if(Run.doprocess && (s->type == TYPE_PROCESS || s->type == TYPE_SYSTEM) ) {
+                SystemInfo_T si;
+
+                Snapshot_system(&si);
 
                 if(!Util_hasServiceStatus(s)) {
                         if(s->type == TYPE_PROCESS) {
@@ -2301,13 +2545,19 @@ static void print_service_params_resource(HttpResponse res, Service_T s) {
                                           "<tr><td>Total memory usage (incl. children)</td><td class='%s'>%.1f%% [%ldkB]</td></tr>",
                                           (s->error & Event_Resource)?"red-text":"",
                                           s->inf->priv.process.total_mem_percent/10.0, s->inf->priv.process.total_mem_kbyte);
+                                if(s->cgroup)
+                                        StringBuffer_append(res->outputbuffer,
+                                                  "<tr><td>Cgroup</td><td>%s [%d tasks]</td></tr>"
+                                                  "<tr><td>Cgroup I/O</td><td>read %llu bytes, written %llu bytes</td></tr>",
+                                                  s->cgroup, s->inf->priv.process.cgroup_pids,
+                                                  s->inf->priv.process.cgroup_io_rbytes, s->inf->priv.process.cgroup_io_wbytes);
                         } else if(s->type == TYPE_SYSTEM) {
                                 StringBuffer_append(res->outputbuffer,
                                           "<tr><td>Load average</td><td class='%s'>[%.2f] [%.2f] [%.2f]</td></tr>",
                                           (s->error & Event_Resource)?"red-text":"",
-                                          systeminfo.loadavg[0],
-                                          systeminfo.loadavg[1],
-                                          systeminfo.loadavg[2]);
+                                          si.loadavg[0],
+                                          si.loadavg[1],
+                                          si.loadavg[2]);
                                 StringBuffer_append(res->outputbuffer,
                                           "<tr><td>CPU usage</td><td class='%s'>%.1f%%us %.1f%%sy"
 #ifdef HAVE_CPU_WAIT
@@ -2315,24 +2565,41 @@ static void print_service_params_resource(HttpResponse res, Service_T s) {
 #endif
                                           "%s",
                                           (s->error & Event_Resource)?"red-text":"",
-                                          systeminfo.total_cpu_user_percent > 0 ? systeminfo.total_cpu_user_percent/10. : 0,
-                                          systeminfo.total_cpu_syst_percent > 0 ? systeminfo.total_cpu_syst_percent/10. : 0,
+                                          si.total_cpu_user_percent > 0 ? si.total_cpu_user_percent/10. : 0,
+                                          si.total_cpu_syst_percent > 0 ? si.total_cpu_syst_percent/10. : 0,
 #ifdef HAVE_CPU_WAIT
-                                          systeminfo.total_cpu_wait_percent > 0 ? systeminfo.total_cpu_wait_percent/10. : 0,
+                                          si.total_cpu_wait_percent > 0 ? si.total_cpu_wait_percent/10. : 0,
 #endif
                                           "</td></tr>");
                                 StringBuffer_append(res->outputbuffer,
                                           "<tr><td>Memory usage</td><td class='%s'>%ld kB [%.1f%%]</td></tr>",
                                           (s->error & Event_Resource)?"red-text":"",
-                                          systeminfo.total_mem_kbyte,
-                                          systeminfo.total_mem_percent/10.);
+                                          si.total_mem_kbyte,
+                                          si.total_mem_percent/10.);
                                 StringBuffer_append(res->outputbuffer,
                                           "<tr><td>Swap usage</td><td class='%s'>%ld kB [%.1f%%]</td></tr>",
                                           (s->error & Event_Resource)?"red-text":"",
-                                          systeminfo.total_swap_kbyte,
-                                          systeminfo.total_swap_percent/10.);
+                                          si.total_swap_kbyte,
+                                          si.total_swap_percent/10.);
+                                if(si.total_cpu_steal_percent >= 0 && si.total_cpu_irq_percent >= 0)
+                                        StringBuffer_append(res->outputbuffer,
+                                                  "<tr><td>CPU steal and interrupts</td><td class='%s'>%.1f%%st %.1f%%hi+si</td></tr>",
+                                                  (s->error & Event_Resource)?"red-text":"",
+                                                  si.total_cpu_steal_percent/10.,
+                                                  si.total_cpu_irq_percent/10.);
+                                if(si.cpu_percent) {
+                                        StringBuffer_append(res->outputbuffer, "<tr><td>CPU usage per core</td><td>");
+                                        for(int i = 0; i < si.cpus; i++)
+                                                if(si.cpu_percent[i] >= 0)
+                                                        StringBuffer_append(res->outputbuffer, "[%d] %.1f%% ", i, si.cpu_percent[i]/10.);
+                                        StringBuffer_append(res->outputbuffer, "</td></tr>");
+                                }
+                                print_pressure_html(res, s, "CPU pressure", &si.pressure_cpu);
+                                print_pressure_html(res, s, "Memory pressure", &si.pressure_memory);
+                                print_pressure_html(res, s, "I/O pressure", &si.pressure_io);
                         }
                 }
+                FREE(si.cpu_percent);
         }
 }
 
@@ -2412,8 +2679,42 @@ static void print_status(HttpRequest req, HttpResponse res, int version)
 }
 
 
+/**
+ * Print the metrics history of all services or of the service given by
+ * the "service" parameter as XML
+ */
+static void print_history(HttpRequest req, HttpResponse res) {
+        history_xml(res->outputbuffer, get_parameter(req, "service"));
+        set_content_type(res, "text/xml");
+}
+
+
+/**
+ * Print the check latency profile of all services or of the service
+ * given by the "service" parameter as XML
+ */
+static void print_profile(HttpRequest req, HttpResponse res) {
+        profile_xml(res->outputbuffer, get_parameter(req, "service"));
+        set_content_type(res, "text/xml");
+}
+
+
+/**
+ * Print the status of all services in the Prometheus text format
+ */
+static void print_metrics(HttpRequest req, HttpResponse res) {
+        status_metrics(res->outputbuffer);
+        set_content_type(res, "text/plain; version=0.0.4");
+}
+
+
 static void status_service_txt(Service_T s, HttpResponse res, short level) {
         char buf[STRLEN];
+        Snapshot_T snapshot;
+        SystemInfo_T si;
+
+        s = Snapshot_service(s, &snapshot);
+        Snapshot_system(&si);
         if(level == LEVEL_SUMMARY)
         {
                 char prefix[STRLEN];
@@ -2451,6 +2752,21 @@ static void status_service_txt(Service_T s, HttpResponse res, short level) {
                                           "  %-33s %s\n",
                                           "timestamp", Time_string(s->inf->timestamp, buf));
                         }
+                        if(s->type == TYPE_DIRECTORY && s->treelist) {
+                                TreeStat_T *ts = &s->inf->priv.directory.tree;
+                                char oldest[32], newest[32];
+                                StringBuffer_append(res->outputbuffer,
+                                          "  %-33s %llu\n"
+                                          "  %-33s %llu B\n"
+                                          "  %-33s %s\n"
+                                          "  %-33s %s\n"
+                                          "  %-33s %lu\n",
+                                          "files", ts->files,
+                                          "size of files", ts->size,
+                                          "oldest file", ts->files ? Time_string(ts->oldest, oldest) : "-",
+                                          "newest file", ts->files ? Time_string(ts->newest, newest) : "-",
+                                          "directories", s->inf->priv.directory.directories);
+                        }
                         if(s->type == TYPE_FILE) {
                                 StringBuffer_append(res->outputbuffer,
                                           "  %-33s %llu B\n",
@@ -2521,6 +2837,16 @@ static void status_service_txt(Service_T s, HttpResponse res, short level) {
                                                   "memory percent total", s->inf->priv.process.total_mem_percent/10.0,
                                                   "cpu percent", s->inf->priv.process.cpu_percent/10.0,
                                                   "cpu percent total", s->inf->priv.process.total_cpu_percent/10.0);
+                                        if(s->cgroup)
+                                                StringBuffer_append(res->outputbuffer,
+                                                          "  %-33s %s\n"
+                                                          "  %-33s %d\n"
+                                                          "  %-33s %llu\n"
+                                                          "  %-33s %llu\n",
+                                                          "cgroup", s->cgroup,
+                                                          "cgroup tasks", s->inf->priv.process.cgroup_pids,
+                                                          "cgroup io read bytes", s->inf->priv.process.cgroup_io_rbytes,
+                                                          "cgroup io write bytes", s->inf->priv.process.cgroup_io_wbytes);
                                 }
                         }
                         if(s->type == TYPE_HOST && s->icmplist) {
@@ -2542,11 +2868,19 @@ static void status_service_txt(Service_T s, HttpResponse res, short level) {
                                                           p->hostname,
                                                           p->port, p->request?p->request:"", p->protocol->name,
                                                           Util_portTypeDescription(p));
+                                                if(p->is_available)
+                                                        StringBuffer_append(res->outputbuffer,
+                                                                  "  %-33s %s\n",
+                                                                  "port response timing", Util_portTiming(p, buf, sizeof(buf)));
                                         } else if(p->family == AF_UNIX) {
                                                 StringBuffer_append(res->outputbuffer,
                                                           "  %-33s %.3fs to %s [%s]\n",
                                                           "unix socket response time", p->is_available ? p->response : 0.,
                                                           p->pathname, p->protocol->name);
+                                                if(p->is_available)
+                                                        StringBuffer_append(res->outputbuffer,
+                                                                  "  %-33s %s\n",
+                                                                  "unix socket response timing", Util_portTiming(p, buf, sizeof(buf)));
                                         }
                                 }
                         }
@@ -2561,21 +2895,33 @@ static void status_service_txt(Service_T s, HttpResponse res, short level) {
                                           "  %-33s %ld kB [%.1f%%]\n"
                                           "  %-33s %ld kB [%.1f%%]\n",
                                           "load average",
-                                          systeminfo.loadavg[0],
-                                          systeminfo.loadavg[1],
-                                          systeminfo.loadavg[2],
+                                          si.loadavg[0],
+                                          si.loadavg[1],
+                                          si.loadavg[2],
                                           "cpu",
-                                          systeminfo.total_cpu_user_percent > 0 ? systeminfo.total_cpu_user_percent/10. : 0,
-                                          systeminfo.total_cpu_syst_percent > 0 ? systeminfo.total_cpu_syst_percent/10. : 0,
+                                          si.total_cpu_user_percent > 0 ? si.total_cpu_user_percent/10. : 0,
+                                          si.total_cpu_syst_percent > 0 ? si.total_cpu_syst_percent/10. : 0,
 #ifdef HAVE_CPU_WAIT
-                                          systeminfo.total_cpu_wait_percent > 0 ? systeminfo.total_cpu_wait_percent/10. : 0,
+                                          si.total_cpu_wait_percent > 0 ? si.total_cpu_wait_percent/10. : 0,
 #endif
                                           "memory usage",
-                                          systeminfo.total_mem_kbyte,
-                                          systeminfo.total_mem_percent/10.,
+                                          si.total_mem_kbyte,
+                                          si.total_mem_percent/10.,
                                           "swap usage",
-                                          systeminfo.total_swap_kbyte,
-                                          systeminfo.total_swap_percent/10.);
+                                          si.total_swap_kbyte,
+                                          si.total_swap_percent/10.);
+                                if(si.total_cpu_steal_percent >= 0 && si.total_cpu_irq_percent >= 0)
+                                        StringBuffer_append(res->outputbuffer,
+                                                  "  %-33s %.1f%%st %.1f%%hi+si\n",
+                                                  "cpu steal and interrupts",
+                                                  si.total_cpu_steal_percent/10.,
+                                                  si.total_cpu_irq_percent/10.);
+                                if(si.pressure_cpu.some_avg10 >= 0)
+                                        StringBuffer_append(res->outputbuffer, "  %-33s %.1f%% %.1f%%\n", "cpu pressure (avg10 avg60)", si.pressure_cpu.some_avg10/10., si.pressure_cpu.some_avg60/10.);
+                                if(si.pressure_memory.some_avg10 >= 0)
+                                        StringBuffer_append(res->outputbuffer, "  %-33s %.1f%% %.1f%%\n", "memory pressure (avg10 avg60)", si.pressure_memory.some_avg10/10., si.pressure_memory.some_avg60/10.);
+                                if(si.pressure_io.some_avg10 >= 0)
+                                        StringBuffer_append(res->outputbuffer, "  %-33s %.1f%% %.1f%%\n", "io pressure (avg10 avg60)", si.pressure_io.some_avg10/10., si.pressure_io.some_avg60/10.);
                         }
                         if(s->type == TYPE_PROGRAM) {
                                 if (s->program->started) {
@@ -2593,6 +2939,7 @@ static void status_service_txt(Service_T s, HttpResponse res, short level) {
                 }
                 StringBuffer_append(res->outputbuffer, "  %-33s %s\n\n", "data collected", Time_string(s->collected.tv_sec, buf));
         }
+        FREE(si.cpu_percent);        Snapshot_free(&snapshot);
 }
 
 
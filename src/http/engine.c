@@ -87,6 +87,10 @@
 #include <arpa/inet.h>
 #endif
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
 #include "engine.h"
 #include "socket.h"
 
@@ -107,6 +111,11 @@
  *    accepted. Hosts allowed to connect to this server should be
  *    added to the access control list by calling add_host_allow().
  *
+ *    If a control socket is configured, the server accepts connections
+ *    on this local UNIX socket too. The socket file is accessible by
+ *    the owner only, so the host allow list is not checked for local
+ *    connections; Basic Authentication still applies.
+ *
  *  @file 
  */
 
@@ -114,15 +123,26 @@
 /* ------------------------------------------------------------- Definitions */
 
 
+/* The allow list compiled into a binary trie. Node 0 is the root of the
+ * IPv4 networks and node 1 of the IPv6 networks, a child index of 0 means
+ * no child. Lookups stop at the first node on the path which allows. */
+typedef struct allow_trie {
+  unsigned int count;
+  struct allow_node {
+    unsigned int child[2];
+    int allow;
+  } node[];
+} *AllowTrie;
+
+
 static int myServerSocket= 0;
+static int myControlSocket= -1;
 static HostsAllow hostlist= NULL;
+static int hostcount= 0;
+static int hostsize= 0;
+static AllowTrie hosttrie= NULL;
 static volatile int stopped= FALSE;
 ssl_server_connection *mySSLServerConnection= NULL;
-static pthread_mutex_t hostlist_mutex= PTHREAD_MUTEX_INITIALIZER;
-struct ulong_net {
-  unsigned long network;
-  unsigned long mask;
-};
 
 
 /* -------------------------------------------------------------- Prototypes */
@@ -131,10 +151,11 @@ struct ulong_net {
 static void check_Impl();
 static void initialize_service();
 static int  authenticate(const struct in_addr);
-static int  is_host_allow(const struct in_addr);
-static void destroy_host_allow(HostsAllow);
+static int  add_allow(HostsAllow, const char *);
+static AllowTrie compile_trie();
+static int  wait_connection();
 static Socket_T socket_producer(int, int, void*);
-static int  parse_network(char *, struct ulong_net *);
+static int  parse_network(char *, HostsAllow);
 
 /* ------------------------------------------------------------------ Public */
 
@@ -168,6 +189,8 @@ void start_httpd(int port, int backlog, char *bindAddr) {
   } else {
 
     initialize_service();
+    clear_credential_cache();
+    compile_hosts_allow();
 
     if(Run.httpdssl) {
 
@@ -188,9 +211,14 @@ void start_httpd(int port, int backlog, char *bindAddr) {
 #endif
     }
 
+    if(Run.httpdsocket && (myControlSocket= create_unix_server_socket(Run.httpdsocket, backlog)) < 0)
+      LogError("http server: Could not create the control socket %s\n", Run.httpdsocket);
+
     while(! stopped) {
 
-      if(!(S= socket_producer(myServerSocket, port, mySSLServerConnection))) {
+      int server= wait_connection();
+
+      if(server < 0 || !(S= socket_producer(server, port, server == myServerSocket ? mySSLServerConnection : NULL))) {
 	continue;
       }
 
@@ -198,8 +226,14 @@ void start_httpd(int port, int backlog, char *bindAddr) {
 
     }
 
+    clear_credential_cache();
     delete_ssl_server_socket(mySSLServerConnection);  
     close_socket(myServerSocket);
+    if(myControlSocket >= 0) {
+      close_socket(myControlSocket);
+      unlink(Run.httpdsocket);
+      myControlSocket= -1;
+    }
 
   }
 
@@ -221,8 +255,8 @@ void stop_httpd() {
 
 /**
  * Add hosts allowed to connect to this server.
- * @param name A hostname (A-Record) or IP address to be added to the
- * hosts allow list
+ * @param name A hostname (A or AAAA-Record) or IP address to be added to
+ * the hosts allow list
  * @return FALSE if the given host does not resolve, otherwise TRUE
  */
 int add_host_allow(char *name) {
@@ -234,39 +268,23 @@ int add_host_allow(char *name) {
   ASSERT(name);
 
   memset(&hints, 0, sizeof(struct addrinfo));
-  hints.ai_family = PF_INET; /* we support just IPv4 currently */
+  hints.ai_family = PF_UNSPEC;
 
   if(getaddrinfo(name, NULL, &hints, &res) != 0)
     return FALSE;
 
   for(_res = res; _res; _res = _res->ai_next) {
+    struct host_allow h= {.family= _res->ai_family};
     if(_res->ai_family == AF_INET) {
-       HostsAllow h;
-       struct sockaddr_in *sin = (struct sockaddr_in *)_res->ai_addr;
-
-       NEW(h);      
-       memcpy(&h->network, &sin->sin_addr, 4);
-       h->mask=    0xffffffff;
-       LOCK(hostlist_mutex)
-       if(hostlist) {
-         HostsAllow p, n;
-         for(n= p= hostlist; p; n= p, p= p->next) {
-           if((p->network == h->network) && ((p->mask == h->mask))) {
-             DEBUG("%s: Debug: Skipping redundant host '%s'\n", prog, name); 
-             destroy_host_allow(h);
-             goto done;
-           }
-         }
-         DEBUG("%s: Debug: Adding host allow '%s'\n", prog, name); 
-         n->next= h;
-       } else {
-         DEBUG("%s: Debug: Adding host allow '%s'\n", prog, name);
-
-         hostlist= h;
-       }
-       done:
-       END_LOCK;
+      h.prefix= 32;
+      memcpy(h.network, &((struct sockaddr_in *)_res->ai_addr)->sin_addr, 4);
+    } else if(_res->ai_family == AF_INET6) {
+      h.prefix= 128;
+      memcpy(h.network, &((struct sockaddr_in6 *)_res->ai_addr)->sin6_addr, 16);
+    } else {
+      continue;
     }
+    add_allow(&h, name);
   }
 
   freeaddrinfo(res);
@@ -283,8 +301,7 @@ int add_host_allow(char *name) {
 
 int add_net_allow(char *s_network) {
 
-  struct ulong_net net={0, 0};
-  HostsAllow h;
+  struct host_allow net;
 
   ASSERT(s_network);
 
@@ -296,64 +313,71 @@ int add_net_allow(char *s_network) {
 
   }
 
-  NEW(h);
-
-  h->network=net.network;
-  h->mask=net.mask;
-
-  LOCK(hostlist_mutex)
-
-  if(hostlist) {
-
-    HostsAllow p, n;
+  add_allow(&net, s_network);
 
-    for(n= p= hostlist; p; n= p, p= p->next) {
-
-      if((p->network == net.network) && ((p->mask == net.mask))) {
-	
-        DEBUG("%s: Debug: Skipping redundant net '%s'.\n",
-              prog, s_network); 
-        destroy_host_allow(h);
-        goto done;
-	
-      }
+  return TRUE;
+}
 
-    }
 
-    DEBUG("%s: Debug: Adding net allow '%s'.\n",
-          prog, s_network); 
+/**
+ * Are any hosts present in the host allow list?
+ * @return TRUE if the host allow list is non-empty, otherwise FALSE
+ */
+int has_hosts_allow() {
 
-    n->next= h;
+  return hostcount > 0;
 
-  } else {
+}
 
-    DEBUG("%s: Debug: Adding net allow '%s'.\n",
-          prog, s_network); 
 
-    hostlist= h;
+/**
+ * Compile the host allow list into the lookup trie used by
+ * match_host_allow(). The new trie replaces the current one atomically,
+ * lookups don't lock. The previous trie is freed, so this function must
+ * be called by the thread doing the lookups, i.e. the http server when
+ * it starts.
+ */
+void compile_hosts_allow() {
 
-  }
+  AllowTrie t= hostcount ? compile_trie() : NULL;
 
-  done:
-  END_LOCK;
+  t= __atomic_exchange_n(&hosttrie, t, __ATOMIC_ACQ_REL);
+  FREE(t);
 
-  return TRUE;
 }
 
 
 /**
- * Are any hosts present in the host allow list?
- * @return TRUE if the host allow list is non-empty, otherwise FALSE
+ * Check if the address is in the compiled host allow list
+ * @param family The address family, AF_INET or AF_INET6
+ * @param address The address in network byte order
+ * @return TRUE if the address is allowed, otherwise FALSE
  */
-int has_hosts_allow() {
+int match_host_allow(int family, const void *address) {
 
-  int rv;
+  static const unsigned char v4mapped[12]= {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+  AllowTrie t= __atomic_load_n(&hosttrie, __ATOMIC_ACQUIRE);
+  const unsigned char *a= address;
+  unsigned int n= 0, bits= 32, b;
 
-  LOCK(hostlist_mutex)
-      rv= (hostlist != NULL);
-  END_LOCK;
+  if(! t)
+    return FALSE;
 
-  return rv;
+  if(family == AF_INET6) {
+    if(memcmp(a, v4mapped, sizeof(v4mapped)) == 0) {
+      a+= sizeof(v4mapped);
+    } else {
+      n= 1;
+      bits= 128;
+    }
+  }
+
+  for(b= 0; ! t->node[n].allow; b++) {
+    if(b == bits || ! (n= t->node[n].child[(a[b >> 3] >> (7 - (b & 7))) & 1]))
+      return FALSE;
+  }
+
+  return TRUE;
 
 }
 
@@ -363,14 +387,12 @@ int has_hosts_allow() {
  */
 void destroy_hosts_allow() {
 
-  if(has_hosts_allow()) {
+  AllowTrie t= __atomic_exchange_n(&hosttrie, NULL, __ATOMIC_ACQ_REL);
 
-    LOCK(hostlist_mutex)
-	destroy_host_allow(hostlist);
-        hostlist= NULL;
-    END_LOCK;
-
-  }
+  FREE(t);
+  FREE(hostlist);
+  hostcount= 0;
+  hostsize= 0;
 
 }
 
@@ -413,7 +435,7 @@ static void check_Impl() {
  */
 static int authenticate(const struct in_addr addr) {
 
-  if(is_host_allow(addr)) {
+  if(match_host_allow(AF_INET, &addr)) {
 
     return TRUE;
 
@@ -434,44 +456,78 @@ static int authenticate(const struct in_addr addr) {
 
 
 /**
- * Returns TRUE if host is allowed to connect to
- * this server
+ * Add the network to the host allow list unless it is there already
+ * @param net The network
+ * @param name The host or network name for the debug message
+ * @return TRUE if the network was added, FALSE if it was redundant
  */
-static int is_host_allow(const struct in_addr addr) { 
+static int add_allow(HostsAllow net, const char *name) {
 
-  HostsAllow p;
-  int rv= FALSE;
+  int i;
 
-  LOCK(hostlist_mutex)
+  for(i= 0; i < hostcount; i++) {
+    if(hostlist[i].family == net->family && hostlist[i].prefix == net->prefix && ! memcmp(hostlist[i].network, net->network, sizeof(net->network))) {
+      DEBUG("%s: Debug: Skipping redundant host allow '%s'\n", prog, name);
+      return FALSE;
+    }
+  }
 
-  for(p= hostlist; p; p= p->next) {
+  DEBUG("%s: Debug: Adding host allow '%s'\n", prog, name);
+  if(hostcount == hostsize) {
+    /* Grow geometrically, the list is in the configuration arena where resize copies */
+    hostsize= hostsize ? 2 * hostsize : 16;
+    RESIZE(hostlist, hostsize * sizeof(struct host_allow));
+  }
+  hostlist[hostcount++]= *net;
 
-    if((p->network & p->mask) == (addr.s_addr & p->mask)) {
+  return TRUE;
 
-      rv= TRUE;
-      break;
+}
 
-    }
 
+/**
+ * Build a trie of the host allow list. A network is not inserted below
+ * a shorter network which contains it.
+ * @return The trie
+ */
+static AllowTrie compile_trie() {
+
+  int i, b;
+  unsigned int size= 2;
+  AllowTrie t;
+
+  for(i= 0; i < hostcount; i++)
+    size+= hostlist[i].prefix;
+
+  t= CALLOC(1, sizeof(struct allow_trie) + size * sizeof(struct allow_node));
+  t->count= 2;
+
+  for(i= 0; i < hostcount; i++) {
+    HostsAllow h= &hostlist[i];
+    unsigned int n= h->family == AF_INET6 ? 1 : 0;
+    for(b= 0; b < h->prefix && ! t->node[n].allow; b++) {
+      int bit= (h->network[b >> 3] >> (7 - (b & 7))) & 1;
+      if(! t->node[n].child[bit])
+        t->node[n].child[bit]= t->count++;
+      n= t->node[n].child[bit];
+    }
+    t->node[n].allow= TRUE;
   }
 
-  END_LOCK;
-
-  if (rv)
-      return rv;
-
-  return rv;
+  return t;
 
 }
 
 
 /**
- * Parse network string and return numeric IP and netmask
+ * Parse network string and return numeric IP and prefix length. IPv4
+ * networks are given as IP/prefix or IP/netmask, IPv6 networks as
+ * IP/prefix.
  * @param s_network A network identifier in IP/mask format to be parsed
- * @param net A structure holding IP and mask of the network
+ * @param net A structure holding IP and prefix of the network
  * @return FALSE if parsing fails otherwise TRUE
  */
-static int parse_network(char *s_network, struct ulong_net *net) {
+static int parse_network(char *s_network, HostsAllow net) {
 
   char *temp=NULL;
   char *copy=NULL;
@@ -481,13 +537,34 @@ static int parse_network(char *s_network, struct ulong_net *net) {
   int   dotcount=0;
   int   count=0;
   int   rv=FALSE;
+  unsigned long mask;
   struct in_addr inp;
 
   ASSERT(s_network);
   ASSERT(net);
 
+  memset(net, 0, sizeof(struct host_allow));
   temp= copy= Str_dup(s_network);
 
+  if(strchr(copy, ':')) {
+
+    /* IPv6 network */
+
+    net->family= AF_INET6;
+    net->prefix= 128;
+    if((temp= strchr(copy, '/'))) {
+      char *end;
+      *temp++= 0;
+      net->prefix= (int)strtol(temp, &end, 10);
+      if(! *temp || *end || net->prefix < 0 || net->prefix > 128)
+        goto done;
+    }
+    if(inet_pton(AF_INET6, copy, net->network) != 1)
+      goto done;
+    goto prefix;
+
+  }
+
   /* decide if we have xxx.xxx.xxx.xxx/yyy or
                        xxx.xxx.xxx.xxx/yyy.yyy.yyy.yyy */
   while (*temp!=0) {
@@ -561,41 +638,44 @@ static int parse_network(char *s_network, struct ulong_net *net) {
     goto done;
 
   }
-  net->network=inp.s_addr;
+  net->family= AF_INET;
+  memcpy(net->network, &inp.s_addr, 4);
 
-  /* Convert short netmasks to integer */
   if (longmask==NULL) {
 
     if ((shortmask > 32) || (shortmask < 0)) {
 
       goto done;
 
-    } else if ( shortmask == 32 ) {
-
-      net->mask=-1;
-
-    } else {
-
-      net->mask= (1<<shortmask)-1;
-      net->mask= htonl(net->mask<<(32-shortmask));
-
     }
 
+    net->prefix= shortmask;
+
   } else { 	 
   	 
-    /* Parse long netmasks */ 	 
+    /* Parse long netmasks, the netmask bits must be contiguous */ 	 
     if (inet_aton(longmask, &inp) == 0) { 	 
 
       goto done; 	 
 
     }
 
-    net->mask=inp.s_addr;
+    mask= ntohl(inp.s_addr);
+    for (net->prefix= 0; net->prefix < 32 && (mask & (0x80000000UL >> net->prefix)); net->prefix++)
+      ;
+    if (net->prefix < 32 && (mask & (0xffffffffUL >> net->prefix))) {
+
+      goto done;
+
+    }
 
   }
 
+  prefix:
+
   /* Remove bogus network components */
-  net->network&=net->mask;
+  for (count= net->prefix; count < (net->family == AF_INET6 ? 128 : 32); count++)
+    net->network[count >> 3]&= ~(0x80 >> (count & 7));
 
   /* Everything went fine, so we return TRUE! */
   rv=TRUE;
@@ -610,6 +690,29 @@ static int parse_network(char *s_network, struct ulong_net *net) {
 /* --------------------------------------------------------------- Factories */
 
 
+/**
+ * Wait up to one second for a connection on the server socket or the
+ * control socket. If timeout or error occured, return -1 to allow the
+ * caller to handle various states (such as stopped) which can occure
+ * in the meantime.
+ * @return The server socket with a pending connection or -1
+ */
+static int wait_connection() {
+
+  struct pollfd fds[2]= {{.fd= myServerSocket, .events= POLLIN}, {.fd= myControlSocket, .events= POLLIN}};
+  int n= myControlSocket >= 0 ? 2 : 1;
+
+  if(poll(fds, n, 1000) > 0) {
+    for(int i= 0; i < n; i++)
+      if(fds[i].revents & POLLIN)
+        return fds[i].fd;
+  }
+
+  return -1;
+
+}
+
+
 /**
  * Accept connections from Clients and create a Socket_T object for
  * each successful accept. If accept fails, return a NULL object
@@ -620,25 +723,27 @@ static Socket_T socket_producer(int server, int port, void *sslserver) {
   struct sockaddr_in in;
   socklen_t len= sizeof(struct sockaddr_in);
 
-  if(can_read(server, 1)) {
+  if(server == myControlSocket) {
 
-    if( (client= accept(server, (struct sockaddr*)&in, &len)) < 0) {
+    if((client= accept(server, NULL, NULL)) < 0) {
+      LogError("http server: cannot accept connection on the control socket -- %s\n", STRERROR);
+      return NULL;
+    }
+    if(set_noblock(client) < 0) {
+      goto error;
+    }
+    return socket_create_a(client, LOCALHOST, port, NULL);
 
-      if(stopped) {
-        LogError("http server: service stopped\n");
-      }  else {
-        LogError("http server: cannot accept connection -- %s\n", STRERROR);
-      }
+  }
 
-      return NULL;
+  if( (client= accept(server, (struct sockaddr*)&in, &len)) < 0) {
 
+    if(stopped) {
+      LogError("http server: service stopped\n");
+    }  else {
+      LogError("http server: cannot accept connection -- %s\n", STRERROR);
     }
 
-  } else {
-
-    /* If timeout or error occured, return NULL to allow the caller to
-     * handle various states (such as stopped) which can occure in the
-     * meantime */
     return NULL;
 
   }
@@ -665,21 +770,3 @@ static Socket_T socket_producer(int server, int port, void *sslserver) {
 }
 
 
-/* ----------------------------------------------------------------- Cleanup */
-
-
-/**
- * Free a (linked list of) host_allow ojbect(s). 
- */
-static void destroy_host_allow(HostsAllow p) {
-
-  HostsAllow a= p; 
-
-  if(a->next) {
-    destroy_host_allow(a->next);
-  }
-
-  FREE(a);
-
-}
-
@@ -39,10 +39,9 @@
 #define DEFAULT_QUEUE_LEN  10
 
 typedef struct host_allow {
-  unsigned long network;
-  unsigned long mask;
-  /* For internal use */
-  struct host_allow *next;
+  int family;                                      /**< AF_INET or AF_INET6 */
+  int prefix;                            /**< The network prefix length in bits */
+  unsigned char network[16];       /**< The network address, network byte order */
 } *HostsAllow;
 
 /* Public prototypes */
@@ -51,6 +50,8 @@ void stop_httpd();
 int add_host_allow(char *);
 int add_net_allow(char *);
 int has_hosts_allow();
+void compile_hosts_allow();
+int match_host_allow(int, const void *);
 void destroy_hosts_allow();
 
 
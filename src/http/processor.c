@@ -79,6 +79,14 @@
 #include <limits.h>
 #endif
 
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef HAVE_TIME_H
+#include <time.h>
+#endif
+
 #include "processor.h"
 #include "base64.h"
 
@@ -105,10 +113,35 @@
  *     The doGet/doPost routines act's on the COMMAND. See the
  *     cervlet.c code in this dir. for an example. 
  *
+ *  Verified credentials are cached for AUTH_CACHE_TTL seconds, so the
+ *  password digest or PAM conversation runs once per client and not
+ *  per request. The cache is only used from the http server thread.
+ *
  *  @file
  */
 
 
+/* ------------------------------------------------------------- Definitions */
+
+
+#define AUTH_CACHE_SIZE    64
+#define AUTH_CACHE_TTL     300
+#define AUTH_KEY_SIZE      16
+#define SESSION_COOKIE     "monit_session"
+#define SESSION_TOKEN_SIZE 16
+
+
+/* A verified Authorization header or session token. Only a keyed hash
+ * of the header or token is kept. */
+static struct credential {
+  unsigned char key[AUTH_KEY_SIZE];
+  char *uname;
+  time_t expire;
+} authCache[AUTH_CACHE_SIZE];
+
+static unsigned char authSecret[AUTH_KEY_SIZE];
+
+
 /* -------------------------------------------------------------- Prototypes */
 
 
@@ -118,7 +151,13 @@ static char *get_date(char *, int);
 static char *get_server(char *, int); 
 static void create_headers(HttpRequest);
 static void send_response(HttpResponse);
-static int basic_authenticate(HttpRequest);
+static int basic_authenticate(HttpRequest, HttpResponse);
+static int get_random(unsigned char *, int);
+static void hash_credential(const char *, unsigned char *);
+static const char *get_credential(const char *);
+static void add_credential(const char *, const char *, int);
+static const char *get_session(HttpRequest);
+static void add_session(HttpResponse, const char *);
 static void done(HttpRequest, HttpResponse);
 static void destroy_HttpRequest(HttpRequest);
 static void reset_response(HttpResponse res);
@@ -154,6 +193,24 @@ void *http_processor(Socket_T s) {
 }
 
 
+/**
+ * Forget all verified credentials and session tokens. Called when the
+ * http server starts and stops, so a reload invalidates the cache.
+ */
+void clear_credential_cache() {
+  int i;
+
+  for(i= 0; i < AUTH_CACHE_SIZE; i++) {
+    FREE(authCache[i].uname);
+  }
+  memset(authCache, 0, sizeof(authCache));
+  if(! get_random(authSecret, sizeof(authSecret))) {
+    for(i= 0; i < AUTH_KEY_SIZE; i++)
+      authSecret[i]= (unsigned char)random();
+  }
+}
+
+
 /**
  * Callback for implementors of cervlet functions.
  * @param doGetFunc doGet function
@@ -691,7 +748,7 @@ static void destroy_entry(void *p) {
  */
 static int is_authenticated(HttpRequest req, HttpResponse res) {
   if(Run.credentials!=NULL) {
-    if(! basic_authenticate(req)) {
+    if(! basic_authenticate(req, res)) {
       send_error(res, SC_UNAUTHORIZED,
 		 "You are <b>not</b> authorized to access <i>monit</i>. "
 		 "Either you supplied the wrong credentials (e.g. bad "
@@ -707,18 +764,28 @@ static int is_authenticated(HttpRequest req, HttpResponse res) {
 
 /**
  * Authenticate the basic-credentials (uname/password) submitted by
- * the user.
+ * the user. Credentials verified before and session tokens are looked
+ * up in the cache.
  */
-static int basic_authenticate(HttpRequest req) {
+static int basic_authenticate(HttpRequest req, HttpResponse res) {
   size_t n;
   char *password;
   char buf[STRLEN];
   char uname[STRLEN];
+  const char *user;
   const char *credentials= get_header(req, "Authorization");
 
+  if((user= get_session(req))) {
+    req->remote_user= Str_dup(user);
+    return TRUE;
+  }
   if(! (credentials && Str_startsWith(credentials, "Basic "))) {
     return FALSE;
   }
+  if((user= get_credential(credentials))) {
+    req->remote_user= Str_dup(user);
+    return TRUE;
+  }
   strncpy(buf, &credentials[6], sizeof(buf) - 1);
   buf[sizeof(buf) - 1] = 0;
   if((n= decode_base64((unsigned char*)uname, buf))<=0) {
@@ -746,10 +813,121 @@ static int basic_authenticate(HttpRequest req) {
     return FALSE;
   }
   req->remote_user= Str_dup(uname);
+  add_credential(credentials, uname, AUTH_CACHE_TTL);
+  if(Run.httpdsession)
+    add_session(res, uname);
   return TRUE;
 }
 
 
+/* -------------------------------------------------------- Credential cache */
+
+
+/**
+ * Read random bytes from /dev/urandom
+ * @return TRUE if the buffer was filled, otherwise FALSE
+ */
+static int get_random(unsigned char *buf, int len) {
+  int fd, n= -1;
+
+  if((fd= open("/dev/urandom", O_RDONLY)) >= 0) {
+    n= (int)read(fd, buf, len);
+    close(fd);
+  }
+  return n == len;
+}
+
+
+/**
+ * Compute the cache key of an Authorization header or session token
+ */
+static void hash_credential(const char *value, unsigned char *key) {
+  Util_hmacMD5((const unsigned char *)value, (int)strlen(value), authSecret, sizeof(authSecret), key);
+}
+
+
+/**
+ * Get the user of a verified Authorization header or session token
+ * @return The user name or NULL if not found or expired
+ */
+static const char *get_credential(const char *value) {
+  int i;
+  time_t now= time(NULL);
+  unsigned char key[AUTH_KEY_SIZE];
+
+  hash_credential(value, key);
+  for(i= 0; i < AUTH_CACHE_SIZE; i++) {
+    if(authCache[i].uname && authCache[i].expire > now && ! memcmp(authCache[i].key, key, AUTH_KEY_SIZE))
+      return authCache[i].uname;
+  }
+  return NULL;
+}
+
+
+/**
+ * Add a verified Authorization header or session token to the cache,
+ * replacing an expired entry or the one which expires first
+ */
+static void add_credential(const char *value, const char *uname, int ttl) {
+  int i;
+  struct credential *c= authCache;
+
+  for(i= 1; i < AUTH_CACHE_SIZE && c->uname; i++) {
+    if(! authCache[i].uname || authCache[i].expire < c->expire)
+      c= &authCache[i];
+  }
+  FREE(c->uname);
+  hash_credential(value, c->key);
+  c->uname= Str_dup(uname);
+  c->expire= time(NULL) + ttl;
+}
+
+
+/**
+ * Get the user of the session token submitted in the session cookie
+ * @return The user name or NULL if there is no valid session
+ */
+static const char *get_session(HttpRequest req) {
+  const char *p;
+  const char *cookie= get_header(req, "Cookie");
+
+  if(! (Run.httpdsession && cookie))
+    return NULL;
+  for(p= cookie; (p= strstr(p, SESSION_COOKIE "=")); p++) {
+    if(p == cookie || p[-1] == ' ' || p[-1] == ';') {
+      char token[2 * SESSION_TOKEN_SIZE + 1];
+      p+= strlen(SESSION_COOKIE "=");
+      if(strspn(p, "0123456789abcdef") != sizeof(token) - 1)
+        return NULL;
+      snprintf(token, sizeof(token), "%s", p);
+      return get_credential(token);
+    }
+  }
+  return NULL;
+}
+
+
+/**
+ * Start a session for the user and send the token in a cookie, so the
+ * client is authenticated by the token in subsequent requests
+ */
+static void add_session(HttpResponse res, const char *uname) {
+  int i;
+  char cookie[STRLEN];
+  char token[2 * SESSION_TOKEN_SIZE + 1];
+  unsigned char random[SESSION_TOKEN_SIZE];
+
+  if(! get_random(random, sizeof(random)))
+    return;
+  for(i= 0; i < SESSION_TOKEN_SIZE; i++)
+    snprintf(token + 2 * i, 3, "%02x", random[i]);
+  add_credential(token, uname, Run.httpdsession);
+  snprintf(cookie, sizeof(cookie), "%s=%s; Path=/; Max-Age=%d; HttpOnly; SameSite=Strict%s",
+           SESSION_COOKIE, token, Run.httpdsession, Run.httpdssl ? "; Secure" : "");
+  set_header(res, "Set-Cookie", cookie);
+}
+
+
 /* --------------------------------------------------------------- Utilities */
 
 
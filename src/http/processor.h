@@ -115,5 +115,6 @@ const char *get_header(HttpRequest req, const char *header_name);
 void send_error(HttpResponse, int status, const char *message);
 const char *get_parameter(HttpRequest req, const char *parameter_name);
 void set_header(HttpResponse res, const char *name, const char *value);
+void clear_credential_cache();
 
 #endif
@@ -372,8 +372,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 270
-#define YY_END_OF_BUFFER 271
+#define YY_NUM_RULES 296
+#define YY_END_OF_BUFFER 297
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -381,424 +381,475 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_acclist[2450] =
+static yyconst flex_int16_t yy_acclist[2722] =
     {   0,
-        2,    2,  266,  266,  271,  265,  270,    1,  265,  270,
-        2,  270,  265,  270,  232,  265,  270,    2,  231,  265,
-      270,  231,  265,  270,  218,  265,  270,  232,  265,  270,
-      226,  231,  265,  270,  216,  217,  231,  265,  270,  197,
-      231,  265,  270,  198,  231,  265,  270,  196,  231,  265,
-      270,  231,  265,  270,  186,  231,  265,  270,  231,  265,
-      270,  231,  265,  270,  231,  265,  270,  231,  265,  270,
-      231,  265,  270,  231,  265,  270,  231,  265,  270,  231,
-      265,  270,  231,  265,  270,  231,  265,  270,  231,  265,
-      270,  231,  265,  270,  231,  265,  270,  231,  265,  270,
-
-      231,  265,  270,  231,  265,  270,  231,  265,  270,  231,
-      265,  270,  231,  265,  270,    2,  231,  265,  270,  248,
-      265,  270,  243,  265,  270,  244,  270,  243,  248,  265,
-      270,  245,  265,  270,  247,  248,  265,  270,  239,  265,
-      270,  240,  270,  241,  265,  270,  239,  265,  270,  233,
-      265,  270,  234,  270,  238,  265,  270,  235,  265,  270,
-      238,  265,  270,  252,  265,  270,16634,  249,  252,  265,
-      270,16634,  249,  270,16634,  249,  265,  270,16634,  249,
-      265,  270,  256,  265,  270,16634,  254,  265,  270,16634,
-      265,  270,  255,  265,  270,16634,  252,  265,  270,  270,
-
-      260,  265,  270,  257,  265,  270,  260,  265,  270,  264,
-      265,  270,  261,  264,  265,  270,  264,  265,  270,  262,
-      264,  265,  270,  269,  270,  266,  270,  269,  270,  269,
-      270,    1,  199,  222,    2,    2,    2,  231,    2,  231,
-        2,    2,  231,  231,  231,  223,  225,  231,  225,  231,
-      219,  231,  219,  231,  216,  217,  219,  231,  219,  231,
-      198,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,    4,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  198,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  189,  219,  231,  219,
-      231,  219,  231,  219,  231,  196,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,   27,  219,
-      231,  219,  231,  219,  231,  219,  231,    3,  219,  231,
-      187,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  197,  219,  231,  219,  231,
-      188,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  199,  219,  231,  219,  231,
-      219,  231,  219,  231,   21,  219,  231,    7,  219,  231,
-       28,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  248,
-
-      243,  243,  248,  248,  246,  248,  242,  239,  242,  240,
-      242,  239,  242,  239,  240,  242,  242,  240,  242,  240,
-      241,  240,  233,  235,  252,16634,16634,  252,  249,  252,
-    16634,  249,16634,  249,  256,16634,  256,  256,  254,16634,
-      254,  254,  253,  255,16634,  255,  255,  257,  261,  262,
-      269,  266,  269,  269,  220,  222,    2,    2,  231,    2,
-      231,    2,  224,    2,  224,  231,  224,  221,  223,  225,
-      231,  219,  231,  217,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,   10,  219,  231,  219,  231,    5,
-      219,  231,  219,  231,   20,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  125,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  133,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,   85,  219,  231,  219,  231,   90,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,    6,  219,  231,  219,  231,  219,  231,
-       79,  219,  231,  109,  219,  231,  219,  231,   99,  219,
-      231,  219,  231,  219,  231,  219,  231,   11,  219,  231,
-
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  159,  219,  231,  219,
-      231,  122,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      148,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  174,  219,  231,
-       82,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,   34,  219,  231,
-      219,  231,  219,  231,   98,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,   89,  219,  231,   31,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,   15,
-      219,  231,  219,  231,  219,  231,  219,  231,   59,  219,
-      231,  219,  231,   14,  219,  231,  219,  231,  219,  231,
-       96,  219,  231,  219,  231,  219,  231,   61,  219,  231,
-      108,  219,  231,  219,  231,  219,  231,  219,  231,  172,
-
-      219,  231,  219,  231,   13,  219,  231,  219,  231,  219,
-      231,   18,  219,  231,  219,  231,  246,  236,  237,  256,
-      254,  251,  255,  258,  259,  267,  269,  267,  268,  269,
-      268,  215,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  186,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  166,
-      219,  231,  133,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,   22,  219,  231,  154,  219,
-
-      231,  170,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  141,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  185,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,   72,  219,
-      231,  132,  219,  231,   77,  219,  231,  153,  219,  231,
-      219,  231,  219,  231,   83,  219,  231,  219,  231,   46,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  197,  219,  231,   94,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-
-      219,  231,  219,  231,  219,  231,  104,  219,  231,  219,
-      231,   87,  219,  231,  219,  231,  219,  231,  219,  231,
-       88,  219,  231,    7,  219,  231,  219,  231,   52,  219,
-      231,  219,  231,  219,  231,  140,  219,  231,  219,  231,
-      219,  231,   55,  219,  231,  219,  231,  175,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  155,  219,  231,  160,  219,  231,  219,  231,
-      142,  219,  231,  145,  219,  231,   80,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  219,  231,   54,
-      219,  231,  219,  231,  219,  231,  123,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,   16,  219,  231,
-       29,  219,  231,  219,  231,  219,  231,  219,  231,   57,
-      219,  231,   56,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,    8,  219,  231,
-     8442, 8442,  256, 8442,  254, 8442,  255,  219,  231,  219,
-      231,  219,  231,   62,  219,  231,   47,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  176,  219,  231,  193,  194,
-      195,  219,  231,  219,  231,  161,  219,  231,   67,  219,
-      231,  219,  231,  219,  231,   36,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  198,  219,  231,  219,
-      231,  202,  219,  231,   26,  219,  231,  164,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      132,  219,  231,   40,  219,  231,  219,  231,  219,  231,
-      219,  231,  138,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,   91,  219,  231,   92,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  147,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,   86,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,   97,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-       58,  219,  231,  219,  231,   93,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,   69,  219,  231,   95,
-      219,  231,  219,  231,  219,  231,  219,  231,  145,  219,
-
-      231,  139,  219,  231,  219,  231,  134,  219,  231,  135,
-      219,  231,   53,  219,  231,  219,  231,  219,  231,   24,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,   19,  219,
-      231,  136,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,   17,  219,  231,  219,  231,   12,  219,  231,
-      219,  231,  219,  231,  219,  231,  152,  219,  231,  105,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  204,  205,  219,  231,  219,  231,
-       84,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  219,  231,   67,
-      219,  231,   35,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,   32,  219,  231,  219,  231,  219,  231,
-      156,  219,  231,  219,  231,   30,  219,  231,  184,  219,
-      231,  219,  231,  219,  231,  219,  231,  214,  219,  231,
-      219,  231,   50,  219,  231,  149,  219,  231,  219,  231,
-      138,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  107,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  122,  219,  231,  219,  231,  131,  219,  231,
-
-      171,  219,  231,  219,  231,  219,  231,  219,  231,  168,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  100,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  130,  219,  231,  111,  219,
-      231,  219,  231,  219,  231,   23,  219,  231,  219,  231,
-      219,  231,  219,  231,   74,  219,  231,  219,  231,  219,
-      231,  219,  231,   38,  219,  231,   75,  219,  231,  102,
-      219,  231,   60,  219,  231,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  143,  219,  231,
-      219,  231,  219,  231,    8,  219,  231,  219,  231,   41,
-      219,  231,  219,  231,  219,  231,  144,  219,  231,   44,
-      219,  231,  129,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  173,
-      219,  231,  194,  193,  195,  219,  231,  219,  231,   76,
-      219,  231,  203,  219,  231,   33,  219,  231,  219,  231,
-      219,  231,  141,  219,  231,  219,  231,  219,  231,  215,
-      184,  219,  231,  219,  231,  219,  231,  196,  219,  231,
-      219,  231,  219,  231,  200,  219,  231,  219,  231,  165,
-
-      219,  231,  219,  231,  219,  231,  190,  219,  231,   37,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  131,  219,
-      231,   63,  219,  231,  219,  231,  219,  231,  106,  219,
-      231,  219,  231,   45,  219,  231,  218,  219,  231,  219,
-      231,   49,  219,  231,  219,  231,  219,  231,    9,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  110,  219,  231,
-      219,  231,   66,  219,  231,  130,  219,  231,  219,  231,
-      137,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-
-      231,  219,  231,  219,  231,   68,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      219,  231,    8,  219,  231,  219,  231,  219,  231,   70,
-      219,  231,  127,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  114,
-      219,  231,  219,  231,  219,  231,   39,  219,  231,  227,
-      189,  219,  231,  219,  231,  219,  231,  179,  219,  231,
-      178,  219,  231,  219,  231,  187,  219,  231,  190,  112,
-      219,  231,  219,  231,  219,  231,  147,  219,  231,  219,
-      231,  188,  219,  231,  101,  219,  231,  230,  163,  219,
-
-      231,  199,  219,  231,  181,  219,  231,  219,  231,  219,
-      231,  219,  231,    9,  219,  231,   58,  219,  231,  219,
-      231,   48,  219,  231,  219,  231,  183,  219,  231,  177,
-      219,  231,  219,  231,  219,  231,  219,  231,   65,  219,
-      231,   25,  219,  231,  219,  231,   66,  219,  231,  219,
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  229,
-      219,  231,  219,  231,  126,  219,  231,  124,  219,  231,
-      219,  231,  219,  231,  180,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  158,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  203,  219,  231,  219,
-
-      231,  219,  231,  219,  231,  219,  231,  219,  231,  219,
-      231,  219,  231,  230,  230,  201,  219,  231,  219,  231,
-      219,  231,   48,  219,  231,  167,  219,  231,  219,  231,
-      219,  231,  219,  231,  162,  219,  231,  219,  231,  219,
-      231,   51,  219,  231,  219,  231,  229,  229,  169,  219,
-      231,  128,  219,  231,  219,  231,  219,  231,  151,  219,
-      231,  119,  219,  231,  219,  231,  219,  231,  212,  208,
-      210,  219,  231,  219,  231,  113,  219,  231,  150,  219,
-      231,  219,  231,  203,  146,  219,  231,  219,  231,  219,
-      231,   73,  219,  231,  219,  231,  190,  191,  219,  231,
-
-       71,  219,  231,  103,  219,  231,  215,  230,  140,  219,
-      231,   55,  219,  231,  219,  231,  116,  219,  231,  219,
-      231,  219,  231,  118,  219,  231,  219,  231,  219,  231,
-      215,  229,  219,  231,   56,  219,  231,  219,  231,  219,
-      231,  219,  231,  219,  231,  182,  219,  231,  219,  231,
-      219,  231,  219,  231,  192,   64,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,  219,  231,  124,  219,
-      231,  263,  219,  231,  219,  231,  206,  211,  121,  219,
-      231,  219,  231,  157,  219,  231,  219,  231,  219,  231,
-      219,  231,  228,  117,  219,  231,  219,  231,  219,  231,
-
-      219,  231,   78,  219,  231,  213,   42,  219,  231,  120,
-      219,  231,  219,  231,  219,  231,  219,  231,  219,  231,
-      204,  205,  115,  219,  231,   81,  219,  231,  219,  231,
-      219,  231,  209,  219,  231,  207,  219,  231,  219,  231,
-      219,  231,  219,  231,  219,  231,   43,  219,  231
+        2,    2,  292,  292,  297,  291,  296,    1,  291,  296,
+        2,  296,  291,  296,  258,  291,  296,    2,  257,  291,
+      296,  257,  291,  296,  244,  291,  296,  258,  291,  296,
+      252,  257,  291,  296,  242,  243,  257,  291,  296,  223,
+      257,  291,  296,  224,  257,  291,  296,  222,  257,  291,
+      296,  257,  291,  296,  193,  257,  291,  296,  257,  291,
+      296,  257,  291,  296,  257,  291,  296,  257,  291,  296,
+      257,  291,  296,  257,  291,  296,  257,  291,  296,  257,
+      291,  296,  257,  291,  296,  257,  291,  296,  257,  291,
+      296,  257,  291,  296,  257,  291,  296,  257,  291,  296,
+
+      257,  291,  296,  257,  291,  296,  257,  291,  296,  257,
+      291,  296,  257,  291,  296,  257,  291,  296,    2,  257,
+      291,  296,  274,  291,  296,  269,  291,  296,  270,  296,
+      269,  274,  291,  296,  271,  291,  296,  273,  274,  291,
+      296,  265,  291,  296,  266,  296,  267,  291,  296,  265,
+      291,  296,  259,  291,  296,  260,  296,  264,  291,  296,
+      261,  291,  296,  264,  291,  296,  278,  291,  296,16660,
+      275,  278,  291,  296,16660,  275,  296,16660,  275,  291,
+      296,16660,  275,  291,  296,  282,  291,  296,16660,  280,
+      291,  296,16660,  291,  296,  281,  291,  296,16660,  278,
+
+      291,  296,  296,  286,  291,  296,  283,  291,  296,  286,
+      291,  296,  290,  291,  296,  287,  290,  291,  296,  290,
+      291,  296,  288,  290,  291,  296,  295,  296,  292,  296,
+      295,  296,  295,  296,    1,  225,  248,    2,    2,    2,
+      257,    2,  257,    2,    2,  257,  257,  257,  249,  251,
+      257,  251,  257,  245,  257,  245,  257,  242,  243,  245,
+      257,  245,  257,  224,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,    4,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  224,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  196,  245,  257,  245,  257,  245,  257,
+      245,  257,  222,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,   27,  245,  257,  245,  257,
+      245,  257,  245,  257,    3,  245,  257,  194,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  223,  245,  257,  245,  257,  195,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      217,  245,  257,  245,  257,  225,  245,  257,  245,  257,
+      245,  257,  245,  257,   21,  245,  257,  245,  257,    7,
+      245,  257,   28,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  274,  269,  269,  274,  274,
+      272,  274,  268,  265,  268,  266,  268,  265,  268,  265,
+      266,  268,  268,  266,  268,  266,  267,  266,  259,  261,
+      278,16660,16660,  278,  275,  278,16660,  275,16660,  275,
+      282,16660,  282,  282,  280,16660,  280,  280,  279,  281,
+    16660,  281,  281,  283,  287,  288,  295,  292,  295,  295,
+      246,  248,    2,    2,  257,    2,  257,    2,  257,    2,
+      250,    2,  250,  257,  257,  250,  247,  249,  251,  257,
+      251,  257,  245,  257,  245,  257,  243,  245,  257,  245,
+
+      257,  245,  257,  245,  257,  245,  257,   10,  245,  257,
+      245,  257,    5,  245,  257,  245,  257,  213,  245,  257,
+      245,  257,   20,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  126,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  138,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,   85,  245,  257,  245,  257,   90,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+
+      257,  245,  257,  245,  257,  245,  257,    6,  245,  257,
+      245,  257,  245,  257,   79,  245,  257,  110,  245,  257,
+      245,  257,   99,  245,  257,  245,  257,  245,  257,  245,
+      257,   11,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      164,  245,  257,  245,  257,  123,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  153,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  181,
+      245,  257,   82,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,   34,  245,  257,  245,  257,
+      245,  257,   98,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,   89,  245,  257,   31,  245,  257,  245,
+
+      257,  245,  257,  245,  257,  245,  257,   15,  245,  257,
+      245,  257,  245,  257,  245,  257,   59,  245,  257,  245,
+      257,   14,  245,  257,  245,  257,  245,  257,   96,  245,
+      257,  245,  257,  245,  257,   61,  245,  257,  109,  245,
+      257,  245,  257,  245,  257,  245,  257,  179,  245,  257,
+      245,  257,   13,  245,  257,  245,  257,  245,  257,   18,
+      245,  257,  245,  257,  245,  257,  272,  262,  263,  282,
+      280,  277,  281,  284,  285,  293,  295,  293,  294,  295,
+      294,  241,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  193,  245,  257,  245,
+
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  173,  245,  257,  138,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,   22,  245,  257,  159,  245,  257,  177,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  146,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  192,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,   72,  245,
+
+      257,  137,  245,  257,   77,  245,  257,  158,  245,  257,
+      245,  257,  245,  257,   83,  245,  257,  245,  257,   46,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  223,  245,  257,   94,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  104,  245,
+      257,  245,  257,  245,  257,   87,  245,  257,  245,  257,
+      245,  257,  245,  257,   88,  245,  257,  245,  257,    7,
+      245,  257,  216,  245,  257,  245,  257,   52,  245,  257,
+
+      245,  257,  245,  257,  145,  245,  257,  245,  257,  245,
+      257,  245,  257,   55,  245,  257,  245,  257,  182,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  160,
+      245,  257,  245,  257,  165,  245,  257,  245,  257,  245,
+      257,  147,  245,  257,  245,  257,  150,  245,  257,   80,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,   54,  245,  257,  245,  257,  245,  257,  124,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+       16,  245,  257,   29,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,   57,  245,  257,   56,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,    8,  245,  257,  245,  257, 8468, 8468,  282,
+     8468,  280, 8468,  281,  245,  257,  245,  257,  245,  257,
+       62,  245,  257,   47,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  183,  245,
+
+      257,  200,  201,  202,  245,  257,  245,  257,  168,  245,
+      257,   67,  245,  257,  245,  257,  245,  257,   36,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  224,
+      245,  257,  245,  257,  228,  245,  257,   26,  245,  257,
+      171,  245,  257,  245,  257,  245,  257,  245,  257,  130,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  137,  245,
+      257,   40,  245,  257,  245,  257,  245,  257,  245,  257,
+      143,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,   91,  245,  257,   92,  245,  257,  245,  257,  245,
+
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  152,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,   86,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,   97,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,   58,  245,
+      257,  245,  257,   93,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+
+       69,  245,  257,   95,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  215,  245,  257,  150,
+      245,  257,  144,  245,  257,  245,  257,  139,  245,  257,
+      140,  245,  257,   53,  245,  257,  245,  257,  245,  257,
+       24,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,   19,
+      245,  257,  245,  257,  141,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,   17,  245,  257,  245,  257,
+       12,  245,  257,  245,  257,  245,  257,  245,  257,  167,
+      245,  257,  157,  245,  257,  106,  245,  257,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      105,  245,  257,  245,  257,  230,  231,  245,  257,  245,
+      257,   84,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,   67,  245,  257,   35,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,   32,  245,  257,  245,
+      257,  245,  257,  161,  245,  257,  245,  257,   30,  245,
+      257,  245,  257,  191,  245,  257,  245,  257,  245,  257,
+      245,  257,  240,  245,  257,  245,  257,   50,  245,  257,
+      154,  245,  257,  245,  257,  143,  245,  257,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  108,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  123,  245,  257,
+      245,  257,  245,  257,  136,  245,  257,  178,  245,  257,
+      132,  245,  257,  245,  257,  245,  257,  245,  257,  131,
+      245,  257,  175,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  100,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  135,  245,
+      257,  112,  245,  257,  245,  257,  166,  245,  257,  245,
+      257,  245,  257,   23,  245,  257,  245,  257,  245,  257,
+      245,  257,   74,  245,  257,  245,  257,  245,  257,  245,
+      257,   38,  245,  257,   75,  245,  257,  102,  245,  257,
+       60,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  148,  245,  257,
+      245,  257,  245,  257,    8,  245,  257,  245,  257,   41,
+      245,  257,  245,  257,  245,  257,  213,  245,  257,  149,
+      245,  257,   44,  245,  257,  134,  245,  257,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  180,  245,  257,  203,  201,  200,
+      202,  245,  257,  245,  257,   76,  245,  257,  229,  245,
+      257,   33,  245,  257,  245,  257,  245,  257,  146,  245,
+      257,  245,  257,  245,  257,  245,  257,  241,  191,  245,
+      257,  245,  257,  245,  257,  222,  245,  257,  245,  257,
+      245,  257,  226,  245,  257,  245,  257,  172,  245,  257,
+      245,  257,  245,  257,  197,  245,  257,   37,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,  136,  245,
+
+      257,   63,  245,  257,  245,  257,  245,  257,  107,  245,
+      257,  245,  257,   45,  245,  257,  244,  245,  257,  245,
+      257,   49,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,    9,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  133,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  111,  245,  257,  245,  257,  245,
+      257,  245,  257,   66,  245,  257,  135,  245,  257,  221,
+      245,  257,  245,  257,  142,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,   68,
+      245,  257,  245,  257,  211,  245,  257,  245,  257,  245,
+
+      257,  245,  257,  245,  257,  245,  257,  245,  257,    8,
+      245,  257,  245,  257,  245,  257,   70,  245,  257,  128,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  204,  245,  257,  245,
+      257,  115,  245,  257,  245,  257,  245,  257,   39,  245,
+      257,  245,  257,  253,  196,  245,  257,  245,  257,  245,
+      257,  186,  245,  257,  185,  245,  257,  245,  257,  194,
+      245,  257,  197,  113,  245,  257,  245,  257,  245,  257,
+      152,  245,  257,  245,  257,  195,  245,  257,  101,  245,
+      257,  256,  245,  257,  170,  245,  257,  225,  245,  257,
+
+      188,  245,  257,  245,  257,  245,  257,  219,  245,  257,
+      245,  257,  245,  257,  245,  257,    9,  245,  257,   58,
+      245,  257,  245,  257,   48,  245,  257,  245,  257,  190,
+      245,  257,  184,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,   65,  245,  257,  245,  257,   25,  245,
+      257,  245,  257,   66,  245,  257,  245,  257,  245,  257,
+      245,  257,  245,  257,  245,  257,  255,  245,  257,  245,
+      257,  211,  127,  245,  257,  125,  245,  257,  245,  257,
+      245,  257,  187,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  163,  245,  257,  245,  257,  245,  257,
+
+      245,  257,  245,  257,  245,  257,  245,  257,  229,  245,
+      257,  245,  257,  245,  257,  245,  257,  245,  257,  218,
+      245,  257,  245,  257,  245,  257,  245,  257,  256,  256,
+      245,  257,  227,  245,  257,  245,  257,  245,  257,  245,
+      257,   48,  245,  257,  174,  245,  257,  245,  257,  245,
+      257,  245,  257,  245,  257,  245,  257,  169,  245,  257,
+      245,  257,  245,  257,   51,  245,  257,  245,  257,  255,
+      255,  176,  245,  257,  129,  245,  257,  245,  257,  245,
+      257,  156,  245,  257,  120,  245,  257,  245,  257,  245,
+      257,  238,  234,  236,  245,  257,  245,  257,  114,  245,
+
+      257,  245,  257,  155,  245,  257,  245,  257,  245,  257,
+      229,  151,  245,  257,  245,  257,  245,  257,  245,  257,
+       73,  245,  257,  245,  257,  197,  198,  245,  257,   71,
+      245,  257,  103,  245,  257,  241,  256,  245,  257,  214,
+      245,  257,  145,  245,  257,   55,  245,  257,  245,  257,
+      117,  245,  257,  245,  257,  245,  257,  245,  257,  245,
+      257,  119,  245,  257,  245,  257,  245,  257,  241,  255,
+      245,  257,   56,  245,  257,  245,  257,  245,  257,  245,
+      257,  245,  257,  220,  245,  257,  210,  245,  257,  189,
+      245,  257,  245,  257,  245,  257,  245,  257,  245,  257,
+
+      199,   64,  245,  257,  217,  245,  257,  245,  257,  245,
+      257,  209,  245,  257,  245,  257,  245,  257,  245,  257,
+      245,  257,  125,  245,  257,  289,  245,  257,  245,  257,
+      232,  237,  122,  245,  257,  245,  257,  210,  162,  245,
+      257,  245,  257,  245,  257,  245,  257,  217,  245,  257,
+      245,  257,  207,  254,  118,  245,  257,  209,  208,  245,
+      257,  245,  257,  245,  257,  245,  257,   78,  245,  257,
+      239,   42,  245,  257,  212,  245,  257,  121,  245,  257,
+      245,  257,  245,  257,  205,  206,  208,  245,  257,  245,
+      257,  230,  231,  212,  116,  245,  257,   81,  245,  257,
+
+      245,  257,  245,  257,  235,  245,  257,  233,  245,  257,
+      245,  257,  245,  257,  245,  257,  245,  257,   43,  245,
+      257
     } ;
 
-static yyconst flex_int16_t yy_accept[1299] =
+static yyconst flex_int16_t yy_accept[1487] =
     {   0,
         1,    2,    3,    3,    3,    3,    3,    3,    3,    3,
         3,    3,    3,    3,    3,    4,    5,    6,    8,   11,
        13,   15,   18,   22,   25,   28,   31,   35,   40,   44,
        48,   52,   55,   59,   62,   65,   68,   71,   74,   77,
        80,   83,   86,   89,   92,   95,   98,  101,  104,  107,
-      110,  113,  116,  120,  123,  126,  128,  132,  135,  139,
-      142,  144,  147,  150,  153,  155,  158,  161,  164,  168,
-      173,  176,  180,  183,  187,  191,  193,  197,  200,  201,
-      204,  207,  210,  213,  217,  220,  224,  226,  228,  230,
-      232,  233,  234,  234,  235,  235,  236,  237,  239,  241,
-
-      242,  244,  245,  246,  246,  246,  247,  247,  249,  251,
-      253,  255,  259,  259,  261,  263,  265,  267,  269,  271,
-      273,  275,  277,  280,  282,  284,  286,  288,  290,  292,
-      294,  296,  298,  300,  302,  304,  306,  308,  310,  312,
-      314,  316,  318,  321,  323,  325,  327,  329,  331,  333,
-      335,  337,  340,  342,  344,  346,  349,  351,  353,  355,
-      357,  359,  362,  364,  366,  368,  371,  374,  376,  378,
-      380,  382,  384,  386,  389,  391,  394,  396,  398,  400,
-      402,  404,  406,  409,  411,  413,  415,  418,  421,  424,
-      426,  428,  430,  432,  434,  436,  438,  440,  442,  444,
-
-      446,  448,  450,  452,  454,  456,  458,  460,  462,  464,
-      466,  468,  470,  472,  474,  476,  478,  480,  482,  484,
-      486,  488,  490,  492,  494,  496,  498,  500,  501,  502,
-      504,  505,  505,  507,  508,  510,  512,  514,  515,  517,
-      518,  520,  521,  522,  523,  524,  524,  525,  525,  527,
-      528,  528,  529,  532,  534,  535,  537,  538,  539,  541,
-      542,  543,  543,  544,  546,  547,  548,  548,  549,  549,
-      550,  550,  550,  551,  552,  553,  554,  554,  555,  555,
-      555,  557,  558,  560,  562,  564,  566,  567,  568,  568,
-      570,  572,  574,  577,  577,  579,  581,  583,  585,  588,
-
-      590,  593,  595,  598,  600,  602,  604,  606,  608,  610,
-      612,  614,  616,  618,  620,  623,  625,  627,  629,  631,
-      633,  636,  638,  640,  642,  644,  647,  649,  652,  654,
-      656,  658,  660,  662,  664,  666,  668,  670,  672,  674,
-      677,  679,  681,  684,  687,  689,  692,  694,  696,  698,
-      701,  703,  705,  707,  709,  711,  713,  715,  717,  719,
-      721,  723,  725,  727,  729,  731,  733,  735,  737,  739,
-      741,  743,  745,  747,  750,  752,  755,  757,  759,  761,
-      763,  765,  767,  769,  771,  774,  776,  778,  780,  782,
-      784,  786,  788,  791,  794,  796,  798,  800,  802,  804,
-
-      806,  808,  810,  812,  814,  816,  818,  820,  822,  824,
-      826,  828,  831,  833,  835,  838,  840,  842,  844,  846,
-      849,  852,  854,  856,  858,  860,  863,  865,  867,  869,
-      872,  874,  877,  879,  881,  884,  886,  888,  891,  894,
-      896,  898,  900,  903,  905,  908,  910,  912,  915,  917,
-      918,  919,  920,  920,  921,  922,  923,  924,  925,  926,
-      926,  928,  929,  931,  932,  933,  935,  937,  939,  941,
-      943,  945,  948,  950,  952,  954,  956,  958,  960,  962,
-      964,  966,  968,  970,  970,  970,  972,  974,  976,  978,
-      980,  983,  986,  988,  990,  992,  994,  996,  999, 1002,
-
-     1005, 1007, 1009, 1011, 1013, 1016, 1018, 1020, 1022, 1024,
-     1027, 1029, 1031, 1033, 1035, 1037, 1039, 1042, 1045, 1048,
-     1051, 1053, 1055, 1058, 1060, 1063, 1065, 1067, 1069, 1071,
-     1073, 1075, 1078, 1081, 1083, 1085, 1087, 1089, 1091, 1093,
-     1095, 1097, 1099, 1101, 1103, 1105, 1107, 1110, 1112, 1115,
-     1117, 1119, 1119, 1121, 1124, 1127, 1129, 1132, 1134, 1136,
-     1139, 1141, 1143, 1146, 1148, 1151, 1153, 1155, 1157, 1159,
-     1161, 1163, 1165, 1167, 1169, 1171, 1173, 1175, 1177, 1179,
-     1181, 1183, 1186, 1189, 1191, 1194, 1197, 1200, 1202, 1204,
-     1206, 1208, 1210, 1213, 1215, 1217, 1220, 1222, 1224, 1226,
-
-     1228, 1231, 1234, 1236, 1238, 1240, 1243, 1246, 1248, 1250,
-     1252, 1254, 1256, 1258, 1261, 1262, 1264, 1266, 1268, 1268,
-     1270, 1272, 1274, 1277, 1280, 1282, 1284, 1286, 1288, 1290,
-     1292, 1294, 1296, 1298, 1300, 1302, 1304, 1306, 1309, 1309,
-     1309, 1312, 1312, 1312, 1312, 1314, 1316, 1319, 1322, 1324,
-     1326, 1329, 1331, 1333, 1335, 1337, 1340, 1342, 1345, 1345,
-     1346, 1348, 1351, 1353, 1355, 1357, 1357, 1359, 1361, 1363,
-     1365, 1367, 1369, 1371, 1374, 1377, 1379, 1381, 1383, 1386,
-     1388, 1390, 1392, 1394, 1397, 1400, 1402, 1404, 1406, 1408,
-     1410, 1412, 1415, 1417, 1419, 1421, 1423, 1425, 1427, 1429,
-
-     1432, 1434, 1436, 1436, 1438, 1440, 1442, 1444, 1446, 1448,
-     1450, 1453, 1455, 1457, 1459, 1461, 1464, 1466, 1469, 1471,
-     1473, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1490, 1493,
-     1495, 1497, 1499, 1502, 1505, 1507, 1510, 1513, 1516, 1518,
-     1520, 1520, 1521, 1523, 1525, 1527, 1529, 1531, 1533, 1535,
-     1537, 1539, 1542, 1545, 1547, 1549, 1551, 1553, 1556, 1558,
-     1561, 1563, 1565, 1567, 1567, 1570, 1573, 1575, 1577, 1579,
-     1581, 1583, 1585, 1587, 1589, 1591, 1594, 1596, 1598, 1600,
-     1602, 1604, 1606, 1606, 1606, 1606, 1606, 1608, 1610, 1613,
-     1616, 1618, 1620, 1622, 1624, 1627, 1629, 1631, 1634, 1636,
-
-     1639, 1639, 1639, 1639, 1642, 1644, 1646, 1648, 1649, 1651,
-     1653, 1656, 1659, 1661, 1664, 1666, 1668, 1670, 1672, 1674,
-     1676, 1678, 1680, 1682, 1685, 1687, 1689, 1691, 1693, 1696,
-     1698, 1701, 1704, 1706, 1708, 1708, 1710, 1713, 1715, 1717,
-     1719, 1721, 1723, 1725, 1727, 1729, 1731, 1733, 1736, 1738,
-     1740, 1742, 1744, 1746, 1748, 1750, 1752, 1754, 1756, 1759,
-     1762, 1764, 1766, 1766, 1767, 1769, 1771, 1773, 1775, 1778,
-     1778, 1778, 1778, 1780, 1782, 1784, 1787, 1790, 1793, 1796,
-     1798, 1800, 1802, 1804, 1806, 1808, 1811, 1813, 1815, 1818,
-     1820, 1820, 1823, 1825, 1827, 1830, 1833, 1836, 1836, 1836,
-
-     1836, 1836, 1836, 1838, 1840, 1842, 1844, 1846, 1848, 1850,
-     1853, 1853, 1853, 1854, 1854, 1854, 1855, 1855, 1855, 1855,
-     1856, 1856, 1858, 1860, 1863, 1864, 1866, 1869, 1871, 1873,
-     1876, 1878, 1880, 1880, 1881, 1884, 1886, 1888, 1891, 1893,
-     1895, 1898, 1900, 1903, 1905, 1907, 1910, 1913, 1915, 1917,
-     1919, 1921, 1923, 1925, 1927, 1929, 1932, 1935, 1937, 1937,
-     1939, 1942, 1944, 1947, 1950, 1952, 1955, 1957, 1959, 1962,
-     1964, 1966, 1968, 1970, 1972, 1974, 1976, 1978, 1981, 1983,
-     1986, 1989, 1991, 1994, 1994, 1994, 1994, 1996, 1998, 2000,
-     2000, 2002, 2004, 2006, 2009, 2011, 2013, 2015, 2017, 2019,
-
-     2021, 2023, 2026, 2026, 2028, 2030, 2030, 2030, 2030, 2030,
-     2030, 2030, 2033, 2036, 2038, 2040, 2042, 2044, 2046, 2046,
-     2046, 2046, 2046, 2048, 2050, 2050, 2053, 2055, 2057, 2060,
-     2061, 2064, 2066, 2068, 2071, 2074, 2076, 2079, 2080, 2080,
-     2083, 2085, 2087, 2090, 2092, 2095, 2098, 2099, 2102, 2102,
-     2105, 2108, 2110, 2112, 2114, 2117, 2120, 2122, 2125, 2127,
-     2130, 2133, 2135, 2137, 2139, 2142, 2142, 2143, 2145, 2147,
-     2150, 2152, 2152, 2154, 2156, 2158, 2158, 2160, 2161, 2163,
-     2165, 2168, 2171, 2173, 2175, 2178, 2180, 2180, 2182, 2184,
-     2184, 2184, 2184, 2184, 2184, 2184, 2184, 2186, 2189, 2191,
-
-     2193, 2195, 2195, 2195, 2195, 2197, 2198, 2200, 2202, 2204,
-     2206, 2208, 2208, 2208, 2208, 2210, 2212, 2214, 2215, 2216,
-     2217, 2219, 2221, 2223, 2226, 2229, 2229, 2231, 2233, 2233,
-     2233, 2233, 2235, 2238, 2238, 2240, 2242, 2245, 2245, 2247,
-     2248, 2249, 2252, 2255, 2257, 2259, 2262, 2265, 2265, 2267,
-     2269, 2269, 2269, 2270, 2271, 2272, 2272, 2272, 2272, 2274,
-     2276, 2279, 2282, 2282, 2284, 2285, 2288, 2290, 2292, 2295,
-     2297, 2297, 2298, 2298, 2298, 2298, 2299, 2299, 2301, 2304,
-     2307, 2309, 2312, 2315, 2317, 2317, 2317, 2320, 2322, 2322,
-     2324, 2324, 2327, 2329, 2329, 2331, 2333, 2335, 2338, 2338,
-
-     2340, 2342, 2342, 2342, 2342, 2342, 2342, 2342, 2344, 2346,
-     2349, 2351, 2353, 2355, 2355, 2356, 2356, 2356, 2356, 2356,
-     2356, 2359, 2361, 2361, 2363, 2363, 2365, 2365, 2367, 2367,
-     2369, 2372, 2372, 2373, 2375, 2377, 2378, 2378, 2378, 2378,
-     2378, 2379, 2382, 2384, 2387, 2389, 2391, 2391, 2391, 2391,
-     2391, 2393, 2394, 2397, 2397, 2399, 2399, 2401, 2401, 2401,
-     2403, 2406, 2406, 2406, 2406, 2407, 2410, 2413, 2415, 2415,
-     2417, 2417, 2419, 2419, 2419, 2421, 2421, 2421, 2422, 2423,
-     2426, 2429, 2429, 2431, 2433, 2434, 2434, 2434, 2434, 2436,
-     2437, 2439, 2441, 2443, 2445, 2447, 2450, 2450
-
+      110,  113,  116,  119,  123,  126,  129,  131,  135,  138,
+      142,  145,  147,  150,  153,  156,  158,  161,  164,  167,
+      171,  176,  179,  183,  186,  190,  194,  196,  200,  203,
+      204,  207,  210,  213,  216,  220,  223,  227,  229,  231,
+      233,  235,  236,  237,  237,  238,  238,  239,  240,  242,
+
+      244,  245,  247,  248,  249,  249,  249,  250,  250,  252,
+      254,  256,  258,  262,  262,  264,  266,  268,  270,  272,
+      274,  276,  278,  280,  283,  285,  287,  289,  291,  293,
+      295,  297,  299,  301,  303,  305,  307,  309,  311,  313,
+      315,  317,  319,  321,  323,  325,  328,  330,  332,  334,
+      336,  338,  340,  342,  344,  347,  349,  351,  353,  356,
+      358,  360,  362,  364,  366,  369,  371,  373,  375,  378,
+      381,  383,  385,  387,  389,  391,  393,  396,  398,  401,
+      403,  405,  407,  409,  411,  414,  416,  419,  421,  423,
+      425,  428,  430,  433,  436,  438,  440,  442,  444,  446,
+
+      448,  450,  452,  454,  456,  458,  460,  462,  464,  466,
+      468,  470,  472,  474,  476,  478,  480,  482,  484,  486,
+      488,  490,  492,  494,  496,  498,  500,  502,  504,  506,
+      508,  510,  512,  514,  516,  517,  518,  520,  521,  521,
+      523,  524,  526,  528,  530,  531,  533,  534,  536,  537,
+      538,  539,  540,  540,  541,  541,  543,  544,  544,  545,
+      548,  550,  551,  553,  554,  555,  557,  558,  559,  559,
+      560,  562,  563,  564,  564,  565,  565,  566,  566,  566,
+      567,  568,  569,  570,  570,  571,  571,  571,  573,  574,
+      576,  578,  580,  582,  584,  585,  586,  587,  587,  589,
+
+      591,  593,  595,  597,  600,  600,  602,  604,  606,  608,
+      611,  613,  616,  618,  621,  623,  626,  628,  630,  632,
+      634,  636,  638,  640,  642,  644,  646,  648,  650,  653,
+      655,  657,  659,  661,  663,  666,  668,  670,  672,  674,
+      677,  679,  682,  684,  686,  688,  690,  692,  694,  696,
+      698,  700,  702,  704,  706,  708,  711,  713,  715,  718,
+      721,  723,  726,  728,  730,  732,  735,  737,  739,  741,
+      743,  745,  747,  749,  751,  753,  755,  757,  759,  761,
+      763,  765,  767,  769,  771,  773,  775,  777,  779,  781,
+      784,  786,  789,  791,  793,  795,  797,  799,  801,  803,
+
+      805,  807,  809,  812,  814,  816,  818,  820,  822,  824,
+      826,  828,  830,  833,  836,  838,  840,  842,  844,  846,
+      848,  850,  852,  854,  856,  858,  860,  862,  864,  866,
+      868,  870,  872,  874,  876,  879,  881,  883,  886,  888,
+      890,  892,  894,  897,  900,  902,  904,  906,  908,  911,
+      913,  915,  917,  920,  922,  925,  927,  929,  932,  934,
+      936,  939,  942,  944,  946,  948,  951,  953,  956,  958,
+      960,  963,  965,  967,  968,  969,  970,  970,  971,  972,
+      973,  974,  975,  976,  976,  978,  979,  981,  982,  983,
+      985,  987,  989,  991,  993,  995,  997, 1000, 1002, 1004,
+
+     1006, 1008, 1010, 1012, 1014, 1016, 1018, 1020, 1022, 1024,
+     1026, 1026, 1026, 1028, 1030, 1032, 1034, 1036, 1039, 1042,
+     1044, 1046, 1048, 1050, 1052, 1055, 1058, 1061, 1063, 1065,
+     1067, 1069, 1072, 1074, 1076, 1078, 1080, 1082, 1085, 1087,
+     1089, 1091, 1093, 1095, 1097, 1099, 1102, 1105, 1108, 1111,
+     1113, 1115, 1118, 1120, 1123, 1125, 1127, 1129, 1131, 1133,
+     1135, 1138, 1141, 1143, 1145, 1147, 1149, 1151, 1153, 1155,
+     1157, 1159, 1161, 1163, 1165, 1167, 1169, 1172, 1174, 1176,
+     1179, 1181, 1183, 1183, 1185, 1188, 1190, 1193, 1196, 1198,
+     1201, 1203, 1205, 1208, 1210, 1212, 1214, 1217, 1219, 1222,
+
+     1224, 1226, 1228, 1230, 1232, 1234, 1236, 1238, 1240, 1242,
+     1244, 1246, 1248, 1250, 1252, 1254, 1256, 1258, 1260, 1263,
+     1265, 1268, 1270, 1272, 1275, 1277, 1280, 1283, 1285, 1287,
+     1289, 1291, 1293, 1296, 1298, 1300, 1303, 1305, 1307, 1309,
+     1311, 1314, 1317, 1319, 1319, 1321, 1323, 1325, 1328, 1331,
+     1333, 1335, 1337, 1339, 1341, 1343, 1346, 1348, 1349, 1351,
+     1353, 1355, 1355, 1357, 1359, 1361, 1364, 1367, 1369, 1371,
+     1373, 1375, 1377, 1379, 1381, 1383, 1385, 1387, 1389, 1391,
+     1393, 1395, 1397, 1399, 1402, 1402, 1402, 1405, 1405, 1405,
+     1405, 1405, 1407, 1409, 1412, 1415, 1417, 1419, 1422, 1424,
+
+     1426, 1428, 1430, 1433, 1435, 1438, 1438, 1439, 1441, 1444,
+     1446, 1448, 1450, 1453, 1455, 1455, 1457, 1459, 1461, 1463,
+     1465, 1467, 1469, 1472, 1475, 1477, 1479, 1481, 1484, 1486,
+     1488, 1490, 1492, 1495, 1498, 1500, 1502, 1504, 1506, 1508,
+     1510, 1513, 1515, 1517, 1519, 1521, 1523, 1525, 1527, 1529,
+     1532, 1534, 1536, 1538, 1538, 1540, 1542, 1544, 1546, 1548,
+     1550, 1552, 1554, 1557, 1559, 1561, 1563, 1565, 1567, 1569,
+     1572, 1574, 1577, 1579, 1581, 1583, 1585, 1587, 1589, 1591,
+     1593, 1595, 1597, 1599, 1601, 1604, 1607, 1609, 1611, 1613,
+     1615, 1617, 1620, 1623, 1626, 1628, 1631, 1634, 1637, 1639,
+
+     1641, 1641, 1642, 1644, 1646, 1648, 1650, 1652, 1654, 1656,
+     1658, 1660, 1663, 1663, 1665, 1668, 1670, 1672, 1674, 1676,
+     1679, 1681, 1684, 1686, 1688, 1690, 1693, 1693, 1696, 1699,
+     1701, 1703, 1705, 1707, 1709, 1711, 1714, 1716, 1718, 1720,
+     1722, 1725, 1727, 1729, 1731, 1733, 1735, 1737, 1739, 1739,
+     1739, 1739, 1739, 1739, 1739, 1739, 1741, 1743, 1746, 1749,
+     1751, 1753, 1755, 1757, 1760, 1762, 1764, 1767, 1769, 1772,
+     1772, 1774, 1774, 1774, 1774, 1777, 1779, 1781, 1783, 1784,
+     1786, 1788, 1791, 1794, 1796, 1799, 1801, 1803, 1805, 1807,
+     1809, 1811, 1813, 1815, 1817, 1820, 1822, 1824, 1826, 1828,
+
+     1831, 1833, 1835, 1838, 1841, 1844, 1846, 1848, 1848, 1850,
+     1853, 1856, 1858, 1860, 1862, 1864, 1866, 1868, 1870, 1872,
+     1874, 1876, 1878, 1880, 1883, 1885, 1887, 1889, 1891, 1893,
+     1895, 1897, 1899, 1901, 1903, 1905, 1907, 1909, 1912, 1915,
+     1917, 1920, 1922, 1924, 1924, 1925, 1927, 1929, 1931, 1933,
+     1936, 1936, 1936, 1936, 1938, 1940, 1942, 1945, 1948, 1951,
+     1954, 1956, 1958, 1958, 1960, 1962, 1964, 1966, 1968, 1971,
+     1973, 1975, 1978, 1980, 1980, 1983, 1985, 1987, 1990, 1993,
+     1996, 1999, 1999, 1999, 1999, 1999, 1999, 2001, 2003, 2005,
+     2007, 2009, 2011, 2013, 2015, 2018, 2018, 2018, 2018, 2018,
+
+     2019, 2019, 2019, 2020, 2020, 2020, 2021, 2021, 2021, 2021,
+     2022, 2022, 2024, 2026, 2029, 2030, 2032, 2035, 2037, 2039,
+     2042, 2044, 2046, 2046, 2048, 2048, 2049, 2052, 2054, 2056,
+     2059, 2061, 2063, 2066, 2068, 2071, 2073, 2075, 2078, 2081,
+     2083, 2085, 2087, 2089, 2091, 2093, 2095, 2097, 2099, 2102,
+     2105, 2107, 2107, 2109, 2112, 2114, 2117, 2120, 2122, 2125,
+     2127, 2129, 2131, 2133, 2136, 2138, 2140, 2142, 2144, 2147,
+     2149, 2151, 2153, 2155, 2158, 2160, 2162, 2164, 2167, 2170,
+     2173, 2175, 2178, 2178, 2178, 2178, 2180, 2182, 2184, 2184,
+     2186, 2188, 2190, 2193, 2195, 2195, 2198, 2200, 2202, 2204,
+
+     2206, 2208, 2210, 2213, 2213, 2215, 2217, 2217, 2217, 2217,
+     2217, 2217, 2217, 2220, 2223, 2225, 2227, 2229, 2231, 2233,
+     2233, 2235, 2237, 2237, 2237, 2237, 2238, 2238, 2238, 2238,
+     2238, 2240, 2242, 2242, 2245, 2247, 2249, 2252, 2252, 2254,
+     2255, 2258, 2260, 2262, 2265, 2268, 2270, 2273, 2274, 2274,
+     2277, 2279, 2281, 2284, 2286, 2289, 2292, 2293, 2295, 2298,
+     2298, 2301, 2304, 2306, 2308, 2311, 2313, 2315, 2317, 2320,
+     2323, 2325, 2328, 2330, 2333, 2336, 2338, 2340, 2342, 2342,
+     2344, 2347, 2349, 2349, 2350, 2352, 2354, 2357, 2359, 2359,
+     2361, 2363, 2365, 2365, 2367, 2368, 2370, 2372, 2373, 2376,
+
+     2379, 2381, 2383, 2386, 2388, 2388, 2390, 2392, 2392, 2392,
+     2392, 2392, 2392, 2392, 2392, 2394, 2397, 2399, 2401, 2403,
+     2403, 2405, 2407, 2407, 2407, 2407, 2407, 2407, 2409, 2410,
+     2412, 2414, 2414, 2416, 2418, 2420, 2423, 2423, 2423, 2423,
+     2425, 2427, 2429, 2430, 2431, 2433, 2434, 2436, 2438, 2440,
+     2442, 2442, 2442, 2445, 2448, 2448, 2450, 2452, 2452, 2454,
+     2454, 2456, 2456, 2456, 2456, 2458, 2461, 2461, 2463, 2465,
+     2468, 2468, 2470, 2471, 2472, 2475, 2478, 2480, 2482, 2485,
+     2488, 2488, 2490, 2492, 2492, 2492, 2493, 2494, 2495, 2495,
+     2495, 2495, 2497, 2499, 2502, 2504, 2504, 2507, 2509, 2509,
+
+     2509, 2511, 2512, 2515, 2517, 2517, 2517, 2519, 2521, 2524,
+     2526, 2526, 2527, 2527, 2527, 2527, 2528, 2528, 2530, 2533,
+     2536, 2538, 2540, 2543, 2546, 2549, 2551, 2551, 2551, 2551,
+     2551, 2551, 2551, 2554, 2556, 2556, 2558, 2558, 2560, 2560,
+     2562, 2562, 2565, 2567, 2567, 2569, 2571, 2573, 2576, 2576,
+     2578, 2580, 2580, 2580, 2580, 2580, 2580, 2580, 2582, 2584,
+     2587, 2587, 2590, 2590, 2593, 2595, 2595, 2597, 2599, 2601,
+     2601, 2602, 2602, 2602, 2602, 2602, 2602, 2605, 2608, 2610,
+     2610, 2610, 2610, 2610, 2612, 2612, 2615, 2615, 2617, 2617,
+     2619, 2619, 2621, 2621, 2623, 2626, 2626, 2627, 2629, 2631,
+
+     2632, 2632, 2632, 2632, 2632, 2633, 2636, 2638, 2639, 2639,
+     2642, 2642, 2644, 2646, 2648, 2648, 2648, 2648, 2648, 2651,
+     2653, 2653, 2653, 2654, 2654, 2655, 2658, 2659, 2659, 2662,
+     2662, 2664, 2664, 2666, 2666, 2666, 2668, 2671, 2671, 2671,
+     2671, 2672, 2675, 2675, 2675, 2678, 2681, 2683, 2683, 2685,
+     2685, 2686, 2686, 2687, 2687, 2688, 2688, 2690, 2690, 2690,
+     2692, 2692, 2692, 2693, 2694, 2695, 2698, 2701, 2701, 2701,
+     2703, 2705, 2706, 2706, 2706, 2706, 2706, 2708, 2709, 2711,
+     2713, 2715, 2717, 2719, 2722, 2722
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -808,15 +859,15 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    5,    6,    7,    8,    9,   10,    9,   11,   12,
        13,   14,    9,   15,   16,   17,   18,   19,   20,   21,
-       22,   19,   23,   19,   19,   19,   19,   24,   25,   26,
-       27,   28,   29,   30,   31,   32,   33,   34,   35,   36,
+       22,   23,   24,   25,   19,   19,   19,   26,   27,   28,
+       29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
+       39,   40,   41,   42,   43,   44,   45,   46,   47,   48,
+       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
+        9,   59,    9,    9,    9,    9,   33,   34,   35,   36,
+
        37,   38,   39,   40,   41,   42,   43,   44,   45,   46,
        47,   48,   49,   50,   51,   52,   53,   54,   55,   56,
-        9,   57,    9,    9,    9,    9,   58,   59,   60,   61,
-
-       62,   63,   64,   65,   66,   67,   68,   69,   70,   71,
-       72,   73,   74,   75,   76,   77,   78,   79,   80,   81,
-       82,   83,    1,    9,   84,    9,    9,    9,    9,    9,
+       57,   58,    1,    9,   60,    9,    9,    9,    9,    9,
         9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
         9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
         9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
@@ -833,1093 +884,885 @@ static yyconst flex_int32_t yy_ec[256] =
         9,    9,    9,    9,    9
     } ;
 
-static yyconst flex_int32_t yy_meta[85] =
+static yyconst flex_int32_t yy_meta[61] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    7,    8,    1,
-        9,    1,    1,   10,   11,   10,    8,   12,   10,   10,
-       10,   10,   10,   13,    1,    8,    8,    8,   14,   15,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
-        8,    8,    8,   16
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[1402] =
+static yyconst flex_int16_t yy_base[1486] =
     {   0,
-        0,    0,   83,   93,  104,  188,  272,  356,  118,  135,
-      440,  524,  147,  203,  169,  225,  533, 6742,  229, 6742,
-      505,   84,  608,   82, 6742,  107,  114,  685,  115,  218,
-      116,  735,  804,  856,  908,  960, 1012, 1064,  249, 1116,
-      188,  343, 1168, 1220,  274,  341, 1272,  423, 1324, 1376,
-     1427,  352,  179,    0,  158, 6742,  173, 6742,  248,  424,
-      464,    0,  491,  179, 6742,    0,    0,    0,  325,  538,
-      473,  286,  256,  265,  308,  440,  483,    0, 6742,    0,
-        0,    0, 6742,  260,  555,  489,    0,   87,  296,  337,
-      577, 6742,  475, 6742,  154,   98, 6742, 1504, 1588, 1672,
-
-     1756,  185,  450,    0,  437, 6742,  124,  187,  403,  275,
-      564, 1833,  395, 1883,  276,  335, 1933,  345,  503,  566,
-      425,  338,   53,  264,  161,  170,  275,  591,  600,  596,
-      578,  609,  337,  705,  730,  602,  611,  358,  442,  598,
-      620,  440,  639,  648,  790,  804,  673,  516,  650,  738,
-      725,  190,  789,  671,  838,  270,  680,  798,  334,  747,
-      764,  340,  794,  847,  956,  423,  470,  822,  843,  858,
-      873,  473,  896,  511,  901,  547,  708,  960,  859,  892,
-      907,  949,  557,  604,  969,  898,  668, 1002,  728,  998,
-     1006, 1009, 1016, 1051,  829, 1057, 1048, 1014, 1980, 1056,
-
-     1112, 1086, 1132, 1063,  739, 1123, 1166, 1162, 1224, 1164,
-     1055,  842, 1151, 1218,  915, 1108, 1211,  769, 1160, 1171,
-     1114, 1219,  906, 1222, 1275, 1266,  944,    0,  594,  599,
-      730,  353,    0, 6742, 1520, 1534, 1538, 1552, 1571, 1408,
-     1356, 1383,    0, 1602,  680,  346,    0,  304, 1422,  262,
-        0,    0, 1460, 1324,  734, 1413, 1425,    0, 1617, 1620,
-        0,  251, 1549, 1488, 1627,    0,  250,    0,  245, 1116,
-     1684, 1711, 1460,    0,  247, 1317,  230,  840,  210,  327,
-     6742,  319, 2057, 2141, 2225, 2309,  186,    0,  176, 6742,
-      167,  156, 1633,  167, 2386, 2445,  948, 1225, 1005, 1316,
-
-     1017, 1330, 1068, 1633, 1422, 1260, 1324, 1563, 1591, 1585,
-     1666, 1264, 1673, 1674, 1731, 1426, 1512, 1722, 1594, 1662,
-     1533, 1741, 1744, 1676, 1745, 1735, 1736, 1218, 1308, 1739,
-     1746, 1759, 1752, 1798, 1789, 1760, 1800, 1829, 1819, 1419,
-     1833, 1845, 1554, 1592, 1848, 1617, 1869, 1857, 1868, 1664,
-     1795, 1671, 1879, 1880, 1900, 1919, 1922, 1923, 1924, 1939,
-     1928, 1958, 1934, 1940, 1972, 1973, 2025, 1991, 2038, 2035,
-     2027, 1971, 1933, 1740, 2045, 2046, 2036, 2041, 1980, 1883,
-     2048, 2042, 2086, 2101, 2122, 2087, 2085, 2083, 2126, 2132,
-     2139, 2130, 2133, 1750, 2049, 2125, 2145, 2196, 2144, 2138,
-
-     2200, 2194, 2146, 2204, 2176, 2205, 2209, 2141, 2214, 2219,
-     2229, 2142, 2248, 2228, 2199, 2230, 2250, 2280, 2269, 2260,
-     2299, 2288, 2294, 2297, 2298, 2284, 2295, 2306, 2312, 2313,
-     2336, 2348, 2370, 2349, 2302, 2351, 2373, 2304, 2323, 2383,
-     2372, 2390, 2358, 2393, 2374, 2407, 2429, 2391, 2422, 6742,
-     6742, 6742,  126, 2477, 2481, 6742, 2488, 6742, 6742, 2511,
-        0, 6742,    0, 6742, 6742, 2469, 2460, 2488, 2471, 2491,
-     2489, 2392, 2497, 2505, 2506, 2509, 2527, 2511, 2529, 2514,
-     2543, 2544, 2540, 2556, 2582, 2545, 2548, 2549, 2563, 2564,
-     2428, 2553, 2565, 2574, 2593, 2598, 2603, 2579, 2584, 2596,
-
-     2605, 2613, 2600, 2597, 2679, 2615, 2637, 2645, 2641, 2619,
-     2667, 2665, 2663, 2669, 2651, 2659, 2681, 2660, 2676, 2658,
-     2697, 2673, 2693, 2699, 2695, 2714, 2727, 2711, 2730, 2723,
-     2742, 2712, 2717, 2736, 2752, 2756, 2765, 2748, 2745, 2764,
-     2767, 2776, 2753, 2777, 2771, 2790, 2755, 2795, 2784, 2809,
-     2799, 2828, 2802, 2797, 2806, 2834, 2810, 2827, 2843, 2840,
-     2820, 2844, 2850, 2863, 2838, 2849, 2856, 2869, 2868, 2891,
-     2875, 2884, 2893, 2874, 2900, 2894, 2903, 2898, 2907, 2926,
-     2917, 2909, 2910, 2940, 2928, 2938, 2929, 2946, 2942, 2974,
-     2941, 2975, 3025, 2971, 2976, 2959, 2964, 2993, 3000, 2994,
-
-     2983, 2992, 3011, 3024, 3015, 2999, 3016, 3032, 3018, 3046,
-     3034, 3048, 3047, 3065, 6742,    0,    0,    0, 3113, 3076,
-     3090, 3093, 3031, 3095, 3091, 3106, 3112, 3113, 3109, 3101,
-     3107, 3116, 3129, 3130, 3114, 3160, 3148, 3115, 3125, 3190,
-     6742, 3142, 3149, 3168, 3169, 3165, 3154, 3162, 3174, 3173,
-     3180, 3198, 3205, 3208, 3215, 3182, 3186, 3183, 1878, 6742,
-     3204, 3214, 3217, 3236, 3237,  768, 3239, 3238, 3252, 3234,
-     3299, 3260, 3268, 3216, 3249, 3270, 3271, 3273, 3280, 3292,
-     3291, 3275, 3283, 3262, 3277, 3301, 3312, 3316, 3352, 3327,
-     3329, 3331, 3293, 3330, 3351, 3335, 3355, 3359, 3345, 3325,
-
-     3348, 3370, 3349, 3365, 3390, 3377, 3387, 3385, 3393, 3398,
-     3383, 3400, 3402, 3418, 3413, 3422, 3430, 3401, 3455, 3419,
-     3448, 3439, 3447, 3470, 3450, 3444, 3453, 3454, 3455, 3473,
-     3461, 3465, 3456, 3469, 3485, 3472, 3476, 3548, 3501, 3508,
-     3561, 6742, 3565, 3484, 3525, 3539, 3541, 3529, 3531, 3544,
-     3561, 3543, 3523, 3582, 3579, 3563, 3587, 3562, 3595, 3580,
-     3592, 3597, 3596, 3661, 3584, 3585, 3630, 3638, 3640, 3616,
-     3646, 3651, 3691, 3639, 3660, 3641, 3655, 3672, 3663, 3684,
-     3683, 3691, 3661, 3697, 3740, 3738, 3707, 3715, 3649, 3694,
-     3722, 3774, 3739, 3741, 3709, 3730, 3750, 3761, 3763, 3735,
-
-      516, 3789, 3816, 3778, 3780, 3781, 3758,  550, 3793, 3794,
-     3769, 3783, 3800, 3791, 3812, 3813, 3804, 3815, 3830, 3836,
-     3834, 3859, 3832, 3833, 3847, 3848, 3835, 3855, 3838, 3867,
-     3868, 3849, 3871, 3877, 3871, 3901, 3866, 3892, 3886, 3902,
-     3888, 3907, 3910, 3914, 3912, 3925, 3926, 3903, 3958, 3938,
-     3921, 3944, 3946, 3973, 3966, 3949, 3977, 3961, 3967, 3943,
-     3969, 3982, 4044, 6742, 4051, 3992, 3964, 4021, 3986, 1750,
-     3987, 1931, 4025, 4016, 4011, 4017, 4026, 4027, 4028, 4029,
-     4047, 4034, 4050, 4051, 4060, 4040, 4046, 4070, 4066, 4079,
-     4128, 4071, 4086, 4122, 4083, 4088, 4090, 4118, 4120, 4115,
-
-     4114, 4109, 4124, 4122, 4126, 4121, 4142, 4130, 4137, 4131,
-     4144,  258, 6742, 4202,  419, 6742, 4134,  509,  721, 6742,
-     4133, 4176, 4174, 4144, 4216, 4218, 4166, 4178, 4181, 4228,
-     4194, 4189,    0, 4229, 4179, 4212, 4215, 4198, 4214, 4230,
-     4202, 4232, 4210, 4234, 4233, 4286, 4222, 4251, 4266, 4252,
-     4269, 4271, 4275, 4276, 4288, 4267, 4268, 4270, 4273, 4307,
-     4277, 4305, 4282, 4284, 4317, 4287, 4322, 4324, 4319, 4316,
-     4354, 4331, 4325, 4326, 4327, 4360, 4345, 4356, 4368, 4407,
-     4360, 4362, 4369, 1824, 4370, 2030, 4376, 4388, 4379, 4377,
-     4402, 4404, 4422, 4390, 4399, 4410, 4416, 4427, 4428, 4446,
-
-     4423, 4392, 4508, 4442, 4476, 4420, 4439, 4473, 4443, 4462,
-     4462, 4468, 4470, 4493, 4485, 4477, 4498, 4503, 4504, 4505,
-     1419, 1539, 4544, 4513, 4506, 4506, 4507, 4521, 4515,    0,
-     4522, 4532, 4541, 4524, 4531, 4552, 4535,  426, 1430, 4538,
-     4574, 4563, 4545, 4546, 4554, 4557,  123, 4560, 4554, 4564,
-     4567, 4578, 4583, 4611, 4576, 4585, 4613, 4586, 4606, 4589,
-     4598, 1496, 4608, 4623, 4600, 4675, 6742, 4661, 4601, 4611,
-     4637, 4624, 4649, 4653, 4652, 4655, 4645,  106, 4670, 4657,
-     4658, 4662, 4674, 4660, 4663, 4675, 4739, 4709, 4709, 4690,
-     4711, 4702, 4716, 4713, 4731, 4715, 4723, 4722, 4739, 4729,
-
-     4728, 4776, 4737,  539, 4741,  789, 4761, 4765, 4746, 4757,
-     4769, 1813, 4820, 4813, 4817, 4760, 4797,    0,   95, 6742,
-     4771, 4774, 4807,  896, 4782,  875, 4791, 4807, 4857, 4803,
-     4869, 4819, 4805, 4823, 4836, 4817, 4821, 4822, 4850,    0,
-       75, 4837, 4840, 4841, 4845, 4851, 4852, 4919, 4869, 4902,
-     4868, 4869, 6742, 4854, 6742, 4874, 4862, 4883, 4907, 4908,
-     4895, 4900, 1657, 4901, 1417, 4903, 4918, 4911, 4909, 4919,
-     4955, 6742, 4956, 4958, 4959, 6742, 4982, 4973, 4914, 4917,
-        0, 4940, 4943, 4989, 1525, 5002, 4952, 4962, 4963, 4972,
-     4963, 4964, 4982, 4983, 4974,    0, 4997, 4968, 5049, 4986,
-
-     5016, 5007, 5005, 5004, 5013, 5032, 5021, 5018, 5023, 5022,
-     5025, 5035, 5032, 5071, 6742, 5072, 1819, 5034, 1873, 5037,
-     1038, 5079,    0, 5056, 5051, 5051, 5072, 5069, 5070, 5120,
-     5068, 5144, 6742, 5084, 5120, 6742, 5084, 5086, 5087, 5109,
-     6742, 5105, 5119, 5109, 5110, 5125, 1917, 5121, 2124, 2125,
-     5153,    0, 5118, 5123, 5141, 5131, 5200, 5204, 5210, 5180,
-     1138, 5128, 5147, 1617, 1689, 5170, 5172, 5175, 2198, 5204,
-     5191, 5187, 5234, 5249, 5222, 5178, 5205, 6742, 6742, 5194,
-     1427, 5201, 5261, 5225, 6742, 5229, 5275, 5285, 5245, 6742,
-     5250, 5246, 5235, 5258, 5263, 5247, 6742, 5338, 5354, 5370,
-
-     5386, 5402, 5418, 5434, 5450, 5466, 5476, 5491, 5501, 5510,
-     5525, 5541, 5557, 5567, 5575, 5583, 5591, 5605, 5621, 5637,
-     5653, 5669, 5685, 5701, 5711, 5719, 5727, 5741, 5757, 5773,
-     5789, 5805, 5821, 5837, 5853, 5869, 5879, 5888, 5897, 5911,
-     5927, 5937, 5946, 5955, 5964, 5973, 5988, 6004, 6020, 6036,
-     6046, 6055, 6063, 6071, 6085, 6101, 6117, 6133, 6149, 6165,
-     6181, 6197, 6213, 6229, 6245, 6261, 6277, 6293, 6304, 6312,
-     6320, 6334, 6350, 6366, 6382, 6398, 6414, 6430, 6446, 6462,
-     6472, 6481, 6495, 6505, 6514, 6523, 6538, 6554, 6570, 6586,
-     6602, 6618, 6634, 6649, 6657, 6666, 6680, 6695, 6709, 6722,
-
-     6727
+        0,    0,   60,    0,  119,    0,  177,    0,  236,    0,
+      295,    0,  354,    0,  414,    0, 4752, 4752,  473, 4752,
+      116,  500,  560,  613, 4752,  672,  725,  777,    0,  122,
+        0,  820,  829,  840,  848,  863,  877,  892,  899,  922,
+      858,  442,  444,  929,  447,  893,  828,  945,  947,  968,
+      970,  449,  127,  184, 1018,  303, 4752,  493, 4752, 1078,
+     1138, 1197, 1197, 1255,  621, 4752, 1255, 1307, 1359, 1418,
+      733, 1478,  785,  855, 1538, 1598, 1658, 1718, 1778, 4752,
+     1831, 1883, 1935, 4752,  967, 1993, 1980, 2018,  897, 2078,
+     2138,    0, 4752,  185, 4752, 2198, 2251, 4752,    0, 2303,
+
+     2355,    0,    0, 2407, 2459,  191, 4752, 2518,    0, 2571,
+     2612, 2663,    0,  283,    0,    0, 2704,  258,  285,  869,
+      286,  294,  320,    0,  884,  366,  435,  440,  574,  578,
+      867, 2697,  895,  586,  801,  605,  953,  945,  685,  689,
+      714,  704,  717,  737,  759,  751,  772, 2694,  918, 2689,
+      797,  816,  834,  835,    0,  899,  841,  917,    0,  863,
+     1266,  870,  891,  939,    0,  939,  961, 2705,    0,    0,
+      960,  963,  980,  966,  971, 1190,    0, 2695,    0, 1179,
+     2704, 1274, 1157, 1171,    0, 1157, 1206, 1210, 1339, 1217,
+        0, 1230, 1237,    0, 1250, 1282, 1324, 1271, 1303, 1793,
+
+     1329, 1449, 1335, 1353, 2715, 1366, 2722, 1448, 2722, 1435,
+     1431, 1471, 1562, 1749, 1976, 1476, 1490, 1492, 1495, 1689,
+     1556, 1552, 1578, 1611, 1642, 1673, 1687, 1801, 1729, 1739,
+     2738, 1955, 1734, 1764,    0,    0,    0,    0, 2777,    0,
+     4752,    0,    0,    0,    0,    0, 2836, 2840,    0,    0,
+        0,    0, 1802,    0, 1846,    0,    0, 2867,    0,    0,
+        0,    0,    0, 2927, 2987,    0, 3047, 3107, 3149, 1826,
+        0, 3176, 3236, 1856,    0, 1882,    0,    0, 1943,    0,
+        0,    0, 1887, 3296, 1884, 3356,    0, 4752,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0, 4752,    0,
+
+        0,    0,    0,    0, 1878, 1857, 1859, 1860, 1868,    0,
+     1911,    0, 1900,    0, 1924,    0, 1925, 1915, 1973, 1976,
+     1988, 2037, 2037, 2052, 2104, 2091, 2283, 2103, 3412, 2165,
+     2213, 2218, 2218, 2231, 2215, 2244, 2245, 2276, 2281, 2271,
+     2265,    0, 2283, 2328, 2332, 2334, 2372, 2333, 2319, 2344,
+     2341, 2343, 2380, 2368, 2369,    0, 2388, 2390,    0,    0,
+     2406,    0, 2434, 2437, 2418,    0, 2420, 2424, 2437, 2438,
+     2450, 2474, 2533, 2538, 2531, 2548, 2534, 2564, 2550, 2556,
+     2591, 2589, 2593, 2606, 2651, 2599, 2591, 2638, 2636,    0,
+     2642, 2643, 2625, 2688, 2692, 2712, 2725, 2716, 2732, 2724,
+
+     2732, 2740, 2856, 2760, 2747, 2782, 2793, 2795, 2807, 2812,
+     2819, 2807, 3380,    0, 2805, 2806, 2823, 2809, 3380, 2821,
+     2813, 2830, 2825, 2849, 2889, 2890, 2888, 2937, 3003, 2941,
+     2946, 3065, 3016, 3027,    0, 3090, 3092,    0, 3138, 3128,
+     3131, 3149,    0, 3387, 3189, 3192, 3202, 3263,    0, 3251,
+     3377, 3261, 3250, 3312, 3313, 3323, 3417,    0, 3328, 3386,
+        0,    0, 3369, 3379, 3386,    0, 3389, 3380, 3385, 3381,
+        0, 3394, 3411, 4752, 4752, 4752, 3405, 3406, 3407, 4752,
+     3408, 4752, 4752, 3428,    0, 4752,    0, 4752, 4752, 3407,
+     3408, 3394, 3400, 3416, 3424, 3422,    0, 3414, 3407, 3423,
+
+     3420, 3428, 3433, 3422, 3421, 3433, 3420, 3437, 3438, 3424,
+     3472, 3473, 3428, 3443, 3429, 3445, 3436,    0,    0, 3432,
+     3430, 3442, 3455, 3449,    0,    0,    0, 3447, 3448, 3441,
+     3437, 3493, 3444, 3464, 3457, 3465, 3452,    0, 3452, 3479,
+     3473, 3473, 3471, 3457, 3462, 3471, 3461, 3477,    0, 3471,
+     3466,    0, 3465,    0, 3482, 3487, 3477, 3489, 3489, 3508,
+        0,    0, 3494, 3490, 3491, 3517, 3501, 3495, 3489, 3503,
+     3505, 3489, 3507, 3500, 3490, 3502,    0, 3500, 3494,    0,
+     3510, 3492, 3544, 3501,    0, 3500,    0,    0, 3515,    0,
+     3512, 3517, 3514, 3513, 3517, 3526, 3514, 3523,    0, 3511,
+
+     3513, 3517, 3512, 3529, 3551, 3515, 3534, 3521, 3527, 3517,
+     3538, 3532, 3530, 3545, 3522, 3545, 3536, 3546,    0, 3543,
+        0, 3562, 3554,    0, 3551, 3538,    0, 3553, 3538, 3571,
+     3542, 3558, 3595, 3559, 3564,    0, 3556, 3567, 3568, 3555,
+        0,    0, 3561, 3602, 3568, 3590, 3569,    0, 3563, 3569,
+     3571, 3580, 3572, 3580, 3576, 3580, 3599, 4752,    0,    0,
+        0, 3621, 3582, 3592, 3579,    0, 3580, 3595, 3594, 3593,
+     3599, 3588, 3600, 3636, 3589, 3586, 3589, 3592, 3593, 3602,
+     3597, 3613, 3603,    0, 3599,    0, 4752, 3605, 3600, 3602,
+     3623, 3625, 3613,    0, 3609, 3615, 3618,    0, 3627, 3620,
+
+     3620, 3629,    0, 3618,    0, 3666, 4752, 3617,    0, 3620,
+     3633, 3639,    0, 3671, 3690, 3638, 3621, 3641, 3643, 3679,
+     3645, 3650,    0,    0, 3648, 3649, 3652, 3638, 3644, 3650,
+     3649, 3637,    0,    0, 3642, 3653, 3655, 3663, 3665, 3659,
+     3675, 3667, 3665, 3715, 3694, 3713, 3702, 3717, 3703,    0,
+     3704, 3707, 3717, 3705, 3707, 3709, 3726, 3709, 3717, 3721,
+     3720, 3716,    0, 3724, 3717, 3717, 3730, 3719, 3740, 3739,
+     3724,    0, 3729, 3731, 3741, 3728, 3728, 3745, 3766, 3732,
+     3730, 3735, 3740, 3737,    0,    0, 3752, 3737, 3743, 3766,
+     3740,    0,    0,    0, 3741,    0,    0, 3792, 3757, 3747,
+
+     3798, 4752, 3802, 3751, 3773, 3772, 3772, 3767, 3761, 3770,
+     3762, 3764, 3776, 3773,    0, 3784, 3773, 3781, 3786,    0,
+     3791,    0, 3784, 3780, 3775,    0, 3828,    0,    0, 3779,
+     3794, 3816, 3796, 3784, 3811,    0, 3801, 3836, 3786, 3808,
+        0, 3806, 3818, 3808, 3816, 3808, 3807, 3808, 3828, 3810,
+     3814, 3860, 3862, 3864, 3865, 3825, 3814,    0,    0, 3816,
+     3877, 3834, 3839,    0, 3828, 3846, 3851, 3834,    0, 3883,
+     3832, 3872, 3889, 3874, 3842, 3843, 3843, 3848, 3897, 3867,
+     3858,    0,    0, 3867,    0, 3870, 3871, 3867, 3857, 3871,
+     3874, 3871, 3868, 3866,    0, 3872, 3864, 3868, 3882,    0,
+
+     3886, 3887, 3874,    0,    0, 3874, 3876, 3892, 3897,    0,
+        0, 3894, 3882, 3896, 3882, 3884, 3899, 3902, 3893, 3883,
+     3890, 3896, 3895,    0, 3897, 3900, 3895, 3906, 3910, 3911,
+     3897, 3909, 3899, 3915, 3918, 3903, 3903, 3905,    0, 3911,
+        0, 3905, 3912, 3958, 4752, 3962, 3920, 3918, 3928,    0,
+     3968, 3921, 3967, 3928, 3924, 3941,    0,    0,    0,    0,
+     3926, 3946, 3935, 3944, 3934, 3946, 3949, 3933,    0, 3941,
+     3943,    0, 3937, 3988,    0, 3947, 3943,    0,    0,    0,
+        0, 3958, 3955, 3950, 3948, 3943, 3956, 3956, 3959, 3948,
+     3968, 3962, 3971, 4004,    0, 3971, 3974, 4007, 3976, 4752,
+
+     3981, 3964, 4752, 3964, 4012, 4752, 3968,    0, 3978, 4752,
+     3969, 3985, 3982,    0, 4022, 3975,    0, 3976, 3992, 3977,
+     3978, 3975, 3976, 3982, 4043,    0,    0, 3998, 3992,    0,
+     4001, 4001,    0, 4002,    0, 3986, 4004, 4037,    0, 3991,
+     3994, 3992, 4008, 4015, 4013, 4016, 4028, 4020,    0,    0,
+     4006, 4020, 4031,    0, 4067,    0, 4063, 4064,    0, 4066,
+     4073, 4092, 4072, 4059, 4067, 4068, 4056, 4077,    0, 4065,
+     4066, 4070, 4073, 4075, 4115, 4084, 4085, 4121,    0,    0,
+     4074,    0, 4125, 4081, 4125, 4088, 4087, 4091, 4089, 4098,
+     4112, 4102,    0, 4095, 4104,    0, 4089, 4098, 4101, 4098,
+
+     4109, 4106,    0, 4137, 4110, 4097, 4100, 4105, 4126, 4112,
+     4118, 4115,    0,    0, 4127, 4119, 4128, 4133, 4129, 4171,
+     4130, 4137, 4142, 4130,    0, 4752, 4137, 4145,    0,    0,
+     4178, 4151, 4139,    0, 4133, 4149,    0, 4136, 4152,    0,
+        0, 4146, 4154,    0,    0, 4155,    0, 4188, 4189,    0,
+     4150, 4159,    0, 4147,    0,    0, 4223, 4151,    0, 4142,
+        0,    0, 4157, 4155,    0, 4166, 4156, 4200,    0,    0,
+     4149,    0, 4171,    0,    0, 4182, 4169, 4170, 4278, 4173,
+        0, 4279, 4284, 4752, 4213, 4166,    0, 4182, 4173, 4180,
+     4183, 4248, 4248, 4240, 4332, 4256, 4245, 4752,    0, 4247,
+
+     4258, 4246,    0, 4245, 4296, 4264, 4269, 4262, 4267, 4258,
+     4269, 4255, 4273, 4257, 4265,    0, 4273, 4262, 4280, 4275,
+     4271, 4273, 4314, 4270,    0, 4276, 4269, 4279, 4322, 4288,
+     4288, 4291, 4387, 4288, 4285, 4349,    0, 4389, 4390, 4363,
+     4347, 4362, 4381, 4382, 4355, 4752, 4367, 4359, 4356, 4360,
+     4403, 4405,    0,    0, 4439, 4357, 4366, 4371, 4369, 4413,
+     4375, 4415, 4371, 4415, 4376,    0, 4385, 4373, 4376,    0,
+     4377, 4395, 4411, 4412,    0,    0, 4381, 4380,    0,    0,
+     4485, 4396, 4384, 4402, 4403, 4752, 4391, 4752, 4406, 4395,
+     4412, 4410, 4411,    0, 4397, 4421,    0, 4434, 4449,    0,
+
+     4452,    0,    0, 4474, 4507,    0, 4472, 4469,    0, 4474,
+     4492, 4752, 4512, 4513,    0, 4752, 4514, 4468,    0,    0,
+        0, 4485,    0,    0,    0, 4478,    0, 4475, 4477, 4491,
+        0, 4528,    0, 4488, 4486, 4495, 4493, 4490, 4489, 4498,
+     4488,    0, 4506, 4507, 4496,    0, 4485,    0, 4541, 4494,
+     4494, 4512, 4498, 4494, 4502, 4523, 4513, 4509, 4518,    0,
+     4526,    0, 4516,    0, 4515, 4525, 4522, 4527, 4524,    0,
+     4752, 4565, 4530, 4526, 4532, 4528,    0, 4524, 4535, 4524,
+     4574, 4535, 4574, 4529, 4547,    0, 4540, 4549, 4550, 4550,
+     4568, 4589, 4590, 4634,    0, 4638, 4752, 4585, 4590, 4752,
+
+     4597, 4595, 4596, 4603, 4752,    0, 4613, 4752, 4599,    0,
+     4607, 4616, 4602, 4614, 4615, 4611,    0,    0,    0, 4623,
+     4654,    0, 4752, 4655,    0,    0, 4752, 4624,    0, 4612,
+     4630, 4619, 4667, 4671,    0, 4624,    0, 4616, 4618, 4675,
+     4676,    0,    0, 4642,    0,    0, 4631,    0, 4627,    0,
+     4752, 4638, 4752, 4636, 4752, 4654, 4643, 4687,    0, 4652,
+     4636, 4657, 4752, 4752, 4752,    0,    0, 4638, 4652, 4696,
+     4658, 4752, 4659,    0, 4703,    0, 4671, 4752, 4676, 4658,
+     4670, 4665, 4667,    0, 4752
     } ;
 
-static yyconst flex_int16_t yy_def[1402] =
+static yyconst flex_int16_t yy_def[1486] =
     {   0,
-     1297,    1, 1298, 1298, 1299, 1299, 1300, 1300, 1301, 1301,
-     1302, 1302, 1303, 1303, 1304, 1304, 1297, 1297, 1297, 1297,
-     1297, 1305, 1306, 1307, 1297, 1308, 1309, 1310, 1307, 1307,
-     1307, 1310, 1310,   33,   33,   33,   33,   33,   33,   33,
-       33,   33,   33,   33,   43,   33,   33,   33,   33,   33,
-       38,   33, 1307, 1311, 1297, 1297, 1311, 1297, 1312, 1313,
-     1313, 1314, 1297, 1297, 1297, 1315, 1316, 1317, 1318, 1318,
-     1319, 1319, 1297, 1320, 1321, 1322, 1323, 1324, 1297, 1325,
-     1326, 1327, 1297, 1297, 1297, 1297, 1328, 1297, 1329, 1330,
-     1297, 1297, 1331, 1297, 1332, 1333, 1297, 1334, 1335, 1336,
-
-     1334, 1337, 1338, 1339, 1340, 1297, 1341, 1342, 1343, 1344,
-     1345, 1346, 1297, 1346, 1337, 1345, 1346,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
-      117,  117,  117,  117,  117,  117,  117, 1347, 1297, 1347,
-     1348, 1349, 1347, 1297, 1350, 1350, 1297, 1297, 1350, 1350,
-     1297, 1297, 1351, 1297, 1297, 1352, 1353, 1354, 1355, 1356,
-     1357, 1358, 1355, 1356, 1297, 1359, 1360, 1361, 1362, 1363,
-     1364, 1365, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1297,
-     1297, 1297, 1297, 1372, 1297, 1373, 1374, 1375, 1376, 1377,
-     1297, 1378, 1379, 1379, 1380, 1380, 1381, 1382, 1383, 1297,
-     1384, 1385, 1385, 1297, 1386, 1386,  296,  296,  296,  296,
-
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296, 1297,
-     1297, 1297, 1387, 1388, 1389, 1297, 1390, 1297, 1297, 1297,
-     1372, 1297, 1372, 1297, 1297,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296, 1297, 1297,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296, 1297,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296, 1297, 1391, 1392, 1393, 1297,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296, 1297, 1297,
-     1297, 1297, 1297, 1297,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296, 1297, 1297,
-      296,  296,  296,  296,  296, 1394,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296, 1395,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-
-      296,  296, 1297,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296, 1395,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-     1297, 1297, 1395,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296, 1297,  296,  296,  296,  296,  296,  296,
-      296,  296, 1297,  296,  296,  296,  296,  296,  296,  296,
-      296,  296, 1297, 1297, 1297, 1297,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-
-     1394, 1394, 1394,  296,  296,  296,  296, 1297,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-      296, 1395,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296, 1297,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296, 1395,  296,
-      296,  296,  296, 1395,  296,  296,  296,  296,  296,  296,
-      296,  296, 1297, 1297, 1395,  296,  296,  296,  296, 1297,
-     1297, 1297,  296,  296,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-     1297,  296,  296, 1395,  296,  296,  296, 1297, 1297, 1297,
-
-     1297, 1297,  296,  296,  296,  296,  296,  296,  296,  296,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297,  296,  296,  296, 1297,  296,  296,  296,  296,  296,
-      296,  296, 1396, 1394,  296,  296,  296,  296,  296,  296,
-      296,  296,  296,  296,  296,  296,  296,  296, 1395,  296,
-      296,  296,  296,  296,  296,  296,  296,  296, 1297,  296,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-     1395,  296,  296,  296,  296, 1395,  296,  296,  296,  296,
-      296,  296,  296, 1297, 1297, 1297,  296,  296,  296, 1297,
-      296,  296,  296,  296,  296,  296,  296,  296,  296,  296,
-
-      296,  296, 1297,  296, 1395, 1297, 1297, 1297, 1297, 1297,
-     1297,  296,  296,  296,  296,  296,  296,  296, 1297, 1297,
-     1297, 1297,  296,  296, 1297,  296,  296,  296,  296, 1396,
-      296,  296,  296,  296,  296,  296,  296, 1297, 1297,  296,
-     1395,  296,  296,  296,  296,  296, 1397,  296, 1297,  296,
-      296,  296,  296, 1395,  296,  296, 1395,  296,  296,  296,
-      296, 1395,  296,  296,  296, 1297, 1297, 1395,  296,  296,
-      296, 1297,  296,  296,  296, 1297,  296, 1398,  296,  296,
-      296,  296,  296,  296,  296,  296, 1297,  296, 1395, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297,  296,  296,  296,  296,
-
-      296, 1297, 1297, 1297,  296, 1297,  296,  296,  296,  296,
-      296, 1297, 1297, 1297, 1395,  296,  296, 1397, 1397, 1297,
-      296,  296, 1395, 1395,  296, 1399,  296,  296, 1297, 1297,
-     1297,  296,  296, 1297,  296,  296,  296, 1297,  296, 1398,
-     1398,  296,  296,  296,  296,  296,  296, 1297,  296, 1395,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,  296,  296,
-      296,  296, 1297,  296, 1297,  296,  296,  296,  296,  296,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1395,  296,  296,
-     1397,  296,  296, 1395, 1399, 1399,  296,  296, 1297,  296,
-     1297,  296,  296, 1297,  296, 1398,  296,  296, 1400,  296,
-
-     1395, 1297, 1297, 1297, 1297, 1297, 1297,  296,  296,  296,
-      296,  296,  296, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1395, 1395, 1401,  296, 1297,  296, 1297,  296, 1297,  296,
-      296, 1297, 1297,  296, 1395, 1297, 1297, 1297, 1297, 1297,
-     1297,  296,  296,  296,  296,  296, 1297, 1297, 1297, 1297,
-     1395, 1401,  296, 1297,  296, 1297,  296, 1297, 1297,  296,
-     1395, 1297, 1297, 1297, 1297,  296,  296,  296, 1297, 1395,
-     1297,  296, 1297, 1297,  296, 1297, 1297, 1297, 1297,  296,
-     1395, 1297,  296,  296, 1297, 1297, 1297, 1297,  296, 1297,
-      296,  296,  296,  296,  296,  296,    0, 1297, 1297, 1297,
-
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-
-     1297
+     1485,    1, 1485,    3,    1,    5,    5,    7, 1485,    9,
+        7,   11,   11,   13,   11,   15, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485,   24,   24,   24,   24,
+       24,   28,   28,   33,   33,   33,   33,   33,   33,   33,
+       33,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   24, 1485, 1485, 1485,   55, 1485, 1485,
+     1485,   61, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+       70,   70,   72, 1485,   70,   70, 1485,   70, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,   88,
+       88,   19, 1485,   22, 1485,   22,   23, 1485,   23,   23,
+
+       97,   23,   24,   24, 1485,   26, 1485,   26,   27,   24,
+       32,   24,   28, 1485,   41,   24,  112,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   55,   56,   58,   60,   60,   55,
+     1485,   61,   62,   64,   64,   62,   62, 1485,  248,   63,
+      248,   65,   67,   68,   69,   70,   72, 1485,   79,   71,
+       73,   74,   75,  258, 1485,   76,  258, 1485,   77,   77,
+       78,  258, 1485,   81,   82,   83,   85,   86,   86,   87,
+       88,   89,   90,   90,   91,   91,   96, 1485,   97,  100,
+      100,  100,  101,  101,  104,  104,  105,  108, 1485,  110,
+
+      110,  117,  117,  112, 1485,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41, 1485, 1485, 1485,  258,  264,  267, 1485,
+      272, 1485, 1485,  279,   88, 1485,   88, 1485, 1485,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+     1485, 1485,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41, 1485,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41, 1485,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41, 1485,  265,  268,
+      273,  484,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41, 1485,  512, 1485, 1485, 1485, 1485,
+     1485,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41, 1485, 1485,   41,   41,   41,
+       41,   41,   41,   41, 1485,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,  111,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41, 1485,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,  111,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+     1485, 1485,  111,   41,   41,   41,   41,   41,   41,   41,
+       41,   41, 1485,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,  662,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41, 1485,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41, 1485,
+       41,  715,  872,  873,   41,   41,   41,   41, 1485,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,  111,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41, 1485,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,  111,   41,   41,   41,   41,   41,
+      111,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41, 1485, 1485,  111,   41,   41,   41,   41,
+     1485, 1485,  951,   41,   41,   41,   41,   41,   41,   41,
+       41,   41, 1485,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,  827,   41,   41,  111,   41,   41,   41,
+       41, 1485, 1485, 1485, 1485, 1485,   41,   41,   41,   41,
+       41,   41,   41,   41,   41, 1485, 1485, 1485,  852, 1485,
+
+     1485,  853, 1485, 1002, 1485, 1485, 1485, 1005,  855, 1485,
+     1485,   41,   41,   41, 1485,  861,   41,   41,   41,  532,
+       41,   41, 1485,   41, 1485,  873,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+      111,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41, 1485,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,  111,   41,   41,   41,   41,
+       41,  111,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41, 1485, 1485, 1083,   41,   41,   41, 1485,   41,
+       41,   41,   41,   41, 1485,   41,   41,   41,   41,   41,
+
+       41,   41,   41,  974,   41,  111, 1485, 1485, 1485, 1485,
+     1485, 1485,   41,   41,   41,   41,   41,   41,   41, 1485,
+       41,   41, 1485, 1485,  998, 1485, 1485, 1485, 1005, 1009,
+      329,   41, 1485,   41,   41,   41,   41, 1485,   41, 1025,
+       41,   41,   41,   41,   41,   41,   41, 1485, 1485,   41,
+      111,   41,   41,   41,   41,   41, 1485,   41,   41, 1485,
+       41,   41,   41,   41,   41,   41,  111,   41,   41,   41,
+      111,   41,   41,   41,   41,  111,   41,   41, 1485,   41,
+       41,   41, 1485, 1485,  111,   41,   41,   41, 1485,   41,
+       41,   41, 1485,   41, 1485,   41,   41, 1485,   41,   41,
+
+       41,   41,   41,   41, 1104,   41,  111, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485,   41,   41,   41,   41,   41, 1485,
+       41,   41,  511, 1485,  999, 1485, 1223,   41, 1485,   41,
+       41, 1485,   41,   41,   41,   41, 1149, 1485, 1485,  111,
+       41,   41, 1157, 1157,   41, 1485,   41,   41,   41,  111,
+     1485, 1485,  111,   41, 1485,   41,   41, 1485,   41, 1485,
+       41, 1485, 1485, 1262,   41,   41, 1485,   41,   41,   41,
+     1485,   41, 1195, 1195,   41,   41,   41,   41,   41,   41,
+     1205,   41,  111, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485,   41,   41,   41,   41, 1485,   41,   41, 1485, 1002,
+
+       41, 1229,   41,   41, 1485, 1305,   41,   41,   41,   41,
+     1238, 1485, 1485, 1485, 1239, 1485, 1485,  111,   41,   41,
+     1243,   41,   41,   41,   41,  111, 1252, 1485, 1485, 1485,
+     1255, 1255,   41,   41, 1485,   41, 1485,   41, 1485,   41,
+     1485,   41,   41, 1485,   41, 1273,   41,   41, 1281,   41,
+      111, 1485, 1485, 1485, 1485, 1485, 1485,   41,   41,   41,
+     1485,   41, 1485,   41,   41, 1485,   41,   41,   41, 1313,
+     1485, 1485, 1314, 1485, 1317, 1485,  111,   41,  111, 1485,
+     1485, 1485, 1485,   41, 1485,   41, 1485,   41, 1485,   41,
+     1485,   41, 1485,  633,   41, 1485, 1485,   41,  111, 1485,
+
+     1485, 1485, 1485, 1485, 1485,   41,   41, 1485, 1485,   41,
+     1485,   41,   41,   41, 1372, 1485, 1373, 1375,   41,  111,
+     1485, 1381, 1485, 1485, 1383,   41, 1485, 1485,   41, 1485,
+       41, 1485,   41,  801, 1434,   41,  111, 1485, 1485, 1485,
+     1485,   41,  998, 1485,   41,   41,   41, 1415,  111, 1421,
+     1485, 1424, 1485, 1485, 1485, 1485,   41,  944, 1458,   41,
+     1485, 1485, 1485, 1485, 1485,   41,  111, 1485, 1485,   41,
+       41, 1485, 1485, 1452, 1183, 1475,   41, 1485,   41,   41,
+       41,   41,   41,   41,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[6827] =
+static yyconst flex_int16_t yy_nxt[4813] =
     {   0,
        18,   19,   20,   19,   19,   21,   22,   23,   24,   25,
        26,   19,   19,   24,   19,   24,   24,   27,   28,   28,
-       28,   28,   28,   18,   19,   29,   30,   31,   24,   18,
-       32,   33,   34,   35,   36,   37,   38,   39,   40,   41,
-       42,   43,   44,   45,   46,   47,   41,   48,   49,   50,
-       51,   41,   52,   41,   41,   41,   53,   32,   33,   34,
-       35,   36,   37,   38,   39,   40,   41,   42,   43,   44,
-       45,   46,   47,   41,   48,   49,   50,   51,   41,   52,
-       41,   41,   41,   18,   55,   56,   57,   55,  275,   58,
-       94,  275, 1196,   59,   55,   56,   57,   55,  103,   58,
-
-       97,   95,  114,   59,   18,   60,   61,   60,   60,   18,
-       18,  104, 1181,   18,   18,   63,   63,  106,   63,   70,
-       71,   72,   73, 1141,  107,   74,  105,   18,   63,  114,
-      109,  103,  103,   18,  290,   75,   70,   71,   72,   73,
-     1119,   76,   74,  104,  104,  104,   77,   78,   84,   79,
-       84,   84,   75,   85,  282,  615,   93,   85,   76,  229,
-      281,  229,  229,   77,   78,   86,   86,   86,   86,   86,
-       88,   79,   79,   88,  229,   89,  230,  229,  105,   90,
-      245,   97,  245,  245,  465,  104,  290,   18,   18,   60,
-       61,   60,   60,   18,   18,  103,  104,   18,   18,   63,
-
-       63,  103,   63,  109,   84,   79,   84,   84,  104,   85,
-      303,   18,   63,   85,  104,  104,  104,   18,  114,  304,
-      464,   86,   86,   86,   86,   86,   88,   79,   79,   88,
-       91,   89,   91,   91,  103,   90,  462,  303,  114,  114,
-       91,   91,  114,   91,  115,  114,  304,  104,  275,  232,
-      232,  275,  232,   91,  232,  459,  458,  255,  233,  255,
-      255,  270,  912,  270,  270,  114,  114,  250,  250,  114,
-      913,   18,   18,   64,   65,   64,   64,   18,   66,  157,
-      456,   18,   68,   18,   18,  251,   18,  254,  257,  254,
-      255,  116,  103,  158,  258,   18,   18,  277,  159,  114,
-
-      277,   18,  274,  114,  104,  104,  157,  114,  183,  251,
-      250,  250,  302,  114,  452,  250,  114,  184,  185,  114,
-      158,   97,  305,  186,  114,  159,  114,  250,  250,   93,
-      114,  260,  250,  281,  114,  183,  250,  261,  279,  302,
-      114,  279,  250,  114,  184,  185,  114,  274,  251,  305,
-      186,  114,  451,  250,  252,   18,   18,   64,   65,   64,
-       64,   18,   66,  450,  104,   18,   68,   18,   18,  318,
-       18,  114,  301,  114,  167,  282,  187,  168,  296,   18,
-       18,  169,  226,  353,  188,   18,  114,  114,  189,  114,
-      227,  114,  327,  114,  114,  114,  318,  114,  114,  301,
-
-      114,  167,  114,  187,  168,  296,  114,  114,  169,  226,
-      353,  188,  294,  114,  114,  189,  114,  227,  114,  327,
-      114,  114,  114,  915,  114,  235,  236,  235,  235,  114,
-     1038,  916,  104,  114,  114,  237,  237, 1039,  238,   18,
-       18,   18,   79,   18,   18,   18,   80,  106,  237,   18,
-       82,   18,   18,  197,   18,  300,  198,  199,  263,  263,
-      263,  263,  263,   18,   18,  239,  240,  239,  239,   18,
-      331,  200,  114,  114,  114,  241,  241,  114,  242,  104,
-      197,   94,  300,  198,  199,  250,  250,  328,  241,  114,
-      250,  114,  238,  244,  238,  238,  251,  331,  200,  114,
-
-      114,  114,  238,  238,  114,  238,  265,  273,  273,  273,
-      273,  273,  266,  915,  328,  238,  114,  801,  114,  114,
-      801,  916,  367,   18,   18,   18,   79,   18,   18,   18,
-       80,   92, 1297,   18,   82,   18,   18,  297,   18,  253,
-      250,  254,  255, 1104,  298,  250,  114,   18,   18,  367,
-      485,  808,  114,   18,  808,  250,  271, 1297,  271,  271,
-      114,  251, 1297,  340,  297,  114,  250,  252,  272,  272,
-      272,  298, 1297,  272,  272,  272,  272,  272,   91,  114,
-       91,   91,  293,  293,  293,  293,  293,  114,   91,   91,
-      340,   91,  114,  104, 1297,  229,  114,  229,  229,  299,
-
-      229,   91,  230,  229, 1297, 1297,  114,   18,   96,   96,
-       97,   96,   96,   96,   96,  114, 1297,   96,   96,   96,
-       96,  306,   96,  114,   99,  307,  299,  114,  315,  308,
-      309,   96,   96,  114,  310,  329, 1297,  100,  311,  313,
-      114, 1297,  114,  316,  312,  114,  314,  114,  306,  114,
-      325,  114,  307,  382,  114,  315,  308,  309,  114,  326,
-      114,  310,  329,  317,  101,  311,  313,  114,  330,  114,
-      316,  312,  114,  314,  114, 1297,  114,  325,  114, 1297,
-      382,  245,  333,  245,  245,  114,  326,  114,  114,  332,
-      317,   96,  110,  110,  341,  330,  114,  114,  110,  114,
-
-      110,  111,  110,  112,  112,  112,  112,  112,  113,  333,
-      110,  110,  110,  110,  104,  114,  332,  114,  339,  346,
-      114,  341,  114, 1297,  114,  919,  114, 1297,  350,  114,
-      374,  232,  232,  920,  232,  255,  232,  255,  255,  319,
-      233,  110,  110,  110,  114,  339,  346,  114,  110,  114,
-      110,  116,  110, 1297,  320,  350,  114,  114,  113,  321,
-      110,  110,  110,  110,  104,  322,  319,  117,  118,  801,
-      343,  323,  801,  342,  114,  324,  119,  114,  120,  114,
-      121,  320,  122,  123,  114,  803,  321,  114,  418,  354,
-     1165,  110,  322, 1165,  117,  118,  114,  343,  323,  355,
-
-      342,  114,  324,  119,  114,  120,  114,  121, 1297,  122,
-      123,  110,  110,  114,  114,  418,  354,  110,  436,  110,
-      116,  110,  344,  114,  334,  345,  355,  113,  335,  110,
-      110,  110,  110,  104,  124,  336,  337,  356,  114,  114,
-      114,  279,  338,  114,  279,  436,  351,  114,  352,  344,
-      463,  334,  345,  114,  125,  335,  363, 1297,  126, 1297,
-      110,  124,  336,  337,  356,  114,  114,  397,  347,  338,
-      114,  114,  348,  351,  114,  352, 1185,  357,  114, 1185,
-      114,  125,  349,  363,  364,  126,  114,  114,  365,  429,
-      127,  114,  114,  128,  397,  347,  114,  129,  114,  348,
-
-      130,  131,  378,  132,  357,  114,  114,  114,  114,  349,
-      133,  364,  116,  114,  114,  365,  429,  127,  114,  114,
-      128,  366,  114,  114,  129,  104,  368,  130,  131,  378,
-      132, 1297,  369,  114,  114,  114,  379,  133,  134,  370,
-      380,  114,  135,  386,  371,  114,  136,  114,  366,  114,
-      372,  137,  138,  368,  373,  442,  114,  433,  114,  369,
-      139, 1297,  114,  379,  114,  134,  370,  380,  114,  135,
-      386,  371,  114,  136,  114, 1297, 1297,  372,  137,  138,
-     1297,  373,  442,  114,  433,  114, 1297,  139,  358,  114,
-      114,  114,  140,  449,  359,  468,  375,  381,  114,  383,
-
-      360,  141,  376,  142,  361,  114,  143,  362,  377,  114,
-      114,  144,  384,  145,  114,  358, 1297,  114,  385,  140,
-      449,  359,  468,  375,  381,  114,  383,  360,  141,  376,
-      142,  361,  114,  143,  362,  377,  114,  114,  144,  384,
-      145,  114,  146,  387,  400,  385,  388,  389,  390,  393,
-      147,  114,  114,  391,  116,  114,  148,  392,  114,  149,
-      150,  151,  114,  114,  114,  114,  114,  104, 1297,  146,
-      387,  400, 1297,  388,  389,  390,  393,  147,  114,  114,
-      391,  399,  114,  148,  392,  114,  149,  150,  151,  114,
-      114,  114,  114,  114,  114,  152,  394,  114,  395,  396,
-
-      114,  398,  153,  428,  114,  114,  114,  417,  399,  154,
-      409,  155,  114,  156,  114,  114,  413,  270,  114,  270,
-      270,  114,  152,  394,  114,  395,  396,  114,  398,  153,
-      428,  114,  114,  114,  417,  114,  154,  409,  155,  114,
-      156,  114,  114,  413,  410,  114,  114,  439,  160,  161,
-     1297,  162,  163,  419,  116,  411,  434,  114,  164,  165,
-     1297,  412,  114,  114,  166, 1297,  114,  104,  414, 1297,
-      114,  410,  114,  114,  439,  160,  161,  415,  162,  163,
-      419,  114,  411,  434,  114,  164,  165,  416,  412, 1297,
-      114,  166,  422,  114,  427,  414,  430,  114,  114,  114,
-
-      114,  170,  171,  420,  415,  437,  423,  421,  114,  114,
-      172,  114,  173,  114,  416,  114,  438,  174,  114,  422,
-      114,  427,  114,  430, 1297,  114, 1297,  114,  170,  171,
-      420, 1297,  437,  423,  421, 1297,  114,  172,  114,  173,
-      114, 1297,  114,  438,  174,  114, 1297,  114,  431,  114,
-      175,  176,  432,  177,  178,  424,  425,  440,  179,  435,
-      114,  441,  180,  443,  181,  114,  426,  114,  114,  469,
-      114,  114,  114,  114,  182,  431, 1297,  175,  176,  432,
-      177,  178,  424,  425,  440,  179,  435,  114,  441,  180,
-      443,  181,  114,  426,  114,  114,  469,  114,  114,  114,
-
-      114,  182,  190,  474,  447,  444,  191,  114,  192,  445,
-      193,  114,  480,  446,  448,  114,  194,  195,  277,  196,
-     1297,  277,  114,  461,  114,  254,  114,  254,  255,  190,
-      474,  447,  444,  191,  114,  192,  445,  193,  114,  480,
-      446,  448,  114,  194,  195, 1297,  196,  251,  470,  114,
-     1297,  114,  499,  114,  114,  114,  475,  242,  201,  242,
-      242,  202,  203,  114,  471,  204,  205,  242,  242,  206,
-      242,  114,  207,  208,  209,  470,  210,  114,  211,  499,
-      242,  114,  114,  475,  242,  201,  242,  242,  202,  203,
-      114,  471,  204,  205,  242,  242,  206,  242,  114,  207,
-
-      208,  209, 1297,  210,  114,  211,  212,  242,  213,  240,
-      240,  240,  240,  214,  215,  250,  250,  216, 1165,  217,
-      218, 1165, 1297,  915,  250,  250,  114,  453,  453,  250,
-      219,  916, 1297,  212, 1112,  213,  257, 1297, 1297,  250,
-      214,  215,  258,  116,  216,  251,  217,  218,  258, 1113,
-      250,  252, 1114,  114,  258, 1297,  104,  219,  114,  487,
-      220,  253,  250,  254,  255,  221,  114,  250, 1297,  114,
-      222,  473,  223,  114,  224,  225,  114,  250,  273,  273,
-      273,  273,  273,  251, 1297,  114,  487,  220,  250,  252,
-      250,  250,  221,  114, 1297,  250,  114,  222,  473,  223,
-
-      114,  224,  225,  114,   96,   96,   97,   96,   96,   96,
-       96,  265,  116,   96,   96,   96,   96,  266,   96, 1126,
-       99,  235,  236,  235,  235,  104, 1185,   96,   96, 1185,
-     1297,  237,  237,  100,  238,  239,  240,  239,  239,  238,
-      244,  238,  238,  919,  237,  241,  241, 1297,  242,  238,
-      238,  920,  238,  238,  244,  238,  238,  488,  241,  114,
-      101, 1297,  238,  238,  238, 1297,  238,  263,  263,  263,
-      263,  263,  239,  240,  239,  239,  238, 1297,  456, 1297,
-      114,  492,  241,  241,  488,  242,  114,   96,   96,   96,
-       97,   96,   96,   96,   96,  241, 1297,   96,   96,   96,
-
-       96,  114,   96,  242,  476,  242,  242,  114,  492, 1297,
-      114,   96,   96,  242,  242,  478,  242,  100, 1278,  250,
-      250, 1278,  453,  453,  250, 1297,  242,  453,  114,  453,
-      453,  476,  114,  477,  453, 1297,  490,  114,  114,  114,
-      260,  114,  478,  261,  284,  250,  261, 1297,  453,  261,
-      266,  293,  293,  293,  293,  293,  266, 1297, 1297,  114,
-      477,  912,  104,  490,  114,  114,  114,  472,  114,  913,
-     1297,   96,   96,   96,   97,   96,   96,   96,   96, 1297,
-      114,   96,   96,   96,   96,  271,   96,  271,  271, 1297,
-     1279,  114,  491, 1279,  472,   96,   96,  272,  272,  272,
-
-      479,   96,  272,  272,  272,  272,  272,  114, 1297,  114,
-      495,  114,  460,  114,  460,  460,  481,  483,  518,  491,
-      114,  114,  482,  114,  272,  272,  272,  479,  286,  272,
-      272,  272,  272,  272, 1297,  484,  114,  495,  114, 1297,
-      114, 1297,  485,  481,  483,  518, 1297,  114,  114,  482,
-      114,  872, 1297,  872,  872,   96,   96,   96,   97,   96,
-       96,   96,   96,  489, 1297,   96,   96,   96,   96,  114,
-       96,  493,   99,  500,  494,  496,  497,  501,  114,   96,
-       96,  486,  114,  114,  498,  100,  114,  114,  114,  502,
-      489,  114,  114,  114,  507,  503,  114,  114,  493,  504,
-
-      500,  494,  496,  497,  501,  114,  114,  114,  486,  114,
-      114,  498,  101,  114,  114,  114,  502, 1112,  114,  114,
-      114,  507,  503, 1217,  114,  986,  504,  986,  986, 1297,
-      505, 1172, 1113,  114,  114, 1114,  114,  506,  508,   96,
-      110,  110,  114, 1297,  517,  114,  110,  114,  110,  111,
-      110,  112,  112,  112,  112,  112,  113,  505,  110,  110,
-      110,  110,  104,  114,  506,  508,  114,  510, 1297,  114,
-      509,  517,  114, 1297,  114,  511,  114, 1219,  513,  659,
-      114,  659,  659, 1297,  660, 1176,  512,  515, 1297,  110,
-      110,  110,  114,  114,  510,  114,  110,  509,  110,  116,
-
-      110,  514,  511,  114,  114,  513,  113,  114,  110,  110,
-      110,  110,  104,  512,  515,  114,  114,  547,  516,  114,
-     1297, 1247,  114, 1297,  519,  520,  114,  114,  514, 1215,
-      114,  114,  872, 1297,  872,  872, 1297,  742,  521,  110,
-      110,  110,  114,  114,  547,  516,  110,  114,  110,  116,
-      110,  519,  520,  114,  114, 1297,  113,  114,  110,  110,
-      110,  110,  104,  522,  524,  521,  114,  523,  540,  114,
-      114,  114,  526,  525,  114,  114, 1297,  527, 1297,  529,
-      114,  114,  295, 1297,  530, 1297,  114,  114,  528,  110,
-      522,  524, 1297,  114,  523,  540,  114,  114,  114,  526,
-
-      525, 1297,  114,  539,  527,  114,  529,  114,  114,  295,
-      401,  530,  402,  114,  114,  528,  403,  531,  114,  114,
-      114,  532,  404,  546,  534,  405,  406,  114,  407,  408,
-      539,  986,  114,  986,  986, 1297,  864,  401,  114,  402,
-     1297, 1297, 1297,  403,  531,  114,  114,  114,  532,  404,
-      546,  534,  405,  406,  114,  407,  408,   96,   96,   97,
-       96,   96,   96,   96, 1297,  114,   96,   96,   96,   96,
-      533,   96,  114,  535,  114,  541,  537,  538,  542,  536,
-       96,   96,  114,  114,  544,  114,  100,  549,  114,  114,
-      543,  545,  114,  114,  548,  114,  114,  533,  563,  114,
-
-      535,  114,  541,  537,  538,  542,  536, 1297,  554,  114,
-      114,  544,  114,  284,  549,  114,  114,  543,  545,  114,
-      114,  548,  114,  114, 1297,  563,  552,  550, 1217, 1219,
-      114,  556,  114,  114,  114,  551, 1172, 1176, 1297,  555,
-       96,   96,   96,   97,   96,   96,   96,   96,  114, 1297,
-       96,   96,   96,   96,  550,   96,  553,  114,  556,  114,
-      114,  114,  551,  557,   96,   96,  555,  558,  562,  114,
-      100,  559,  114,  114,  564,  114,  561,  114,  565,  114,
-      114,  560,  568,  553,  572,  114,  114,  569,  578,  114,
-      557,  114,  114,  114,  558,  562,  114,  284,  559,  114,
-
-      114,  564, 1247,  561,  114,  565,  114,  114,  560,  568,
-     1215,  572,  114,  114,  569,  578,  114,  574,  114,  114,
-      114, 1297, 1297,  114,   96,   96,   96,   97,   96,   96,
-       96,   96,  566,  570,   96,   96,   96,   96,  571,   96,
-     1297,  114,  573,  114,  574,  567,  114,  114,   96,   96,
-      114,  114,  114,  576,   96,  575,  114,  579,  577,  566,
-      570,  114,  582,  580,  585,  571,  581,  583,  114,  573,
-      114,  584,  567,  114,  114,  114,  114,  114,  114,  114,
-      576,  286,  575,  114,  579,  577, 1297, 1297,  114,  582,
-      580,  585, 1297,  581, 1297,  114, 1297,  114,  584,  586,
-
-     1297,  588,  114,  114,  114, 1297, 1297,  114,   96,   96,
-       96,   97,   96,   96,   96,   96,  114, 1297,   96,   96,
-       96,   96,  114,   96,  114,  587,  586,  114,  588,  589,
-      595,  114,   96,   96,  114,  591,  594,  592,   96,  593,
-      596,  114,  114,  114,  114,  114,  114,  597,  599,  114,
-      590,  114,  587,  114,  114,  598,  589,  595,  114,  114,
-      114,  600,  591,  594,  592,  286,  593,  596,  114,  114,
-      114,  114,  114,  114,  597,  599,  114,  590,  114,  601,
-      114,  605,  598,  114, 1297, 1297,  114,  114,  600, 1297,
-     1297,  602,   96,  110,  110,  114,  114,  114,  114,  110,
-
-      604,  110,  116,  110,  603,  114,  601,  606,  605,  113,
-      114,  110,  110,  110,  110,  104,  608,  114,  602,  114,
-      114,  611,  114,  114,  466,  114, 1297,  604,  609,  610,
-      114,  603,  114, 1297,  606, 1297,  607,  114,  114,  114,
-      114, 1297,  110,  608,  114, 1297,  114,  114,  611, 1297,
-      612,  466,  110,  110,  114,  609,  610,  114,  110,  614,
-      110,  116,  110,  607,  114,  114,  114,  114,  113,  114,
-      110,  110,  110,  110,  104,  114,  114,  612,  613,  453,
-      453,  114, 1297,  453,  453, 1297,  614, 1297,  453, 1297,
-      453,  453,  467, 1297,  622,  453,  114, 1297, 1297, 1297,
-
-      258,  110,  114,  114,  261,  613,  616,  114, 1297,  453,
-      617,  266,  460,  620,  460,  460,  114,  618,  114,  467,
-      621,  622,  626,  624,  619,  619,  619, 1297,  625,  619,
-      619,  619,  619,  619,  114,  114,  114,  623,  114,  627,
-      620,  628,  630,  114,  114,  114,  629,  621,  635,  626,
-      624, 1297,  114,  114,  632,  625,  114,  631,  633, 1297,
-      484,  114,  114,  114,  623,  114,  627,  485,  628,  630,
-     1297,  114,  634,  629,  114,  635,  114,  636,  637,  114,
-      114,  632,  646,  114,  631,  633,  640,  114,  114,  638,
-      114,  114,  114,  645,  641,  114,  114,  648,  647,  634,
-
-      114,  114, 1297,  114,  636,  637,  639, 1297,  649,  646,
-      114,  114,  114, 1297,  114,  650,  638,  114,  114,  114,
-      645,  114,  114,  114,  648,  647,  114,  114,  651,  653,
-      642,  114,  643,  639,  644,  649,  652,  114,  114,  114,
-      114,  654,  650,  114,  114,  114,  655,  114,  114,  657,
-      114,  658,  114,  114,  656,  651,  653,  642,  114,  643,
-      114,  644,  114,  652,  662, 1297,  114,  114,  654,  663,
-      114,  114,  114,  655,  114,  665,  657,  114,  658,  114,
-      659,  656,  659,  659,  114,  660,  664,  114,  114,  114,
-      666,  662,  114,  114,  668,  667,  663, 1297,  114, 1297,
-
-      670, 1297,  665,  669,  671,  114,  114,  114,  674,  675,
-      114,  114,  114,  664,  114,  114,  114, 1297,  672,  114,
-      677,  668,  667,  114,  673,  114,  114,  670,  114,  661,
-      669,  671,  114,  114,  114,  674,  675,  114,  676,  114,
-      114,  114,  114,  114,  114,  672,  114,  677,  679,  678,
-      114,  673,  681,  114,  683,  114,  661,  680,  114,  114,
-      682,  114,  684,  685,  114,  676,  686,  114, 1297,  114,
-      114,  114, 1297,  114,  114,  679,  678,  114,  691,  681,
-      689,  683,  692,  114,  680,  114,  114,  682,  114,  114,
-      687,  114,  114,  686,  688,  114, 1297,  114,  694,  114,
-
-      696,  114,  114,  114,  114,  691,  695,  697,  693,  692,
-      114,  114,  114,  690,  114, 1297,  114,  687,  114,  114,
-      698,  688,  114,  114,  114,  694,  114,  696,  699,  114,
-      114,  114,  552,  695,  697,  693,  700,  114,  114,  114,
-      690,  114,  114,  701,  114,  114,  114,  698,  704,  114,
-      114,  114,  702,  114, 1297,  699,  114,  114,  114, 1297,
-     1297,  711,  703,  700,  114,  708, 1297,  114,  705,  114,
-      701,  114,  706,  114,  114,  704,  114,  709,  710,  702,
-      114,  114,  712,  114,  114,  114,  707,  114,  711,  703,
-      114,  114,  708,  713,  114,  705,  715,  114,  714,  706,
-
-      716,  114,  718,  114,  709,  710,  719, 1297,  114,  712,
-      114, 1297,  114,  707,  114,  114,  114,  114,  114,  717,
-      713,  114,  114,  715,  114,  714,  721,  716,  724,  718,
-      114,  114,  722,  727,  725,  720,  723,  114,  114,  729,
-      114,  114,  114,  114,  726,  114,  717,  114,  114,  114,
-      114,  731,  728,  721,  114,  724,  114,  114,  114,  722,
-      727,  725,  720,  723,  114,  114,  729,  114,  114,  730,
-      732,  726,  114,  114,  114,  114,  114,  114,  731,  728,
-      734,  114, 1297,  114,  114,  114,  733,  114,  114,  114,
-      738,  114,  735,  114,  736,  737,  730,  732, 1297, 1297,
-
-      114, 1297,  114,  114, 1297,  745,  114,  734,  747,  739,
-      746,  114,  114,  733,  114,  114,  114,  738,  114,  735,
-      114,  114,  114,  114, 1297,  740,  741,  748,  741,  741,
-      114,  742,  745,  114,  749,  747,  739,  746,  114,  114,
-      114,  114,  750,  753, 1297,  114,  114,  114,  114,  114,
-      114,  743,  740, 1297,  748,  751,  754,  114,  114,  752,
-      757,  749,  114,  114,  755,  114,  114,  114,  114,  750,
-      744,  114,  114,  114,  114,  756, 1297,  759,  114,  114,
-      758,  114,  751,  754,  760,  114,  752,  757,  761,  114,
-      114,  755,  114,  114,  114,  114, 1297,  744,  114,  114,
-
-     1297, 1297,  756,  762,  759,  114,  114,  758,  114,  763,
-      773,  760,  114,  773,  764,  761,  764,  764, 1297,  765,
-      114,  114,  114,  114,  766,  769,  619,  619,  619, 1297,
-      762,  619,  619,  619,  619,  619,  763,  114,  114,  114,
-      114,  767,  114,  768,  770,  771,  765,  772,  775, 1297,
-      114,  766,  769,  114,  114,  780,  114,  774,  776,  114,
-      114,  114,  114,  114,  114,  114,  777,  114,  767,  114,
-      768,  770,  771,  783,  772,  775,  114,  114,  778,  779,
-      114,  114,  780,  114,  774,  776,  114,  114,  114,  114,
-      114,  782,  781,  777,  640,  114,  784,  785,  786,  787,
-
-      783,  114,  641,  114,  114,  778,  779,  114,  788,  114,
-      789, 1297,  114, 1297,  791, 1297,  114,  790,  782,  781,
-      114,  114,  114,  784,  785,  786,  787,  114,  114,  114,
-      114,  792,  796,  114,  114,  788,  114,  789,  642,  114,
-      643,  791,  644,  114,  790,  114,  793,  114,  114,  795,
-      794,  114,  114,  797,  114,  114,  114,  114,  792,  796,
-      114,  114,  114,  114,  114,  642,  798,  643,  807,  644,
-      800, 1297,  114,  793,  799,  804,  795,  794,  114,  114,
-      797,  114,  114,  114,  114,  114,  114,  806,  114,  114,
-      114,  114,  805,  798,  809,  807,  114,  800,  810,  114,
-
-      808,  799,  804,  808,  811,  812,  813,  114,  114,  114,
-      114,  114,  114,  114,  806,  114,  817,  114,  114,  805,
-      114,  809,  114,  114,  114,  810,  114,  114,  814,  816,
-      114,  811,  812,  813,  114,  815,  114,  818,  114,  114,
-      826, 1297,  114,  817,  114,  114,  114,  114,  114,  114,
-     1297,  114,  819,  820,  114,  814,  816,  114,  821,  114,
-     1297,  823,  815,  114,  818,  114,  114,  826,  116,  825,
-      824, 1297,  114,  114,  114,  114,  114,  114,  114,  819,
-      820,  104,  114,  828,  827,  821,  114,  822,  823,  829,
-      114,  830,  114,  831,  832,  833,  825,  824,  114,  114,
-
-      835,  114,  114,  114,  114,  114,  114, 1297,  834,  114,
-      828,  827,  114, 1297,  822,  836,  829,  114,  830,  114,
-      831,  832,  833,  837,  114,  114,  840,  835,  838,  114,
-      114,  839,  114,  114,  114,  834,  841,  114, 1297,  114,
-      114,  843,  836,  846,  114,  114,  842,  114,  114,  114,
-      837,  114,  844,  840,  847,  838,  845,  114,  839,  114,
-      114,  114,  850,  841,  114,  114,  114,  114,  843,  114,
-      846,  116,  114,  842,  114,  114,  114,  114,  848,  844,
-      853,  847,  851,  845,  104,  854,  114,  114,  852,  850,
-     1297,  857,  114,  114,  114,  114,  114,  114,  856,  849,
-
-      858,  114,  114,  114,  114,  848,  859,  853,  114,  851,
-      860,  855,  114,  114,  861,  852,  114,  114,  857,  114,
-      114,  114,  114,  114,  114,  856,  849,  858,  114,  114,
-      114,  873,  114,  859,  862,  114,  868,  860,  855,  114,
-     1297,  861, 1297,  114,  114, 1297,  114,  114,  114,  863,
-      114,  863,  863, 1297,  864,  114,  869,  874,  873,  114,
-     1297,  862,  741,  868,  741,  741,  872,  742,  872,  872,
-      114,  877,  114,  875,  865,  114,  114,  876,  114, 1297,
-      878,  116,  114,  869,  874,  879,  114,  870,  114,  866,
-      114,  114,  881,  867,  104,  114, 1297,  114,  877,  114,
-
-      875,  885, 1297,  114,  876,  114,  871,  878,  114,  114,
-      114,  880,  879,  114,  882,  114,  866,  114,  114,  881,
-      867,  886,  114,  884,  883,  887,  114,  114,  885,  114,
-      888,  114,  114,  871,  114,  114,  114,  114,  880,  114,
-      889,  882,  114,  114,  114, 1297,  890, 1297,  886, 1297,
-      884,  883,  887,  114,  114,  894,  114,  888,  114,  114,
-     1297,  114,  764,  895,  764,  764,  114,  889,  896,  114,
-      114,  114,  893,  890,  891,  891,  891,  114,  892,  891,
-      891,  891,  891,  891,  897,  114,  114,  114,  114,  903,
-      895,  911,  773,  114,  904,  773,  114, 1297,  114,  893,
-
-      905,  912,  114, 1297,  114,  892,  906,  114,  907,  913,
-      114,  897,  114,  114,  114,  114,  903, 1297,  911,  114,
-      114,  904,  908,  114,  898,  114,  899,  905,  900,  114,
-      114,  114,  909,  906,  114,  907,  901,  114,  114,  902,
-      910,  114,  919,  922,  915,  914,  114, 1297, 1297,  908,
-      920,  898,  916,  899,  114,  900,  114,  114,  114,  909,
-     1297, 1297,  114,  901,  923,  114,  902,  910,  114,  114,
-      922,  924,  914,  927,  917,  925,  921,  114,  925,  928,
-      929,  114,  114,  114,  930, 1297,  114,  918,  114,  114,
-     1297,  923,  931, 1297, 1297, 1297,  114,  114,  924, 1297,
-
-      927,  917, 1297,  921,  114,  938,  928,  929,  114,  114,
-      114,  930,  932,  114,  918,  114,  114, 1297,  933,  931,
-     1297,  114,  926,  939,  114,  114,  935,  114,  114,  936,
-      114,  937,  938,  934,  941,  114,  940,  114,  114,  932,
-      114,  114,  944,  114,  942,  933,  943,  114,  114,  926,
-      939,  114,  114,  935,  114,  114,  936,  114,  937,  114,
-      114,  941,  114,  940,  945,  114,  946,  114,  114,  944,
-      947,  942,  948,  943,  114,  116, 1297,  114,  114,  950,
-      114,  114,  114,  114,  953,  114,  114,  114,  104,  114,
-      951,  945,  954,  946,  114,  114,  114,  947, 1297,  948,
-
-      952,  955,  114,  949,  114,  959,  950,  114,  114,  114,
-      114,  953,  114,  114,  114,  114,  956,  951,  114,  954,
-      957,  114,  114,  114,  114,  958,  961,  952,  955,  114,
-      949,  960,  959,  962, 1297,  114,  963,  964, 1297,  114,
-      114,  114,  114,  956,  966,  114, 1297,  957,  114,  114,
-      114,  114,  958,  961,  114,  965,  967,  114,  960,  114,
-      962,  114,  114,  963,  964,  968,  114,  969,  973, 1297,
-      970,  966,  114,  114,  116,  114,  114,  114,  974,  972,
-      975,  114,  965,  967,  114,  114,  114,  104,  114,  116,
-      114,  114,  968,  114,  969,  973,  114,  970,  978,  114,
-
-      114,  971,  104, 1297,  977,  974,  972,  975,  114,  979,
-      980,  988,  114,  114,  114,  981,  114,  114,  114,  982,
-      114, 1297,  976,  114,  114,  978,  983, 1297,  971,  114,
-      987,  977, 1297,  114,  990,  114,  979,  980,  988,  114,
-      114,  114,  981,  114,  993,  863,  982,  863,  863,  976,
-      864,  114,  986,  983,  986,  986,  114,  987,  114,  989,
-      114,  990, 1297,  114,  114,  992,  114,  116,  114,  991,
-      984,  993,  114,  114,  114,  114,  114,  995,  994,  996,
-      104,  114, 1297,  998,  997,  114,  989,  114, 1000,  985,
-      114,  114,  992,  114,  114,  114,  991,  114,  114,  114,
-
-      114,  114,  114,  114,  995,  994,  996,  114,  114,  999,
-      998,  997, 1001,  114,  114, 1000,  985,  114,  114, 1297,
-      114,  114, 1297, 1297,  114,  114,  114, 1004, 1002, 1003,
-      114, 1003, 1003,  114,  114,  114,  999,  114,  116, 1001,
-      114,  891,  891,  891,  114,  114,  891,  891,  891,  891,
-      891,  104, 1006,  114, 1004, 1002, 1007,  114, 1008, 1009,
-      114, 1010,  114, 1011,  114, 1013, 1012, 1014,  114,  114,
-     1005,  114, 1017,  114, 1015, 1018, 1016,  114,  114, 1006,
-     1019, 1021, 1022, 1007,  114, 1008, 1009, 1297, 1010,  114,
-     1011,  114, 1013, 1012, 1014,  114,  114, 1005,  114, 1017,
-
-      114, 1015, 1018, 1016,  114,  114,  912, 1019, 1021, 1022,
-     1023,  114, 1024,  114,  913, 1027,  114,  925,  114,  925,
-      925,  114,  925,  114, 1297,  114,  114, 1026,  114,  659,
-     1297,  659,  659, 1297,  660, 1297,  114, 1023, 1297, 1024,
-      114,  114, 1027, 1029, 1028,  114, 1031, 1033,  114,  114,
-      114, 1020,  114,  114, 1026,  114, 1032,  114,  933,  114,
-     1025,  114,  114,  114, 1034,  114, 1035, 1037,  114,  114,
-     1029, 1028,  114, 1031, 1033,  114,  114,  114, 1020,  114,
-      114,  114,  116, 1032,  114, 1036,  114, 1025,  114,  114,
-     1038, 1034,  114, 1035, 1037,  104,  114, 1039,  114,  114,
-
-     1040, 1044,  114, 1042,  114, 1043,  114,  114,  114, 1045,
-     1046, 1047, 1036, 1041,  114,  114,  114,  114,  114, 1048,
-     1049, 1297,  114,  114,  114,  114,  114, 1040, 1044,  114,
-     1042,  114, 1043,  114,  114,  114, 1045, 1046, 1051, 1054,
-     1041,  114,  114,  114,  114,  114, 1048, 1049, 1050,  114,
-      114,  114,  114, 1053,  114, 1052,  114, 1056,  114, 1059,
-      114,  114,  114,  114,  114, 1051,  114, 1055, 1297,  114,
-      116,  114,  114, 1060, 1061, 1050,  116, 1297,  114,  114,
-     1053,  114, 1052,  104, 1056, 1058, 1059, 1063, 1297,  104,
-      114,  114,  114,  114, 1055, 1057,  114, 1064,  114,  114,
-
-     1060, 1061, 1065,  114, 1062,  114, 1297,  114, 1066, 1071,
-     1066, 1066, 1058, 1067, 1063,  114,  114, 1072, 1073,  114,
-     1075, 1076, 1057,  114, 1064, 1297,  114, 1078, 1297, 1065,
-      114, 1062, 1074, 1068,  114,  114, 1071,  114, 1077,  114,
-     1297, 1080,  114,  114, 1072, 1073,  114, 1075, 1076,  114,
-      114,  114, 1069,  114,  114, 1070, 1079,  114, 1082, 1074,
-     1081, 1086,  114,  114,  114, 1077,  114, 1083, 1080,  114,
-      114, 1090, 1084,  114,  114,  114,  114, 1088,  114, 1069,
-     1085,  114, 1070, 1079,  114, 1082, 1091, 1081, 1086,  114,
-      114, 1094,  116,  114, 1083, 1297,  114,  114, 1090, 1084,
-
-     1297,  114,  114, 1297, 1088,  104, 1095, 1085, 1092, 1003,
-     1096, 1003, 1003, 1091, 1093,  114,  114,  114, 1094, 1099,
-      114, 1087, 1087, 1087,  114, 1089, 1087, 1087, 1087, 1087,
-     1087, 1097,  114, 1095, 1098, 1092, 1100, 1096, 1102, 1103,
-      114, 1093,  114, 1105,  114,  114, 1099, 1101, 1104, 1106,
-      114,  114, 1089,  114,  114,  485, 1108, 1107, 1097,  114,
-      114, 1098,  114, 1100, 1297, 1102, 1103,  114,  114,  114,
-     1105,  114,  114, 1109, 1101, 1110, 1106,  114,  114,  114,
-      114,  114,  114, 1108, 1107,  114, 1111,  114,  114,  114,
-      116,  114,  114, 1117,  486,  114,  114, 1116,  114,  114,
-
-     1109,  114, 1110,  104,  114,  114,  114,  114, 1120,  114,
-      114,  114,  114, 1111,  114,  114, 1115, 1122,  114,  114,
-     1117,  486, 1121,  114, 1116,  114,  114,  116,  114,  116,
-      114,  114,  114,  114,  114, 1120,  114,  114,  114, 1125,
-      104,  114,  104, 1115, 1122,  114, 1127,  114, 1132, 1121,
-      114, 1297,  114,  114, 1297,  114, 1123,  114,  114,  114,
-      114, 1128, 1131,  114, 1131, 1131, 1125, 1124, 1134, 1297,
-      114, 1133,  114, 1127,  114, 1132, 1066,  116, 1066, 1066,
-      114, 1067,  114, 1123,  114,  114, 1137, 1135, 1128, 1136,
-      104, 1138, 1139, 1297, 1124, 1134,  114,  114, 1133,  114,
-
-      114, 1129, 1143, 1142,  114,  114, 1144, 1146, 1145,  114,
-      114,  114, 1297, 1137, 1135, 1297, 1136,  114, 1138, 1139,
-     1130,  114,  114,  114, 1147,  116,  114,  114, 1151, 1143,
-     1142,  114,  114, 1144, 1146, 1145,  114,  114,  104, 1150,
-     1148, 1149, 1148, 1148,  114, 1152, 1153, 1130,  114,  114,
-     1154, 1147, 1087, 1087, 1087, 1151,  114, 1087, 1087, 1087,
-     1087, 1087, 1155, 1156, 1158, 1159, 1150, 1157, 1149,  114,
-      114, 1162, 1152, 1153, 1160,  114,  114, 1154, 1161, 1163,
-     1104, 1297, 1164,  114, 1168, 1297,  114,  485,  114, 1155,
-     1156, 1158, 1159,  114, 1157, 1166,  114,  114, 1162, 1297,
-
-     1167, 1160,  114,  114, 1169, 1161, 1163, 1179,  114, 1164,
-     1170, 1168,  114,  114, 1182,  114,  114, 1175,  114, 1297,
-      114, 1183, 1166,  116, 1171, 1176,  639, 1167, 1297,  114,
-     1180, 1169, 1172,  116, 1179,  114,  104, 1170,  114,  114,
-     1187, 1182, 1173,  114,  114,  114,  104, 1178, 1183, 1188,
-     1189, 1184,  114,  639,  114, 1177,  114, 1180, 1131, 1191,
-     1131, 1131, 1174, 1190, 1193,  114,  114, 1187,  114, 1194,
-     1131,  114, 1131, 1131, 1178, 1067, 1188, 1189, 1184,  114,
-     1195,  114, 1177,  114,  114, 1192, 1191,  114, 1197, 1174,
-     1190, 1193,  114,  114, 1198,  114, 1194,  114,  114,  114,
-
-     1202, 1203, 1204, 1200, 1297, 1297, 1297, 1195, 1205, 1206,
-      114,  114, 1192, 1297,  114, 1197,  114, 1207,  116,  114,
-     1148, 1198, 1148, 1148,  114,  114,  114, 1202, 1203, 1204,
-     1200,  104, 1199, 1199, 1199, 1205, 1206, 1199, 1199, 1199,
-     1199, 1199,  114,  114, 1207, 1208, 1209,  114,  114, 1210,
-      114, 1201, 1211, 1212,  114,  114,  114, 1213,  114, 1171,
-     1214,  114, 1217, 1175,  114,  114,  114, 1172, 1215,  114,
-     1172, 1176, 1208, 1209,  114,  114, 1210,  114, 1201, 1211,
-     1212,  114,  114,  114, 1213,  114, 1219,  114,  114,  116,
-      114,  114,  114,  114, 1176, 1297, 1218, 1174, 1216,  114,
-
-     1224, 1177,  104, 1297, 1297,  116, 1297, 1225, 1226,  114,
-     1227,  114, 1228, 1229,  114,  114, 1230,  114,  104,  114,
-     1220,  114, 1221, 1218, 1174, 1216,  114, 1224, 1177,  114,
-     1222, 1223,  116, 1234, 1225, 1226,  114, 1227,  114, 1228,
-     1229, 1236,  114, 1230,  114,  104,  114, 1220,  114, 1221,
-     1232, 1231, 1232, 1232, 1237, 1233,  114, 1222, 1238, 1233,
-     1234, 1239, 1240, 1241, 1243,  114, 1235, 1242, 1236,  114,
-      114,  114, 1244, 1245, 1246, 1214, 1247, 1249, 1231,  114,
-     1250, 1237,  114, 1215, 1215, 1238, 1297, 1254, 1239, 1240,
-     1241, 1243,  114, 1235, 1242,  116,  114,  114, 1255, 1244,
-
-     1245, 1246, 1256,  114, 1249, 1253,  114, 1250,  104,  114,
-     1248, 1257, 1258, 1216, 1254,  114,  114, 1251, 1297, 1297,
-     1297, 1259, 1297, 1259, 1259, 1255,  742, 1297, 1262, 1256,
-      114,  114, 1253, 1260, 1263, 1264,  116, 1248, 1257, 1258,
-     1216, 1297,  114,  114, 1251, 1232,  743, 1232, 1232,  104,
-     1233, 1265,  114, 1266, 1233, 1262,  114,  114,  114, 1267,
-     1260, 1263, 1264, 1268, 1269,  114,  114,  114, 1261,  116,
-     1271, 1272,  114, 1273, 1297, 1276, 1297, 1297, 1265,  114,
-     1266, 1297,  104,  114,  114, 1270, 1267, 1297,  114, 1297,
-     1268, 1269,  114,  114,  114, 1261, 1277, 1271, 1272,  114,
-
-     1273, 1274, 1276, 1274, 1274, 1259,  864, 1259, 1259, 1297,
-      742, 1259, 1270, 1259, 1259,  114,  742,  114, 1275,  114,
-      116, 1282,  114, 1277, 1280, 1297,  865,  114, 1297, 1283,
-      870, 1297, 1285,  104,  114, 1274,  870, 1274, 1274, 1286,
-      864,  114, 1297, 1287,  114, 1275,  114,  114, 1282,  114,
-     1274, 1280, 1274, 1274,  114,  864, 1283, 1284, 1281, 1285,
-      984,  114, 1288, 1289, 1288, 1288, 1286, 1067,  114,  114,
-     1287, 1290,  114, 1294,  114,  984, 1288, 1291, 1288, 1288,
-     1292, 1067,  114, 1297, 1284, 1281, 1288, 1068, 1288, 1288,
-     1289, 1067,  114,  114,  114, 1293,  114,  114, 1290,  114,
-
-     1294, 1129, 1295, 1297, 1291,  114, 1296, 1292,  114,  114,
-      114, 1129, 1297, 1297, 1297, 1297, 1297, 1297, 1297,  114,
-      114,  114, 1293, 1297,  114, 1297, 1297, 1297, 1297, 1295,
-     1297, 1297,  114, 1296, 1297,  114, 1297,  114,   54,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   54,   62,   62,   62,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
-       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
-       67,   67,   67,   67,   67,   67,   69,   69,   69,   69,
-       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
-
-       69,   69,   81,   81,   81,   81,   81,   81,   81,   81,
-       81,   81,   81,   81,   81,   81,   81,   81,   83,   83,
-       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
-       83,   83,   83,   83,   87,   87,   87,   87,   87,   87,
-       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
-       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
-       93,   93,   93,   93,   93,   93,   98,   98,   98,   98,
-       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
-       98,   98,  102,  102, 1297,  102, 1297,  102, 1297,  102,
-      102,  105,  105,  105,  105,  105,  105,  105,  105,  105,
-
-      105,  105,  105,  105,  105,  105,  105,  108,  108, 1297,
-      108, 1297,  108, 1297,  108,  108,  114,  114, 1297,  114,
-     1297,  114,  114,  114,  114,  228, 1297, 1297,  228, 1297,
-     1297,  228,  228,  228,  228,  228,  228,  228,  228,  228,
-      228,  231,  231,  231,  231,  231,  231,  231,  231,  231,
-      231,  231,  231,  231,  231,  231,  231,  234,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  234,  234,  243,  243, 1297,  243, 1297,  243, 1297,
-      243,  246,  246, 1297,  246, 1297,  246, 1297,  246,  247,
-      247, 1297,  247, 1297,  247, 1297,  247,  248,  248, 1297,
-
-      248, 1297,  248, 1297,  248,  249,  249,  249,  249, 1297,
-      249,  249,  249,  249,  249,  249,  249,  249,  249,  249,
-      249,  250,  250,  250,  250, 1297,  250,  250,  250,  250,
-      250,  250,  250,  250,  250, 1297,  250,  256,  256,  256,
-      256, 1297,  256,  256,  256,  256,  256,  256,  256,  256,
-      256,  256,  256,  259,  259,  259,  259, 1297,  259,  259,
-      259,  259,  259,  259,  259,  259,  259,  259,  259,  262,
-      262,  262,  262, 1297,  262,  262,  262,  262,  262,  262,
-      262,  262,  262, 1297,  262,  264,  264,  264,  264, 1297,
-      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
-
-      264,  252,  252, 1297, 1297, 1297,  252, 1297,  252,  252,
-      252,  252, 1297, 1297, 1297,  252,  252,  267,  267, 1297,
-      267, 1297,  267, 1297,  267,  268,  268, 1297,  268, 1297,
-      268, 1297,  268,  269,  269, 1297,  269, 1297,  269, 1297,
-      269,  274, 1297, 1297, 1297, 1297,  274,  274,  274,  274,
-      274,  274,  274,  274,  274,  274,  274,  276,  276, 1297,
-     1297,  276,  276,  276,  276,  276,  276,  276,  276,  276,
-      276,  276,  276,  278,  278, 1297, 1297,  278,  278,  278,
-      278,  278,  278,  278,  278,  278,  278,  278,  278,   93,
-       93,   93,   93,   93,   93,   93,   93,   93,   93,   93,
-
-       93,   93,   93,   93,   93,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-      280,   96,   96,   96,   96,   96,   96,   96,   96,   96,
-       96,   96,   96,   96,   96,   96,   96,   98,   98,   98,
-       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
-       98,   98,   98,  283,  283,  283,  283,  283,  283,  283,
-      283,  283,  283,  283,  283,  283,  283,  283,  283,  285,
-      285,  285,  285,  285,  285,  285,  285,  285,  285,  285,
-      285,  285,  285,  285,  285,  102,  102, 1297,  102, 1297,
-      102, 1297,  102,  102,  287,  287, 1297,  287, 1297,  287,
-
-     1297,  287,  287,  288,  288, 1297,  288, 1297,  288, 1297,
-      288,  105,  105,  105,  105,  105,  105,  105,  105,  105,
-      105,  105,  105,  105,  105,  105,  105,  289,  289,  289,
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  289,  289,  108,  108, 1297,  108, 1297,  108, 1297,
-      108,  108,  291,  291, 1297,  291, 1297,  291, 1297,  291,
-      291,  110,  110, 1297,  110, 1297,  110, 1297,  110,  110,
-      292,  292, 1297,  292, 1297,  292, 1297,  292,  292,  114,
-      114, 1297,  114, 1297,  114,  114,  114,  114,  228, 1297,
-     1297,  228, 1297, 1297,  228,  228,  228,  228,  228,  228,
-
-      228,  228,  228,  228,  231,  231,  231,  231,  231,  231,
-      231,  231,  231,  231,  231,  231,  231,  231,  231,  231,
-      232,  232,  232,  232,  232,  232,  232,  232,  232,  232,
-      232,  232,  232,  232,  232,  232,  234,  234,  234,  234,
-      234,  234,  234,  234,  234,  234,  234,  234,  234,  234,
-      234,  234,  243,  243, 1297,  243, 1297,  243, 1297,  243,
-      246,  246,  246, 1297,  246, 1297,  246, 1297,  246,  247,
-      247, 1297,  247, 1297,  247, 1297,  247,  248,  248,  248,
-      248, 1297,  248, 1297,  248,  249,  249,  249,  249, 1297,
-      249,  249,  249,  249,  249,  249,  249,  249,  249,  249,
-
-      249,  250,  250,  250,  250, 1297,  250,  250,  250,  250,
-      250,  250,  250,  250,  250, 1297,  250,  453,  453,  453,
-      453, 1297,  453,  453,  453,  453,  453,  453,  453, 1297,
-      453, 1297,  453,  252,  252, 1297, 1297, 1297,  252, 1297,
-      252,  252,  252,  252, 1297, 1297, 1297,  252,  252,  256,
-      256,  256,  256, 1297,  256,  256,  256,  256,  256,  256,
-      256,  256,  256,  256,  256,  454,  454,  454,  454, 1297,
-      454,  454,  454,  454,  454,  454,  454,  454,  454,  454,
-      454,  258,  258, 1297, 1297, 1297,  258,  258,  258,  258,
-      258,  258,  258,  258,  258,  258,  258,  259,  259,  259,
-
-      259, 1297,  259,  259,  259,  259,  259,  259,  259,  259,
-      259,  259,  259,  455,  455,  455,  455, 1297,  455,  455,
-      455,  455,  455,  455,  455,  455,  455,  455,  455,  261,
-      261, 1297, 1297, 1297,  261, 1297,  261,  261,  261,  261,
-      261,  261, 1297,  261,  261,  262,  262,  262,  262, 1297,
-      262,  262,  262,  262,  262,  262,  262,  262,  262,  262,
-      262,  264,  264,  264,  264, 1297,  264,  264,  264,  264,
-      264,  264,  264,  264,  264,  264,  264,  457,  457,  457,
-      457, 1297,  457,  457,  457,  457,  457,  457,  457,  457,
-      457,  457,  457,  266,  266, 1297, 1297, 1297,  266, 1297,
-
-      266,  266,  266,  266,  266,  266,  266,  266,  266,  267,
-      267,  267, 1297,  267, 1297,  267, 1297,  267,  268,  268,
-     1297,  268, 1297,  268, 1297,  268,  269,  269,  269,  269,
-     1297,  269, 1297,  269,  274, 1297, 1297, 1297, 1297,  274,
+       28,   28,   28,   28,   28,   18,   19,   29,   30,   31,
+       24,   18,   32,   33,   34,   35,   36,   37,   38,   39,
+       40,   41,   42,   43,   44,   45,   46,   47,   41,   48,
+       49,   50,   51,   41,   52,   53,   41,   41,   54,   18,
+       55,   56,   57,   58,   56,   55,   59,   55,   55,   55,
+       60,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       61,   62,   61,   61,   18,   18,   63,   63,   18,   18,
+       64,   64,   63,   64,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   93,   64,   63,   63,   63,   63,
+      116,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   65,   66,
+       65,   65,  234,   67,   68,   68,   98,   69,   18,   18,
+       68,   18,   68,   68,   68,   68,   68,   68,   68,   68,
+
+       68,   68,   94,   18,   68,   68,   68,   68,  106,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   70,   71,   72,   73,
+       74,   70,   70,   75,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   76,   70,   70,   70,   70,   70,   70,
+       70,   77,   70,   70,   70,   70,   78,   79,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   18,   80,   18,   18,
+
+      305,   81,   82,   82,  236,   83,  236,  236,   82,  306,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+      307,  310,   82,   82,   82,   82,  311,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   84,   85,  312,   85,   85,   84,
+       86,   84,   84,   84,   86,   84,   84,   84,   84,   84,
+       84,   84,   87,   87,   87,   87,   87,   87,   87,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   88,   89,  315,   80,   89,   88,
+       90,   88,   88,   88,   91,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   92,  170,   92,   92,  171,  173,
+      174,  232,  172,  187,   92,   92,  316,   92,  175,  233,
+      176,  317,  188,  189,  236,  177,  237,  236,  190,   92,
+
+       94,   94,   94,   94,   94,   94,   95,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   96,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       97,   97,   98,   97,   97,   97,   97,   99,   99,   97,
+       97,   97,   97,   99,   97,   99,  100,   99,   99,   99,
+       99,   99,   99,   99,   99,   97,   97,   99,   99,   99,
+       99,  101,   99,   99,   99,   99,   99,   99,   99,   99,
+
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,  102,   97,
+      103,  103,  252,  318,  252,  252,  103,  319,  103,  104,
+      103,  103,  103,  103,  103,  103,  103,  103,  329,  332,
+      103,  103,  103,  103,  105,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  103,  103,  103,  103,  103,  103,  103,
+      103,  103,  106,  106,  106,  106,  106,  106,  106,  106,
+      106,  106,  107,  106,  106,  106,  106,  106,  106,  108,
+      106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+
+      106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+      106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+      106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
+      106,  106,  109,  109,  260,  339,  261,  262,  109,  340,
+      109,  110,  109,  109,  109,  109,  109,  109,  109,  109,
+      341,  342,  109,  109,  109,  109,  343,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  109,  111,  111,  261,  344,  261,  262,
+      111,  345,  111,  112,  111,  113,  113,  113,  113,  113,
+
+      113,  113,  114,  346,  111,  111,  111,  111,  347,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  111,  117,  330,  115,  115,
+      115,  115,  115,  115,  115,  117,  356,  115,  115,  115,
+      115,  115,  115,  115,  118,  119,  262,  331,  262,  262,
+      196,  126,  357,  120,  197,  121,  198,  122,  199,  123,
+      124,  358,  115,  125,  200,  201,  129,  202,  130,  131,
+      137,  127,  359,  132,  138,  128,  133,  134,  139,  135,
+      115,  362,  115,  140,  141,  115,  136,  143,  282,  320,
+
+      115,  282,  142,  321,  115,  308,  144,  322,  145,  149,
+      115,  146,  309,  366,  115,  115,  147,  150,  148,  115,
+      313,  369,  314,  151,  115,  155,  152,  153,  154,  115,
+      191,  160,  156,  115,  360,  370,  192,  361,  193,  157,
+      327,  158,  194,  159,  115,  161,  195,  328,  115,  363,
+      162,  115,  351,  364,  115,  115,  163,  164,  352,  165,
+      166,  178,  179,  365,  180,  181,  167,  168,  277,  182,
+      277,  277,  169,  183,  115,  184,  371,  203,  115,  185,
+      204,  205,  336,  207,  372,  186,  208,  209,  337,  333,
+      210,  211,  338,  373,  212,  206,  379,  213,  214,  215,
+
+      218,  216,  219,  217,  334,  226,  380,  220,  221,  335,
+      227,  222,  381,  223,  224,  228,  382,  229,  235,  230,
+      231,  235,  383,  235,  225,  235,  235,  235,  235,  235,
+      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
+      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
+      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
+      235,  235,  235,  235,  235,  235,  235,  235,  235,  235,
+      235,  235,  235,  235,  235,  235,  235,  235,  238,  239,
+      239,  238,  239,  238,  239,  238,  238,  238,  240,  238,
+      238,  238,  238,  238,  238,  238,  238,  238,  238,  238,
+
+      238,  238,  238,  238,  238,  238,  238,  238,  238,  238,
+      238,  238,  238,  238,  238,  238,  238,  238,  238,  238,
+      238,  238,  238,  238,  238,  238,  238,  238,  238,  238,
+      238,  238,  238,  238,  238,  238,  238,  238,  241,  242,
+      243,  242,  242,  241,  241,  241,  241,  241,  241,  244,
+      244,  241,  245,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  244,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  241,  241,
+      241,  241,  241,  241,  241,  241,  241,  241,  246,  247,
+
+      246,  246,  390,  396,  250,  250,  397,  398,  248,  248,
+      250,  249,  250,  250,  250,  250,  250,  250,  250,  250,
+      250,  250,  384,  248,  250,  250,  250,  250,  385,  250,
+      250,  250,  250,  250,  250,  250,  250,  250,  250,  250,
+      250,  250,  250,  250,  250,  250,  250,  250,  250,  250,
+      250,  250,  250,  250,  250,  250,  245,  251,  245,  245,
+      399,  400,  253,  253,  404,  405,  245,  245,  253,  245,
+      253,  253,  253,  253,  253,  253,  253,  253,  253,  253,
+      406,  245,  253,  253,  253,  253,  407,  253,  253,  253,
+      253,  253,  253,  253,  253,  253,  253,  253,  253,  253,
+
+      253,  253,  253,  253,  253,  253,  253,  253,  253,  253,
+      253,  253,  253,  253,  254,  254,  367,  394,  368,  395,
+      254,  412,  254,  254,  254,  254,  254,  254,  254,  254,
+      254,  254,  408,  409,  254,  254,  254,  254,  413,  254,
+      254,  254,  254,  254,  254,  254,  254,  254,  254,  254,
+      254,  254,  254,  254,  254,  254,  254,  254,  254,  254,
+      254,  254,  254,  254,  254,  254,  255,  255,  410,  417,
+      420,  401,  255,  411,  255,  255,  255,  255,  255,  255,
+      255,  255,  255,  255,  402,  421,  255,  255,  255,  255,
+      403,  255,  255,  255,  255,  255,  255,  255,  255,  255,
+
+      255,  255,  255,  255,  255,  255,  255,  255,  255,  255,
+      255,  255,  255,  255,  255,  255,  255,  255,  256,  256,
+      257,  257,  431,  256,  256,  257,  256,  256,  256,  256,
+      256,  256,  256,  256,  256,  257,  256,  256,  256,  256,
+      256,  256,  256,  258,  256,  256,  256,  256,  257,  259,
+      256,  256,  256,  256,  256,  256,  256,  256,  256,  256,
+      256,  256,  256,  256,  256,  256,  256,  256,  256,  256,
+      256,  256,  256,  256,  256,  256,  256,  256,  257,  257,
+      436,  440,  441,  257,  257,  418,  257,  257,  257,  257,
+      257,  257,  257,  257,  257,  419,  257,  257,  257,  257,
+
+      257,  257,  257,  442,  257,  257,  257,  257,  450, 1485,
+      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
+      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
+      257,  257,  257,  257,  257,  257,  257,  257,  263,  263,
+      451,  452,  453,  263,  263,  263,  263,  263,  263,  263,
+      263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+      263,  263,  263,  264,  263,  263,  263,  263,  263,  265,
+      263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+      263,  263,  263,  263,  263,  263,  263,  263,  263,  263,
+      263,  263,  263,  263,  263,  263,  263,  263,  266,  266,
+
+      456,  443,  457,  266,  266,  444,  266,  266,  266,  266,
+      266,  266,  266,  266,  266,  266,  266,  266,  266,  266,
+      266,  266,  266,  267,  266,  266,  266,  266,  458,  268,
+      266,  266,  266,  266,  266,  266,  266,  266,  266,  266,
+      266,  266,  266,  266,  266,  266,  266,  266,  266,  266,
+      266,  266,  266,  266,  266,  266,  266,  266,  269,  269,
+      269,  269,  459,  269,  269,  269,  269,  269,  269,  269,
+      269,  269,  269,  269,  269,  269,  270,  270,  270,  270,
+      270,  270,  270,  269,  269,  269,  269,  269,  269,  460,
+      269,  269,  269,  269,  269,  269,  269,  269,  269,  269,
+
+      269,  269,  269,  269,  269,  269,  269,  269,  269,  269,
+      269,  269,  269,  269,  269,  269,  269,  269,  271,  271,
+      461,  454,  462,  271,  271,  455,  271,  271,  271,  271,
+      271,  271,  271,  271,  271,  271,  271,  271,  271,  271,
+      271,  271,  271,  272,  271,  271,  271,  271,  271,  273,
+      271,  271,  271,  271,  271,  271,  271,  271,  271,  271,
+      271,  271,  271,  271,  271,  271,  271,  271,  271,  271,
+      271,  271,  271,  271,  271,  271,  271,  271,  259,  259,
+      465,  445,  466,  259,  259,  472,  259,  259,  259,  259,
+      259,  259,  259,  259,  259,  446,  259,  259,  259,  259,
+
+      259,  259,  259,  473,  259,  259,  259,  259,  475,  259,
+      259,  259,  259,  259,  259,  259,  259,  259,  259,  259,
+      259,  259,  259,  259,  259,  259,  259,  259,  259,  259,
+      259,  259,  259,  259,  259,  259,  259,  259,  274,  274,
+      414,  463,  415,  416,  274,  464,  274,  274,  274,  274,
+      274,  274,  274,  274,  274,  274,  476,  480,  274,  274,
+      274,  274,  482,  274,  274,  274,  274,  274,  274,  274,
       274,  274,  274,  274,  274,  274,  274,  274,  274,  274,
-      276,  276, 1297, 1297,  276,  276,  276,  276,  276,  276,
-      276,  276,  276,  276,  276,  276,  277,  277, 1297, 1297,
-      277,  277,  277,  277,  277,  277,  277,  277,  277,  277,
-      277,  277,  278,  278, 1297, 1297,  278,  278,  278,  278,
-      278,  278,  278,  278,  278,  278,  278,  278,  279,  279,
-
-     1297, 1297,  279,  279,  279,  279,  279,  279,  279,  279,
-      279,  279,  279,  279,  280,  280,  280,  280,  280,  280,
-      280,  280,  280,  280,  280,  280,  280,  280,  280,  280,
-       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
-       96,   96,   96,   96,   96,   96,  283,  283,  283,  283,
+      274,  274,  274,  274,  274,  274,  274,  274,  274,  274,
+      275,  275,  483,  485,  487,  489,  275,  490,  275,  275,
+
+      275,  275,  275,  275,  275,  275,  275,  275,  491,  492,
+      275,  275,  275,  275,  493,  275,  275,  275,  275,  275,
+      275,  275,  275,  275,  275,  275,  275,  275,  275,  275,
+      275,  275,  275,  275,  275,  275,  275,  275,  275,  275,
+      275,  275,  276,  276,  484,  494,  484,  484,  276,  495,
+      276,  276,  276,  276,  276,  276,  276,  276,  276,  276,
+      496,  497,  276,  276,  276,  276,  498,  276,  276,  276,
+      276,  276,  276,  276,  276,  276,  276,  276,  276,  276,
+      276,  276,  276,  276,  276,  276,  276,  276,  276,  276,
+      276,  276,  276,  276,  278,  470,  278,  278,  280,  280,
+
+      280,  280,  280,  280,  280,  471,  279,  279,  279,  447,
+      448,  279,  279,  279,  279,  279,  279,  279,  281,  499,
+      449,  500,  501,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  281,  281,  281,  283,  284,
+      502,  503,  284,  283,  504,  283,  283,  283,  283,  283,
+      283,  283,  283,  283,  283,  283,  283,  283,  283,  283,
+
+      283,  283,  283,  283,  283,  283,  283,  283,  283,  283,
       283,  283,  283,  283,  283,  283,  283,  283,  283,  283,
-      283,  283,  285,  285,  285,  285,  285,  285,  285,  285,
+      283,  283,  283,  283,  283,  283,  283,  283,  283,  283,
+      283,  283,  283,  283,  283,  283,  283,  283,  285,  286,
+      505,  506,  286,  285,  285,  285,  285,  285,  510,  285,
+      285,  285,  285,  285,  285,  285,  285,  285,  285,  285,
+      285,  285,  285,  285,  285,  285,  285,  285,  285,  285,
+      285,  285,  285,  285,  285,  285,  285,  285,  285,  285,
+      285,  285,  285,  285,  285,  285,  285,  285,  285,  285,
       285,  285,  285,  285,  285,  285,  285,  285,  287,  287,
-     1297,  287, 1297,  287, 1297,  287,  287,  288,  288, 1297,
-      288, 1297,  288, 1297,  288,  289,  289,  289,  289,  289,
-
-      289,  289,  289,  289,  289,  289,  289,  289,  289,  289,
-      289,  291,  291, 1297,  291, 1297,  291, 1297,  291,  291,
-      292,  292, 1297,  292, 1297,  292, 1297,  292,  292,  114,
-      114, 1297,  114, 1297,  114,  114,  114,  114,  453,  453,
-      453,  453, 1297,  453,  453,  453,  453,  453,  453,  453,
-     1297,  453,  453,  453,  454,  454,  454,  454, 1297,  454,
-      454,  454,  454,  454,  454,  454,  454,  454,  454,  454,
-      455,  455,  455,  455, 1297,  455,  455,  455,  455,  455,
-      455,  455,  455,  455,  455,  455,  457,  457,  457,  457,
-     1297,  457,  457,  457,  457,  457,  457,  457,  457,  457,
-
-      457,  457,  258,  258, 1297, 1297, 1297,  258,  258,  258,
-      258,  258,  258,  258,  258,  258,  258,  258,  261,  261,
-     1297, 1297, 1297,  261, 1297,  261,  261,  261,  261,  261,
-      261, 1297,  261,  261,  266,  266, 1297, 1297, 1297,  266,
-     1297,  266,  266,  266,  266,  266,  266,  266,  266,  266,
-      802, 1297, 1297,  802, 1297,  802,  802, 1297,  802, 1297,
-      802, 1297,  802,  110,  110, 1297,  110, 1297,  110, 1297,
-      110,  110, 1030, 1030, 1297, 1030, 1297, 1030, 1297, 1030,
-     1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118, 1118,
-     1118, 1118, 1118, 1118, 1118, 1140, 1140, 1297, 1140, 1140,
 
+      514,  287,  287,  287,  288,  287,  287,  287,  287,  287,
+      287,  287,  287,  287,  287,  287,  287,  287,  287,  287,
+      287,  287,  287,  287,  287,  287,  287,  287,  287,  287,
+      287,  287,  287,  287,  287,  287,  287,  287,  287,  287,
+      287,  287,  287,  287,  287,  287,  287,  287,  287,  287,
+      287,  287,  287,  287,  287,  287,  287,  287,   97,   97,
+      515,  516,  517,  518,   97,  519,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,  520,  521,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+
+       97,   97,   97,   97,   97,   97,   97,   97,   97,  289,
+      290,  290,  522,  523,  524,  525,  290,  507,  290,  291,
+      290,  290,  290,  290,  290,  290,  290,  290,  508,  526,
+      290,  290,  290,  290,  509,  290,  290,  290,  290,  290,
+      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
+      290,  290,  290,  290,  290,  290,  290,  290,  290,  290,
+      290,  292,  293,  293,  527,  528,  529,  532,  293,  533,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      534,  535,  293,  293,  293,  293,  536,  293,  293,  293,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      293,  293,  293,  294,  295,  295,  537,  530,  538,  539,
+      295,  531,  295,  296,  295,  295,  295,  295,  295,  295,
+      295,  295,  540,  541,  295,  295,  295,  295,  542,  295,
+      295,  295,  295,  295,  295,  295,  295,  295,  295,  295,
+      295,  295,  295,  295,  295,  295,  295,  295,  295,  295,
+      295,  295,  295,  295,  295,  295,  297,  297,  543,  544,
+      545,  546,  297,  547,  297,  297,  297,  297,  297,  297,
+      297,  297,  297,  297,  548,  549,  297,  297,  297,  297,
+      550,  297,  297,  297,  297,  297,  297,  297,  297,  297,
+
+      297,  297,  297,  297,  297,  297,  297,  297,  297,  297,
+      297,  297,  297,  297,  297,  297,  297,  297,  298,  298,
+      551,  298,  298,  298,  298,  298,  298,  298,  299,  298,
+      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
+      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
+      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
+      298,  298,  298,  298,  298,  298,  298,  298,  298,  298,
+      298,  298,  298,  298,  298,  298,  298,  298,  300,  300,
+      552,  553,  554,  555,  300,  556,  300,  301,  300,  300,
+      300,  300,  300,  300,  300,  300,  557,  558,  300,  300,
+
+      300,  300,  559,  300,  300,  300,  300,  300,  300,  300,
+      300,  300,  300,  300,  300,  300,  300,  300,  300,  300,
+      300,  300,  300,  300,  300,  300,  300,  300,  300,  300,
+      111,  111,  111,  111,  111,  111,  111, 1485,  560,  561,
+      562,  563,  566,  567,  111,  111,  111,  111,  111,  111,
+      111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+      111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+      302,  302,  568,  569,  570,  573,  302,  571,  302,  303,
+      302,  304,  304,  304,  304,  304,  304,  304,  564,  572,
+      302,  302,  302,  302,  565,  302,  302,  302,  302,  302,
+
+      302,  302,  302,  302,  302,  302,  302,  302,  302,  302,
+      302,  302,  302,  302,  302,  302,  302,  302,  302,  302,
+      302,  302,  302,  302,  302,  302,  302,  302,  302,  323,
+      348,  574,  353,  324,  349,  386,  354,  325,  355,  374,
+      387,  350,  391,  326,  575,  375,  388,  422,  392,  423,
+      389,  376,  424,  425,  393,  377,  432,  576,  378,  426,
+      437,  577,  427,  428,  578,  429,  430,  433,  579,  438,
+      467,  580,  434,  435,  468,  581,  582,  239,  469,  439,
+      239,  585,  239,  586,  239,  239,  239,  474,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  247,  587,  247,
+      247,  249,  588,  249,  249,  589,  590,  241,  241,  591,
+     1485,  249,  249,  592,  249,  594,  597,  598,  599,  600,
+      583,  603,  241,  593,  604,  605,  249,  477,  477,  477,
+      477,  606,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  584,  477,  477,  477,  477,  477,  607,  477,
+
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  477,  477,  477,  477,  478,  478,  608,
+      609,  610,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  265,  478,  478,  478,  478,  478,  265,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  478,  478,  265,  265,  611,
+      615,  616,  265,  265,  265,  265,  265,  265,  265,  265,
+
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  479,  479,  612,
+      613,  619,  479,  479,  614,  479,  479,  479,  479,  479,
+      479,  479,  479,  479,  479,  479,  479,  479,  479,  479,
+      479,  479,  268,  479,  479,  479,  479,  620,  268,  479,
+      479,  479,  479,  479,  479,  479,  479,  479,  479,  479,
+      479,  479,  479,  479,  479,  479,  479,  479,  479,  479,
+
+      479,  479,  479,  479,  479,  479,  479,  268,  268,  621,
+      622,  617,  268,  268,  618,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  623,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  269,  269,  269,
+      269,  269,  269,  269,  624,  625,  481,  481,  627,  626,
+      480,  481,  481,  628,  481,  481,  481,  481,  481,  481,
+      481,  481,  481,  481,  481,  481,  481,  481,  481,  481,
+
+      481,  273,  481,  481,  481,  481,  481,  273,  481,  481,
+      481,  481,  481,  481,  481,  481,  481,  481,  481,  481,
+      481,  481,  481,  481,  481,  481,  481,  481,  481,  481,
+      481,  481,  481,  481,  481,  481,  273,  273,  631,  633,
+      632,  273,  273,  634,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  284,  635,  636,  639,
+
+      640,  284,  486,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  286,  641,  642,  643,
+      647,  286,  286,  286,  286,  286,  488,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  511,  595,  601,  629,
+      637,  644,  648,  512,  649,  650,  651,  652,  638,  653,
+      654,  602,  655,  656,  596,  657,  658,  659,  660,  661,
+      630,  662,  662,  662,  665,  666,  662,  662,  662,  662,
+      662,  662,  662,  663,  667,  668,  669,  670,  671,  672,
+      664,  673,  674,  675,  513,  676,  679,  677,  645,  680,
+      646,  678,  681,  682,  683,  684,  511,  686,  692,  693,
+      694,  695,  696,  512,  697,  687,  698,  699,  700,  701,
+      702,  703,  704,  705,  706,  709,  706,  706,  710,  707,
+
+      711,  712,  713,  714,  715,  716,  717,  718,  719,  720,
+      721,  723,  724,  688,  725,  726,  722,  727,  728,  729,
+      730,  731,  732,  689,  685,  690,  735,  691,  733,  734,
+      736,  737,  738,  740,  741,  742,  743,  744,  745,  746,
+      747,  748,  749,  750,  751,  708,  752,  753,  583,  755,
+      756,  757,  760,  761,  762,  758,  763,  764,  765,  766,
+      767,  768,  769,  770,  771,  772,  773,  739,  775,  759,
+      776,  777,  778,  779,  780,  781,  783,  784,  785,  786,
+      754,  787,  788,  789,  782,  790,  791,  792,  793,  794,
+      795,  796,  797,  798,  799,  805,  801,  774,  801,  801,
+
+      806,  802,  807,  808,  809,  810,  644,  811,  814,  815,
+      800,  812,  816,  817,  818,  819,  820,  821,  822,  823,
+      824,  826,  827,  803,  827,  827,  825,  828,  829,  830,
+      831,  832,  833,  834,  835,  836,  837,  838,  840,  841,
+      838,  842,  804,  843,  844,  845,  846,  847,  848,  849,
+      850,  852,  854,  813,  851,  855,  853,  856,  857,  858,
+      859,  860,  861,  862,  863,  864,  865,  706,  866,  706,
+      706,  867,  707,  868,  869,  870,  875,  876,  877,  878,
+      879,  880,  881,  879,  882,  883,  839,  884,  885,  886,
+      887,  872,  888,  889,  872,  890,  891,  873,  873,  892,
+
+      893,  894,  895,  873,  871,  873,  873,  874,  873,  873,
+      873,  873,  873,  873,  873,  896,  897,  873,  873,  873,
+      873,  898,  873,  873,  873,  873,  873,  873,  873,  873,
+      873,  873,  873,  873,  873,  873,  873,  873,  873,  873,
+      873,  873,  873,  873,  873,  873,  873,  873,  873,  899,
+      900,  901,  902,  903,  904,  905,  906,  907,  908,  909,
+      910,  911,  912,  913,  914,  915,  916,  917,  918,  919,
+      920,  921,  922,  923,  924,  925,  926,  927,  928,  929,
+      930,  931,  933,  934,  935,  936,  937,  938,  939,  940,
+      941,  942,  943,  944,  949,  944,  944,  950,  945,  801,
+
+      954,  801,  801,  953,  802,  953,  953,  955,  956,  932,
+      957,  958,  959,  960,  961,  962,  963,  964,  965,  967,
+      946,  968,  969,  970,  971,  972,  951,  973,  966,  975,
+      976,  977,  978,  979,  980,  947,  981,  838,  987,  948,
+      838,  974,  974,  974,  988,  952,  974,  974,  974,  974,
+      974,  974,  974,  989,  990,  991,  992,  993,  994,  995,
+      996,  997,  998, 1012,  999, 1013, 1002, 1014, 1005, 1009,
+     1017,  982, 1000,  983, 1003,  984, 1006, 1010, 1015, 1018,
+     1019, 1015, 1020,  985, 1021, 1022,  986,  870, 1024,  873,
+     1485, 1026, 1027, 1485, 1028, 1029, 1001, 1030,  879, 1031,
+
+     1007,  879, 1032, 1033, 1034, 1011, 1035, 1036, 1037, 1038,
+     1039, 1040, 1004, 1008, 1041, 1042, 1023, 1043, 1044, 1045,
+     1025, 1046, 1047, 1048, 1049, 1050, 1051, 1016, 1052, 1053,
+     1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
+     1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073,
+     1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082,  944,
+     1086,  944,  944, 1085,  945, 1085, 1085, 1087, 1088,  953,
+     1089,  953,  953,  802, 1090, 1091, 1092, 1093, 1094, 1095,
+     1096, 1097, 1098, 1099, 1100, 1101, 1083, 1102, 1103, 1104,
+     1105, 1104, 1104, 1106, 1107, 1109, 1110, 1111, 1108, 1112,
+
+     1113, 1114, 1115, 1116, 1117, 1084, 1118, 1119, 1120, 1123,
+     1124, 1125, 1485, 1127, 1485, 1128, 1005, 1129, 1485, 1126,
+     1130, 1131, 1132, 1015, 1006,  115, 1015, 1134, 1135,  115,
+     1136, 1137, 1138, 1139, 1141, 1142, 1143, 1144, 1145, 1146,
+     1147, 1148, 1150, 1151, 1121, 1152, 1153, 1154, 1149, 1155,
+     1140, 1140, 1156, 1157, 1158, 1122, 1140, 1159, 1140, 1140,
+     1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1133, 1160,
+     1140, 1140, 1140, 1140, 1161, 1140, 1140, 1140, 1140, 1140,
+     1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
      1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
-     1186, 1297, 1297, 1186, 1297, 1186, 1186, 1297, 1186, 1297,
-     1186, 1297, 1186, 1199, 1297, 1199, 1199, 1199, 1297, 1297,
-     1199, 1199, 1199, 1252, 1252, 1297, 1252, 1297, 1252, 1297,
-     1252,   17, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297
+
+     1140, 1140, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
+     1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179,
+     1181, 1182, 1183, 1188, 1183, 1183, 1085, 1184, 1085, 1085,
+     1189,  945, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197,
+     1198, 1199, 1200, 1201, 1202, 1203, 1204, 1206, 1207, 1185,
+     1205, 1205, 1205, 1208, 1209, 1205, 1205, 1205, 1205, 1205,
+     1205, 1205, 1212, 1210, 1213, 1214, 1180, 1215, 1186, 1211,
+     1216, 1187, 1217, 1218, 1219, 1120, 1221, 1222, 1223, 1224,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1148, 1237, 1240, 1241, 1242, 1245, 1246, 1149,
+
+     1247, 1248, 1249, 1250, 1251, 1253, 1254, 1255, 1238, 1256,
+     1257, 1252, 1239, 1259, 1264, 1265, 1264, 1264, 1266, 1267,
+     1268, 1269, 1220, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1244, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1179, 1260, 1270, 1183, 1271, 1183, 1183, 1272,
+     1184, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1281,
+
+     1281, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1291, 1292,
+     1293, 1290, 1262, 1294, 1295, 1296, 1297, 1298, 1227, 1299,
+     1300, 1485, 1301, 1302, 1303, 1304, 1302, 1305, 1308, 1258,
+     1261, 1263, 1273, 1273, 1309, 1273, 1273, 1273, 1273, 1273,
+     1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1274,
+     1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273,
+     1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273,
+     1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273,
+     1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273, 1273,
+     1273, 1306, 1310, 1311, 1315, 1318, 1319, 1320, 1243, 1321,
+
+     1322, 1312, 1316, 1323, 1324, 1325, 1326, 1251, 1333, 1327,
+     1334, 1335, 1313, 1336, 1252, 1338, 1264, 1260, 1264, 1264,
+     1339, 1184, 1340, 1341, 1342, 1343, 1344, 1345, 1273, 1346,
+     1347, 1348, 1350, 1314, 1317, 1351, 1352, 1353, 1307, 1328,
+     1331, 1354, 1355, 1331, 1356, 1329, 1332, 1332, 1357, 1330,
+     1358, 1359, 1332, 1360, 1332, 1332, 1332, 1332, 1332, 1332,
+     1332, 1332, 1332, 1332, 1337, 1361, 1332, 1332, 1332, 1332,
+     1362, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332,
+     1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332,
+     1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1349, 1349,
+
+     1349, 1363, 1364, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
+     1365, 1306, 1367, 1368, 1369, 1485, 1370, 1373, 1375, 1377,
+     1378, 1379, 1380, 1381, 1371, 1312, 1316, 1382, 1384, 1485,
+     1385, 1386, 1485, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
+     1394, 1395, 1396, 1398, 1396, 1396, 1399, 1397, 1400, 1401,
+     1402, 1397, 1403, 1374, 1376, 1404, 1372, 1405, 1366, 1383,
+     1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415,
+     1485, 1417, 1485, 1418, 1419, 1420, 1421, 1371, 1422, 1424,
+     1426, 1425, 1425, 1427, 1428, 1429, 1423, 1425, 1430, 1425,
+     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1431,
+
+     1432, 1425, 1425, 1425, 1425, 1416, 1425, 1425, 1425, 1425,
+     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
+     1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425, 1425,
+     1425, 1425, 1425, 1433, 1434, 1435, 1436, 1435, 1435, 1396,
+     1437, 1396, 1396, 1438, 1397, 1439, 1440, 1441, 1397, 1442,
+     1443, 1444, 1445, 1446, 1447, 1485, 1448, 1449, 1450, 1452,
+     1455, 1456, 1457, 1458, 1460, 1461, 1451, 1453, 1459, 1462,
+     1459, 1459, 1435,  945, 1435, 1435, 1463, 1464, 1465, 1463,
+     1464,  115, 1466, 1467, 1485, 1468, 1469, 1470, 1459, 1471,
+     1459, 1459, 1472, 1473, 1474,  946, 1475, 1476, 1477, 1476,
+
+     1476, 1454, 1184, 1478, 1476, 1479, 1476, 1476, 1480, 1481,
+     1482, 1483, 1484,    0,    0,    0,    0,    0, 1485,    0,
+        0,    0,    0,    0, 1185,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 1485,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     1485,   17, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485
     } ;
 
-static yyconst flex_int16_t yy_chk[6827] =
+static yyconst flex_int16_t yy_chk[4813] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1927,751 +1770,530 @@ static yyconst flex_int16_t yy_chk[6827] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    3,    3,    3,    3,   88,    3,
-       22,   88, 1141,    3,    4,    4,    4,    4,   24,    4,
-
-       96,   22,  123,    4,    5,    5,    5,    5,    5,    5,
-        5,   24, 1119,    5,    5,    5,    5,   26,    5,    9,
-        9,    9,    9, 1078,   26,    9,  107,    5,    5,  123,
-       27,   29,   31,    5,  107,    9,   10,   10,   10,   10,
-     1047,    9,   10,   27,   29,   31,    9,    9,   13,   13,
-       13,   13,   10,   13,   96,  453,   95,   13,   10,   55,
-       95,   55,   55,   10,   10,   13,   13,   13,   13,   13,
-       15,   15,   15,   15,   57,   15,   57,   57,  289,   15,
-       64,   53,   64,   64,  294,  292,  289,    5,    6,    6,
-        6,    6,    6,    6,    6,   53,  291,    6,    6,    6,
-
-        6,  102,    6,  108,   14,   14,   14,   14,   53,   14,
-      125,    6,    6,   14,  102,  287,  108,    6,   41,  126,
-      279,   14,   14,   14,   14,   14,   16,   16,   16,   16,
-       19,   16,   19,   19,   30,   16,  277,  125,   41,  152,
-       19,   19,   41,   19,   30,   41,  126,   30,  275,   59,
-       59,  275,   59,   19,   59,  269,  267,   73,   59,   73,
-       73,   84,  912,   84,   84,   41,  152,   74,   74,   41,
-      912,    6,    7,    7,    7,    7,    7,    7,    7,   39,
-      262,    7,    7,    7,    7,  250,    7,   72,   74,   72,
-       72,  110,  115,   39,   74,    7,    7,   89,   39,   39,
-
-       89,    7,   89,   39,  110,  115,   39,   45,   45,   72,
-       75,   75,  124,  124,  248,   75,   45,   45,   45,  156,
-       39,  282,  127,   45,  127,   39,   39,   69,   69,  280,
-       39,   75,   69,  280,   45,   45,   75,   75,   90,  124,
-      124,   90,   69,   45,   45,   45,  156,   90,   69,  127,
-       45,  127,  246,   69,   69,    7,    8,    8,    8,    8,
-        8,    8,    8,  232,  116,    8,    8,    8,    8,  133,
-        8,   46,  122,   42,   42,  282,   46,   42,  118,    8,
-        8,   42,   52,  159,   46,    8,  133,  122,   46,  162,
-       52,   46,  138,   42,  118,   46,  133,   42,   46,  122,
-
-       42,   42,   52,   46,   42,  118,   52,  138,   42,   52,
-      159,   46,  113,  133,  122,   46,  162,   52,   46,  138,
-       42,  118,   46,  915,   42,   60,   60,   60,   60,   52,
-     1038,  915,  109,   52,  138,   60,   60, 1038,   60,    8,
-       11,   11,   11,   11,   11,   11,   11,  105,   60,   11,
-       11,   11,   11,   48,   11,  121,   48,   48,   76,   76,
-       76,   76,   76,   11,   11,   61,   61,   61,   61,   11,
-      142,   48,  166,   48,  121,   61,   61,   48,   61,  103,
-       48,   93,  121,   48,   48,   77,   77,  139,   61,  142,
-       77,  139,   63,   63,   63,   63,   71,  142,   48,  166,
-
-       48,  121,   63,   63,   48,   63,   77,   86,   86,   86,
-       86,   86,   77,  918,  139,   63,  142,  801,  139,  167,
-      801,  918,  172,   11,   12,   12,   12,   12,   12,   12,
-       12,   21,   17,   12,   12,   12,   12,  119,   12,   70,
-       70,   70,   70, 1104,  119,   70,  167,   12,   12,  172,
-     1104,  808,  119,   12,  808,   70,   85,    0,   85,   85,
-      174,   70,    0,  148,  119,  148,   70,   70,   85,   85,
-       85,  119,    0,   85,   85,   85,   85,   85,   91,  119,
-       91,   91,  111,  111,  111,  111,  111,  174,   91,   91,
-      148,   91,  148,  111,    0,  229,  176,  229,  229,  120,
-
-      230,   91,  230,  230,    0,    0,  183,   12,   23,   23,
-       23,   23,   23,   23,   23,  120,    0,   23,   23,   23,
-       23,  128,   23,  176,   23,  128,  120,  131,  131,  128,
-      129,   23,   23,  183,  129,  140,    0,   23,  129,  130,
-      128,    0,  120,  132,  129,  130,  130,  140,  128,  129,
-      136,  136,  128,  184,  131,  131,  128,  129,  132,  137,
-      137,  129,  140,  132,   23,  129,  130,  128,  141,  141,
-      132,  129,  130,  130,  140,    0,  129,  136,  136,    0,
-      184,  245,  144,  245,  245,  132,  137,  137,  143,  143,
-      132,   23,   28,   28,  149,  141,  141,  144,   28,  149,
-
-       28,   28,   28,   28,   28,   28,   28,   28,   28,  144,
-       28,   28,   28,   28,   28,  143,  143,  187,  147,  154,
-      154,  149,  147,    0,  144,  919,  149,    0,  157,  157,
-      177,  231,  231,  919,  231,  255,  231,  255,  255,  134,
-      231,   28,   32,   32,  187,  147,  154,  154,   32,  147,
-       32,   32,   32,    0,  134,  157,  157,  177,   32,  134,
-       32,   32,   32,   32,   32,  135,  134,   32,   32,  666,
-      151,  135,  666,  150,  151,  135,   32,  189,   32,  135,
-       32,  134,   32,   32,  177,  666,  134,  150,  205,  160,
-     1106,   32,  135, 1106,   32,   32,  160,  151,  135,  161,
-
-      150,  151,  135,   32,  189,   32,  135,   32,    0,   32,
-       32,   33,   33,  161,  150,  205,  160,   33,  218,   33,
-       33,   33,  153,  160,  145,  153,  161,   33,  145,   33,
-       33,   33,   33,   33,   33,  145,  146,  163,  153,  145,
-      161,  278,  146,  163,  278,  218,  158,  158,  158,  153,
-      278,  145,  153,  146,   33,  145,  168,    0,   33,    0,
-       33,   33,  145,  146,  163,  153,  145,  195,  155,  146,
-      163,  168,  155,  158,  158,  158, 1126,  164,  195, 1126,
-      146,   33,  155,  168,  169,   33,   34,  155,  170,  212,
-       34,  212,  169,   34,  195,  155,  164,   34,  168,  155,
-
-       34,   34,  179,   34,  164,  195,   34,  170,  179,  155,
-       34,  169, 1124,   34,  155,  170,  212,   34,  212,  169,
-       34,  171,  171,  164,   34, 1124,  173,   34,   34,  179,
-       34,    0,  173,   34,  170,  179,  180,   34,   35,  175,
-      181,  180,   35,  186,  175,  173,   35,  186,  171,  171,
-      175,   35,   35,  173,  175,  223,  181,  215,   35,  173,
-       35,    0,   35,  180,  215,   35,  175,  181,  180,   35,
-      186,  175,  173,   35,  186,    0,    0,  175,   35,   35,
-        0,  175,  223,  181,  215,   35,    0,   35,  165,   35,
-       36,  215,   36,  227,  165,  297,  178,  182,  182,  185,
-
-      165,   36,  178,   36,  165,  165,   36,  165,  178,  178,
-       36,   36,  185,   36,   36,  165,    0,   36,  185,   36,
-      227,  165,  297,  178,  182,  182,  185,  165,   36,  178,
-       36,  165,  165,   36,  165,  178,  178,   36,   36,  185,
-       36,   36,   37,  188,  198,  185,  190,  190,  191,  193,
-       37,  188,  299,  191, 1221,  191,   37,  192,  192,   37,
-       37,   37,   37,  198,  301,  193,   37, 1221,    0,   37,
-      188,  198,    0,  190,  190,  191,  193,   37,  188,  299,
-      191,  197,  191,   37,  192,  192,   37,   37,   37,   37,
-      198,  301,  193,   37,   38,   38,  194,  197,  194,  194,
-
-      194,  196,   38,  211,  211,  200,  196,  204,  197,   38,
-      200,   38,  204,   38,   38,  303,  202,  270,   38,  270,
-      270,   38,   38,  194,  197,  194,  194,  194,  196,   38,
-      211,  211,  200,  196,  204,  202,   38,  200,   38,  204,
-       38,   38,  303,  202,  201,   38,   40,  221,   40,   40,
-        0,   40,   40,  206, 1261,  201,  216,  216,   40,   40,
-        0,  201,  202,  221,   40,    0,   40, 1261,  203,    0,
-       40,  201,  206,   40,  221,   40,   40,  203,   40,   40,
-      206,  203,  201,  216,  216,   40,   40,  203,  201,    0,
-      221,   40,  208,   40,  210,  203,  213,   40,   43,  206,
-
-      213,   43,   43,  207,  203,  219,  208,  207,  203,  219,
-       43,  208,   43,  210,  203,  207,  220,   43,   43,  208,
-      220,  210,   43,  213,    0,   43,    0,  213,   43,   43,
-      207,    0,  219,  208,  207,    0,  219,   43,  208,   43,
-      210,    0,  207,  220,   43,   43,    0,  220,  214,   43,
-       44,   44,  214,   44,   44,  209,  209,  222,   44,  217,
-      217,  222,   44,  224,   44,  328,  209,  214,  222,  298,
-       44,  224,  298,  209,   44,  214,    0,   44,   44,  214,
-       44,   44,  209,  209,  222,   44,  217,  217,  222,   44,
-      224,   44,  328,  209,  214,  222,  298,   44,  224,  298,
-
-      209,   44,   47,  306,  226,  225,   47,  306,   47,  225,
-       47,  312,  312,  225,  226,  226,   47,   47,  276,   47,
-        0,  276,   47,  276,  225,  254,   47,  254,  254,   47,
-      306,  226,  225,   47,  306,   47,  225,   47,  312,  312,
-      225,  226,  226,   47,   47,    0,   47,  254,  300,   47,
-        0,  225,  329,   47,   49,  329,  307,  241,   49,  241,
-      241,   49,   49,  300,  302,   49,   49,  241,  241,   49,
-      241,  307,   49,   49,   49,  300,   49,  302,   49,  329,
-      241,   49,  329,  307,  242,   49,  242,  242,   49,   49,
-      300,  302,   49,   49,  242,  242,   49,  242,  307,   49,
-
-       49,   49,    0,   49,  302,   49,   50,  242,   50,  240,
-      240,  240,  240,   50,   50,  256,  256,   50, 1165,   50,
-       50, 1165,  240, 1021,  249,  249,   50,  257,  257,  249,
-       50, 1021,    0,   50, 1039,   50,  256,    0,    0,  249,
-       50,   50,  256, 1281,   50,  249,   50,   50,  257, 1039,
-      249,  249, 1039,   50,  257,    0, 1281,   50,   51,  316,
-       51,  253,  253,  253,  253,   51,  340,  253,    0,  305,
-       51,  305,   51,  316,   51,   51,   51,  253,  273,  273,
-      273,  273,  273,  253,    0,   51,  316,   51,  253,  253,
-      264,  264,   51,  340,    0,  264,  305,   51,  305,   51,
-
-      316,   51,   51,   51,   98,   98,   98,   98,   98,   98,
-       98,  264, 1062,   98,   98,   98,   98,  264,   98, 1062,
-       98,  235,  235,  235,  235, 1062, 1185,   98,   98, 1185,
-        0,  235,  235,   98,  235,  236,  236,  236,  236,  237,
-      237,  237,  237, 1022,  235,  236,  236,    0,  236,  237,
-      237, 1022,  237,  238,  238,  238,  238,  317,  236,  317,
-       98,    0,  237,  238,  238,    0,  238,  263,  263,  263,
-      263,  263,  239,  239,  239,  239,  238,    0,  263,    0,
-      321,  321,  239,  239,  317,  239,  317,   98,   99,   99,
-       99,   99,   99,   99,   99,  239,    0,   99,   99,   99,
-
-       99,  343,   99,  244,  308,  244,  244,  321,  321,    0,
-      308,   99,   99,  244,  244,  310,  244,   99, 1264,  259,
-      259, 1264,  260,  260,  259,    0,  244,  260,  343,  265,
-      265,  308,  310,  309,  265,    0,  319,  308,  309,  344,
-      259,  319,  310,  260,   99,  259,  259,    0,  260,  260,
-      265,  293,  293,  293,  293,  293,  265,    0,    0,  310,
-      309, 1163,  293,  319,  346,  309,  344,  304,  319, 1163,
-        0,   99,  100,  100,  100,  100,  100,  100,  100,    0,
-      304,  100,  100,  100,  100,  271,  100,  271,  271,    0,
-     1265,  346,  320, 1265,  304,  100,  100,  271,  271,  271,
-
-      311,  100,  271,  271,  271,  271,  271,  304,    0,  320,
-      324,  350,  272,  311,  272,  272,  313,  314,  352,  320,
-      313,  314,  313,  324,  272,  272,  272,  311,  100,  272,
-      272,  272,  272,  272,    0,  315,  320,  324,  350,    0,
-      311,    0,  315,  313,  314,  352,    0,  313,  314,  313,
-      324,  870,    0,  870,  870,  100,  101,  101,  101,  101,
-      101,  101,  101,  318,    0,  101,  101,  101,  101,  318,
-      101,  322,  101,  330,  323,  325,  326,  331,  315,  101,
-      101,  315,  326,  327,  327,  101,  330,  374,  322,  332,
-      318,  323,  325,  331,  336,  333,  318,  394,  322,  333,
-
-      330,  323,  325,  326,  331,  315,  332,  336,  315,  326,
-      327,  327,  101,  330,  374,  322,  332, 1112,  323,  325,
-      331,  336,  333, 1217,  394,  984,  333,  984,  984,    0,
-      334, 1217, 1112,  332,  336, 1112,  335,  335,  337,  101,
-      112,  112,  351,    0,  351,  334,  112,  337,  112,  112,
-      112,  112,  112,  112,  112,  112,  112,  334,  112,  112,
-      112,  112,  112,  335,  335,  337,  339,  339,    0,  351,
-      338,  351,  334,    0,  337,  341,  338, 1219,  345,  659,
-      341,  659,  659,    0,  659, 1219,  342,  348,    0,  112,
-      114,  114,  342,  339,  339,  345,  114,  338,  114,  114,
-
-      114,  347,  341,  338,  348,  345,  114,  341,  114,  114,
-      114,  114,  114,  342,  348,  349,  347,  380,  349,  342,
-        0, 1247,  345,    0,  353,  354,  353,  354,  347, 1247,
-      380,  348,  872,    0,  872,  872,    0,  872,  355,  114,
-      117,  117,  349,  347,  380,  349,  117,  355,  117,  117,
-      117,  353,  354,  353,  354,    0,  117,  380,  117,  117,
-      117,  117,  117,  356,  358,  355,  356,  357,  373,  357,
-      358,  359,  360,  359,  355,  361,    0,  361,    0,  363,
-      373,  363,  117,    0,  364,    0,  360,  364,  362,  117,
-      356,  358,    0,  356,  357,  373,  357,  358,  359,  360,
-
-      359,    0,  361,  372,  361,  362,  363,  373,  363,  117,
-      199,  364,  199,  360,  364,  362,  199,  365,  372,  365,
-      366,  366,  199,  379,  368,  199,  199,  379,  199,  199,
-      372,  986,  362,  986,  986,    0,  986,  199,  368,  199,
-        0,    0,    0,  199,  365,  372,  365,  366,  366,  199,
-      379,  368,  199,  199,  379,  199,  199,  283,  283,  283,
-      283,  283,  283,  283,    0,  368,  283,  283,  283,  283,
-      367,  283,  367,  369,  371,  375,  370,  371,  376,  369,
-      283,  283,  370,  377,  377,  369,  283,  382,  378,  382,
-      376,  378,  375,  376,  381,  381,  395,  367,  395,  367,
-
-      369,  371,  375,  370,  371,  376,  369,    0,  386,  370,
-      377,  377,  369,  283,  382,  378,  382,  376,  378,  375,
-      376,  381,  381,  395,    0,  395,  385,  383, 1249, 1250,
-      388,  388,  387,  383,  386,  384, 1249, 1250,    0,  387,
-      283,  284,  284,  284,  284,  284,  284,  284,  384,    0,
-      284,  284,  284,  284,  383,  284,  385,  388,  388,  387,
-      383,  386,  384,  389,  284,  284,  387,  390,  393,  385,
-      284,  391,  396,  389,  396,  384,  392,  392,  397,  390,
-      393,  391,  399,  385,  403,  400,  391,  400,  408,  412,
-      389,  399,  397,  403,  390,  393,  385,  284,  391,  396,
-
-      389,  396, 1269,  392,  392,  397,  390,  393,  391,  399,
-     1269,  403,  400,  391,  400,  408,  412,  405,  399,  397,
-      403,    0,    0,  405,  284,  285,  285,  285,  285,  285,
-      285,  285,  398,  401,  285,  285,  285,  285,  402,  285,
-        0,  402,  404,  398,  405,  398,  415,  401,  285,  285,
-      405,  404,  406,  407,  285,  406,  407,  409,  407,  398,
-      401,  409,  411,  410,  416,  402,  410,  413,  402,  404,
-      398,  414,  398,  415,  401,  414,  411,  416,  404,  406,
-      407,  285,  406,  407,  409,  407,    0,    0,  409,  411,
-      410,  416,    0,  410,    0,  413,    0,  417,  414,  417,
-
-        0,  419,  414,  411,  416,    0,    0,  420,  285,  286,
-      286,  286,  286,  286,  286,  286,  419,    0,  286,  286,
-      286,  286,  413,  286,  417,  418,  417,  418,  419,  421,
-      425,  426,  286,  286,  420,  422,  424,  422,  286,  423,
-      427,  423,  427,  419,  424,  425,  421,  428,  429,  435,
-      421,  438,  418,  428,  418,  428,  421,  425,  426,  429,
-      430,  430,  422,  424,  422,  286,  423,  427,  423,  427,
-      439,  424,  425,  421,  428,  429,  435,  421,  438,  431,
-      428,  436,  428,  431,    0,    0,  429,  430,  430,    0,
-        0,  432,  286,  295,  295,  432,  434,  439,  436,  295,
-
-      434,  295,  295,  295,  433,  443,  431,  437,  436,  295,
-      431,  295,  295,  295,  295,  295,  441,  433,  432,  441,
-      437,  445,  432,  434,  295,  436,    0,  434,  442,  444,
-      440,  433,  443,    0,  437,    0,  440,  442,  448,  472,
-      444,    0,  295,  441,  433,    0,  441,  437,  445,    0,
-      446,  295,  296,  296,  446,  442,  444,  440,  296,  449,
-      296,  296,  296,  440,  442,  448,  472,  444,  296,  449,
-      296,  296,  296,  296,  296,  491,  447,  446,  447,  454,
-      454,  446,    0,  455,  455,    0,  449,    0,  455,    0,
-      457,  457,  296,    0,  467,  457,  449,    0,    0,    0,
-
-      454,  296,  491,  447,  455,  447,  454,  467,    0,  455,
-      455,  457,  460,  466,  460,  460,  466,  457,  469,  296,
-      466,  467,  471,  469,  460,  460,  460,    0,  470,  460,
-      460,  460,  460,  460,  467,  468,  471,  468,  470,  473,
-      466,  474,  476,  466,  473,  469,  475,  466,  480,  471,
-      469,    0,  474,  475,  478,  470,  476,  477,  478,    0,
-      484,  480,  468,  471,  468,  470,  473,  484,  474,  476,
-        0,  473,  479,  475,  477,  480,  479,  481,  482,  474,
-      475,  478,  487,  476,  477,  478,  485,  483,  480,  483,
-      481,  482,  486,  486,  485,  487,  488,  489,  488,  479,
-
-      492,  477,    0,  479,  481,  482,  484,    0,  490,  487,
-      489,  490,  493,    0,  483,  493,  483,  481,  482,  486,
-      486,  494,  487,  488,  489,  488,  498,  492,  494,  496,
-      485,  499,  485,  484,  485,  490,  495,  489,  490,  493,
-      495,  497,  493,  500,  504,  496,  501,  503,  494,  503,
-      497,  504,  501,  498,  502,  494,  496,  485,  499,  485,
-      502,  485,  506,  495,  506,    0,  510,  495,  497,  507,
-      500,  504,  496,  501,  503,  509,  503,  497,  504,  501,
-      505,  502,  505,  505,  507,  505,  508,  502,  509,  506,
-      511,  506,  508,  510,  513,  512,  507,    0,  515,    0,
-
-      515,    0,  509,  514,  516,  520,  516,  518,  518,  519,
-      513,  507,  512,  508,  511,  509,  514,    0,  517,  508,
-      522,  513,  512,  519,  517,  515,  505,  515,  517,  505,
-      514,  516,  520,  516,  518,  518,  519,  513,  521,  512,
-      523,  511,  525,  514,  521,  517,  524,  522,  526,  524,
-      519,  517,  528,  505,  530,  517,  505,  527,  528,  532,
-      529,  526,  531,  531,  533,  521,  534,  523,    0,  525,
-      530,  521,    0,  524,  527,  526,  524,  529,  538,  528,
-      537,  530,  539,  534,  527,  528,  532,  529,  526,  531,
-      535,  533,  539,  534,  536,  538,    0,  530,  541,  535,
-
-      543,  527,  547,  536,  529,  538,  542,  544,  540,  539,
-      534,  540,  537,  537,  541,    0,  531,  535,  545,  539,
-      545,  536,  538,  542,  544,  541,  535,  543,  546,  547,
-      536,  549,  552,  542,  544,  540,  548,  546,  540,  537,
-      537,  541,  548,  550,  554,  545,  551,  545,  553,  553,
-      542,  544,  551,  555,    0,  546,  550,  557,  549,    0,
-        0,  561,  552,  548,  546,  558,    0,  561,  556,  548,
-      550,  554,  556,  551,  558,  553,  553,  559,  560,  551,
-      555,  556,  562,  550,  557,  565,  556,  560,  561,  552,
-      559,  562,  558,  563,  561,  556,  566,  563,  564,  556,
-
-      567,  558,  569,  567,  559,  560,  570,    0,  556,  562,
-      564,    0,  565,  556,  560,  569,  568,  559,  562,  568,
-      563,  574,  571,  566,  563,  564,  571,  567,  574,  569,
-      567,  572,  572,  577,  575,  570,  573,  564,  570,  579,
-      573,  576,  569,  568,  576,  578,  568,  575,  574,  571,
-      577,  581,  578,  571,  579,  574,  582,  583,  572,  572,
-      577,  575,  570,  573,  581,  570,  579,  573,  576,  580,
-      584,  576,  578,  580,  575,  585,  587,  577,  581,  578,
-      588,  579,    0,  582,  583,  586,  586,  584,  591,  589,
-      591,  581,  589,  588,  590,  590,  580,  584,    0,    0,
-
-      580,    0,  585,  587,    0,  594,  596,  588,  597,  592,
-      595,  597,  586,  586,  584,  591,  589,  591,  594,  589,
-      588,  590,  592,  595,    0,  592,  593,  598,  593,  593,
-      601,  593,  594,  596,  599,  597,  592,  595,  597,  602,
-      598,  600,  600,  604,    0,  594,  606,  599,  590,  592,
-      595,  593,  592,    0,  598,  603,  605,  601,  603,  603,
-      609,  599,  605,  607,  607,  609,  602,  598,  600,  600,
-      593,  604,  593,  606,  599,  608,    0,  611,  623,  608,
-      610,  611,  603,  605,  612,  603,  603,  609,  613,  605,
-      607,  607,  609,  610,  613,  612,    0,  593,  604,  593,
-
-        0,    0,  608,  614,  611,  623,  608,  610,  611,  614,
-      629,  612,  614,  629,  619,  613,  619,  619,    0,  620,
-      610,  613,  612,  620,  621,  625,  619,  619,  619,    0,
-      614,  619,  619,  619,  619,  619,  614,  621,  625,  614,
-      622,  622,  624,  624,  626,  627,  620,  628,  630,    0,
-      620,  621,  625,  626,  631,  635,  629,  629,  631,  627,
-      628,  635,  638,  632,  621,  625,  632,  622,  622,  624,
-      624,  626,  627,  639,  628,  630,  633,  634,  633,  634,
-      626,  631,  635,  629,  629,  631,  627,  628,  635,  638,
-      632,  637,  636,  632,  640,  637,  642,  643,  644,  645,
-
-      639,  647,  640,  633,  634,  633,  634,  636,  646,  648,
-      648,    0,  646,    0,  650,    0,  645,  649,  637,  636,
-      650,  649,  637,  642,  643,  644,  645,  651,  647,  656,
-      658,  652,  657,  657,  636,  646,  648,  648,  640,  646,
-      640,  650,  640,  645,  649,  652,  653,  650,  649,  655,
-      654,  661,  653,  661,  651,  654,  656,  658,  652,  657,
-      657,  662,  655,  674,  663,  640,  663,  640,  670,  640,
-      665,    0,  652,  653,  664,  667,  655,  654,  661,  653,
-      661,  670,  654,  664,  665,  668,  667,  669,  662,  655,
-      674,  663,  668,  663,  672,  670,  675,  665,  673,  669,
-
-      671,  664,  667,  671,  676,  677,  678,  672,  670,  684,
-      664,  665,  668,  667,  669,  673,  682,  676,  677,  668,
-      678,  672,  682,  675,  685,  673,  669,  679,  679,  681,
-      683,  676,  677,  678,  672,  680,  684,  683,  681,  680,
-      693,    0,  673,  682,  676,  677,  671,  678,  686,  682,
-        0,  685,  686,  687,  679,  679,  681,  683,  688,  687,
-        0,  690,  680,  688,  683,  681,  680,  693,  689,  692,
-      691,    0,  700,  671,  690,  686,  691,  694,  692,  686,
-      687,  689,  696,  695,  694,  688,  687,  689,  690,  696,
-      688,  697,  699,  698,  699,  701,  692,  691,  695,  700,
-
-      703,  690,  697,  691,  694,  692,  698,    0,  702,  696,
-      695,  694,  704,    0,  689,  704,  696,  702,  697,  699,
-      698,  699,  701,  705,  706,  695,  708,  703,  706,  697,
-      711,  707,  708,  698,  707,  702,  709,  705,    0,  704,
-      709,  712,  704,  715,  702,  710,  710,  712,  718,  713,
-      705,  706,  713,  708,  716,  706,  714,  711,  707,  708,
-      715,  707,  720,  709,  705,  714,  720,  709,  712,  716,
-      715,  719,  710,  710,  712,  718,  713,  717,  717,  713,
-      723,  716,  721,  714,  719,  724,  722,  715,  722,  720,
-        0,  726,  714,  720,  723,  721,  716,  725,  725,  719,
-
-      727,  728,  729,  733,  717,  717,  730,  723,  731,  721,
-      731,  724,  732,  722,  732,  722,  734,  724,  726,  736,
-      730,  723,  721,  737,  725,  725,  719,  727,  728,  729,
-      733,  744,  735,  730,  735,  731,  739,  731,  724,  732,
-        0,  732,    0,  734,  724,    0,  736,  730,  739,  738,
-      737,  738,  738,    0,  738,  740,  740,  745,  744,  735,
-        0,  735,  741,  739,  741,  741,  743,  741,  743,  743,
-      753,  748,  745,  746,  738,  739,  748,  747,  749,    0,
-      749,  743,  740,  740,  745,  750,  746,  741,  747,  738,
-      752,  750,  752,  738,  743,  738,    0,  753,  748,  745,
-
-      746,  756,    0,  748,  747,  749,  741,  749,  751,  758,
-      756,  751,  750,  746,  754,  747,  738,  752,  750,  752,
-      738,  757,  738,  755,  754,  759,  755,  760,  756,  754,
-      761,  765,  766,  741,  757,  751,  758,  756,  751,  761,
-      762,  754,  759,  763,  762,    0,  763,    0,  757,    0,
-      755,  754,  759,  755,  760,  769,  754,  761,  765,  766,
-        0,  757,  764,  770,  764,  764,  761,  762,  771,  759,
-      763,  762,  768,  763,  764,  764,  764,  767,  767,  764,
-      764,  764,  764,  764,  772,  768,  774,  769,  776,  774,
-      770,  783,  773,  771,  775,  773,  789,    0,  772,  768,
-
-      777,  784,  777,    0,  767,  767,  778,  775,  779,  784,
-      779,  772,  768,  774,  769,  776,  774,    0,  783,  778,
-      771,  775,  780,  789,  773,  772,  773,  777,  773,  777,
-      781,  780,  781,  778,  775,  779,  773,  779,  782,  773,
-      782,  790,  786,  787,  785,  784,  778,    0,    0,  780,
-      786,  773,  785,  773,  787,  773,  795,  781,  780,  781,
-        0,    0,  788,  773,  788,  782,  773,  782,  790,  791,
-      787,  791,  784,  793,  785,  792,  786,  796,  792,  794,
-      796,  787,  800,  795,  797,    0,  793,  785,  794,  788,
-      802,  788,  798,  802,    0,    0,  791,  797,  791,    0,
-
-      793,  785,    0,  786,  796,  807,  794,  796,  798,  800,
-      799,  797,  799,  793,  785,  794,  811,  803,  802,  798,
-      803,  792,  792,  809,  797,  804,  804,  805,  806,  805,
-      812,  806,  807,  803,  813,  798,  810,  799,  814,  799,
-      809,  810,  817,  811,  815,  803,  816,  813,  792,  792,
-      809,  817,  804,  804,  805,  806,  805,  812,  806,  815,
-      816,  813,  818,  810,  818,  814,  819,  809,  810,  817,
-      820,  815,  821,  816,  813,  822,    0,  819,  817,  823,
-      824,  821,  827,  820,  827,  829,  815,  816,  822,  818,
-      825,  818,  828,  819,  825,  826,  832,  820,    0,  821,
-
-      826,  830,  828,  822,  819,  835,  823,  824,  821,  827,
-      820,  827,  829,  837,  830,  831,  831,  825,  833,  828,
-      833,  825,  826,  832,  834,  834,  838,  826,  830,  828,
-      822,  836,  835,  839,    0,  841,  840,  841,    0,  838,
-      837,  830,  831,  831,  843,  833,    0,  833,  836,  840,
-      848,  834,  834,  838,  842,  842,  844,  843,  836,  845,
-      839,  844,  841,  840,  841,  845,  838,  846,  851,    0,
-      847,  843,  846,  847,  849,  836,  840,  848,  852,  850,
-      853,  842,  842,  844,  843,  850,  845,  849,  844,  854,
-      860,  852,  845,  853,  846,  851,  856,  847,  856,  846,
-
-      847,  849,  854,    0,  855,  852,  850,  853,  858,  857,
-      858,  867,  850,  855,  859,  859,  861,  860,  852,  861,
-      853,    0,  854,  856,  857,  856,  862,    0,  849,  862,
-      866,  855,    0,  869,  871,  858,  857,  858,  867,  866,
-      855,  859,  859,  861,  875,  863,  861,  863,  863,  854,
-      863,  857,  865,  862,  865,  865,  862,  866,  875,  868,
-      869,  871,    0,  874,  876,  874,  866,  865,  868,  873,
-      863,  875,  873,  877,  878,  879,  880,  881,  880,  882,
-      865,  882,    0,  884,  883,  875,  868,  886,  887,  863,
-      874,  876,  874,  887,  881,  868,  873,  883,  884,  873,
-
-      877,  878,  879,  880,  881,  880,  882,  885,  882,  885,
-      884,  883,  888,  889,  886,  887,  863,  888,  892,    0,
-      887,  881,    0,    0,  883,  884,  890,  893,  890,  891,
-      895,  891,  891,  893,  885,  896,  885,  897,  894,  888,
-      889,  891,  891,  891,  888,  892,  891,  891,  891,  891,
-      891,  894,  898,  890,  893,  890,  898,  895,  899,  900,
-      893,  901,  896,  902,  897,  904,  903,  905,  906,  904,
-      894,  903,  908,  905,  906,  909,  907,  908,  910,  898,
-      911,  917,  921,  898,  909,  899,  900,    0,  901,  907,
-      902,  924,  904,  903,  905,  906,  904,  894,  903,  908,
-
-      905,  906,  909,  907,  908,  910,  914,  911,  917,  921,
-      922,  909,  923,  927,  914,  929,  907,  925,  924,  926,
-      925,  923,  926,  922,    0,  928,  935,  928,  929,  930,
-      934,  930,  930,  934,  930,    0,  932,  922,    0,  923,
-      927,  931,  929,  932,  931,  938,  936,  939,  923,  941,
-      922,  914,  928,  935,  928,  929,  937,  943,  934,  936,
-      925,  939,  937,  932,  940,  926,  942,  945,  931,  947,
-      932,  931,  938,  936,  939,  930,  941,  940,  914,  942,
-      945,  944,  949,  937,  943,  944,  936,  925,  939,  937,
-      946,  940,  926,  942,  945,  949,  947,  946,  948,  950,
-
-      948,  952,  930,  950,  940,  951,  942,  945,  944,  953,
-      954,  955,  944,  949,  956,  957,  951,  958,  952,  958,
-      959,    0,  953,  954,  961,  948,  950,  948,  952,  963,
-      950,  964,  951,  946,  966,  955,  953,  954,  962,  968,
-      949,  956,  957,  951,  958,  952,  958,  959,  960,  953,
-      954,  961,  962,  967,  960,  965,  963,  970,  964,  973,
-      946,  966,  955,  970,  965,  962,  969,  969,    0,  967,
-      971,  968,  973,  974,  975,  960,  976,    0,  972,  962,
-      967,  960,  965,  971,  970,  972,  973,  977,    0,  976,
-      970,  965,  977,  969,  969,  971,  967,  978,  968,  973,
-
-      974,  975,  979,  978,  976,  972,    0,  981,  980,  982,
-      980,  980,  972,  980,  977,  979,  983,  985,  987,  977,
-      989,  990,  971,  987,  978,    0,  989,  992,    0,  979,
-      978,  976,  988,  980,  981,  988,  982,  994,  991, 1002,
-        0,  995,  979,  983,  985,  987,  995,  989,  990,  991,
-      987,  992,  980,  989,  980,  980,  993,  996,  997,  988,
-      996, 1001,  988,  997,  994,  991, 1002,  998,  995,  993,
-     1001, 1006,  999,  995,  998,  999,  991, 1004,  992,  980,
-     1000,  980,  980,  993,  996,  997, 1007,  996, 1001, 1004,
-      997, 1009, 1005, 1000,  998,    0,  993, 1001, 1006,  999,
-
-        0,  998,  999,    0, 1004, 1005, 1010, 1000, 1008, 1003,
-     1011, 1003, 1003, 1007, 1008, 1012, 1004, 1013, 1009, 1016,
-     1000, 1003, 1003, 1003, 1016, 1005, 1003, 1003, 1003, 1003,
-     1003, 1014, 1015, 1010, 1015, 1008, 1017, 1011, 1019, 1020,
-     1014, 1008, 1012, 1024, 1013, 1017, 1016, 1018, 1023, 1025,
-     1018, 1016, 1005, 1026, 1027, 1023, 1028, 1027, 1014, 1015,
-     1024, 1015, 1029, 1017,    0, 1019, 1020, 1014, 1028, 1031,
-     1024, 1034, 1017, 1032, 1018, 1033, 1025, 1018, 1035, 1032,
-     1026, 1027, 1037, 1028, 1027, 1040, 1036, 1024, 1033, 1029,
-     1041, 1023, 1043, 1044, 1023, 1028, 1031, 1042, 1034, 1036,
-
-     1032, 1045, 1033, 1041, 1046, 1035, 1032, 1048, 1049, 1037,
-     1042, 1050, 1040, 1036, 1051, 1033, 1041, 1053, 1023, 1043,
-     1044, 1023, 1052, 1055, 1042, 1052, 1036, 1054, 1045, 1057,
-     1053, 1046, 1056, 1058, 1048, 1049, 1060, 1042, 1050, 1059,
-     1054, 1051, 1057, 1041, 1053, 1061, 1063, 1065, 1069, 1052,
-     1055,    0, 1052, 1059,    0, 1063, 1054, 1053, 1070, 1056,
-     1058, 1064, 1068, 1060, 1068, 1068, 1059, 1057, 1072,    0,
-     1064, 1071, 1061, 1063, 1065, 1069, 1066, 1068, 1066, 1066,
-     1059, 1066, 1063, 1054, 1071, 1070, 1075, 1073, 1064, 1074,
-     1068, 1076, 1077,    0, 1057, 1072, 1073, 1064, 1071, 1075,
-
-     1074, 1066, 1080, 1079, 1080, 1081, 1082, 1084, 1083, 1082,
-     1085, 1071,    0, 1075, 1073,    0, 1074, 1079, 1076, 1077,
-     1066, 1083, 1086, 1073, 1086, 1089, 1075, 1074, 1090, 1080,
-     1079, 1080, 1081, 1082, 1084, 1083, 1082, 1085, 1089, 1089,
-     1087, 1088, 1087, 1087, 1079, 1091, 1092, 1066, 1083, 1086,
-     1093, 1086, 1087, 1087, 1087, 1090, 1088, 1087, 1087, 1087,
-     1087, 1087, 1094, 1095, 1096, 1097, 1089, 1095, 1088, 1098,
-     1097, 1101, 1091, 1092, 1099, 1101, 1100, 1093, 1100, 1103,
-     1102,    0, 1105, 1088, 1109,    0, 1099, 1102, 1105, 1094,
-     1095, 1096, 1097, 1109, 1095, 1107, 1098, 1097, 1101,    0,
-
-     1108, 1099, 1101, 1100, 1110, 1100, 1103, 1116, 1107, 1105,
-     1111, 1109, 1108, 1099, 1121, 1105, 1111, 1114, 1121,    0,
-     1109, 1122, 1107, 1123, 1113, 1114, 1102, 1108,    0, 1125,
-     1117, 1110, 1113, 1115, 1116, 1107, 1123, 1111, 1127, 1108,
-     1127, 1121, 1113, 1111, 1117, 1121, 1115, 1115, 1122, 1128,
-     1130, 1123, 1133, 1102, 1128, 1114, 1125, 1117, 1129, 1134,
-     1129, 1129, 1113, 1132, 1136, 1127, 1132, 1127, 1137, 1138,
-     1131, 1117, 1131, 1131, 1115, 1131, 1128, 1130, 1123, 1133,
-     1139, 1128, 1114, 1135, 1142, 1135, 1134, 1143, 1144, 1113,
-     1132, 1136, 1145, 1132, 1145, 1137, 1138, 1139, 1146, 1147,
-
-     1151, 1152, 1154, 1149,    0,    0,    0, 1139, 1156, 1157,
-     1135, 1142, 1135,    0, 1143, 1144, 1149, 1158, 1150, 1145,
-     1148, 1145, 1148, 1148, 1139, 1146, 1147, 1151, 1152, 1154,
-     1149, 1150, 1148, 1148, 1148, 1156, 1157, 1148, 1148, 1148,
-     1148, 1148, 1161, 1149, 1158, 1159, 1160, 1162, 1164, 1164,
-     1166, 1150, 1167, 1168, 1159, 1160, 1169, 1170, 1168, 1171,
-     1173, 1179, 1174, 1175, 1180, 1167, 1170, 1171, 1173, 1161,
-     1174, 1175, 1159, 1160, 1162, 1164, 1164, 1166, 1150, 1167,
-     1168, 1159, 1160, 1169, 1170, 1168, 1177, 1182, 1179, 1178,
-     1183, 1180, 1167, 1170, 1177,    0, 1174, 1171, 1173, 1187,
-
-     1188, 1175, 1178, 1186,    0, 1184, 1186, 1189, 1190, 1188,
-     1191, 1192, 1193, 1194, 1182, 1198, 1195, 1183, 1184, 1190,
-     1177, 1195, 1178, 1174, 1171, 1173, 1187, 1188, 1175, 1193,
-     1184, 1186, 1201, 1200, 1189, 1190, 1188, 1191, 1192, 1193,
-     1194, 1202, 1198, 1195, 1197, 1201, 1190, 1177, 1195, 1178,
-     1199, 1197, 1199, 1199, 1203, 1199, 1193, 1184, 1204, 1199,
-     1200, 1205, 1206, 1207, 1209, 1208, 1201, 1208, 1202, 1210,
-     1209, 1197, 1211, 1212, 1213, 1214, 1216, 1218, 1197, 1213,
-     1220, 1203, 1212, 1214, 1216, 1204,    0, 1225, 1205, 1206,
-     1207, 1209, 1208, 1201, 1208, 1222, 1210, 1209, 1226, 1211,
-
-     1212, 1213, 1227, 1224, 1218, 1224, 1213, 1220, 1222, 1212,
-     1216, 1228, 1229, 1214, 1225, 1231, 1228, 1222,    0,    0,
-        0, 1230,    0, 1230, 1230, 1226, 1230,    0, 1237, 1227,
-     1224, 1234, 1224, 1234, 1238, 1239, 1235, 1216, 1228, 1229,
-     1214,    0, 1231, 1228, 1222, 1232, 1230, 1232, 1232, 1235,
-     1232, 1240, 1242, 1243, 1232, 1237, 1244, 1245, 1234, 1245,
-     1234, 1238, 1239, 1246, 1248, 1253, 1243, 1230, 1235, 1251,
-     1254, 1255, 1246, 1256,    0, 1262,    0,    0, 1240, 1242,
-     1243,    0, 1251, 1244, 1245, 1251, 1245,    0, 1255,    0,
-     1246, 1248, 1253, 1243, 1230, 1235, 1263, 1254, 1255, 1246,
-
-     1256, 1257, 1262, 1257, 1257, 1258, 1257, 1258, 1258,    0,
-     1258, 1259, 1251, 1259, 1259, 1255, 1259, 1266, 1260, 1267,
-     1270, 1271, 1268, 1263, 1268,    0, 1257, 1260,    0, 1272,
-     1258,    0, 1276, 1270, 1272, 1273, 1259, 1273, 1273, 1277,
-     1273, 1280,    0, 1282, 1266, 1260, 1267, 1257, 1271, 1268,
-     1274, 1268, 1274, 1274, 1260, 1274, 1272, 1275, 1270, 1276,
-     1273, 1272, 1283, 1284, 1283, 1283, 1277, 1283, 1280, 1275,
-     1282, 1286, 1284, 1293, 1257, 1274, 1287, 1289, 1287, 1287,
-     1291, 1287, 1293,    0, 1275, 1270, 1288, 1283, 1288, 1288,
-     1284, 1288, 1289, 1292, 1296, 1292, 1275, 1291, 1286, 1284,
-
-     1293, 1287, 1294,    0, 1289, 1294, 1295, 1291, 1283, 1293,
-     1295, 1288,    0,    0,    0,    0,    0,    0,    0, 1289,
-     1292, 1296, 1292,    0, 1291,    0,    0,    0,    0, 1294,
-        0,    0, 1294, 1295,    0, 1283,    0, 1295, 1298, 1298,
-     1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298,
-     1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299,
-     1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
-     1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300,
-     1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301,
-     1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
-
-     1301, 1301, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302,
-     1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303,
-     1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
-     1303, 1303, 1303, 1303, 1304, 1304, 1304, 1304, 1304, 1304,
-     1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304,
-     1305, 1305, 1305, 1305, 1305, 1305, 1305, 1305, 1305, 1305,
-     1305, 1305, 1305, 1305, 1305, 1305, 1306, 1306, 1306, 1306,
-     1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306, 1306,
-     1306, 1306, 1307, 1307,    0, 1307,    0, 1307,    0, 1307,
-     1307, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
-
-     1308, 1308, 1308, 1308, 1308, 1308, 1308, 1309, 1309,    0,
-     1309,    0, 1309,    0, 1309, 1309, 1310, 1310,    0, 1310,
-        0, 1310, 1310, 1310, 1310, 1311,    0,    0, 1311,    0,
-        0, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311,
-     1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
-     1312, 1312, 1312, 1312, 1312, 1312, 1312, 1313, 1313, 1313,
-     1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313,
-     1313, 1313, 1313, 1314, 1314,    0, 1314,    0, 1314,    0,
-     1314, 1315, 1315,    0, 1315,    0, 1315,    0, 1315, 1316,
-     1316,    0, 1316,    0, 1316,    0, 1316, 1317, 1317,    0,
-
-     1317,    0, 1317,    0, 1317, 1318, 1318, 1318, 1318,    0,
-     1318, 1318, 1318, 1318, 1318, 1318, 1318, 1318, 1318, 1318,
-     1318, 1319, 1319, 1319, 1319,    0, 1319, 1319, 1319, 1319,
-     1319, 1319, 1319, 1319, 1319,    0, 1319, 1320, 1320, 1320,
-     1320,    0, 1320, 1320, 1320, 1320, 1320, 1320, 1320, 1320,
-     1320, 1320, 1320, 1321, 1321, 1321, 1321,    0, 1321, 1321,
-     1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1322,
-     1322, 1322, 1322,    0, 1322, 1322, 1322, 1322, 1322, 1322,
-     1322, 1322, 1322,    0, 1322, 1323, 1323, 1323, 1323,    0,
-     1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323,
-
-     1323, 1324, 1324,    0,    0,    0, 1324,    0, 1324, 1324,
-     1324, 1324,    0,    0,    0, 1324, 1324, 1325, 1325,    0,
-     1325,    0, 1325,    0, 1325, 1326, 1326,    0, 1326,    0,
-     1326,    0, 1326, 1327, 1327,    0, 1327,    0, 1327,    0,
-     1327, 1328,    0,    0,    0,    0, 1328, 1328, 1328, 1328,
-     1328, 1328, 1328, 1328, 1328, 1328, 1328, 1329, 1329,    0,
-        0, 1329, 1329, 1329, 1329, 1329, 1329, 1329, 1329, 1329,
-     1329, 1329, 1329, 1330, 1330,    0,    0, 1330, 1330, 1330,
-     1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1330, 1331,
-     1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331, 1331,
-
-     1331, 1331, 1331, 1331, 1331, 1332, 1332, 1332, 1332, 1332,
-     1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332, 1332,
-     1332, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333, 1333,
-     1333, 1333, 1333, 1333, 1333, 1333, 1333, 1334, 1334, 1334,
-     1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
-     1334, 1334, 1334, 1335, 1335, 1335, 1335, 1335, 1335, 1335,
-     1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336,
-     1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
-     1336, 1336, 1336, 1336, 1336, 1337, 1337,    0, 1337,    0,
-     1337,    0, 1337, 1337, 1338, 1338,    0, 1338,    0, 1338,
-
-        0, 1338, 1338, 1339, 1339,    0, 1339,    0, 1339,    0,
-     1339, 1340, 1340, 1340, 1340, 1340, 1340, 1340, 1340, 1340,
-     1340, 1340, 1340, 1340, 1340, 1340, 1340, 1341, 1341, 1341,
-     1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341,
-     1341, 1341, 1341, 1342, 1342,    0, 1342,    0, 1342,    0,
-     1342, 1342, 1343, 1343,    0, 1343,    0, 1343,    0, 1343,
-     1343, 1344, 1344,    0, 1344,    0, 1344,    0, 1344, 1344,
-     1345, 1345,    0, 1345,    0, 1345,    0, 1345, 1345, 1346,
-     1346,    0, 1346,    0, 1346, 1346, 1346, 1346, 1347,    0,
-        0, 1347,    0,    0, 1347, 1347, 1347, 1347, 1347, 1347,
-
-     1347, 1347, 1347, 1347, 1348, 1348, 1348, 1348, 1348, 1348,
-     1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348,
-     1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349,
-     1349, 1349, 1349, 1349, 1349, 1349, 1350, 1350, 1350, 1350,
-     1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350,
-     1350, 1350, 1351, 1351,    0, 1351,    0, 1351,    0, 1351,
-     1352, 1352, 1352,    0, 1352,    0, 1352,    0, 1352, 1353,
-     1353,    0, 1353,    0, 1353,    0, 1353, 1354, 1354, 1354,
-     1354,    0, 1354,    0, 1354, 1355, 1355, 1355, 1355,    0,
-     1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355, 1355,
-
-     1355, 1356, 1356, 1356, 1356,    0, 1356, 1356, 1356, 1356,
-     1356, 1356, 1356, 1356, 1356,    0, 1356, 1357, 1357, 1357,
-     1357,    0, 1357, 1357, 1357, 1357, 1357, 1357, 1357,    0,
-     1357,    0, 1357, 1358, 1358,    0,    0,    0, 1358,    0,
-     1358, 1358, 1358, 1358,    0,    0,    0, 1358, 1358, 1359,
-     1359, 1359, 1359,    0, 1359, 1359, 1359, 1359, 1359, 1359,
-     1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360,    0,
-     1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
-     1360, 1361, 1361,    0,    0,    0, 1361, 1361, 1361, 1361,
-     1361, 1361, 1361, 1361, 1361, 1361, 1361, 1362, 1362, 1362,
-
-     1362,    0, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362,
-     1362, 1362, 1362, 1363, 1363, 1363, 1363,    0, 1363, 1363,
-     1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364,
-     1364,    0,    0,    0, 1364,    0, 1364, 1364, 1364, 1364,
-     1364, 1364,    0, 1364, 1364, 1365, 1365, 1365, 1365,    0,
-     1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365,
-     1365, 1366, 1366, 1366, 1366,    0, 1366, 1366, 1366, 1366,
-     1366, 1366, 1366, 1366, 1366, 1366, 1366, 1367, 1367, 1367,
-     1367,    0, 1367, 1367, 1367, 1367, 1367, 1367, 1367, 1367,
-     1367, 1367, 1367, 1368, 1368,    0,    0,    0, 1368,    0,
-
-     1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1368, 1369,
-     1369, 1369,    0, 1369,    0, 1369,    0, 1369, 1370, 1370,
-        0, 1370,    0, 1370,    0, 1370, 1371, 1371, 1371, 1371,
-        0, 1371,    0, 1371, 1372,    0,    0,    0,    0, 1372,
-     1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1372,
-     1373, 1373,    0,    0, 1373, 1373, 1373, 1373, 1373, 1373,
-     1373, 1373, 1373, 1373, 1373, 1373, 1374, 1374,    0,    0,
-     1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374,
-     1374, 1374, 1375, 1375,    0,    0, 1375, 1375, 1375, 1375,
-     1375, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376, 1376,
-
-        0,    0, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376,
-     1376, 1376, 1376, 1376, 1377, 1377, 1377, 1377, 1377, 1377,
-     1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377, 1377,
-     1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378, 1378,
-     1378, 1378, 1378, 1378, 1378, 1378, 1379, 1379, 1379, 1379,
-     1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379,
-     1379, 1379, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380,
-     1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1381, 1381,
-        0, 1381,    0, 1381,    0, 1381, 1381, 1382, 1382,    0,
-     1382,    0, 1382,    0, 1382, 1383, 1383, 1383, 1383, 1383,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,   21,    5,    5,    5,    5,    5,
+       30,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    7,    7,
+        7,    7,   53,    7,    7,    7,   54,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,   94,    7,    7,    7,    7,    7,  106,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,   11,   11,   11,   11,
+
+      114,   11,   11,   11,   56,   11,   56,   56,   11,  118,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      119,  121,   11,   11,   11,   11,  122,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   13,   13,  123,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   15,   15,  126,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+       15,   15,   15,   15,   19,   42,   19,   19,   42,   43,
+       43,   52,   42,   45,   19,   19,  127,   19,   43,   52,
+       43,  128,   45,   45,   58,   43,   58,   58,   45,   19,
+
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       22,   22,   22,   22,   22,   22,   22,   22,   22,   22,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       24,   24,   65,  129,   65,   65,   24,  130,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,   24,  134,  136,
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   27,   27,   71,  139,   71,   71,   27,  140,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+      141,  142,   27,   27,   27,   27,  143,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   28,   28,   73,  144,   73,   73,
+       28,  145,   28,   28,   28,   28,   28,   28,   28,   28,
+
+       28,   28,   28,  146,   28,   28,   28,   28,  147,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   28,   28,   28,   28,
+       28,   28,   28,   28,   28,   28,   32,  135,   32,   32,
+       32,   32,   32,   32,   32,   33,  151,   33,   33,   33,
+       33,   33,   33,   33,   32,   32,   74,  135,   74,   74,
+       47,   33,  152,   32,   47,   32,   47,   32,   47,   32,
+       32,  153,   34,   32,   47,   47,   34,   47,   34,   34,
+       35,   33,  154,   34,   35,   33,   34,   34,   35,   34,
+       41,  157,   34,   35,   35,   36,   34,   36,   89,  131,
+
+       35,   89,   35,  131,   35,  120,   36,  131,   36,   37,
+       41,   36,  120,  160,   41,   36,   36,   37,   36,   36,
+      125,  162,  125,   37,   38,   38,   37,   37,   37,   37,
+       46,   39,   38,   37,  156,  163,   46,  156,   46,   38,
+      133,   38,   46,   38,   38,   39,   46,  133,   38,  158,
+       39,   39,  149,  158,   40,   39,   40,   40,  149,   40,
+       40,   44,   44,  158,   44,   44,   40,   40,   85,   44,
+       85,   85,   40,   44,   40,   44,  164,   48,   40,   44,
+       48,   48,  138,   49,  166,   44,   49,   49,  138,  137,
+       49,   49,  138,  167,   49,   48,  171,   49,   49,   49,
+
+       50,   49,   50,   49,  137,   51,  172,   50,   50,  137,
+       51,   50,  173,   50,   50,   51,  174,   51,   55,   51,
+       51,   55,  175,   55,   50,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   62,   62,
+
+       62,   62,  180,  183,   63,   63,  184,  186,   62,   62,
+       63,   62,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,  176,   62,   63,   63,   63,   63,  176,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+       63,   63,   63,   63,   63,   63,   64,   64,   64,   64,
+      187,  188,   67,   67,  190,  192,   64,   64,   67,   64,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+      193,   64,   67,   67,   67,   67,  195,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   68,   68,  161,  182,  161,  182,
+       68,  198,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,  196,  196,   68,   68,   68,   68,  199,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   69,   69,  197,  201,
+      203,  189,   69,  197,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,  189,  204,   69,   69,   69,   69,
+      189,   69,   69,   69,   69,   69,   69,   69,   69,   69,
 
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   70,   70,
+       70,   70,  206,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+       70,   70,   70,   70,   70,   70,   70,   70,   72,   72,
+      208,  210,  211,   72,   72,  202,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,  202,   72,   72,   72,   72,
+
+       72,   72,   72,  212,   72,   72,   72,   72,  216,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   75,   75,
+      217,  218,  219,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   76,   76,
+
+      221,  213,  222,   76,   76,  213,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,  223,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+       76,   76,   76,   76,   76,   76,   76,   76,   77,   77,
+       77,   77,  224,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,  225,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   78,   78,
+      226,  220,  227,   78,   78,  220,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   79,   79,
+      229,  214,  230,   79,   79,  233,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,  214,   79,   79,   79,   79,
+
+       79,   79,   79,  234,   79,   79,   79,   79,  253,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   81,   81,
+      200,  228,  200,  200,   81,  228,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,  255,  270,   81,   81,
+       81,   81,  274,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       81,   81,   81,   81,   81,   81,   81,   81,   81,   81,
+       82,   82,  276,  283,  285,  305,   82,  306,   82,   82,
+
+       82,   82,   82,   82,   82,   82,   82,   82,  307,  308,
+       82,   82,   82,   82,  309,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   82,   82,   82,   82,   82,   82,   82,   82,
+       82,   82,   83,   83,  279,  311,  279,  279,   83,  313,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+      315,  317,   83,   83,   83,   83,  318,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   83,   83,   83,   86,  232,   86,   86,   87,   87,
+
+       87,   87,   87,   87,   87,  232,   86,   86,   86,  215,
+      215,   86,   86,   86,   86,   86,   86,   86,   88,  319,
+      215,  320,  321,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   90,   90,
+      322,  323,   90,   90,  324,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   91,   91,
+      325,  326,   91,   91,   91,   91,   91,   91,  328,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   91,   91,
+       91,   91,   91,   91,   91,   91,   91,   91,   96,   96,
+
+      330,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   97,   97,
+      331,  332,  333,  334,   97,  335,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,  336,  337,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+
+       97,   97,   97,   97,   97,   97,   97,   97,   97,   97,
+      100,  100,  338,  339,  340,  341,  100,  327,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  327,  343,
+      100,  100,  100,  100,  327,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  100,  100,  100,  100,  100,  100,  100,  100,
+      100,  100,  101,  101,  344,  345,  346,  348,  101,  349,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      350,  351,  101,  101,  101,  101,  352,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  104,  104,  353,  347,  354,  355,
+      104,  347,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  357,  358,  104,  104,  104,  104,  361,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      104,  104,  104,  104,  104,  104,  105,  105,  363,  364,
+      365,  367,  105,  368,  105,  105,  105,  105,  105,  105,
+      105,  105,  105,  105,  369,  370,  105,  105,  105,  105,
+      371,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+
+      105,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+      105,  105,  105,  105,  105,  105,  105,  105,  108,  108,
+      372,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+      108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+      108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+      108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+      108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+      108,  108,  108,  108,  108,  108,  108,  108,  110,  110,
+      373,  374,  375,  376,  110,  377,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  378,  379,  110,  110,
+
+      110,  110,  380,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  110,  110,  110,
+      111,  111,  111,  111,  111,  111,  111,  111,  381,  382,
+      383,  384,  386,  387,  111,  111,  111,  111,  111,  111,
+      111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+      111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+      112,  112,  388,  389,  391,  393,  112,  392,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  385,  392,
+      112,  112,  112,  112,  385,  112,  112,  112,  112,  112,
+
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  117,  117,  117,  117,  117,  117,  117,  132,
+      148,  394,  150,  132,  148,  178,  150,  132,  150,  168,
+      178,  148,  181,  132,  395,  168,  178,  205,  181,  205,
+      178,  168,  205,  205,  181,  168,  207,  396,  168,  205,
+      209,  397,  205,  205,  398,  205,  205,  207,  399,  209,
+      231,  400,  207,  207,  231,  401,  402,  239,  231,  209,
+      239,  404,  239,  405,  239,  239,  239,  239,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  239,  239,  239,
+      239,  239,  239,  239,  239,  239,  239,  247,  406,  247,
+      247,  248,  407,  248,  248,  408,  409,  247,  247,  410,
+      247,  248,  248,  411,  248,  412,  415,  416,  417,  418,
+      403,  420,  247,  411,  421,  422,  248,  258,  258,  258,
+      258,  423,  258,  258,  258,  258,  258,  258,  258,  258,
+      258,  258,  258,  258,  258,  258,  258,  258,  258,  258,
+      258,  258,  403,  258,  258,  258,  258,  258,  424,  258,
+
+      258,  258,  258,  258,  258,  258,  258,  258,  258,  258,
+      258,  258,  258,  258,  258,  258,  258,  258,  258,  258,
+      258,  258,  258,  258,  258,  258,  258,  264,  264,  425,
+      426,  427,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  264,  264,
+      264,  264,  264,  264,  264,  264,  264,  265,  265,  428,
+      430,  431,  265,  265,  265,  265,  265,  265,  265,  265,
+
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265,  265,  265,  267,  267,  429,
+      429,  433,  267,  267,  429,  267,  267,  267,  267,  267,
+      267,  267,  267,  267,  267,  267,  267,  267,  267,  267,
+      267,  267,  267,  267,  267,  267,  267,  434,  267,  267,
+      267,  267,  267,  267,  267,  267,  267,  267,  267,  267,
+      267,  267,  267,  267,  267,  267,  267,  267,  267,  267,
+
+      267,  267,  267,  267,  267,  267,  267,  268,  268,  436,
+      436,  432,  268,  268,  432,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  437,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  268,  268,  269,  269,  269,
+      269,  269,  269,  269,  439,  440,  272,  272,  441,  440,
+      269,  272,  272,  442,  272,  272,  272,  272,  272,  272,
+      272,  272,  272,  272,  272,  272,  272,  272,  272,  272,
+
+      272,  272,  272,  272,  272,  272,  272,  272,  272,  272,
+      272,  272,  272,  272,  272,  272,  272,  272,  272,  272,
+      272,  272,  272,  272,  272,  272,  272,  272,  272,  272,
+      272,  272,  272,  272,  272,  272,  273,  273,  445,  446,
+      445,  273,  273,  447,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  273,  284,  448,  450,  452,
+
+      453,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  286,  454,  455,  456,
+      459,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+
+      286,  286,  286,  286,  286,  286,  286,  286,  286,  286,
+      286,  286,  286,  286,  286,  286,  329,  413,  419,  444,
+      451,  457,  460,  329,  463,  464,  465,  467,  451,  468,
+      469,  419,  470,  472,  413,  473,  477,  478,  479,  481,
+      444,  484,  484,  484,  491,  492,  484,  484,  484,  484,
+      484,  484,  484,  490,  493,  494,  495,  496,  498,  499,
+      490,  500,  501,  502,  329,  503,  505,  504,  457,  506,
+      457,  504,  507,  508,  509,  510,  511,  512,  513,  514,
+      515,  516,  517,  511,  520,  512,  521,  522,  523,  524,
+      528,  529,  530,  531,  532,  533,  532,  532,  534,  532,
+
+      535,  536,  537,  539,  540,  541,  542,  543,  544,  545,
+      546,  547,  548,  512,  550,  551,  546,  553,  555,  556,
+      557,  558,  559,  512,  511,  512,  563,  512,  560,  560,
+      564,  565,  566,  567,  568,  569,  570,  571,  572,  573,
+      574,  575,  576,  578,  579,  532,  581,  582,  583,  584,
+      586,  589,  591,  592,  593,  589,  594,  595,  596,  597,
+      598,  600,  601,  602,  603,  604,  605,  566,  606,  589,
+      607,  608,  609,  610,  611,  612,  613,  614,  615,  616,
+      583,  617,  618,  620,  612,  622,  623,  625,  626,  628,
+      629,  630,  630,  631,  632,  634,  633,  605,  633,  633,
+
+      635,  633,  637,  638,  639,  640,  644,  643,  645,  646,
+      632,  643,  647,  649,  650,  651,  652,  653,  654,  655,
+      656,  657,  662,  633,  662,  662,  656,  663,  664,  665,
+      667,  668,  669,  670,  671,  672,  673,  674,  675,  676,
+      674,  677,  633,  678,  679,  680,  681,  682,  683,  685,
+      688,  689,  690,  644,  688,  691,  689,  692,  693,  695,
+      696,  697,  699,  700,  701,  702,  704,  706,  708,  706,
+      706,  710,  706,  711,  712,  714,  716,  717,  718,  719,
+      720,  721,  722,  720,  725,  726,  674,  727,  728,  729,
+      730,  715,  731,  732,  715,  735,  736,  715,  715,  737,
+
+      738,  739,  740,  715,  714,  715,  715,  715,  715,  715,
+      715,  715,  715,  715,  715,  741,  742,  715,  715,  715,
+      715,  743,  715,  715,  715,  715,  715,  715,  715,  715,
+      715,  715,  715,  715,  715,  715,  715,  715,  715,  715,
+      715,  715,  715,  715,  715,  715,  715,  715,  715,  744,
+      745,  746,  747,  748,  749,  751,  752,  753,  754,  755,
+      756,  757,  758,  759,  760,  761,  762,  764,  765,  766,
+      767,  768,  769,  770,  771,  773,  774,  775,  776,  777,
+      778,  779,  780,  781,  782,  783,  784,  787,  788,  789,
+      790,  791,  795,  798,  799,  798,  798,  800,  798,  801,
+
+      804,  801,  801,  803,  801,  803,  803,  805,  806,  779,
+      807,  808,  809,  810,  811,  812,  813,  814,  816,  817,
+      798,  818,  819,  821,  823,  824,  801,  825,  816,  830,
+      831,  832,  833,  834,  835,  798,  837,  838,  839,  798,
+      838,  827,  827,  827,  840,  801,  827,  827,  827,  827,
+      827,  827,  827,  842,  843,  844,  845,  846,  847,  848,
+      849,  850,  851,  856,  852,  857,  853,  860,  854,  855,
+      862,  838,  852,  838,  853,  838,  854,  855,  861,  863,
+      865,  861,  866,  838,  867,  868,  838,  870,  871,  872,
+      873,  874,  875,  873,  876,  877,  852,  878,  879,  880,
+
+      854,  879,  881,  884,  886,  855,  887,  888,  889,  890,
+      891,  892,  853,  854,  893,  894,  870,  896,  897,  898,
+      873,  899,  901,  902,  903,  906,  907,  861,  908,  909,
+      912,  913,  914,  915,  916,  917,  918,  919,  920,  921,
+      922,  923,  925,  926,  927,  928,  929,  930,  931,  932,
+      933,  934,  935,  936,  937,  938,  940,  942,  943,  944,
+      947,  944,  944,  946,  944,  946,  946,  948,  949,  951,
+      952,  951,  951,  953,  954,  955,  956,  961,  962,  963,
+      964,  965,  966,  967,  968,  970,  944,  971,  973,  974,
+      976,  974,  974,  977,  982,  983,  984,  985,  982,  986,
+
+      987,  988,  989,  990,  991,  944,  992,  993,  994,  996,
+      997,  998,  999, 1001, 1002, 1004, 1005, 1007, 1009,  998,
+     1011, 1012, 1013, 1015, 1005, 1016, 1015, 1018, 1019, 1020,
+     1021, 1022, 1023, 1024, 1028, 1029, 1031, 1032, 1034, 1036,
+     1037, 1038, 1040, 1041,  994, 1042, 1043, 1044, 1038, 1045,
+     1025, 1025, 1046, 1047, 1048,  994, 1025, 1051, 1025, 1025,
+     1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1015, 1052,
+     1025, 1025, 1025, 1025, 1053, 1025, 1025, 1025, 1025, 1025,
+     1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025,
+     1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025,
+
+     1025, 1025, 1055, 1057, 1058, 1060, 1061, 1062, 1063, 1064,
+     1065, 1066, 1067, 1068, 1070, 1071, 1072, 1073, 1074, 1075,
+     1076, 1077, 1078, 1081, 1078, 1078, 1083, 1078, 1083, 1083,
+     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1094,
+     1095, 1097, 1098, 1099, 1100, 1101, 1102, 1105, 1106, 1078,
+     1104, 1104, 1104, 1107, 1108, 1104, 1104, 1104, 1104, 1104,
+     1104, 1104, 1110, 1109, 1111, 1112, 1075, 1115, 1078, 1109,
+     1116, 1078, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+     1127, 1128, 1131, 1132, 1133, 1135, 1136, 1138, 1139, 1142,
+     1143, 1146, 1148, 1149, 1151, 1152, 1154, 1158, 1160, 1148,
+
+     1163, 1164, 1166, 1167, 1168, 1171, 1173, 1176, 1149, 1177,
+     1178, 1168, 1149, 1180, 1185, 1186, 1185, 1185, 1188, 1189,
+     1190, 1191, 1120, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+     1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+     1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+     1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+     1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+     1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157,
+     1157, 1157, 1179, 1182, 1192, 1183, 1193, 1183, 1183, 1194,
+     1183, 1196, 1197, 1200, 1201, 1202, 1204, 1205, 1206, 1205,
+
+     1205, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+     1217, 1213, 1183, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+     1226, 1227, 1228, 1229, 1230, 1231, 1229, 1232, 1234, 1179,
+     1182, 1183, 1195, 1195, 1235, 1195, 1195, 1195, 1195, 1195,
+     1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+     1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+     1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+     1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+     1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195, 1195,
+     1195, 1233, 1236, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+
+     1245, 1238, 1239, 1247, 1248, 1249, 1250, 1251, 1256, 1252,
+     1257, 1258, 1238, 1259, 1251, 1261, 1262, 1260, 1262, 1262,
+     1263, 1264, 1265, 1267, 1268, 1269, 1271, 1272, 1273, 1274,
+     1277, 1278, 1282, 1238, 1239, 1283, 1284, 1285, 1233, 1252,
+     1255, 1287, 1289, 1255, 1290, 1252, 1255, 1255, 1291, 1252,
+     1292, 1293, 1255, 1295, 1255, 1255, 1255, 1255, 1255, 1255,
+     1255, 1255, 1255, 1255, 1260, 1296, 1255, 1255, 1255, 1255,
+     1298, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+     1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255,
+     1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1281, 1281,
+
+     1281, 1299, 1301, 1281, 1281, 1281, 1281, 1281, 1281, 1281,
+     1304, 1305, 1307, 1308, 1310, 1311, 1313, 1314, 1317, 1318,
+     1322, 1326, 1328, 1329, 1313, 1314, 1317, 1330, 1334, 1332,
+     1335, 1336, 1332, 1337, 1338, 1339, 1340, 1341, 1343, 1344,
+     1345, 1347, 1349, 1350, 1349, 1349, 1351, 1349, 1352, 1353,
+     1354, 1349, 1355, 1314, 1317, 1356, 1313, 1357, 1305, 1332,
+     1358, 1359, 1361, 1363, 1365, 1366, 1367, 1368, 1369, 1372,
+     1373, 1374, 1375, 1376, 1378, 1379, 1380, 1372, 1381, 1382,
+     1384, 1383, 1383, 1385, 1387, 1388, 1381, 1383, 1389, 1383,
+     1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1390,
+
+     1391, 1383, 1383, 1383, 1383, 1372, 1383, 1383, 1383, 1383,
      1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383,
-     1383, 1384, 1384,    0, 1384,    0, 1384,    0, 1384, 1384,
-     1385, 1385,    0, 1385,    0, 1385,    0, 1385, 1385, 1386,
-     1386,    0, 1386,    0, 1386, 1386, 1386, 1386, 1387, 1387,
-     1387, 1387,    0, 1387, 1387, 1387, 1387, 1387, 1387, 1387,
-        0, 1387, 1387, 1387, 1388, 1388, 1388, 1388,    0, 1388,
-     1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
-     1389, 1389, 1389, 1389,    0, 1389, 1389, 1389, 1389, 1389,
-     1389, 1389, 1389, 1389, 1389, 1389, 1390, 1390, 1390, 1390,
-        0, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390, 1390,
-
-     1390, 1390, 1391, 1391,    0,    0,    0, 1391, 1391, 1391,
-     1391, 1391, 1391, 1391, 1391, 1391, 1391, 1391, 1392, 1392,
-        0,    0,    0, 1392,    0, 1392, 1392, 1392, 1392, 1392,
-     1392,    0, 1392, 1392, 1393, 1393,    0,    0,    0, 1393,
-        0, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
-     1394,    0,    0, 1394,    0, 1394, 1394,    0, 1394,    0,
-     1394,    0, 1394, 1395, 1395,    0, 1395,    0, 1395,    0,
-     1395, 1395, 1396, 1396,    0, 1396,    0, 1396,    0, 1396,
-     1397, 1397, 1397, 1397, 1397, 1397, 1397, 1397, 1397, 1397,
-     1397, 1397, 1397, 1397, 1397, 1398, 1398,    0, 1398, 1398,
-
-     1398, 1398, 1398, 1398, 1398, 1398, 1398, 1398, 1398, 1398,
-     1399,    0,    0, 1399,    0, 1399, 1399,    0, 1399,    0,
-     1399,    0, 1399, 1400,    0, 1400, 1400, 1400,    0,    0,
-     1400, 1400, 1400, 1401, 1401,    0, 1401,    0, 1401,    0,
-     1401, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297, 1297,
-     1297, 1297, 1297, 1297, 1297, 1297
+     1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383,
+     1383, 1383, 1383, 1392, 1393, 1394, 1398, 1394, 1394, 1396,
+     1399, 1396, 1396, 1401, 1396, 1402, 1403, 1404, 1396, 1407,
+     1409, 1411, 1412, 1413, 1414, 1415, 1416, 1420, 1421, 1424,
+     1428, 1430, 1431, 1432, 1436, 1438, 1421, 1424, 1433, 1439,
+     1433, 1433, 1434, 1433, 1434, 1434, 1440, 1441, 1444, 1440,
+     1441, 1394, 1447, 1449, 1452, 1454, 1456, 1457, 1458, 1460,
+     1458, 1458, 1461, 1462, 1468, 1433, 1469, 1470, 1471, 1470,
+
+     1470, 1424, 1470, 1473, 1475, 1477, 1475, 1475, 1479, 1480,
+     1481, 1482, 1483,    0,    0,    0,    0,    0, 1434,    0,
+        0,    0,    0,    0, 1470,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 1458,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     1475, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+
+     1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485,
+     1485, 1485
     } ;
 
 extern int yy_flex_debug;
@@ -2784,7 +2406,7 @@ char *yytext;
   static URL_T create_URL(char *proto);
 
 
-#line 2788 "src/lex.yy.c"
+#line 2410 "src/lex.yy.c"
 
 #define INITIAL 0
 #define ARGUMENT_COND 1
@@ -2978,10 +2600,10 @@ YY_DECL
 	register char *yy_cp, *yy_bp;
 	register int yy_act;
     
-#line 118 "src/l.l"
+#line 128 "src/l.l"
 
 
-#line 2985 "src/lex.yy.c"
+#line 2607 "src/lex.yy.c"
 
 	if ( !(yy_init) )
 		{
@@ -3039,14 +2661,14 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1298 )
+				if ( yy_current_state >= 1486 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			*(yy_state_ptr)++ = yy_current_state;
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 6742 );
+		while ( yy_base[yy_current_state] != 4752 );
 
 yy_find_action:
 		yy_current_state = *--(yy_state_ptr);
@@ -3095,1248 +2717,1378 @@ do_action:	/* This label is used only to access EOF actions. */
 	{ /* beginning of action switch */
 case 1:
 YY_RULE_SETUP
-#line 120 "src/l.l"
+#line 130 "src/l.l"
 { /* Wide white space */ }
 	YY_BREAK
 case 2:
 /* rule 2 can match eol */
 YY_RULE_SETUP
-#line 121 "src/l.l"
+#line 131 "src/l.l"
 { lineno++; } 
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 123 "src/l.l"
+#line 133 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 124 "src/l.l"
+#line 134 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 125 "src/l.l"
+#line 135 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 126 "src/l.l"
+#line 136 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 127 "src/l.l"
+#line 137 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 128 "src/l.l"
+#line 138 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 129 "src/l.l"
+#line 139 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 130 "src/l.l"
+#line 140 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 131 "src/l.l"
+#line 141 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 132 "src/l.l"
+#line 142 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 133 "src/l.l"
+#line 143 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 134 "src/l.l"
+#line 144 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 135 "src/l.l"
+#line 145 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 136 "src/l.l"
+#line 146 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 137 "src/l.l"
+#line 147 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 138 "src/l.l"
+#line 148 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 139 "src/l.l"
+#line 149 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 140 "src/l.l"
+#line 150 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 141 "src/l.l"
+#line 151 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 142 "src/l.l"
+#line 152 "src/l.l"
 {/* EMPTY */}
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 144 "src/l.l"
+#line 154 "src/l.l"
 { BEGIN(ARGUMENT_COND); return START; }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 145 "src/l.l"
+#line 155 "src/l.l"
 { BEGIN(ARGUMENT_COND); return STOP; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 146 "src/l.l"
+#line 156 "src/l.l"
 { BEGIN(ARGUMENT_COND); return RESTART; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 147 "src/l.l"
+#line 157 "src/l.l"
 { BEGIN(ARGUMENT_COND); return EXEC; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 149 "src/l.l"
+#line 159 "src/l.l"
 { return IF; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 150 "src/l.l"
+#line 160 "src/l.l"
 { return OR; }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 151 "src/l.l"
+#line 161 "src/l.l"
 { return THEN; }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 152 "src/l.l"
+#line 162 "src/l.l"
 { return FAILED; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 153 "src/l.l"
+#line 163 "src/l.l"
 { return HTTPDSSL; }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 154 "src/l.l"
+#line 164 "src/l.l"
 { return ENABLE; }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 155 "src/l.l"
+#line 165 "src/l.l"
 { return DISABLE; }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 156 "src/l.l"
+#line 166 "src/l.l"
 { return SET; }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 157 "src/l.l"
+#line 167 "src/l.l"
 { return DAEMON; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 158 "src/l.l"
+#line 168 "src/l.l"
 { return DELAY; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 159 "src/l.l"
+#line 169 "src/l.l"
 { return LOGFILE; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 160 "src/l.l"
+#line 170 "src/l.l"
 { return SYSLOG; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 161 "src/l.l"
+#line 171 "src/l.l"
 { return FACILITY; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 162 "src/l.l"
+#line 172 "src/l.l"
 { return HTTPD; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 163 "src/l.l"
+#line 173 "src/l.l"
 { return ADDRESS; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 164 "src/l.l"
+#line 174 "src/l.l"
 { return CLIENTPEMFILE; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 165 "src/l.l"
+#line 175 "src/l.l"
 { return ALLOWSELFCERTIFICATION; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 166 "src/l.l"
+#line 176 "src/l.l"
 { return CERTMD5; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 167 "src/l.l"
+#line 177 "src/l.l"
 { return PEMFILE; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 168 "src/l.l"
+#line 178 "src/l.l"
 { return INIT; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 169 "src/l.l"
+#line 179 "src/l.l"
 { return ALLOW; }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 170 "src/l.l"
+#line 180 "src/l.l"
 { return READONLY; }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 171 "src/l.l"
+#line 181 "src/l.l"
 { return PIDFILE; }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 172 "src/l.l"
+#line 182 "src/l.l"
 { return IDFILE; }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 173 "src/l.l"
+#line 183 "src/l.l"
 { return STATEFILE; }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 174 "src/l.l"
+#line 184 "src/l.l"
 { return PATHTOK; }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 175 "src/l.l"
+#line 185 "src/l.l"
 { return START; }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 176 "src/l.l"
+#line 186 "src/l.l"
 { return STOP; }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 177 "src/l.l"
+#line 187 "src/l.l"
 { return PORT; }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 178 "src/l.l"
+#line 188 "src/l.l"
 { return UNIXSOCKET; }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 179 "src/l.l"
+#line 189 "src/l.l"
 { return TYPE; }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 180 "src/l.l"
+#line 190 "src/l.l"
 { return PROTOCOL; }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 181 "src/l.l"
+#line 191 "src/l.l"
 { return TCP; }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 182 "src/l.l"
+#line 192 "src/l.l"
 { return TCPSSL; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 183 "src/l.l"
+#line 193 "src/l.l"
 { return UDP; }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 184 "src/l.l"
+#line 194 "src/l.l"
 { return ALERT; }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 185 "src/l.l"
+#line 195 "src/l.l"
 { return NOALERT; }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 186 "src/l.l"
+#line 196 "src/l.l"
 { return MAILFORMAT; }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 187 "src/l.l"
+#line 197 "src/l.l"
 { return RESOURCE; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 188 "src/l.l"
+#line 198 "src/l.l"
 { return RESTART; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 189 "src/l.l"
+#line 199 "src/l.l"
 { return CYCLE;}
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 190 "src/l.l"
+#line 200 "src/l.l"
 { return TIMEOUT; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 191 "src/l.l"
+#line 201 "src/l.l"
 { return RETRY; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 192 "src/l.l"
+#line 202 "src/l.l"
 { return CHECKSUM; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 193 "src/l.l"
+#line 203 "src/l.l"
 { return MAILSERVER; }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 194 "src/l.l"
+#line 204 "src/l.l"
 { return HOST; }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 195 "src/l.l"
+#line 205 "src/l.l"
 { return HOSTHEADER; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 196 "src/l.l"
+#line 206 "src/l.l"
 { return STATUS; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 197 "src/l.l"
+#line 207 "src/l.l"
 { return SYSTEM; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 198 "src/l.l"
+#line 208 "src/l.l"
 { return DEFAULT; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-#line 199 "src/l.l"
+#line 209 "src/l.l"
 { return HTTP; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-#line 200 "src/l.l"
+#line 210 "src/l.l"
 { return APACHESTATUS; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-#line 201 "src/l.l"
+#line 211 "src/l.l"
 { return FTP; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-#line 202 "src/l.l"
+#line 212 "src/l.l"
 { return SMTP; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
-#line 203 "src/l.l"
+#line 213 "src/l.l"
 { return POSTFIXPOLICY; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
-#line 204 "src/l.l"
+#line 214 "src/l.l"
 { return POP; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
-#line 205 "src/l.l"
+#line 215 "src/l.l"
 { return IMAP; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
-#line 206 "src/l.l"
+#line 216 "src/l.l"
 { return CLAMAV; }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
-#line 207 "src/l.l"
+#line 217 "src/l.l"
 { return DNS; }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
-#line 208 "src/l.l"
+#line 218 "src/l.l"
 { return MYSQL; }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
-#line 209 "src/l.l"
+#line 219 "src/l.l"
 { return NNTP; }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
-#line 210 "src/l.l"
+#line 220 "src/l.l"
 { return NTP3; }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
-#line 211 "src/l.l"
+#line 221 "src/l.l"
 { return SSH; }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
-#line 212 "src/l.l"
+#line 222 "src/l.l"
 { return DWP; }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
-#line 213 "src/l.l"
+#line 223 "src/l.l"
 { return LDAP2; }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
-#line 214 "src/l.l"
+#line 224 "src/l.l"
 { return LDAP3; }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
-#line 215 "src/l.l"
+#line 225 "src/l.l"
 { return RDATE; }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
-#line 216 "src/l.l"
+#line 226 "src/l.l"
 { return LMTP; }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
-#line 217 "src/l.l"
+#line 227 "src/l.l"
 { return RSYNC; }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
-#line 218 "src/l.l"
+#line 228 "src/l.l"
 { return TNS; }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
-#line 219 "src/l.l"
+#line 229 "src/l.l"
 { return PGSQL; }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
-#line 220 "src/l.l"
+#line 230 "src/l.l"
 { return SIP; } 
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
-#line 221 "src/l.l"
+#line 231 "src/l.l"
 { return GPS; } 
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
-#line 222 "src/l.l"
+#line 232 "src/l.l"
 { return RADIUS; }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
-#line 223 "src/l.l"
+#line 233 "src/l.l"
 { return MEMCACHE; }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
-#line 224 "src/l.l"
+#line 234 "src/l.l"
 { return TARGET; }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
-#line 225 "src/l.l"
+#line 235 "src/l.l"
 { return MAXFORWARD; }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
-#line 226 "src/l.l"
+#line 236 "src/l.l"
 { return MODE; }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
-#line 227 "src/l.l"
-{ return ACTIVE; }
+#line 237 "src/l.l"
+{ return CGROUP; }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
-#line 228 "src/l.l"
-{ return PASSIVE; }
+#line 238 "src/l.l"
+{ return ACTIVE; }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
-#line 229 "src/l.l"
-{ return MANUAL; }
+#line 239 "src/l.l"
+{ return PASSIVE; }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
-#line 230 "src/l.l"
-{ return UID; }
+#line 240 "src/l.l"
+{ return MANUAL; }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
-#line 231 "src/l.l"
-{ return GID; }
+#line 241 "src/l.l"
+{ return UID; }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
-#line 232 "src/l.l"
-{ return REQUEST; }
+#line 242 "src/l.l"
+{ return GID; }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
-#line 233 "src/l.l"
-{ return SECRET; }
+#line 243 "src/l.l"
+{ return REQUEST; }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
-#line 234 "src/l.l"
-{ return LOGLIMIT; }
+#line 244 "src/l.l"
+{ return SECRET; }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
-#line 235 "src/l.l"
-{ return CLOSELIMIT; }
+#line 245 "src/l.l"
+{ return LOGLIMIT; }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
-#line 236 "src/l.l"
-{ return DNSLIMIT; }
+#line 246 "src/l.l"
+{ return CLOSELIMIT; }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
-#line 237 "src/l.l"
-{ return KEEPALIVELIMIT; }
+#line 247 "src/l.l"
+{ return DNSLIMIT; }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
-#line 238 "src/l.l"
-{ return REPLYLIMIT; }
+#line 248 "src/l.l"
+{ return KEEPALIVELIMIT; }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
-#line 239 "src/l.l"
-{ return REQUESTLIMIT; }
+#line 249 "src/l.l"
+{ return REPLYLIMIT; }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
-#line 240 "src/l.l"
-{ return STARTLIMIT; }
+#line 250 "src/l.l"
+{ return REQUESTLIMIT; }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
-#line 241 "src/l.l"
-{ return WAITLIMIT; }
+#line 251 "src/l.l"
+{ return STARTLIMIT; }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
-#line 242 "src/l.l"
-{ return GRACEFULLIMIT; }
+#line 252 "src/l.l"
+{ return WAITLIMIT; }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
-#line 243 "src/l.l"
-{ return CLEANUPLIMIT; }
+#line 253 "src/l.l"
+{ return GRACEFULLIMIT; }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
-#line 244 "src/l.l"
-{ return MEMORY; }
+#line 254 "src/l.l"
+{ return CLEANUPLIMIT; }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
-#line 245 "src/l.l"
-{ return SWAP; }
+#line 255 "src/l.l"
+{ return MEMORY; }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
-#line 246 "src/l.l"
-{ return TOTALMEMORY; }
+#line 256 "src/l.l"
+{ return SWAP; }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
-#line 247 "src/l.l"
-{ return CPU; }
+#line 257 "src/l.l"
+{ return TOTALMEMORY; }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
-#line 248 "src/l.l"
-{ return TOTALCPU; }
+#line 258 "src/l.l"
+{ return CPU; }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
-#line 249 "src/l.l"
-{ return CHILDREN; }
+#line 259 "src/l.l"
+{ return TOTALCPU; }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
-#line 250 "src/l.l"
-{ return TIMESTAMP; }
+#line 260 "src/l.l"
+{ return CHILDREN; }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
-#line 251 "src/l.l"
-{ return CHANGED; }
+#line 261 "src/l.l"
+{ return TIMESTAMP; }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
-#line 252 "src/l.l"
-{ return SECOND; }
+#line 262 "src/l.l"
+{ return FILES; }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
-#line 253 "src/l.l"
-{ return MINUTE; }
+#line 263 "src/l.l"
+{ return OLDEST; }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
-#line 254 "src/l.l"
-{ return HOUR; }
+#line 264 "src/l.l"
+{ return NEWEST; }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
-#line 255 "src/l.l"
-{ return DAY; }
+#line 265 "src/l.l"
+{ return REFRESH; }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
-#line 256 "src/l.l"
-{ return SSLV2; }
+#line 266 "src/l.l"
+{ return CHANGED; }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
-#line 257 "src/l.l"
-{ return SSLV3; }
+#line 267 "src/l.l"
+{ return SECOND; }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
-#line 258 "src/l.l"
-{ return TLSV1; }
+#line 268 "src/l.l"
+{ return MINUTE; }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
-#line 259 "src/l.l"
-{ return SSLAUTO; }
+#line 269 "src/l.l"
+{ return HOUR; }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
-#line 260 "src/l.l"
-{ return INODE; }
+#line 270 "src/l.l"
+{ return DAY; }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
-#line 261 "src/l.l"
-{ return SPACE; }
+#line 271 "src/l.l"
+{ return SSLV2; }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
-#line 262 "src/l.l"
-{ return PERMISSION; }
+#line 272 "src/l.l"
+{ return SSLV3; }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
-#line 263 "src/l.l"
-{ return EXEC; }
+#line 273 "src/l.l"
+{ return TLSV1; }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
-#line 264 "src/l.l"
-{ return SIZE; }
+#line 274 "src/l.l"
+{ return SSLAUTO; }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
-#line 265 "src/l.l"
-{ return UPTIME; }
+#line 275 "src/l.l"
+{ return INODE; }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
-#line 266 "src/l.l"
-{ return BASEDIR; }
+#line 276 "src/l.l"
+{ return SPACE; }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
-#line 267 "src/l.l"
-{ return SLOT; }
+#line 277 "src/l.l"
+{ return PERMISSION; }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
-#line 268 "src/l.l"
-{ return EVENTQUEUE; }
+#line 278 "src/l.l"
+{ return EXEC; }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
-#line 269 "src/l.l"
-{ return MATCH; }
+#line 279 "src/l.l"
+{ return SIZE; }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
-#line 270 "src/l.l"
-{ return NOT; }
+#line 280 "src/l.l"
+{ return UPTIME; }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
-#line 271 "src/l.l"
-{ return IGNORE; }
+#line 281 "src/l.l"
+{ return BASEDIR; }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
-#line 272 "src/l.l"
-{ return CONNECTION; }
+#line 282 "src/l.l"
+{ return SLOT; }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
-#line 273 "src/l.l"
-{ return UNMONITOR; }
+#line 283 "src/l.l"
+{ return EVENTQUEUE; }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
-#line 274 "src/l.l"
-{ return ACTION; }
+#line 284 "src/l.l"
+{ return MATCH; }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
-#line 275 "src/l.l"
-{ return ICMP; }
+#line 285 "src/l.l"
+{ return NOT; }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
-#line 276 "src/l.l"
-{ return ICMPECHO; }
+#line 286 "src/l.l"
+{ return IGNORE; }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
-#line 277 "src/l.l"
-{ return SEND; }
+#line 287 "src/l.l"
+{ return CONNECTION; }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
-#line 278 "src/l.l"
-{ return EXPECT; }
+#line 288 "src/l.l"
+{ return UNMONITOR; }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
-#line 279 "src/l.l"
-{ return EXPECTBUFFER; }
+#line 289 "src/l.l"
+{ return ACTION; }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
-#line 280 "src/l.l"
-{ return CLEARTEXT; }
+#line 290 "src/l.l"
+{ return ICMP; }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
-#line 281 "src/l.l"
-{ return MD5HASH; }
+#line 291 "src/l.l"
+{ return ICMPECHO; }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
-#line 282 "src/l.l"
-{ return SHA1HASH; }
+#line 292 "src/l.l"
+{ return SEND; }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
-#line 283 "src/l.l"
-{ return CRYPT; }
+#line 293 "src/l.l"
+{ return EXPECT; }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
-#line 284 "src/l.l"
-{ return SIGNATURE; }
+#line 294 "src/l.l"
+{ return EXPECTBUFFER; }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
-#line 285 "src/l.l"
-{ return NONEXIST; }
+#line 295 "src/l.l"
+{ return CLEARTEXT; }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
-#line 286 "src/l.l"
-{ return EXIST; }
+#line 296 "src/l.l"
+{ return MD5HASH; }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
-#line 287 "src/l.l"
-{ return INVALID; }
+#line 297 "src/l.l"
+{ return SHA1HASH; }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
-#line 288 "src/l.l"
-{ return DATA; }
+#line 298 "src/l.l"
+{ return SHA256HASH; }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
-#line 289 "src/l.l"
-{ return RECOVERED; }
+#line 299 "src/l.l"
+{ return XXH64HASH; }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
-#line 290 "src/l.l"
-{ return PASSED; }
+#line 300 "src/l.l"
+{ return CRYPT; }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
-#line 291 "src/l.l"
-{ return SUCCEEDED; }
+#line 301 "src/l.l"
+{ return SIGNATURE; }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
-#line 292 "src/l.l"
-{ return ELSE; }
+#line 302 "src/l.l"
+{ return NONEXIST; }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
-#line 293 "src/l.l"
-{ return MMONIT; }
+#line 303 "src/l.l"
+{ return EXIST; }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
-#line 294 "src/l.l"
-{ return URL; }
+#line 304 "src/l.l"
+{ return INVALID; }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
-#line 295 "src/l.l"
-{ return CONTENT; }
+#line 305 "src/l.l"
+{ return DATA; }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
-#line 296 "src/l.l"
-{ return PID; }
+#line 306 "src/l.l"
+{ return RECOVERED; }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
-#line 297 "src/l.l"
+#line 307 "src/l.l"
+{ return PASSED; }
+	YY_BREAK
+case 176:
+YY_RULE_SETUP
+#line 308 "src/l.l"
+{ return SUCCEEDED; }
+	YY_BREAK
+case 177:
+YY_RULE_SETUP
+#line 309 "src/l.l"
+{ return ELSE; }
+	YY_BREAK
+case 178:
+YY_RULE_SETUP
+#line 310 "src/l.l"
+{ return MMONIT; }
+	YY_BREAK
+case 179:
+YY_RULE_SETUP
+#line 311 "src/l.l"
+{ return URL; }
+	YY_BREAK
+case 180:
+YY_RULE_SETUP
+#line 312 "src/l.l"
+{ return CONTENT; }
+	YY_BREAK
+case 181:
+YY_RULE_SETUP
+#line 313 "src/l.l"
+{ return PID; }
+	YY_BREAK
+case 182:
+YY_RULE_SETUP
+#line 314 "src/l.l"
 { return PPID; }
 	YY_BREAK
-case 176:
+case 183:
+YY_RULE_SETUP
+#line 315 "src/l.l"
+{ return COUNT; }
+	YY_BREAK
+case 184:
+YY_RULE_SETUP
+#line 316 "src/l.l"
+{ return REMINDER; }
+	YY_BREAK
+case 185:
+YY_RULE_SETUP
+#line 317 "src/l.l"
+{ return INSTANCE; }
+	YY_BREAK
+case 186:
+YY_RULE_SETUP
+#line 318 "src/l.l"
+{ return HOSTNAME; }
+	YY_BREAK
+case 187:
+YY_RULE_SETUP
+#line 319 "src/l.l"
+{ return USERNAME; }
+	YY_BREAK
+case 188:
+YY_RULE_SETUP
+#line 320 "src/l.l"
+{ return PASSWORD; }
+	YY_BREAK
+case 189:
+YY_RULE_SETUP
+#line 321 "src/l.l"
+{ return CREDENTIALS; }
+	YY_BREAK
+case 190:
+YY_RULE_SETUP
+#line 322 "src/l.l"
+{ return REGISTER; }
+	YY_BREAK
+case 191:
+YY_RULE_SETUP
+#line 323 "src/l.l"
+{ return FSFLAG; }
+	YY_BREAK
+case 192:
+YY_RULE_SETUP
+#line 324 "src/l.l"
+{ return FIPS; }
+	YY_BREAK
+case 193:
+YY_RULE_SETUP
+#line 325 "src/l.l"
+{ return BYTE; }
+	YY_BREAK
+case 194:
+YY_RULE_SETUP
+#line 326 "src/l.l"
+{ return KILOBYTE; }
+	YY_BREAK
+case 195:
+YY_RULE_SETUP
+#line 327 "src/l.l"
+{ return MEGABYTE; }
+	YY_BREAK
+case 196:
+YY_RULE_SETUP
+#line 328 "src/l.l"
+{ return GIGABYTE; }
+	YY_BREAK
+case 197:
+YY_RULE_SETUP
+#line 329 "src/l.l"
+{ return LOADAVG1; }
+	YY_BREAK
+case 198:
+YY_RULE_SETUP
+#line 330 "src/l.l"
+{ return LOADAVG5; }
+	YY_BREAK
+case 199:
+YY_RULE_SETUP
+#line 331 "src/l.l"
+{ return LOADAVG15; }
+	YY_BREAK
+case 200:
+YY_RULE_SETUP
+#line 332 "src/l.l"
+{ return CPUUSER; }
+	YY_BREAK
+case 201:
+YY_RULE_SETUP
+#line 333 "src/l.l"
+{ return CPUSYSTEM; }
+	YY_BREAK
+case 202:
 YY_RULE_SETUP
-#line 298 "src/l.l"
-{ return COUNT; }
+#line 334 "src/l.l"
+{ return CPUWAIT; }
 	YY_BREAK
-case 177:
+case 203:
 YY_RULE_SETUP
-#line 299 "src/l.l"
-{ return REMINDER; }
+#line 335 "src/l.l"
+{ return CPUSTEAL; }
 	YY_BREAK
-case 178:
+case 204:
 YY_RULE_SETUP
-#line 300 "src/l.l"
-{ return INSTANCE; }
+#line 336 "src/l.l"
+{ return CPUIRQ; }
 	YY_BREAK
-case 179:
+case 205:
 YY_RULE_SETUP
-#line 301 "src/l.l"
-{ return HOSTNAME; }
+#line 337 "src/l.l"
+{ return PRESSURECPU; }
 	YY_BREAK
-case 180:
+case 206:
 YY_RULE_SETUP
-#line 302 "src/l.l"
-{ return USERNAME; }
+#line 338 "src/l.l"
+{ return PRESSUREMEMORY; }
 	YY_BREAK
-case 181:
+case 207:
 YY_RULE_SETUP
-#line 303 "src/l.l"
-{ return PASSWORD; }
+#line 339 "src/l.l"
+{ return PRESSUREIO; }
 	YY_BREAK
-case 182:
+case 208:
 YY_RULE_SETUP
-#line 304 "src/l.l"
-{ return CREDENTIALS; }
+#line 340 "src/l.l"
+{ return RESPONSETIME; }
 	YY_BREAK
-case 183:
+case 209:
 YY_RULE_SETUP
-#line 305 "src/l.l"
-{ return REGISTER; }
+#line 341 "src/l.l"
+{ return RESOLVETIME; }
 	YY_BREAK
-case 184:
+case 210:
 YY_RULE_SETUP
-#line 306 "src/l.l"
-{ return FSFLAG; }
+#line 342 "src/l.l"
+{ return CONNECTTIME; }
 	YY_BREAK
-case 185:
+case 211:
 YY_RULE_SETUP
-#line 307 "src/l.l"
-{ return FIPS; }
+#line 343 "src/l.l"
+{ return TLSTIME; }
 	YY_BREAK
-case 186:
+case 212:
 YY_RULE_SETUP
-#line 308 "src/l.l"
-{ return BYTE; }
+#line 344 "src/l.l"
+{ return FIRSTBYTETIME; }
 	YY_BREAK
-case 187:
+case 213:
 YY_RULE_SETUP
-#line 309 "src/l.l"
-{ return KILOBYTE; }
+#line 345 "src/l.l"
+{ return AVERAGE; }
 	YY_BREAK
-case 188:
+case 214:
 YY_RULE_SETUP
-#line 310 "src/l.l"
-{ return MEGABYTE; }
+#line 346 "src/l.l"
+{ return PERCENTILE; }
 	YY_BREAK
-case 189:
+case 215:
 YY_RULE_SETUP
-#line 311 "src/l.l"
-{ return GIGABYTE; }
+#line 347 "src/l.l"
+{ return SLOPE; }
 	YY_BREAK
-case 190:
+case 216:
 YY_RULE_SETUP
-#line 312 "src/l.l"
-{ return LOADAVG1; }
+#line 348 "src/l.l"
+{ return OVER; }
 	YY_BREAK
-case 191:
+case 217:
 YY_RULE_SETUP
-#line 313 "src/l.l"
-{ return LOADAVG5; }
+#line 349 "src/l.l"
+{ return MILLISECOND; }
 	YY_BREAK
-case 192:
+case 218:
 YY_RULE_SETUP
-#line 314 "src/l.l"
-{ return LOADAVG15; }
+#line 350 "src/l.l"
+{ return KEEPALIVE; }
 	YY_BREAK
-case 193:
+case 219:
 YY_RULE_SETUP
-#line 315 "src/l.l"
-{ return CPUUSER; }
+#line 351 "src/l.l"
+{ return PIDWATCH; }
 	YY_BREAK
-case 194:
+case 220:
 YY_RULE_SETUP
-#line 316 "src/l.l"
-{ return CPUSYSTEM; }
+#line 352 "src/l.l"
+{ return CONCURRENCY; }
 	YY_BREAK
-case 195:
+case 221:
 YY_RULE_SETUP
-#line 317 "src/l.l"
-{ return CPUWAIT; }
+#line 353 "src/l.l"
+{ return SESSION; }
 	YY_BREAK
-case 196:
+case 222:
 YY_RULE_SETUP
-#line 318 "src/l.l"
+#line 354 "src/l.l"
 { return GREATER; }
 	YY_BREAK
-case 197:
+case 223:
 YY_RULE_SETUP
-#line 319 "src/l.l"
+#line 355 "src/l.l"
 { return LESS; }
 	YY_BREAK
-case 198:
+case 224:
 YY_RULE_SETUP
-#line 320 "src/l.l"
+#line 356 "src/l.l"
 { return EQUAL; }
 	YY_BREAK
-case 199:
+case 225:
 YY_RULE_SETUP
-#line 321 "src/l.l"
+#line 357 "src/l.l"
 { return NOTEQUAL; }
 	YY_BREAK
-case 200:
+case 226:
 YY_RULE_SETUP
-#line 323 "src/l.l"
+#line 359 "src/l.l"
 { BEGIN(INCLUDE); }
 	YY_BREAK
-case 201:
+case 227:
 YY_RULE_SETUP
-#line 325 "src/l.l"
+#line 361 "src/l.l"
 { 
                     BEGIN(EVERY_COND);
                     return NOTEVERY;
                   }
 	YY_BREAK
-case 202:
+case 228:
 YY_RULE_SETUP
-#line 330 "src/l.l"
+#line 366 "src/l.l"
 { 
                     BEGIN(EVERY_COND);
                     return EVERY;
                   }
 	YY_BREAK
-case 203:
+case 229:
 YY_RULE_SETUP
-#line 335 "src/l.l"
+#line 371 "src/l.l"
 {
                     BEGIN(DEPEND_COND);
                     return DEPENDS;
                   } 
 	YY_BREAK
-case 204:
+case 230:
 YY_RULE_SETUP
-#line 340 "src/l.l"
+#line 376 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKPROC;
                   }
 	YY_BREAK
-case 205:
+case 231:
 YY_RULE_SETUP
-#line 345 "src/l.l"
+#line 381 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKPROGRAM;
                   }
 	YY_BREAK
-case 206:
+case 232:
 YY_RULE_SETUP
-#line 350 "src/l.l"
+#line 386 "src/l.l"
 { /* Filesystem alias for backward compatibility  */
                     BEGIN(SERVICE_COND);
                     return CHECKFILESYS;
                   }
 	YY_BREAK
-case 207:
+case 233:
 YY_RULE_SETUP
-#line 355 "src/l.l"
+#line 391 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKFILESYS;
                   }
 	YY_BREAK
-case 208:
+case 234:
 YY_RULE_SETUP
-#line 360 "src/l.l"
+#line 396 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKFILE;
                   }
 	YY_BREAK
-case 209:
+case 235:
 YY_RULE_SETUP
-#line 365 "src/l.l"
+#line 401 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKDIR;
                   }
 	YY_BREAK
-case 210:
+case 236:
 YY_RULE_SETUP
-#line 370 "src/l.l"
+#line 406 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKHOST;
                   }
 	YY_BREAK
-case 211:
+case 237:
 YY_RULE_SETUP
-#line 375 "src/l.l"
+#line 411 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKSYSTEM;
                   }
 	YY_BREAK
-case 212:
+case 238:
 YY_RULE_SETUP
-#line 380 "src/l.l"
+#line 416 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                     return CHECKFIFO;
                   }
 	YY_BREAK
-case 213:
+case 239:
 YY_RULE_SETUP
-#line 385 "src/l.l"
+#line 421 "src/l.l"
 {
                     BEGIN(SERVICE_COND);
                         return CHECKPROGRAM;
                   }
 	YY_BREAK
-case 214:
+case 240:
 YY_RULE_SETUP
-#line 390 "src/l.l"
+#line 426 "src/l.l"
 {
                     BEGIN(STRING_COND);
                     return GROUP;
                   }
 	YY_BREAK
-case 215:
+case 241:
 YY_RULE_SETUP
-#line 395 "src/l.l"
+#line 431 "src/l.l"
 {
 		    yylval.url= 
 		      create_URL(Str_ndup(yytext, strlen(yytext)-3));
                     BEGIN(URL_COND);
                   }
 	YY_BREAK
-case 216:
+case 242:
 YY_RULE_SETUP
-#line 401 "src/l.l"
+#line 437 "src/l.l"
 {
                     yylval.number= atoi(yytext);
                     save_arg(); return NUMBER;
                   }
 	YY_BREAK
-case 217:
+case 243:
 YY_RULE_SETUP
-#line 406 "src/l.l"
+#line 442 "src/l.l"
 {
                     yylval.real= atof(yytext);
                     save_arg(); return REAL;
                   }
 	YY_BREAK
-case 218:
+case 244:
 YY_RULE_SETUP
-#line 411 "src/l.l"
+#line 447 "src/l.l"
 {
 	            return PERCENT;
                   }
 	YY_BREAK
-case 219:
+case 245:
 YY_RULE_SETUP
-#line 415 "src/l.l"
+#line 451 "src/l.l"
 {
                     yylval.string= Str_dup(yytext);
                     save_arg(); return STRING;
                   }
 	YY_BREAK
-case 220:
+case 246:
 YY_RULE_SETUP
-#line 420 "src/l.l"
+#line 456 "src/l.l"
 {
                     yylval.string= handle_quoted_string(yytext);
                     save_arg(); return PATH;
                   }
 	YY_BREAK
-case 221:
+case 247:
 YY_RULE_SETUP
-#line 425 "src/l.l"
+#line 461 "src/l.l"
 {
                     yylval.string= handle_quoted_string(yytext);
                     save_arg(); return PATH;
                   }
 	YY_BREAK
-case 222:
-/* rule 222 can match eol */
+case 248:
+/* rule 248 can match eol */
 YY_RULE_SETUP
-#line 430 "src/l.l"
+#line 466 "src/l.l"
 {
                     steplinenobycr(yytext);
                     yylval.string= handle_quoted_string(yytext);
                     save_arg(); return STRING;
                   }
 	YY_BREAK
-case 223:
-/* rule 223 can match eol */
+case 249:
+/* rule 249 can match eol */
 YY_RULE_SETUP
-#line 436 "src/l.l"
+#line 472 "src/l.l"
 {
                     steplinenobycr(yytext);
                     yylval.string= handle_quoted_string(yytext);
                     save_arg(); return STRING;
                   }
 	YY_BREAK
-case 224:
+case 250:
 YY_RULE_SETUP
-#line 442 "src/l.l"
+#line 478 "src/l.l"
 {
                     yylval.string= Str_dup(yytext);
                     save_arg(); return MAILADDR;
                   }
 	YY_BREAK
-case 225:
+case 251:
 YY_RULE_SETUP
-#line 447 "src/l.l"
+#line 483 "src/l.l"
 {
                      yylval.string= Str_dup(yytext);
                      save_arg(); return PATH;
                   }
 	YY_BREAK
-case 226:
+case 252:
 YY_RULE_SETUP
-#line 452 "src/l.l"
+#line 488 "src/l.l"
 {
                      yylval.string= Str_dup(yytext);
                      save_arg(); return PATH;
                   }
 	YY_BREAK
-case 227:
+case 253:
 YY_RULE_SETUP
-#line 457 "src/l.l"
+#line 493 "src/l.l"
 {
                       char *p= yytext+strlen("from:");
                       yylval.string = Str_trim(Str_dup(p));
                       save_arg(); return MAILFROM;
                   }
 	YY_BREAK
-case 228:
+case 254:
 YY_RULE_SETUP
-#line 463 "src/l.l"
+#line 499 "src/l.l"
 {
                       char *p= yytext+strlen("reply-to:");
                       yylval.string = Str_trim(Str_dup(p));
                       save_arg(); return MAILREPLYTO;
                   }
 	YY_BREAK
-case 229:
+case 255:
 YY_RULE_SETUP
-#line 469 "src/l.l"
+#line 505 "src/l.l"
 {
                       char *p= yytext+strlen("subject:");
                       yylval.string = Str_trim(Str_dup(p));
                       save_arg(); return MAILSUBJECT;
                   }
 	YY_BREAK
-case 230:
-/* rule 230 can match eol */
+case 256:
+/* rule 256 can match eol */
 YY_RULE_SETUP
-#line 475 "src/l.l"
+#line 511 "src/l.l"
 {
                       char *p= yytext+strlen("message:");
                       steplinenobycr(yytext);
@@ -4344,96 +4096,96 @@ YY_RULE_SETUP
                       save_arg(); return MAILBODY;
                   }
 	YY_BREAK
-case 231:
+case 257:
 YY_RULE_SETUP
-#line 482 "src/l.l"
+#line 518 "src/l.l"
 {
                       yylval.string = Str_dup(yytext);
                       save_arg(); return STRING;
                   }
 	YY_BREAK
-case 232:
+case 258:
 YY_RULE_SETUP
-#line 487 "src/l.l"
+#line 523 "src/l.l"
 {
                       yyerror("unbalanced quotes");
                   }
 	YY_BREAK
 
-case 233:
+case 259:
 YY_RULE_SETUP
-#line 493 "src/l.l"
+#line 529 "src/l.l"
 ;
 	YY_BREAK
-case 234:
-/* rule 234 can match eol */
+case 260:
+/* rule 260 can match eol */
 YY_RULE_SETUP
-#line 495 "src/l.l"
+#line 531 "src/l.l"
 {
                     lineno++;
                   }
 	YY_BREAK
-case 235:
+case 261:
 YY_RULE_SETUP
-#line 499 "src/l.l"
+#line 535 "src/l.l"
 {
                     yylval.string= Str_dup(yytext);
                     BEGIN(INITIAL);
                     save_arg(); return SERVICENAME;
                   }
 	YY_BREAK
-case 236:
+case 262:
 YY_RULE_SETUP
-#line 505 "src/l.l"
+#line 541 "src/l.l"
 {
                     yylval.string= handle_quoted_string(yytext);
                     BEGIN(INITIAL);
                     save_arg(); return SERVICENAME;
                   }
 	YY_BREAK
-case 237:
+case 263:
 YY_RULE_SETUP
-#line 511 "src/l.l"
+#line 547 "src/l.l"
 {
                     yylval.string= handle_quoted_string(yytext);
                     BEGIN(INITIAL);
                     save_arg(); return SERVICENAME;
                   }
 	YY_BREAK
-case 238:
+case 264:
 YY_RULE_SETUP
-#line 517 "src/l.l"
+#line 553 "src/l.l"
 {
                       yyerror("unbalanced quotes");
                   }
 	YY_BREAK
 
 
-case 239:
+case 265:
 YY_RULE_SETUP
-#line 525 "src/l.l"
+#line 561 "src/l.l"
 ;
 	YY_BREAK
-case 240:
-/* rule 240 can match eol */
+case 266:
+/* rule 266 can match eol */
 YY_RULE_SETUP
-#line 527 "src/l.l"
+#line 563 "src/l.l"
 {
                     lineno++;
                   }
 	YY_BREAK
-case 241:
+case 267:
 YY_RULE_SETUP
-#line 531 "src/l.l"
+#line 567 "src/l.l"
 {
                     yylval.string= Str_dup(yytext);
                     save_arg(); return SERVICENAME;
                   }
 	YY_BREAK
-case 242:
-/* rule 242 can match eol */
+case 268:
+/* rule 268 can match eol */
 YY_RULE_SETUP
-#line 536 "src/l.l"
+#line 572 "src/l.l"
 {
                     steplinenobycr(yytext);
                     unput(yytext[strlen(yytext)-1]);
@@ -4442,46 +4194,46 @@ YY_RULE_SETUP
 	YY_BREAK
 
 
-case 243:
+case 269:
 YY_RULE_SETUP
-#line 546 "src/l.l"
+#line 582 "src/l.l"
 ;
 	YY_BREAK
-case 244:
-/* rule 244 can match eol */
+case 270:
+/* rule 270 can match eol */
 YY_RULE_SETUP
-#line 548 "src/l.l"
+#line 584 "src/l.l"
 {
                     lineno++;
                   }
 	YY_BREAK
-case 245:
+case 271:
 YY_RULE_SETUP
-#line 552 "src/l.l"
+#line 588 "src/l.l"
 {
                       BEGIN(INITIAL);
                   }
 	YY_BREAK
-case 246:
-/* rule 246 can match eol */
+case 272:
+/* rule 272 can match eol */
 YY_RULE_SETUP
-#line 556 "src/l.l"
+#line 592 "src/l.l"
 {
                       steplinenobycr(yytext);
                       yylval.string= handle_quoted_string(yytext);
                       save_arg(); return STRING;
                   }
 	YY_BREAK
-case 247:
+case 273:
 YY_RULE_SETUP
-#line 562 "src/l.l"
+#line 598 "src/l.l"
 {
                       yyerror("unbalanced quotes");
                   }
 	YY_BREAK
-case 248:
+case 274:
 YY_RULE_SETUP
-#line 566 "src/l.l"
+#line 602 "src/l.l"
 {
                       yylval.string= Str_dup(yytext);
                       save_arg(); return STRING;
@@ -4489,10 +4241,10 @@ YY_RULE_SETUP
 	YY_BREAK
 
 
-case 249:
-/* rule 249 can match eol */
+case 275:
+/* rule 275 can match eol */
 YY_RULE_SETUP
-#line 575 "src/l.l"
+#line 611 "src/l.l"
 {
                       BEGIN(INITIAL);
 		      if(!yylval.url->hostname)
@@ -4510,143 +4262,143 @@ YY_RULE_SETUP
 		      save_arg(); return URLOBJECT;
                   }
 	YY_BREAK
-case 250:
-/* rule 250 can match eol */
+case 276:
+/* rule 276 can match eol */
 YY_RULE_SETUP
-#line 592 "src/l.l"
+#line 628 "src/l.l"
 {
 	              yylval.url->user= Str_dup(yytext);
                   }
 	YY_BREAK
-case 251:
-/* rule 251 can match eol */
+case 277:
+/* rule 277 can match eol */
 YY_RULE_SETUP
-#line 596 "src/l.l"
+#line 632 "src/l.l"
 {
 	              yytext++;
 	              yylval.url->password= Str_ndup(yytext, strlen(yytext)-1);
                   }
 	YY_BREAK
-case 252:
+case 278:
 YY_RULE_SETUP
-#line 601 "src/l.l"
+#line 637 "src/l.l"
 {
 	              yylval.url->hostname= Str_dup(yytext);
                   }
 	YY_BREAK
-case 253:
+case 279:
 YY_RULE_SETUP
-#line 605 "src/l.l"
+#line 641 "src/l.l"
 {
 	              yylval.url->port= atoi(++yytext);
                   }
 	YY_BREAK
-case 254:
+case 280:
 YY_RULE_SETUP
-#line 609 "src/l.l"
+#line 645 "src/l.l"
 {
 	              yylval.url->path= Util_urlEncode(yytext);
                   }
 	YY_BREAK
-case 255:
+case 281:
 YY_RULE_SETUP
-#line 613 "src/l.l"
+#line 649 "src/l.l"
 {
 	              yylval.url->query= Util_urlEncode(++yytext);
                   }
 	YY_BREAK
-case 256:
+case 282:
 YY_RULE_SETUP
-#line 617 "src/l.l"
+#line 653 "src/l.l"
 { 
 	              /* EMPTY - reference is ignored */ 
                   }
 	YY_BREAK
 
 
-case 257:
+case 283:
 YY_RULE_SETUP
-#line 625 "src/l.l"
+#line 661 "src/l.l"
 {
                     yylval.string= Str_dup(yytext);
                     BEGIN(INITIAL);
                     save_arg(); return STRINGNAME;
                   }
 	YY_BREAK
-case 258:
+case 284:
 YY_RULE_SETUP
-#line 631 "src/l.l"
+#line 667 "src/l.l"
 {
                     yylval.string= handle_quoted_string(yytext);
                     BEGIN(INITIAL);
                     save_arg(); return STRINGNAME;
                   }
 	YY_BREAK
-case 259:
+case 285:
 YY_RULE_SETUP
-#line 637 "src/l.l"
+#line 673 "src/l.l"
 {
                     yylval.string= handle_quoted_string(yytext);
                     BEGIN(INITIAL);
                     save_arg(); return STRINGNAME;
                   }
 	YY_BREAK
-case 260:
+case 286:
 YY_RULE_SETUP
-#line 643 "src/l.l"
+#line 679 "src/l.l"
 {
                       yyerror("unbalanced quotes");
                   }
 	YY_BREAK
 
 
-case 261:
+case 287:
 YY_RULE_SETUP
-#line 651 "src/l.l"
+#line 687 "src/l.l"
 ;
 	YY_BREAK
-case 262:
+case 288:
 YY_RULE_SETUP
-#line 653 "src/l.l"
+#line 689 "src/l.l"
 {
                     yylval.number= atoi(yytext);
                     BEGIN(INITIAL);
                     save_arg(); return NUMBER;
                   }
 	YY_BREAK
-case 263:
+case 289:
 YY_RULE_SETUP
-#line 659 "src/l.l"
+#line 695 "src/l.l"
 { // A minimal syntax check of the cron format string; 5 fields separated with white-space
                     yylval.string= Str_dup(Str_unquote(yytext));
                     BEGIN(INITIAL);
                     save_arg(); return TIMESPEC;
                   }
 	YY_BREAK
-case 264:
+case 290:
 YY_RULE_SETUP
-#line 665 "src/l.l"
+#line 701 "src/l.l"
 {
                       BEGIN(INITIAL);
                       yyerror("invalid every format");
                   }
 	YY_BREAK
 
-case 265:
+case 291:
 YY_RULE_SETUP
-#line 673 "src/l.l"
+#line 709 "src/l.l"
 {
                       return yytext[0];
                   }  
 	YY_BREAK
-case 266:
+case 292:
 YY_RULE_SETUP
-#line 678 "src/l.l"
+#line 714 "src/l.l"
 /* eat the whitespace */
 	YY_BREAK
-case 267:
+case 293:
 YY_RULE_SETUP
-#line 680 "src/l.l"
+#line 716 "src/l.l"
 { /* got the include file name with double quotes */
                      char *temp=Str_dup(yytext);
                      Str_unquote(temp);    
@@ -4655,9 +4407,9 @@ YY_RULE_SETUP
                      BEGIN(INITIAL);
                    }
 	YY_BREAK
-case 268:
+case 294:
 YY_RULE_SETUP
-#line 688 "src/l.l"
+#line 724 "src/l.l"
 { /* got the include file name with single quotes*/
                      char *temp=Str_dup(yytext);
                      Str_unquote(temp);    
@@ -4666,9 +4418,9 @@ YY_RULE_SETUP
                      BEGIN(INITIAL);
                    }
 	YY_BREAK
-case 269:
+case 295:
 YY_RULE_SETUP
-#line 696 "src/l.l"
+#line 732 "src/l.l"
 { /* got the include file name without quotes*/
                      char *temp=Str_dup(yytext);
                      include_file(temp);
@@ -4684,7 +4436,7 @@ case YY_STATE_EOF(URL_COND):
 case YY_STATE_EOF(STRING_COND):
 case YY_STATE_EOF(EVERY_COND):
 case YY_STATE_EOF(INCLUDE):
-#line 704 "src/l.l"
+#line 740 "src/l.l"
 {
 
                        if ( !pop_buffer_state() )
@@ -4695,12 +4447,12 @@ case YY_STATE_EOF(INCLUDE):
                        }
                   }
 	YY_BREAK
-case 270:
+case 296:
 YY_RULE_SETUP
-#line 714 "src/l.l"
+#line 750 "src/l.l"
 ECHO;
 	YY_BREAK
-#line 4704 "src/lex.yy.c"
+#line 4456 "src/lex.yy.c"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4959,7 +4711,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1298 )
+			if ( yy_current_state >= 1486 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4982,11 +4734,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1298 )
+		if ( yy_current_state >= 1486 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1297);
+	yy_is_jam = (yy_current_state == 1485);
 	if ( ! yy_is_jam )
 		*(yy_state_ptr)++ = yy_current_state;
 
@@ -5670,7 +5422,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 714 "src/l.l"
+#line 750 "src/l.l"
 
 
 
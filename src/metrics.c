@@ -0,0 +1,408 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#include "config.h"
+
+#ifdef HAVE_STDIO_H
+#include <stdio.h>
+#endif
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+#include "monit.h"
+#include "event.h"
+#include "resolver.h"
+#include "socket.h"
+#include "snapshot.h"
+
+
+/**
+ *  Prometheus text exposition format (version 0.0.4) of the service
+ *  status. The values are read directly from the service list, the
+ *  output is written in one pass per metric family since the format
+ *  requires all samples of a family to be grouped together.
+ *
+ *  @file
+ */
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+static const char *typenames[] = {"filesystem", "directory", "file", "process", "host", "system", "fifo", "program"};
+
+
+static struct {
+        long id;
+        const char *name;
+} events[] = {
+        {Event_Checksum,   "checksum"},
+        {Event_Resource,   "resource"},
+        {Event_Timeout,    "timeout"},
+        {Event_Timestamp,  "timestamp"},
+        {Event_Size,       "size"},
+        {Event_Connection, "connection"},
+        {Event_Permission, "permission"},
+        {Event_Uid,        "uid"},
+        {Event_Gid,        "gid"},
+        {Event_Nonexist,   "nonexist"},
+        {Event_Invalid,    "invalid"},
+        {Event_Data,       "data"},
+        {Event_Exec,       "exec"},
+        {Event_Fsflag,     "fsflags"},
+        {Event_Icmp,       "icmp"},
+        {Event_Content,    "content"},
+        {Event_Instance,   "instance"},
+        {Event_Action,     "action"},
+        {Event_Pid,        "pid"},
+        {Event_PPid,       "ppid"},
+        {Event_Heartbeat,  "heartbeat"},
+        {Event_Status,     "status"},
+        {Event_Uptime,     "uptime"},
+        {0, NULL}
+};
+
+
+#define HAS_STATUS(s) (Util_hasServiceStatus(s))
+#define HAS_PROCESS(s) ((s)->type == TYPE_PROCESS && Run.doprocess && HAS_STATUS(s) && (s)->inf->priv.process.pid > 0)
+#define HAS_FILESYSTEM(s) ((s)->type == TYPE_FILESYSTEM && HAS_STATUS(s) && (s)->inf->priv.filesystem.f_bsize > 0)
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+/**
+ * Prints the HELP and TYPE lines of a metric family
+ */
+static void family(StringBuffer_T B, const char *name, const char *type, const char *help) {
+        StringBuffer_append(B, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+
+/**
+ * Escape a label value into the given buffer. Backslash, double-quote
+ * and line feed must be escaped in the exposition format.
+ * @return The buffer
+ */
+static char *escape(const char *value, char *buf, int size) {
+        int i = 0;
+        for (const char *p = value ? value : ""; *p && i < size - 2; p++) {
+                if (*p == '\\' || *p == '"' || *p == '\n') {
+                        buf[i++] = '\\';
+                        buf[i++] = *p == '\n' ? 'n' : *p;
+                } else {
+                        buf[i++] = *p;
+                }
+        }
+        buf[i] = 0;
+        return buf;
+}
+
+
+/**
+ * Describe the connection test target as "host:port" or the unix socket path
+ * @return The buffer
+ */
+static char *port_target(Port_T p, char *buf, int size) {
+        char address[STRLEN];
+        if (p->family == AF_UNIX)
+                snprintf(address, sizeof(address), "%s", p->pathname ? p->pathname : "");
+        else
+                snprintf(address, sizeof(address), "%s:%d", p->hostname ? p->hostname : "", p->port);
+        return escape(address, buf, size);
+}
+
+
+/**
+ * Build the label set of each service once per scrape; the array is
+ * indexed in servicelist_conf order and NULL terminated
+ */
+static char **service_labels() {
+        int n = 0;
+        Service_T s;
+        char name[STRLEN];
+
+        for (s = servicelist_conf; s; s = s->next_conf)
+                n++;
+        char **labels = CALLOC(n + 1, sizeof(char *));
+        n = 0;
+        for (s = servicelist_conf; s; s = s->next_conf)
+                labels[n++] = Str_cat("service=\"%s\",type=\"%s\"", escape(s->name, name, sizeof(name)), typenames[s->type]);
+        return labels;
+}
+
+
+/**
+ * Take a consistent copy of each service once per scrape, the array is
+ * indexed like the labels and NULL terminated
+ */
+static Service_T *service_snapshots(Snapshot_T **snapshots) {
+        int n = 0;
+        Service_T s;
+
+        for (s = servicelist_conf; s; s = s->next_conf)
+                n++;
+        Service_T *services = CALLOC(n + 1, sizeof(Service_T));
+        *snapshots = CALLOC(n + 1, sizeof(Snapshot_T));
+        n = 0;
+        for (s = servicelist_conf; s; s = s->next_conf, n++)
+                services[n] = Snapshot_service(s, &(*snapshots)[n]);
+        return services;
+}
+
+
+static void status_monit(StringBuffer_T B) {
+        family(B, "monit_info", "gauge", "Monit version and instance");
+        StringBuffer_append(B, "monit_info{version=\"%s\",id=\"%s\"} 1\n", VERSION, Run.id ? Run.id : "");
+        family(B, "monit_uptime_seconds", "gauge", "Uptime of the Monit daemon");
+        StringBuffer_append(B, "monit_uptime_seconds %ld\n", (long)Util_getProcessUptime(Run.pidfile));
+        family(B, "monit_poll_interval_seconds", "gauge", "Polling cycle length");
+        StringBuffer_append(B, "monit_poll_interval_seconds %d\n", Run.polltime);
+        ResolverStatistics_T r;
+        Resolver_statistics(&r);
+        family(B, "monit_resolver_lookups_total", "counter", "Hostname lookups by result");
+        StringBuffer_append(B,
+                "monit_resolver_lookups_total{result=\"hit\"} %llu\n"
+                "monit_resolver_lookups_total{result=\"miss\"} %llu\n"
+                "monit_resolver_lookups_total{result=\"stale\"} %llu\n"
+                "monit_resolver_lookups_total{result=\"failed\"} %llu\n",
+                r.hits, r.misses, r.stale, r.failures);
+        family(B, "monit_resolver_entries", "gauge", "Hostnames in the resolver cache");
+        StringBuffer_append(B, "monit_resolver_entries %d\n", r.entries);
+        unsigned long long created, reused;
+        socket_pool_statistics(&created, &reused);
+        family(B, "monit_connections_total", "counter", "Outgoing connections by origin");
+        StringBuffer_append(B,
+                "monit_connections_total{origin=\"new\"} %llu\n"
+                "monit_connections_total{origin=\"pool\"} %llu\n",
+                created, reused);
+}
+
+
+static void status_service(StringBuffer_T B, Service_T *services, char **labels) {
+        Service_T s;
+        int i;
+
+        family(B, "monit_service_monitored", "gauge", "1 if the service is monitored, 2 while initializing, 0 otherwise");
+        for (i = 0; (s = services[i]); i++)
+                StringBuffer_append(B, "monit_service_monitored{%s} %d\n", labels[i], s->monitor & MONITOR_YES ? 1 : s->monitor & MONITOR_INIT ? 2 : 0);
+        family(B, "monit_service_status", "gauge", "Bitmap of the failed events of the service, 0 if ok");
+        for (i = 0; (s = services[i]); i++)
+                StringBuffer_append(B, "monit_service_status{%s} %d\n", labels[i], s->error);
+        family(B, "monit_service_failed", "gauge", "Failed event of the service, only present while the event is failed");
+        for (i = 0; (s = services[i]); i++)
+                if (s->error)
+                        for (int e = 0; events[e].name; e++)
+                                if (IS_EVENT_SET(s->error, events[e].id))
+                                        StringBuffer_append(B, "monit_service_failed{%s,event=\"%s\"} 1\n", labels[i], events[e].name);
+        family(B, "monit_service_check_duration_seconds", "gauge", "Duration of the last check of the service");
+        for (i = 0; (s = services[i]); i++)
+                if (s->collected.tv_sec)
+                        StringBuffer_append(B, "monit_service_check_duration_seconds{%s} %.6f\n", labels[i], s->duration / 1000000.);
+        family(B, "monit_service_last_check_timestamp_seconds", "gauge", "Time of the last check of the service");
+        for (i = 0; (s = services[i]); i++)
+                if (s->collected.tv_sec)
+                        StringBuffer_append(B, "monit_service_last_check_timestamp_seconds{%s} %ld.%06ld\n", labels[i], (long)s->collected.tv_sec, (long)s->collected.tv_usec);
+}
+
+
+static void status_process(StringBuffer_T B, Service_T *services, char **labels) {
+        Service_T s;
+        int i;
+
+        family(B, "monit_process_cpu_percent", "gauge", "CPU usage of the process");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_PROCESS(s))
+                        StringBuffer_append(B, "monit_process_cpu_percent{%s} %.1f\n", labels[i], s->inf->priv.process.cpu_percent / 10.);
+        family(B, "monit_process_cpu_total_percent", "gauge", "CPU usage of the process and its children");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_PROCESS(s))
+                        StringBuffer_append(B, "monit_process_cpu_total_percent{%s} %.1f\n", labels[i], s->inf->priv.process.total_cpu_percent / 10.);
+        family(B, "monit_process_memory_bytes", "gauge", "Resident memory of the process");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_PROCESS(s))
+                        StringBuffer_append(B, "monit_process_memory_bytes{%s} %lld\n", labels[i], (long long)s->inf->priv.process.mem_kbyte * 1024);
+        family(B, "monit_process_memory_total_bytes", "gauge", "Resident memory of the process and its children");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_PROCESS(s))
+                        StringBuffer_append(B, "monit_process_memory_total_bytes{%s} %lld\n", labels[i], (long long)s->inf->priv.process.total_mem_kbyte * 1024);
+        family(B, "monit_process_children", "gauge", "Number of child processes");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_PROCESS(s))
+                        StringBuffer_append(B, "monit_process_children{%s} %d\n", labels[i], s->inf->priv.process.children);
+        family(B, "monit_process_uptime_seconds", "gauge", "Uptime of the process");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_PROCESS(s))
+                        StringBuffer_append(B, "monit_process_uptime_seconds{%s} %ld\n", labels[i], (long)s->inf->priv.process.uptime);
+}
+
+
+static void status_port(StringBuffer_T B, Service_T *services, char **labels) {
+        Service_T s;
+        int i;
+        char target[STRLEN];
+
+        family(B, "monit_port_up", "gauge", "1 if the last connection test succeeded");
+        for (i = 0; (s = services[i]); i++) {
+                if (! HAS_STATUS(s))
+                        continue;
+                for (Port_T p = s->portlist; p; p = p->next)
+                        StringBuffer_append(B, "monit_port_up{%s,target=\"%s\",protocol=\"%s\"} %d\n", labels[i], port_target(p, target, sizeof(target)), p->protocol->name ? p->protocol->name : "", p->is_available ? 1 : 0);
+        }
+        family(B, "monit_port_response_seconds", "gauge", "Response time of the last successful connection test");
+        for (i = 0; (s = services[i]); i++) {
+                if (! HAS_STATUS(s))
+                        continue;
+                for (Port_T p = s->portlist; p; p = p->next)
+                        if (p->is_available && p->response >= 0)
+                                StringBuffer_append(B, "monit_port_response_seconds{%s,target=\"%s\",protocol=\"%s\"} %.6f\n", labels[i], port_target(p, target, sizeof(target)), p->protocol->name ? p->protocol->name : "", p->response);
+        }
+        family(B, "monit_port_phase_seconds", "gauge", "Response time phases of the last successful connection test");
+        for (i = 0; (s = services[i]); i++) {
+                if (! HAS_STATUS(s))
+                        continue;
+                for (Port_T p = s->portlist; p; p = p->next)
+                        for (int j = TIMING_RESOLVE; j < TIMING_PHASES; j++)
+                                if (p->is_available && p->timing[j] >= 0)
+                                        StringBuffer_append(B, "monit_port_phase_seconds{%s,target=\"%s\",protocol=\"%s\",phase=\"%s\"} %.6f\n", labels[i], port_target(p, target, sizeof(target)), p->protocol->name ? p->protocol->name : "", timingnames[j], p->timing[j]);
+        }
+        family(B, "monit_icmp_response_seconds", "gauge", "Response time of the last successful ping test");
+        for (i = 0; (s = services[i]); i++) {
+                if (! HAS_STATUS(s))
+                        continue;
+                for (Icmp_T p = s->icmplist; p; p = p->next)
+                        if (p->is_available && p->response >= 0)
+                                StringBuffer_append(B, "monit_icmp_response_seconds{%s} %.6f\n", labels[i], p->response);
+        }
+}
+
+
+static void status_filesystem(StringBuffer_T B, Service_T *services, char **labels) {
+        Service_T s;
+        int i;
+
+        family(B, "monit_filesystem_used_percent", "gauge", "Used space of the filesystem");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_FILESYSTEM(s))
+                        StringBuffer_append(B, "monit_filesystem_used_percent{%s} %.1f\n", labels[i], s->inf->priv.filesystem.space_percent / 10.);
+        family(B, "monit_filesystem_used_bytes", "gauge", "Used space of the filesystem");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_FILESYSTEM(s))
+                        StringBuffer_append(B, "monit_filesystem_used_bytes{%s} %lld\n", labels[i], (long long)s->inf->priv.filesystem.space_total * s->inf->priv.filesystem.f_bsize);
+        family(B, "monit_filesystem_size_bytes", "gauge", "Size of the filesystem");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_FILESYSTEM(s))
+                        StringBuffer_append(B, "monit_filesystem_size_bytes{%s} %lld\n", labels[i], (long long)s->inf->priv.filesystem.f_blocks * s->inf->priv.filesystem.f_bsize);
+        family(B, "monit_filesystem_inodes_used_percent", "gauge", "Used inodes of the filesystem");
+        for (i = 0; (s = services[i]); i++)
+                if (HAS_FILESYSTEM(s) && s->inf->priv.filesystem.f_files > 0)
+                        StringBuffer_append(B, "monit_filesystem_inodes_used_percent{%s} %.1f\n", labels[i], s->inf->priv.filesystem.inode_percent / 10.);
+}
+
+
+static void status_program(StringBuffer_T B, Service_T *services, char **labels) {
+        Service_T s;
+        int i;
+
+        family(B, "monit_program_exit_status", "gauge", "Exit status of the last program run");
+        for (i = 0; (s = services[i]); i++)
+                if (s->type == TYPE_PROGRAM && s->program->started)
+                        StringBuffer_append(B, "monit_program_exit_status{%s} %d\n", labels[i], s->program->exitStatus);
+}
+
+
+static void status_system(StringBuffer_T B) {
+        SystemInfo_T si;
+
+        if (! Run.doprocess)
+                return;
+        Snapshot_system(&si);
+        family(B, "monit_system_load", "gauge", "System load average");
+        StringBuffer_append(B,
+                "monit_system_load{period=\"1m\"} %.2f\n"
+                "monit_system_load{period=\"5m\"} %.2f\n"
+                "monit_system_load{period=\"15m\"} %.2f\n",
+                si.loadavg[0], si.loadavg[1], si.loadavg[2]);
+        family(B, "monit_system_cpu_percent", "gauge", "System CPU usage by mode");
+        StringBuffer_append(B, "monit_system_cpu_percent{mode=\"user\"} %.1f\n", si.total_cpu_user_percent > 0 ? si.total_cpu_user_percent / 10. : 0);
+        StringBuffer_append(B, "monit_system_cpu_percent{mode=\"system\"} %.1f\n", si.total_cpu_syst_percent > 0 ? si.total_cpu_syst_percent / 10. : 0);
+#ifdef HAVE_CPU_WAIT
+        StringBuffer_append(B, "monit_system_cpu_percent{mode=\"wait\"} %.1f\n", si.total_cpu_wait_percent > 0 ? si.total_cpu_wait_percent / 10. : 0);
+#endif
+        if (si.total_cpu_steal_percent >= 0)
+                StringBuffer_append(B, "monit_system_cpu_percent{mode=\"steal\"} %.1f\n", si.total_cpu_steal_percent / 10.);
+        if (si.total_cpu_irq_percent >= 0)
+                StringBuffer_append(B, "monit_system_cpu_percent{mode=\"irq\"} %.1f\n", si.total_cpu_irq_percent / 10.);
+        family(B, "monit_system_memory_bytes", "gauge", "Used system memory");
+        StringBuffer_append(B, "monit_system_memory_bytes %lld\n", (long long)si.total_mem_kbyte * 1024);
+        family(B, "monit_system_memory_percent", "gauge", "Used system memory");
+        StringBuffer_append(B, "monit_system_memory_percent %.1f\n", si.total_mem_percent / 10.);
+        family(B, "monit_system_swap_bytes", "gauge", "Used swap");
+        StringBuffer_append(B, "monit_system_swap_bytes %lld\n", (long long)si.total_swap_kbyte * 1024);
+        family(B, "monit_system_swap_percent", "gauge", "Used swap");
+        StringBuffer_append(B, "monit_system_swap_percent %.1f\n", si.total_swap_percent / 10.);
+        FREE(si.cpu_percent);
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+/**
+ * Get the status of the monitored services and of the system in the
+ * Prometheus text exposition format
+ * @param B StringBuffer object
+ */
+void status_metrics(StringBuffer_T B) {
+        char **labels = service_labels();
+        Snapshot_T *snapshots;
+        Service_T *services = service_snapshots(&snapshots);
+
+        status_monit(B);
+        status_service(B, services, labels);
+        status_process(B, services, labels);
+        status_port(B, services, labels);
+        status_filesystem(B, services, labels);
+        status_program(B, services, labels);
+        status_system(B);
+        for (int i = 0; labels[i]; i++)
+                FREE(labels[i]);
+        FREE(labels);
+        for (int i = 0; services[i]; i++)
+                Snapshot_free(&snapshots[i]);
+        FREE(services);
+        FREE(snapshots);
+}
+
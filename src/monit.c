@@ -70,12 +70,16 @@
 #include <sys/wait.h>
 #endif
 
+#include <sys/select.h>
+
 #include "monit.h"
 #include "net.h"
 #include "ssl.h"
 #include "process.h"
 #include "state.h"
 #include "event.h"
+#include "watch.h"
+#include "snapshot.h"
 
 // libmonit
 #include "Bootstrap.h"
@@ -134,7 +138,7 @@ ProcessTree_T *oldptree = NULL;
 
 char *actionnames[] = {"ignore", "alert", "restart", "stop", "exec", "unmonitor", "start", "monitor", ""};
 char *modenames[] = {"active", "passive", "manual"};
-char *checksumnames[] = {"UNKNOWN", "MD5", "SHA1"};
+char *checksumnames[] = {"UNKNOWN", "MD5", "SHA1", "SHA256", "XXH64"};
 char *operatornames[] = {"greater than", "less than", "equal to", "not equal to"};
 char *operatorshortnames[] = {">", "<", "=", "!="};
 char *statusnames[] = {"Accessible", "Accessible", "Accessible", "Running", "Online with all services", "Running", "Accessible", "Status ok"};
@@ -142,6 +146,11 @@ char *servicetypes[] = {"Filesystem", "Directory", "File", "Process", "Remote Ho
 char *pathnames[] = {"Path", "Path", "Path", "Pid file", "Path", "", "Path"};
 char *icmpnames[] = {"Echo Reply", "", "", "Destination Unreachable", "Source Quench", "Redirect", "", "", "Echo Request", "", "", "Time Exceeded", "Parameter Problem", "Timestamp Request", "Timestamp Reply", "Information Request", "Information Reply", "Address Mask Request", "Address Mask Reply"};
 char *sslnames[] = {"auto", "v2", "v3", "tls"};
+char *historymetricnames[] = {"cpu", "totalcpu", "memory", "totalmemory", "children", "loadavg", "swap", "response"};
+char *profiletestnames[] = {"check", "connection", "match", "checksum", "tree"};
+char *treemetricnames[] = {"files", "size", "oldest", "newest"};
+char *timingnames[] = {"response", "resolve", "connect", "tls", "first byte"};
+char *profilephasenames[] = {"collect", "checks", "events", "cycle"};
 
 
 
@@ -270,6 +279,7 @@ static void do_init() {
         /*
          * Initialize the process information gathering interface
          */
+        Run.procfs = "/proc";
         Run.doprocess = init_process_info();
 
         /*
@@ -352,6 +362,9 @@ static void do_reinit() {
 
         Run.doreload = FALSE;
 
+        /* Stop the process watcher, the watched services are freed by gc */
+        Watch_stop();
+
         /* Stop http interface */
         if (Run.dohttpd)
                 monit_http(STOP_HTTP);
@@ -393,6 +406,7 @@ static void do_reinit() {
         if (! State_open())
                 exit(1);
         State_update();
+        Snapshot_init();
 
         /* Start http interface */
         if (can_http())
@@ -405,6 +419,8 @@ static void do_reinit() {
                 LogError("%s: Failed to create the heartbeat thread -- %s\n", prog, strerror(status));
         else
                 heartbeatRunning = TRUE;
+
+        Watch_start();
 }
 
 
@@ -426,9 +442,13 @@ static void do_action(char **args) {
                    IS(action, "restart")) {
                 if (Run.mygroup || service) {
                         int errors = 0;
-                        int (*_control_service)(const char *, const char *) = exist_daemon() ? control_service_daemon : control_service_string;
+                        int daemon = exist_daemon();
+                        int (*_control_service)(const char *, const char *) = daemon ? control_service_daemon : control_service_string;
 
-                        if (Run.mygroup) {
+                        /* The daemon schedules a group or all services in one request */
+                        if (daemon && (Run.mygroup || IS(service, "all"))) {
+                                errors = control_group_daemon(Run.mygroup, action) ? 0 : 1;
+                        } else if (Run.mygroup) {
                                 ServiceGroup_T sg = NULL;
 
                                 for (sg = servicegrouplist; sg; sg = sg->next) {
@@ -478,6 +498,8 @@ static void do_action(char **args) {
         } else if (IS(action, "validate")) {
                 if (! validate())
                         exit(1);
+        } else if (IS(action, "benchmark")) {
+                benchmark(service ? atoi(service) : 10, service ? args[optind + 1] : NULL);
         } else {
                 LogError("%s: invalid argument -- %s  (-h will show valid arguments)\n", prog, action);
                 exit(1);
@@ -506,6 +528,8 @@ static void do_exit() {
                         heartbeatRunning = FALSE;
                 }
 
+                Watch_stop();
+
                 LogInfo("%s daemon with pid [%d] killed\n", prog, (int)getpid());
 
                 /* send the monit stop notification */
@@ -550,6 +574,7 @@ static void do_default() {
                 if (! State_open())
                         exit(1);
                 State_update();
+                Snapshot_init();
 
                 atexit(file_finalize);
 
@@ -577,13 +602,38 @@ static void do_default() {
                 else
                         heartbeatRunning = TRUE;
 
+                Watch_start();
+
                 while (TRUE) {
                         validate();
                         State_save();
 
-                        /* In the case that there is no pending action then sleep */
-                        if (!Run.doaction)
-                                sleep(Run.polltime);
+                        /* In the case that there is no pending action then sleep. If the process watcher
+                         * interrupts the sleep, the exited processes and programs are checked and the sleep continues.
+                         * The signals are blocked while the flags are tested and pselect() unblocks them atomically,
+                         * so a signal arriving just before the sleep is not lost until the next cycle */
+                        if (!Run.doaction) {
+                                sigset_t ns, os;
+                                time_t now = time(NULL), wakeup = now + Run.polltime;
+                                sigemptyset(&ns);
+                                sigaddset(&ns, SIGTERM);
+                                sigaddset(&ns, SIGINT);
+                                sigaddset(&ns, SIGHUP);
+                                sigaddset(&ns, SIGUSR1);
+                                sigaddset(&ns, SIGUSR2);
+                                pthread_sigmask(SIG_BLOCK, &ns, &os);
+                                while (now < wakeup && ! (Run.dowakeup || Run.doaction || Run.doreload || Run.stopped)) {
+                                        if (Watch_pending()) {
+                                                validate_exited();
+                                                State_save();
+                                        } else {
+                                                struct timespec timeout = {wakeup - now, 0};
+                                                pselect(0, NULL, NULL, NULL, &timeout, &os);
+                                        }
+                                        now = time(NULL);
+                                }
+                                pthread_sigmask(SIG_SETMASK, &os, NULL);
+                        }
 
                         if (Run.dowakeup) {
                                 Run.dowakeup = FALSE;
@@ -739,6 +789,7 @@ static void help() {
         printf(" quit                - Kill monit daemon process\n");
         printf(" validate            - Check all services and start if not running\n");
         printf(" procmatch <pattern> - Test process matching pattern\n");
+        printf(" benchmark [n [proc]]- Time n check cycles, optionally with a fake /proc\n");
         printf("\n");
         printf("(Action arguments operate on services defined in the control file)\n");
 }
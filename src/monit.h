@@ -81,6 +81,7 @@
 #include "socket.h"
 
 // libmonit
+#include "system/Arena.h"
 #include "system/Command.h"
 #include "system/Process.h"
 #include "util/Str.h"
@@ -121,6 +122,8 @@
 
 #define SSL_TIMEOUT        15
 #define SMTP_TIMEOUT       30
+#define KEEPALIVE_TIMEOUT  60
+#define SESSION_TIMEOUT    300
 
 #define START_DELAY        0
 #define EXEC_TIMEOUT       30
@@ -197,6 +200,39 @@
 #define RESOURCE_ID_TOTAL_CPU_PERCENT 15
 #define RESOURCE_ID_SWAP_PERCENT      16
 #define RESOURCE_ID_SWAP_KBYTE        17
+#define RESOURCE_ID_CPUSTEAL          18
+#define RESOURCE_ID_CPUIRQ            19
+#define RESOURCE_ID_PRESSURE_CPU      20
+#define RESOURCE_ID_PRESSURE_MEMORY   21
+#define RESOURCE_ID_PRESSURE_IO       22
+
+#define HISTORY_CPU           0                    /**< CPU usage [percent * 10] */
+#define HISTORY_TOTALCPU      1                    /**< CPU usage incl. children */
+#define HISTORY_MEMORY        2                          /**< Memory usage [kB] */
+#define HISTORY_TOTALMEMORY   3                 /**< Memory usage incl. children */
+#define HISTORY_CHILDREN      4                          /**< Number of children */
+#define HISTORY_LOADAVG       5                        /**< 1 min load average * 10 */
+#define HISTORY_SWAP          6                            /**< Swap usage [kB] */
+#define HISTORY_RESPONSE      7         /**< Slowest port response time [us] */
+#define HISTORY_METRICS       8
+/* Number of samples kept per metric */
+#define HISTORY_SIZE          128
+
+#define TREND_AVERAGE      1
+#define TREND_PERCENTILE   2
+#define TREND_SLOPE        3
+
+#define TREE_FILES         0                        /**< Number of regular files */
+#define TREE_SIZE          1                       /**< Total size of the files [B] */
+#define TREE_OLDEST        2                    /**< Age of the oldest file [s] */
+#define TREE_NEWEST        3                    /**< Age of the newest file [s] */
+
+#define TIMING_RESPONSE    0                  /**< Total connection test time */
+#define TIMING_RESOLVE     1                          /**< Hostname lookup */
+#define TIMING_CONNECT     2                   /**< TCP or unix socket connect */
+#define TIMING_TLS         3                            /**< TLS handshake */
+#define TIMING_FIRSTBYTE   4  /**< Protocol test start until the first byte */
+#define TIMING_PHASES      5
 
 #define DIGEST_CLEARTEXT   1
 #define DIGEST_CRYPT       2
@@ -211,6 +247,8 @@
 #define HASH_UNKNOWN       0
 #define HASH_MD5           1
 #define HASH_SHA1          2
+#define HASH_SHA256        3
+#define HASH_XXH64         4
 #define DEFAULT_HASH       HASH_MD5   
 /* Length of the longest message digest in bytes */
 #define MD_SIZE            65
@@ -396,7 +434,6 @@ typedef struct myprocesstree {
         time_t        starttime;
         char         *cmdline;
 
-        int           visited;
         int           children_num;
         int           children_sum;
         int           cpu_percent;
@@ -411,10 +448,18 @@ typedef struct myprocesstree {
         long          cputime_prev;                              /**< 1/10 seconds */
 
         int           parent;
-        int          *children;
 } ProcessTree_T;
 
 
+/** Defines pressure stall information for one resource (percentage * 10) */
+typedef struct mypressure {
+        int some_avg10;        /**< Some tasks stalled, 10 seconds average */
+        int some_avg60;        /**< Some tasks stalled, 60 seconds average */
+        int full_avg10;         /**< All tasks stalled, 10 seconds average */
+        int full_avg60;         /**< All tasks stalled, 60 seconds average */
+} Pressure_T;
+
+
 /** Defines data for systemwide statistic */
 typedef struct mysysteminfo {
         struct timeval collected;                    /**< When were data collected */
@@ -429,6 +474,12 @@ typedef struct mysysteminfo {
         int    total_cpu_user_percent;   /**< Total CPU in use in user space (pct.)*/
         int    total_cpu_syst_percent; /**< Total CPU in use in kernel space (pct.)*/
         int    total_cpu_wait_percent;      /**< Total CPU in use in waiting (pct.)*/
+        int    total_cpu_steal_percent;  /**< Total CPU stolen by hypervisor (pct.)*/
+        int    total_cpu_irq_percent;   /**< Total CPU in hard/soft interrupts (pct.)*/
+        int   *cpu_percent;         /**< Per-CPU usage (pct.), systeminfo.cpus slots */
+        Pressure_T pressure_cpu;                     /**< CPU pressure stall info */
+        Pressure_T pressure_memory;               /**< Memory pressure stall info */
+        Pressure_T pressure_io;                       /**< I/O pressure stall info */
         struct utsname uname;        /**< Platform information provided by uname() */
 } SystemInfo_T;
 
@@ -469,7 +520,8 @@ typedef struct myport {
         int timeout;   /**< The timeout in seconds to wait for connect or read i/o */
         int retry;       /**< Number of connection retry before reporting an error */
         int is_available;                /**< TRUE if the server/port is available */
-        double response;                      /**< Socket connection response time */
+        double response;                  /**< Socket connection response time [s] */
+        double timing[TIMING_PHASES];     /**< Response time phases [s], -1 = n/a */
         EventAction_T action;  /**< Description of the action upon event occurence */
         /** Apache-status specific parameters */
         struct apache_status {
@@ -625,6 +677,66 @@ typedef struct mysize {
 } *Size_T;
 
 
+/** Defines trend object, evaluated on the service metrics history */
+typedef struct mytrend {
+        int  metric;                           /**< History metric (HISTORY_*) */
+        int  function;                           /**< Aggregate function (TREND_*) */
+        int  percentile;              /**< Percentile rank if TREND_PERCENTILE */
+        int  cycles;                        /**< Number of latest samples to use */
+        int  operator;                                    /**< Comparison operator */
+        long long limit;  /**< Limit in metric unit, for TREND_SLOPE percent * 10 */
+        EventAction_T action;  /**< Description of the action upon event occurence */
+
+        /** For internal use */
+        struct mytrend *next;                             /**< next trend in chain */
+} *Trend_T;
+
+
+/** Defines connection timing object, evaluated on the slowest port */
+typedef struct mytiming {
+        int  phase;                                /**< Timing phase (TIMING_*) */
+        int  operator;                                    /**< Comparison operator */
+        long long limit;                                            /**< Limit [us] */
+        EventAction_T action;  /**< Description of the action upon event occurence */
+
+        /** For internal use */
+        struct mytiming *next;                           /**< next timing in chain */
+} *Timing_T;
+
+
+/** Defines directory tree object, evaluated on the files below a directory */
+typedef struct mytree {
+        int  metric;                                /**< Tree metric (TREE_*) */
+        char *pattern;         /**< Shell pattern of the file names or NULL (all) */
+        int  filter;          /**< Index of the pattern in the tree scan, 0 = all */
+        int  operator;                                    /**< Comparison operator */
+        unsigned long long limit;      /**< Limit in the unit of the metric [B, s] */
+        EventAction_T action;  /**< Description of the action upon event occurence */
+
+        /** For internal use */
+        struct mytree *next;                               /**< next tree in chain */
+} *Tree_T;
+
+
+/** Aggregate of the regular files in a directory tree */
+typedef struct mytreestat {
+        unsigned long long files;                           /**< Number of files */
+        unsigned long long size;                   /**< Total size of the files */
+        time_t oldest;            /**< Modification time of the oldest file or 0 */
+        time_t newest;            /**< Modification time of the newest file or 0 */
+} TreeStat_T;
+
+
+/** Opaque directory tree cache object, see dirtree.h */
+typedef struct mydirtree *Dirtree_T;
+
+/** Opaque metrics history object, see history.h */
+typedef struct myhistory *History_T;
+
+/** Opaque check latency profile object, see profile.h */
+typedef struct myprofile *Profile_T;
+
+
 /** Defines uptime object */
 typedef struct myuptime {
         int  operator;                                    /**< Comparison operator */
@@ -730,6 +842,12 @@ typedef struct myinfo {
                         MD_T  cs_sum;                                            /**< Checksum */
                 } file;
 
+                struct {
+                        TreeStat_T    tree;                   /**< All files of the tree */
+                        unsigned long directories;      /**< Number of directories */
+                        unsigned long reread;   /**< Directories read in the last scan */
+                } directory;
+
                 struct {
                         int    _pid;                          /**< Process PID from last cycle */
                         int    _ppid;                  /**< Process parent PID from last cycle */
@@ -744,6 +862,12 @@ typedef struct myinfo {
                         int    cpu_percent;                               /**< percentage * 10 */
                         int    total_cpu_percent;                         /**< percentage * 10 */
                         time_t uptime;                                     /**< Process uptime */
+                        int    cgroup_pids;              /**< Number of tasks in the cgroup */
+                        unsigned long long cgroup_cpu_usec;   /**< cgroup CPU usage [us] */
+                        unsigned long long cgroup_io_rbytes;  /**< cgroup bytes read */
+                        unsigned long long cgroup_io_wbytes;  /**< cgroup bytes written */
+                        double cgroup_time;        /**< When was the cgroup sampled [1/10s] */
+                        int    cgroup_error;           /**< TRUE if the cgroup read failed */
                 } process;
         } priv;
 } *Info_T;
@@ -767,6 +891,7 @@ typedef struct myservice {
         command_t stop;                      /**< The stop command for the service */
         command_t restart;                /**< The restart command for the service */
         Program_T program;                            /**< Program execution check */
+        char *cgroup;              /**< cgroup v2 path used for resource accounting */
 
         Dependant_T dependantlist;                     /**< Dependant service list */
         Mail_T      maillist;                  /**< Alert notification mailinglist */
@@ -787,6 +912,10 @@ typedef struct myservice {
         Timestamp_T timestamplist;                       /**< Timestamp check list */
         Uid_T       uid;                                            /**< Uid check */
         Status_T    statuslist;           /**< Program execution status check list */
+        Trend_T     trendlist;                       /**< Metrics trend check list */
+        Timing_T    timinglist;             /**< Connection timing check list */
+        Tree_T      treelist;                   /**< Directory tree check list */
+        int         treerefresh;   /**< Cycles between full tree reads, 0 = default */
 
 
         EventAction_T action_PID;                      /**< Action upon pid change */
@@ -809,10 +938,36 @@ typedef struct myservice {
         int                error;                          /**< Error flags bitmap */
         int                error_hint;   /**< Failed/Changed hint for error bitmap */
         Info_T             inf;                          /**< Service check result */
+        History_T          history;           /**< Metrics history, NULL if none */
+        Profile_T          profile;  /**< Check latency histograms, NULL if none */
+        Dirtree_T          dirtree;      /**< Directory tree cache, NULL if none */
         struct timeval     collected;                /**< When were data collected */
+        long long          duration;         /**< Duration of the last check [us] */
         int                doaction;          /**< Action scheduled by http thread */
         char              *token;                                /**< Action token */
 
+        /** Result of the last check, published for the http and heartbeat threads */
+        struct mypublished {
+                unsigned int   sequence;    /**< Seqlock counter, odd during publish */
+                int            monitor;                      /**< Monitor state flag */
+                int            error;                        /**< Error flags bitmap */
+                int            error_hint; /**< Failed/Changed hint for error bitmap */
+                struct myinfo  inf;                        /**< Service check result */
+                struct timeval collected;              /**< When were data collected */
+                long long      duration;       /**< Duration of the last check [us] */
+                time_t         started;          /**< When the program was started */
+                int            exitStatus;              /**< The program exit status */
+                struct myportresult {
+                        int    is_available;  /**< TRUE if the server/port is available */
+                        double response;           /**< Connection response time [s] */
+                        double timing[TIMING_PHASES];   /**< Response time phases [s] */
+                } *port;                          /**< Results in portlist order */
+                struct myicmpresult {
+                        int    is_available;       /**< TRUE if the server is available */
+                        double response;                  /**< ICMP ECHO response time */
+                } *icmp;                          /**< Results in icmplist order */
+        } published;
+
         /** Events */
         struct myevent {
                 #define           EVENT_VERSION  3      /**< The event structure version */
@@ -876,6 +1031,8 @@ struct myrun {
         int  facility;              /** The facility to use when running openlog() */
         int  doprocess;                 /**< TRUE if process status engine is used */
         char *bind_addr;                  /**< The address monit http will bind to */
+        char *httpdsocket;          /**< The monit http server's local UNIX socket */
+        int  httpdsession; /**< Lifetime of http session cookies in seconds or 0 */
         volatile int  doreload;    /**< TRUE if a monit daemon should reinitialize */
         volatile int  dowakeup;  /**< TRUE if a monit daemon was wake up by signal */
         int  doaction;             /**< TRUE if some service(s) has action pending */
@@ -889,6 +1046,19 @@ struct myrun {
         char *eventlist_dir;                   /**< The event queue base directory */
         int  eventlist_slots;          /**< The event queue size - number of slots */
         int  expectbuffer; /**< Generic protocol expect buffer - STRLEN by default */
+        int  keepalive;  /**< Idle timeout of pooled HTTP connections, 0 if off */
+        int  pidwatch;   /**< TRUE if process exits are watched between cycles */
+        int  concurrency;  /**< Max. services started or stopped in parallel */
+        char *procfs;          /**< The proc filesystem mountpoint, /proc default */
+        Arena_T arena;        /**< Memory of the configuration, released by gc() */
+
+        /** Duration of the phases of the last validate() cycle in microseconds */
+        struct mycycle {
+                long long prepare;  /**< Resolver, connection pool and system load */
+                long long collect;                          /**< The process tree */
+                long long check;                /**< Service checks incl. events */
+                long long event;           /**< Event handling and queue processing */
+        } cycle;
 
         /** An object holding program relevant "environment" data, see: env.c */
         struct myenvironment {
@@ -944,6 +1114,11 @@ extern char *servicetypes[];
 extern char *pathnames[];
 extern char *icmpnames[];
 extern char *sslnames[];
+extern char *historymetricnames[];
+extern char *profiletestnames[];
+extern char *treemetricnames[];
+extern char *timingnames[];
+extern char *profilephasenames[];
 
 /* ------------------------------------------------------- Public prototypes */
 
@@ -960,7 +1135,9 @@ int   parse(char *);
 int   control_service(const char *, int);
 int   control_service_string(const char *, const char *);
 int   control_service_daemon(const char *, const char *);
+int   control_group_daemon(const char *, const char *);
 void  setup_dependants();
+void  control_batch();
 void  reset_depend();
 void  spawn(Service_T, command_t, Event_T);
 int   status(char *);
@@ -982,6 +1159,8 @@ void vsyslog (int, const char *, va_list);
 #endif /* HAVE_SYSLOG */
 #endif /* HAVE_VSYSLOG */
 int   validate();
+void  validate_exited();
+void  benchmark(int, const char *);
 void  daemonize();
 void  gc();
 void  gc_mail_list(Mail_T *);
@@ -1014,6 +1193,9 @@ void reset_procinfo(Service_T);
 int  check_service_status(Service_T);
 void printhash(char *);  
 void status_xml(StringBuffer_T, Event_T, short, int, const char *);
+void history_xml(StringBuffer_T, const char *);
+void profile_xml(StringBuffer_T, const char *);
+void status_metrics(StringBuffer_T);
 int  handle_mmonit(Event_T);
 int  do_wakeupcall();
 
@@ -137,6 +137,8 @@
 #include "monit.h"
 #include "net.h"
 #include "ssl.h"
+#include "resolver.h"
+#include "util.h"
 
 /**
  *  General purpose Network and Socket methods.
@@ -190,6 +192,39 @@ static int do_connect(int s, const struct sockaddr *addr, socklen_t addrlen, int
 }
 
 
+/*
+ * Create a non-blocking socket of the given type and connect it to the
+ * resolved address
+ */
+static int connect_inet(struct sockaddr_in *sin, int port, int type, int timeout) {
+  int s;
+
+  if((s= socket(AF_INET, type, 0)) < 0) {
+    return -1;
+  }
+
+  sin->sin_family= AF_INET;
+  sin->sin_port= htons(port);
+
+  if(! set_noblock(s)) {
+    goto error;
+  }
+
+  if(fcntl(s, F_SETFD, FD_CLOEXEC) == -1)
+    goto error; 
+
+  if(do_connect(s, (struct sockaddr *)sin, sizeof(*sin), timeout) < 0) {
+    goto error;
+  }
+
+  return s;
+
+  error:
+  close_socket(s);
+  return -1;
+}
+
+
 /*
  * Compute Internet Checksum for "count" bytes beginning at location "addr".
  * Based on RFC1071.
@@ -244,20 +279,11 @@ static int can_read_ms(int socket, int ms) {
  */
 int check_host(const char *hostname) {
 
-  struct addrinfo hints;
-  struct addrinfo *res;
+  struct sockaddr_in sin;
 
   ASSERT(hostname);
 
-  memset(&hints, 0, sizeof(struct addrinfo));
-  hints.ai_family = PF_INET; /* we support just IPv4 currently */
-
-  if(getaddrinfo(hostname, NULL, &hints, &res) != 0)
-    return FALSE;
-
-  freeaddrinfo(res);
-
-  return TRUE;
+  return Resolver_getAddress(hostname, &sin) == 0;
 
 }
 
@@ -316,47 +342,16 @@ int check_udp_socket(int socket) {
  */
 int create_socket(const char *hostname, int port, int type, int timeout) {
 
-  int s;
   struct sockaddr_in sin;
-  struct sockaddr_in *sa;
-  struct addrinfo hints;
-  struct addrinfo *result;
 
   ASSERT(hostname);
 
-  memset(&hints, 0, sizeof(struct addrinfo));
-  hints.ai_family = AF_INET;
-  if(getaddrinfo(hostname, NULL, &hints, &result) != 0) {
-    return -1;
-  }
-
-  if((s= socket(AF_INET, type, 0)) < 0) {
-    freeaddrinfo(result);
+  memset(&sin, 0, sizeof(sin));
+  if(Resolver_getAddress(hostname, &sin) != 0) {
     return -1;
   }
 
-  sa = (struct sockaddr_in *)result->ai_addr;
-  memcpy(&sin, sa, result->ai_addrlen);
-  sin.sin_family= AF_INET;
-  sin.sin_port= htons(port);
-  freeaddrinfo(result);
-
-  if(! set_noblock(s)) {
-    goto error;
-  }
-
-  if(fcntl(s, F_SETFD, FD_CLOEXEC) == -1)
-    goto error; 
-
-  if(do_connect(s, (struct sockaddr *)&sin, sizeof(sin), timeout) < 0) {
-    goto error;
-  }
-
-  return s;
-
-  error:
-  close_socket(s);
-  return -1;
+  return connect_inet(&sin, port, type, timeout);
 
 }
 
@@ -365,11 +360,14 @@ int create_socket(const char *hostname, int port, int type, int timeout) {
  * Open a socket using the given Port_T structure. The protocol,
  * destination and type are selected appropriately.
  * @param p connection description
+ * @param timing Output of the hostname lookup and connect time [s]
  * @return The socket or -1 if an error occured.
  */
-int create_generic_socket(Port_T p) {
+int create_generic_socket(Port_T p, double *timing) {
 
   int socket_fd= -1;
+  long long start= Util_monotonic();
+  struct sockaddr_in sin;
 
   ASSERT(p);
 
@@ -378,11 +376,17 @@ int create_generic_socket(Port_T p) {
       socket_fd= create_unix_socket(p->pathname, p->timeout);
       break;
   case AF_INET:
-      socket_fd= create_socket(p->hostname, p->port, p->type, p->timeout);
+      memset(&sin, 0, sizeof(sin));
+      if(Resolver_getAddress(p->hostname, &sin) != 0)
+        return -1;
+      timing[TIMING_RESOLVE]= (Util_monotonic() - start) / 1000000.;
+      start= Util_monotonic();
+      socket_fd= connect_inet(&sin, p->port, p->type, p->timeout);
       break;
   default:
       socket_fd= -1;
   }
+  timing[TIMING_CONNECT]= (Util_monotonic() - start) / 1000000.;
 
   return socket_fd;
 
@@ -504,6 +508,63 @@ int create_server_socket(int port, int backlog, const char *bindAddr) {
 }
 
 
+/**
+ * Create a non-blocking UNIX server socket bound to the pathname, with
+ * the specified backlog. A stale socket file is removed first and the
+ * new socket file is accessible by the owner only.
+ * @param pathname The pathname of the unix socket
+ * @param backlog The maximum queue length for incomming connections
+ * @return The socket ready for accept, or -1 if an error occured.
+ */
+int create_unix_server_socket(const char *pathname, int backlog) {
+  int s;
+  mode_t mask;
+  struct sockaddr_un unixsocket;
+
+  ASSERT(pathname);
+
+  if((s = socket(PF_UNIX, SOCK_STREAM, 0)) < 0) {
+    LogError("%s: Cannot create socket -- %s\n", prog, STRERROR);
+    return -1;
+  }
+
+  memset(&unixsocket, 0, sizeof(unixsocket));
+  unixsocket.sun_family = AF_UNIX;
+  snprintf(unixsocket.sun_path, sizeof(unixsocket.sun_path), "%s", pathname);
+  unlink(pathname);
+
+  if(! set_noblock(s))
+    goto error;
+
+  if(fcntl(s, F_SETFD, FD_CLOEXEC) == -1) {
+    LogError("%s: Cannot set close on exec option -- %s\n", prog, STRERROR);
+    goto error;
+  }
+
+  mask = umask(077);
+  if(bind(s, (struct sockaddr *)&unixsocket, sizeof(unixsocket)) < 0) {
+    umask(mask);
+    LogError("%s: Cannot bind to %s -- %s\n", prog, pathname, STRERROR);
+    goto error;
+  }
+  umask(mask);
+
+  if(listen(s, backlog) < 0) {
+    LogError("%s: Cannot listen -- %s\n", prog, STRERROR);
+    goto error;
+  }
+
+  return s;
+
+  error:
+  if (close(s) < 0)
+    LogError("%s: Socket %d close failed -- %s\n", prog, s, STRERROR);
+
+  return -1;
+
+}
+
+
 /**
  * Shutdown a socket and close the descriptor.
  * @param socket The socket to shutdown and close
@@ -713,9 +774,7 @@ int udp_write(int socket, void *b, size_t len, int timeout) {
  */
 double icmp_echo(const char *hostname, int timeout, int count) {
   struct sockaddr_in sout;
-  struct sockaddr_in *sa;
-  struct addrinfo hints;
-  struct addrinfo *result;
+  struct sockaddr_in sa;
   struct ip *iphdrin;
   int len_out = offsetof(struct icmp, icmp_data) + DATALEN;
   int len_in = sizeof(struct ip) + sizeof(struct icmp);
@@ -734,9 +793,8 @@ double icmp_echo(const char *hostname, int timeout, int count) {
   ASSERT(hostname);   
   ASSERT(len_out < sizeof(buf));
 
-  memset(&hints, 0, sizeof(struct addrinfo));
-  hints.ai_family = AF_INET;
-  if ((status = getaddrinfo(hostname, NULL, &hints, &result)) != 0) {
+  memset(&sa, 0, sizeof(sa));
+  if ((status = Resolver_getAddress(hostname, &sa)) != 0) {
     LogError("ICMP echo for %s -- getaddrinfo failed: %s\n", hostname, status == EAI_SYSTEM ? STRERROR : gai_strerror(status));
     return response;
   }
@@ -789,8 +847,7 @@ double icmp_echo(const char *hostname, int timeout, int count) {
 
     icmpout->icmp_cksum = checksum_ip((unsigned char *)icmpout, len_out);
 
-    sa = (struct sockaddr_in *)result->ai_addr;
-    memcpy(&sout, sa, result->ai_addrlen);
+    memcpy(&sout, &sa, sizeof(sout));
     sout.sin_family = AF_INET;
     sout.sin_port   = 0;
 
@@ -823,7 +880,7 @@ readnext:
       gettimeofday(&t_in, NULL);
 
       /* The read from connection-less raw socket via recvfrom() provides messages regardless of origin, the source IP address is set in sout, we have to check the IP and skip responses belonging to other ICMP conversations */
-      if (sout.sin_addr.s_addr != sa->sin_addr.s_addr || icmpin->icmp_type != ICMP_ECHOREPLY || id_in != id_out || seq_in >= (uint16_t)count) {
+      if (sout.sin_addr.s_addr != sa.sin_addr.s_addr || icmpin->icmp_type != ICMP_ECHOREPLY || id_in != id_out || seq_in >= (uint16_t)count) {
         if ((read_timeout = timeout * 1000. - ((t_in.tv_sec - t_out.tv_sec) * 1000. + (t_in.tv_usec - t_out.tv_usec) / 1000.)) > 0)
           goto readnext; // Try to read next packet, but don't exceed the timeout while waiting for our response so we won't loop forever if the socket is flooded with other ICMP packets
       } else {
@@ -844,8 +901,6 @@ error1:
     LogError("%s: Socket %d close failed -- %s\n", prog, s, STRERROR);
 
 error2:
-  freeaddrinfo(result);
-
   return response;
 }
 
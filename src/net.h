@@ -87,9 +87,10 @@ int create_socket(const char *hostname, int port, int protocol, int timeout);
  * Open a socket using the given Port_T structure. The protocol,
  * destination and type are selected appropriately.
  * @param p connection description
+ * @param timing Output of the hostname lookup and connect time [s]
  * @return The socket or -1 if an error occured.
  */
-int create_generic_socket(Port_T p);
+int create_generic_socket(Port_T p, double *timing);
 
 
 /**
@@ -116,6 +117,17 @@ int create_unix_socket(const char *pathname, int timeout);
 int create_server_socket(int port, int backlog, const char *bindAddr);
 
 
+/**
+ * Create a non-blocking UNIX server socket bound to the pathname, with
+ * the specified backlog. A stale socket file is removed first and the
+ * new socket file is accessible by the owner only.
+ * @param pathname The pathname of the unix socket
+ * @param backlog The maximum queue length for incomming connections
+ * @return The socket ready for accept, or -1 if an error occured.
+ */
+int create_unix_server_socket(const char *pathname, int backlog);
+
+
 /**
  * Shutdown a socket and close the descriptor.
  * @param socket The socket to shutdown and close
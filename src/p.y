@@ -115,6 +115,7 @@
 #include "process.h"
 #include "ssl.h"
 #include "device.h"
+#include "digest.h"
 
 // libmonit
 #include "io/File.h"
@@ -175,14 +176,30 @@
   static struct mychecksum checksumset;
   static struct mytimestamp timestampset;
   static struct myactionrate actionrateset;
+  static struct mytrend trendset;
+  static struct mytiming timingset;
+  static struct mytree treeset;
+  static double trendvalue = 0.;
+  static int    trendunit = 0;
   static struct IHavePrecedence ihp = {FALSE, FALSE, FALSE};
   static struct myrate rate1 = {1, 1};
   static struct myrate rate2 = {1, 1};
   static char * htpasswd_file = NULL;
   static int    digesttype = DIGEST_CLEARTEXT;
+  static struct myserviceindex {
+          Service_T *table;
+          int size;
+          int count;
+  } serviceindex;
 
 #define BITMAP_MAX (sizeof(long long) * 8)
 
+/* Trend limit units beside the UNIT_* memory units */
+#define TRENDUNIT_NONE         0
+#define TRENDUNIT_PERCENT     -1
+#define TRENDUNIT_MILLISECOND -2
+#define TRENDUNIT_SECOND      -3
+
 
 /* -------------------------------------------------------------- Prototypes */
 
@@ -191,10 +208,15 @@
   static void  addmail(char *, Mail_T, Mail_T *);
   static Service_T createservice(int, char *, char *, int (*)(Service_T));
   static void  addservice(Service_T);
+  static void  indexservice(Service_T);
+  static Service_T getservice(const char *);
   static void  adddependant(char *);
   static void  addservicegroup(char *);
   static void  addport(Port_T);
   static void  addresource(Resource_T);
+  static void  addtrend(Trend_T);
+  static void  addtiming(Timing_T);
+  static void  addtree(Tree_T);
   static void  addtimestamp(Timestamp_T, int);
   static void  addactionrate(ActionRate_T);
   static void  addsize(Size_T);
@@ -226,12 +248,16 @@
   static void  seteventaction(EventAction_T *, int, int);
   static void  prepare_urlrequest(URL_T U);
   static void  seturlrequest(int, char *);
+  static char *heapstring(char *);
   static void  setlogfile(char *);
   static void  setpidfile(char *);
   static void  reset_mailset();
   static void  reset_mailserverset();
   static void  reset_portset();
   static void  reset_resourceset();
+  static void  reset_trendset();
+  static void  reset_timingset();
+  static void  reset_treeset();
   static void  reset_timestampset();
   static void  reset_actionrateset();
   static void  reset_sizeset();
@@ -265,7 +291,7 @@
 
 %token IF ELSE THEN OR FAILED
 %token SET LOGFILE FACILITY DAEMON SYSLOG MAILSERVER HTTPD ALLOW ADDRESS INIT
-%token READONLY CLEARTEXT MD5HASH SHA1HASH CRYPT DELAY
+%token READONLY CLEARTEXT MD5HASH SHA1HASH SHA256HASH XXH64HASH CRYPT DELAY
 %token PEMFILE ENABLE DISABLE HTTPDSSL CLIENTPEMFILE ALLOWSELFCERTIFICATION
 %token IDFILE STATEFILE SEND EXPECT EXPECTBUFFER CYCLE COUNT REMINDER
 %token PIDFILE START STOP PATHTOK
@@ -297,6 +323,15 @@
 %token <string> TARGET TIMESPEC
 %token <number> MAXFORWARD
 %token FIPS
+%token CGROUP
+%token CPUSTEAL CPUIRQ PRESSURECPU PRESSUREMEMORY PRESSUREIO
+%token AVERAGE PERCENTILE SLOPE OVER MILLISECOND RESPONSETIME
+%token RESOLVETIME CONNECTTIME TLSTIME FIRSTBYTETIME
+%token KEEPALIVE
+%token PIDWATCH
+%token CONCURRENCY
+%token SESSION
+%token FILES OLDEST NEWEST REFRESH
 
 %left GREATER LESS EQUAL NOTEQUAL
 
@@ -324,6 +359,9 @@ statement       : setalert
                 | setexpectbuffer
                 | setinit
                 | setfips
+                | setkeepalive
+                | setpidwatch
+                | setconcurrency
                 | checkproc optproclist
                 | checkfile optfilelist
                 | checkfilesys optfilesyslist
@@ -354,6 +392,9 @@ optproc         : start
                 | group
                 | depend
                 | resourceprocess
+                | cgroup
+                | trend
+                | timing
                 ;
 
 optfilelist      : /* EMPTY */
@@ -410,6 +451,8 @@ optdir          : start
                 | restart
                 | exist
                 | timestamp
+                | tree
+                | treerefresh
                 | actionrate
                 | every
                 | alert
@@ -437,6 +480,8 @@ opthost         : start
                 | mode
                 | group
                 | depend
+                | trend
+                | timing
                 ;
 
 optsystemlist   : /* EMPTY */
@@ -452,6 +497,7 @@ optsystem       : start
                 | group
                 | depend
                 | resourcesystem
+                | trend
                 ;
 
 optfifolist     : /* EMPTY */
@@ -522,6 +568,28 @@ setexpectbuffer : SET EXPECTBUFFER NUMBER unit {
                   }
                 ;
 
+setkeepalive    : SET KEEPALIVE {
+                    Run.keepalive = KEEPALIVE_TIMEOUT;
+                  }
+                | SET KEEPALIVE TIMEOUT NUMBER SECOND {
+                    if ($4 < 1)
+                      yyerror2("The keepalive timeout must be at least 1 second");
+                    Run.keepalive = $4;
+                  }
+                ;
+
+setpidwatch     : SET PIDWATCH {
+                    Run.pidwatch = TRUE;
+                  }
+                ;
+
+setconcurrency  : SET ACTION CONCURRENCY NUMBER {
+                    if ($4 < 1)
+                      yyerror2("The action concurrency must be at least 1");
+                    Run.concurrency = $4;
+                  }
+                ;
+
 setinit         : SET INIT {
                     Run.init = TRUE;
                   }
@@ -564,12 +632,12 @@ seteventqueue   : SET EVENTQUEUE BASEDIR PATH {
                 ;
 
 setidfile       : SET IDFILE PATH {
-                    Run.idfile = $3;
+                    Run.idfile = heapstring($3);
                   }
                 ;
 
 setstatefile    : SET STATEFILE PATH {
-                    Run.statefile = $3;
+                    Run.statefile = heapstring($3);
                   }
                 ;
 
@@ -671,6 +739,8 @@ httpdlist       : /* EMPTY */
 httpdoption     : ssl
                 | signature
                 | bindaddress
+                | controlsocket
+                | session
                 | allow
                 ;
 
@@ -720,6 +790,17 @@ sigdisable      : SIGNATURE DISABLE
 bindaddress     : ADDRESS STRING { Run.bind_addr = $2; }
                 ;
 
+controlsocket   : UNIXSOCKET PATH { Run.httpdsocket = $2; }
+                ;
+
+session         : SESSION { Run.httpdsession = SESSION_TIMEOUT; }
+                | SESSION TIMEOUT NUMBER SECOND {
+                    if ($3 < 1)
+                      yyerror2("The session timeout must be at least 1 second");
+                    Run.httpdsession = $3;
+                  }
+                ;
+
 pemfile         : PEMFILE PATH {
                     Run.httpsslpem = $2;
                   }
@@ -1379,6 +1460,12 @@ mode            : MODE ACTIVE  {
 group           : GROUP STRINGNAME { addservicegroup($2); FREE($2);}
                 ;
 
+cgroup          : CGROUP PATH {
+                    FREE(current->cgroup);
+                    current->cgroup = $2;
+                  }
+                ;
+
 
 depend          : DEPENDS dependlist
                 ;
@@ -1428,6 +1515,7 @@ resourcesystemopt  : resourceload
                    | resourcemem
                    | resourceswap
                    | resourcecpu
+                   | resourcepressure
                    ;
 
 resourcecpuproc : CPU operator NUMBER PERCENT {
@@ -1452,8 +1540,22 @@ resourcecpu     : resourcecpuid operator NUMBER PERCENT {
 resourcecpuid   : CPUUSER   { $<number>$ = RESOURCE_ID_CPUUSER; }
                 | CPUSYSTEM { $<number>$ = RESOURCE_ID_CPUSYSTEM; }
                 | CPUWAIT   { $<number>$ = RESOURCE_ID_CPUWAIT; }
+                | CPUSTEAL  { $<number>$ = RESOURCE_ID_CPUSTEAL; }
+                | CPUIRQ    { $<number>$ = RESOURCE_ID_CPUIRQ; }
                 ;
 
+resourcepressure : resourcepressureid operator value PERCENT {
+                    resourceset.resource_id = $<number>1;
+                    resourceset.operator = $<number>2;
+                    resourceset.limit = (int) ($<real>3 * 10.0);
+                  }
+                ;
+
+resourcepressureid : PRESSURECPU    { $<number>$ = RESOURCE_ID_PRESSURE_CPU; }
+                   | PRESSUREMEMORY { $<number>$ = RESOURCE_ID_PRESSURE_MEMORY; }
+                   | PRESSUREIO     { $<number>$ = RESOURCE_ID_PRESSURE_IO; }
+                   ;
+
 resourcemem     : MEMORY operator value unit {
                     resourceset.resource_id = RESOURCE_ID_MEM_KBYTE;
                     resourceset.operator = $<number>2;
@@ -1507,6 +1609,69 @@ resourceloadavg : LOADAVG1  { $<number>$ = RESOURCE_ID_LOAD1; }
                 | LOADAVG15 { $<number>$ = RESOURCE_ID_LOAD15; }
                 ;
 
+trend           : IF trendfunction trendmetric OVER NUMBER CYCLE operator trendlimit rate1 THEN action1 recovery {
+                    trendset.cycles = $5;
+                    trendset.operator = $<number>7;
+                    addeventaction(&(trendset).action, $<number>11, $<number>12);
+                    addtrend(&trendset);
+                  }
+                ;
+
+trendfunction   : AVERAGE { trendset.function = TREND_AVERAGE; }
+                | PERCENTILE NUMBER {
+                    trendset.function = TREND_PERCENTILE;
+                    trendset.percentile = $2;
+                    if ($2 < 1 || $2 > 100)
+                      yyerror2("the percentile must be between 1 and 100");
+                  }
+                | SLOPE { trendset.function = TREND_SLOPE; }
+                ;
+
+trendmetric     : CPU          { trendset.metric = HISTORY_CPU; }
+                | TOTALCPU     { trendset.metric = HISTORY_TOTALCPU; }
+                | MEMORY       { trendset.metric = HISTORY_MEMORY; }
+                | TOTALMEMORY  { trendset.metric = HISTORY_TOTALMEMORY; }
+                | CHILDREN     { trendset.metric = HISTORY_CHILDREN; }
+                | LOADAVG1     { trendset.metric = HISTORY_LOADAVG; }
+                | SWAP         { trendset.metric = HISTORY_SWAP; }
+                | RESPONSETIME { trendset.metric = HISTORY_RESPONSE; }
+                ;
+
+trendlimit      : value trendunit {
+                    trendvalue = $<real>1;
+                    trendunit = $<number>2;
+                  }
+                ;
+
+trendunit       : /* EMPTY */  { $<number>$ = TRENDUNIT_NONE; }
+                | PERCENT      { $<number>$ = TRENDUNIT_PERCENT; }
+                | MILLISECOND  { $<number>$ = TRENDUNIT_MILLISECOND; }
+                | SECOND       { $<number>$ = TRENDUNIT_SECOND; }
+                | BYTE         { $<number>$ = UNIT_BYTE; }
+                | KILOBYTE     { $<number>$ = UNIT_KILOBYTE; }
+                | MEGABYTE     { $<number>$ = UNIT_MEGABYTE; }
+                | GIGABYTE     { $<number>$ = UNIT_GIGABYTE; }
+                ;
+
+timing          : IF timingphase operator value timingunit rate1 THEN action1 recovery {
+                    timingset.operator = $<number>3;
+                    timingset.limit = (long long)($<real>4 * $<number>5);
+                    addeventaction(&(timingset).action, $<number>8, $<number>9);
+                    addtiming(&timingset);
+                  }
+                ;
+
+timingphase     : RESPONSETIME  { timingset.phase = TIMING_RESPONSE; }
+                | RESOLVETIME   { timingset.phase = TIMING_RESOLVE; }
+                | CONNECTTIME   { timingset.phase = TIMING_CONNECT; }
+                | TLSTIME       { timingset.phase = TIMING_TLS; }
+                | FIRSTBYTETIME { timingset.phase = TIMING_FIRSTBYTE; }
+                ;
+
+timingunit      : MILLISECOND { $<number>$ = 1000; }
+                | SECOND      { $<number>$ = 1000000; }
+                ;
+
 value           : REAL { $<real>$ = $1; }
                 | NUMBER { $<real>$ = (float) $1; }
                 ;
@@ -1524,6 +1689,47 @@ timestamp       : IF TIMESTAMP operator NUMBER time rate1 THEN action1 recovery
                   }
                 ;
 
+tree            : IF FILES treepattern operator NUMBER rate1 THEN action1 recovery {
+                    treeset.metric = TREE_FILES;
+                    treeset.operator = $<number>4;
+                    treeset.limit = $5;
+                    addeventaction(&(treeset).action, $<number>8, $<number>9);
+                    addtree(&treeset);
+                  }
+                | IF SIZE treepattern operator NUMBER unit rate1 THEN action1 recovery {
+                    treeset.metric = TREE_SIZE;
+                    treeset.operator = $<number>4;
+                    treeset.limit = ((unsigned long long)$5 * $<number>6);
+                    addeventaction(&(treeset).action, $<number>9, $<number>10);
+                    addtree(&treeset);
+                  }
+                | IF OLDEST treepattern operator NUMBER time rate1 THEN action1 recovery {
+                    treeset.metric = TREE_OLDEST;
+                    treeset.operator = $<number>4;
+                    treeset.limit = ((unsigned long long)$5 * $<number>6);
+                    addeventaction(&(treeset).action, $<number>9, $<number>10);
+                    addtree(&treeset);
+                  }
+                | IF NEWEST treepattern operator NUMBER time rate1 THEN action1 recovery {
+                    treeset.metric = TREE_NEWEST;
+                    treeset.operator = $<number>4;
+                    treeset.limit = ((unsigned long long)$5 * $<number>6);
+                    addeventaction(&(treeset).action, $<number>9, $<number>10);
+                    addtree(&treeset);
+                  }
+                ;
+
+treerefresh     : REFRESH NUMBER CYCLE {
+                    if ($2 < 1)
+                      yyerror2("The directory tree refresh must be at least 1 cycle");
+                    current->treerefresh = $2;
+                  }
+                ;
+
+treepattern     : /* EMPTY */ { treeset.pattern = NULL; }
+                | MATCH STRING { treeset.pattern = $2; }
+                ;
+
 operator        : /* EMPTY */ { $<number>$ = OPERATOR_EQUAL; }
                 | GREATER     { $<number>$ = OPERATOR_GREATER; }
                 | LESS        { $<number>$ = OPERATOR_LESS; }
@@ -1634,6 +1840,8 @@ checksum        : IF FAILED hashtype CHECKSUM rate1 THEN action1 recovery {
 hashtype        : /* EMPTY */ { checksumset.type = HASH_UNKNOWN; }
                 | MD5HASH     { checksumset.type = HASH_MD5; }
                 | SHA1HASH    { checksumset.type = HASH_SHA1; }
+                | SHA256HASH  { checksumset.type = HASH_SHA256; }
+                | XXH64HASH   { checksumset.type = HASH_XXH64; }
                 ;
 
 inode           : IF INODE operator NUMBER rate1 THEN action1 recovery {
@@ -1874,6 +2082,13 @@ int parse(char *controlfile) {
     return FALSE;
   }
 
+  /*
+   * The configuration objects are allocated from the arena of this
+   * configuration generation, gc() releases it in one step
+   */
+  Run.arena = Arena_new();
+  Arena_use(Run.arena);
+
   currentfile = Str_dup(controlfile);
 
   /* 
@@ -1891,6 +2106,8 @@ int parse(char *controlfile) {
   if (argyytext != NULL)
     FREE(argyytext);
 
+  Arena_use(NULL);
+
   /*
    * Secure check the monitrc file. The run control file must have the
    * same uid as the REAL uid of this process, it must have permissions
@@ -1936,11 +2153,16 @@ static void preparse() {
   Run.allowselfcert       = FALSE; 
   Run.mailserver_timeout  = SMTP_TIMEOUT;
   Run.bind_addr           = NULL;
+  Run.httpdsocket         = NULL;
+  Run.httpdsession        = 0;
   Run.eventlist           = NULL;
   Run.eventlist_dir       = NULL;
   Run.eventlist_slots     = -1;
   Run.system              = NULL;
   Run.expectbuffer        = STRLEN;
+  Run.keepalive           = 0;
+  Run.pidwatch            = FALSE;
+  Run.concurrency         = 1;
   Run.mmonits             = NULL;
   Run.maillist            = NULL;
   Run.mailservers         = NULL;
@@ -1950,6 +2172,7 @@ static void preparse() {
   Run.MailFormat.message  = NULL;
   depend_list             = NULL;
   Run.handler_init        = TRUE;
+  memset(&serviceindex, 0, sizeof(serviceindex));
 #ifdef OPENSSL_FIPS  
   Run.fipsEnabled         = FALSE;
 #endif
@@ -1970,6 +2193,9 @@ static void preparse() {
   reset_rateset();
   reset_filesystemset();
   reset_resourceset();
+  reset_trendset();
+  reset_timingset();
+  reset_treeset();
   reset_checksumset();
   reset_timestampset();
   reset_actionrateset();
@@ -2012,6 +2238,11 @@ static void postparse() {
                                 cfg_errflag++;
                         }
                 }
+                /* The timing tests measure the port tests of the service */
+                if (s->timinglist && ! s->portlist) {
+                        LogError("%s: Error: service '%s' has a response time test but no port or unix socket test\n", prog, s->name);
+                        cfg_errflag++;
+                }
         }
 
         /* Add the default general system service if not specified explicitly: service name default to hostname */
@@ -2021,7 +2252,7 @@ static void postparse() {
                         LogError("Cannot get system hostname -- please add 'check system <name>'\n");
                         cfg_errflag++;
                 }
-                if (Util_existService(hostname)) {
+                if (getservice(hostname)) {
                         LogError("'check system' not defined in control file, failed to add automatic configuration (service name %s is used already) -- please add 'check system <name>' manually\n", hostname);
                         cfg_errflag++;
                 } else {
@@ -2120,6 +2351,58 @@ static void addservice(Service_T s) {
     servicelist_conf = s;
   }
   tail = s;
+  indexservice(s);
+}
+
+
+/*
+ * Hash of a service name, service names are case insensitive
+ */
+static unsigned int hashname(const char *name) {
+  unsigned int h = 2166136261U;
+  for (; *name; name++)
+    h = (h ^ tolower((unsigned char)*name)) * 16777619U;
+  return h;
+}
+
+
+/*
+ * Add the service to the name index of the services parsed so far,
+ * the index replaces scans of the service list in the duplicate and
+ * dependency checks. The index is a hash table with linear probing in
+ * the configuration arena, it is kept at most half full.
+ */
+static void indexservice(Service_T s) {
+  unsigned int i;
+
+  if (2 * (serviceindex.count + 1) > serviceindex.size) {
+    Service_T *old = serviceindex.table;
+    int oldsize = serviceindex.size;
+    serviceindex.size = oldsize ? 2 * oldsize : 1024;
+    serviceindex.table = CALLOC(serviceindex.size, sizeof(Service_T));
+    serviceindex.count = 0;
+    for (int j = 0; j < oldsize; j++)
+      if (old[j])
+        indexservice(old[j]);
+    FREE(old);
+  }
+  for (i = hashname(s->name) & (serviceindex.size - 1); serviceindex.table[i]; i = (i + 1) & (serviceindex.size - 1))
+    ;
+  serviceindex.table[i] = s;
+  serviceindex.count++;
+}
+
+
+/*
+ * Return the service with the given name from the services parsed so far
+ */
+static Service_T getservice(const char *name) {
+  if (serviceindex.size) {
+    for (unsigned int i = hashname(name) & (serviceindex.size - 1); serviceindex.table[i]; i = (i + 1) & (serviceindex.size - 1))
+      if (IS(serviceindex.table[i]->name, name))
+        return serviceindex.table[i];
+  }
+  return NULL;
 }
 
 
@@ -2223,11 +2506,7 @@ static void addport(Port_T port) {
 
   if (p->request_checksum) {
     cleanup_hash_string(p->request_checksum);
-    if (strlen(p->request_checksum) == 32)
-      p->request_hashtype = HASH_MD5;
-    else if (strlen(p->request_checksum) == 40)
-      p->request_hashtype = HASH_SHA1;
-    else
+    if ((p->request_hashtype = Digest_typeOf((int)strlen(p->request_checksum))) == HASH_UNKNOWN)
       yyerror2("invalid checksum [%s]", p->request_checksum);
   } else
     p->request_hashtype = 0;
@@ -2245,6 +2524,8 @@ static void addport(Port_T port) {
     }
   }
   p->maxforward = port->maxforward;
+  for (int i = 0; i < TIMING_PHASES; i++)
+    p->timing[i] = -1;
   p->next = current->portlist;
   current->portlist = p;
 
@@ -2275,6 +2556,151 @@ static void addresource(Resource_T rr) {
 }
 
 
+/*
+ * Add a new trend object to the current service trend list
+ */
+static void addtrend(Trend_T tt) {
+  Trend_T t;
+
+  ASSERT(tt);
+
+  if (tt->cycles < 1 || tt->cycles > HISTORY_SIZE)
+    yyerror2("the number of trend cycles must be between 1 and %d", HISTORY_SIZE);
+  switch (current->type) {
+    case TYPE_PROCESS:
+      if (tt->metric == HISTORY_LOADAVG || tt->metric == HISTORY_SWAP)
+        yyerror2("the %s trend can only be used in a check system entry", historymetricnames[tt->metric]);
+      break;
+    case TYPE_SYSTEM:
+      if (tt->metric != HISTORY_CPU && tt->metric != HISTORY_MEMORY && tt->metric != HISTORY_SWAP && tt->metric != HISTORY_LOADAVG)
+        yyerror2("the %s trend cannot be used in a check system entry", historymetricnames[tt->metric]);
+      break;
+    default:
+      if (tt->metric != HISTORY_RESPONSE)
+        yyerror2("only the response time trend can be used in a check host entry");
+      break;
+  }
+  if (tt->metric != HISTORY_RESPONSE && ! Run.doprocess)
+    yyerror("Cannot activate service check. The process status engine was disabled. On certain systems you must run monit as root to utilize this feature)\n");
+
+  /* Convert the limit to the unit of the history samples */
+  if (tt->function == TREND_SLOPE) {
+    if (trendunit != TRENDUNIT_PERCENT)
+      yyerror2("the slope limit must be given in percent");
+    tt->limit = (long long)(trendvalue * 10.);
+  } else {
+    switch (tt->metric) {
+      case HISTORY_CPU:
+      case HISTORY_TOTALCPU:
+        if (trendunit != TRENDUNIT_PERCENT)
+          yyerror2("the cpu trend limit must be given in percent");
+        tt->limit = (long long)(trendvalue * 10.);
+        break;
+      case HISTORY_MEMORY:
+      case HISTORY_TOTALMEMORY:
+      case HISTORY_SWAP:
+        if (trendunit == TRENDUNIT_NONE)
+          trendunit = UNIT_BYTE;
+        if (trendunit < UNIT_BYTE)
+          yyerror2("the %s trend limit must be given as an amount (B, kB, MB, GB)", historymetricnames[tt->metric]);
+        tt->limit = (long long)(trendvalue * (trendunit / 1024.0));
+        break;
+      case HISTORY_RESPONSE:
+        if (trendunit == TRENDUNIT_MILLISECOND)
+          tt->limit = (long long)(trendvalue * 1000.);
+        else if (trendunit == TRENDUNIT_SECOND)
+          tt->limit = (long long)(trendvalue * 1000000.);
+        else
+          yyerror2("the response time trend limit must be given in ms or seconds");
+        break;
+      case HISTORY_LOADAVG:
+        if (trendunit != TRENDUNIT_NONE)
+          yyerror2("the loadavg trend limit has no unit");
+        tt->limit = (long long)(trendvalue * 10.);
+        break;
+      default:
+        if (trendunit != TRENDUNIT_NONE)
+          yyerror2("the %s trend limit has no unit", historymetricnames[tt->metric]);
+        tt->limit = (long long)trendvalue;
+        break;
+    }
+  }
+
+  NEW(t);
+  t->metric     = tt->metric;
+  t->function   = tt->function;
+  t->percentile = tt->percentile;
+  t->cycles     = tt->cycles;
+  t->operator   = tt->operator;
+  t->limit      = tt->limit;
+  t->action     = tt->action;
+  t->next       = current->trendlist;
+
+  current->trendlist = t;
+  reset_trendset();
+}
+
+
+/*
+ * Add a new connection timing object to the current service timing list
+ */
+static void addtiming(Timing_T tt) {
+  Timing_T t;
+
+  ASSERT(tt);
+
+  if (tt->limit < 0)
+    yyerror2("the %s time limit must not be negative", timingnames[tt->phase]);
+
+  NEW(t);
+  t->phase    = tt->phase;
+  t->operator = tt->operator;
+  t->limit    = tt->limit;
+  t->action   = tt->action;
+  t->next     = current->timinglist;
+
+  current->timinglist = t;
+  reset_timingset();
+}
+
+
+/*
+ * Add a new directory tree object to the current service tree list
+ */
+static void addtree(Tree_T tt) {
+  Tree_T t;
+  int filter = 0, found = FALSE;
+
+  ASSERT(tt);
+
+  /* The rules with the same pattern share one aggregate of the scan */
+  if (tt->pattern) {
+    for (t = current->treelist; t; t = t->next) {
+      if (t->pattern && IS(t->pattern, tt->pattern)) {
+        filter = t->filter;
+        found = TRUE;
+        break;
+      }
+      filter = MAX(filter, t->filter);
+    }
+    if (! found)
+      filter++;
+  }
+
+  NEW(t);
+  t->metric   = tt->metric;
+  t->pattern  = tt->pattern;
+  t->filter   = filter;
+  t->operator = tt->operator;
+  t->limit    = tt->limit;
+  t->action   = tt->action;
+  t->next     = current->treelist;
+
+  current->treelist = t;
+  reset_treeset();
+}
+
+
 /*
  * Add a new file object to the current service timestamp list
  */
@@ -2395,7 +2821,8 @@ static void addchecksum(Checksum_T cs) {
       cs->type = DEFAULT_HASH;
     if ( !(Util_getChecksum(current->path, cs->type, cs->hash, sizeof(cs->hash)))) {
       /* If the file doesn't exist, set dummy value */
-      snprintf(cs->hash, sizeof(cs->hash), "00000000000000000000000000000000");
+      memset(cs->hash, '0', Digest_length(cs->type) * 2);
+      cs->hash[Digest_length(cs->type) * 2] = 0;
       cs->initialized = FALSE;
       yywarning2("cannot compute a checksum for file %s", current->path);
     }
@@ -2404,16 +2831,12 @@ static void addchecksum(Checksum_T cs) {
   len = cleanup_hash_string(cs->hash);
 
   if (cs->type == HASH_UNKNOWN) {
-    if (len == 32) {
-      cs->type = HASH_MD5;
-    } else if (len == 40) {
-      cs->type = HASH_SHA1;
-    } else {
+    if ((cs->type = Digest_typeOf(len)) == HASH_UNKNOWN) {
       yyerror2("unknown checksum type [%s] for file %s", cs->hash, current->path);
       reset_checksumset();
       return;
     }
-  } else if (( cs->type == HASH_MD5 && len!=32 ) || ( cs->type == HASH_SHA1 && len != 40 )) {
+  } else if (len != Digest_length(cs->type) * 2) {
     yyerror2("invalid checksum [%s] for file %s", cs->hash, current->path);
     reset_checksumset();
     return;
@@ -3003,6 +3426,19 @@ static void addegid(gid_t gid) {
 }
 
 
+/*
+ * Copy a string which outlives the configuration generation (the log,
+ * pid, id and state files are kept across reloads) to the heap
+ */
+static char *heapstring(char *s) {
+  Arena_T arena = Arena_use(NULL);
+  char *h = Str_dup(s);
+  Arena_use(arena);
+  FREE(s);
+  return h;
+}
+
+
 /*
  * Reset the logfile if changed
  */
@@ -3014,7 +3450,7 @@ static void setlogfile(char *logfile) {
     } else
       FREE(Run.logfile);
   }
-  Run.logfile = logfile;
+  Run.logfile = heapstring(logfile);
 }
 
 
@@ -3029,7 +3465,7 @@ static void setpidfile(char *pidfile) {
     } else
       FREE(Run.pidfile);
   }
-  Run.pidfile = pidfile;
+  Run.pidfile = heapstring(pidfile);
 }
 
 
@@ -3276,6 +3712,33 @@ static void reset_resourceset() {
 }
 
 
+/*
+ * Reset the Trend set to default values
+ */
+static void reset_trendset() {
+  trendset.metric = 0;
+  trendset.function = TREND_AVERAGE;
+  trendset.percentile = 0;
+  trendset.cycles = 0;
+  trendset.operator = OPERATOR_EQUAL;
+  trendset.limit = 0;
+  trendset.action = NULL;
+  trendvalue = 0.;
+  trendunit = TRENDUNIT_NONE;
+}
+
+
+/*
+ * Reset the Timing set to default values
+ */
+static void reset_timingset() {
+  timingset.phase = TIMING_RESPONSE;
+  timingset.operator = OPERATOR_EQUAL;
+  timingset.limit = 0;
+  timingset.action = NULL;
+}
+
+
 /*
  * Reset the Timestamp set to default values
  */
@@ -3308,6 +3771,19 @@ static void reset_sizeset() {
 }
 
 
+/*
+ * Reset the Tree set to default values
+ */
+static void reset_treeset() {
+  treeset.metric = TREE_FILES;
+  treeset.pattern = NULL;
+  treeset.filter = 0;
+  treeset.operator = OPERATOR_EQUAL;
+  treeset.limit = 0;
+  treeset.action = NULL;
+}
+
+
 /*
  * Reset the Uptime set to default values
  */
@@ -3410,7 +3886,7 @@ static void reset_rateset() {
 static void check_name(char *name) {
   ASSERT(name);
 
-  if (Util_existService(name) || (current && IS(name, current->name)))
+  if (getservice(name) || (current && IS(name, current->name)))
     yyerror2("service name conflict, %s already defined", name);
   if (name && *name == '/')		
           yyerror2("service name '%s' must not start with '/' -- ", name);	
@@ -3470,7 +3946,7 @@ static void check_depend() {
       done = FALSE; // still unvisited nodes
       depends_on = NULL;
       for (d = s->dependantlist; d; d = d->next) {
-        Service_T dp = Util_getService(d->dependant);
+        Service_T dp = getservice(d->dependant);
         if (!dp) {
           LogError("%s: Error: Depend service '%s' is not defined in the control file\n", prog, d->dependant);
           exit(1);
@@ -52,6 +52,14 @@
 #include <string.h>
 #endif
 
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+
+#ifdef LINUX
+#include <sys/syscall.h>
+#endif
+
 #include <stdio.h>
 
 #include "monit.h"
@@ -65,6 +73,189 @@
  */
 
 
+/* ------------------------------------------------------------- Definitions */
+
+
+/**
+ * Index of a process tree. The topology and the subtree totals are kept in
+ * parallel arrays next to the process records: the children of process i
+ * are child[first[i]] .. child[first[i + 1] - 1] and order[] lists the
+ * processes parents first, so the totals are summed up by one sweep over
+ * order[] in reverse. The pid hash (open addressing, process index + 1,
+ * 0 if empty) has at least 4 slots per process, the tree can grow up to
+ * twice the size read from the system by virtual parents. The blocks are
+ * kept and reused by the next tree.
+ */
+typedef struct myprocessindex {
+  ProcessTree_T *tree;                /**< The process records, NULL if unused */
+  int            size;                          /**< Number of processes */
+  int            capacity;         /**< Number of processes the arrays hold */
+  int            mask;                              /**< Pid hash size - 1 */
+  int           *hash;                                       /**< Pid hash */
+  unsigned long *mem_kbyte_sum;
+  int           *cpu_percent_sum;
+  int           *children_sum;
+  int           *parent;
+  int           *first;
+  int           *child;
+  int           *order;
+} ProcessIndex_T;
+
+
+/* The index of ptree and of oldptree */
+static ProcessIndex_T current, previous;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static inline unsigned int hash_pid(int pid, int mask) {
+  return ((unsigned int)pid * 2654435761U) & mask;
+}
+
+
+static int lookup_process(ProcessIndex_T *x, int pid) {
+  for (unsigned int h = hash_pid(pid, x->mask); x->hash[h]; h = (h + 1) & x->mask)
+    if (x->tree[x->hash[h] - 1].pid == pid)
+      return x->hash[h] - 1;
+  return -1;
+}
+
+
+static void insert_process(ProcessIndex_T *x, int i) {
+  unsigned int h;
+  for (h = hash_pid(x->tree[i].pid, x->mask); x->hash[h]; h = (h + 1) & x->mask)
+    ;
+  x->hash[h] = i + 1;
+}
+
+
+/**
+ * Reset the index for a tree of up to size processes, the blocks grow if needed
+ * @param x The index
+ * @param size Number of processes read from the system
+ */
+static void reset_index(ProcessIndex_T *x, int size) {
+  int buckets = 64;
+  while (buckets < 8 * size)
+    buckets *= 2;
+  if (buckets - 1 > x->mask) {
+    FREE(x->hash);
+    x->hash = ALLOC(buckets * sizeof(int));
+    x->mask = buckets - 1;
+  }
+  memset(x->hash, 0, (x->mask + 1) * sizeof(int));
+  if (2 * size + 1 > x->capacity) {
+    int n = x->capacity = 2 * size + 1;
+    FREE(x->mem_kbyte_sum);
+    /* The arrays share one block */
+    x->mem_kbyte_sum   = ALLOC(n * (sizeof(unsigned long) + 6 * sizeof(int)));
+    x->cpu_percent_sum = (int *)(x->mem_kbyte_sum + n);
+    x->children_sum    = x->cpu_percent_sum + n;
+    x->parent          = x->children_sum + n;
+    x->first           = x->parent + n;
+    x->child           = x->first + n;
+    x->order           = x->child + n;
+  }
+  x->size = 0;
+  x->tree = NULL;
+}
+
+
+static void free_index(ProcessIndex_T *x) {
+  FREE(x->hash);
+  FREE(x->mem_kbyte_sum);
+  memset(x, 0, sizeof(*x));
+}
+
+
+static ProcessIndex_T *get_index(ProcessTree_T *pt, int size) {
+  if (pt == current.tree && size == current.size)
+    return &current;
+  if (pt == previous.tree && size == previous.size)
+    return &previous;
+  return NULL;
+}
+
+
+static void free_processes(ProcessTree_T *pt, int size) {
+  for (int i = 0; i < size; i++)
+    FREE(pt[i].cmdline);
+  FREE(pt);
+}
+
+
+/**
+ * Mark the pressure stall information as unavailable
+ * @param p A Pressure object
+ */
+static void reset_pressure(Pressure_T *p) {
+  p->some_avg10 = p->some_avg60 = p->full_avg10 = p->full_avg60 = -10;
+}
+
+
+/**
+ * Replace the process subtree totals by the cgroup v2 accounting data. The
+ * cgroup covers all tasks of the service, including daemons which detached
+ * from the process subtree, and is read with one pass per interface file.
+ * @param s A Service object with the cgroup path set
+ * @return TRUE if succeeded otherwise FALSE.
+ */
+static int update_cgroup_data(Service_T s) {
+  char buf[4096];
+  char *p;
+  unsigned long long value;
+  unsigned long long cpu_usec = 0;
+  unsigned long long rbytes = 0;
+  unsigned long long wbytes = 0;
+  double now;
+
+  /* memory.current: current memory usage in bytes */
+  if (! read_cgroup_file(buf, sizeof(buf), s->cgroup, "memory.current") || sscanf(buf, "%llu", &value) != 1) {
+    DEBUG("'%s' cgroup %s memory usage gathering failed\n", s->name, s->cgroup);
+    return FALSE;
+  }
+  s->inf->priv.process.total_mem_kbyte   = (long)(value / 1024);
+  s->inf->priv.process.total_mem_percent = systeminfo.mem_kbyte_max ? (int)((double)s->inf->priv.process.total_mem_kbyte * 1000.0 / systeminfo.mem_kbyte_max) : 0;
+
+  /* pids.current: number of tasks, the main process is not counted as a child */
+  if (read_cgroup_file(buf, sizeof(buf), s->cgroup, "pids.current") && sscanf(buf, "%llu", &value) == 1) {
+    s->inf->priv.process.cgroup_pids = (int)value;
+    s->inf->priv.process.children    = value > 0 ? (int)value - 1 : 0;
+  }
+
+  /* cpu.stat: cumulative CPU time in the usage_usec key */
+  if (read_cgroup_file(buf, sizeof(buf), s->cgroup, "cpu.stat") && (p = strstr(buf, "usage_usec ")) && sscanf(p, "usage_usec %llu", &cpu_usec) == 1) {
+    now = get_float_time();
+    if (s->inf->priv.process.cgroup_time > 0 && now > s->inf->priv.process.cgroup_time && cpu_usec >= s->inf->priv.process.cgroup_cpu_usec) {
+      /* usec -> 1/10 seconds to match get_float_time() */
+      s->inf->priv.process.total_cpu_percent = (int)((1000 * ((double)(cpu_usec - s->inf->priv.process.cgroup_cpu_usec) / 100000.)) / (now - s->inf->priv.process.cgroup_time) / systeminfo.cpus);
+      if (s->inf->priv.process.total_cpu_percent > 1000)
+        s->inf->priv.process.total_cpu_percent = 1000;
+    } else {
+      s->inf->priv.process.total_cpu_percent = 0;
+    }
+    s->inf->priv.process.cgroup_cpu_usec = cpu_usec;
+    s->inf->priv.process.cgroup_time     = now;
+  }
+
+  /* io.stat: one line per device, "MAJ:MIN rbytes=N wbytes=N rios=N ..." */
+  if (read_cgroup_file(buf, sizeof(buf), s->cgroup, "io.stat")) {
+    char *line, *ctx = NULL;
+    for (line = strtok_r(buf, "\n", &ctx); line; line = strtok_r(NULL, "\n", &ctx)) {
+      if ((p = strstr(line, "rbytes=")))
+        rbytes += strtoull(p + 7, NULL, 10);
+      if ((p = strstr(line, "wbytes=")))
+        wbytes += strtoull(p + 7, NULL, 10);
+    }
+    s->inf->priv.process.cgroup_io_rbytes = rbytes;
+    s->inf->priv.process.cgroup_io_wbytes = wbytes;
+  }
+
+  return TRUE;
+}
+
+
 /* ------------------------------------------------------------------ Public */
 
 
@@ -83,6 +274,11 @@ int init_process_info(void) {
   systeminfo.total_cpu_user_percent = -10;
   systeminfo.total_cpu_syst_percent = -10;
   systeminfo.total_cpu_wait_percent = -10;
+  systeminfo.total_cpu_steal_percent = -10;
+  systeminfo.total_cpu_irq_percent = -10;
+  reset_pressure(&systeminfo.pressure_cpu);
+  reset_pressure(&systeminfo.pressure_memory);
+  reset_pressure(&systeminfo.pressure_io);
 
   return (init_process_info_sysdep());
 
@@ -139,6 +335,18 @@ int update_process_data(Service_T s, ProcessTree_T *pt, int treesize, pid_t pid)
     s->inf->priv.process.total_cpu_percent = 0;
   }
 
+  /* The cgroup accounting, if configured, supersedes the process subtree totals. A
+   * missing cgroup (no cgroup v2 on this host) is reported once, the next failures
+   * are logged in debug mode by update_cgroup_data() only */
+  if (s->cgroup) {
+    if (update_cgroup_data(s)) {
+      s->inf->priv.process.cgroup_error = FALSE;
+    } else if (! s->inf->priv.process.cgroup_error) {
+      s->inf->priv.process.cgroup_error = TRUE;
+      LogError("'%s' cgroup %s resource usage gathering failed -- using process tree totals\n", s->name, s->cgroup);
+    }
+  }
+
   return TRUE;
 }
 
@@ -173,6 +381,10 @@ int update_system_load() {
       goto error3;
     }
 
+    /** Get pressure stall information, optional (not supported by all kernels) */
+    if (! used_system_pressure_sysdep(&systeminfo))
+      DEBUG("'%s' statistic -- pressure stall information not available\n", Run.system->name);
+
     return TRUE;
   }
 
@@ -187,6 +399,8 @@ error3:
   systeminfo.total_cpu_user_percent = 0;
   systeminfo.total_cpu_syst_percent = 0;  
   systeminfo.total_cpu_wait_percent = 0;  
+  systeminfo.total_cpu_steal_percent = 0;
+  systeminfo.total_cpu_irq_percent = 0;
 
   return FALSE;
 }
@@ -197,17 +411,16 @@ error3:
  * @return treesize >= 0 if succeeded otherwise < 0
  */
 int initprocesstree(ProcessTree_T **pt_r, int *size_r, ProcessTree_T **oldpt_r, int *oldsize_r) {
-  int i;
-  int oldentry;
-  ProcessTree_T *pt;
-  ProcessTree_T *oldpt;
-  int root = -1;
-
   if (*pt_r != NULL) {  
     if (oldpt_r && *oldpt_r != NULL)
-      delprocesstree(oldpt_r, oldsize_r);
+      free_processes(*oldpt_r, *oldsize_r);
     *oldpt_r   = *pt_r; 
     *oldsize_r = *size_r; 
+    /* The index of the deleted tree is reused for the new one */
+    ProcessIndex_T spare = previous;
+    previous = current;
+    current = spare;
+    current.tree = NULL;
   }
 
   if ((*size_r = initprocesstree_sysdep(pt_r)) <= 0) {
@@ -219,14 +432,40 @@ int initprocesstree(ProcessTree_T **pt_r, int *size_r, ProcessTree_T **oldpt_r,
     Run.doprocess = TRUE;
   }
 
-  pt    = *pt_r;
-  oldpt = *oldpt_r;
-
-  if (pt == NULL)
+  if (*pt_r == NULL)
     return 0;
 
-  for (i = 0; i < (volatile int)*size_r; i ++) {
-    if (oldpt && ((oldentry = findprocess(pt[i].pid, oldpt, *oldsize_r)) != -1)) {
+  return buildprocesstree(pt_r, size_r, *oldpt_r, *oldsize_r);
+}
+
+
+/**
+ * Link the process records read from the system into a tree and sum up
+ * the children, memory and CPU usage of each subtree. The CPU usage is
+ * computed from the previous tree. The tree is built in a few passes over
+ * the arrays of the index, without recursion.
+ * @param pt_r The process records, virtual parents may be appended
+ * @param size_r Number of records
+ * @param oldpt The previous process tree or NULL
+ * @param oldsize Size of the previous process tree
+ * @return treesize >= 0 if succeeded otherwise < 0
+ */
+int buildprocesstree(ProcessTree_T **pt_r, int *size_r, ProcessTree_T *oldpt, int oldsize) {
+  int i, j, k, roots;
+  int size = *size_r;
+  ProcessTree_T *pt = *pt_r;
+  ProcessIndex_T *x = &current;
+  ProcessIndex_T *old = oldpt ? get_index(oldpt, oldsize) : NULL;
+
+  reset_index(x, size);
+  x->tree = pt;
+  for (i = 0; i < size; i++)
+    insert_process(x, i);
+
+  /* Resolve the parents, the CPU usage is computed against the previous tree */
+  for (i = 0; i < size; i ++) {
+    int oldentry = ! oldpt ? -1 : old ? lookup_process(old, pt[i].pid) : findprocess(pt[i].pid, oldpt, oldsize);
+    if (oldentry != -1) {
       pt[i].cputime_prev = oldpt[oldentry].cputime;
       pt[i].time_prev    = oldpt[oldentry].time;
 
@@ -247,41 +486,75 @@ int initprocesstree(ProcessTree_T **pt_r, int *size_r, ProcessTree_T **oldpt_r,
       continue;
     }
 
-    if ((pt[i].parent = findprocess(pt[i].ppid, pt, *size_r)) == -1) {
+    if ((pt[i].parent = lookup_process(x, pt[i].ppid)) == -1) {
       /* Parent process wasn't found - on Linux this is normal: main process with PID 0 is not listed, similarly in FreeBSD jail.
        * We create virtual process entry for missing parent so we can have full tree-like structure with root. */
-      int j = (*size_r)++;
-
-      pt = RESIZE(*pt_r, *size_r * sizeof(ProcessTree_T));
+      j = size++;
+      pt = x->tree = RESIZE(*pt_r, size * sizeof(ProcessTree_T));
       memset(&pt[j], 0, sizeof(ProcessTree_T));
       pt[j].ppid = pt[j].pid  = pt[i].ppid;
+      pt[j].parent = j;
+      insert_process(x, j);
       pt[i].parent = j;
-    }
-
-    if (! connectchild(pt, pt[i].parent, i)) {
-      /* connection to parent process has failed, this is usually caused in the part above */
+    } else if (pt[pt[i].parent].pid == pt[i].pid) {
+      /* connection to parent process has failed, this is usually caused by a duplicate entry */
       DEBUG("system statistic error -- cannot connect process id %d to its parent %d\n", pt[i].pid, pt[i].ppid);
       pt[i].pid = 0;
-      continue;
+      pt[i].parent = i;
     }
   }
-
-  /* The main process in Solaris zones and FreeBSD host doesn't have pid 1, so try to find process which is parent of itself */
-  for (i = 0; i < *size_r; i++) {
-    if (pt[i].pid == pt[i].ppid) {
-      root = i;
-      break;
-    }
+  *size_r = x->size = size;
+
+  /* Children index: count, prefix sums, fill */
+  for (i = 0; i <= size; i++)
+    x->first[i] = 0;
+  for (i = 0; i < size; i++) {
+    x->parent[i] = pt[i].parent;
+    if (x->parent[i] != i)
+      x->first[x->parent[i] + 1]++;
   }
-
-  if (root == -1) {
+  for (i = 0; i < size; i++)
+    x->first[i + 1] += x->first[i];
+  for (i = 0; i < size; i++)
+    x->children_sum[i] = x->first[i];
+  for (i = 0; i < size; i++)
+    if (x->parent[i] != i)
+      x->child[x->children_sum[x->parent[i]]++] = i;
+
+  /* Breadth first order from the roots, parents before their children */
+  for (i = 0, roots = 0; i < size; i++)
+    if (x->parent[i] == i)
+      x->order[roots++] = i;
+  if (! roots) {
     DEBUG("system statistic error -- cannot find root process id\n");
     return -1;
   }
+  for (k = 0, j = roots; k < j; k++)
+    for (int c = x->first[x->order[k]]; c < x->first[x->order[k] + 1]; c++)
+      x->order[j++] = x->child[c];
+
+  /* Sum up the subtrees, children first */
+  for (i = 0; i < size; i++) {
+    x->children_sum[i]    = x->first[i + 1] - x->first[i];
+    x->mem_kbyte_sum[i]   = pt[i].mem_kbyte;
+    x->cpu_percent_sum[i] = pt[i].cpu_percent;
+  }
+  for (k = j - 1; k >= roots; k--) {
+    int c = x->order[k];
+    int p = x->parent[c];
+    x->children_sum[p]    += x->children_sum[c];
+    x->mem_kbyte_sum[p]   += x->mem_kbyte_sum[c];
+    x->cpu_percent_sum[p] += x->cpu_percent_sum[c];
+    x->cpu_percent_sum[p]  = (x->cpu_percent_sum[c] > 1000) ? 1000 : x->cpu_percent_sum[p];
+  }
+  for (i = 0; i < size; i++) {
+    pt[i].children_num    = x->first[i + 1] - x->first[i];
+    pt[i].children_sum    = x->children_sum[i];
+    pt[i].mem_kbyte_sum   = x->mem_kbyte_sum[i];
+    pt[i].cpu_percent_sum = x->cpu_percent_sum[i];
+  }
 
-  fillprocesstree(pt, root);
-
-  return *size_r;
+  return size;
 }
 
 
@@ -294,12 +567,16 @@ int initprocesstree(ProcessTree_T **pt_r, int *size_r, ProcessTree_T **oldpt_r,
  */
 int findprocess(int pid, ProcessTree_T *pt, int size) {
   int i;
+  ProcessIndex_T *x;
 
   ASSERT(pt);
 
   if (size <= 0)
     return -1;
 
+  if ((x = get_index(pt, size)))
+    return lookup_process(x, pid);
+
   for (i = 0; i < size; i++)
     if (pid == pt[i].pid)
       return i;
@@ -311,18 +588,103 @@ int findprocess(int pid, ProcessTree_T *pt, int size) {
  * Delete the process tree 
  */
 void delprocesstree(ProcessTree_T **reference, int *size) {
-  int i;
   ProcessTree_T *pt = *reference;
   if (pt) {
-    for (i = 0; i < *size; i++) {
-      FREE(pt[i].cmdline);
-      FREE(pt[i].children);
-    }
-    FREE(pt);
+    ProcessIndex_T *x = get_index(pt, *size);
+    if (x)
+      free_index(x);
+    free_processes(pt, *size);
     *reference = NULL;
     *size = 0;
   }
-  return;
+}
+
+
+/**
+ * Cheap liveness test of a single process which doesn't build the
+ * process tree. A zombie is not alive, this is detected if the process
+ * state can be read from /proc.
+ * @param pid The process id
+ * @return TRUE if the process is alive otherwise FALSE
+ */
+int process_isalive(pid_t pid) {
+  char buf[STRLEN], *state;
+
+  if (pid <= 0)
+    return FALSE;
+  errno = 0;
+  if (getpgid(pid) < 0 && errno != EPERM)
+    return FALSE;
+  if (read_proc_file(buf, sizeof(buf), "stat", pid, NULL) && (state = strrchr(buf, ')')) && state[1] == ' ' && state[2] == 'Z')
+    return FALSE;
+  return TRUE;
+}
+
+
+/**
+ * Find the first process with a command line matching the pattern by
+ * reading just /proc/<pid>/cmdline of each process, without building
+ * the process tree
+ * @param match The pattern
+ * @return The pid of the process, 0 if no process matches or -1 if the
+ * command lines cannot be read from /proc on this system
+ */
+pid_t process_findmatch(Match_T match) {
+  DIR *dir;
+  struct dirent *de;
+  pid_t found = 0, self = getpid();
+  int readable = FALSE;
+
+  ASSERT(match);
+
+  if (! (dir = opendir(Run.procfs)))
+    return -1;
+  while (! found && (de = readdir(dir))) {
+    char buf[1024], procname[STRLEN], *cmdline = buf, *end;
+    int bytes = 0;
+    pid_t pid = (pid_t)strtol(de->d_name, &end, 10);
+
+    if (pid <= 0 || *end || pid == self || ! read_proc_file(buf, sizeof(buf), "cmdline", pid, &bytes))
+      continue;
+    readable = TRUE;
+    /* The cmdline file contains argv elements terminated by '\0', join them as the process tree does */
+    for (int i = 0; i < bytes - 1; i++)
+      if (buf[i] == 0)
+        buf[i] = ' ';
+    if (! *buf) {
+      /* No command line (kernel thread or zombie), the process tree uses the process name then */
+      if (! read_proc_file(buf, sizeof(buf), "stat", pid, NULL) || ! (end = strrchr(buf, ')')))
+        continue;
+      *end = 0;
+      if (sscanf(buf, "%*d (%255s", procname) != 1)
+        continue;
+      cmdline = procname;
+    }
+#ifdef HAVE_REGEX_H
+    if (! regexec(match->regex_comp, cmdline, 0, NULL, 0))
+#else
+    if (strstr(cmdline, match->match_string))
+#endif
+      found = pid;
+  }
+  closedir(dir);
+  return readable ? found : -1;
+}
+
+
+/**
+ * Get a descriptor which becomes readable when the process exits (Linux
+ * pidfd). Must be called before the process is signalled so the pid
+ * cannot be reused in the meantime.
+ * @param pid The process id
+ * @return The descriptor or -1 if not supported or the process is gone
+ */
+int process_watch(pid_t pid) {
+#if defined(LINUX) && defined(SYS_pidfd_open)
+  if (pid > 0)
+    return (int)syscall(SYS_pidfd_open, pid, 0);
+#endif
+  return -1;
 }
 
 
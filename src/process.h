@@ -38,8 +38,12 @@ int init_process_info(void);
 int update_system_load();
 int  findprocess(int, ProcessTree_T *, int);
 int  initprocesstree(ProcessTree_T **, int *, ProcessTree_T **, int *);
+int  buildprocesstree(ProcessTree_T **, int *, ProcessTree_T *, int);
 void delprocesstree(ProcessTree_T **, int *);
 void process_testmatch(char *);
+int  process_isalive(pid_t);
+pid_t process_findmatch(Match_T);
+int  process_watch(pid_t);
 
 #endif
 
@@ -42,6 +42,14 @@
 #include <string.h>
 #endif
 
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
 #ifdef HAVE_SYS_TIME_H
 #include <sys/time.h>
 #endif
@@ -72,35 +80,26 @@
 
 
 /**
- * Reads an process dependent entry or the proc filesystem
+ * Reads a file to the buffer and 0 terminates it
  * @param buf buffer to write to
  * @param buf_size size of buffer "buf"
- * @param name name of proc service
- * @param pid number of the process / or <0 if main directory
- * @param bytes_read number of bytes read to buffer
+ * @param filename path of the file
+ * @param kind kind of the file for the debug messages, e.g. "proc"
+ * @param bytes_read number of bytes read to buffer (may be NULL)
  * @return TRUE if succeeded otherwise FALSE.
  */
-int read_proc_file(char *buf, int buf_size, char *name, int pid, int *bytes_read) {
+static int read_file(char *buf, int buf_size, const char *filename, const char *kind, int *bytes_read) {
         int fd;
-        char filename[STRLEN];
         int bytes;
         int rv = FALSE;
 
-        ASSERT(buf);
-        ASSERT(name);
-
-        if (pid < 0)
-                snprintf(filename, STRLEN, "/proc/%s", name);
-        else
-                snprintf(filename, STRLEN, "/proc/%d/%s", pid, name);
-
         if ((fd = open(filename, O_RDONLY)) < 0) {
-                DEBUG("%s: Cannot open proc file %s -- %s\n", prog, filename, STRERROR);
+                DEBUG("%s: Cannot open %s file %s -- %s\n", prog, kind, filename, STRERROR);
                 return rv;
         }
 
         if ((bytes = (int)read(fd, buf, buf_size-1)) < 0) {
-                DEBUG("%s: Cannot read proc file %s -- %s\n", prog, filename, STRERROR);
+                DEBUG("%s: Cannot read %s file %s -- %s\n", prog, kind, filename, STRERROR);
                 goto error;
         }
         if (bytes_read)
@@ -112,73 +111,182 @@ int read_proc_file(char *buf, int buf_size, char *name, int pid, int *bytes_read
 
 error:
         if (close(fd) < 0)
-                LogError("%s: Socket close failed -- %s\n", prog, STRERROR);
+                LogError("%s: Cannot close %s file %s -- %s\n", prog, kind, filename, STRERROR);
 
         return rv;
 }
 
+
 /**
- * Get the actual time as a floating point number
- * @return time in seconds
+ * Reads an process dependent entry or the proc filesystem
+ * @param buf buffer to write to
+ * @param buf_size size of buffer "buf"
+ * @param name name of proc service
+ * @param pid number of the process / or <0 if main directory
+ * @param bytes_read number of bytes read to buffer
+ * @return TRUE if succeeded otherwise FALSE.
  */
-double get_float_time(void) {    
-        struct timeval t;
+int read_proc_file(char *buf, int buf_size, char *name, int pid, int *bytes_read) {
+        char filename[STRLEN];
 
-        gettimeofday(&t, NULL);
-        return (double) t.tv_sec * 10 + (double) t.tv_usec / 100000.0;
-}
+        ASSERT(buf);
+        ASSERT(name);
 
+        if (pid < 0)
+                snprintf(filename, STRLEN, "%s/%s", Run.procfs, name);
+        else
+                snprintf(filename, STRLEN, "%s/%d/%s", Run.procfs, pid, name);
+
+        return read_file(buf, buf_size, filename, "proc", bytes_read);
+}
 
 /**
- * Connects child and parent in a process tree
- * @param pt process tree
- * @param parent index
- * @param child index
+ * Reads a cgroup v2 interface file such as cpu.stat or memory.current
+ * @param buf buffer to write to
+ * @param buf_size size of buffer "buf"
+ * @param cgroup path of the cgroup, either absolute or relative to the
+ * cgroup v2 mountpoint
+ * @param name name of the cgroup interface file
  * @return TRUE if succeeded otherwise FALSE.
  */
-int connectchild(ProcessTree_T *pt, int parent, int child) {
+int read_cgroup_file(char *buf, int buf_size, const char *cgroup, const char *name) {
+        char filename[STRLEN];
 
-        ASSERT(pt);
+        ASSERT(buf);
+        ASSERT(cgroup);
+        ASSERT(name);
 
-        if (pt[parent].pid == pt[child].pid)
-                return FALSE;
-        RESIZE(pt[parent].children, sizeof(ProcessTree_T *) * (pt[parent].children_num + 1));
-        pt[parent].children[pt[parent].children_num] = child;
-        pt[parent].children_num++;
+        if (Str_startsWith(cgroup, CGROUP_MOUNTPOINT))
+                snprintf(filename, STRLEN, "%s/%s", cgroup, name);
+        else
+                snprintf(filename, STRLEN, "%s%s%s/%s", CGROUP_MOUNTPOINT, *cgroup == '/' ? "" : "/", cgroup, name);
 
-        return TRUE;
+        return read_file(buf, buf_size, filename, "cgroup", NULL);
 }
 
 
 /**
- * Fill data in the process tree by recusively walking through it
- * @param pt process tree
- * @param i process index
- * @return TRUE if succeeded otherwise FALSE.
+ * Reads a system wide file of the proc filesystem such as meminfo or
+ * stat. The file is opened on the first call and the descriptor is kept
+ * open, later calls read it again from offset 0 with pread(). The buffer
+ * grows until the whole file fits, so large files are not truncated. The
+ * content is valid until the next read of the same file, a ProcFile_T
+ * must not be read from two threads at once.
+ * @param file the proc file
+ * @param bytes_read number of bytes read to the buffer (may be NULL)
+ * @return the 0 terminated content or NULL if the file cannot be read
  */
-void fillprocesstree(ProcessTree_T *pt, int index) {
-        int            i;
-        ProcessTree_T *parent_pt;
-
-        ASSERT(pt);
-
-        if (pt[index].visited == 1)
-                return;
-
-        pt[index].visited         = 1;
-        pt[index].children_sum    = pt[index].children_num;
-        pt[index].mem_kbyte_sum   = pt[index].mem_kbyte;
-        pt[index].cpu_percent_sum = pt[index].cpu_percent;
-
-        for (i = 0; i < pt[index].children_num; i++)
-                fillprocesstree(pt, pt[index].children[i]);
-
-        if (pt[index].parent != -1 && pt[index].parent != index) {
-                parent_pt                   = &pt[pt[index].parent];
-                parent_pt->children_sum    += pt[index].children_sum;
-                parent_pt->mem_kbyte_sum   += pt[index].mem_kbyte_sum;
-                parent_pt->cpu_percent_sum += pt[index].cpu_percent_sum;
-                parent_pt->cpu_percent_sum  = (pt[index].cpu_percent_sum > 1000) ? 1000 : parent_pt->cpu_percent_sum;
-        } 
+char *read_proc_system(ProcFile_T *file, int *bytes_read) {
+        ASSERT(file);
+        ASSERT(file->name);
+
+        if (file->fd >= 0 && file->procfs != Run.procfs)
+                close_proc_system(file);
+        for (int retry = 0; retry < 2; retry++) {
+                ssize_t bytes;
+                int     length = 0;
+
+                if (file->fd < 0) {
+                        char filename[STRLEN];
+
+                        snprintf(filename, STRLEN, "%s/%s", Run.procfs, file->name);
+                        if ((file->fd = open(filename, O_RDONLY)) < 0) {
+                                DEBUG("%s: Cannot open proc file %s -- %s\n", prog, filename, STRERROR);
+                                return NULL;
+                        }
+                        fcntl(file->fd, F_SETFD, FD_CLOEXEC);
+                        file->procfs = Run.procfs;
+                }
+                if (! file->buf) {
+                        file->size = 4096;
+                        file->buf = ALLOC(file->size);
+                }
+                while ((bytes = pread(file->fd, file->buf + length, file->size - 1 - length, length)) > 0) {
+                        length += (int)bytes;
+                        if (length == file->size - 1) {
+                                file->size *= 2;
+                                RESIZE(file->buf, file->size);
+                        }
+                }
+                if (bytes == 0) {
+                        file->buf[length] = 0;
+                        if (bytes_read)
+                                *bytes_read = length;
+                        return file->buf;
+                }
+                /* The descriptor may be stale, open the file again once */
+                DEBUG("%s: Cannot read proc file %s -- %s\n", prog, file->name, STRERROR);
+                close_proc_system(file);
+        }
+        return NULL;
 }
 
+
+/**
+ * Closes the descriptor of a system wide proc file, the buffer is kept
+ * for the next read
+ * @param file the proc file
+ */
+void close_proc_system(ProcFile_T *file) {
+        ASSERT(file);
+
+        if (file->fd >= 0) {
+                close(file->fd);
+                file->fd = -1;
+        }
+}
+
+
+/**
+ * Scans a proc file with one "Name: value" field per line such as
+ * meminfo in one pass, in place. The scan stops when all fields were
+ * found. Fields which are not in the file are left unchanged and their
+ * found flag is FALSE.
+ * @param buf the 0 terminated file content
+ * @param fields the fields to scan, the names include the colon
+ * @param count number of fields
+ * @return number of fields found
+ */
+int scan_proc_fields(const char *buf, ProcField_T *fields, int count) {
+        int found = 0;
+
+        ASSERT(buf);
+        ASSERT(fields);
+
+        for (int i = 0; i < count; i++)
+                fields[i].found = FALSE;
+        const char *line = buf;
+        while (*line && found < count) {
+                const char *colon = strchr(line, ':');
+
+                if (! colon)
+                        break;
+                size_t length = colon - line + 1;
+                for (int i = 0; i < count; i++) {
+                        if (! fields[i].found && ! strncmp(fields[i].name, line, length) && fields[i].name[length] == 0) {
+                                *fields[i].value = strtoul(colon + 1, NULL, 10);
+                                fields[i].found = TRUE;
+                                found++;
+                                break;
+                        }
+                }
+                if (! (line = strchr(colon, '\n')))
+                        break;
+                line++;
+        }
+        return found;
+}
+
+
+/**
+ * Get the actual time as a floating point number
+ * @return time in seconds
+ */
+double get_float_time(void) {    
+        struct timeval t;
+
+        gettimeofday(&t, NULL);
+        return (double) t.tv_sec * 10 + (double) t.tv_usec / 100000.0;
+}
+
+
@@ -25,20 +25,43 @@
 #ifndef MONIT_PROCESS_SYSDEP_H
 #define MONIT_PROCESS_SYSDEP_H
 
+/** The cgroup v2 unified hierarchy mountpoint */
+#define CGROUP_MOUNTPOINT "/sys/fs/cgroup"
+
+/** A system wide proc file which is kept open between reads */
+typedef struct myprocfile {
+        const char *name;                     /**< File name relative to procfs */
+        const char *procfs;            /**< The procfs the descriptor belongs to */
+        int         fd;                 /**< Descriptor of the file or -1 if closed */
+        int         size;                                  /**< Size of the buffer */
+        char       *buf;                  /**< 0 terminated content of the last read */
+} ProcFile_T;
+
+#define PROCFILE(name) {name, NULL, -1, 0, NULL}
+
+/** A field of a "Name: value" proc file such as meminfo */
+typedef struct myprocfield {
+        const char    *name;                     /**< Field name including colon */
+        unsigned long *value;                              /**< Value destination */
+        int            found;                  /**< TRUE if the field was scanned */
+} ProcField_T;
+
 int init_process_info_sysdep(void);
 int init_proc_info_sysdep(void);
 
 int read_proc_file(char *, int, char *, int, int *);
+char *read_proc_system(ProcFile_T *, int *);
+void close_proc_system(ProcFile_T *);
+int scan_proc_fields(const char *, ProcField_T *, int);
+int read_cgroup_file(char *, int, const char *, const char *);
 int getloadavg_sysdep (double *, int);
 int used_system_memory_sysdep(SystemInfo_T *);
 int used_system_cpu_sysdep(SystemInfo_T *);
+int used_system_pressure_sysdep(SystemInfo_T *);
 
 double get_float_time(void);
 
 int    initprocesstree_sysdep(ProcessTree_T **);
-void   fillprocesstree(ProcessTree_T *, int);
-
-int    connectchild(ProcessTree_T *, int, int);
 
 
 #endif
@@ -107,11 +107,25 @@
 
 #define NSEC_PER_SEC    1000000000L
 
-static unsigned long long old_cpu_user     = 0;
-static unsigned long long old_cpu_syst     = 0;
-static unsigned long long old_cpu_wait     = 0;
-static unsigned long long old_cpu_total    = 0;
-static int                page_shift_to_kb = 0;
+/* user, nice, system, idle, iowait, irq, softirq, steal */
+#define CPU_TICKS       8
+
+static unsigned long long  old_cpu_user     = 0;
+static unsigned long long  old_cpu_syst     = 0;
+static unsigned long long  old_cpu_wait     = 0;
+static unsigned long long  old_cpu_steal    = 0;
+static unsigned long long  old_cpu_irq      = 0;
+static unsigned long long  old_cpu_total    = 0;
+static unsigned long long *old_percpu_busy  = NULL;
+static unsigned long long *old_percpu_total = NULL;
+static int                 page_shift_to_kb = 0;
+
+/* The system wide files are kept open, /proc/stat and /proc/meminfo grow
+   with the number of CPUs and NUMA nodes. Only the validator thread
+   collects system data. */
+static ProcFile_T          procstat         = PROCFILE("stat");
+static ProcFile_T          procmeminfo      = PROCFILE("meminfo");
+static ProcFile_T          procpressure[]   = {PROCFILE("pressure/cpu"), PROCFILE("pressure/memory"), PROCFILE("pressure/io")};
 
 
 /**
@@ -136,25 +150,78 @@ static time_t get_starttime() {
 }
 
 
+/**
+ * Scan the time counters following a cpu label in /proc/stat in place,
+ * without copying or allocating. Missing counters are set to zero.
+ * @param p Pointer to the first counter
+ * @param ticks Array of CPU_TICKS counters
+ * @param next Set to the start of the next line or NULL at end of buffer
+ * @return Number of counters found
+ */
+static int scan_cpu_ticks(char *p, unsigned long long ticks[CPU_TICKS], char **next) {
+  int n = 0;
+
+  while (n < CPU_TICKS) {
+    while (*p == ' ')
+      p++;
+    if (*p < '0' || *p > '9')
+      break;
+    ticks[n++] = strtoull(p, &p, 10);
+  }
+  for (int i = n; i < CPU_TICKS; i++)
+    ticks[i] = 0;
+  *next = strchr(p, '\n');
+  if (*next)
+    (*next)++;
+  return n;
+}
+
+
+/**
+ * Read one /proc/pressure file. The "full" line is missing for cpu on
+ * kernels before 5.13 and reported as -10 (unavailable).
+ * @param file The pressure file
+ * @param pressure Pressure stall info to fill
+ * @return TRUE if succeeded otherwise FALSE.
+ */
+static int read_pressure(ProcFile_T *file, Pressure_T *pressure) {
+  char *buf;
+  char *p;
+
+  pressure->some_avg10 = pressure->some_avg60 = pressure->full_avg10 = pressure->full_avg60 = -10;
+  if (! (buf = read_proc_system(file, NULL)))
+    return FALSE;
+  if ((p = strstr(buf, "some avg10="))) {
+    pressure->some_avg10 = (int)(strtod(p + 11, &p) * 10.);
+    if ((p = strstr(p, "avg60=")))
+      pressure->some_avg60 = (int)(strtod(p + 6, NULL) * 10.);
+  }
+  if ((p = strstr(buf, "full avg10="))) {
+    pressure->full_avg10 = (int)(strtod(p + 11, &p) * 10.);
+    if ((p = strstr(p, "avg60=")))
+      pressure->full_avg60 = (int)(strtod(p + 6, NULL) * 10.);
+  }
+  return pressure->some_avg10 >= 0;
+}
+
+
 /* ------------------------------------------------------------------ Public */
 
 
 int init_process_info_sysdep(void) {
-  char *ptr;
-  char  buf[1024];
-  long  page_size;
-  int   page_shift;  
+  char          *buf;
+  long           page_size;
+  int            page_shift;  
+  unsigned long  mem_total = 0UL;
+  ProcField_T    fields[] = {{MEMTOTAL, &mem_total}};
 
-  if (! read_proc_file(buf, sizeof(buf), "meminfo", -1, NULL)) 
-    return FALSE;
-  if (! (ptr = strstr(buf, MEMTOTAL))) {
-    DEBUG("system statistic error -- cannot get real memory amount\n");
+  if (! (buf = read_proc_system(&procmeminfo, NULL)))
     return FALSE;
-  }
-  if (sscanf(ptr+strlen(MEMTOTAL), "%ld", &systeminfo.mem_kbyte_max) != 1) {
+  if (! scan_proc_fields(buf, fields, 1)) {
     DEBUG("system statistic error -- cannot get real memory amount\n");
     return FALSE;
   }
+  systeminfo.mem_kbyte_max = mem_total;
 
   if ((systeminfo.cpus = sysconf(_SC_NPROCESSORS_CONF)) < 0) {
     DEBUG("system statistic error -- cannot get cpu count: %s\n", STRERROR);
@@ -172,6 +239,12 @@ int init_process_info_sysdep(void) {
   for (page_shift = 0; page_size != 1; page_size >>= 1, page_shift++);
   page_shift_to_kb = page_shift - 10;
 
+  systeminfo.cpu_percent = CALLOC(systeminfo.cpus, sizeof(int));
+  old_percpu_busy        = CALLOC(systeminfo.cpus, sizeof(unsigned long long));
+  old_percpu_total       = CALLOC(systeminfo.cpus, sizeof(unsigned long long));
+  for (int i = 0; i < systeminfo.cpus; i++)
+    systeminfo.cpu_percent[i] = -10;
+
   return TRUE;
 }
 
@@ -190,6 +263,7 @@ int initprocesstree_sysdep(ProcessTree_T ** reference) {
   int                 stat_ppid = 0;
   char               *tmp = NULL;
   char                procname[STRLEN];
+  char                pattern[STRLEN];
   char                buf[1024];
   char                stat_item_state;
   long                stat_item_cutime = 0;
@@ -199,24 +273,27 @@ int initprocesstree_sysdep(ProcessTree_T ** reference) {
   unsigned long       stat_item_utime = 0;
   unsigned long       stat_item_stime = 0;
   unsigned long long  stat_item_starttime = 0ULL;
+  time_t              starttime;
   ProcessTree_T      *pt = NULL;
 
   ASSERT(reference);
 
   /* Find all processes in the /proc directory */
-  if ((rv = glob("/proc/[0-9]*", GLOB_ONLYDIR, NULL, &globbuf))) {
+  snprintf(pattern, sizeof(pattern), "%s/[0-9]*", Run.procfs);
+  if ((rv = glob(pattern, GLOB_ONLYDIR, NULL, &globbuf))) {
     LogError("system statistic error -- glob failed: %d (%s)\n", rv, STRERROR);
     return FALSE;
   } 
 
   treesize = globbuf.gl_pathc;
+  starttime = get_starttime();
 
   pt = CALLOC(sizeof(ProcessTree_T), treesize);
 
   /* Insert data from /proc directory */
   for (i = 0; i < treesize; i++) {
 
-    pt[i].pid = atoi(globbuf.gl_pathv[i] + strlen("/proc/"));
+    pt[i].pid = atoi(globbuf.gl_pathv[i] + strlen(Run.procfs) + 1);
 
     if (!read_proc_file(buf, sizeof(buf), "stat", pt[i].pid, NULL)) {
       DEBUG("system statistic error -- cannot read /proc/%d/stat\n", pt[i].pid);
@@ -230,7 +307,7 @@ int initprocesstree_sysdep(ProcessTree_T ** reference) {
       continue;
     }
     *tmp = 0;
-    if (sscanf(buf, "%*d (%256s", procname) != 1) {
+    if (sscanf(buf, "%*d (%255s", procname) != 1) {
       DEBUG("system statistic error -- file /proc/%d/stat process name parse error\n", pt[i].pid);
       continue;
     }
@@ -257,7 +334,7 @@ int initprocesstree_sysdep(ProcessTree_T ** reference) {
     }
 
     pt[i].ppid      = stat_ppid;
-    pt[i].starttime = get_starttime() + (time_t)(stat_item_starttime / HZ);
+    pt[i].starttime = starttime + (time_t)(stat_item_starttime / HZ);
 
     /* jiffies -> seconds = 1 / HZ
      * HZ is defined in "asm/param.h"  and it is usually 1/100s but on
@@ -323,36 +400,43 @@ int getloadavg_sysdep(double *loadv, int nelem) {
  * @return: TRUE if successful, FALSE if failed
  */
 int used_system_memory_sysdep(SystemInfo_T *si) {
-  char          *ptr;
-  char           buf[1024];
+  char          *buf;
   unsigned long  mem_free = 0UL;
   unsigned long  buffers = 0UL;
   unsigned long  cached = 0UL;
   unsigned long  swap_total = 0UL;
   unsigned long  swap_free = 0UL;
-
-  if (! read_proc_file(buf, 1024, "meminfo", -1, NULL)) {
+  ProcField_T    fields[] = {
+    {MEMFREE,   &mem_free},
+    {MEMBUF,    &buffers},
+    {MEMCACHE,  &cached},
+    {SWAPTOTAL, &swap_total},
+    {SWAPFREE,  &swap_free}
+  };
+
+  if (! (buf = read_proc_system(&procmeminfo, NULL))) {
     LogError("system statistic error -- cannot get real memory free amount\n");
     goto error;
   }
+  scan_proc_fields(buf, fields, sizeof(fields) / sizeof(fields[0]));
 
   /* Memory */
-  if (! (ptr = strstr(buf, MEMFREE)) || sscanf(ptr + strlen(MEMFREE), "%ld", &mem_free) != 1) {
+  if (! fields[0].found) {
     LogError("system statistic error -- cannot get real memory free amount\n");
     goto error;
   }
-  if (! (ptr = strstr(buf, MEMBUF)) || sscanf(ptr + strlen(MEMBUF), "%ld", &buffers) != 1)
+  if (! fields[1].found)
     DEBUG("system statistic error -- cannot get real memory buffers amount\n");
-  if (! (ptr = strstr(buf, MEMCACHE)) || sscanf(ptr + strlen(MEMCACHE), "%ld", &cached) != 1)
+  if (! fields[2].found)
     DEBUG("system statistic error -- cannot get real memory cache amount\n");
   si->total_mem_kbyte = systeminfo.mem_kbyte_max - mem_free - buffers - cached;
 
   /* Swap */
-  if (! (ptr = strstr(buf, SWAPTOTAL)) || sscanf(ptr + strlen(SWAPTOTAL), "%ld", &swap_total) != 1) {
+  if (! fields[3].found) {
     LogError("system statistic error -- cannot get swap total amount\n");
     goto error;
   }
-  if (! (ptr = strstr(buf, SWAPFREE)) || sscanf(ptr + strlen(SWAPFREE), "%ld", &swap_free) != 1) {
+  if (! fields[4].found) {
     LogError("system statistic error -- cannot get swap free amount\n");
     goto error;
   }
@@ -374,65 +458,102 @@ int used_system_memory_sysdep(SystemInfo_T *si) {
  */
 int used_system_cpu_sysdep(SystemInfo_T *si) {
   int                rv;
+  char              *next;
+  unsigned long long ticks[CPU_TICKS];
   unsigned long long cpu_total;
   unsigned long long cpu_user;
-  unsigned long long cpu_nice;
   unsigned long long cpu_syst;
-  unsigned long long cpu_idle;
   unsigned long long cpu_wait;
   unsigned long long cpu_irq;
-  unsigned long long cpu_softirq;
-  char               buf[1024];
+  unsigned long long cpu_steal;
+  char              *statbuf;
 
-  if (!read_proc_file(buf, 1024, "stat", -1, NULL)) {
+  if (! (statbuf = read_proc_system(&procstat, NULL))) {
     LogError("system statistic error -- cannot read /proc/stat\n");
     goto error;
   }
 
-  rv = sscanf(buf, "cpu %llu %llu %llu %llu %llu %llu %llu",
-         &cpu_user,
-         &cpu_nice,
-         &cpu_syst,
-         &cpu_idle,
-         &cpu_wait,
-         &cpu_irq,
-         &cpu_softirq);
-  if (rv < 4) {
+  /* linux 2.4.x reports only user, nice, system and idle */
+  if (strncmp(statbuf, "cpu ", 4) || (rv = scan_cpu_ticks(statbuf + 4, ticks, &next)) < 4) {
     LogError("system statistic error -- cannot read cpu usage\n");
     goto error;
-  } else if (rv == 4) {
-    /* linux 2.4.x doesn't support these values */
-    cpu_wait    = 0;
-    cpu_irq     = 0;
-    cpu_softirq = 0;
   }
 
-  cpu_total = cpu_user + cpu_nice + cpu_syst + cpu_idle + cpu_wait + cpu_irq + cpu_softirq;
-  cpu_user  = cpu_user + cpu_nice;
-
-  if (old_cpu_total == 0) {
-    si->total_cpu_user_percent = -10;
-    si->total_cpu_syst_percent = -10;
-    si->total_cpu_wait_percent = -10;
+  cpu_total = 0;
+  for (int i = 0; i < CPU_TICKS; i++)
+    cpu_total += ticks[i];
+  cpu_user  = ticks[0] + ticks[1];
+  cpu_syst  = ticks[2];
+  cpu_wait  = ticks[4];
+  cpu_irq   = ticks[5] + ticks[6];
+  cpu_steal = ticks[7];
+
+  if (old_cpu_total == 0 || cpu_total <= old_cpu_total) {
+    si->total_cpu_user_percent  = -10;
+    si->total_cpu_syst_percent  = -10;
+    si->total_cpu_wait_percent  = -10;
+    si->total_cpu_irq_percent   = -10;
+    si->total_cpu_steal_percent = -10;
   } else {
     unsigned long long delta = cpu_total - old_cpu_total;
 
-    si->total_cpu_user_percent = (int)(1000 * (double)(cpu_user - old_cpu_user) / delta);
-    si->total_cpu_syst_percent = (int)(1000 * (double)(cpu_syst - old_cpu_syst) / delta);
-    si->total_cpu_wait_percent = (int)(1000 * (double)(cpu_wait - old_cpu_wait) / delta);
+    si->total_cpu_user_percent  = (int)(1000 * (double)(cpu_user - old_cpu_user) / delta);
+    si->total_cpu_syst_percent  = (int)(1000 * (double)(cpu_syst - old_cpu_syst) / delta);
+    si->total_cpu_wait_percent  = (int)(1000 * (double)(cpu_wait - old_cpu_wait) / delta);
+    si->total_cpu_irq_percent   = rv > 6 ? (int)(1000 * (double)(cpu_irq - old_cpu_irq) / delta) : -10;
+    si->total_cpu_steal_percent = rv > 7 ? (int)(1000 * (double)(cpu_steal - old_cpu_steal) / delta) : -10;
   }
 
   old_cpu_user  = cpu_user;
   old_cpu_syst  = cpu_syst;
   old_cpu_wait  = cpu_wait;
+  old_cpu_irq   = cpu_irq;
+  old_cpu_steal = cpu_steal;
   old_cpu_total = cpu_total;
+
+  /* The per-CPU lines follow the aggregate line, offline CPUs are omitted */
+  while (next && si->cpu_percent && ! strncmp(next, "cpu", 3) && next[3] >= '0' && next[3] <= '9') {
+    char *p;
+    int   cpu = (int)strtol(next + 3, &p, 10);
+
+    if (scan_cpu_ticks(p, ticks, &next) < 4 || cpu >= si->cpus)
+      continue;
+    cpu_total = 0;
+    for (int i = 0; i < CPU_TICKS; i++)
+      cpu_total += ticks[i];
+    /* busy = all but idle and iowait */
+    unsigned long long cpu_busy = cpu_total - ticks[3] - ticks[4];
+    if (old_percpu_total[cpu] == 0 || cpu_total <= old_percpu_total[cpu])
+      si->cpu_percent[cpu] = -10;
+    else
+      si->cpu_percent[cpu] = (int)(1000 * (double)(cpu_busy - old_percpu_busy[cpu]) / (cpu_total - old_percpu_total[cpu]));
+    old_percpu_busy[cpu]  = cpu_busy;
+    old_percpu_total[cpu] = cpu_total;
+  }
+
   return TRUE;
 
   error:
-  si->total_cpu_user_percent = 0;
-  si->total_cpu_syst_percent = 0;
-  si->total_cpu_wait_percent = 0;
+  si->total_cpu_user_percent  = 0;
+  si->total_cpu_syst_percent  = 0;
+  si->total_cpu_wait_percent  = 0;
+  si->total_cpu_irq_percent   = 0;
+  si->total_cpu_steal_percent = 0;
   return FALSE;
 }
 
 
+/**
+ * This routine returns the pressure stall information of cpu, memory and
+ * io from /proc/pressure (linux 4.20 and later with PSI enabled).
+ * @return: TRUE if successful, FALSE if failed (or not available)
+ */
+int used_system_pressure_sysdep(SystemInfo_T *si) {
+  int rv = read_pressure(&procpressure[0], &si->pressure_cpu);
+
+  rv = read_pressure(&procpressure[1], &si->pressure_memory) && rv;
+  rv = read_pressure(&procpressure[2], &si->pressure_io) && rv;
+  return rv;
+}
+
+
@@ -287,3 +287,12 @@ int used_system_cpu_sysdep(SystemInfo_T *si) {
   return TRUE;  
 }
 
+
+/**
+ * This routine returns the pressure stall information (not available)
+ * @return: TRUE if successful, FALSE if failed (or not available)
+ */
+int used_system_pressure_sysdep(SystemInfo_T *si) {
+  return FALSE;
+}
+
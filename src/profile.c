@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include "monit.h"
+#include "profile.h"
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+struct myprofile {
+        Histogram_T test[Profile_Tests];
+};
+
+
+static struct myhistogram tests[Profile_Tests];
+static struct myhistogram types[TYPE_PROGRAM + 1];
+static struct myhistogram phases[Profile_Phases];
+static unsigned long long cycles = 0ULL;
+static unsigned long long overruns = 0ULL;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+/* Copy the histogram if it has samples. Must be called with the mutex locked */
+static int copy(Histogram_T h, Histogram_T c) {
+        if (! h || ! h->count)
+                return FALSE;
+        *c = *h;
+        return TRUE;
+}
+
+
+static int bucket(unsigned long long value) {
+        if (value < PROFILE_SUBBUCKETS)
+                return (int)value;
+        int msb = 0;
+        for (unsigned long long v = value; v >>= 1;)
+                msb++;
+        int b = (msb - PROFILE_SUBBITS + 1) * PROFILE_SUBBUCKETS + (int)((value >> (msb - PROFILE_SUBBITS)) & (PROFILE_SUBBUCKETS - 1));
+        return b < PROFILE_BUCKETS ? b : PROFILE_BUCKETS - 1;
+}
+
+
+static void add(Histogram_T h, long long duration) {
+        unsigned long long value = duration > 0 ? duration : 0;
+        h->bucket[bucket(value)]++;
+        h->count++;
+        h->sum += value;
+        if (value > h->max)
+                h->max = value;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void Profile_record(Service_T s, Profile_Test test, long long duration) {
+        ASSERT(s);
+        ASSERT(test >= 0 && test < Profile_Tests);
+        LOCK(mutex)
+        {
+                if (! s->profile)
+                        NEW(s->profile);
+                if (! s->profile->test[test])
+                        NEW(s->profile->test[test]);
+                add(s->profile->test[test], duration);
+                add(&tests[test], duration);
+                if (test == Profile_Check && s->type >= 0 && s->type <= TYPE_PROGRAM)
+                        add(&types[s->type], duration);
+        }
+        END_LOCK;
+}
+
+
+void Profile_cycle(long long duration) {
+        LOCK(mutex)
+        {
+                add(&phases[Profile_Collect], Run.cycle.prepare + Run.cycle.collect);
+                add(&phases[Profile_Checks], Run.cycle.check);
+                add(&phases[Profile_Events], Run.cycle.event);
+                add(&phases[Profile_Cycle], duration);
+                cycles++;
+                if (duration > Run.polltime * 1000000LL)
+                        overruns++;
+        }
+        END_LOCK;
+        if (duration > Run.polltime * 1000000LL)
+                DEBUG("The check cycle took %.3fs, longer than the poll interval %ds\n", duration / 1000000., Run.polltime);
+}
+
+
+int Profile_test(Service_T s, Profile_Test test, Histogram_T h) {
+        int rv;
+        ASSERT(test >= 0 && test < Profile_Tests);
+        ASSERT(h);
+        LOCK(mutex)
+        {
+                rv = copy(s ? (s->profile ? s->profile->test[test] : NULL) : &tests[test], h);
+        }
+        END_LOCK;
+        return rv;
+}
+
+
+int Profile_type(int type, Histogram_T h) {
+        int rv;
+        ASSERT(type >= 0 && type <= TYPE_PROGRAM);
+        ASSERT(h);
+        LOCK(mutex)
+        {
+                rv = copy(&types[type], h);
+        }
+        END_LOCK;
+        return rv;
+}
+
+
+int Profile_phase(Profile_Phase phase, Histogram_T h) {
+        int rv;
+        ASSERT(phase >= 0 && phase < Profile_Phases);
+        ASSERT(h);
+        LOCK(mutex)
+        {
+                rv = copy(&phases[phase], h);
+        }
+        END_LOCK;
+        return rv;
+}
+
+
+void Profile_cycles(unsigned long long *c, unsigned long long *o) {
+        ASSERT(c);
+        ASSERT(o);
+        LOCK(mutex)
+        {
+                *c = cycles;
+                *o = overruns;
+        }
+        END_LOCK;
+}
+
+
+long long Histogram_bucket(int b) {
+        ASSERT(b >= 0 && b < PROFILE_BUCKETS);
+        if (b < PROFILE_SUBBUCKETS)
+                return b;
+        return (long long)(PROFILE_SUBBUCKETS + b % PROFILE_SUBBUCKETS) << (b / PROFILE_SUBBUCKETS - 1);
+}
+
+
+long long Histogram_percentile(Histogram_T h, double percentile) {
+        ASSERT(h);
+        if (! h->count)
+                return 0LL;
+        unsigned long long rank = (unsigned long long)(h->count * percentile / 100. + 0.5), seen = 0ULL;
+        if (rank < 1)
+                rank = 1;
+        for (int b = 0; b < PROFILE_BUCKETS; b++) {
+                if ((seen += h->bucket[b]) >= rank) {
+                        long long upper = b + 1 < PROFILE_BUCKETS ? Histogram_bucket(b + 1) - 1 : (long long)h->max;
+                        return upper < (long long)h->max ? upper : (long long)h->max;
+                }
+        }
+        return h->max;
+}
+
+
+void Profile_free(Profile_T *p) {
+        Profile_T profile;
+        ASSERT(p && *p);
+        LOCK(mutex)
+        {
+                profile = *p;
+                *p = NULL;
+        }
+        END_LOCK;
+        for (int i = 0; i < Profile_Tests; i++)
+                FREE(profile->test[i]);
+        FREE(profile);
+}
+
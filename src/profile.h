@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+
+
+#ifndef MONIT_PROFILE_H
+#define MONIT_PROFILE_H
+
+#include "monit.h"
+
+
+/**
+ * Check latency profile.
+ *
+ * The duration of every service check and of the connection, content
+ * match and checksum tests is recorded in log-linear histograms, per
+ * service and per check type, along with the duration of the validate()
+ * phases. A histogram has PROFILE_SUBBUCKETS linear buckets per power of
+ * two microseconds, so a value is recorded with a few operations and a
+ * relative error below 25%. The histograms of a service are allocated on
+ * the first sample of the test. Cycles which take longer than the poll
+ * interval are counted as overruns. The histograms are updated by the
+ * validator and read by the http thread, so they are only read through a
+ * copy taken under the profile lock.
+ *
+ *  @file
+ */
+
+
+#define PROFILE_SUBBITS    2
+#define PROFILE_SUBBUCKETS (1 << PROFILE_SUBBITS)
+#define PROFILE_BUCKETS    128                   /**< Up to 2^33 us (~2.4h) */
+
+
+/** Profiled tests of a service */
+typedef enum {
+        Profile_Check = 0,              /**< The whole service check */
+        Profile_Connection,                  /**< A port or unix socket test */
+        Profile_Match,                              /**< The content match */
+        Profile_Checksum,                                /**< The checksum */
+        Profile_Tree,                             /**< The directory tree scan */
+        Profile_Tests
+} Profile_Test;
+
+
+/** Profiled phases of the validate() cycle, see Run.cycle */
+typedef enum {
+        Profile_Collect = 0,
+        Profile_Checks,
+        Profile_Events,
+        Profile_Cycle,
+        Profile_Phases
+} Profile_Phase;
+
+
+typedef struct myhistogram {
+        unsigned long long count;
+        unsigned long long sum;                            /**< Sum of values [us] */
+        unsigned long long max;                            /**< Maximum value [us] */
+        unsigned int bucket[PROFILE_BUCKETS];
+} *Histogram_T;
+
+
+/**
+ * Record the duration of a test of the service in the service and check
+ * type histograms
+ * @param s A Service object
+ * @param test The test
+ * @param duration The duration [us]
+ */
+void Profile_record(Service_T s, Profile_Test test, long long duration);
+
+
+/**
+ * Record the duration of the validate() cycle and of its phases, which
+ * are read from Run.cycle, and count the overrun of the poll interval
+ * @param duration The cycle duration [us]
+ */
+void Profile_cycle(long long duration);
+
+
+/**
+ * Copy a test histogram
+ * @param s A Service object or NULL for the histogram of all services
+ * @param test The test
+ * @param h Output of the histogram copy
+ * @return TRUE if the histogram has samples otherwise FALSE
+ */
+int Profile_test(Service_T s, Profile_Test test, Histogram_T h);
+
+
+/**
+ * Copy the check histogram of a service type
+ * @param type The service type (TYPE_*)
+ * @param h Output of the histogram copy
+ * @return TRUE if the histogram has samples otherwise FALSE
+ */
+int Profile_type(int type, Histogram_T h);
+
+
+/**
+ * Copy a cycle phase histogram
+ * @param phase The phase
+ * @param h Output of the histogram copy
+ * @return TRUE if the histogram has samples otherwise FALSE
+ */
+int Profile_phase(Profile_Phase phase, Histogram_T h);
+
+
+/**
+ * Get the cycle counters
+ * @param cycles Output of the number of cycles
+ * @param overruns Output of the number of cycles longer than the poll interval
+ */
+void Profile_cycles(unsigned long long *cycles, unsigned long long *overruns);
+
+
+/**
+ * Get the lower bound of a histogram bucket
+ * @param bucket The bucket index
+ * @return The smallest value of the bucket [us]
+ */
+long long Histogram_bucket(int bucket);
+
+
+/**
+ * Estimate a percentile of the recorded values. The upper bound of the
+ * bucket holding the percentile is returned, capped to the maximum value.
+ * @param h A Histogram object
+ * @param percentile The percentile (0-100)
+ * @return The percentile value [us] or 0 if the histogram is empty
+ */
+long long Histogram_percentile(Histogram_T h, double percentile);
+
+
+/**
+ * Free the profile of a service
+ * @param p A Profile object reference
+ */
+void Profile_free(Profile_T *p);
+
+
+#endif
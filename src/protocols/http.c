@@ -28,6 +28,10 @@
 #include <stdio.h>
 #endif
 
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+
 #ifdef HAVE_ERRNO_H
 #include <errno.h>
 #endif
@@ -52,8 +56,7 @@
 #include <netinet/in.h>
 #endif
 
-#include "md5.h"
-#include "sha1.h"
+#include "digest.h"
 #include "base64.h"
 #include "protocol.h"
 #include "httpstatus.h"
@@ -85,120 +88,209 @@
 #define  READ_SIZE  8192
 #define  LINE_SIZE  512
 
+/* Content is matched in windows of READ_SIZE bytes, the last OVERLAP bytes
+ of a window are matched again with the next window so a match spanning
+ the window boundary is found if it is not longer than OVERLAP bytes */
+#define  OVERLAP    (READ_SIZE / 4)
+
+/* Unread body data up to DRAIN_MAX bytes is skipped to keep a connection
+ for reuse, it is cheaper to reconnect than to read larger bodies */
+#define  DRAIN_MAX  65536
+
+#ifndef HAVE_REGEX_H
+#define  REG_NOTBOL 0
+#define  REG_NOTEOL 0
+#endif
+
+
+/* The response body reader, decodes the chunked transfer encoding */
+typedef struct {
+        Socket_T  socket;
+        int       chunked;                        /**< TRUE if chunked encoding */
+        int       eof;                       /**< TRUE when the body was read */
+        long long remaining;  /**< Bytes left in the chunk or body, -1 if unknown */
+} Body_T;
+
 
 /* ----------------------------------------------------------------- Private */
 
 
-static int do_regex(Socket_T socket, int content_length, Request_T R) {
-        int n, size = 0, length = 0, rv = FALSE, regex_return;
-        char *buf = NULL;
+/**
+ * Read the next chunk size line. The line ending of the previous chunk
+ * is skipped and the trailer is consumed after the last chunk.
+ * @return TRUE on success, FALSE if the chunk header is invalid
+ */
+static int read_chunk_header(Body_T *B) {
+        char buf[LINE_SIZE], *end;
 
-        if (content_length == 0) {
-                socket_setError(socket, "HTTP error: No content returned from server\n");
+        do {
+                if (! socket_readln(B->socket, buf, LINE_SIZE)) {
+                        socket_setError(B->socket, "HTTP error: Cannot read the chunk size -- %s\n", STRERROR);
+                        return FALSE;
+                }
+                Str_chomp(buf);
+        } while (! *buf);
+        B->remaining = strtoll(buf, &end, 16);
+        if (end == buf || B->remaining < 0) {
+                socket_setError(B->socket, "HTTP error: Invalid chunk size '%s'\n", buf);
                 return FALSE;
-        } else if (content_length < 0) { /* Not defined in response */
-                content_length = HTTP_CONTENT_MAX;
-        } else if (content_length > HTTP_CONTENT_MAX) {
-                content_length = HTTP_CONTENT_MAX;
         }
+        if (B->remaining == 0) {
+                /* Last chunk, skip the trailer */
+                while (socket_readln(B->socket, buf, LINE_SIZE) && ! ((buf[0] == '\r' && buf[1] == '\n') || buf[0] == '\n'))
+                        ;
+                B->eof = TRUE;
+        }
+        return TRUE;
+}
 
-        length = content_length;
-        buf = ALLOC(content_length + 1);
 
-        do {
-                n = socket_read(socket, &buf[size], length);
+/**
+ * Read up to size bytes of the response body
+ * @return The number of bytes read, 0 at the end of the body or -1 on error
+ */
+static int read_body(Body_T *B, char *buf, int size) {
+        int n;
+
+        if (B->eof)
+                return 0;
+        if (B->chunked && B->remaining == 0 && (! read_chunk_header(B) || B->eof))
+                return B->eof ? 0 : -1;
+        if (B->remaining >= 0 && B->remaining < size)
+                size = (int)B->remaining;
+        if ((n = socket_read(B->socket, buf, size)) <= 0) {
+                if (B->remaining < 0) {
+                        /* Body delimited by the connection close */
+                        B->eof = TRUE;
+                        return 0;
+                }
+                socket_setError(B->socket, "HTTP error: receiving data -- %s\n", STRERROR);
+                return -1;
+        }
+        if (B->remaining >= 0) {
+                B->remaining -= n;
+                if (B->remaining == 0 && ! B->chunked)
+                        B->eof = TRUE;
+        }
+        return n;
+}
+
+
+/**
+ * Skip the rest of a length delimited or chunked body
+ * @return TRUE if the whole body was read
+ */
+static int drain(Body_T *B) {
+        char buf[READ_SIZE];
+        long long total = 0;
+
+        while (! B->eof && total < DRAIN_MAX) {
+                int n = read_body(B, buf, sizeof(buf));
                 if (n <= 0)
                         break;
-                size += n;
-                length -= n;
-        } while (length > 0);
-
-        if (size == 0) {
-                socket_setError(socket, "HTTP error: receiving data -- %s\n", STRERROR);
-                goto error;
+                total += n;
         }
-        buf[size] = 0;
+        return B->eof;
+}
 
+
+static int match(Request_T R, char *window, int length, int flags) {
+        window[length] = 0;
 #ifdef HAVE_REGEX_H
-        regex_return = regexec(R->regex, buf, 0, NULL, 0);
-#else
-        regex_return = strstr(buf, R->regex) ? 0 : 1;
-#endif
-        switch (R->operator) {
-                case OPERATOR_EQUAL:
-                        if (regex_return == 0) {
-                                rv = TRUE;
-                                DEBUG("HTTP: Regular expression matches\n");
-                        } else {
-#ifdef HAVE_REGEX_H
-                                char errbuf[STRLEN];
-                                regerror(regex_return, NULL, errbuf, sizeof(errbuf));
-                                socket_setError(socket, "HTTP error: Regular expression doesn't match: %s\n", errbuf);
+        return regexec(R->regex, window, 0, NULL, flags) == 0;
 #else
-                                socket_setError(socket, "HTTP error: Regular expression doesn't match\n");
+        return strstr(window, R->regex) ? TRUE : FALSE;
 #endif
-                        }
-                        break;
-                case OPERATOR_NOTEQUAL:
-                        if (regex_return == 0) {
-                                socket_setError(socket, "HTTP error: Regular expression matches\n");
-                        } else {
-                                rv = TRUE;
-                                DEBUG("HTTP: Regular expression doesn't match\n");
-                        }
-                        break;
-                default:
-                        socket_setError(socket, "HTTP error: Invalid content operator\n");
-        }
-
-error:
-        FREE(buf);
-        return rv;
 }
 
 
-static int check_request_checksum(Socket_T socket, int content_length, char *checksum, int hashtype) {
-        int n, keylength = 0;
-        MD_T result, hash;
-        md5_context_t ctx_md5;
-        sha1_context_t ctx_sha1;
-        char buf[READ_SIZE];
-
-        if (content_length <= 0) {
-                DEBUG("HTTP warning: Response does not contain a valid Content-Length -- cannot compute checksum\n");
-                return TRUE;
+/**
+ * Read the response body and test the content and the checksum as the
+ * data arrives. Reading stops as soon as all tests are decided, the
+ * content is tested up to HTTP_CONTENT_MAX bytes. The memory used is
+ * fixed regardless of the response size.
+ * @return TRUE if the tests succeeded otherwise FALSE
+ */
+static int check_body(Body_T *B, Port_T P) {
+        int n = 0, length = 0, flags = 0, matched = FALSE;
+        long long total = 0;
+        char window[READ_SIZE + 1];
+        Digest_T digest;
+        unsigned char hash[MD_SIZE];
+        Request_T R = (P->url_request && P->url_request->regex) ? P->url_request : NULL;
+        int hashtype = P->request_checksum ? P->request_hashtype : 0;
+
+        if (hashtype && ! Digest_init(&digest, hashtype)) {
+                socket_setError(B->socket, "HTTP checksum error: Unknown hash type\n");
+                return FALSE;
         }
 
-        switch (hashtype) {
-                case HASH_MD5:
-                        md5_init(&ctx_md5);
-                        for (n = 0; content_length > 0; content_length -= n) {
-                                if ((n = socket_read(socket, buf, content_length > sizeof(buf) ? sizeof(buf) : content_length)) < 0)
-                                        break;
-                                md5_append(&ctx_md5, (const md5_byte_t *)buf, n);
-                        }
-                        md5_finish(&ctx_md5, (md5_byte_t *)hash);
-                        keylength = 16; /* Raw key bytes not string chars! */
+        while (TRUE) {
+                int scan = R && ! matched && total < HTTP_CONTENT_MAX;
+                if (! scan && ! hashtype)
                         break;
-                case HASH_SHA1:
-                        sha1_init(&ctx_sha1);
-                        for (n = 0; content_length > 0; content_length -= n) {
-                                if ((n = socket_read(socket, buf, content_length > sizeof(buf) ? sizeof(buf) : content_length)) < 0)
-                                        break;
-                                sha1_append(&ctx_sha1, (md5_byte_t *)buf, n);
-                        }
-                        sha1_finish(&ctx_sha1, (md5_byte_t *)hash);
-                        keylength = 20; /* Raw key bytes not string chars! */
+                if (! scan && length > 0) {
+                        /* The content limit is reached: test the rest of the window, then it only buffers the data for the digest */
+                        if (R && ! matched)
+                                matched = match(R, window, length, flags | REG_NOTEOL);
+                        length = 0;
+                }
+                if ((n = read_body(B, window + length, READ_SIZE - length)) <= 0)
                         break;
-                default:
-                        socket_setError(socket, "HTTP checksum error: Unknown hash type\n");
+                if (hashtype)
+                        Digest_append(&digest, window + length, n);
+                total += n;
+                if (scan && (length += n) == READ_SIZE) {
+                        if ((matched = match(R, window, length, flags | REG_NOTEOL))) {
+                                length = 0;
+                        } else {
+                                memmove(window, window + length - OVERLAP, OVERLAP);
+                                length = OVERLAP;
+                                flags = REG_NOTBOL;
+                        }
+                }
+        }
+        /* Finish the digest also if reading failed, to release its context */
+        if (hashtype)
+                Digest_finish(&digest, hash);
+        if (n < 0)
+                return FALSE;
+
+        if (R) {
+                if (total == 0) {
+                        socket_setError(B->socket, "HTTP error: No content returned from server\n");
                         return FALSE;
+                }
+                if (! matched && length > 0)
+                        matched = match(R, window, length, flags | (B->eof ? 0 : REG_NOTEOL));
+                switch (R->operator) {
+                        case OPERATOR_EQUAL:
+                                if (! matched) {
+                                        socket_setError(B->socket, "HTTP error: Regular expression doesn't match\n");
+                                        return FALSE;
+                                }
+                                DEBUG("HTTP: Regular expression matches\n");
+                                break;
+                        case OPERATOR_NOTEQUAL:
+                                if (matched) {
+                                        socket_setError(B->socket, "HTTP error: Regular expression matches\n");
+                                        return FALSE;
+                                }
+                                DEBUG("HTTP: Regular expression doesn't match\n");
+                                break;
+                        default:
+                                socket_setError(B->socket, "HTTP error: Invalid content operator\n");
+                                return FALSE;
+                }
         }
 
-        if (strncasecmp(Util_digest2Bytes((unsigned char *)hash, keylength, result), checksum, keylength * 2) != 0) {
-                socket_setError(socket, "HTTP checksum error: Document checksum mismatch\n");
-                return FALSE;
-        } else {
+        if (hashtype) {
+                MD_T result;
+                int keylength = Digest_length(hashtype); /* Raw key bytes not string chars! */
+                if (strncasecmp(Util_digest2Bytes(hash, keylength, result), P->request_checksum, keylength * 2) != 0) {
+                        socket_setError(B->socket, "HTTP checksum error: Document checksum mismatch\n");
+                        return FALSE;
+                }
                 DEBUG("HTTP: Succeeded testing document checksum\n");
         }
         return TRUE;
@@ -212,8 +304,10 @@ static int check_request_checksum(Socket_T socket, int content_length, char *che
  * @return TRUE if the response is valid otherwise FALSE
  */
 static int check_request(Socket_T socket, Port_T P) {
-        int status, content_length = -1;
+        int status, framed, keepalive;
         char buf[LINE_SIZE];
+        Body_T B = {.socket = socket, .chunked = FALSE, .eof = FALSE, .remaining = -1};
+
         if (! socket_readln(socket, buf, LINE_SIZE)) {
                 socket_setError(socket, "HTTP: Error receiving data -- %s\n", STRERROR);
                 return FALSE;
@@ -227,26 +321,37 @@ static int check_request(Socket_T socket, Port_T P) {
                 socket_setError(socket, "HTTP error: Server returned status %d\n", status);
                 return FALSE;
         }
-        /* Get Content-Length header value */
+        keepalive = Str_startsWith(buf, "HTTP/1.1") && status >= 200;
+        /* Get the Content-Length and Transfer-Encoding header values */
         while (socket_readln(socket, buf, LINE_SIZE)) {
                 if ((buf[0] == '\r' && buf[1] == '\n') || (buf[0] == '\n'))
                         break;
                 Str_chomp(buf);
                 if (Str_startsWith(buf, "Content-Length")) {
-                        if (! sscanf(buf, "%*s%*[: ]%d", &content_length)) {
+                        if (! sscanf(buf, "%*s%*[: ]%lld", &B.remaining)) {
                                 socket_setError(socket, "HTTP error: Parsing Content-Length response header '%s'\n", buf);
                                 return FALSE;
                         }
-                        if (content_length < 0) {
+                        if (B.remaining < 0) {
                                 socket_setError(socket, "HTTP error: Illegal Content-Length response header '%s'\n", buf);
                                 return FALSE;
                         }
+                } else if (Str_startsWith(buf, "Transfer-Encoding") && Str_sub(buf, "chunked")) {
+                        B.chunked = TRUE;
+                } else if (Str_startsWith(buf, "Connection") && Str_sub(buf, "close")) {
+                        keepalive = FALSE;
                 }
         }
-        if (P->url_request && P->url_request->regex && ! do_regex(socket, content_length, P->url_request))
+        if (B.chunked)
+                B.remaining = 0; /* Chunked encoding overrides Content-Length, see RFC 2616 4.4 */
+        else if (B.remaining == 0 || status == 204 || status == 304 || (status >= 100 && status < 200))
+                B.eof = TRUE;
+        framed = B.eof || B.chunked || B.remaining >= 0;
+        if (((P->url_request && P->url_request->regex) || P->request_checksum) && ! check_body(&B, P))
                 return FALSE;
-        if (P->request_checksum)
-                return check_request_checksum(socket, content_length, P->request_checksum, P->request_hashtype);
+        /* The connection can be reused only if the response was read completely */
+        if (Run.keepalive && keepalive && framed && drain(&B))
+                socket_set_reusable(socket, TRUE);
         return TRUE;
 }
 
@@ -305,8 +410,10 @@ int check_http(Socket_T socket) {
                          "Host: %s\r\n"
                          "Accept: */*\r\n"
                          "User-Agent: %s/%s\r\n"
+                         "Connection: %s\r\n"
                          "%s\r\n",
                          request, hostheader, prog, VERSION,
+                         Run.keepalive ? "keep-alive" : "close",
                          get_auth_header(P, auth, STRLEN)) < 0) {
                 socket_setError(socket, "HTTP: error sending data -- %s\n", STRERROR);
                 return FALSE;
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#ifdef HAVE_SYS_SOCKET_H
+#include <sys/socket.h>
+#endif
+
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#include <arpa/inet.h>
+
+#include "monit.h"
+#include "resolver.h"
+
+// libmonit
+#include "system/Time.h"
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+#define BUCKETS 64
+
+
+typedef struct myresolverentry {
+        char           *hostname;
+        struct in_addr  address;                        /**< Last known address */
+        int             resolved;          /**< TRUE if address was ever set */
+        int             status;      /**< Result of the last getaddrinfo call */
+        time_t          updated;                /**< Time of the last success */
+        time_t          expire;         /**< Time when the entry is renewed */
+        time_t          used;                       /**< Time of the last use */
+        struct myresolverentry *next;
+} *ResolverEntry_T;
+
+
+static ResolverEntry_T cache[BUCKETS];
+static ResolverStatistics_T statistics;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+static unsigned int hash(const char *hostname) {
+        unsigned int h = 5381;
+        for (const unsigned char *p = (const unsigned char *)hostname; *p; p++)
+                h = h * 33 + *p;
+        return h % BUCKETS;
+}
+
+
+/* Must be called with the mutex locked */
+static ResolverEntry_T find(const char *hostname) {
+        for (ResolverEntry_T e = cache[hash(hostname)]; e; e = e->next)
+                if (Str_isEqual(e->hostname, hostname))
+                        return e;
+        return NULL;
+}
+
+
+/**
+ * Query the system resolver. Called without the mutex locked, the
+ * lookup may block for the resolver timeout.
+ */
+static int lookup(const char *hostname, struct in_addr *address) {
+        int status;
+        struct addrinfo hints;
+        struct addrinfo *result;
+
+        memset(&hints, 0, sizeof(struct addrinfo));
+        hints.ai_family = AF_INET; /* we support just IPv4 currently */
+        if ((status = getaddrinfo(hostname, NULL, &hints, &result)) == 0) {
+                *address = ((struct sockaddr_in *)result->ai_addr)->sin_addr;
+                freeaddrinfo(result);
+        }
+        return status;
+}
+
+
+/**
+ * Store the result of a lookup, creating the entry if necessary.
+ * Must be called with the mutex locked.
+ */
+static ResolverEntry_T update(const char *hostname, int status, struct in_addr *address, time_t now) {
+        ResolverEntry_T e = find(hostname);
+        if (! e) {
+                unsigned int h = hash(hostname);
+                NEW(e);
+                e->hostname = Str_dup(hostname);
+                e->used = now;
+                e->next = cache[h];
+                cache[h] = e;
+                statistics.entries++;
+        }
+        e->status = status;
+        if (status == 0) {
+                e->address = *address;
+                e->resolved = TRUE;
+                e->updated = now;
+                e->expire = now + RESOLVER_TTL;
+        } else {
+                e->expire = now + RESOLVER_NEGATIVE_TTL;
+        }
+        return e;
+}
+
+
+/**
+ * Answer a lookup from the entry, serving the last known address if the
+ * hostname cannot be resolved currently. Must be called with the mutex
+ * locked.
+ */
+static int answer(ResolverEntry_T e, struct sockaddr_in *sin, time_t now) {
+        if (e->status == 0) {
+                sin->sin_addr = e->address;
+                return 0;
+        }
+        if (e->resolved && now - e->updated < RESOLVER_STALE) {
+                DEBUG("Cannot resolve %s -- using the address resolved %lds ago\n", e->hostname, (long)(now - e->updated));
+                statistics.stale++;
+                sin->sin_addr = e->address;
+                return 0;
+        }
+        statistics.failures++;
+        return e->status;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+int Resolver_getAddress(const char *hostname, struct sockaddr_in *sin) {
+        int status = -1, cached = FALSE;
+        time_t now = Time_now();
+        struct in_addr address;
+
+        ASSERT(hostname);
+        ASSERT(sin);
+
+        if (inet_pton(AF_INET, hostname, &address) == 1) {
+                sin->sin_addr = address;
+                return 0;
+        }
+        LOCK(mutex)
+        {
+                ResolverEntry_T e = find(hostname);
+                if (e && e->expire > now) {
+                        e->used = now;
+                        statistics.hits++;
+                        status = answer(e, sin, now);
+                        cached = TRUE;
+                }
+        }
+        END_LOCK;
+        if (cached)
+                return status;
+        /* Cache miss, resolve without holding the lock */
+        status = lookup(hostname, &address);
+        LOCK(mutex)
+        {
+                ResolverEntry_T e = update(hostname, status, &address, now);
+                e->used = now;
+                statistics.misses++;
+                status = answer(e, sin, now);
+        }
+        END_LOCK;
+        return status;
+}
+
+
+void Resolver_refresh() {
+        int n = 0;
+        time_t now = Time_now();
+        char *renew[BUCKETS];
+
+        /* Collect a bounded batch of entries which expire before the next cycle */
+        LOCK(mutex)
+        {
+                for (int i = 0; i < BUCKETS; i++) {
+                        for (ResolverEntry_T *p = &cache[i]; *p;) {
+                                ResolverEntry_T e = *p;
+                                if (now - e->used > RESOLVER_STALE) {
+                                        *p = e->next;
+                                        FREE(e->hostname);
+                                        FREE(e);
+                                        statistics.entries--;
+                                        continue;
+                                }
+                                if (n < BUCKETS && e->status == 0 && e->expire <= now + Run.polltime)
+                                        renew[n++] = Str_dup(e->hostname);
+                                p = &e->next;
+                        }
+                }
+        }
+        END_LOCK;
+        for (int i = 0; i < n; i++) {
+                struct in_addr address;
+                int status = lookup(renew[i], &address);
+                LOCK(mutex)
+                {
+                        update(renew[i], status, &address, now);
+                        statistics.refreshes++;
+                }
+                END_LOCK;
+                if (status != 0)
+                        DEBUG("Cannot renew the address of %s -- %s\n", renew[i], gai_strerror(status));
+                FREE(renew[i]);
+        }
+}
+
+
+void Resolver_statistics(ResolverStatistics_T *s) {
+        ASSERT(s);
+        LOCK(mutex)
+        {
+                *s = statistics;
+        }
+        END_LOCK;
+}
+
+
+void Resolver_free() {
+        LOCK(mutex)
+        {
+                for (int i = 0; i < BUCKETS; i++) {
+                        while (cache[i]) {
+                                ResolverEntry_T e = cache[i];
+                                cache[i] = e->next;
+                                FREE(e->hostname);
+                                FREE(e);
+                        }
+                }
+                statistics.entries = 0;
+        }
+        END_LOCK;
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef MONIT_RESOLVER_H
+#define MONIT_RESOLVER_H
+
+#include "config.h"
+
+#ifdef HAVE_NETINET_IN_H
+#include <netinet/in.h>
+#endif
+
+
+/**
+ * Time in seconds a resolved address is used before it is resolved again
+ */
+#define RESOLVER_TTL          300
+
+/**
+ * Time in seconds a failed resolution is remembered
+ */
+#define RESOLVER_NEGATIVE_TTL 30
+
+/**
+ * Maximum age in seconds of an address which is still used if the
+ * hostname cannot be resolved anymore
+ */
+#define RESOLVER_STALE        3600
+
+
+/** Resolver cache counters */
+typedef struct myresolverstatistics {
+        unsigned long long hits;             /**< Lookups answered from the cache */
+        unsigned long long misses;      /**< Lookups which queried the resolver */
+        unsigned long long stale;   /**< Failed lookups answered with old data */
+        unsigned long long failures;                   /**< Failed lookups */
+        unsigned long long refreshes;   /**< Entries renewed ahead of expiry */
+        int entries;                             /**< Cached hostnames */
+} ResolverStatistics_T;
+
+
+/**
+ * Process-wide cache of IPv4 hostname resolutions used by all outgoing
+ * connections. Successful and failed lookups are cached for a fixed
+ * time and addresses which are about to expire are renewed once per
+ * cycle by Resolver_refresh(), so the checks themselves rarely wait for
+ * the resolver. If the resolver fails, the last known address is used
+ * for up to RESOLVER_STALE seconds.
+ *
+ * @file
+ */
+
+
+/**
+ * Get the IPv4 address of the given host. Numeric addresses are
+ * converted without a lookup.
+ * @param hostname The host name or address
+ * @param sin The address is copied into sin_addr on success
+ * @return 0 on success, otherwise a getaddrinfo() error code
+ */
+int Resolver_getAddress(const char *hostname, struct sockaddr_in *sin);
+
+
+/**
+ * Renew cached addresses which will expire before the next cycle and
+ * drop entries which were not used for RESOLVER_STALE seconds
+ */
+void Resolver_refresh();
+
+
+/**
+ * Get the cache counters
+ * @param statistics The counters are copied into statistics
+ */
+void Resolver_statistics(ResolverStatistics_T *statistics);
+
+
+/**
+ * Free the cache
+ */
+void Resolver_free();
+
+
+#endif
@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#include "monit.h"
+#include "snapshot.h"
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+static pthread_t validator;
+static struct {
+        unsigned int sequence;
+        SystemInfo_T info;
+        int *cpu_percent;
+} published_system;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+/* Make the sequence odd, waits while another writer holds it */
+static unsigned int write_begin(unsigned int *sequence) {
+        unsigned int s = __atomic_load_n(sequence, __ATOMIC_RELAXED);
+        for (;;) {
+                if (s & 1) {
+                        sched_yield();
+                        s = __atomic_load_n(sequence, __ATOMIC_RELAXED);
+                } else if (__atomic_compare_exchange_n(sequence, &s, s + 1, FALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                        break;
+                }
+        }
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        return s + 1;
+}
+
+
+static void write_end(unsigned int *sequence, unsigned int s) {
+        __atomic_store_n(sequence, s + 1, __ATOMIC_RELEASE);
+}
+
+
+/* Wait until no writer holds the sequence and return it */
+static unsigned int read_begin(unsigned int *sequence) {
+        unsigned int s;
+        while ((s = __atomic_load_n(sequence, __ATOMIC_ACQUIRE)) & 1)
+                sched_yield();
+        return s;
+}
+
+
+/* TRUE if the data copied since read_begin() may be inconsistent */
+static int read_retry(unsigned int *sequence, unsigned int s) {
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        return __atomic_load_n(sequence, __ATOMIC_RELAXED) != s;
+}
+
+
+/* Copy the configuration of a service which readers need, the pointers are not changed after the configuration was parsed */
+static void copy_service(Service_T to, Service_T from) {
+        memset(to, 0, sizeof(struct myservice));
+        to->name = from->name;
+        to->type = from->type;
+        to->mode = from->mode;
+        to->every.type = from->every.type;
+        if (from->every.type == EVERY_SKIPCYCLES)
+                to->every.spec.cycle.number = from->every.spec.cycle.number;
+        else if (from->every.type == EVERY_CRON || from->every.type == EVERY_NOTINCRON)
+                to->every.spec.cron = from->every.spec.cron;
+        to->start = from->start;
+        to->stop = from->stop;
+        to->restart = from->restart;
+        to->cgroup = from->cgroup;
+        to->dependantlist = from->dependantlist;
+        to->maillist = from->maillist;
+        to->actionratelist = from->actionratelist;
+        to->checksum = from->checksum;
+        to->filesystemlist = from->filesystemlist;
+        to->gid = from->gid;
+        to->perm = from->perm;
+        to->resourcelist = from->resourcelist;
+        to->sizelist = from->sizelist;
+        to->uptimelist = from->uptimelist;
+        to->matchlist = from->matchlist;
+        to->matchignorelist = from->matchignorelist;
+        to->timestamplist = from->timestamplist;
+        to->uid = from->uid;
+        to->statuslist = from->statuslist;
+        to->trendlist = from->trendlist;
+        to->timinglist = from->timinglist;
+        to->treelist = from->treelist;
+        to->treerefresh = from->treerefresh;
+        to->action_PID = from->action_PID;
+        to->action_PPID = from->action_PPID;
+        to->action_FSFLAG = from->action_FSFLAG;
+        to->action_DATA = from->action_DATA;
+        to->action_EXEC = from->action_EXEC;
+        to->action_INVALID = from->action_INVALID;
+        to->action_NONEXIST = from->action_NONEXIST;
+        to->action_MONIT_START = from->action_MONIT_START;
+        to->action_MONIT_STOP = from->action_MONIT_STOP;
+        to->action_MONIT_RELOAD = from->action_MONIT_RELOAD;
+        to->action_ACTION = from->action_ACTION;
+        to->path = from->path;
+        to->next = from->next;
+        to->next_conf = from->next_conf;
+        to->next_depend = from->next_depend;
+        to->doaction = __atomic_load_n(&from->doaction, __ATOMIC_RELAXED);
+}
+
+
+/* Copy the port configuration, the results are filled in from the published record */
+static Port_T copy_ports(Port_T from) {
+        int n = 0;
+        for (Port_T p = from; p; p = p->next)
+                n++;
+        if (! n)
+                return NULL;
+        Port_T to = CALLOC(n, sizeof(struct myport));
+        for (int i = 0; from; from = from->next, i++) {
+                to[i].socket = -1;
+                to[i].type = from->type;
+                to[i].family = from->family;
+                to[i].hostname = from->hostname;
+                to[i].port = from->port;
+                to[i].request = from->request;
+                to[i].request_checksum = from->request_checksum;
+                to[i].request_hostheader = from->request_hostheader;
+                to[i].request_hashtype = from->request_hashtype;
+                to[i].pathname = from->pathname;
+                to[i].maxforward = from->maxforward;
+                to[i].generic = from->generic;
+                to[i].timeout = from->timeout;
+                to[i].retry = from->retry;
+                to[i].action = from->action;
+                to[i].ApacheStatus = from->ApacheStatus;
+                to[i].SSL = from->SSL;
+                to[i].protocol = from->protocol;
+                to[i].url_request = from->url_request;
+                to[i].next = i + 1 < n ? &to[i + 1] : NULL;
+        }
+        return to;
+}
+
+
+/* Copy the ICMP configuration, the results are filled in from the published record */
+static Icmp_T copy_icmps(Icmp_T from) {
+        int n = 0;
+        for (Icmp_T i = from; i; i = i->next)
+                n++;
+        if (! n)
+                return NULL;
+        Icmp_T to = CALLOC(n, sizeof(struct myicmp));
+        for (int i = 0; from; from = from->next, i++) {
+                to[i].type = from->type;
+                to[i].count = from->count;
+                to[i].timeout = from->timeout;
+                to[i].action = from->action;
+                to[i].next = i + 1 < n ? &to[i + 1] : NULL;
+        }
+        return to;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void Snapshot_init(void) {
+        validator = pthread_self();
+        for (Service_T s = servicelist; s; s = s->next) {
+                /* The result arrays are allocated before the readers are started and are not changed later */
+                int n = 0;
+                for (Port_T p = s->portlist; p; p = p->next)
+                        n++;
+                if (n && ! s->published.port)
+                        s->published.port = CALLOC(n, sizeof(struct myportresult));
+                n = 0;
+                for (Icmp_T i = s->icmplist; i; i = i->next)
+                        n++;
+                if (n && ! s->published.icmp)
+                        s->published.icmp = CALLOC(n, sizeof(struct myicmpresult));
+                Snapshot_publish(s);
+        }
+        Snapshot_publishSystem();
+}
+
+
+void Snapshot_publish(Service_T s) {
+        ASSERT(s);
+        struct mypublished *p = &s->published;
+        unsigned int seq = write_begin(&p->sequence);
+        p->monitor = s->monitor;
+        p->error = s->error;
+        p->error_hint = s->error_hint;
+        if (s->inf)
+                p->inf = *s->inf;
+        p->collected = s->collected;
+        p->duration = s->duration;
+        if (s->program) {
+                p->started = s->program->started;
+                p->exitStatus = s->program->exitStatus;
+        }
+        if (p->port) {
+                int i = 0;
+                for (Port_T q = s->portlist; q; q = q->next, i++) {
+                        p->port[i].is_available = q->is_available;
+                        p->port[i].response = q->response;
+                        memcpy(p->port[i].timing, q->timing, sizeof(q->timing));
+                }
+        }
+        if (p->icmp) {
+                int i = 0;
+                for (Icmp_T q = s->icmplist; q; q = q->next, i++) {
+                        p->icmp[i].is_available = q->is_available;
+                        p->icmp[i].response = q->response;
+                }
+        }
+        write_end(&p->sequence, seq);
+}
+
+
+void Snapshot_publishSystem(void) {
+        if (! published_system.cpu_percent && systeminfo.cpu_percent)
+                published_system.cpu_percent = CALLOC(systeminfo.cpus, sizeof(int));
+        unsigned int seq = write_begin(&published_system.sequence);
+        published_system.info = systeminfo;
+        if (systeminfo.cpu_percent)
+                memcpy(published_system.cpu_percent, systeminfo.cpu_percent, systeminfo.cpus * sizeof(int));
+        write_end(&published_system.sequence, seq);
+}
+
+
+Service_T Snapshot_service(Service_T s, Snapshot_T *snapshot) {
+        ASSERT(s);
+        ASSERT(snapshot);
+        snapshot->portlist = NULL;
+        snapshot->icmplist = NULL;
+        if (pthread_equal(pthread_self(), validator))
+                return s;
+        struct mypublished *p = &s->published;
+        Service_T copy = &snapshot->service;
+        copy_service(copy, s);
+        copy->portlist = snapshot->portlist = copy_ports(s->portlist);
+        copy->icmplist = snapshot->icmplist = copy_icmps(s->icmplist);
+        if (s->program) {
+                memset(&snapshot->program, 0, sizeof(struct myprogram));
+                snapshot->program.timeout = s->program->timeout;
+                copy->program = &snapshot->program;
+        }
+        unsigned int seq;
+        do {
+                seq = read_begin(&p->sequence);
+                copy->monitor = p->monitor;
+                copy->error = p->error;
+                copy->error_hint = p->error_hint;
+                snapshot->inf = p->inf;
+                copy->collected = p->collected;
+                copy->duration = p->duration;
+                snapshot->program.started = p->started;
+                snapshot->program.exitStatus = p->exitStatus;
+                if (p->port) {
+                        int i = 0;
+                        for (Port_T q = copy->portlist; q; q = q->next, i++) {
+                                q->is_available = p->port[i].is_available;
+                                q->response = p->port[i].response;
+                                memcpy(q->timing, p->port[i].timing, sizeof(q->timing));
+                        }
+                }
+                if (p->icmp) {
+                        int i = 0;
+                        for (Icmp_T q = copy->icmplist; q; q = q->next, i++) {
+                                q->is_available = p->icmp[i].is_available;
+                                q->response = p->icmp[i].response;
+                        }
+                }
+        } while (read_retry(&p->sequence, seq));
+        copy->inf = &snapshot->inf;
+        return copy;
+}
+
+
+void Snapshot_free(Snapshot_T *snapshot) {
+        ASSERT(snapshot);
+        FREE(snapshot->portlist);
+        FREE(snapshot->icmplist);
+}
+
+
+void Snapshot_system(SystemInfo_T *si) {
+        ASSERT(si);
+        int *cpu_percent = published_system.cpu_percent ? CALLOC(systeminfo.cpus, sizeof(int)) : NULL;
+        unsigned int seq;
+        do {
+                seq = read_begin(&published_system.sequence);
+                *si = published_system.info;
+                if (cpu_percent)
+                        memcpy(cpu_percent, published_system.cpu_percent, si->cpus * sizeof(int));
+        } while (read_retry(&published_system.sequence, seq));
+        si->cpu_percent = cpu_percent;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.
+ */
+
+
+#ifndef MONIT_SNAPSHOT_H
+#define MONIT_SNAPSHOT_H
+
+#include "monit.h"
+
+
+/**
+ * Check results published for the http and heartbeat threads.
+ *
+ * The validator updates the service data while it checks a service, a
+ * reader which renders the status at the same time could see a half
+ * updated result. After each check the validator copies the result to
+ * the published record of the service (Service_T.published), which is
+ * guarded by a sequence lock: the writer makes the sequence odd, copies
+ * the data and makes it even again, a reader copies the record and
+ * retries if the sequence was odd or changed meanwhile. Readers never
+ * block the validator and the validator only waits for another writer
+ * (an action thread changing the monitoring state). The system data is
+ * published the same way once per cycle.
+ *
+ * The service copy returned to readers holds only the configuration
+ * which is not changed after parsing, the rule lists are shared with the
+ * live service. The runtime data of the copy, including the port and ICMP
+ * results, comes from the published record only.
+ *
+ *  @file
+ */
+
+
+/** Storage of a service copy, see Snapshot_service() */
+typedef struct mysnapshot {
+        struct myservice service;
+        struct myinfo    inf;
+        struct myprogram program;
+        Port_T           portlist;      /**< Port copies with the published results */
+        Icmp_T           icmplist;      /**< ICMP copies with the published results */
+} Snapshot_T;
+
+
+/**
+ * Publish all services and the system data, called by the validator
+ * thread at startup and after reload, before the readers are started.
+ */
+void Snapshot_init(void);
+
+
+/**
+ * Publish the current check result of the service
+ * @param s A Service object
+ */
+void Snapshot_publish(Service_T s);
+
+
+/**
+ * Publish the system data collected in this cycle
+ */
+void Snapshot_publishSystem(void);
+
+
+/**
+ * Get a consistent copy of the service with its last published check
+ * result. The validator thread gets the live service. The copy must be
+ * released with Snapshot_free().
+ * @param s A Service object
+ * @param snapshot Storage of the copy
+ * @return The service copy
+ */
+Service_T Snapshot_service(Service_T s, Snapshot_T *snapshot);
+
+
+/**
+ * Free the port and ICMP copies of a service copy
+ * @param snapshot Storage of the copy, see Snapshot_service()
+ */
+void Snapshot_free(Snapshot_T *snapshot);
+
+
+/**
+ * Get a consistent copy of the last published system data. The per-CPU
+ * usage array of the copy is allocated and must be freed by the caller.
+ * @param si Output of the system data
+ */
+void Snapshot_system(SystemInfo_T *si);
+
+
+#endif
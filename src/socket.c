@@ -52,6 +52,14 @@
 #include <arpa/inet.h>
 #endif
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
 #ifdef HAVE_NETINET_IN_H
 #include <netinet/in.h>
 #endif
@@ -61,10 +69,12 @@
 #include "ssl.h"
 #include "monit.h"
 #include "socket.h"
+#include "util.h"
 
 // libmonit
 #include "exceptions/assert.h"
 #include "util/Str.h"
+#include "system/Time.h"
 
 
 
@@ -80,7 +90,8 @@
 
 #define TYPE_LOCAL   0
 #define TYPE_ACCEPT  1
-#define RBUFFER_SIZE 1024
+#define RBUFFER_SIZE 8192
+#define POOL_MAX     64
 
 struct Socket_T {
         int port;
@@ -94,10 +105,22 @@ struct Socket_T {
         ssl_server_connection *sslserver;
         int length;
         int offset;
+        int reusable;
+        time_t idle;
+        long long firstbyte;
+        struct Socket_T *next;
         unsigned char buffer[RBUFFER_SIZE+1];
 };
 
 
+/* Idle connections kept open for reuse by HTTP tests, see socket_pool_get() */
+static struct Socket_T *pool = NULL;
+static int pool_size = 0;
+static unsigned long long pool_created = 0;
+static unsigned long long pool_reused = 0;
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
 /* --------------------------------------------------------------- Private */
 
 
@@ -140,11 +163,45 @@ static int fill(Socket_T S, int timeout) {
 
         }
 
+        if(S->length > 0 && ! S->firstbyte)
+                S->firstbyte = Util_monotonic();
+
         return S->length;
 
 }
 
 
+/*
+ * Check that the pooled connection is the same kind of connection the
+ * port requires
+ */
+static int pool_match(Socket_T S, Port_T p) {
+        Port_T q = S->Port;
+        return (p->family == AF_INET &&
+                S->type == SOCK_STREAM &&
+                S->port == p->port &&
+                IS(S->host, p->hostname) &&
+                q->SSL.use_ssl == p->SSL.use_ssl &&
+                q->SSL.version == p->SSL.version &&
+                (q->SSL.clientpemfile ? (p->SSL.clientpemfile && IS(q->SSL.clientpemfile, p->SSL.clientpemfile)) : ! p->SSL.clientpemfile) &&
+                (q->SSL.certmd5 ? (p->SSL.certmd5 && IS(q->SSL.certmd5, p->SSL.certmd5)) : ! p->SSL.certmd5));
+}
+
+
+/*
+ * An idle keep-alive connection must not be readable: readable means
+ * the server closed it or sent data nobody asked for
+ */
+static int pool_validate(Socket_T S, time_t now) {
+        struct pollfd fds[1];
+        if (now - S->idle > Run.keepalive)
+                return FALSE;
+        fds[0].fd = S->socket;
+        fds[0].events = POLLIN;
+        return poll(fds, 1, 0) == 0;
+}
+
+
 /* ------------------------------------------------------------------ Public */
 
 
@@ -154,14 +211,14 @@ Socket_T socket_new(const char *host, int port, int type, int use_ssl, int timeo
 }
 
 
-Socket_T socket_create(void *port) {
+Socket_T socket_create(void *port, double *timing) {
 
         int s;
         Port_T p = port;
 
         ASSERT(port);
 
-        if((s = create_generic_socket(p)) != -1) {
+        if((s = create_generic_socket(p, timing)) != -1) {
 
                 Socket_T S = NULL;
 
@@ -180,12 +237,21 @@ Socket_T socket_create(void *port) {
                         S->host = Str_dup(p->hostname);
                 }
 
-                if(p->SSL.use_ssl && !socket_switch2ssl(S, p->SSL)) {
-                        socket_free(&S);
-                        return NULL;
+                if(p->SSL.use_ssl) {
+                        long long start = Util_monotonic();
+                        if(! socket_switch2ssl(S, p->SSL)) {
+                                socket_free(&S);
+                                return NULL;
+                        }
+                        timing[TIMING_TLS] = (Util_monotonic() - start) / 1000000.;
                 }
 
                 S->Port = port;
+                LOCK(pool_mutex)
+                {
+                        pool_created++;
+                }
+                END_LOCK;
                 return S;
         }
 
@@ -229,6 +295,31 @@ Socket_T socket_create_t(const char *host, int port, int type, Ssl_T ssl, int ti
 }
 
 
+Socket_T socket_create_u(const char *path, int timeout) {
+
+        int s;
+
+        ASSERT(path);
+        ASSERT(timeout>0);
+
+        if((s = create_unix_socket(path, timeout)) != -1) {
+
+                Socket_T S = NULL;
+
+                NEW(S);
+                S->socket = s;
+                S->type = SOCK_STREAM;
+                S->timeout = timeout;
+                S->host = Str_dup(LOCALHOST);
+                S->connection_type = TYPE_LOCAL;
+
+                return S;
+        }
+
+        return NULL;
+}
+
+
 Socket_T socket_create_a(int socket, const char *remote_host, int port, void *sslserver) {
 
         Socket_T S;
@@ -285,6 +376,120 @@ void socket_free(Socket_T *S) {
 }
 
 
+Socket_T socket_pool_get(void *port) {
+
+        Socket_T S = NULL, stale = NULL;
+        Port_T p = port;
+        time_t now = Time_now();
+
+        ASSERT(port);
+
+        LOCK(pool_mutex)
+        {
+                for(Socket_T *q = &pool; *q;) {
+                        Socket_T c = *q;
+                        if(! pool_match(c, p)) {
+                                q = &c->next;
+                                continue;
+                        }
+                        *q = c->next;
+                        pool_size--;
+                        if(pool_validate(c, now)) {
+                                S = c;
+                                pool_reused++;
+                                break;
+                        }
+                        c->next = stale;
+                        stale = c;
+                }
+        }
+        END_LOCK;
+        while(stale) {
+                Socket_T c = stale;
+                stale = c->next;
+                socket_free(&c);
+        }
+        if(S) {
+                S->Port = port;
+                S->timeout = p->timeout;
+                S->reusable = FALSE;
+                S->next = NULL;
+                S->length = S->offset = 0;
+                S->firstbyte = 0;
+        }
+        return S;
+
+}
+
+
+void socket_pool_put(Socket_T *S) {
+
+        ASSERT(S && *S);
+
+        if(Run.keepalive && (*S)->reusable && (*S)->connection_type == TYPE_LOCAL) {
+                int pooled = FALSE;
+                LOCK(pool_mutex)
+                {
+                        if(pool_size < POOL_MAX) {
+                                (*S)->idle = Time_now();
+                                (*S)->next = pool;
+                                pool = *S;
+                                pool_size++;
+                                pooled = TRUE;
+                        }
+                }
+                END_LOCK;
+                if(pooled) {
+                        *S = NULL;
+                        return;
+                }
+        }
+        socket_free(S);
+
+}
+
+
+void socket_pool_flush(int all) {
+
+        Socket_T closed = NULL;
+        time_t now = Time_now();
+
+        LOCK(pool_mutex)
+        {
+                for(Socket_T *q = &pool; *q;) {
+                        Socket_T c = *q;
+                        if(all || now - c->idle > Run.keepalive) {
+                                *q = c->next;
+                                pool_size--;
+                                c->next = closed;
+                                closed = c;
+                        } else {
+                                q = &c->next;
+                        }
+                }
+        }
+        END_LOCK;
+        while(closed) {
+                Socket_T c = closed;
+                closed = c->next;
+                socket_free(&c);
+        }
+
+}
+
+
+void socket_pool_statistics(unsigned long long *created, unsigned long long *reused) {
+
+        LOCK(pool_mutex)
+        {
+                *created = pool_created;
+                *reused = pool_reused;
+        }
+        END_LOCK;
+
+}
+
+
 /* ------------------------------------------------------------ Properties */
 
 
@@ -345,6 +550,18 @@ void *socket_get_Port(Socket_T S) {
 }
 
 
+void socket_set_reusable(Socket_T S, int reusable) {
+        ASSERT(S);
+        S->reusable = reusable;
+}
+
+
+long long socket_get_firstbyte(Socket_T S) {
+        ASSERT(S);
+        return S->firstbyte;
+}
+
+
 int socket_get_remote_port(Socket_T S) {
 
         ASSERT(S);
@@ -413,7 +630,7 @@ int socket_switch2ssl(Socket_T S, Ssl_T ssl)  {
         if(! (S->ssl = new_ssl_connection(ssl.clientpemfile, ssl.version)))
                 return FALSE;
 
-        if(! embed_ssl_socket(S->ssl, S->socket))
+        if(! embed_ssl_socket(S->ssl, S->socket, S->host, S->port))
                 return FALSE;
 
         if(ssl.certmd5 && !check_ssl_md5sum(S->ssl, ssl.certmd5)) {
@@ -498,16 +715,24 @@ int socket_read_byte(Socket_T S) {
 
 int socket_read(Socket_T S, void *b, int size) {
 
-        int c;
+        int n = 0;
         unsigned char *p = b;
 
         ASSERT(S);
 
-        while((size-- > 0) && ((c = socket_read_byte(S)) >= 0)) { 
-                *p++ = c;
+        while(n < size) {
+                int available;
+                if(S->offset >= S->length && fill(S, S->timeout) <= 0)
+                        break;
+                available = S->length - S->offset;
+                if(available > size - n)
+                        available = size - n;
+                memcpy(p + n, S->buffer + S->offset, available);
+                S->offset += available;
+                n += available;
         }
 
-        return  (int)((long)p - (long)b);
+        return n;
 
 }
 
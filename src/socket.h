@@ -61,9 +61,11 @@ Socket_T socket_new(const char *host, int port, int type, int use_ssl, int timeo
 /**
  * Factory method for creating a new Socket from a monit Port object
  * @param port The port object to create a socket from
+ * @param timing Output of the resolve, connect and TLS handshake time
+ * [s], indexed by the TIMING_* phases
  * @return The connected Socket or NULL if an error occurred
  */
-Socket_T socket_create(void *port);
+Socket_T socket_create(void *port, double *timing);
 
 
 /**
@@ -80,6 +82,15 @@ Socket_T socket_create(void *port);
 Socket_T socket_create_t(const char *host, int port, int type, Ssl_T ssl, int timeout);
 
 
+/**
+ * Create a new Socket connected to a local UNIX socket
+ * @param path The pathname of the unix socket
+ * @param timeout The timeout value in seconds
+ * @return The connected Socket or NULL if an error occurred
+ */
+Socket_T socket_create_u(const char *path, int timeout);
+
+
 /**
  * Factory method for creating a Socket object from an accepted
  * socket. The given socket must be a socket created from accept(2).
@@ -104,6 +115,42 @@ Socket_T socket_create_a(int socket, const char *remote_host, int port, void *ss
 void socket_free(Socket_T *S);
 
 
+/**
+ * Get an idle connection to the host and port of the given Port object
+ * from the keep-alive pool. Pooled connections which were idle longer
+ * than the keepalive timeout or which were closed by the server are
+ * dropped.
+ * @param port The Port object to connect to
+ * @return A connected Socket object or NULL if no connection is available
+ */
+Socket_T socket_pool_get(void *port);
+
+
+/**
+ * Put the socket back into the keep-alive pool if keepalive is enabled
+ * and the protocol test marked the connection reusable, otherwise the
+ * socket is destroyed. The reference is set to NULL in both cases.
+ * @param S A Socket object reference
+ */
+void socket_pool_put(Socket_T *S);
+
+
+/**
+ * Close pooled connections which exceeded the keepalive timeout
+ * @param all If TRUE, close every pooled connection
+ */
+void socket_pool_flush(int all);
+
+
+/**
+ * Get the number of connections created and the number of connections
+ * reused from the keep-alive pool
+ * @param created The number of new connections
+ * @param reused The number of reused connections
+ */
+void socket_pool_statistics(unsigned long long *created, unsigned long long *reused);
+
+
 /**
  * Returns TRUE if the socket is ready for i|o
  * @param S A Socket object
@@ -145,6 +192,26 @@ int socket_get_type(Socket_T S);
 void *socket_get_Port(Socket_T S);
 
 
+/**
+ * Mark whether the connection may be reused for a later request. The
+ * HTTP test sets it after a complete keep-alive response.
+ * @param S A Socket object
+ * @param reusable TRUE if the connection can be reused
+ */
+void socket_set_reusable(Socket_T S, int reusable);
+
+
+/**
+ * Get the time the first byte was received on the connection. For a
+ * connection from the keep-alive pool, the time of the first byte
+ * received after it was taken from the pool.
+ * @param S A Socket object
+ * @return The monotonic time [us] (see Util_monotonic()) or 0 if no data
+ * was received
+ */
+long long socket_get_firstbyte(Socket_T S);
+
+
 /**
  * Get the remote port number the socket is connected to
  * @param S A Socket object
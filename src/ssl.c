@@ -84,6 +84,10 @@
 #include <string.h>
 #endif
 
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
 
 #include <openssl/crypto.h>
 #include <openssl/x509.h>
@@ -98,12 +102,41 @@
 #include "net.h"
 #include "ssl.h"
 
+// libmonit
+#include "system/Time.h"
+
 
 /* -------------------------------------------------------------- Prototypes */
 
 
 #define SSLERROR ERR_error_string(ERR_get_error(),NULL)
 
+
+/**
+ * Client sessions cached per context for abbreviated handshakes,
+ * keyed by "host:port"
+ */
+typedef struct mysslsession {
+        char               *key;
+        SSL_SESSION        *session;
+        struct mysslsession *next;
+} *SslSession_T;
+
+
+/**
+ * Client contexts are built once per SSL version and client certificate
+ * and shared by all outgoing connections until free_ssl_client_contexts()
+ */
+typedef struct mysslcontext {
+        int                 version;
+        char               *clientpemfile;
+        SSL_METHOD         *method;
+        SSL_CTX            *ctx;
+        SslSession_T        sessions;
+        struct mysslcontext *next;
+} *SslContext_T;
+
+
 static int unsigned long ssl_thread_id();
 static void ssl_mutex_lock(int, int n, const char *, int );
 static int verify_init(ssl_server_connection *);
@@ -115,10 +148,18 @@ static int handle_error(int, ssl_connection *);
 static int update_ssl_cert_data(ssl_connection *);
 static ssl_server_connection *new_ssl_server_connection(char *, char *);
 static int start_ssl();
+static SSL_METHOD *get_client_method(int);
+static SslContext_T new_client_context(int, const char *);
+static SslContext_T get_client_context(int, const char *);
+static int set_session(ssl_connection *, const char *);
+static void put_session(SSL_CTX *, const char *, SSL_SESSION *);
+static int wait_handshake(ssl_connection *, int, long long);
 
 static int              ssl_initialized          = FALSE;
 static pthread_mutex_t  ssl_mutex                = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t *ssl_mutex_table;
+static pthread_mutex_t  ssl_cache_mutex          = PTHREAD_MUTEX_INITIALIZER;
+static SslContext_T     ssl_contexts             = NULL;
 
 
 /* ------------------------------------------------------------- Definitions */
@@ -159,13 +200,19 @@ static pthread_mutex_t *ssl_mutex_table;
 
 
 /**
- * Embeds a socket in a ssl connection.
+ * Embeds a socket in a ssl connection. If a session was cached for the
+ * given host and port by an earlier connection it is offered to the
+ * server for an abbreviated handshake.
  * @param socket the socket to be used.
+ * @param host The server host name or NULL to not use the session cache
+ * @param port The server port
  * @return The ssl connection or NULL if an error occured.
  */
-int embed_ssl_socket(ssl_connection *ssl, int socket) {
+int embed_ssl_socket(ssl_connection *ssl, int socket, const char *host, int port) {
         int ssl_error;
-        time_t ssl_time;
+        long long deadline;
+        int resumed = FALSE;
+        char key[STRLEN];
 
         if (!ssl)
                 return FALSE;
@@ -185,11 +232,6 @@ int embed_ssl_socket(ssl_connection *ssl, int socket) {
                 goto sslerror;
         }
 
-        if (SSL_CTX_set_cipher_list(ssl->ctx, CIPHER_LIST) != 1) {
-                LogError("%s: Error setting cipher list '" CIPHER_LIST "' (no valid ciphers)", prog);
-                goto sslerror;
-        }
-
         set_noblock(ssl->socket);
 
         if ((ssl->socket_bio = BIO_new_socket(ssl->socket, BIO_NOCLOSE)) == NULL) {
@@ -198,21 +240,24 @@ int embed_ssl_socket(ssl_connection *ssl, int socket) {
         }
 
         SSL_set_bio(ssl->handler, ssl->socket_bio, ssl->socket_bio);
-        ssl_time = time(NULL);
 
-        while ((ssl_error = SSL_connect (ssl->handler)) < 0) {
-                if ((time(NULL) - ssl_time) > SSL_TIMEOUT) {
-                        LogError("%s: SSL service timeout!\n", prog);
-                        goto sslerror;
-                }
-
-                if (!handle_error(ssl_error, ssl))
-                        goto sslerror;
+        if (host) {
+                snprintf(key, sizeof(key), "%s:%d", host, port);
+                resumed = set_session(ssl, key);
+        }
 
-                if (!BIO_should_retry(ssl->socket_bio))
+        deadline = Time_milli() + SSL_TIMEOUT * 1000;
+        while ((ssl_error = SSL_connect (ssl->handler)) <= 0) {
+                if (! wait_handshake(ssl, ssl_error, deadline)) {
+                        if (resumed)
+                                put_session(ssl->ctx, key, NULL);
                         goto sslerror;
+                }
         }
 
+        if (host && ! SSL_session_reused(ssl->handler))
+                put_session(ssl->ctx, key, SSL_get1_session(ssl->handler));
+
         ssl->cipher = (char *) SSL_get_cipher(ssl->handler);
 
         if (! update_ssl_cert_data(ssl)) {
@@ -282,9 +327,7 @@ void delete_ssl_socket(ssl_connection *ssl) {
 
         cleanup_ssl_socket(ssl);
 
-        if (ssl->ctx && !ssl->accepted)
-                SSL_CTX_free(ssl->ctx);
-
+        /* The context is owned by the server connection or the client context cache */
         ssl->ctx = NULL;
 
         FREE(ssl);
@@ -569,6 +612,7 @@ void stop_ssl() {
         if (ssl_initialized) {
                 int i;
                 ssl_initialized = FALSE;
+                free_ssl_client_contexts();
                 ERR_free_strings();
                 CRYPTO_set_id_callback(NULL);
                 CRYPTO_set_locking_callback(NULL);
@@ -581,7 +625,36 @@ void stop_ssl() {
 
 
 /**
- * Generate a new ssl connection
+ * Free the cached client contexts and sessions. Called on reload, so a
+ * client certificate renewed at the same path is loaded again and the
+ * sessions of hosts which were removed from the configuration are dropped.
+ */
+void free_ssl_client_contexts() {
+        LOCK(ssl_cache_mutex)
+        {
+                while (ssl_contexts) {
+                        SslContext_T c = ssl_contexts;
+                        ssl_contexts = c->next;
+                        while (c->sessions) {
+                                SslSession_T s = c->sessions;
+                                c->sessions = s->next;
+                                if (s->session)
+                                        SSL_SESSION_free(s->session);
+                                FREE(s->key);
+                                FREE(s);
+                        }
+                        SSL_CTX_free(c->ctx);
+                        FREE(c->clientpemfile);
+                        FREE(c);
+                }
+        }
+        END_LOCK;
+}
+
+
+/**
+ * Generate a new ssl connection. The SSL context is shared with other
+ * connections using the same SSL version and client certificate.
  * @return ssl connection container
  */
 ssl_connection *new_ssl_connection(char *clientpemfile, int sslversion) {
@@ -602,84 +675,15 @@ ssl_connection *new_ssl_connection(char *clientpemfile, int sslversion) {
         ssl->cert_md5_len = 0;
         ssl->clientpemfile = clientpemfile ? Str_dup(clientpemfile) : NULL;
 
-        switch (sslversion) {
-
-                case SSL_VERSION_AUTO:
-#ifdef OPENSSL_FIPS
-                        if (FIPS_mode()) {
-                                ssl->method = TLSv1_client_method();
-                        } else
-#endif
-                                ssl->method = SSLv23_client_method();
-                        break;
-
-                case SSL_VERSION_SSLV2:
-#ifdef OPENSSL_NO_SSL2
-                        LogError("SSLv2 is not allowed - use either SSLv3 or TLSv1");
-                        goto sslerror;
-#else
-#ifdef OPENSSL_FIPS
-                        if (FIPS_mode()) {
-                                LogError("SSLv2 is not allowed in FIPS mode - use TLSv1");
-                                goto sslerror;
-                        } else
-#endif
-                                ssl->method = SSLv2_client_method();
-#endif
-                        break;
-
-                case SSL_VERSION_SSLV3:
-#ifdef OPENSSL_FIPS
-                        if (FIPS_mode()) {
-                                LogError("SSLv3 is not allowed in FIPS mode - use TLSv1");
-                                goto sslerror;
-                        } else
-#endif
-                                ssl->method = SSLv3_client_method();
-                        break;
-
-                case SSL_VERSION_TLS:
-                        /* fall through */
-                default:
-                        ssl->method = TLSv1_client_method();
-                        break;
-
-        }
-
-        if (!ssl->method) {
-                LogError("%s: Cannot initialize SSL method -- %s\n", prog, SSLERROR);
-                goto sslerror;
-        } 
-
-        if (!(ssl->ctx = SSL_CTX_new(ssl->method))) {
-                LogError("%s: Cannot initialize SSL server certificate handler -- %s\n", prog, SSLERROR);
-                goto sslerror;
-        }
-
-        if (ssl->clientpemfile) {
-
-                if (SSL_CTX_use_certificate_chain_file(ssl->ctx, ssl->clientpemfile) <= 0) {
-                        LogError("%s: Cannot initialize SSL server certificate -- %s\n", prog, SSLERROR);
-                        goto sslerror;
-                }
-
-                if (SSL_CTX_use_PrivateKey_file(ssl->ctx, ssl->clientpemfile, SSL_FILETYPE_PEM) <= 0) {
-                        LogError("%s: Cannot initialize SSL server private key -- %s\n", prog, SSLERROR);
-                        goto sslerror;
-                }
-
-                if (!SSL_CTX_check_private_key(ssl->ctx)) {
-                        LogError("%s: Private key does not match the certificate public key -- %s\n", prog, SSLERROR);
-                        goto sslerror;
-                }
-
+        SslContext_T context = get_client_context(sslversion, clientpemfile);
+        if (! context) {
+                delete_ssl_socket(ssl);
+                return NULL;
         }
+        ssl->ctx = context->ctx;
+        ssl->method = context->method;
 
         return ssl;
-
-sslerror:
-        delete_ssl_socket(ssl);
-        return NULL;
 }
 
 
@@ -833,7 +837,7 @@ static int handle_error(int code, ssl_connection *ssl) {
                         break;
 
                 case SSL_ERROR_WANT_WRITE:
-                        if (can_read(ssl->socket, SSL_TIMEOUT))
+                        if (can_write(ssl->socket, SSL_TIMEOUT))
                                 return TRUE;
                         LogError("%s: Openssl write timeout error!\n", prog);
                         break;
@@ -953,6 +957,242 @@ static ssl_server_connection *new_ssl_server_connection(char * pemfile, char * c
         return ssl_server;
 }
 
+/**
+ * Wait for the socket to become ready after a non-blocking handshake
+ * step instead of retrying at once
+ * @param ssl reference to ssl connection
+ * @param code The return value of the handshake step
+ * @param deadline Time in milliseconds when the handshake times out
+ * @return TRUE if the handshake step should be retried, otherwise FALSE
+ */
+static int wait_handshake(ssl_connection *ssl, int code, long long deadline) {
+        int r;
+        struct pollfd fds[1];
+
+        fds[0].fd = ssl->socket;
+        switch (SSL_get_error(ssl->handler, code)) {
+                case SSL_ERROR_WANT_READ:
+                        fds[0].events = POLLIN;
+                        break;
+                case SSL_ERROR_WANT_WRITE:
+                        fds[0].events = POLLOUT;
+                        break;
+                default:
+                        return handle_error(code, ssl);
+        }
+        do {
+                long long timeout = deadline - Time_milli();
+                if (timeout <= 0) {
+                        LogError("%s: SSL service timeout!\n", prog);
+                        return FALSE;
+                }
+                r = poll(fds, 1, (int)timeout);
+        } while (r == -1 && errno == EINTR);
+        if (r <= 0) {
+                LogError("%s: SSL service timeout!\n", prog);
+                return FALSE;
+        }
+        return TRUE;
+}
+
+
+/**
+ * Get the client method for the given SSL version
+ * @return The method or NULL if the version is not available
+ */
+static SSL_METHOD *get_client_method(int sslversion) {
+        SSL_METHOD *method = NULL;
+
+        switch (sslversion) {
+
+                case SSL_VERSION_AUTO:
+#ifdef OPENSSL_FIPS
+                        if (FIPS_mode()) {
+                                method = TLSv1_client_method();
+                        } else
+#endif
+                                method = SSLv23_client_method();
+                        break;
+
+                case SSL_VERSION_SSLV2:
+#ifdef OPENSSL_NO_SSL2
+                        LogError("SSLv2 is not allowed - use either SSLv3 or TLSv1");
+                        return NULL;
+#else
+#ifdef OPENSSL_FIPS
+                        if (FIPS_mode()) {
+                                LogError("SSLv2 is not allowed in FIPS mode - use TLSv1");
+                                return NULL;
+                        } else
+#endif
+                                method = SSLv2_client_method();
+#endif
+                        break;
+
+                case SSL_VERSION_SSLV3:
+#ifdef OPENSSL_FIPS
+                        if (FIPS_mode()) {
+                                LogError("SSLv3 is not allowed in FIPS mode - use TLSv1");
+                                return NULL;
+                        } else
+#endif
+                                method = SSLv3_client_method();
+                        break;
+
+                case SSL_VERSION_TLS:
+                        /* fall through */
+                default:
+                        method = TLSv1_client_method();
+                        break;
+
+        }
+
+        if (!method)
+                LogError("%s: Cannot initialize SSL method -- %s\n", prog, SSLERROR);
+        return method;
+}
+
+
+/**
+ * Create a client context for the given SSL version and load the client
+ * certificate if given
+ * @return The context or NULL if an error occured
+ */
+static SslContext_T new_client_context(int sslversion, const char *clientpemfile) {
+        SslContext_T c;
+        SSL_METHOD *method;
+        SSL_CTX *ctx;
+
+        if (! (method = get_client_method(sslversion)))
+                return NULL;
+        if (! (ctx = SSL_CTX_new(method))) {
+                LogError("%s: Cannot initialize SSL server certificate handler -- %s\n", prog, SSLERROR);
+                return NULL;
+        }
+        if (SSL_CTX_set_cipher_list(ctx, CIPHER_LIST) != 1) {
+                LogError("%s: Error setting cipher list '" CIPHER_LIST "' (no valid ciphers)", prog);
+                goto sslerror;
+        }
+        if (clientpemfile) {
+                if (SSL_CTX_use_certificate_chain_file(ctx, clientpemfile) <= 0) {
+                        LogError("%s: Cannot initialize SSL server certificate -- %s\n", prog, SSLERROR);
+                        goto sslerror;
+                }
+                if (SSL_CTX_use_PrivateKey_file(ctx, clientpemfile, SSL_FILETYPE_PEM) <= 0) {
+                        LogError("%s: Cannot initialize SSL server private key -- %s\n", prog, SSLERROR);
+                        goto sslerror;
+                }
+                if (!SSL_CTX_check_private_key(ctx)) {
+                        LogError("%s: Private key does not match the certificate public key -- %s\n", prog, SSLERROR);
+                        goto sslerror;
+                }
+        }
+        /* Client sessions are cached by host and port, see set_session() */
+        SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+
+        NEW(c);
+        c->version = sslversion;
+        c->clientpemfile = clientpemfile ? Str_dup(clientpemfile) : NULL;
+        c->method = method;
+        c->ctx = ctx;
+        return c;
+
+sslerror:
+        SSL_CTX_free(ctx);
+        return NULL;
+}
+
+
+/**
+ * Get the cached client context for the given SSL version and client
+ * certificate, the context is created on first use
+ * @return The context or NULL if an error occured
+ */
+static SslContext_T get_client_context(int sslversion, const char *clientpemfile) {
+        SslContext_T c;
+
+        LOCK(ssl_cache_mutex)
+        {
+                for (c = ssl_contexts; c; c = c->next)
+                        if (c->version == sslversion && (c->clientpemfile ? (clientpemfile && IS(c->clientpemfile, clientpemfile)) : ! clientpemfile))
+                                break;
+                if (! c && (c = new_client_context(sslversion, clientpemfile))) {
+                        c->next = ssl_contexts;
+                        ssl_contexts = c;
+                }
+        }
+        END_LOCK;
+
+        return c;
+}
+
+
+/**
+ * Offer the session cached for the given key to the server
+ * @param ssl reference to ssl connection
+ * @param key The "host:port" session key
+ * @return TRUE if a cached session was set, otherwise FALSE
+ */
+static int set_session(ssl_connection *ssl, const char *key) {
+        int rv = FALSE;
+
+        LOCK(ssl_cache_mutex)
+        {
+                for (SslContext_T c = ssl_contexts; c; c = c->next) {
+                        if (c->ctx == ssl->ctx) {
+                                for (SslSession_T s = c->sessions; s; s = s->next) {
+                                        if (IS(s->key, key)) {
+                                                rv = SSL_set_session(ssl->handler, s->session) == 1;
+                                                break;
+                                        }
+                                }
+                                break;
+                        }
+                }
+        }
+        END_LOCK;
+
+        return rv;
+}
+
+
+/**
+ * Store the session for the given key, replacing a previous session. The
+ * cache takes over the session reference.
+ * @param ctx The SSL context the session was negotiated with
+ * @param key The "host:port" session key
+ * @param session The session or NULL to drop the cached session
+ */
+static void put_session(SSL_CTX *ctx, const char *key, SSL_SESSION *session) {
+        LOCK(ssl_cache_mutex)
+        {
+                SslContext_T c;
+                for (c = ssl_contexts; c && c->ctx != ctx; c = c->next)
+                        ;
+                if (c) {
+                        SslSession_T s;
+                        for (s = c->sessions; s && ! IS(s->key, key); s = s->next)
+                                ;
+                        if (! s && session) {
+                                NEW(s);
+                                s->key = Str_dup(key);
+                                s->next = c->sessions;
+                                c->sessions = s;
+                        }
+                        if (s) {
+                                if (s->session)
+                                        SSL_SESSION_free(s->session);
+                                s->session = session;
+                                session = NULL;
+                        }
+                }
+                if (session)
+                        SSL_SESSION_free(session);
+        }
+        END_LOCK;
+}
+
+
 #ifdef OPENSSL_FIPS
 /**
  * Enable FIPS mode, if it isn't enabled yet.
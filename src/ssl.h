@@ -88,7 +88,8 @@ typedef struct my_ssl_server_connection {
 
 #define                have_ssl() 1
 void                   stop_ssl();
-int                    embed_ssl_socket(ssl_connection *, int);
+void                   free_ssl_client_contexts();
+int                    embed_ssl_socket(ssl_connection *, int, const char *, int);
 int                    embed_accepted_ssl_socket(ssl_connection *, int);
 int                    close_ssl_socket(ssl_connection *);
 void                   close_accepted_ssl_socket(ssl_server_connection *, ssl_connection *);
@@ -115,7 +116,8 @@ typedef void ssl_server_connection;
 /* dummy ssl functions */
 #define have_ssl()                      0
 #define stop_ssl()
-#define embed_ssl_socket(x, y)          0
+#define free_ssl_client_contexts()
+#define embed_ssl_socket(a, b, c, d)     0
 #define embed_accepted_ssl_socket(x, y) 0
 #define close_ssl_socket(x)             0
 #define close_accepted_ssl_socket(x, y)
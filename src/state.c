@@ -30,6 +30,7 @@
 
 #ifdef HAVE_STDIO_H
 #include <stdio.h>
+#include <stddef.h>
 #endif
 
 #ifdef HAVE_UNISTD_H
@@ -48,10 +49,12 @@
 #include <errno.h>
 #endif
 
+#include <sys/mman.h>
 
 
 #include "monit.h"
 #include "state.h"
+#include "xxhash.h"
 
 // libmonit
 #include "exceptions/IOException.h"
@@ -82,7 +85,24 @@
  *        already to suppress duplicate events.
  *
  * Data is stored in binary form in the statefile using the following format:
- *    <MAGIC><VERSION>{<SERVICE_STATE>}+
+ *    <MAGIC><VERSION>{<SERVICE_STATE><SERVICE_STATE>}+
+ *
+ * The file is written in the latest format version with one fixed size record
+ * per service, in the order of the service list, and mapped to memory. Each
+ * record has two slots holding the service state with a generation number and
+ * a checksum. Each cycle only the records whose persistent properties changed
+ * are updated: the new state is written to the older slot, so the newer slot
+ * stays intact until the write is complete. An unchanged state doesn't cause
+ * any write. State_update() restores the valid slot with the higher generation
+ * and ignores a slot whose checksum doesn't match, i.e. which was torn by a
+ * crash. If the service list changes (reload) or the file cannot be mapped, a
+ * new file is written to <statefile>.tmp, synced and renamed over the old one.
+ *
+ * The msync policy: a change of the monitoring mode is synced to disk at once,
+ * the restart counters and the file read position are left to the kernel's
+ * writeback (MS_ASYNC) and the whole map is synced when the state file is
+ * closed. A crash may thus lose the latest counters and read position, the
+ * previous complete state of the service is restored then.
  *
  * When the persistent field needs to be added, update the State_Version along
  * with State_update() and State_save(). The version allows to recognize the
@@ -101,7 +121,8 @@
 /* Extended format version */
 typedef enum {
         StateVersion0 = 0,
-        StateVersion1
+        StateVersion1,
+        StateVersion2
 } State_Version;
 
 
@@ -132,12 +153,146 @@ typedef struct mystate1 {
 } State1_T;
 
 
+/* Extended format version 2, two slots per service */
+typedef struct mystate2 {
+        struct {
+                State1_T           state;
+                unsigned int       generation;  // the slot with the higher generation is current
+                unsigned int       reserved;
+                unsigned long long checksum;    // of the state and generation
+        } slot[2];
+} State2_T;
+
+
+/* Header size: <MAGIC><VERSION> */
+#define STATE_HEADER (2 * sizeof(int))
+
+
 static int file = -1;
+static void *map = NULL;
+static size_t mapsize = 0;
+static int records = 0;
 
 
 /* ----------------------------------------------------------------- Private */
 
 
+static void fill(State1_T *state, Service_T service) {
+        memset(state, 0, sizeof(State1_T));
+        snprintf(state->name, sizeof(state->name), "%s", service->name);
+        state->type = service->type;
+        state->monitor = service->monitor & ~MONITOR_WAITING;
+        state->nstart = service->nstart;
+        state->ncycle = service->ncycle;
+        if (service->type == TYPE_FILE) {
+                state->priv.file.st_ino = service->inf->priv.file.st_ino;
+                state->priv.file.readpos = service->inf->priv.file.readpos;
+        }
+}
+
+
+static unsigned long long checksum(State2_T *record, int slot) {
+        unsigned long long sum;
+        xxh64_context_t context;
+        xxh64_init(&context);
+        xxh64_append(&context, (unsigned char *)&record->slot[slot], offsetof(State2_T, slot[0].checksum));
+        xxh64_finish(&context, (unsigned char *)&sum);
+        return sum;
+}
+
+
+/* Return the index of the slot with the higher generation */
+static int newer(State2_T *record) {
+        return (int)(record->slot[1].generation - record->slot[0].generation) > 0 ? 1 : 0;
+}
+
+
+/* Return the index of the newer valid slot or -1 if neither slot is valid */
+static int current(State2_T *record) {
+        int valid[2];
+        for (int i = 0; i < 2; i++)
+                valid[i] = record->slot[i].checksum == checksum(record, i);
+        if (valid[0] && valid[1])
+                return newer(record);
+        return valid[0] ? 0 : valid[1] ? 1 : -1;
+}
+
+
+static void restore(State1_T *state) {
+        Service_T service;
+        if ((service = Util_getService(state->name)) && service->type == state->type) {
+                service->nstart = state->nstart;
+                service->ncycle = state->ncycle;
+                if (state->monitor == MONITOR_NOT)
+                        service->monitor = state->monitor;
+                else if (service->monitor == MONITOR_NOT)
+                        service->monitor = MONITOR_INIT;
+                if (service->type == TYPE_FILE) {
+                        service->inf->priv.file.st_ino = state->priv.file.st_ino;
+                        service->inf->priv.file.readpos = state->priv.file.readpos;
+                }
+        }
+}
+
+
+static void unmap() {
+        if (map) {
+                if (msync(map, mapsize, MS_SYNC) == -1)
+                        LogError("State file '%s': sync error -- %s\n", Run.statefile, STRERROR);
+                munmap(map, mapsize);
+                map = NULL;
+                mapsize = 0;
+                records = 0;
+        }
+}
+
+
+/**
+ * Write the state of all services to a new file which atomically replaces
+ * the current state file, then map the new file to memory.
+ * @return TRUE if succeeded, otherwise FALSE
+ */
+static int build(int count) {
+        int fd, rv = FALSE;
+        char path[PATH_MAX];
+        size_t size = STATE_HEADER + count * sizeof(State2_T);
+        char *image = CALLOC(1, size);
+        ((int *)image)[0] = 0; // magic
+        ((int *)image)[1] = StateVersion2;
+        State2_T *record = (State2_T *)(image + STATE_HEADER);
+        for (Service_T service = servicelist; service; service = service->next, record++) {
+                // The second slot stays zeroed and thus invalid until the first change
+                fill(&record->slot[0].state, service);
+                record->slot[0].generation = 1;
+                record->slot[0].checksum = checksum(record, 0);
+        }
+        unmap();
+        snprintf(path, sizeof(path), "%s.tmp", Run.statefile);
+        if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600)) == -1) {
+                LogError("State file '%s': cannot open for write -- %s\n", path, STRERROR);
+        } else if (write(fd, image, size) != (ssize_t)size || fsync(fd) == -1 || rename(path, Run.statefile) == -1) {
+                LogError("State file '%s': cannot write -- %s\n", Run.statefile, STRERROR);
+                close(fd);
+                unlink(path);
+        } else {
+                if (file != -1)
+                        close(file);
+                file = fd;
+                if ((map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0)) == MAP_FAILED) {
+                        // The file is complete, it will be rewritten again on the next save
+                        LogError("State file '%s': cannot map -- %s\n", Run.statefile, STRERROR);
+                        map = NULL;
+                } else {
+                        mapsize = size;
+                        records = count;
+                }
+                rv = TRUE;
+        }
+        FREE(image);
+        return rv;
+}
+
+
 static void update_v0(int services) {
         for (int i = 0; i < services; i++) {
                 State0_T state;
@@ -158,20 +313,19 @@ static void update_v0(int services) {
 
 static void update_v1() {
         State1_T state;
-        while (read(file, &state, sizeof(state)) == sizeof(state)) {
-                Service_T service;
-                if ((service = Util_getService(state.name)) && service->type == state.type) {
-                        service->nstart = state.nstart;
-                        service->ncycle = state.ncycle;
-                        if (state.monitor == MONITOR_NOT)
-                                service->monitor = state.monitor;
-                        else if (service->monitor == MONITOR_NOT)
-                                service->monitor = MONITOR_INIT;
-                        if (service->type == TYPE_FILE) {
-                                service->inf->priv.file.st_ino = state.priv.file.st_ino;
-                                service->inf->priv.file.readpos = state.priv.file.readpos;
-                        }
-                }
+        while (read(file, &state, sizeof(state)) == sizeof(state))
+                restore(&state);
+}
+
+
+static void update_v2() {
+        State2_T record;
+        while (read(file, &record, sizeof(record)) == sizeof(record)) {
+                int slot;
+                if ((slot = current(&record)) < 0)
+                        LogWarning("State file '%s': ignoring a damaged service record\n", Run.statefile);
+                else
+                        restore(&record.slot[slot].state);
         }
 }
 
@@ -191,6 +345,7 @@ int State_open() {
 
 
 void State_close() {
+        unmap();
         if (file != -1) {
                 if (close(file) == -1)
                         LogError("State file '%s': close error -- %s\n", Run.statefile, STRERROR);
@@ -201,40 +356,44 @@ void State_close() {
 
 
 void State_save() {
-        TRY
-        {
-                if (ftruncate(file, 0L) == -1)
-                        THROW(IOException, "Unable to truncate");
-                if (lseek(file, 0L, SEEK_SET) == -1)
-                        THROW(IOException, "Unable to seek");
-                int magic = 0;
-                if (write(file, &magic, sizeof(magic)) != sizeof(magic))
-                        THROW(IOException, "Unable to write magic");
-                // Save always using the latest format version
-                int version = StateVersion1;
-                if (write(file, &version, sizeof(version)) != sizeof(version))
-                        THROW(IOException, "Unable to write format version");
-                for (Service_T service = servicelist; service; service = service->next) {
-                        State1_T state;
-                        memset(&state, 0, sizeof(state));
-                        snprintf(state.name, sizeof(state.name), "%s", service->name);
-                        state.type = service->type;
-                        state.monitor = service->monitor & ~MONITOR_WAITING;
-                        state.nstart = service->nstart;
-                        state.ncycle = service->ncycle;
-                        if (service->type == TYPE_FILE) {
-                                state.priv.file.st_ino = service->inf->priv.file.st_ino;
-                                state.priv.file.readpos = service->inf->priv.file.readpos;
+        int count = 0;
+        for (Service_T service = servicelist; service; service = service->next)
+                count++;
+        if (! map || records != count) {
+                build(count);
+                return;
+        }
+        int mode = FALSE;
+        char *first = NULL, *last = NULL;
+        State2_T *record = (State2_T *)((char *)map + STATE_HEADER);
+        for (Service_T service = servicelist; service; service = service->next, record++) {
+                State1_T state;
+                int slot = newer(record); // the map was written by build() and this function, both slots are complete
+                fill(&state, service);
+                if (memcmp(&record->slot[slot].state, &state, sizeof(State1_T))) {
+                        if (record->slot[slot].state.type != state.type || strncmp(record->slot[slot].state.name, state.name, sizeof(state.name))) {
+                                // The service list doesn't match the records, rewrite the file
+                                build(count);
+                                return;
                         }
-                        if (write(file, &state, sizeof(state)) != sizeof(state))
-                                THROW(IOException, "Unable to write service state");
+                        if (record->slot[slot].state.monitor != state.monitor)
+                                mode = TRUE;
+                        // Write the older slot, the current one is valid until the checksum is written
+                        int next = ! slot;
+                        record->slot[next].state = state;
+                        record->slot[next].generation = record->slot[slot].generation + 1;
+                        record->slot[next].checksum = checksum(record, next);
+                        if (! first)
+                                first = (char *)record;
+                        last = (char *)(record + 1);
                 }
         }
-        ELSE
-        {
-                LogError("State file '%s': %s\n", Run.statefile, Exception_frame.message);
+        if (first) {
+                long pagesize = sysconf(_SC_PAGESIZE);
+                char *start = (char *)map + (((first - (char *)map) / pagesize) * pagesize);
+                if (msync(start, last - start, mode ? MS_SYNC : MS_ASYNC) == -1)
+                        LogError("State file '%s': sync error -- %s\n", Run.statefile, STRERROR);
         }
-        END_TRY;
 }
 
 
@@ -257,9 +416,10 @@ void State_update() {
                         int version;
                         if (read(file, &version, sizeof(version)) != sizeof(version))
                                 THROW(IOException, "Unable to read version");
-                        // Currently the extended format has only one version, additional versions can be added here
                         if (version == StateVersion1)
                                 update_v1();
+                        else if (version == StateVersion2)
+                                update_v2();
                         else
                                 LogWarning("State file '%s': incompatible version %d\n", Run.statefile, version);
                 }
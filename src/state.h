@@ -31,8 +31,10 @@
  * Management of the persistent service properties.
  *
  * If Monit runs in daemon mode, it saves the persistent properties of every
- * service to the state file at the end of every poll cycle. When Monit is
- * restarted or reloaded, it restores the state of the services from this file.
+ * service to the state file at the end of every poll cycle. The file is
+ * mapped to memory and only the records of services whose state changed are
+ * updated. When Monit is restarted or reloaded, it restores the state of the
+ * services from this file.
  *
  * The location of the state file defaults to ~/.monit.state and can be
  * overriden on the command line or using the "set statefile" statement in the
@@ -56,7 +58,9 @@ void State_close();
 
 
 /**
- * Save service state information to the state file
+ * Save service state information to the state file. Only changed records
+ * are written, each to the older of its two slots. If the service list
+ * changed the file is replaced atomically
  */
 void State_save();
 
@@ -79,6 +83,9 @@ void State_save();
  * service A was removed from monitrc; when reading the state file,
  * service A is not found in the current service list (the list is
  * always generated from monitrc) and therefore A is simply discarded.
+ *
+ * Each service is restored from the newer of its two record slots whose
+ * checksum matches, a slot torn by a crash is ignored.
  */
 void State_update();
 
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,219 +27,266 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_SRC_Y_TAB_H_INCLUDED
+# define YY_YY_SRC_Y_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     IF = 258,
-     ELSE = 259,
-     THEN = 260,
-     OR = 261,
-     FAILED = 262,
-     SET = 263,
-     LOGFILE = 264,
-     FACILITY = 265,
-     DAEMON = 266,
-     SYSLOG = 267,
-     MAILSERVER = 268,
-     HTTPD = 269,
-     ALLOW = 270,
-     ADDRESS = 271,
-     INIT = 272,
-     READONLY = 273,
-     CLEARTEXT = 274,
-     MD5HASH = 275,
-     SHA1HASH = 276,
-     CRYPT = 277,
-     DELAY = 278,
-     PEMFILE = 279,
-     ENABLE = 280,
-     DISABLE = 281,
-     HTTPDSSL = 282,
-     CLIENTPEMFILE = 283,
-     ALLOWSELFCERTIFICATION = 284,
-     IDFILE = 285,
-     STATEFILE = 286,
-     SEND = 287,
-     EXPECT = 288,
-     EXPECTBUFFER = 289,
-     CYCLE = 290,
-     COUNT = 291,
-     REMINDER = 292,
-     PIDFILE = 293,
-     START = 294,
-     STOP = 295,
-     PATHTOK = 296,
-     HOST = 297,
-     HOSTNAME = 298,
-     PORT = 299,
-     TYPE = 300,
-     UDP = 301,
-     TCP = 302,
-     TCPSSL = 303,
-     PROTOCOL = 304,
-     CONNECTION = 305,
-     ALERT = 306,
-     NOALERT = 307,
-     MAILFORMAT = 308,
-     UNIXSOCKET = 309,
-     SIGNATURE = 310,
-     TIMEOUT = 311,
-     RETRY = 312,
-     RESTART = 313,
-     CHECKSUM = 314,
-     EVERY = 315,
-     NOTEVERY = 316,
-     DEFAULT = 317,
-     HTTP = 318,
-     APACHESTATUS = 319,
-     FTP = 320,
-     SMTP = 321,
-     POP = 322,
-     IMAP = 323,
-     CLAMAV = 324,
-     NNTP = 325,
-     NTP3 = 326,
-     MYSQL = 327,
-     DNS = 328,
-     SSH = 329,
-     DWP = 330,
-     LDAP2 = 331,
-     LDAP3 = 332,
-     RDATE = 333,
-     RSYNC = 334,
-     TNS = 335,
-     PGSQL = 336,
-     POSTFIXPOLICY = 337,
-     SIP = 338,
-     LMTP = 339,
-     GPS = 340,
-     RADIUS = 341,
-     MEMCACHE = 342,
-     STRING = 343,
-     PATH = 344,
-     MAILADDR = 345,
-     MAILFROM = 346,
-     MAILREPLYTO = 347,
-     MAILSUBJECT = 348,
-     MAILBODY = 349,
-     SERVICENAME = 350,
-     STRINGNAME = 351,
-     NUMBER = 352,
-     PERCENT = 353,
-     LOGLIMIT = 354,
-     CLOSELIMIT = 355,
-     DNSLIMIT = 356,
-     KEEPALIVELIMIT = 357,
-     REPLYLIMIT = 358,
-     REQUESTLIMIT = 359,
-     STARTLIMIT = 360,
-     WAITLIMIT = 361,
-     GRACEFULLIMIT = 362,
-     CLEANUPLIMIT = 363,
-     REAL = 364,
-     CHECKPROC = 365,
-     CHECKFILESYS = 366,
-     CHECKFILE = 367,
-     CHECKDIR = 368,
-     CHECKHOST = 369,
-     CHECKSYSTEM = 370,
-     CHECKFIFO = 371,
-     CHECKPROGRAM = 372,
-     CHILDREN = 373,
-     SYSTEM = 374,
-     STATUS = 375,
-     RESOURCE = 376,
-     MEMORY = 377,
-     TOTALMEMORY = 378,
-     LOADAVG1 = 379,
-     LOADAVG5 = 380,
-     LOADAVG15 = 381,
-     SWAP = 382,
-     MODE = 383,
-     ACTIVE = 384,
-     PASSIVE = 385,
-     MANUAL = 386,
-     CPU = 387,
-     TOTALCPU = 388,
-     CPUUSER = 389,
-     CPUSYSTEM = 390,
-     CPUWAIT = 391,
-     GROUP = 392,
-     REQUEST = 393,
-     DEPENDS = 394,
-     BASEDIR = 395,
-     SLOT = 396,
-     EVENTQUEUE = 397,
-     SECRET = 398,
-     HOSTHEADER = 399,
-     UID = 400,
-     GID = 401,
-     MMONIT = 402,
-     INSTANCE = 403,
-     USERNAME = 404,
-     PASSWORD = 405,
-     TIMESTAMP = 406,
-     CHANGED = 407,
-     SECOND = 408,
-     MINUTE = 409,
-     HOUR = 410,
-     DAY = 411,
-     SSLAUTO = 412,
-     SSLV2 = 413,
-     SSLV3 = 414,
-     TLSV1 = 415,
-     CERTMD5 = 416,
-     BYTE = 417,
-     KILOBYTE = 418,
-     MEGABYTE = 419,
-     GIGABYTE = 420,
-     INODE = 421,
-     SPACE = 422,
-     PERMISSION = 423,
-     SIZE = 424,
-     MATCH = 425,
-     NOT = 426,
-     IGNORE = 427,
-     ACTION = 428,
-     UPTIME = 429,
-     EXEC = 430,
-     UNMONITOR = 431,
-     ICMP = 432,
-     ICMPECHO = 433,
-     NONEXIST = 434,
-     EXIST = 435,
-     INVALID = 436,
-     DATA = 437,
-     RECOVERED = 438,
-     PASSED = 439,
-     SUCCEEDED = 440,
-     URL = 441,
-     CONTENT = 442,
-     PID = 443,
-     PPID = 444,
-     FSFLAG = 445,
-     REGISTER = 446,
-     CREDENTIALS = 447,
-     URLOBJECT = 448,
-     TARGET = 449,
-     TIMESPEC = 450,
-     MAXFORWARD = 451,
-     FIPS = 452,
-     NOTEQUAL = 453,
-     EQUAL = 454,
-     LESS = 455,
-     GREATER = 456
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IF = 258,                      /* IF  */
+    ELSE = 259,                    /* ELSE  */
+    THEN = 260,                    /* THEN  */
+    OR = 261,                      /* OR  */
+    FAILED = 262,                  /* FAILED  */
+    SET = 263,                     /* SET  */
+    LOGFILE = 264,                 /* LOGFILE  */
+    FACILITY = 265,                /* FACILITY  */
+    DAEMON = 266,                  /* DAEMON  */
+    SYSLOG = 267,                  /* SYSLOG  */
+    MAILSERVER = 268,              /* MAILSERVER  */
+    HTTPD = 269,                   /* HTTPD  */
+    ALLOW = 270,                   /* ALLOW  */
+    ADDRESS = 271,                 /* ADDRESS  */
+    INIT = 272,                    /* INIT  */
+    READONLY = 273,                /* READONLY  */
+    CLEARTEXT = 274,               /* CLEARTEXT  */
+    MD5HASH = 275,                 /* MD5HASH  */
+    SHA1HASH = 276,                /* SHA1HASH  */
+    SHA256HASH = 277,              /* SHA256HASH  */
+    XXH64HASH = 278,               /* XXH64HASH  */
+    CRYPT = 279,                   /* CRYPT  */
+    DELAY = 280,                   /* DELAY  */
+    PEMFILE = 281,                 /* PEMFILE  */
+    ENABLE = 282,                  /* ENABLE  */
+    DISABLE = 283,                 /* DISABLE  */
+    HTTPDSSL = 284,                /* HTTPDSSL  */
+    CLIENTPEMFILE = 285,           /* CLIENTPEMFILE  */
+    ALLOWSELFCERTIFICATION = 286,  /* ALLOWSELFCERTIFICATION  */
+    IDFILE = 287,                  /* IDFILE  */
+    STATEFILE = 288,               /* STATEFILE  */
+    SEND = 289,                    /* SEND  */
+    EXPECT = 290,                  /* EXPECT  */
+    EXPECTBUFFER = 291,            /* EXPECTBUFFER  */
+    CYCLE = 292,                   /* CYCLE  */
+    COUNT = 293,                   /* COUNT  */
+    REMINDER = 294,                /* REMINDER  */
+    PIDFILE = 295,                 /* PIDFILE  */
+    START = 296,                   /* START  */
+    STOP = 297,                    /* STOP  */
+    PATHTOK = 298,                 /* PATHTOK  */
+    HOST = 299,                    /* HOST  */
+    HOSTNAME = 300,                /* HOSTNAME  */
+    PORT = 301,                    /* PORT  */
+    TYPE = 302,                    /* TYPE  */
+    UDP = 303,                     /* UDP  */
+    TCP = 304,                     /* TCP  */
+    TCPSSL = 305,                  /* TCPSSL  */
+    PROTOCOL = 306,                /* PROTOCOL  */
+    CONNECTION = 307,              /* CONNECTION  */
+    ALERT = 308,                   /* ALERT  */
+    NOALERT = 309,                 /* NOALERT  */
+    MAILFORMAT = 310,              /* MAILFORMAT  */
+    UNIXSOCKET = 311,              /* UNIXSOCKET  */
+    SIGNATURE = 312,               /* SIGNATURE  */
+    TIMEOUT = 313,                 /* TIMEOUT  */
+    RETRY = 314,                   /* RETRY  */
+    RESTART = 315,                 /* RESTART  */
+    CHECKSUM = 316,                /* CHECKSUM  */
+    EVERY = 317,                   /* EVERY  */
+    NOTEVERY = 318,                /* NOTEVERY  */
+    DEFAULT = 319,                 /* DEFAULT  */
+    HTTP = 320,                    /* HTTP  */
+    APACHESTATUS = 321,            /* APACHESTATUS  */
+    FTP = 322,                     /* FTP  */
+    SMTP = 323,                    /* SMTP  */
+    POP = 324,                     /* POP  */
+    IMAP = 325,                    /* IMAP  */
+    CLAMAV = 326,                  /* CLAMAV  */
+    NNTP = 327,                    /* NNTP  */
+    NTP3 = 328,                    /* NTP3  */
+    MYSQL = 329,                   /* MYSQL  */
+    DNS = 330,                     /* DNS  */
+    SSH = 331,                     /* SSH  */
+    DWP = 332,                     /* DWP  */
+    LDAP2 = 333,                   /* LDAP2  */
+    LDAP3 = 334,                   /* LDAP3  */
+    RDATE = 335,                   /* RDATE  */
+    RSYNC = 336,                   /* RSYNC  */
+    TNS = 337,                     /* TNS  */
+    PGSQL = 338,                   /* PGSQL  */
+    POSTFIXPOLICY = 339,           /* POSTFIXPOLICY  */
+    SIP = 340,                     /* SIP  */
+    LMTP = 341,                    /* LMTP  */
+    GPS = 342,                     /* GPS  */
+    RADIUS = 343,                  /* RADIUS  */
+    MEMCACHE = 344,                /* MEMCACHE  */
+    STRING = 345,                  /* STRING  */
+    PATH = 346,                    /* PATH  */
+    MAILADDR = 347,                /* MAILADDR  */
+    MAILFROM = 348,                /* MAILFROM  */
+    MAILREPLYTO = 349,             /* MAILREPLYTO  */
+    MAILSUBJECT = 350,             /* MAILSUBJECT  */
+    MAILBODY = 351,                /* MAILBODY  */
+    SERVICENAME = 352,             /* SERVICENAME  */
+    STRINGNAME = 353,              /* STRINGNAME  */
+    NUMBER = 354,                  /* NUMBER  */
+    PERCENT = 355,                 /* PERCENT  */
+    LOGLIMIT = 356,                /* LOGLIMIT  */
+    CLOSELIMIT = 357,              /* CLOSELIMIT  */
+    DNSLIMIT = 358,                /* DNSLIMIT  */
+    KEEPALIVELIMIT = 359,          /* KEEPALIVELIMIT  */
+    REPLYLIMIT = 360,              /* REPLYLIMIT  */
+    REQUESTLIMIT = 361,            /* REQUESTLIMIT  */
+    STARTLIMIT = 362,              /* STARTLIMIT  */
+    WAITLIMIT = 363,               /* WAITLIMIT  */
+    GRACEFULLIMIT = 364,           /* GRACEFULLIMIT  */
+    CLEANUPLIMIT = 365,            /* CLEANUPLIMIT  */
+    REAL = 366,                    /* REAL  */
+    CHECKPROC = 367,               /* CHECKPROC  */
+    CHECKFILESYS = 368,            /* CHECKFILESYS  */
+    CHECKFILE = 369,               /* CHECKFILE  */
+    CHECKDIR = 370,                /* CHECKDIR  */
+    CHECKHOST = 371,               /* CHECKHOST  */
+    CHECKSYSTEM = 372,             /* CHECKSYSTEM  */
+    CHECKFIFO = 373,               /* CHECKFIFO  */
+    CHECKPROGRAM = 374,            /* CHECKPROGRAM  */
+    CHILDREN = 375,                /* CHILDREN  */
+    SYSTEM = 376,                  /* SYSTEM  */
+    STATUS = 377,                  /* STATUS  */
+    RESOURCE = 378,                /* RESOURCE  */
+    MEMORY = 379,                  /* MEMORY  */
+    TOTALMEMORY = 380,             /* TOTALMEMORY  */
+    LOADAVG1 = 381,                /* LOADAVG1  */
+    LOADAVG5 = 382,                /* LOADAVG5  */
+    LOADAVG15 = 383,               /* LOADAVG15  */
+    SWAP = 384,                    /* SWAP  */
+    MODE = 385,                    /* MODE  */
+    ACTIVE = 386,                  /* ACTIVE  */
+    PASSIVE = 387,                 /* PASSIVE  */
+    MANUAL = 388,                  /* MANUAL  */
+    CPU = 389,                     /* CPU  */
+    TOTALCPU = 390,                /* TOTALCPU  */
+    CPUUSER = 391,                 /* CPUUSER  */
+    CPUSYSTEM = 392,               /* CPUSYSTEM  */
+    CPUWAIT = 393,                 /* CPUWAIT  */
+    GROUP = 394,                   /* GROUP  */
+    REQUEST = 395,                 /* REQUEST  */
+    DEPENDS = 396,                 /* DEPENDS  */
+    BASEDIR = 397,                 /* BASEDIR  */
+    SLOT = 398,                    /* SLOT  */
+    EVENTQUEUE = 399,              /* EVENTQUEUE  */
+    SECRET = 400,                  /* SECRET  */
+    HOSTHEADER = 401,              /* HOSTHEADER  */
+    UID = 402,                     /* UID  */
+    GID = 403,                     /* GID  */
+    MMONIT = 404,                  /* MMONIT  */
+    INSTANCE = 405,                /* INSTANCE  */
+    USERNAME = 406,                /* USERNAME  */
+    PASSWORD = 407,                /* PASSWORD  */
+    TIMESTAMP = 408,               /* TIMESTAMP  */
+    CHANGED = 409,                 /* CHANGED  */
+    SECOND = 410,                  /* SECOND  */
+    MINUTE = 411,                  /* MINUTE  */
+    HOUR = 412,                    /* HOUR  */
+    DAY = 413,                     /* DAY  */
+    SSLAUTO = 414,                 /* SSLAUTO  */
+    SSLV2 = 415,                   /* SSLV2  */
+    SSLV3 = 416,                   /* SSLV3  */
+    TLSV1 = 417,                   /* TLSV1  */
+    CERTMD5 = 418,                 /* CERTMD5  */
+    BYTE = 419,                    /* BYTE  */
+    KILOBYTE = 420,                /* KILOBYTE  */
+    MEGABYTE = 421,                /* MEGABYTE  */
+    GIGABYTE = 422,                /* GIGABYTE  */
+    INODE = 423,                   /* INODE  */
+    SPACE = 424,                   /* SPACE  */
+    PERMISSION = 425,              /* PERMISSION  */
+    SIZE = 426,                    /* SIZE  */
+    MATCH = 427,                   /* MATCH  */
+    NOT = 428,                     /* NOT  */
+    IGNORE = 429,                  /* IGNORE  */
+    ACTION = 430,                  /* ACTION  */
+    UPTIME = 431,                  /* UPTIME  */
+    EXEC = 432,                    /* EXEC  */
+    UNMONITOR = 433,               /* UNMONITOR  */
+    ICMP = 434,                    /* ICMP  */
+    ICMPECHO = 435,                /* ICMPECHO  */
+    NONEXIST = 436,                /* NONEXIST  */
+    EXIST = 437,                   /* EXIST  */
+    INVALID = 438,                 /* INVALID  */
+    DATA = 439,                    /* DATA  */
+    RECOVERED = 440,               /* RECOVERED  */
+    PASSED = 441,                  /* PASSED  */
+    SUCCEEDED = 442,               /* SUCCEEDED  */
+    URL = 443,                     /* URL  */
+    CONTENT = 444,                 /* CONTENT  */
+    PID = 445,                     /* PID  */
+    PPID = 446,                    /* PPID  */
+    FSFLAG = 447,                  /* FSFLAG  */
+    REGISTER = 448,                /* REGISTER  */
+    CREDENTIALS = 449,             /* CREDENTIALS  */
+    URLOBJECT = 450,               /* URLOBJECT  */
+    TARGET = 451,                  /* TARGET  */
+    TIMESPEC = 452,                /* TIMESPEC  */
+    MAXFORWARD = 453,              /* MAXFORWARD  */
+    FIPS = 454,                    /* FIPS  */
+    CGROUP = 455,                  /* CGROUP  */
+    CPUSTEAL = 456,                /* CPUSTEAL  */
+    CPUIRQ = 457,                  /* CPUIRQ  */
+    PRESSURECPU = 458,             /* PRESSURECPU  */
+    PRESSUREMEMORY = 459,          /* PRESSUREMEMORY  */
+    PRESSUREIO = 460,              /* PRESSUREIO  */
+    AVERAGE = 461,                 /* AVERAGE  */
+    PERCENTILE = 462,              /* PERCENTILE  */
+    SLOPE = 463,                   /* SLOPE  */
+    OVER = 464,                    /* OVER  */
+    MILLISECOND = 465,             /* MILLISECOND  */
+    RESPONSETIME = 466,            /* RESPONSETIME  */
+    RESOLVETIME = 467,             /* RESOLVETIME  */
+    CONNECTTIME = 468,             /* CONNECTTIME  */
+    TLSTIME = 469,                 /* TLSTIME  */
+    FIRSTBYTETIME = 470,           /* FIRSTBYTETIME  */
+    KEEPALIVE = 471,               /* KEEPALIVE  */
+    PIDWATCH = 472,                /* PIDWATCH  */
+    CONCURRENCY = 473,             /* CONCURRENCY  */
+    SESSION = 474,                 /* SESSION  */
+    FILES = 475,                   /* FILES  */
+    OLDEST = 476,                  /* OLDEST  */
+    NEWEST = 477,                  /* NEWEST  */
+    REFRESH = 478,                 /* REFRESH  */
+    GREATER = 479,                 /* GREATER  */
+    LESS = 480,                    /* LESS  */
+    EQUAL = 481,                   /* EQUAL  */
+    NOTEQUAL = 482                 /* NOTEQUAL  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define IF 258
 #define ELSE 259
 #define THEN 260
@@ -258,212 +306,237 @@
 #define CLEARTEXT 274
 #define MD5HASH 275
 #define SHA1HASH 276
-#define CRYPT 277
-#define DELAY 278
-#define PEMFILE 279
-#define ENABLE 280
-#define DISABLE 281
-#define HTTPDSSL 282
-#define CLIENTPEMFILE 283
-#define ALLOWSELFCERTIFICATION 284
-#define IDFILE 285
-#define STATEFILE 286
-#define SEND 287
-#define EXPECT 288
-#define EXPECTBUFFER 289
-#define CYCLE 290
-#define COUNT 291
-#define REMINDER 292
-#define PIDFILE 293
-#define START 294
-#define STOP 295
-#define PATHTOK 296
-#define HOST 297
-#define HOSTNAME 298
-#define PORT 299
-#define TYPE 300
-#define UDP 301
-#define TCP 302
-#define TCPSSL 303
-#define PROTOCOL 304
-#define CONNECTION 305
-#define ALERT 306
-#define NOALERT 307
-#define MAILFORMAT 308
-#define UNIXSOCKET 309
-#define SIGNATURE 310
-#define TIMEOUT 311
-#define RETRY 312
-#define RESTART 313
-#define CHECKSUM 314
-#define EVERY 315
-#define NOTEVERY 316
-#define DEFAULT 317
-#define HTTP 318
-#define APACHESTATUS 319
-#define FTP 320
-#define SMTP 321
-#define POP 322
-#define IMAP 323
-#define CLAMAV 324
-#define NNTP 325
-#define NTP3 326
-#define MYSQL 327
-#define DNS 328
-#define SSH 329
-#define DWP 330
-#define LDAP2 331
-#define LDAP3 332
-#define RDATE 333
-#define RSYNC 334
-#define TNS 335
-#define PGSQL 336
-#define POSTFIXPOLICY 337
-#define SIP 338
-#define LMTP 339
-#define GPS 340
-#define RADIUS 341
-#define MEMCACHE 342
-#define STRING 343
-#define PATH 344
-#define MAILADDR 345
-#define MAILFROM 346
-#define MAILREPLYTO 347
-#define MAILSUBJECT 348
-#define MAILBODY 349
-#define SERVICENAME 350
-#define STRINGNAME 351
-#define NUMBER 352
-#define PERCENT 353
-#define LOGLIMIT 354
-#define CLOSELIMIT 355
-#define DNSLIMIT 356
-#define KEEPALIVELIMIT 357
-#define REPLYLIMIT 358
-#define REQUESTLIMIT 359
-#define STARTLIMIT 360
-#define WAITLIMIT 361
-#define GRACEFULLIMIT 362
-#define CLEANUPLIMIT 363
-#define REAL 364
-#define CHECKPROC 365
-#define CHECKFILESYS 366
-#define CHECKFILE 367
-#define CHECKDIR 368
-#define CHECKHOST 369
-#define CHECKSYSTEM 370
-#define CHECKFIFO 371
-#define CHECKPROGRAM 372
-#define CHILDREN 373
-#define SYSTEM 374
-#define STATUS 375
-#define RESOURCE 376
-#define MEMORY 377
-#define TOTALMEMORY 378
-#define LOADAVG1 379
-#define LOADAVG5 380
-#define LOADAVG15 381
-#define SWAP 382
-#define MODE 383
-#define ACTIVE 384
-#define PASSIVE 385
-#define MANUAL 386
-#define CPU 387
-#define TOTALCPU 388
-#define CPUUSER 389
-#define CPUSYSTEM 390
-#define CPUWAIT 391
-#define GROUP 392
-#define REQUEST 393
-#define DEPENDS 394
-#define BASEDIR 395
-#define SLOT 396
-#define EVENTQUEUE 397
-#define SECRET 398
-#define HOSTHEADER 399
-#define UID 400
-#define GID 401
-#define MMONIT 402
-#define INSTANCE 403
-#define USERNAME 404
-#define PASSWORD 405
-#define TIMESTAMP 406
-#define CHANGED 407
-#define SECOND 408
-#define MINUTE 409
-#define HOUR 410
-#define DAY 411
-#define SSLAUTO 412
-#define SSLV2 413
-#define SSLV3 414
-#define TLSV1 415
-#define CERTMD5 416
-#define BYTE 417
-#define KILOBYTE 418
-#define MEGABYTE 419
-#define GIGABYTE 420
-#define INODE 421
-#define SPACE 422
-#define PERMISSION 423
-#define SIZE 424
-#define MATCH 425
-#define NOT 426
-#define IGNORE 427
-#define ACTION 428
-#define UPTIME 429
-#define EXEC 430
-#define UNMONITOR 431
-#define ICMP 432
-#define ICMPECHO 433
-#define NONEXIST 434
-#define EXIST 435
-#define INVALID 436
-#define DATA 437
-#define RECOVERED 438
-#define PASSED 439
-#define SUCCEEDED 440
-#define URL 441
-#define CONTENT 442
-#define PID 443
-#define PPID 444
-#define FSFLAG 445
-#define REGISTER 446
-#define CREDENTIALS 447
-#define URLOBJECT 448
-#define TARGET 449
-#define TIMESPEC 450
-#define MAXFORWARD 451
-#define FIPS 452
-#define NOTEQUAL 453
-#define EQUAL 454
-#define LESS 455
-#define GREATER 456
-
-
-
+#define SHA256HASH 277
+#define XXH64HASH 278
+#define CRYPT 279
+#define DELAY 280
+#define PEMFILE 281
+#define ENABLE 282
+#define DISABLE 283
+#define HTTPDSSL 284
+#define CLIENTPEMFILE 285
+#define ALLOWSELFCERTIFICATION 286
+#define IDFILE 287
+#define STATEFILE 288
+#define SEND 289
+#define EXPECT 290
+#define EXPECTBUFFER 291
+#define CYCLE 292
+#define COUNT 293
+#define REMINDER 294
+#define PIDFILE 295
+#define START 296
+#define STOP 297
+#define PATHTOK 298
+#define HOST 299
+#define HOSTNAME 300
+#define PORT 301
+#define TYPE 302
+#define UDP 303
+#define TCP 304
+#define TCPSSL 305
+#define PROTOCOL 306
+#define CONNECTION 307
+#define ALERT 308
+#define NOALERT 309
+#define MAILFORMAT 310
+#define UNIXSOCKET 311
+#define SIGNATURE 312
+#define TIMEOUT 313
+#define RETRY 314
+#define RESTART 315
+#define CHECKSUM 316
+#define EVERY 317
+#define NOTEVERY 318
+#define DEFAULT 319
+#define HTTP 320
+#define APACHESTATUS 321
+#define FTP 322
+#define SMTP 323
+#define POP 324
+#define IMAP 325
+#define CLAMAV 326
+#define NNTP 327
+#define NTP3 328
+#define MYSQL 329
+#define DNS 330
+#define SSH 331
+#define DWP 332
+#define LDAP2 333
+#define LDAP3 334
+#define RDATE 335
+#define RSYNC 336
+#define TNS 337
+#define PGSQL 338
+#define POSTFIXPOLICY 339
+#define SIP 340
+#define LMTP 341
+#define GPS 342
+#define RADIUS 343
+#define MEMCACHE 344
+#define STRING 345
+#define PATH 346
+#define MAILADDR 347
+#define MAILFROM 348
+#define MAILREPLYTO 349
+#define MAILSUBJECT 350
+#define MAILBODY 351
+#define SERVICENAME 352
+#define STRINGNAME 353
+#define NUMBER 354
+#define PERCENT 355
+#define LOGLIMIT 356
+#define CLOSELIMIT 357
+#define DNSLIMIT 358
+#define KEEPALIVELIMIT 359
+#define REPLYLIMIT 360
+#define REQUESTLIMIT 361
+#define STARTLIMIT 362
+#define WAITLIMIT 363
+#define GRACEFULLIMIT 364
+#define CLEANUPLIMIT 365
+#define REAL 366
+#define CHECKPROC 367
+#define CHECKFILESYS 368
+#define CHECKFILE 369
+#define CHECKDIR 370
+#define CHECKHOST 371
+#define CHECKSYSTEM 372
+#define CHECKFIFO 373
+#define CHECKPROGRAM 374
+#define CHILDREN 375
+#define SYSTEM 376
+#define STATUS 377
+#define RESOURCE 378
+#define MEMORY 379
+#define TOTALMEMORY 380
+#define LOADAVG1 381
+#define LOADAVG5 382
+#define LOADAVG15 383
+#define SWAP 384
+#define MODE 385
+#define ACTIVE 386
+#define PASSIVE 387
+#define MANUAL 388
+#define CPU 389
+#define TOTALCPU 390
+#define CPUUSER 391
+#define CPUSYSTEM 392
+#define CPUWAIT 393
+#define GROUP 394
+#define REQUEST 395
+#define DEPENDS 396
+#define BASEDIR 397
+#define SLOT 398
+#define EVENTQUEUE 399
+#define SECRET 400
+#define HOSTHEADER 401
+#define UID 402
+#define GID 403
+#define MMONIT 404
+#define INSTANCE 405
+#define USERNAME 406
+#define PASSWORD 407
+#define TIMESTAMP 408
+#define CHANGED 409
+#define SECOND 410
+#define MINUTE 411
+#define HOUR 412
+#define DAY 413
+#define SSLAUTO 414
+#define SSLV2 415
+#define SSLV3 416
+#define TLSV1 417
+#define CERTMD5 418
+#define BYTE 419
+#define KILOBYTE 420
+#define MEGABYTE 421
+#define GIGABYTE 422
+#define INODE 423
+#define SPACE 424
+#define PERMISSION 425
+#define SIZE 426
+#define MATCH 427
+#define NOT 428
+#define IGNORE 429
+#define ACTION 430
+#define UPTIME 431
+#define EXEC 432
+#define UNMONITOR 433
+#define ICMP 434
+#define ICMPECHO 435
+#define NONEXIST 436
+#define EXIST 437
+#define INVALID 438
+#define DATA 439
+#define RECOVERED 440
+#define PASSED 441
+#define SUCCEEDED 442
+#define URL 443
+#define CONTENT 444
+#define PID 445
+#define PPID 446
+#define FSFLAG 447
+#define REGISTER 448
+#define CREDENTIALS 449
+#define URLOBJECT 450
+#define TARGET 451
+#define TIMESPEC 452
+#define MAXFORWARD 453
+#define FIPS 454
+#define CGROUP 455
+#define CPUSTEAL 456
+#define CPUIRQ 457
+#define PRESSURECPU 458
+#define PRESSUREMEMORY 459
+#define PRESSUREIO 460
+#define AVERAGE 461
+#define PERCENTILE 462
+#define SLOPE 463
+#define OVER 464
+#define MILLISECOND 465
+#define RESPONSETIME 466
+#define RESOLVETIME 467
+#define CONNECTTIME 468
+#define TLSTIME 469
+#define FIRSTBYTETIME 470
+#define KEEPALIVE 471
+#define PIDWATCH 472
+#define CONCURRENCY 473
+#define SESSION 474
+#define FILES 475
+#define OLDEST 476
+#define NEWEST 477
+#define REFRESH 478
+#define GREATER 479
+#define LESS 480
+#define EQUAL 481
+#define NOTEQUAL 482
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+union YYSTYPE
 {
-
-/* Line 2068 of yacc.c  */
-#line 259 "src/p.y"
+#line 285 "src/p.y"
 
   URL_T url;
   float real;
   int   number;
   char *string;
 
+#line 528 "src/y.tab.h"
 
-
-/* Line 2068 of yacc.c  */
-#line 461 "src/y.tab.h"
-} YYSTYPE;
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
 
+int yyparse (void);
+
+
+#endif /* !YY_YY_SRC_Y_TAB_H_INCLUDED  */
@@ -124,10 +124,12 @@
 #include "md5.h"
 #include "md5_crypt.h"
 #include "sha1.h"
+#include "digest.h"
 #include "base64.h"
 #include "alert.h"
 #include "process.h"
 #include "event.h"
+#include "snapshot.h"
 
 
 struct ad_user {
@@ -404,6 +406,22 @@ static Auth_T PAMcheckUserGroup(const char *uname) {
 #endif
 
 
+/**
+ * Feed the bytes read from the stream to the digests. The stream is read
+ * in large blocks to keep the number of read calls and digest updates low.
+ */
+static int stream_digest(FILE *stream, Digest_T *digests, int count) {
+#define HASHBLOCKSIZE 32768
+        unsigned char buffer[HASHBLOCKSIZE];
+        size_t n;
+
+        while ((n = fread(buffer, 1, HASHBLOCKSIZE, stream)) > 0)
+                for (int i = 0; i < count; i++)
+                        Digest_append(&digests[i], buffer, n);
+        return ferror(stream) ? FALSE : TRUE;
+}
+
+
 /* ------------------------------------------------------------------ Public */
 
 
@@ -572,63 +590,20 @@ char *Util_digest2Bytes(unsigned char *digest, int mdlen, MD_T result) {
 
 
 int Util_getStreamDigests(FILE *stream, void *sha1_resblock, void *md5_resblock) {
-#define HASHBLOCKSIZE 4096
-        md5_context_t ctx_md5;
-        sha1_context_t ctx_sha1;
-        unsigned char buffer[HASHBLOCKSIZE + 72];
-        size_t sum;
+        Digest_T digests[2];
+        int count = 0;
 
-        /* Initialize the computation contexts */
-        if (md5_resblock)
-                md5_init(&ctx_md5);
         if (sha1_resblock)
-                sha1_init(&ctx_sha1);
-
-        /* Iterate over full file contents */
-        while (1)  {
-                /* We read the file in blocks of HASHBLOCKSIZE bytes. One call of the computation function processes the whole buffer so that with the next round of the loop another block can be read */
-                size_t n;
-                sum = 0;
-
-                /* Read block. Take care for partial reads */
-                while (1) {
-                        n = fread(buffer + sum, 1, HASHBLOCKSIZE - sum, stream);
-                        sum += n;
-                        if (sum == HASHBLOCKSIZE)
-                                break;
-                        if (n == 0) {
-                                /* Check for the error flag IFF N == 0, so that we don't exit the loop after a partial read due to e.g., EAGAIN or EWOULDBLOCK */
-                                if (ferror(stream))
-                                        return FALSE;
-                                goto process_partial_block;
-                        }
-
-                        /* We've read at least one byte, so ignore errors. But always check for EOF, since feof may be true even though N > 0. Otherwise, we could end up calling fread after EOF */
-                        if (feof(stream))
-                                goto process_partial_block;
-                }
-
-                /* Process buffer with HASHBLOCKSIZE bytes. Note that HASHBLOCKSIZE % 64 == 0 */
-                if (md5_resblock)
-                        md5_append(&ctx_md5, (const md5_byte_t *)buffer, HASHBLOCKSIZE);
-                if (sha1_resblock)
-                        sha1_append(&ctx_sha1, buffer, HASHBLOCKSIZE);
-        }
-
-process_partial_block:
-        /* Process any remaining bytes */
-        if (sum > 0) {
-                if (md5_resblock)
-                        md5_append(&ctx_md5, (const md5_byte_t *)buffer, (int)sum);
-                if (sha1_resblock)
-                        sha1_append(&ctx_sha1, buffer, sum);
-        }
-        /* Construct result in desired memory */
+                Digest_init(&digests[count++], HASH_SHA1);
         if (md5_resblock)
-                md5_finish(&ctx_md5, md5_resblock);
+                Digest_init(&digests[count++], HASH_MD5);
+        int rv = stream_digest(stream, digests, count);
+        count = 0;
         if (sha1_resblock)
-                sha1_finish(&ctx_sha1, sha1_resblock);
-        return TRUE;
+                Digest_finish(&digests[count++], sha1_resblock);
+        if (md5_resblock)
+                Digest_finish(&digests[count++], md5_resblock);
+        return rv;
 }
 
 
@@ -647,38 +622,25 @@ void Util_printHash(char *file) {
 
 
 int Util_getChecksum(char *file, int hashtype, char *buf, int bufsize) {
-        int hashlength = 16;
-
         ASSERT(file);
         ASSERT(buf);
         ASSERT(bufsize >= sizeof(MD_T));
 
-        switch (hashtype) {
-                case HASH_MD5:
-                        hashlength = 16;
-                        break;
-                case HASH_SHA1:
-                        hashlength = 20;
-                        break;
-                default:
-                        LogError("checksum: invalid hash type: 0x%x\n", hashtype);
-                        return FALSE;
+        int hashlength = Digest_length(hashtype);
+        if (! hashlength) {
+                LogError("checksum: invalid hash type: 0x%x\n", hashtype);
+                return FALSE;
         }
 
         if (file_isFile(file)) {
                 FILE *f = fopen(file, "r");
                 if (f) {
-                        int fresult = FALSE;
-                        MD_T sum;
+                        Digest_T digest;
+                        unsigned char sum[MD_SIZE];
 
-                        switch (hashtype) {
-                                case HASH_MD5:
-                                        fresult = Util_getStreamDigests(f, NULL, sum);
-                                        break;
-                                case HASH_SHA1:
-                                        fresult = Util_getStreamDigests(f, sum, NULL);
-                                        break;
-                        }
+                        Digest_init(&digest, hashtype);
+                        int fresult = stream_digest(f, &digest, 1);
+                        Digest_finish(&digest, sum);
 
                         if (fclose(f))
                                 LogError("checksum: error closing file '%s' -- %s\n", file, STRERROR);
@@ -688,7 +650,7 @@ int Util_getChecksum(char *file, int hashtype, char *buf, int bufsize) {
                                 return FALSE;
                         }
 
-                        Util_digest2Bytes((unsigned char *)sum, hashlength, buf);
+                        Util_digest2Bytes(sum, hashlength, buf);
                         return TRUE;
 
                 } else
@@ -780,6 +742,12 @@ void Util_printRunList() {
         printf(" %-18s = %s\n", "Use process engine", Run.doprocess?"True":"False");
         printf(" %-18s = %d seconds with start delay %d seconds\n", "Poll time", Run.polltime, Run.startdelay);
         printf(" %-18s = %d bytes\n", "Expect buffer", Run.expectbuffer);
+        if (Run.keepalive)
+                printf(" %-18s = idle timeout %d seconds\n", "HTTP keepalive", Run.keepalive);
+        if (Run.pidwatch)
+                printf(" %-18s = %s\n", "Process watcher", "True");
+        if (Run.concurrency > 1)
+                printf(" %-18s = %d services\n", "Action concurrency", Run.concurrency);
 
         if (Run.eventlist_dir) {
                 char slots[STRLEN];
@@ -842,6 +810,10 @@ void Util_printRunList() {
                 printf(" %-18s = %s\n", "httpd bind address",
                        Run.bind_addr?Run.bind_addr:"Any/All");
                 printf(" %-18s = %d\n", "httpd portnumber", Run.httpdport);
+                if (Run.httpdsocket)
+                        printf(" %-18s = %s\n", "httpd unix socket", Run.httpdsocket);
+                if (Run.httpdsession)
+                        printf(" %-18s = %d seconds\n", "httpd session", Run.httpdsession);
                 printf(" %-18s = %s\n", "httpd signature", Run.httpdsig?"True":"False");
                 printf(" %-18s = %s\n", "Use ssl encryption", Run.httpdssl?"True":"False");
 
@@ -925,6 +897,8 @@ void Util_printService(Service_T s) {
                         printf(" %-20s = %s\n", "Match", s->path);
                 else
                         printf(" %-20s = %s\n", "Pid file", s->path);
+                if (s->cgroup)
+                        printf(" %-20s = %s\n", "Cgroup", s->cgroup);
         } else if (s->type != TYPE_HOST && s->type != TYPE_SYSTEM) {
                 printf(" %-20s = %s\n", "Path", s->path);
         }
@@ -1203,6 +1177,26 @@ void Util_printService(Service_T s) {
                                 printf(" %-20s = ", "CPU wait limit");
                                 break;
 
+                        case RESOURCE_ID_CPUSTEAL:
+                                printf(" %-20s = ", "CPU steal limit");
+                                break;
+
+                        case RESOURCE_ID_CPUIRQ:
+                                printf(" %-20s = ", "CPU irq limit");
+                                break;
+
+                        case RESOURCE_ID_PRESSURE_CPU:
+                                printf(" %-20s = ", "CPU pressure limit");
+                                break;
+
+                        case RESOURCE_ID_PRESSURE_MEMORY:
+                                printf(" %-20s = ", "Memory pressure limit");
+                                break;
+
+                        case RESOURCE_ID_PRESSURE_IO:
+                                printf(" %-20s = ", "I/O pressure limit");
+                                break;
+
                         case RESOURCE_ID_MEM_PERCENT: 
                                 printf(" %-20s = ", "Memory usage limit");
                                 break;
@@ -1250,6 +1244,11 @@ void Util_printService(Service_T s) {
                         case RESOURCE_ID_CPUUSER: 
                         case RESOURCE_ID_CPUSYSTEM: 
                         case RESOURCE_ID_CPUWAIT: 
+                        case RESOURCE_ID_CPUSTEAL:
+                        case RESOURCE_ID_CPUIRQ:
+                        case RESOURCE_ID_PRESSURE_CPU:
+                        case RESOURCE_ID_PRESSURE_MEMORY:
+                        case RESOURCE_ID_PRESSURE_IO:
                         case RESOURCE_ID_MEM_PERCENT: 
                         case RESOURCE_ID_SWAP_PERCENT: 
                                 printf("if %s %.1f%% %s ", operatornames[q->operator], q->limit / 10.0, Util_getEventratio(a->failed, buf, sizeof(buf)));
@@ -1286,6 +1285,42 @@ void Util_printService(Service_T s) {
                 printf("\n");
         }
 
+        for (Trend_T tr = s->trendlist; tr; tr = tr->next) {
+                EventAction_T a = tr->action;
+                char limit[STRLEN];
+                printf(" %-20s = ", "Trend");
+                printf("if %s ", Util_trendDescription(tr, buf, sizeof(buf)));
+                printf("%s %s %s ", operatornames[tr->operator], Util_trendValue(tr, tr->limit, limit, sizeof(limit)), Util_getEventratio(a->failed, buf, sizeof(buf)));
+                printf("then %s ", Util_describeAction(a->failed, buf, sizeof(buf)));
+                printf("else if succeeded %s ", Util_getEventratio(a->succeeded, buf, sizeof(buf)));
+                printf("then %s\n", Util_describeAction(a->succeeded, buf, sizeof(buf)));
+        }
+
+        for (Timing_T t = s->timinglist; t; t = t->next) {
+                EventAction_T a = t->action;
+                char limit[STRLEN];
+                printf(" %-20s = ", "Timing");
+                printf("if %s time ", timingnames[t->phase]);
+                printf("%s %s %s ", operatornames[t->operator], Util_timingValue(t->limit, limit, sizeof(limit)), Util_getEventratio(a->failed, buf, sizeof(buf)));
+                printf("then %s ", Util_describeAction(a->failed, buf, sizeof(buf)));
+                printf("else if succeeded %s ", Util_getEventratio(a->succeeded, buf, sizeof(buf)));
+                printf("then %s\n", Util_describeAction(a->succeeded, buf, sizeof(buf)));
+        }
+
+        for (Tree_T t = s->treelist; t; t = t->next) {
+                EventAction_T a = t->action;
+                char limit[STRLEN];
+                printf(" %-20s = ", "Tree");
+                printf("if %s ", Util_treeDescription(t, buf, sizeof(buf)));
+                printf("%s %s %s ", operatornames[t->operator], Util_treeValue(t, t->limit, limit, sizeof(limit)), Util_getEventratio(a->failed, buf, sizeof(buf)));
+                printf("then %s ", Util_describeAction(a->failed, buf, sizeof(buf)));
+                printf("else if succeeded %s ", Util_getEventratio(a->succeeded, buf, sizeof(buf)));
+                printf("then %s\n", Util_describeAction(a->succeeded, buf, sizeof(buf)));
+        }
+
+        if (s->treerefresh)
+                printf(" %-20s = Read all directories every %d cycles\n", "Tree refresh", s->treerefresh);
+
         if (s->every.type == EVERY_SKIPCYCLES)
                 printf(" %-20s = Check service every %d cycles\n", "Every", s->every.spec.cycle.number);
         else if (s->every.type == EVERY_CRON)
@@ -1744,6 +1779,12 @@ void Util_resetInfo(Service_T s) {
                         s->inf->priv.process.cpu_percent = 0;
                         s->inf->priv.process.total_cpu_percent = 0;
                         s->inf->priv.process.uptime = 0;
+                        s->inf->priv.process.cgroup_pids = 0;
+                        s->inf->priv.process.cgroup_cpu_usec = 0ULL;
+                        s->inf->priv.process.cgroup_io_rbytes = 0ULL;
+                        s->inf->priv.process.cgroup_io_wbytes = 0ULL;
+                        s->inf->priv.process.cgroup_time = 0.;
+                        s->inf->priv.process.cgroup_error = FALSE;
                         break;
                 default:
                         break;
@@ -1799,6 +1840,7 @@ void Util_monitorSet(Service_T s) {
         if (s->monitor == MONITOR_NOT) {
                 s->monitor = MONITOR_INIT;
                 DEBUG("'%s' monitoring enabled\n", s->name);
+                Snapshot_publish(s);
         }
 }
 
@@ -1817,6 +1859,7 @@ void Util_monitorUnset(Service_T s) {
         if (s->eventlist)
                 gc_event(&s->eventlist);
         Util_resetInfo(s);
+        Snapshot_publish(s);
 }
 
 
@@ -1866,6 +1909,135 @@ char *Util_getEventratio(Action_T action, char *buf, int bufsize) {
 }
 
 
+char *Util_trendDescription(Trend_T t, char *buf, int bufsize) {
+        switch (t->function) {
+                case TREND_AVERAGE:
+                        snprintf(buf, bufsize, "average of %s over %d cycle(s)", historymetricnames[t->metric], t->cycles);
+                        break;
+                case TREND_PERCENTILE:
+                        snprintf(buf, bufsize, "percentile %d of %s over %d cycle(s)", t->percentile, historymetricnames[t->metric], t->cycles);
+                        break;
+                case TREND_SLOPE:
+                        snprintf(buf, bufsize, "slope of %s over %d cycle(s)", historymetricnames[t->metric], t->cycles);
+                        break;
+                default:
+                        *buf = 0;
+                        break;
+        }
+        return buf;
+}
+
+
+char *Util_trendValue(Trend_T t, long long value, char *buf, int bufsize) {
+        if (t->function == TREND_SLOPE) {
+                snprintf(buf, bufsize, "%.1f%%", value / 10.);
+                return buf;
+        }
+        switch (t->metric) {
+                case HISTORY_CPU:
+                case HISTORY_TOTALCPU:
+                        snprintf(buf, bufsize, "%.1f%%", value / 10.);
+                        break;
+                case HISTORY_MEMORY:
+                case HISTORY_TOTALMEMORY:
+                case HISTORY_SWAP:
+                        snprintf(buf, bufsize, "%lldkB", value);
+                        break;
+                case HISTORY_LOADAVG:
+                        snprintf(buf, bufsize, "%.1f", value / 10.);
+                        break;
+                case HISTORY_RESPONSE:
+                        snprintf(buf, bufsize, "%.3fms", value / 1000.);
+                        break;
+                default:
+                        snprintf(buf, bufsize, "%lld", value);
+                        break;
+        }
+        return buf;
+}
+
+
+long long Util_treeMetric(Tree_T t, const TreeStat_T *ts, time_t now) {
+        switch (t->metric) {
+                case TREE_FILES:
+                        return ts->files;
+                case TREE_SIZE:
+                        return ts->size;
+                case TREE_OLDEST:
+                        return ts->files && now > ts->oldest ? now - ts->oldest : 0;
+                case TREE_NEWEST:
+                        return ts->files && now > ts->newest ? now - ts->newest : 0;
+                default:
+                        return 0;
+        }
+}
+
+
+char *Util_treeDescription(Tree_T t, char *buf, int bufsize) {
+        static const char *descriptions[] = {"number of files", "size of files", "age of the oldest file", "age of the newest file"};
+        if (t->pattern)
+                snprintf(buf, bufsize, "%s matching \"%s\"", descriptions[t->metric], t->pattern);
+        else
+                snprintf(buf, bufsize, "%s", descriptions[t->metric]);
+        return buf;
+}
+
+
+char *Util_treeValue(Tree_T t, long long value, char *buf, int bufsize) {
+        switch (t->metric) {
+                case TREE_SIZE:
+                        snprintf(buf, bufsize, "%lld B", value);
+                        break;
+                case TREE_OLDEST:
+                case TREE_NEWEST:
+                        snprintf(buf, bufsize, "%lld s", value);
+                        break;
+                default:
+                        snprintf(buf, bufsize, "%lld", value);
+                        break;
+        }
+        return buf;
+}
+
+
+long long Util_timingMetric(Service_T s, int phase, Port_T *port) {
+        long long value = -1;
+        ASSERT(s);
+        ASSERT(phase >= 0 && phase < TIMING_PHASES);
+        if (port)
+                *port = NULL;
+        for (Port_T p = s->portlist; p; p = p->next) {
+                if (p->is_available && p->timing[phase] >= 0) {
+                        long long v = (long long)(p->timing[phase] * 1000000.);
+                        if (v > value) {
+                                value = v;
+                                if (port)
+                                        *port = p;
+                        }
+                }
+        }
+        return value;
+}
+
+
+char *Util_timingValue(long long value, char *buf, int bufsize) {
+        snprintf(buf, bufsize, "%.3fms", value / 1000.);
+        return buf;
+}
+
+
+char *Util_portTiming(Port_T p, char *buf, int bufsize) {
+        int n = 0;
+        ASSERT(p);
+        ASSERT(buf);
+        *buf = 0;
+        for (int i = TIMING_RESOLVE; i < TIMING_PHASES && n < bufsize; i++)
+                if (p->timing[i] >= 0)
+                        n += snprintf(buf + n, bufsize - n, "%s%s %.3fms", n ? ", " : "", timingnames[i], p->timing[i] * 1000.);
+        return buf;
+}
+
+
 char *Util_portTypeDescription(Port_T p) {
         switch (p->type) {
                 case SOCK_STREAM:
@@ -1921,3 +2093,23 @@ int Util_getfqdnhostname(char *buf, unsigned len) {
         return 0;
 }
 
+
+long long Util_elapsed(struct timeval *start) {
+        struct timeval now;
+        ASSERT(start);
+        gettimeofday(&now, NULL);
+        return (now.tv_sec - start->tv_sec) * 1000000LL + (now.tv_usec - start->tv_usec);
+}
+
+
+long long Util_monotonic(void) {
+#ifdef CLOCK_MONOTONIC
+        struct timespec t;
+        if (clock_gettime(CLOCK_MONOTONIC, &t) == 0)
+                return t.tv_sec * 1000000LL + t.tv_nsec / 1000;
+#endif
+        struct timeval now;
+        gettimeofday(&now, NULL);
+        return now.tv_sec * 1000000LL + now.tv_usec;
+}
+
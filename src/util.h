@@ -104,7 +104,7 @@ void Util_printHash(char *file);
 /**
  * Store the checksum of given file in supplied buffer
  * @param file The file for which to compute the checksum
- * @param hashtype The hash type (HASH_MD5 or HASH_SHA1)
+ * @param hashtype The hash type (HASH_MD5, HASH_SHA1, HASH_SHA256 or HASH_XXH64)
  * @param buf The buffer where the result will be stored
  * @param bufsize The size of the buffer
  * @return FALSE if failed, otherwise TRUE
@@ -374,6 +374,93 @@ char *Util_describeAction(Action_T action, char *buf, int bufsize);
 char *Util_getEventratio(Action_T action, char *buf, int bufsize);
 
 
+/**
+ * Print trend rule description, for example "percentile 95 of response
+ * over 30 cycles"
+ * @param t A trend object
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_trendDescription(Trend_T t, char *buf, int bufsize);
+
+
+/**
+ * Print trend value or limit in the unit of the trend metric
+ * @param t A trend object
+ * @param value The value to print
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_trendValue(Trend_T t, long long value, char *buf, int bufsize);
+
+
+/**
+ * Get the value of a directory tree rule metric
+ * @param t A tree object
+ * @param ts The aggregate of the files matching the rule
+ * @param now The current time
+ * @return The value in the unit of the rule limit, the age of the oldest
+ * and newest file is 0 if there are no files
+ */
+long long Util_treeMetric(Tree_T t, const TreeStat_T *ts, time_t now);
+
+
+/**
+ * Print directory tree rule description, for example "age of the oldest
+ * file matching "*.tmp""
+ * @param t A tree object
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_treeDescription(Tree_T t, char *buf, int bufsize);
+
+
+/**
+ * Print directory tree value or limit in the unit of the tree metric
+ * @param t A tree object
+ * @param value The value to print
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_treeValue(Tree_T t, long long value, char *buf, int bufsize);
+
+
+/**
+ * Get the slowest value of a connection timing phase among the ports
+ * of the service which were tested successfully
+ * @param s A Service object
+ * @param phase The timing phase (TIMING_*)
+ * @param port Output of the slowest port or NULL
+ * @return The time [us] or -1 if no port has a value of the phase
+ */
+long long Util_timingMetric(Service_T s, int phase, Port_T *port);
+
+
+/**
+ * Print connection timing value or limit in milliseconds
+ * @param value The value to print [us]
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer
+ */
+char *Util_timingValue(long long value, char *buf, int bufsize);
+
+
+/**
+ * Print the measured response time phases of a port, for example
+ * "resolve 0.012ms, connect 0.250ms, tls 15.100ms, first byte 9.800ms"
+ * @param p A Port object
+ * @param buf Buffer
+ * @param bufsize Buffer size
+ * @return the buffer, empty if no phase was measured
+ */
+char *Util_portTiming(Port_T p, char *buf, int bufsize);
+
+
 /**
  * Print port type description
  * @param p A port structure
@@ -401,5 +488,21 @@ char *Util_portDescription(Port_T p, char *buf, int bufsize);
 int Util_getfqdnhostname(char *buf, unsigned len);
 
 
+/**
+ * Get the time elapsed since the given time
+ * @param start The start time
+ * @return Microseconds elapsed since start
+ */
+long long Util_elapsed(struct timeval *start);
+
+
+/**
+ * Get the time of the monotonic clock, which is not affected by changes
+ * of the system time. Use it to measure intervals only.
+ * @return Microseconds since an unspecified starting point
+ */
+long long Util_monotonic(void);
+
+
 #endif
 
@@ -86,6 +86,13 @@
 #include "device.h"
 #include "process.h"
 #include "protocol.h"
+#include "history.h"
+#include "resolver.h"
+#include "watch.h"
+#include "profile.h"
+#include "snapshot.h"
+#include "digest.h"
+#include "dirtree.h"
 
 // libmonit
 #include "system/Time.h"
@@ -117,6 +124,7 @@ static int  check_skip(Service_T, time_t);
 static void check_timeout(Service_T);
 static void check_checksum(Service_T);
 static void check_timestamp(Service_T);
+static void check_tree(Service_T);
 static void check_process_state(Service_T);
 static void check_process_pid(Service_T);
 static void check_process_ppid(Service_T);
@@ -124,7 +132,10 @@ static void check_connection(Service_T, Port_T);
 static void check_filesystem_flags(Service_T);
 static void check_filesystem_resources(Service_T, Filesystem_T);
 static void check_process_resources(Service_T, Resource_T);
+static void check_history(Service_T);
+static void check_timing(Service_T);
 static int  do_scheduled_action(Service_T);
+static void check_program_status(Service_T);
 
 /* ---------------------------------------------------------------- Public */
 
@@ -137,26 +148,40 @@ static int  do_scheduled_action(Service_T);
 int validate() {
         int errors = 0;
         Service_T s;
+        struct timeval start;
+        long long begin, mark;
 
         Run.handler_flag = HANDLER_SUCCEEDED;
+        begin = Util_monotonic();
         Event_queue_process();
+        Run.cycle.event = (mark = Util_monotonic()) - begin;
 
+        Resolver_refresh();
+        socket_pool_flush(FALSE);
         update_system_load();
+        Run.cycle.prepare = Util_monotonic() - mark;
+
+        mark = Util_monotonic();
         initprocesstree(&ptree, &ptreesize, &oldptree, &oldptreesize);
+        Run.cycle.collect = Util_monotonic() - mark;
         gettimeofday(&systeminfo.collected, NULL);
+        Snapshot_publishSystem();
 
         /* In the case that at least one action is pending, perform quick
          * loop to handle the actions ASAP */
         if (Run.doaction) {
                 Run.doaction = 0;
+                control_batch();
                 for (s = servicelist; s; s = s->next)
                         do_scheduled_action(s);
         }
 
         /* Check the services */
         time_t now = Time_now();
+        mark = Util_monotonic();
         for (s = servicelist; s && !Run.stopped; s = s->next) {
                 if (! do_scheduled_action(s) && s->monitor && ! check_skip(s, now)) {
+                        gettimeofday(&start, NULL);
                         check_timeout(s); // Can disable monitoring => need to check s->monitor again
                         if (s->monitor) {
                                 if (! s->check(s))
@@ -167,15 +192,78 @@ int validate() {
                                         s->monitor = MONITOR_YES;
                         }
                         gettimeofday(&s->collected, NULL);
+                        s->duration = (s->collected.tv_sec - start.tv_sec) * 1000000LL + (s->collected.tv_usec - start.tv_usec);
+                        Profile_record(s, Profile_Check, s->duration);
                 }
+                Snapshot_publish(s);
         }
+        Run.cycle.check = Util_monotonic() - mark;
 
         reset_depend();
 
+        Watch_update();
+
+        Profile_cycle(Util_monotonic() - begin);
+
         return errors;
 }
 
 
+/**
+ * Check the process services whose process exited since the last cycle
+ * and evaluate the check program services whose program exited, as
+ * reported by the process watcher, without waiting for the next cycle.
+ * The exited processes are removed from the cached process tree instead
+ * of rebuilding it.
+ */
+void validate_exited() {
+        Service_T s;
+
+        for (s = servicelist; s && !Run.stopped; s = s->next) {
+                pid_t pid;
+                if (! (s->monitor & MONITOR_YES) || ! (pid = Watch_exited(s)))
+                        continue;
+                if (s->type == TYPE_PROGRAM) {
+                        /* Evaluate the program now, the next run is started in the next cycle as usual */
+                        if (s->program->P && Process_getPid(s->program->P) == pid && Process_exitStatus(s->program->P) >= 0) {
+                                DEBUG("'%s' program with pid %d exited -- evaluating its status now\n", s->name, pid);
+                                check_program_status(s);
+                                gettimeofday(&s->collected, NULL);
+                                Snapshot_publish(s);
+                        }
+                        continue;
+                }
+                if (s->type != TYPE_PROCESS)
+                        continue;
+                int i = findprocess(pid, ptree, ptreesize);
+                if (i >= 0)
+                        FREE(ptree[i].cmdline); // Hide the process from matching
+                check_timeout(s); // Can disable monitoring => need to check s->monitor again
+                if (! s->monitor)
+                        continue;
+                /* A process which exited may be an unreaped zombie for a moment, so the service is tested
+                 * only if another process took its place, otherwise the nonexist event is posted directly */
+                pid_t current = Util_isProcessRunning(s, FALSE);
+                if (current > 0 && current != pid) {
+                        DEBUG("'%s' process with pid %d exited -- checking the new process %d now\n", s->name, pid, current);
+                        struct timeval start;
+                        gettimeofday(&start, NULL);
+                        s->check(s);
+                        Profile_record(s, Profile_Check, Util_elapsed(&start));
+                } else {
+                        Util_resetInfo(s);
+                        Event_post(s, Event_Nonexist, STATE_FAILED, s->action_NONEXIST, "process with pid %d exited", pid);
+                }
+                gettimeofday(&s->collected, NULL);
+                Snapshot_publish(s);
+        }
+
+        reset_depend();
+
+        Watch_update();
+}
+
+
 /**
  * Validate a given process service s. Events are posted according to 
  * its configuration. In case of a fatal event FALSE is returned.
@@ -216,9 +304,17 @@ int check_process(Service_T s) {
         }
 
         /* Test each host:port and protocol in the service's portlist */
-        if (s->portlist)
-                for (pp = s->portlist; pp; pp = pp->next)
+        if (s->portlist) {
+                for (pp = s->portlist; pp; pp = pp->next) {
+                        struct timeval start;
+                        gettimeofday(&start, NULL);
                         check_connection(s, pp);
+                        Profile_record(s, Profile_Connection, Util_elapsed(&start));
+                }
+                check_timing(s);
+        }
+
+        check_history(s);
 
         return TRUE;
 
@@ -324,8 +420,12 @@ int check_file(Service_T s) {
                 Event_post(s, Event_Invalid, STATE_SUCCEEDED, s->action_INVALID, "is a regular file");
         }
 
-        if (s->checksum)
+        if (s->checksum) {
+                struct timeval start;
+                gettimeofday(&start, NULL);
                 check_checksum(s);
+                Profile_record(s, Profile_Checksum, Util_elapsed(&start));
+        }
 
         if (s->perm)
                 check_perm(s);
@@ -342,8 +442,12 @@ int check_file(Service_T s) {
         if (s->timestamplist)
                 check_timestamp(s);
 
-        if (s->matchlist)
+        if (s->matchlist) {
+                struct timeval start;
+                gettimeofday(&start, NULL);
                 check_match(s);
+                Profile_record(s, Profile_Match, Util_elapsed(&start));
+        }
 
         return TRUE;
 
@@ -392,6 +496,13 @@ int check_directory(Service_T s) {
         if (s->timestamplist)
                 check_timestamp(s);
 
+        if (s->treelist) {
+                struct timeval start;
+                gettimeofday(&start, NULL);
+                check_tree(s);
+                Profile_record(s, Profile_Tree, Util_elapsed(&start));
+        }
+
         return TRUE;
 
 }
@@ -444,6 +555,40 @@ int check_fifo(Service_T s) {
 }
 
 
+/**
+ * Evaluate the exit status of the program which exited and free it.
+ * The message is read from the output collected by the process watcher
+ * or from the program's pipes.
+ */
+static void check_program_status(Service_T s) {
+        Process_T P = s->program->P;
+        s->program->exitStatus = Process_exitStatus(P); // Save exit status for web-view display
+        int n = 0;
+        char buf[STRLEN + 1];
+        // Collect the program output, the watcher has drained the pipes while the program ran
+        if ((n = Watch_output(s, buf, sizeof(buf))) <= 0) {
+                if ((n = InputStream_readBytes(Process_getErrorStream(P), buf, STRLEN)) <= 0)
+                        n = InputStream_readBytes(Process_getInputStream(P), buf, STRLEN);
+                buf[n > 0 ? n : 0] = 0;
+        }
+        // Evaluate program's exit status against our status checks.
+        /* TODO: Multiple checks we have now should be deprecated and removed - not useful because it 
+         will alert on everything if != is used other than the match or if = is used, might report nothing on error. */
+        for (Status_T status = s->statuslist; status; status = status->next) {
+                if (Util_evalQExpression(status->operator, s->program->exitStatus, status->return_value)) {
+                        if (n > 0)
+                                Event_post(s, Event_Status, STATE_FAILED, status->action, "%s", buf);
+                        else
+                                Event_post(s, Event_Status, STATE_FAILED, status->action, "'%s' failed with exit status (%d) -- no output from program", s->path, s->program->exitStatus);
+                } else {
+                        DEBUG("'%s' status check succeeded\n", s->name);
+                        Event_post(s, Event_Status, STATE_SUCCEEDED, status->action, "status succeeded");
+                }
+        }
+        Process_free(&s->program->P);
+}
+
+
 /**
  * Validate a program status. Events are posted according to 
  * its configuration. In case of a fatal event FALSE is returned.
@@ -467,29 +612,7 @@ int check_program(Service_T s) {
                                 return TRUE;
                         }
                 }
-                s->program->exitStatus = Process_exitStatus(P); // Save exit status for web-view display
-                int n = 0;
-                char buf[STRLEN + 1];
-                // Evaluate program's exit status against our status checks.
-                /* TODO: Multiple checks we have now should be deprecated and removed - not useful because it 
-                 will alert on everything if != is used other than the match or if = is used, might report nothing on error. */
-                for (Status_T status = s->statuslist; status; status = status->next) {
-                        if (Util_evalQExpression(status->operator, s->program->exitStatus, status->return_value)) {
-                                // Read message from script
-                                if ((n = InputStream_readBytes(Process_getErrorStream(P), buf, STRLEN)) <= 0)
-                                        n = InputStream_readBytes(Process_getInputStream(P), buf, STRLEN);
-                                if (n > 0) {
-                                        buf[n] = 0;
-                                        Event_post(s, Event_Status, STATE_FAILED, status->action, "%s", buf);
-                                } else {
-                                        Event_post(s, Event_Status, STATE_FAILED, status->action, "'%s' failed with exit status (%d) -- no output from program", s->path, s->program->exitStatus);
-                                }
-                        } else {
-                                DEBUG("'%s' status check succeeded\n", s->name);
-                                Event_post(s, Event_Status, STATE_SUCCEEDED, status->action, "status succeeded");
-                        }
-                }
-                Process_free(&s->program->P);
+                check_program_status(s);
         }
         // Start program
         s->program->P = Command_execute(s->program->C);
@@ -498,6 +621,7 @@ int check_program(Service_T s) {
         } else {
                 Event_post(s, Event_Status, STATE_SUCCEEDED, s->action_EXEC, "'%s' program started", s->name);
                 s->program->started = now;
+                Watch_program(s, s->program->P);
         }
         return TRUE;
 }
@@ -556,9 +680,17 @@ int check_remote_host(Service_T s) {
         }
 
         /* Test each host:port and protocol in the service's portlist */
-        if (s->portlist)
-                for (p = s->portlist; p; p = p->next)
+        if (s->portlist) {
+                for (p = s->portlist; p; p = p->next) {
+                        struct timeval start;
+                        gettimeofday(&start, NULL);
                         check_connection(s, p);
+                        Profile_record(s, Profile_Connection, Util_elapsed(&start));
+                }
+                check_timing(s);
+        }
+
+        check_history(s);
 
         return TRUE;
 
@@ -578,6 +710,8 @@ int check_system(Service_T s) {
                 check_process_resources(s, r);
         }
 
+        check_history(s);
+
         return TRUE;
 }
 
@@ -592,18 +726,30 @@ static void check_connection(Service_T s, Port_T p) {
         Socket_T socket;
         volatile int retry_count = p->retry;
         volatile int rv = TRUE;
+        volatile int pooled = FALSE;
+        volatile int reuse = Run.keepalive && p->protocol->check == check_http;
         char buf[STRLEN];
         char report[STRLEN] = {0};
-        struct timeval t1;
-        struct timeval t2;
+        long long start, test;
+        double timing[TIMING_PHASES];
 
         ASSERT(s && p);
 retry:
-        /* Get time of connection attempt beginning */
-        gettimeofday(&t1, NULL);
-
-        /* Open a socket to the destination INET[hostname:port] or UNIX[pathname] */
-        socket = socket_create(p);
+        /* Time the attempt with the monotonic clock, a change of the system time must not affect the response time. The
+         * phases are collected in a local array and stored in the port once the attempt is finished */
+        start = Util_monotonic();
+        for (int i = 0; i < TIMING_PHASES; i++)
+                timing[i] = -1;
+
+        /* Reuse an idle keep-alive connection if possible, otherwise open a socket to the destination INET[hostname:port] or UNIX[pathname] */
+        socket = NULL;
+        if (reuse && (socket = socket_pool_get(p))) {
+                pooled = TRUE;
+                timing[TIMING_RESOLVE] = timing[TIMING_CONNECT] = 0;
+                if (p->SSL.use_ssl)
+                        timing[TIMING_TLS] = 0;
+        } else
+                socket = socket_create(p, timing);
         if (!socket) {
                 snprintf(report, STRLEN, "failed, cannot open a connection to %s", Util_portDescription(p, buf, sizeof(buf)));
                 rv = FALSE;
@@ -622,31 +768,43 @@ retry:
         }
 
         /* Run the protocol verification routine through the socket */
+        test = Util_monotonic();
         if (! p->protocol->check(socket)) {
+                if (pooled) {
+                        /* The server may close an idle connection at any time, retry once with a new one without consuming an attempt */
+                        DEBUG("'%s' pooled connection to %s failed -- reconnecting\n", s->name, Util_portDescription(p, buf, sizeof(buf)));
+                        socket_free(&socket);
+                        pooled = reuse = FALSE;
+                        goto retry;
+                }
                 snprintf(report, STRLEN, "failed protocol test [%s] at %s -- %s", p->protocol->name, Util_portDescription(p, buf, sizeof(buf)), socket_getError(socket));
                 rv = FALSE;
                 goto error;
         } else
                 DEBUG("'%s' succeeded testing protocol [%s] at %s\n", s->name, p->protocol->name, Util_portDescription(p, buf, sizeof(buf)));
 
-        /* Get time of connection attempt finish */
-        gettimeofday(&t2, NULL);
-
-        /* Get the response time */
-        p->response = (double)(t2.tv_sec - t1.tv_sec) + (double)(t2.tv_usec - t1.tv_usec)/1000000;
+        /* Get the response time and the time to the first byte of the protocol response, if the test read any */
+        timing[TIMING_RESPONSE] = (Util_monotonic() - start) / 1000000.;
+        if (socket_get_firstbyte(socket) >= test)
+                timing[TIMING_FIRSTBYTE] = (socket_get_firstbyte(socket) - test) / 1000000.;
 
 error:
         if (socket)
-                socket_free(&socket);
+                socket_pool_put(&socket);
+        pooled = FALSE;
         if (!rv) {
                 if (retry_count-- > 1) {
                         DEBUG("'%s' %s (attempt %d/%d)\n", s->name, report, p->retry - retry_count, p->retry);
                         goto retry;
                 }
                 p->response = -1;
+                for (int i = 0; i < TIMING_PHASES; i++)
+                        p->timing[i] = -1;
                 p->is_available = FALSE;
                 Event_post(s, Event_Connection, STATE_FAILED, p->action, report);
         } else {
+                p->response = timing[TIMING_RESPONSE];
+                memcpy(p->timing, timing, sizeof(timing));
                 p->is_available = TRUE;
                 Event_post(s, Event_Connection, STATE_SUCCEEDED, p->action, "connection succeeded to %s", Util_portDescription(p, buf, sizeof(buf)));
         }
@@ -707,6 +865,55 @@ static void check_process_ppid(Service_T s) {
 }
 
 
+/**
+ * Record the service metrics history and test the trend rules
+ */
+static void check_history(Service_T s) {
+        char value[STRLEN], limit[STRLEN], description[STRLEN];
+        long long v;
+
+        History_record(s);
+        for (Trend_T t = s->trendlist; t; t = t->next) {
+                if (! History_evaluate(s->history, t, &v)) {
+                        DEBUG("'%s' %s check skipped (collecting samples)\n", s->name, Util_trendDescription(t, description, sizeof(description)));
+                        continue;
+                }
+                Util_trendDescription(t, description, sizeof(description));
+                Util_trendValue(t, v, value, sizeof(value));
+                Util_trendValue(t, t->limit, limit, sizeof(limit));
+                if (Util_evalQExpression(t->operator, v, t->limit))
+                        Event_post(s, Event_Resource, STATE_FAILED, t->action, "%s is %s, matches resource limit [%s%s]", description, value, operatorshortnames[t->operator], limit);
+                else
+                        Event_post(s, Event_Resource, STATE_SUCCEEDED, t->action, "'%s' %s check succeeded [current value=%s]", s->name, description, value);
+        }
+}
+
+
+/**
+ * Test the connection timing rules against the slowest port which was
+ * tested successfully. A failed connection is reported by the connection
+ * test itself.
+ */
+static void check_timing(Service_T s) {
+        char value[STRLEN], limit[STRLEN], buf[STRLEN];
+        Port_T p;
+        long long v;
+
+        for (Timing_T t = s->timinglist; t; t = t->next) {
+                if ((v = Util_timingMetric(s, t->phase, &p)) < 0) {
+                        DEBUG("'%s' %s time check skipped (not measured)\n", s->name, timingnames[t->phase]);
+                        continue;
+                }
+                Util_timingValue(v, value, sizeof(value));
+                Util_timingValue(t->limit, limit, sizeof(limit));
+                if (Util_evalQExpression(t->operator, v, t->limit))
+                        Event_post(s, Event_Resource, STATE_FAILED, t->action, "%s time of %s is %s, matches resource limit [%s time%s%s]", timingnames[t->phase], Util_portDescription(p, buf, sizeof(buf)), value, timingnames[t->phase], operatorshortnames[t->operator], limit);
+                else
+                        Event_post(s, Event_Resource, STATE_SUCCEEDED, t->action, "'%s' %s time check succeeded [current value=%s]", s->name, timingnames[t->phase], value);
+        }
+}
+
+
 /**
  * Check process resources
  */
@@ -769,6 +976,56 @@ static void check_process_resources(Service_T s, Resource_T r) {
                                 snprintf(report, STRLEN, "'%s' cpu wait usage check succeeded [current cpu wait usage=%.1f%%]", s->name, systeminfo.total_cpu_wait_percent/10.0);
                         break;
 
+                case RESOURCE_ID_CPUSTEAL:
+                        if (s->monitor & MONITOR_INIT || systeminfo.total_cpu_steal_percent < 0) {
+                                DEBUG("'%s' cpu steal usage check skipped (initializing)\n", s->name);
+                        } else if (Util_evalQExpression(r->operator, systeminfo.total_cpu_steal_percent, r->limit)) {
+                                snprintf(report, STRLEN, "cpu steal usage of %.1f%% matches resource limit [cpu steal usage%s%.1f%%]", systeminfo.total_cpu_steal_percent/10.0, operatorshortnames[r->operator], r->limit/10.0);
+                                okay = FALSE;
+                        } else
+                                snprintf(report, STRLEN, "'%s' cpu steal usage check succeeded [current cpu steal usage=%.1f%%]", s->name, systeminfo.total_cpu_steal_percent/10.0);
+                        break;
+
+                case RESOURCE_ID_CPUIRQ:
+                        if (s->monitor & MONITOR_INIT || systeminfo.total_cpu_irq_percent < 0) {
+                                DEBUG("'%s' cpu irq usage check skipped (initializing)\n", s->name);
+                        } else if (Util_evalQExpression(r->operator, systeminfo.total_cpu_irq_percent, r->limit)) {
+                                snprintf(report, STRLEN, "cpu irq usage of %.1f%% matches resource limit [cpu irq usage%s%.1f%%]", systeminfo.total_cpu_irq_percent/10.0, operatorshortnames[r->operator], r->limit/10.0);
+                                okay = FALSE;
+                        } else
+                                snprintf(report, STRLEN, "'%s' cpu irq usage check succeeded [current cpu irq usage=%.1f%%]", s->name, systeminfo.total_cpu_irq_percent/10.0);
+                        break;
+
+                case RESOURCE_ID_PRESSURE_CPU:
+                        if (systeminfo.pressure_cpu.some_avg10 < 0) {
+                                DEBUG("'%s' cpu pressure check skipped (not available)\n", s->name);
+                        } else if (Util_evalQExpression(r->operator, systeminfo.pressure_cpu.some_avg10, r->limit)) {
+                                snprintf(report, STRLEN, "cpu pressure of %.1f%% matches resource limit [cpu pressure%s%.1f%%]", systeminfo.pressure_cpu.some_avg10/10.0, operatorshortnames[r->operator], r->limit/10.0);
+                                okay = FALSE;
+                        } else
+                                snprintf(report, STRLEN, "'%s' cpu pressure check succeeded [current cpu pressure=%.1f%%]", s->name, systeminfo.pressure_cpu.some_avg10/10.0);
+                        break;
+
+                case RESOURCE_ID_PRESSURE_MEMORY:
+                        if (systeminfo.pressure_memory.some_avg10 < 0) {
+                                DEBUG("'%s' memory pressure check skipped (not available)\n", s->name);
+                        } else if (Util_evalQExpression(r->operator, systeminfo.pressure_memory.some_avg10, r->limit)) {
+                                snprintf(report, STRLEN, "memory pressure of %.1f%% matches resource limit [memory pressure%s%.1f%%]", systeminfo.pressure_memory.some_avg10/10.0, operatorshortnames[r->operator], r->limit/10.0);
+                                okay = FALSE;
+                        } else
+                                snprintf(report, STRLEN, "'%s' memory pressure check succeeded [current memory pressure=%.1f%%]", s->name, systeminfo.pressure_memory.some_avg10/10.0);
+                        break;
+
+                case RESOURCE_ID_PRESSURE_IO:
+                        if (systeminfo.pressure_io.some_avg10 < 0) {
+                                DEBUG("'%s' io pressure check skipped (not available)\n", s->name);
+                        } else if (Util_evalQExpression(r->operator, systeminfo.pressure_io.some_avg10, r->limit)) {
+                                snprintf(report, STRLEN, "io pressure of %.1f%% matches resource limit [io pressure%s%.1f%%]", systeminfo.pressure_io.some_avg10/10.0, operatorshortnames[r->operator], r->limit/10.0);
+                                okay = FALSE;
+                        } else
+                                snprintf(report, STRLEN, "'%s' io pressure check succeeded [current io pressure=%.1f%%]", s->name, systeminfo.pressure_io.some_avg10/10.0);
+                        break;
+
                 case RESOURCE_ID_MEM_PERCENT:
                         if (s->type == TYPE_SYSTEM) {
                                 if (Util_evalQExpression(r->operator, systeminfo.total_mem_percent, r->limit)) {
@@ -904,18 +1161,13 @@ static void check_checksum(Service_T s) {
                         snprintf(cs->hash, sizeof(cs->hash), "%s", s->inf->priv.file.cs_sum);
                 }
 
-                switch(cs->type) {
-                        case HASH_MD5:
-                                changed = strncmp(cs->hash, s->inf->priv.file.cs_sum, 32);
-                                break;
-                        case HASH_SHA1:
-                                changed = strncmp(cs->hash, s->inf->priv.file.cs_sum, 40);
-                                break;
-                        default:
-                                LogError("'%s' unknown hash type\n", s->name);
-                                *s->inf->priv.file.cs_sum = 0;
-                                return;
+                int length = Digest_length(cs->type);
+                if (! length) {
+                        LogError("'%s' unknown hash type\n", s->name);
+                        *s->inf->priv.file.cs_sum = 0;
+                        return;
                 }
+                changed = strncmp(cs->hash, s->inf->priv.file.cs_sum, length * 2);
 
                 if (changed) {
 
@@ -1037,6 +1289,38 @@ static void check_timestamp(Service_T s) {
 }
 
 
+/**
+ * Scan the directory tree and test the files below the directory
+ */
+static void check_tree(Service_T s) {
+        char description[STRLEN], value[STRLEN], limit[STRLEN];
+        time_t now = time(NULL);
+
+        ASSERT(s && s->treelist);
+
+        if (! Dirtree_scan(s)) {
+                Event_post(s, Event_Data, STATE_FAILED, s->action_DATA, "cannot read the directory tree -- %s", STRERROR);
+                return;
+        }
+        DEBUG("'%s' directory tree scanned: %lu directories, %lu read\n", s->name, s->inf->priv.directory.directories, s->inf->priv.directory.reread);
+        Event_post(s, Event_Data, STATE_SUCCEEDED, s->action_DATA, "directory tree scanned");
+
+        for (Tree_T t = s->treelist; t; t = t->next) {
+                const TreeStat_T *ts = Dirtree_get(s->dirtree, t->filter);
+                long long v = Util_treeMetric(t, ts, now);
+                int event = t->metric == TREE_FILES ? Event_Resource : t->metric == TREE_SIZE ? Event_Size : Event_Timestamp;
+                Util_treeDescription(t, description, sizeof(description));
+                Util_treeValue(t, v, value, sizeof(value));
+                if (Util_evalQExpression(t->operator, v, t->limit)) {
+                        Event_post(s, event, STATE_FAILED, t->action, "%s is %s, matches limit [%s%s]", description, value, operatorshortnames[t->operator], Util_treeValue(t, t->limit, limit, sizeof(limit)));
+                } else {
+                        DEBUG("'%s' %s check succeeded [current value=%s]\n", s->name, description, value);
+                        Event_post(s, event, STATE_SUCCEEDED, t->action, "'%s' %s check succeeded [current value=%s]", s->name, description, value);
+                }
+        }
+}
+
+
 /**
  * Test size
  */
@@ -0,0 +1,472 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+
+#ifdef HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+
+#ifdef HAVE_POLL_H
+#include <poll.h>
+#endif
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#include "monit.h"
+#include "process.h"
+#include "watch.h"
+
+
+/* ------------------------------------------------------------- Definitions */
+
+
+typedef struct mywatch {
+        Service_T s;               /**< The service, used as a key only */
+        pid_t     pid;                           /**< The watched process */
+        int       fd;           /**< pidfd of the process, -1 if not open */
+        int       wanted;    /**< FALSE if the entry is dropped by the thread */
+        int       exited;                   /**< TRUE if the process exited */
+        int       reported;      /**< TRUE if the exit was reported already */
+        int       program;   /**< TRUE if this is a check program subprocess */
+        int       out;             /**< Own copy of the program stdout pipe */
+        int       err;             /**< Own copy of the program stderr pipe */
+        int       outlen;
+        int       errlen;
+        char      output[STRLEN];   /**< The first bytes of the program stdout */
+        char      error[STRLEN];    /**< The first bytes of the program stderr */
+        struct mywatch *next;
+} *Watch_T;
+
+
+/* The descriptor of a poll slot */
+typedef struct {
+        Watch_T w;
+        int    *fd;
+} Slot_T;
+
+
+static Watch_T watches = NULL;
+static int running = FALSE;
+static volatile int stopped = FALSE;
+static volatile int pending = FALSE;
+static int wakeup_pipe[2] = {-1, -1};
+static pthread_t main_thread;
+static pthread_t watch_thread;
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+/* ----------------------------------------------------------------- Private */
+
+
+/* SIGUSR2 just interrupts the sleep of the main thread */
+static RETSIGTYPE do_notify(int sig) {
+}
+
+
+static void wakeup() {
+        char c = 0;
+        if (write(wakeup_pipe[1], &c, 1) < 0 && errno != EAGAIN)
+                LogError("%s: Cannot wake up the process watcher -- %s\n", prog, STRERROR);
+}
+
+
+static void close_descriptor(int *fd) {
+        if (*fd >= 0) {
+                close(*fd);
+                *fd = -1;
+        }
+}
+
+
+/**
+ * Read what is available from a program output pipe. The first STRLEN
+ * bytes are kept for the status message, the rest is discarded so the
+ * program never blocks on a full pipe. The pipe is closed at EOF.
+ * Must be called with the mutex locked.
+ */
+static void drain(int *fd, char *buffer, int *length) {
+        char buf[4096];
+        int n;
+        while ((n = (int)read(*fd, buf, sizeof(buf))) > 0) {
+                int copy = n < STRLEN - 1 - *length ? n : STRLEN - 1 - *length;
+                if (copy > 0) {
+                        memcpy(buffer + *length, buf, copy);
+                        *length += copy;
+                }
+        }
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                close_descriptor(fd);
+}
+
+
+/**
+ * Drop the entries which are not wanted anymore and open a pidfd for
+ * new ones. Must be called by the watcher thread with the mutex locked,
+ * so the descriptors are never closed while they are polled.
+ * @return The number of open descriptors
+ */
+static int reconcile() {
+        int n = 0;
+        for (Watch_T *p = &watches; *p;) {
+                Watch_T w = *p;
+                if (! w->wanted) {
+                        *p = w->next;
+                        close_descriptor(&w->fd);
+                        close_descriptor(&w->out);
+                        close_descriptor(&w->err);
+                        FREE(w);
+                        continue;
+                }
+                if (w->fd < 0 && ! w->exited) {
+                        if ((w->fd = process_watch(w->pid)) < 0) {
+                                /* The process is gone already */
+                                DEBUG("Process watcher: cannot watch pid %d -- %s\n", w->pid, STRERROR);
+                                w->exited = TRUE;
+                                pending = TRUE;
+                        }
+                }
+                n += (w->fd >= 0) + (w->out >= 0) + (w->err >= 0);
+                p = &w->next;
+        }
+        return n;
+}
+
+
+/* Add the descriptor to the poll set */
+static void add(struct pollfd *fds, Slot_T *slots, int *n, Watch_T w, int *fd) {
+        if (*fd >= 0) {
+                fds[*n].fd = *fd;
+                fds[*n].events = POLLIN;
+                slots[*n].w = w;
+                slots[*n].fd = fd;
+                (*n)++;
+        }
+}
+
+
+static void *watcher(void *args) {
+        sigset_t ns;
+
+        set_signal_block(&ns, NULL);
+        LogInfo("Process watcher started\n");
+        while (! stopped) {
+                int n = 1, notify;
+                struct pollfd *fds;
+                Slot_T *slots;
+                LOCK(mutex)
+                {
+                        int size = reconcile() + 1;
+                        fds = CALLOC(size, sizeof(struct pollfd));
+                        slots = CALLOC(size, sizeof(Slot_T));
+                        for (Watch_T w = watches; w; w = w->next) {
+                                add(fds, slots, &n, w, &w->fd);
+                                add(fds, slots, &n, w, &w->out);
+                                add(fds, slots, &n, w, &w->err);
+                        }
+                        notify = pending;
+                }
+                END_LOCK;
+                fds[0].fd = wakeup_pipe[0];
+                fds[0].events = POLLIN;
+                if (notify)
+                        pthread_kill(main_thread, SIGUSR2);
+                if (poll(fds, n, -1) < 0) {
+                        if (errno != EINTR) {
+                                LogError("%s: Process watcher poll failed -- %s\n", prog, STRERROR);
+                                FREE(fds);
+                                FREE(slots);
+                                break;
+                        }
+                } else {
+                        if (fds[0].revents) {
+                                char buf[64];
+                                while (read(wakeup_pipe[0], buf, sizeof(buf)) > 0)
+                                        ;
+                        }
+                        notify = FALSE;
+                        LOCK(mutex)
+                        {
+                                for (int i = 1; i < n; i++) {
+                                        Watch_T w = slots[i].w;
+                                        if (! fds[i].revents || *slots[i].fd != fds[i].fd)
+                                                continue;
+                                        if (slots[i].fd == &w->out) {
+                                                drain(&w->out, w->output, &w->outlen);
+                                        } else if (slots[i].fd == &w->err) {
+                                                drain(&w->err, w->error, &w->errlen);
+                                        } else {
+                                                DEBUG("Process watcher: process %d exited\n", w->pid);
+                                                close_descriptor(&w->fd);
+                                                if (w->program) {
+                                                        /* Collect what the program wrote before it exited, descendants may keep the pipes open */
+                                                        if (w->out >= 0)
+                                                                drain(&w->out, w->output, &w->outlen);
+                                                        if (w->err >= 0)
+                                                                drain(&w->err, w->error, &w->errlen);
+                                                        close_descriptor(&w->out);
+                                                        close_descriptor(&w->err);
+                                                }
+                                                w->exited = TRUE;
+                                                pending = notify = TRUE;
+                                        }
+                                }
+                        }
+                        END_LOCK;
+                        if (notify)
+                                pthread_kill(main_thread, SIGUSR2);
+                }
+                FREE(fds);
+                FREE(slots);
+        }
+        LogInfo("Process watcher stopped\n");
+        return NULL;
+}
+
+
+/* Must be called with the mutex locked */
+static Watch_T find(Service_T s, int program) {
+        for (Watch_T w = watches; w; w = w->next)
+                if (w->s == s && w->program == program && w->wanted)
+                        return w;
+        return NULL;
+}
+
+
+/* ------------------------------------------------------------------ Public */
+
+
+void Watch_start() {
+        int status, fd;
+
+        if (running)
+                return;
+        if (! Run.pidwatch) {
+                Service_T s;
+                for (s = servicelist; s && s->type != TYPE_PROGRAM; s = s->next)
+                        ;
+                if (! s)
+                        return;
+        }
+        /* Test pidfd support with our own pid */
+        if ((fd = process_watch(getpid())) < 0) {
+                if (Run.pidwatch)
+                        LogError("%s: The process watcher is not supported on this system -- process exits are detected in the next cycle\n", prog);
+                return;
+        }
+        close(fd);
+        if (pipe(wakeup_pipe) < 0) {
+                LogError("%s: Cannot create the process watcher pipe -- %s\n", prog, STRERROR);
+                return;
+        }
+        for (int i = 0; i < 2; i++) {
+                fcntl(wakeup_pipe[i], F_SETFL, fcntl(wakeup_pipe[i], F_GETFL) | O_NONBLOCK);
+                fcntl(wakeup_pipe[i], F_SETFD, FD_CLOEXEC);
+        }
+        main_thread = pthread_self();
+        signal(SIGUSR2, do_notify);
+        stopped = FALSE;
+        if ((status = pthread_create(&watch_thread, NULL, watcher, NULL)) != 0) {
+                LogError("%s: Failed to create the process watcher thread -- %s\n", prog, strerror(status));
+                close(wakeup_pipe[0]);
+                close(wakeup_pipe[1]);
+                return;
+        }
+        running = TRUE;
+}
+
+
+void Watch_stop() {
+        int status;
+
+        if (! running)
+                return;
+        stopped = TRUE;
+        wakeup();
+        if ((status = pthread_join(watch_thread, NULL)) != 0)
+                LogError("%s: Failed to stop the process watcher thread -- %s\n", prog, strerror(status));
+        close(wakeup_pipe[0]);
+        close(wakeup_pipe[1]);
+        LOCK(mutex)
+        {
+                while (watches) {
+                        Watch_T w = watches;
+                        watches = w->next;
+                        close_descriptor(&w->fd);
+                        close_descriptor(&w->out);
+                        close_descriptor(&w->err);
+                        FREE(w);
+                }
+                pending = FALSE;
+        }
+        END_LOCK;
+        running = FALSE;
+}
+
+
+void Watch_update() {
+        int changed = FALSE;
+
+        if (! running || ! Run.pidwatch)
+                return;
+        LOCK(mutex)
+        {
+                for (Watch_T w = watches; w; w = w->next)
+                        if (! w->program)
+                                w->wanted = FALSE;
+                for (Service_T s = servicelist; s; s = s->next) {
+                        Watch_T w;
+                        pid_t pid;
+                        if (s->type != TYPE_PROCESS || ! (s->monitor & MONITOR_YES))
+                                continue;
+                        /* A process started in this cycle is not known yet, its pidfile is read directly */
+                        if ((pid = s->inf->priv.process.pid) <= 0 && (s->matchlist || ! process_isalive(pid = Util_getPid(s->path))))
+                                continue;
+                        for (w = watches; w; w = w->next)
+                                if (w->s == s && w->pid == pid && ! w->program)
+                                        break;
+                        if (! w) {
+                                NEW(w);
+                                w->s = s;
+                                w->pid = pid;
+                                w->fd = w->out = w->err = -1;
+                                w->next = watches;
+                                watches = w;
+                                changed = TRUE;
+                        }
+                        w->wanted = TRUE;
+                }
+                for (Watch_T w = watches; w && ! changed; w = w->next)
+                        if (! w->wanted)
+                                changed = TRUE;
+        }
+        END_LOCK;
+        if (changed)
+                wakeup();
+}
+
+
+int Watch_program(Service_T s, Process_T P) {
+        Watch_T w;
+
+        ASSERT(s);
+        ASSERT(P);
+
+        if (! running)
+                return FALSE;
+        NEW(w);
+        w->s = s;
+        w->pid = Process_getPid(P);
+        w->program = TRUE;
+        w->wanted = TRUE;
+        w->fd = -1;
+        /* The watcher reads from its own copies of the pipes, so the main thread may free the Process at any time */
+        w->out = dup(InputStream_getDescriptor(Process_getInputStream(P)));
+        w->err = dup(InputStream_getDescriptor(Process_getErrorStream(P)));
+        LOCK(mutex)
+        {
+                Watch_T old = find(s, TRUE);
+                if (old)
+                        old->wanted = FALSE;
+                w->next = watches;
+                watches = w;
+        }
+        END_LOCK;
+        wakeup();
+        return TRUE;
+}
+
+
+int Watch_output(Service_T s, char *buf, int size) {
+        int n = -1;
+
+        ASSERT(s);
+        ASSERT(buf);
+
+        LOCK(mutex)
+        {
+                Watch_T w = find(s, TRUE);
+                if (w) {
+                        /* Prefer the error output like the program test always did */
+                        char *output = w->errlen ? w->error : w->output;
+                        n = w->errlen ? w->errlen : w->outlen;
+                        if (n > size - 1)
+                                n = size - 1;
+                        memcpy(buf, output, n);
+                        buf[n] = 0;
+                        w->wanted = FALSE;
+                }
+        }
+        END_LOCK;
+        if (n >= 0)
+                wakeup();
+        return n;
+}
+
+
+int Watch_pending() {
+        int rv;
+        LOCK(mutex)
+        {
+                rv = pending;
+                pending = FALSE;
+        }
+        END_LOCK;
+        return rv;
+}
+
+
+pid_t Watch_exited(Service_T s) {
+        pid_t pid = 0;
+        ASSERT(s);
+        LOCK(mutex)
+        {
+                for (Watch_T w = watches; w; w = w->next) {
+                        if (w->s == s && w->wanted && w->exited && ! w->reported) {
+                                w->reported = TRUE;
+                                pid = w->pid;
+                                break;
+                        }
+                }
+        }
+        END_LOCK;
+        return pid;
+}
+
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+
+
+#ifndef MONIT_WATCH_H
+#define MONIT_WATCH_H
+
+#include "monit.h"
+
+
+/**
+ * Process exit watcher.
+ *
+ * A thread waits on a pidfd of every running process service and
+ * reports an exit as soon as it happens, instead of at the next poll
+ * cycle. The main thread is interrupted with SIGUSR2 and checks the
+ * affected services at once with validate_exited(), so the usual
+ * nonexist events and actions (e.g. restart) apply. The watched pids
+ * are taken from the process services after each validation cycle.
+ * Process services are watched if enabled with "set pidwatch".
+ *
+ * The programs of check program services are watched the same way:
+ * their stdout and stderr are read while they run, so a chatty program
+ * never blocks on a full pipe, and the exit status is evaluated when
+ * the program exits instead of in the next cycle.
+ *
+ * The watcher needs Linux 5.3 or later, otherwise it is not started
+ * and the services are checked each cycle.
+ *
+ *  @file
+ */
+
+
+/**
+ * Start the watcher thread if "set pidwatch" is used or there is a
+ * check program service. Must be called from the main thread.
+ */
+void Watch_start();
+
+
+/**
+ * Stop the watcher thread and forget all watched processes
+ */
+void Watch_stop();
+
+
+/**
+ * Watch the current process of every monitored process service.
+ * Called by the main thread after each validation cycle.
+ */
+void Watch_update();
+
+
+/**
+ * Watch the program of a check program service. The program output is
+ * collected by the watcher from now on.
+ * @param s A Service object
+ * @param P The program process
+ * @return TRUE if the program is watched, FALSE if the watcher is not running
+ */
+int Watch_program(Service_T s, Process_T P);
+
+
+/**
+ * Get the output collected from the program of the service and stop
+ * watching it. The error output is returned if the program wrote any,
+ * otherwise the standard output.
+ * @param s A Service object
+ * @param buf The output is copied into this buffer
+ * @param size Size of the buffer
+ * @return The number of bytes copied or -1 if the program is not watched
+ */
+int Watch_output(Service_T s, char *buf, int size);
+
+
+/**
+ * Test and clear the exit notification flag
+ * @return TRUE if a watched process exited since the last call
+ */
+int Watch_pending();
+
+
+/**
+ * Get the pid of the service process or program if it exited and was
+ * not reported yet. The exit is reported once.
+ * @param s A Service object
+ * @return The pid of the exited process or 0
+ */
+pid_t Watch_exited(Service_T s);
+
+
+#endif
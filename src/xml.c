@@ -47,6 +47,9 @@
 
 #include "monit.h"
 #include "event.h"
+#include "history.h"
+#include "profile.h"
+#include "snapshot.h"
 #include "process.h"
 
 
@@ -129,6 +132,103 @@ static void document_foot(StringBuffer_T B) {
 }
 
 
+/**
+ * Prints pressure stall information into the given buffer.
+ * @param B StringBuffer object
+ * @param name Resource name
+ * @param P Pressure object
+ */
+static void status_pressure(StringBuffer_T B, const char *name, Pressure_T *P) {
+        if (P->some_avg10 < 0)
+                return;
+        StringBuffer_append(B,
+                "<%s>"
+                "<someavg10>%.1f</someavg10>"
+                "<someavg60>%.1f</someavg60>",
+                name,
+                P->some_avg10/10.,
+                P->some_avg60/10.);
+        if (P->full_avg10 >= 0)
+                StringBuffer_append(B,
+                        "<fullavg10>%.1f</fullavg10>"
+                        "<fullavg60>%.1f</fullavg60>",
+                        P->full_avg10/10.,
+                        P->full_avg60/10.);
+        StringBuffer_append(B, "</%s>", name);
+}
+
+
+/**
+ * Prints the check latency summary of a service into the given buffer.
+ * @param S Service object
+ * @param B StringBuffer object
+ */
+static void status_latency(Service_T S, StringBuffer_T B) {
+        for (int i = 0; i < Profile_Tests; i++) {
+                struct myhistogram copy, *h = &copy;
+                if (! Profile_test(S, i, h))
+                        continue;
+                StringBuffer_append(B,
+                        "<latency test=\"%s\">"
+                        "<count>%llu</count>"
+                        "<avg>%llu</avg>"
+                        "<p50>%lld</p50>"
+                        "<p95>%lld</p95>"
+                        "<p99>%lld</p99>"
+                        "<max>%llu</max>"
+                        "</latency>",
+                        profiletestnames[i],
+                        h->count,
+                        h->sum / h->count,
+                        Histogram_percentile(h, 50),
+                        Histogram_percentile(h, 95),
+                        Histogram_percentile(h, 99),
+                        h->max);
+        }
+}
+
+
+/**
+ * Prints the response time phases of a port into the given buffer, a
+ * phase which was not measured is -1.
+ * @param P Port object
+ * @param B StringBuffer object
+ */
+static void status_timing(Port_T P, StringBuffer_T B) {
+        if (! P->is_available)
+                return;
+        StringBuffer_append(B,
+                "<timing>"
+                "<resolve>%.6f</resolve>"
+                "<connect>%.6f</connect>"
+                "<tls>%.6f</tls>"
+                "<firstbyte>%.6f</firstbyte>"
+                "</timing>",
+                P->timing[TIMING_RESOLVE],
+                P->timing[TIMING_CONNECT],
+                P->timing[TIMING_TLS],
+                P->timing[TIMING_FIRSTBYTE]);
+}
+
+
+/**
+ * Prints a latency histogram into the given buffer. The non-empty
+ * buckets are listed as <lower bound [us]>:<count>.
+ * @param B StringBuffer object
+ * @param element The XML element name
+ * @param name The histogram name
+ * @param h Histogram object
+ */
+static void profile_histogram(StringBuffer_T B, const char *element, const char *name, Histogram_T h) {
+        StringBuffer_append(B, "<%s name=\"%s\" count=\"%llu\" sum=\"%llu\" max=\"%llu\" p50=\"%lld\" p95=\"%lld\" p99=\"%lld\">",
+                element, name, h->count, h->sum, h->max, Histogram_percentile(h, 50), Histogram_percentile(h, 95), Histogram_percentile(h, 99));
+        for (int b = 0, n = 0; b < PROFILE_BUCKETS; b++)
+                if (h->bucket[b])
+                        StringBuffer_append(B, n++ ? " %lld:%u" : "%lld:%u", Histogram_bucket(b), h->bucket[b]);
+        StringBuffer_append(B, "</%s>", element);
+}
+
+
 /**
  * Prints a service status into the given buffer.
  * @param S Service object
@@ -137,6 +237,12 @@ static void document_foot(StringBuffer_T B) {
  * @param V Format version
  */
 static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
+        Snapshot_T snapshot;
+        SystemInfo_T si;
+        Service_T live = S;
+
+        S = Snapshot_service(S, &snapshot);
+        Snapshot_system(&si);
         if (V == 2)
                 StringBuffer_append(B, "<service name=\"%s\"><type>%d</type>", S->name ? S->name : "", S->type);
         else
@@ -176,6 +282,20 @@ static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
                                 if (S->checksum)
                                         StringBuffer_append(B, "<checksum type=\"%s\">%s</checksum>", checksumnames[S->checksum->type], S->inf->priv.file.cs_sum);
                         }
+                        if (S->type == TYPE_DIRECTORY && S->treelist)
+                                StringBuffer_append(B,
+                                        "<tree>"
+                                        "<files>%llu</files>"
+                                        "<size>%llu</size>"
+                                        "<oldest>%ld</oldest>"
+                                        "<newest>%ld</newest>"
+                                        "<directories>%lu</directories>"
+                                        "</tree>",
+                                        S->inf->priv.directory.tree.files,
+                                        S->inf->priv.directory.tree.size,
+                                        (long)S->inf->priv.directory.tree.oldest,
+                                        (long)S->inf->priv.directory.tree.newest,
+                                        S->inf->priv.directory.directories);
                         if (S->type == TYPE_FILESYSTEM) {
                                 StringBuffer_append(B,
                                         "<flags>%d</flags>"
@@ -228,6 +348,20 @@ static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
                                                 S->inf->priv.process.total_mem_kbyte,
                                                 S->inf->priv.process.cpu_percent/10.0,
                                                 S->inf->priv.process.total_cpu_percent/10.0);
+                                        if (S->cgroup)
+                                                StringBuffer_append(B,
+                                                        "<cgroup>"
+                                                        "<path>%s</path>"
+                                                        "<pids>%d</pids>"
+                                                        "<cpuusec>%llu</cpuusec>"
+                                                        "<ioreadbytes>%llu</ioreadbytes>"
+                                                        "<iowritebytes>%llu</iowritebytes>"
+                                                        "</cgroup>",
+                                                        S->cgroup,
+                                                        S->inf->priv.process.cgroup_pids,
+                                                        S->inf->priv.process.cgroup_cpu_usec,
+                                                        S->inf->priv.process.cgroup_io_rbytes,
+                                                        S->inf->priv.process.cgroup_io_wbytes);
                                 }
                         }
                         if (S->type == TYPE_HOST && S->icmplist) {
@@ -244,7 +378,7 @@ static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
                         if ((S->type == TYPE_HOST || S->type == TYPE_PROCESS) && S-> portlist) {
                                 Port_T p;
                                 for (p = S->portlist; p; p = p->next) {
-                                        if (p->family == AF_INET)
+                                        if (p->family == AF_INET) {
                                                 StringBuffer_append(B,
                                                   	"<port>"
                                                   	"<hostname>%s</hostname>"
@@ -252,24 +386,27 @@ static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
                                                   	"<request>%s</request>"
                                                   	"<protocol>%s</protocol>"
                                                   	"<type>%s</type>"
-                                                  	"<responsetime>%.3f</responsetime>"
-                                                  	"</port>",
+                                                  	"<responsetime>%.3f</responsetime>",
                                                   	p->hostname?p->hostname:"",
                                                   	p->port,
                                                   	p->request?p->request:"",
                                                   	p->protocol->name?p->protocol->name:"",
                                                   	Util_portTypeDescription(p),
                                                   	p->is_available?p->response:-1.);
-                                        else if (p->family == AF_UNIX)
+                                                status_timing(p, B);
+                                                StringBuffer_append(B, "</port>");
+                                        } else if (p->family == AF_UNIX) {
                                                 StringBuffer_append(B,
                                                   	"<unix>"
                                                 	"<path>%s</path>"
                                                 	"<protocol>%s</protocol>"
-                                                	"<responsetime>%.3f</responsetime>"
-                                                	"</unix>",
+                                                	"<responsetime>%.3f</responsetime>",
                                                 	p->pathname?p->pathname:"",
                                                 	p->protocol->name?p->protocol->name:"",
                                                 	p->is_available?p->response:-1.);
+                                                status_timing(p, B);
+                                                StringBuffer_append(B, "</unix>");
+                                        }
                                 }
                         }
                         if (S->type == TYPE_SYSTEM && Run.doprocess) {
@@ -282,10 +419,25 @@ static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
                                         "</load>"
                                         "<cpu>"
                                         "<user>%.1f</user>"
-                                        "<system>%.1f</system>"
+                                        "<system>%.1f</system>",
+                                        si.loadavg[0],
+                                        si.loadavg[1],
+                                        si.loadavg[2],
+                                        si.total_cpu_user_percent > 0 ? si.total_cpu_user_percent/10. : 0,
+                                        si.total_cpu_syst_percent > 0 ? si.total_cpu_syst_percent/10. : 0);
 #ifdef HAVE_CPU_WAIT
-                                        "<wait>%.1f</wait>"
+                                StringBuffer_append(B, "<wait>%.1f</wait>", si.total_cpu_wait_percent > 0 ? si.total_cpu_wait_percent/10. : 0);
 #endif
+                                if (si.total_cpu_steal_percent >= 0)
+                                        StringBuffer_append(B, "<steal>%.1f</steal>", si.total_cpu_steal_percent/10.);
+                                if (si.total_cpu_irq_percent >= 0)
+                                        StringBuffer_append(B, "<irq>%.1f</irq>", si.total_cpu_irq_percent/10.);
+                                if (si.cpu_percent) {
+                                        for (int i = 0; i < si.cpus; i++)
+                                                if (si.cpu_percent[i] >= 0)
+                                                        StringBuffer_append(B, "<core id=\"%d\">%.1f</core>", i, si.cpu_percent[i]/10.);
+                                }
+                                StringBuffer_append(B,
                                         "</cpu>"
                                         "<memory>"
                                         "<percent>%.1f</percent>"
@@ -294,20 +446,19 @@ static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
                                         "<swap>"
                                         "<percent>%.1f</percent>"
                                         "<kilobyte>%ld</kilobyte>"
-                                        "</swap>"
-                                        "</system>",
-                                        systeminfo.loadavg[0],
-                                        systeminfo.loadavg[1],
-                                        systeminfo.loadavg[2],
-                                        systeminfo.total_cpu_user_percent > 0 ? systeminfo.total_cpu_user_percent/10. : 0,
-                                        systeminfo.total_cpu_syst_percent > 0 ? systeminfo.total_cpu_syst_percent/10. : 0,
-#ifdef HAVE_CPU_WAIT
-                                        systeminfo.total_cpu_wait_percent > 0 ? systeminfo.total_cpu_wait_percent/10. : 0,
-#endif
-                                        systeminfo.total_mem_percent/10.,
-                                        systeminfo.total_mem_kbyte,
-                                        systeminfo.total_swap_percent/10.,
-                                        systeminfo.total_swap_kbyte);
+                                        "</swap>",
+                                        si.total_mem_percent/10.,
+                                        si.total_mem_kbyte,
+                                        si.total_swap_percent/10.,
+                                        si.total_swap_kbyte);
+                                if (si.pressure_cpu.some_avg10 >= 0 || si.pressure_memory.some_avg10 >= 0 || si.pressure_io.some_avg10 >= 0) {
+                                        StringBuffer_append(B, "<pressure>");
+                                        status_pressure(B, "cpu", &si.pressure_cpu);
+                                        status_pressure(B, "memory", &si.pressure_memory);
+                                        status_pressure(B, "io", &si.pressure_io);
+                                        StringBuffer_append(B, "</pressure>");
+                                }
+                                StringBuffer_append(B, "</system>");
                         }
                         if (S->type == TYPE_PROGRAM && S->program->started) {
                                 StringBuffer_append(B,
@@ -319,8 +470,11 @@ static void status_service(Service_T S, StringBuffer_T B, short L, int V) {
                                         S->program->exitStatus);
                         }
                 }
+                status_latency(live, B);
         }
         StringBuffer_append(B, "</service>");
+        FREE(si.cpu_percent);
+        Snapshot_free(&snapshot);
 }
 
 
@@ -409,3 +563,100 @@ void status_xml(StringBuffer_T B, Event_T E, short L, int V, const char *myip) {
         document_foot(B);
 }
 
+
+
+/**
+ * Get a XML formated metrics history of services. The sample times are
+ * listed once per service, each metric lists its values oldest first and
+ * aligned to the end of the times list (a metric may have fewer samples,
+ * for example if the process was restarted).
+ * @param B StringBuffer object
+ * @param service Name of the service or NULL for all services
+ */
+void history_xml(StringBuffer_T B, const char *service) {
+        long long values[HISTORY_SIZE];
+        time_t timestamps[HISTORY_SIZE];
+
+        StringBuffer_append(B, "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?><history poll=\"%d\" size=\"%d\">", Run.polltime, HISTORY_SIZE);
+        for (Service_T S = servicelist_conf; S; S = S->next_conf) {
+                if (service && ! IS(service, S->name))
+                        continue;
+                /* The validator appends to the history meanwhile, work on a copy */
+                History_T h = History_copy(S);
+                if (! h)
+                        continue;
+                StringBuffer_append(B, "<service name=\"%s\" type=\"%d\">", S->name, S->type);
+                int n = 0, longest = 0;
+                for (int m = 0; m < HISTORY_METRICS; m++) {
+                        int k = History_samples(h, m, values, NULL, HISTORY_SIZE);
+                        if (k > n) {
+                                n = k;
+                                longest = m;
+                        }
+                }
+                History_samples(h, longest, values, timestamps, n);
+                StringBuffer_append(B, "<timestamps>");
+                for (int i = 0; i < n; i++)
+                        StringBuffer_append(B, i ? " %lld" : "%lld", (long long)timestamps[i]);
+                StringBuffer_append(B, "</timestamps>");
+                for (int m = 0; m < HISTORY_METRICS; m++) {
+                        int k = History_samples(h, m, values, NULL, HISTORY_SIZE);
+                        if (k == 0)
+                                continue;
+                        StringBuffer_append(B, "<metric name=\"%s\">", historymetricnames[m]);
+                        for (int i = 0; i < k; i++)
+                                StringBuffer_append(B, i ? " %lld" : "%lld", values[i]);
+                        StringBuffer_append(B, "</metric>");
+                }
+                StringBuffer_append(B, "</service>");
+                History_free(&h);
+        }
+        StringBuffer_append(B, "</history>");
+}
+
+
+/**
+ * Get a XML formated check latency profile: the cycle phases, the checks
+ * per service type, the tests of all services and the tests of each
+ * service. Durations are in microseconds.
+ * @param B StringBuffer object
+ * @param service Name of the service or NULL for all services
+ */
+void profile_xml(StringBuffer_T B, const char *service) {
+        unsigned long long cycles, overruns;
+
+        Profile_cycles(&cycles, &overruns);
+        StringBuffer_append(B, "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?><profile poll=\"%d\" cycles=\"%llu\" overruns=\"%llu\" subbuckets=\"%d\">", Run.polltime, cycles, overruns, PROFILE_SUBBUCKETS);
+        if (! service) {
+                struct myhistogram h;
+                for (int i = 0; i < Profile_Phases; i++)
+                        if (Profile_phase(i, &h))
+                                profile_histogram(B, "phase", profilephasenames[i], &h);
+                for (int i = 0; i <= TYPE_PROGRAM; i++)
+                        if (Profile_type(i, &h))
+                                profile_histogram(B, "type", servicetypes[i], &h);
+                for (int i = 0; i < Profile_Tests; i++)
+                        if (Profile_test(NULL, i, &h))
+                                profile_histogram(B, "test", profiletestnames[i], &h);
+        }
+        for (Service_T S = servicelist_conf; S; S = S->next_conf) {
+                struct myhistogram h[Profile_Tests];
+                int tests = 0;
+                if (service && ! IS(service, S->name))
+                        continue;
+                for (int i = 0; i < Profile_Tests; i++)
+                        if (Profile_test(S, i, &h[i]))
+                                tests++;
+                        else
+                                h[i].count = 0;
+                if (! tests)
+                        continue;
+                StringBuffer_append(B, "<service name=\"%s\" type=\"%d\">", S->name, S->type);
+                for (int i = 0; i < Profile_Tests; i++)
+                        if (h[i].count)
+                                profile_histogram(B, "test", profiletestnames[i], &h[i]);
+                StringBuffer_append(B, "</service>");
+        }
+        StringBuffer_append(B, "</profile>");
+}
+
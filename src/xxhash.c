@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+/*
+ * XXH64, the 64 bit variant of the xxHash non-cryptographic hash by Yann
+ * Collet, with seed 0. The digest is stored big-endian, the same as the
+ * canonical form printed by xxhsum.
+ */
+
+#include "config.h"
+
+#ifdef HAVE_STRING_H
+#include <string.h>
+#endif
+
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+
+#include "xxhash.h"
+
+#define PRIME1 0x9E3779B185EBCA87ULL
+#define PRIME2 0xC2B2AE3D27D4EB4FULL
+#define PRIME3 0x165667B19E3779F9ULL
+#define PRIME4 0x85EBCA77C2B2AE63ULL
+#define PRIME5 0x27D4EB2F165667C5ULL
+
+#define rol(value, bits) (((value) << (bits)) | ((value) >> (64 - (bits))))
+
+
+static unsigned long long read64(const unsigned char *p) {
+        return (unsigned long long)p[0] | ((unsigned long long)p[1] << 8) | ((unsigned long long)p[2] << 16) | ((unsigned long long)p[3] << 24) |
+               ((unsigned long long)p[4] << 32) | ((unsigned long long)p[5] << 40) | ((unsigned long long)p[6] << 48) | ((unsigned long long)p[7] << 56);
+}
+
+
+static unsigned long long read32(const unsigned char *p) {
+        return (unsigned long long)p[0] | ((unsigned long long)p[1] << 8) | ((unsigned long long)p[2] << 16) | ((unsigned long long)p[3] << 24);
+}
+
+
+static unsigned long long xxh64_round(unsigned long long acc, unsigned long long input) {
+        acc += input * PRIME2;
+        acc = rol(acc, 31);
+        return acc * PRIME1;
+}
+
+
+static unsigned long long xxh64_merge(unsigned long long acc, unsigned long long value) {
+        acc ^= xxh64_round(0, value);
+        return acc * PRIME1 + PRIME4;
+}
+
+
+/* Process 32 byte stripes, returns the number of bytes consumed */
+static size_t xxh64_stripes(unsigned long long v[4], const unsigned char *data, size_t len) {
+        size_t i;
+
+        for (i = 0; i + 32 <= len; i += 32) {
+                v[0] = xxh64_round(v[0], read64(data + i));
+                v[1] = xxh64_round(v[1], read64(data + i + 8));
+                v[2] = xxh64_round(v[2], read64(data + i + 16));
+                v[3] = xxh64_round(v[3], read64(data + i + 24));
+        }
+        return i;
+}
+
+
+/* Initialize new context */
+void xxh64_init(xxh64_context_t *context) {
+        context->total = 0ULL;
+        context->v[0] = PRIME1 + PRIME2;
+        context->v[1] = PRIME2;
+        context->v[2] = 0ULL;
+        context->v[3] = -PRIME1;
+        context->size = 0;
+}
+
+
+/* Run your data through this. */
+void xxh64_append(xxh64_context_t *context, const unsigned char *data, const size_t len) {
+        size_t i = 0;
+
+        context->total += len;
+        if (context->size + len < 32) {
+                memcpy(context->buffer + context->size, data, len);
+                context->size += (unsigned int)len;
+                return;
+        }
+        if (context->size) {
+                i = 32 - context->size;
+                memcpy(context->buffer + context->size, data, i);
+                xxh64_stripes(context->v, context->buffer, 32);
+                context->size = 0;
+        }
+        i += xxh64_stripes(context->v, data + i, len - i);
+        memcpy(context->buffer, data + i, len - i);
+        context->size = (unsigned int)(len - i);
+}
+
+
+/* Return the message digest. */
+void xxh64_finish(xxh64_context_t *context, unsigned char digest[XXH64_DIGEST_SIZE]) {
+        unsigned long long h;
+        const unsigned char *p = context->buffer, *end = context->buffer + context->size;
+        int i;
+
+        if (context->total >= 32) {
+                h = rol(context->v[0], 1) + rol(context->v[1], 7) + rol(context->v[2], 12) + rol(context->v[3], 18);
+                for (i = 0; i < 4; i++)
+                        h = xxh64_merge(h, context->v[i]);
+        } else {
+                h = PRIME5;
+        }
+        h += context->total;
+        for (; p + 8 <= end; p += 8) {
+                h ^= xxh64_round(0, read64(p));
+                h = rol(h, 27) * PRIME1 + PRIME4;
+        }
+        if (p + 4 <= end) {
+                h ^= read32(p) * PRIME1;
+                h = rol(h, 23) * PRIME2 + PRIME3;
+                p += 4;
+        }
+        for (; p < end; p++) {
+                h ^= *p * PRIME5;
+                h = rol(h, 11) * PRIME1;
+        }
+        h ^= h >> 33;
+        h *= PRIME2;
+        h ^= h >> 29;
+        h *= PRIME3;
+        h ^= h >> 32;
+        for (i = 0; i < XXH64_DIGEST_SIZE; i++)
+                digest[i] = (unsigned char)(h >> ((7 - i) * 8));
+        memset(context, 0, sizeof(*context));
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) Tildeslash Ltd. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License version 3.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, as a special exception, the copyright holders give
+ * permission to link the code of portions of this program with the
+ * OpenSSL library under certain conditions as described in each
+ * individual source file, and distribute linked combinations
+ * including the two.
+ *
+ * You must obey the GNU Affero General Public License in all respects
+ * for all of the code used other than OpenSSL.  
+ */
+
+#ifndef XXHASH_H
+#define XXHASH_H
+
+
+#define XXH64_DIGEST_SIZE 8
+
+typedef struct {
+    unsigned long long total;
+    unsigned long long v[4];
+    unsigned char buffer[32];
+    unsigned int size;
+} xxh64_context_t;
+
+void xxh64_init(xxh64_context_t *context);
+void xxh64_append(xxh64_context_t *context, const unsigned char *data, const size_t len);
+void xxh64_finish(xxh64_context_t *context, unsigned char digest[XXH64_DIGEST_SIZE]);
+
+
+#endif
@@ -1,22 +1,23 @@
 #include <config.h>
-/* A Bison parser, made by GNU Bison 2.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2011 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -27,13 +28,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -41,11 +46,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -59,14 +64,10 @@
 /* Pull parsers.  */
 #define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
 
 
 
-/* Copy the first part of user declarations.  */
-
-/* Line 268 of yacc.c  */
+/* First part of user prologue.  */
 #line 26 "src/p.y"
 
 
@@ -160,6 +161,7 @@
 #include "process.h"
 #include "ssl.h"
 #include "device.h"
+#include "digest.h"
 
 // libmonit
 #include "io/File.h"
@@ -220,14 +222,30 @@
   static struct mychecksum checksumset;
   static struct mytimestamp timestampset;
   static struct myactionrate actionrateset;
+  static struct mytrend trendset;
+  static struct mytiming timingset;
+  static struct mytree treeset;
+  static double trendvalue = 0.;
+  static int    trendunit = 0;
   static struct IHavePrecedence ihp = {FALSE, FALSE, FALSE};
   static struct myrate rate1 = {1, 1};
   static struct myrate rate2 = {1, 1};
   static char * htpasswd_file = NULL;
   static int    digesttype = DIGEST_CLEARTEXT;
+  static struct myserviceindex {
+          Service_T *table;
+          int size;
+          int count;
+  } serviceindex;
 
 #define BITMAP_MAX (sizeof(long long) * 8)
 
+/* Trend limit units beside the UNIT_* memory units */
+#define TRENDUNIT_NONE         0
+#define TRENDUNIT_PERCENT     -1
+#define TRENDUNIT_MILLISECOND -2
+#define TRENDUNIT_SECOND      -3
+
 
 /* -------------------------------------------------------------- Prototypes */
 
@@ -236,10 +254,15 @@
   static void  addmail(char *, Mail_T, Mail_T *);
   static Service_T createservice(int, char *, char *, int (*)(Service_T));
   static void  addservice(Service_T);
+  static void  indexservice(Service_T);
+  static Service_T getservice(const char *);
   static void  adddependant(char *);
   static void  addservicegroup(char *);
   static void  addport(Port_T);
   static void  addresource(Resource_T);
+  static void  addtrend(Trend_T);
+  static void  addtiming(Timing_T);
+  static void  addtree(Tree_T);
   static void  addtimestamp(Timestamp_T, int);
   static void  addactionrate(ActionRate_T);
   static void  addsize(Size_T);
@@ -271,12 +294,16 @@
   static void  seteventaction(EventAction_T *, int, int);
   static void  prepare_urlrequest(URL_T U);
   static void  seturlrequest(int, char *);
+  static char *heapstring(char *);
   static void  setlogfile(char *);
   static void  setpidfile(char *);
   static void  reset_mailset();
   static void  reset_mailserverset();
   static void  reset_portset();
   static void  reset_resourceset();
+  static void  reset_trendset();
+  static void  reset_timingset();
+  static void  reset_treeset();
   static void  reset_timestampset();
   static void  reset_actionrateset();
   static void  reset_sizeset();
@@ -300,498 +327,540 @@
   static int verifyMaxForward(int);  
 
 
+#line 330 "src/y.tab.c"
 
-/* Line 268 of yacc.c  */
-#line 305 "src/y.tab.c"
-
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 1
-#endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
-
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     IF = 258,
-     ELSE = 259,
-     THEN = 260,
-     OR = 261,
-     FAILED = 262,
-     SET = 263,
-     LOGFILE = 264,
-     FACILITY = 265,
-     DAEMON = 266,
-     SYSLOG = 267,
-     MAILSERVER = 268,
-     HTTPD = 269,
-     ALLOW = 270,
-     ADDRESS = 271,
-     INIT = 272,
-     READONLY = 273,
-     CLEARTEXT = 274,
-     MD5HASH = 275,
-     SHA1HASH = 276,
-     CRYPT = 277,
-     DELAY = 278,
-     PEMFILE = 279,
-     ENABLE = 280,
-     DISABLE = 281,
-     HTTPDSSL = 282,
-     CLIENTPEMFILE = 283,
-     ALLOWSELFCERTIFICATION = 284,
-     IDFILE = 285,
-     STATEFILE = 286,
-     SEND = 287,
-     EXPECT = 288,
-     EXPECTBUFFER = 289,
-     CYCLE = 290,
-     COUNT = 291,
-     REMINDER = 292,
-     PIDFILE = 293,
-     START = 294,
-     STOP = 295,
-     PATHTOK = 296,
-     HOST = 297,
-     HOSTNAME = 298,
-     PORT = 299,
-     TYPE = 300,
-     UDP = 301,
-     TCP = 302,
-     TCPSSL = 303,
-     PROTOCOL = 304,
-     CONNECTION = 305,
-     ALERT = 306,
-     NOALERT = 307,
-     MAILFORMAT = 308,
-     UNIXSOCKET = 309,
-     SIGNATURE = 310,
-     TIMEOUT = 311,
-     RETRY = 312,
-     RESTART = 313,
-     CHECKSUM = 314,
-     EVERY = 315,
-     NOTEVERY = 316,
-     DEFAULT = 317,
-     HTTP = 318,
-     APACHESTATUS = 319,
-     FTP = 320,
-     SMTP = 321,
-     POP = 322,
-     IMAP = 323,
-     CLAMAV = 324,
-     NNTP = 325,
-     NTP3 = 326,
-     MYSQL = 327,
-     DNS = 328,
-     SSH = 329,
-     DWP = 330,
-     LDAP2 = 331,
-     LDAP3 = 332,
-     RDATE = 333,
-     RSYNC = 334,
-     TNS = 335,
-     PGSQL = 336,
-     POSTFIXPOLICY = 337,
-     SIP = 338,
-     LMTP = 339,
-     GPS = 340,
-     RADIUS = 341,
-     MEMCACHE = 342,
-     STRING = 343,
-     PATH = 344,
-     MAILADDR = 345,
-     MAILFROM = 346,
-     MAILREPLYTO = 347,
-     MAILSUBJECT = 348,
-     MAILBODY = 349,
-     SERVICENAME = 350,
-     STRINGNAME = 351,
-     NUMBER = 352,
-     PERCENT = 353,
-     LOGLIMIT = 354,
-     CLOSELIMIT = 355,
-     DNSLIMIT = 356,
-     KEEPALIVELIMIT = 357,
-     REPLYLIMIT = 358,
-     REQUESTLIMIT = 359,
-     STARTLIMIT = 360,
-     WAITLIMIT = 361,
-     GRACEFULLIMIT = 362,
-     CLEANUPLIMIT = 363,
-     REAL = 364,
-     CHECKPROC = 365,
-     CHECKFILESYS = 366,
-     CHECKFILE = 367,
-     CHECKDIR = 368,
-     CHECKHOST = 369,
-     CHECKSYSTEM = 370,
-     CHECKFIFO = 371,
-     CHECKPROGRAM = 372,
-     CHILDREN = 373,
-     SYSTEM = 374,
-     STATUS = 375,
-     RESOURCE = 376,
-     MEMORY = 377,
-     TOTALMEMORY = 378,
-     LOADAVG1 = 379,
-     LOADAVG5 = 380,
-     LOADAVG15 = 381,
-     SWAP = 382,
-     MODE = 383,
-     ACTIVE = 384,
-     PASSIVE = 385,
-     MANUAL = 386,
-     CPU = 387,
-     TOTALCPU = 388,
-     CPUUSER = 389,
-     CPUSYSTEM = 390,
-     CPUWAIT = 391,
-     GROUP = 392,
-     REQUEST = 393,
-     DEPENDS = 394,
-     BASEDIR = 395,
-     SLOT = 396,
-     EVENTQUEUE = 397,
-     SECRET = 398,
-     HOSTHEADER = 399,
-     UID = 400,
-     GID = 401,
-     MMONIT = 402,
-     INSTANCE = 403,
-     USERNAME = 404,
-     PASSWORD = 405,
-     TIMESTAMP = 406,
-     CHANGED = 407,
-     SECOND = 408,
-     MINUTE = 409,
-     HOUR = 410,
-     DAY = 411,
-     SSLAUTO = 412,
-     SSLV2 = 413,
-     SSLV3 = 414,
-     TLSV1 = 415,
-     CERTMD5 = 416,
-     BYTE = 417,
-     KILOBYTE = 418,
-     MEGABYTE = 419,
-     GIGABYTE = 420,
-     INODE = 421,
-     SPACE = 422,
-     PERMISSION = 423,
-     SIZE = 424,
-     MATCH = 425,
-     NOT = 426,
-     IGNORE = 427,
-     ACTION = 428,
-     UPTIME = 429,
-     EXEC = 430,
-     UNMONITOR = 431,
-     ICMP = 432,
-     ICMPECHO = 433,
-     NONEXIST = 434,
-     EXIST = 435,
-     INVALID = 436,
-     DATA = 437,
-     RECOVERED = 438,
-     PASSED = 439,
-     SUCCEEDED = 440,
-     URL = 441,
-     CONTENT = 442,
-     PID = 443,
-     PPID = 444,
-     FSFLAG = 445,
-     REGISTER = 446,
-     CREDENTIALS = 447,
-     URLOBJECT = 448,
-     TARGET = 449,
-     TIMESPEC = 450,
-     MAXFORWARD = 451,
-     FIPS = 452,
-     NOTEQUAL = 453,
-     EQUAL = 454,
-     LESS = 455,
-     GREATER = 456
-   };
-#endif
-/* Tokens.  */
-#define IF 258
-#define ELSE 259
-#define THEN 260
-#define OR 261
-#define FAILED 262
-#define SET 263
-#define LOGFILE 264
-#define FACILITY 265
-#define DAEMON 266
-#define SYSLOG 267
-#define MAILSERVER 268
-#define HTTPD 269
-#define ALLOW 270
-#define ADDRESS 271
-#define INIT 272
-#define READONLY 273
-#define CLEARTEXT 274
-#define MD5HASH 275
-#define SHA1HASH 276
-#define CRYPT 277
-#define DELAY 278
-#define PEMFILE 279
-#define ENABLE 280
-#define DISABLE 281
-#define HTTPDSSL 282
-#define CLIENTPEMFILE 283
-#define ALLOWSELFCERTIFICATION 284
-#define IDFILE 285
-#define STATEFILE 286
-#define SEND 287
-#define EXPECT 288
-#define EXPECTBUFFER 289
-#define CYCLE 290
-#define COUNT 291
-#define REMINDER 292
-#define PIDFILE 293
-#define START 294
-#define STOP 295
-#define PATHTOK 296
-#define HOST 297
-#define HOSTNAME 298
-#define PORT 299
-#define TYPE 300
-#define UDP 301
-#define TCP 302
-#define TCPSSL 303
-#define PROTOCOL 304
-#define CONNECTION 305
-#define ALERT 306
-#define NOALERT 307
-#define MAILFORMAT 308
-#define UNIXSOCKET 309
-#define SIGNATURE 310
-#define TIMEOUT 311
-#define RETRY 312
-#define RESTART 313
-#define CHECKSUM 314
-#define EVERY 315
-#define NOTEVERY 316
-#define DEFAULT 317
-#define HTTP 318
-#define APACHESTATUS 319
-#define FTP 320
-#define SMTP 321
-#define POP 322
-#define IMAP 323
-#define CLAMAV 324
-#define NNTP 325
-#define NTP3 326
-#define MYSQL 327
-#define DNS 328
-#define SSH 329
-#define DWP 330
-#define LDAP2 331
-#define LDAP3 332
-#define RDATE 333
-#define RSYNC 334
-#define TNS 335
-#define PGSQL 336
-#define POSTFIXPOLICY 337
-#define SIP 338
-#define LMTP 339
-#define GPS 340
-#define RADIUS 341
-#define MEMCACHE 342
-#define STRING 343
-#define PATH 344
-#define MAILADDR 345
-#define MAILFROM 346
-#define MAILREPLYTO 347
-#define MAILSUBJECT 348
-#define MAILBODY 349
-#define SERVICENAME 350
-#define STRINGNAME 351
-#define NUMBER 352
-#define PERCENT 353
-#define LOGLIMIT 354
-#define CLOSELIMIT 355
-#define DNSLIMIT 356
-#define KEEPALIVELIMIT 357
-#define REPLYLIMIT 358
-#define REQUESTLIMIT 359
-#define STARTLIMIT 360
-#define WAITLIMIT 361
-#define GRACEFULLIMIT 362
-#define CLEANUPLIMIT 363
-#define REAL 364
-#define CHECKPROC 365
-#define CHECKFILESYS 366
-#define CHECKFILE 367
-#define CHECKDIR 368
-#define CHECKHOST 369
-#define CHECKSYSTEM 370
-#define CHECKFIFO 371
-#define CHECKPROGRAM 372
-#define CHILDREN 373
-#define SYSTEM 374
-#define STATUS 375
-#define RESOURCE 376
-#define MEMORY 377
-#define TOTALMEMORY 378
-#define LOADAVG1 379
-#define LOADAVG5 380
-#define LOADAVG15 381
-#define SWAP 382
-#define MODE 383
-#define ACTIVE 384
-#define PASSIVE 385
-#define MANUAL 386
-#define CPU 387
-#define TOTALCPU 388
-#define CPUUSER 389
-#define CPUSYSTEM 390
-#define CPUWAIT 391
-#define GROUP 392
-#define REQUEST 393
-#define DEPENDS 394
-#define BASEDIR 395
-#define SLOT 396
-#define EVENTQUEUE 397
-#define SECRET 398
-#define HOSTHEADER 399
-#define UID 400
-#define GID 401
-#define MMONIT 402
-#define INSTANCE 403
-#define USERNAME 404
-#define PASSWORD 405
-#define TIMESTAMP 406
-#define CHANGED 407
-#define SECOND 408
-#define MINUTE 409
-#define HOUR 410
-#define DAY 411
-#define SSLAUTO 412
-#define SSLV2 413
-#define SSLV3 414
-#define TLSV1 415
-#define CERTMD5 416
-#define BYTE 417
-#define KILOBYTE 418
-#define MEGABYTE 419
-#define GIGABYTE 420
-#define INODE 421
-#define SPACE 422
-#define PERMISSION 423
-#define SIZE 424
-#define MATCH 425
-#define NOT 426
-#define IGNORE 427
-#define ACTION 428
-#define UPTIME 429
-#define EXEC 430
-#define UNMONITOR 431
-#define ICMP 432
-#define ICMPECHO 433
-#define NONEXIST 434
-#define EXIST 435
-#define INVALID 436
-#define DATA 437
-#define RECOVERED 438
-#define PASSED 439
-#define SUCCEEDED 440
-#define URL 441
-#define CONTENT 442
-#define PID 443
-#define PPID 444
-#define FSFLAG 445
-#define REGISTER 446
-#define CREDENTIALS 447
-#define URLOBJECT 448
-#define TARGET 449
-#define TIMESPEC 450
-#define MAXFORWARD 451
-#define FIPS 452
-#define NOTEQUAL 453
-#define EQUAL 454
-#define LESS 455
-#define GREATER 456
-
-
-
-
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
+#include "tokens.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IF = 3,                         /* IF  */
+  YYSYMBOL_ELSE = 4,                       /* ELSE  */
+  YYSYMBOL_THEN = 5,                       /* THEN  */
+  YYSYMBOL_OR = 6,                         /* OR  */
+  YYSYMBOL_FAILED = 7,                     /* FAILED  */
+  YYSYMBOL_SET = 8,                        /* SET  */
+  YYSYMBOL_LOGFILE = 9,                    /* LOGFILE  */
+  YYSYMBOL_FACILITY = 10,                  /* FACILITY  */
+  YYSYMBOL_DAEMON = 11,                    /* DAEMON  */
+  YYSYMBOL_SYSLOG = 12,                    /* SYSLOG  */
+  YYSYMBOL_MAILSERVER = 13,                /* MAILSERVER  */
+  YYSYMBOL_HTTPD = 14,                     /* HTTPD  */
+  YYSYMBOL_ALLOW = 15,                     /* ALLOW  */
+  YYSYMBOL_ADDRESS = 16,                   /* ADDRESS  */
+  YYSYMBOL_INIT = 17,                      /* INIT  */
+  YYSYMBOL_READONLY = 18,                  /* READONLY  */
+  YYSYMBOL_CLEARTEXT = 19,                 /* CLEARTEXT  */
+  YYSYMBOL_MD5HASH = 20,                   /* MD5HASH  */
+  YYSYMBOL_SHA1HASH = 21,                  /* SHA1HASH  */
+  YYSYMBOL_SHA256HASH = 22,                /* SHA256HASH  */
+  YYSYMBOL_XXH64HASH = 23,                 /* XXH64HASH  */
+  YYSYMBOL_CRYPT = 24,                     /* CRYPT  */
+  YYSYMBOL_DELAY = 25,                     /* DELAY  */
+  YYSYMBOL_PEMFILE = 26,                   /* PEMFILE  */
+  YYSYMBOL_ENABLE = 27,                    /* ENABLE  */
+  YYSYMBOL_DISABLE = 28,                   /* DISABLE  */
+  YYSYMBOL_HTTPDSSL = 29,                  /* HTTPDSSL  */
+  YYSYMBOL_CLIENTPEMFILE = 30,             /* CLIENTPEMFILE  */
+  YYSYMBOL_ALLOWSELFCERTIFICATION = 31,    /* ALLOWSELFCERTIFICATION  */
+  YYSYMBOL_IDFILE = 32,                    /* IDFILE  */
+  YYSYMBOL_STATEFILE = 33,                 /* STATEFILE  */
+  YYSYMBOL_SEND = 34,                      /* SEND  */
+  YYSYMBOL_EXPECT = 35,                    /* EXPECT  */
+  YYSYMBOL_EXPECTBUFFER = 36,              /* EXPECTBUFFER  */
+  YYSYMBOL_CYCLE = 37,                     /* CYCLE  */
+  YYSYMBOL_COUNT = 38,                     /* COUNT  */
+  YYSYMBOL_REMINDER = 39,                  /* REMINDER  */
+  YYSYMBOL_PIDFILE = 40,                   /* PIDFILE  */
+  YYSYMBOL_START = 41,                     /* START  */
+  YYSYMBOL_STOP = 42,                      /* STOP  */
+  YYSYMBOL_PATHTOK = 43,                   /* PATHTOK  */
+  YYSYMBOL_HOST = 44,                      /* HOST  */
+  YYSYMBOL_HOSTNAME = 45,                  /* HOSTNAME  */
+  YYSYMBOL_PORT = 46,                      /* PORT  */
+  YYSYMBOL_TYPE = 47,                      /* TYPE  */
+  YYSYMBOL_UDP = 48,                       /* UDP  */
+  YYSYMBOL_TCP = 49,                       /* TCP  */
+  YYSYMBOL_TCPSSL = 50,                    /* TCPSSL  */
+  YYSYMBOL_PROTOCOL = 51,                  /* PROTOCOL  */
+  YYSYMBOL_CONNECTION = 52,                /* CONNECTION  */
+  YYSYMBOL_ALERT = 53,                     /* ALERT  */
+  YYSYMBOL_NOALERT = 54,                   /* NOALERT  */
+  YYSYMBOL_MAILFORMAT = 55,                /* MAILFORMAT  */
+  YYSYMBOL_UNIXSOCKET = 56,                /* UNIXSOCKET  */
+  YYSYMBOL_SIGNATURE = 57,                 /* SIGNATURE  */
+  YYSYMBOL_TIMEOUT = 58,                   /* TIMEOUT  */
+  YYSYMBOL_RETRY = 59,                     /* RETRY  */
+  YYSYMBOL_RESTART = 60,                   /* RESTART  */
+  YYSYMBOL_CHECKSUM = 61,                  /* CHECKSUM  */
+  YYSYMBOL_EVERY = 62,                     /* EVERY  */
+  YYSYMBOL_NOTEVERY = 63,                  /* NOTEVERY  */
+  YYSYMBOL_DEFAULT = 64,                   /* DEFAULT  */
+  YYSYMBOL_HTTP = 65,                      /* HTTP  */
+  YYSYMBOL_APACHESTATUS = 66,              /* APACHESTATUS  */
+  YYSYMBOL_FTP = 67,                       /* FTP  */
+  YYSYMBOL_SMTP = 68,                      /* SMTP  */
+  YYSYMBOL_POP = 69,                       /* POP  */
+  YYSYMBOL_IMAP = 70,                      /* IMAP  */
+  YYSYMBOL_CLAMAV = 71,                    /* CLAMAV  */
+  YYSYMBOL_NNTP = 72,                      /* NNTP  */
+  YYSYMBOL_NTP3 = 73,                      /* NTP3  */
+  YYSYMBOL_MYSQL = 74,                     /* MYSQL  */
+  YYSYMBOL_DNS = 75,                       /* DNS  */
+  YYSYMBOL_SSH = 76,                       /* SSH  */
+  YYSYMBOL_DWP = 77,                       /* DWP  */
+  YYSYMBOL_LDAP2 = 78,                     /* LDAP2  */
+  YYSYMBOL_LDAP3 = 79,                     /* LDAP3  */
+  YYSYMBOL_RDATE = 80,                     /* RDATE  */
+  YYSYMBOL_RSYNC = 81,                     /* RSYNC  */
+  YYSYMBOL_TNS = 82,                       /* TNS  */
+  YYSYMBOL_PGSQL = 83,                     /* PGSQL  */
+  YYSYMBOL_POSTFIXPOLICY = 84,             /* POSTFIXPOLICY  */
+  YYSYMBOL_SIP = 85,                       /* SIP  */
+  YYSYMBOL_LMTP = 86,                      /* LMTP  */
+  YYSYMBOL_GPS = 87,                       /* GPS  */
+  YYSYMBOL_RADIUS = 88,                    /* RADIUS  */
+  YYSYMBOL_MEMCACHE = 89,                  /* MEMCACHE  */
+  YYSYMBOL_STRING = 90,                    /* STRING  */
+  YYSYMBOL_PATH = 91,                      /* PATH  */
+  YYSYMBOL_MAILADDR = 92,                  /* MAILADDR  */
+  YYSYMBOL_MAILFROM = 93,                  /* MAILFROM  */
+  YYSYMBOL_MAILREPLYTO = 94,               /* MAILREPLYTO  */
+  YYSYMBOL_MAILSUBJECT = 95,               /* MAILSUBJECT  */
+  YYSYMBOL_MAILBODY = 96,                  /* MAILBODY  */
+  YYSYMBOL_SERVICENAME = 97,               /* SERVICENAME  */
+  YYSYMBOL_STRINGNAME = 98,                /* STRINGNAME  */
+  YYSYMBOL_NUMBER = 99,                    /* NUMBER  */
+  YYSYMBOL_PERCENT = 100,                  /* PERCENT  */
+  YYSYMBOL_LOGLIMIT = 101,                 /* LOGLIMIT  */
+  YYSYMBOL_CLOSELIMIT = 102,               /* CLOSELIMIT  */
+  YYSYMBOL_DNSLIMIT = 103,                 /* DNSLIMIT  */
+  YYSYMBOL_KEEPALIVELIMIT = 104,           /* KEEPALIVELIMIT  */
+  YYSYMBOL_REPLYLIMIT = 105,               /* REPLYLIMIT  */
+  YYSYMBOL_REQUESTLIMIT = 106,             /* REQUESTLIMIT  */
+  YYSYMBOL_STARTLIMIT = 107,               /* STARTLIMIT  */
+  YYSYMBOL_WAITLIMIT = 108,                /* WAITLIMIT  */
+  YYSYMBOL_GRACEFULLIMIT = 109,            /* GRACEFULLIMIT  */
+  YYSYMBOL_CLEANUPLIMIT = 110,             /* CLEANUPLIMIT  */
+  YYSYMBOL_REAL = 111,                     /* REAL  */
+  YYSYMBOL_CHECKPROC = 112,                /* CHECKPROC  */
+  YYSYMBOL_CHECKFILESYS = 113,             /* CHECKFILESYS  */
+  YYSYMBOL_CHECKFILE = 114,                /* CHECKFILE  */
+  YYSYMBOL_CHECKDIR = 115,                 /* CHECKDIR  */
+  YYSYMBOL_CHECKHOST = 116,                /* CHECKHOST  */
+  YYSYMBOL_CHECKSYSTEM = 117,              /* CHECKSYSTEM  */
+  YYSYMBOL_CHECKFIFO = 118,                /* CHECKFIFO  */
+  YYSYMBOL_CHECKPROGRAM = 119,             /* CHECKPROGRAM  */
+  YYSYMBOL_CHILDREN = 120,                 /* CHILDREN  */
+  YYSYMBOL_SYSTEM = 121,                   /* SYSTEM  */
+  YYSYMBOL_STATUS = 122,                   /* STATUS  */
+  YYSYMBOL_RESOURCE = 123,                 /* RESOURCE  */
+  YYSYMBOL_MEMORY = 124,                   /* MEMORY  */
+  YYSYMBOL_TOTALMEMORY = 125,              /* TOTALMEMORY  */
+  YYSYMBOL_LOADAVG1 = 126,                 /* LOADAVG1  */
+  YYSYMBOL_LOADAVG5 = 127,                 /* LOADAVG5  */
+  YYSYMBOL_LOADAVG15 = 128,                /* LOADAVG15  */
+  YYSYMBOL_SWAP = 129,                     /* SWAP  */
+  YYSYMBOL_MODE = 130,                     /* MODE  */
+  YYSYMBOL_ACTIVE = 131,                   /* ACTIVE  */
+  YYSYMBOL_PASSIVE = 132,                  /* PASSIVE  */
+  YYSYMBOL_MANUAL = 133,                   /* MANUAL  */
+  YYSYMBOL_CPU = 134,                      /* CPU  */
+  YYSYMBOL_TOTALCPU = 135,                 /* TOTALCPU  */
+  YYSYMBOL_CPUUSER = 136,                  /* CPUUSER  */
+  YYSYMBOL_CPUSYSTEM = 137,                /* CPUSYSTEM  */
+  YYSYMBOL_CPUWAIT = 138,                  /* CPUWAIT  */
+  YYSYMBOL_GROUP = 139,                    /* GROUP  */
+  YYSYMBOL_REQUEST = 140,                  /* REQUEST  */
+  YYSYMBOL_DEPENDS = 141,                  /* DEPENDS  */
+  YYSYMBOL_BASEDIR = 142,                  /* BASEDIR  */
+  YYSYMBOL_SLOT = 143,                     /* SLOT  */
+  YYSYMBOL_EVENTQUEUE = 144,               /* EVENTQUEUE  */
+  YYSYMBOL_SECRET = 145,                   /* SECRET  */
+  YYSYMBOL_HOSTHEADER = 146,               /* HOSTHEADER  */
+  YYSYMBOL_UID = 147,                      /* UID  */
+  YYSYMBOL_GID = 148,                      /* GID  */
+  YYSYMBOL_MMONIT = 149,                   /* MMONIT  */
+  YYSYMBOL_INSTANCE = 150,                 /* INSTANCE  */
+  YYSYMBOL_USERNAME = 151,                 /* USERNAME  */
+  YYSYMBOL_PASSWORD = 152,                 /* PASSWORD  */
+  YYSYMBOL_TIMESTAMP = 153,                /* TIMESTAMP  */
+  YYSYMBOL_CHANGED = 154,                  /* CHANGED  */
+  YYSYMBOL_SECOND = 155,                   /* SECOND  */
+  YYSYMBOL_MINUTE = 156,                   /* MINUTE  */
+  YYSYMBOL_HOUR = 157,                     /* HOUR  */
+  YYSYMBOL_DAY = 158,                      /* DAY  */
+  YYSYMBOL_SSLAUTO = 159,                  /* SSLAUTO  */
+  YYSYMBOL_SSLV2 = 160,                    /* SSLV2  */
+  YYSYMBOL_SSLV3 = 161,                    /* SSLV3  */
+  YYSYMBOL_TLSV1 = 162,                    /* TLSV1  */
+  YYSYMBOL_CERTMD5 = 163,                  /* CERTMD5  */
+  YYSYMBOL_BYTE = 164,                     /* BYTE  */
+  YYSYMBOL_KILOBYTE = 165,                 /* KILOBYTE  */
+  YYSYMBOL_MEGABYTE = 166,                 /* MEGABYTE  */
+  YYSYMBOL_GIGABYTE = 167,                 /* GIGABYTE  */
+  YYSYMBOL_INODE = 168,                    /* INODE  */
+  YYSYMBOL_SPACE = 169,                    /* SPACE  */
+  YYSYMBOL_PERMISSION = 170,               /* PERMISSION  */
+  YYSYMBOL_SIZE = 171,                     /* SIZE  */
+  YYSYMBOL_MATCH = 172,                    /* MATCH  */
+  YYSYMBOL_NOT = 173,                      /* NOT  */
+  YYSYMBOL_IGNORE = 174,                   /* IGNORE  */
+  YYSYMBOL_ACTION = 175,                   /* ACTION  */
+  YYSYMBOL_UPTIME = 176,                   /* UPTIME  */
+  YYSYMBOL_EXEC = 177,                     /* EXEC  */
+  YYSYMBOL_UNMONITOR = 178,                /* UNMONITOR  */
+  YYSYMBOL_ICMP = 179,                     /* ICMP  */
+  YYSYMBOL_ICMPECHO = 180,                 /* ICMPECHO  */
+  YYSYMBOL_NONEXIST = 181,                 /* NONEXIST  */
+  YYSYMBOL_EXIST = 182,                    /* EXIST  */
+  YYSYMBOL_INVALID = 183,                  /* INVALID  */
+  YYSYMBOL_DATA = 184,                     /* DATA  */
+  YYSYMBOL_RECOVERED = 185,                /* RECOVERED  */
+  YYSYMBOL_PASSED = 186,                   /* PASSED  */
+  YYSYMBOL_SUCCEEDED = 187,                /* SUCCEEDED  */
+  YYSYMBOL_URL = 188,                      /* URL  */
+  YYSYMBOL_CONTENT = 189,                  /* CONTENT  */
+  YYSYMBOL_PID = 190,                      /* PID  */
+  YYSYMBOL_PPID = 191,                     /* PPID  */
+  YYSYMBOL_FSFLAG = 192,                   /* FSFLAG  */
+  YYSYMBOL_REGISTER = 193,                 /* REGISTER  */
+  YYSYMBOL_CREDENTIALS = 194,              /* CREDENTIALS  */
+  YYSYMBOL_URLOBJECT = 195,                /* URLOBJECT  */
+  YYSYMBOL_TARGET = 196,                   /* TARGET  */
+  YYSYMBOL_TIMESPEC = 197,                 /* TIMESPEC  */
+  YYSYMBOL_MAXFORWARD = 198,               /* MAXFORWARD  */
+  YYSYMBOL_FIPS = 199,                     /* FIPS  */
+  YYSYMBOL_CGROUP = 200,                   /* CGROUP  */
+  YYSYMBOL_CPUSTEAL = 201,                 /* CPUSTEAL  */
+  YYSYMBOL_CPUIRQ = 202,                   /* CPUIRQ  */
+  YYSYMBOL_PRESSURECPU = 203,              /* PRESSURECPU  */
+  YYSYMBOL_PRESSUREMEMORY = 204,           /* PRESSUREMEMORY  */
+  YYSYMBOL_PRESSUREIO = 205,               /* PRESSUREIO  */
+  YYSYMBOL_AVERAGE = 206,                  /* AVERAGE  */
+  YYSYMBOL_PERCENTILE = 207,               /* PERCENTILE  */
+  YYSYMBOL_SLOPE = 208,                    /* SLOPE  */
+  YYSYMBOL_OVER = 209,                     /* OVER  */
+  YYSYMBOL_MILLISECOND = 210,              /* MILLISECOND  */
+  YYSYMBOL_RESPONSETIME = 211,             /* RESPONSETIME  */
+  YYSYMBOL_RESOLVETIME = 212,              /* RESOLVETIME  */
+  YYSYMBOL_CONNECTTIME = 213,              /* CONNECTTIME  */
+  YYSYMBOL_TLSTIME = 214,                  /* TLSTIME  */
+  YYSYMBOL_FIRSTBYTETIME = 215,            /* FIRSTBYTETIME  */
+  YYSYMBOL_KEEPALIVE = 216,                /* KEEPALIVE  */
+  YYSYMBOL_PIDWATCH = 217,                 /* PIDWATCH  */
+  YYSYMBOL_CONCURRENCY = 218,              /* CONCURRENCY  */
+  YYSYMBOL_SESSION = 219,                  /* SESSION  */
+  YYSYMBOL_FILES = 220,                    /* FILES  */
+  YYSYMBOL_OLDEST = 221,                   /* OLDEST  */
+  YYSYMBOL_NEWEST = 222,                   /* NEWEST  */
+  YYSYMBOL_REFRESH = 223,                  /* REFRESH  */
+  YYSYMBOL_GREATER = 224,                  /* GREATER  */
+  YYSYMBOL_LESS = 225,                     /* LESS  */
+  YYSYMBOL_EQUAL = 226,                    /* EQUAL  */
+  YYSYMBOL_NOTEQUAL = 227,                 /* NOTEQUAL  */
+  YYSYMBOL_228_ = 228,                     /* '{'  */
+  YYSYMBOL_229_ = 229,                     /* '}'  */
+  YYSYMBOL_230_ = 230,                     /* ':'  */
+  YYSYMBOL_231_ = 231,                     /* '@'  */
+  YYSYMBOL_YYACCEPT = 232,                 /* $accept  */
+  YYSYMBOL_cfgfile = 233,                  /* cfgfile  */
+  YYSYMBOL_statement_list = 234,           /* statement_list  */
+  YYSYMBOL_statement = 235,                /* statement  */
+  YYSYMBOL_optproclist = 236,              /* optproclist  */
+  YYSYMBOL_optproc = 237,                  /* optproc  */
+  YYSYMBOL_optfilelist = 238,              /* optfilelist  */
+  YYSYMBOL_optfile = 239,                  /* optfile  */
+  YYSYMBOL_optfilesyslist = 240,           /* optfilesyslist  */
+  YYSYMBOL_optfilesys = 241,               /* optfilesys  */
+  YYSYMBOL_optdirlist = 242,               /* optdirlist  */
+  YYSYMBOL_optdir = 243,                   /* optdir  */
+  YYSYMBOL_opthostlist = 244,              /* opthostlist  */
+  YYSYMBOL_opthost = 245,                  /* opthost  */
+  YYSYMBOL_optsystemlist = 246,            /* optsystemlist  */
+  YYSYMBOL_optsystem = 247,                /* optsystem  */
+  YYSYMBOL_optfifolist = 248,              /* optfifolist  */
+  YYSYMBOL_optfifo = 249,                  /* optfifo  */
+  YYSYMBOL_optstatuslist = 250,            /* optstatuslist  */
+  YYSYMBOL_optstatus = 251,                /* optstatus  */
+  YYSYMBOL_setalert = 252,                 /* setalert  */
+  YYSYMBOL_setdaemon = 253,                /* setdaemon  */
+  YYSYMBOL_startdelay = 254,               /* startdelay  */
+  YYSYMBOL_setexpectbuffer = 255,          /* setexpectbuffer  */
+  YYSYMBOL_setkeepalive = 256,             /* setkeepalive  */
+  YYSYMBOL_setpidwatch = 257,              /* setpidwatch  */
+  YYSYMBOL_setconcurrency = 258,           /* setconcurrency  */
+  YYSYMBOL_setinit = 259,                  /* setinit  */
+  YYSYMBOL_setfips = 260,                  /* setfips  */
+  YYSYMBOL_setlog = 261,                   /* setlog  */
+  YYSYMBOL_seteventqueue = 262,            /* seteventqueue  */
+  YYSYMBOL_setidfile = 263,                /* setidfile  */
+  YYSYMBOL_setstatefile = 264,             /* setstatefile  */
+  YYSYMBOL_setpid = 265,                   /* setpid  */
+  YYSYMBOL_setmmonits = 266,               /* setmmonits  */
+  YYSYMBOL_mmonitlist = 267,               /* mmonitlist  */
+  YYSYMBOL_mmonit = 268,                   /* mmonit  */
+  YYSYMBOL_credentials = 269,              /* credentials  */
+  YYSYMBOL_setmailservers = 270,           /* setmailservers  */
+  YYSYMBOL_setmailformat = 271,            /* setmailformat  */
+  YYSYMBOL_sethttpd = 272,                 /* sethttpd  */
+  YYSYMBOL_mailserverlist = 273,           /* mailserverlist  */
+  YYSYMBOL_mailserver = 274,               /* mailserver  */
+  YYSYMBOL_httpdlist = 275,                /* httpdlist  */
+  YYSYMBOL_httpdoption = 276,              /* httpdoption  */
+  YYSYMBOL_ssl = 277,                      /* ssl  */
+  YYSYMBOL_optssllist = 278,               /* optssllist  */
+  YYSYMBOL_optssl = 279,                   /* optssl  */
+  YYSYMBOL_sslenable = 280,                /* sslenable  */
+  YYSYMBOL_ssldisable = 281,               /* ssldisable  */
+  YYSYMBOL_signature = 282,                /* signature  */
+  YYSYMBOL_sigenable = 283,                /* sigenable  */
+  YYSYMBOL_sigdisable = 284,               /* sigdisable  */
+  YYSYMBOL_bindaddress = 285,              /* bindaddress  */
+  YYSYMBOL_controlsocket = 286,            /* controlsocket  */
+  YYSYMBOL_session = 287,                  /* session  */
+  YYSYMBOL_pemfile = 288,                  /* pemfile  */
+  YYSYMBOL_clientpemfile = 289,            /* clientpemfile  */
+  YYSYMBOL_allowselfcert = 290,            /* allowselfcert  */
+  YYSYMBOL_allow = 291,                    /* allow  */
+  YYSYMBOL_292_1 = 292,                    /* $@1  */
+  YYSYMBOL_293_2 = 293,                    /* $@2  */
+  YYSYMBOL_294_3 = 294,                    /* $@3  */
+  YYSYMBOL_295_4 = 295,                    /* $@4  */
+  YYSYMBOL_allowuserlist = 296,            /* allowuserlist  */
+  YYSYMBOL_allowuser = 297,                /* allowuser  */
+  YYSYMBOL_readonly = 298,                 /* readonly  */
+  YYSYMBOL_checkproc = 299,                /* checkproc  */
+  YYSYMBOL_checkfile = 300,                /* checkfile  */
+  YYSYMBOL_checkfilesys = 301,             /* checkfilesys  */
+  YYSYMBOL_checkdir = 302,                 /* checkdir  */
+  YYSYMBOL_checkhost = 303,                /* checkhost  */
+  YYSYMBOL_checksystem = 304,              /* checksystem  */
+  YYSYMBOL_checkfifo = 305,                /* checkfifo  */
+  YYSYMBOL_checkprogram = 306,             /* checkprogram  */
+  YYSYMBOL_start = 307,                    /* start  */
+  YYSYMBOL_stop = 308,                     /* stop  */
+  YYSYMBOL_restart = 309,                  /* restart  */
+  YYSYMBOL_argumentlist = 310,             /* argumentlist  */
+  YYSYMBOL_useroptionlist = 311,           /* useroptionlist  */
+  YYSYMBOL_argument = 312,                 /* argument  */
+  YYSYMBOL_useroption = 313,               /* useroption  */
+  YYSYMBOL_username = 314,                 /* username  */
+  YYSYMBOL_password = 315,                 /* password  */
+  YYSYMBOL_hostname = 316,                 /* hostname  */
+  YYSYMBOL_connection = 317,               /* connection  */
+  YYSYMBOL_connectionunix = 318,           /* connectionunix  */
+  YYSYMBOL_icmp = 319,                     /* icmp  */
+  YYSYMBOL_host = 320,                     /* host  */
+  YYSYMBOL_port = 321,                     /* port  */
+  YYSYMBOL_unixsocket = 322,               /* unixsocket  */
+  YYSYMBOL_type = 323,                     /* type  */
+  YYSYMBOL_certmd5 = 324,                  /* certmd5  */
+  YYSYMBOL_sslversion = 325,               /* sslversion  */
+  YYSYMBOL_protocol = 326,                 /* protocol  */
+  YYSYMBOL_sendexpectlist = 327,           /* sendexpectlist  */
+  YYSYMBOL_sendexpect = 328,               /* sendexpect  */
+  YYSYMBOL_target = 329,                   /* target  */
+  YYSYMBOL_maxforward = 330,               /* maxforward  */
+  YYSYMBOL_request = 331,                  /* request  */
+  YYSYMBOL_hostheader = 332,               /* hostheader  */
+  YYSYMBOL_secret = 333,                   /* secret  */
+  YYSYMBOL_apache_stat_list = 334,         /* apache_stat_list  */
+  YYSYMBOL_apache_stat = 335,              /* apache_stat  */
+  YYSYMBOL_exist = 336,                    /* exist  */
+  YYSYMBOL_pid = 337,                      /* pid  */
+  YYSYMBOL_ppid = 338,                     /* ppid  */
+  YYSYMBOL_uptime = 339,                   /* uptime  */
+  YYSYMBOL_icmpcount = 340,                /* icmpcount  */
+  YYSYMBOL_exectimeout = 341,              /* exectimeout  */
+  YYSYMBOL_programtimeout = 342,           /* programtimeout  */
+  YYSYMBOL_nettimeout = 343,               /* nettimeout  */
+  YYSYMBOL_retry = 344,                    /* retry  */
+  YYSYMBOL_actionrate = 345,               /* actionrate  */
+  YYSYMBOL_urloption = 346,                /* urloption  */
+  YYSYMBOL_urloperator = 347,              /* urloperator  */
+  YYSYMBOL_alert = 348,                    /* alert  */
+  YYSYMBOL_alertmail = 349,                /* alertmail  */
+  YYSYMBOL_noalertmail = 350,              /* noalertmail  */
+  YYSYMBOL_eventoptionlist = 351,          /* eventoptionlist  */
+  YYSYMBOL_eventoption = 352,              /* eventoption  */
+  YYSYMBOL_formatlist = 353,               /* formatlist  */
+  YYSYMBOL_formatoptionlist = 354,         /* formatoptionlist  */
+  YYSYMBOL_formatoption = 355,             /* formatoption  */
+  YYSYMBOL_every = 356,                    /* every  */
+  YYSYMBOL_mode = 357,                     /* mode  */
+  YYSYMBOL_group = 358,                    /* group  */
+  YYSYMBOL_cgroup = 359,                   /* cgroup  */
+  YYSYMBOL_depend = 360,                   /* depend  */
+  YYSYMBOL_dependlist = 361,               /* dependlist  */
+  YYSYMBOL_dependant = 362,                /* dependant  */
+  YYSYMBOL_statusvalue = 363,              /* statusvalue  */
+  YYSYMBOL_resourceprocess = 364,          /* resourceprocess  */
+  YYSYMBOL_resourceprocesslist = 365,      /* resourceprocesslist  */
+  YYSYMBOL_resourceprocessopt = 366,       /* resourceprocessopt  */
+  YYSYMBOL_resourcesystem = 367,           /* resourcesystem  */
+  YYSYMBOL_resourcesystemlist = 368,       /* resourcesystemlist  */
+  YYSYMBOL_resourcesystemopt = 369,        /* resourcesystemopt  */
+  YYSYMBOL_resourcecpuproc = 370,          /* resourcecpuproc  */
+  YYSYMBOL_resourcecpu = 371,              /* resourcecpu  */
+  YYSYMBOL_resourcecpuid = 372,            /* resourcecpuid  */
+  YYSYMBOL_resourcepressure = 373,         /* resourcepressure  */
+  YYSYMBOL_resourcepressureid = 374,       /* resourcepressureid  */
+  YYSYMBOL_resourcemem = 375,              /* resourcemem  */
+  YYSYMBOL_resourceswap = 376,             /* resourceswap  */
+  YYSYMBOL_resourcechild = 377,            /* resourcechild  */
+  YYSYMBOL_resourceload = 378,             /* resourceload  */
+  YYSYMBOL_resourceloadavg = 379,          /* resourceloadavg  */
+  YYSYMBOL_trend = 380,                    /* trend  */
+  YYSYMBOL_trendfunction = 381,            /* trendfunction  */
+  YYSYMBOL_trendmetric = 382,              /* trendmetric  */
+  YYSYMBOL_trendlimit = 383,               /* trendlimit  */
+  YYSYMBOL_trendunit = 384,                /* trendunit  */
+  YYSYMBOL_timing = 385,                   /* timing  */
+  YYSYMBOL_timingphase = 386,              /* timingphase  */
+  YYSYMBOL_timingunit = 387,               /* timingunit  */
+  YYSYMBOL_value = 388,                    /* value  */
+  YYSYMBOL_timestamp = 389,                /* timestamp  */
+  YYSYMBOL_tree = 390,                     /* tree  */
+  YYSYMBOL_treerefresh = 391,              /* treerefresh  */
+  YYSYMBOL_treepattern = 392,              /* treepattern  */
+  YYSYMBOL_operator = 393,                 /* operator  */
+  YYSYMBOL_time = 394,                     /* time  */
+  YYSYMBOL_action = 395,                   /* action  */
+  YYSYMBOL_action1 = 396,                  /* action1  */
+  YYSYMBOL_action2 = 397,                  /* action2  */
+  YYSYMBOL_rate1 = 398,                    /* rate1  */
+  YYSYMBOL_rate2 = 399,                    /* rate2  */
+  YYSYMBOL_recovery = 400,                 /* recovery  */
+  YYSYMBOL_checksum = 401,                 /* checksum  */
+  YYSYMBOL_hashtype = 402,                 /* hashtype  */
+  YYSYMBOL_inode = 403,                    /* inode  */
+  YYSYMBOL_space = 404,                    /* space  */
+  YYSYMBOL_fsflag = 405,                   /* fsflag  */
+  YYSYMBOL_unit = 406,                     /* unit  */
+  YYSYMBOL_permission = 407,               /* permission  */
+  YYSYMBOL_match = 408,                    /* match  */
+  YYSYMBOL_matchflagnot = 409,             /* matchflagnot  */
+  YYSYMBOL_size = 410,                     /* size  */
+  YYSYMBOL_uid = 411,                      /* uid  */
+  YYSYMBOL_gid = 412,                      /* gid  */
+  YYSYMBOL_icmptype = 413,                 /* icmptype  */
+  YYSYMBOL_reminder = 414                  /* reminder  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Line 293 of yacc.c  */
-#line 259 "src/p.y"
-
-  URL_T url;
-  float real;
-  int   number;
-  char *string;
 
 
 
-/* Line 293 of yacc.c  */
-#line 752 "src/y.tab.c"
-} YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+#ifdef short
+# undef short
 #endif
 
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
-
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-/* Line 343 of yacc.c  */
-#line 764 "src/y.tab.c"
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-typedef signed char yytype_int8;
-#else
-typedef short int yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -799,55 +868,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -864,9 +984,9 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
 #      define EXIT_SUCCESS 0
 #     endif
@@ -876,8 +996,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -893,7 +1013,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -901,40 +1021,37 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -944,61 +1061,66 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
-/* Copy COUNT objects from FROM to TO.  The source and destination do
+/* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  58
+#define YYFINAL  64
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   982
+#define YYLAST   1118
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  206
+#define YYNTOKENS  232
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  164
+#define YYNNTS  183
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  505
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  889
+#define YYNRULES  571
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1018
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   456
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   482
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1006,14 +1128,14 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,   204,     2,
-       2,     2,     2,     2,   205,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   230,     2,
+       2,     2,     2,     2,   231,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   202,     2,   203,     2,     2,     2,     2,
+       2,     2,     2,   228,     2,   229,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1046,339 +1168,141 @@ static const yytype_uint8 yytranslate[] =
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
      185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
-     195,   196,   197,   198,   199,   200,   201
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     4,     6,     8,    11,    13,    15,    17,
-      19,    21,    23,    25,    27,    29,    31,    33,    35,    37,
-      39,    42,    45,    48,    51,    54,    57,    60,    63,    64,
-      67,    69,    71,    73,    75,    77,    79,    81,    83,    85,
-      87,    89,    91,    93,    95,    97,    99,   100,   103,   105,
-     107,   109,   111,   113,   115,   117,   119,   121,   123,   125,
-     127,   129,   131,   133,   135,   137,   138,   141,   143,   145,
-     147,   149,   151,   153,   155,   157,   159,   161,   163,   165,
-     167,   169,   171,   173,   174,   177,   179,   181,   183,   185,
-     187,   189,   191,   193,   195,   197,   199,   201,   203,   205,
-     207,   210,   212,   214,   216,   218,   220,   222,   224,   226,
-     228,   230,   232,   234,   235,   238,   240,   242,   244,   246,
-     248,   250,   252,   254,   256,   257,   260,   262,   264,   266,
-     268,   270,   272,   274,   276,   278,   280,   282,   284,   286,
-     288,   289,   292,   294,   296,   298,   300,   302,   304,   306,
-     308,   310,   312,   317,   325,   334,   339,   340,   344,   349,
-     352,   355,   359,   363,   369,   374,   381,   386,   390,   394,
-     398,   402,   405,   409,   414,   415,   418,   424,   430,   436,
-     438,   441,   447,   455,   456,   459,   461,   463,   465,   467,
-     470,   473,   474,   477,   479,   481,   483,   486,   489,   492,
-     495,   497,   499,   502,   505,   508,   511,   514,   517,   520,
-     522,   528,   533,   536,   540,   544,   548,   549,   554,   555,
-     561,   562,   568,   569,   575,   578,   580,   583,   585,   586,
-     588,   593,   598,   603,   608,   613,   618,   623,   628,   631,
-     636,   642,   646,   651,   655,   660,   664,   669,   671,   674,
-     676,   679,   681,   683,   686,   689,   692,   695,   696,   699,
-     702,   703,   706,   707,   710,   723,   735,   747,   758,   759,
-     762,   765,   768,   769,   772,   777,   780,   781,   784,   785,
-     787,   789,   791,   793,   794,   798,   801,   804,   807,   810,
-     814,   817,   820,   823,   826,   829,   834,   837,   840,   843,
-     846,   849,   852,   855,   858,   861,   864,   867,   870,   874,
-     877,   879,   881,   884,   887,   890,   891,   894,   897,   898,
-     901,   902,   906,   912,   913,   916,   919,   921,   925,   930,
-     935,   940,   945,   950,   955,   960,   965,   970,   975,   983,
-     990,   997,  1007,  1008,  1011,  1012,  1016,  1017,  1021,  1022,
-    1026,  1027,  1030,  1038,  1046,  1047,  1051,  1053,  1055,  1059,
-    1066,  1074,  1076,  1079,  1082,  1084,  1087,  1089,  1091,  1093,
-    1095,  1097,  1099,  1101,  1103,  1105,  1107,  1109,  1111,  1113,
-    1115,  1117,  1119,  1121,  1123,  1125,  1127,  1129,  1131,  1132,
-    1137,  1139,  1142,  1144,  1146,  1148,  1150,  1154,  1157,  1160,
-    1163,  1166,  1169,  1172,  1175,  1177,  1180,  1182,  1191,  1198,
-    1200,  1203,  1205,  1207,  1209,  1211,  1218,  1220,  1223,  1225,
-    1227,  1229,  1231,  1236,  1241,  1246,  1248,  1250,  1252,  1257,
-    1262,  1267,  1272,  1277,  1282,  1286,  1290,  1292,  1294,  1296,
-    1298,  1300,  1310,  1317,  1318,  1320,  1322,  1324,  1326,  1328,
-    1329,  1331,  1333,  1335,  1337,  1339,  1342,  1346,  1348,  1350,
-    1352,  1354,  1356,  1358,  1359,  1362,  1366,  1367,  1370,  1374,
-    1375,  1382,  1389,  1396,  1405,  1416,  1424,  1425,  1427,  1429,
-    1438,  1448,  1458,  1468,  1475,  1476,  1478,  1480,  1482,  1484,
-    1493,  1501,  1509,  1514,  1519,  1520,  1522,  1532,  1539,  1548,
-    1557,  1566,  1575,  1578,  1579,  1582
+       0,   340,   340,   341,   344,   345,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
+     362,   363,   364,   365,   366,   367,   368,   369,   370,   371,
+     372,   375,   376,   379,   380,   381,   382,   383,   384,   385,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,   395,
+     396,   397,   400,   401,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   423,   424,   427,   428,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   445,
+     446,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     458,   459,   460,   461,   462,   463,   464,   467,   468,   471,
+     472,   473,   474,   475,   476,   477,   478,   479,   480,   481,
+     482,   483,   484,   487,   488,   491,   492,   493,   494,   495,
+     496,   497,   498,   499,   500,   503,   504,   507,   508,   509,
+     510,   511,   512,   513,   514,   515,   516,   517,   518,   519,
+     520,   523,   524,   527,   528,   529,   530,   531,   532,   533,
+     534,   535,   536,   539,   543,   546,   552,   562,   563,   566,
+     571,   574,   581,   586,   593,   598,   605,   613,   616,   621,
+     624,   628,   634,   639,   644,   652,   655,   656,   659,   665,
+     666,   671,   678,   687,   693,   694,   697,   716,   735,   736,
+     739,   740,   741,   742,   743,   744,   747,   750,   761,   762,
+     765,   766,   767,   770,   771,   774,   775,   778,   779,   782,
+     783,   786,   787,   790,   793,   796,   797,   804,   809,   817,
+     822,   825,   833,   837,   841,   845,   849,   849,   856,   856,
+     863,   863,   870,   870,   877,   885,   886,   889,   893,   894,
+     897,   900,   903,   910,   919,   924,   929,   934,   940,   952,
+     957,   964,   967,   972,   975,   981,   984,   989,   990,   993,
+     994,   997,   998,  1001,  1002,  1003,  1004,  1007,  1008,  1009,
+    1012,  1013,  1016,  1017,  1020,  1027,  1037,  1046,  1056,  1062,
+    1065,  1068,  1073,  1076,  1079,  1087,  1092,  1093,  1096,  1097,
+    1098,  1099,  1100,  1103,  1106,  1109,  1112,  1115,  1118,  1121,
+    1124,  1127,  1130,  1133,  1136,  1139,  1142,  1145,  1149,  1152,
+    1155,  1158,  1161,  1164,  1167,  1170,  1173,  1176,  1179,  1182,
+    1185,  1190,  1191,  1194,  1195,  1198,  1199,  1202,  1207,  1208,
+    1213,  1214,  1218,  1225,  1226,  1231,  1236,  1237,  1240,  1244,
+    1248,  1252,  1256,  1260,  1264,  1268,  1272,  1276,  1282,  1288,
+    1293,  1298,  1305,  1308,  1313,  1316,  1321,  1324,  1329,  1332,
+    1337,  1340,  1345,  1351,  1359,  1360,  1366,  1367,  1370,  1374,
+    1377,  1381,  1386,  1389,  1392,  1393,  1396,  1397,  1398,  1399,
+    1400,  1401,  1402,  1403,  1404,  1405,  1406,  1407,  1408,  1409,
+    1410,  1411,  1412,  1413,  1414,  1415,  1416,  1417,  1420,  1421,
+    1424,  1425,  1428,  1429,  1430,  1431,  1434,  1438,  1442,  1448,
+    1451,  1454,  1460,  1463,  1470,  1473,  1474,  1477,  1480,  1488,
+    1494,  1495,  1498,  1499,  1500,  1501,  1504,  1510,  1511,  1514,
+    1515,  1516,  1517,  1518,  1521,  1526,  1533,  1540,  1541,  1542,
+    1543,  1544,  1547,  1554,  1555,  1556,  1559,  1564,  1569,  1574,
+    1581,  1586,  1593,  1600,  1607,  1608,  1609,  1612,  1620,  1621,
+    1627,  1630,  1631,  1632,  1633,  1634,  1635,  1636,  1637,  1640,
+    1646,  1647,  1648,  1649,  1650,  1651,  1652,  1653,  1656,  1664,
+    1665,  1666,  1667,  1668,  1671,  1672,  1675,  1676,  1679,  1685,
+    1692,  1699,  1706,  1713,  1722,  1729,  1730,  1733,  1734,  1735,
+    1736,  1737,  1738,  1741,  1742,  1743,  1744,  1745,  1748,  1749,
+    1750,  1751,  1752,  1753,  1754,  1757,  1766,  1775,  1776,  1782,
+    1792,  1793,  1799,  1809,  1812,  1815,  1818,  1823,  1827,  1834,
+    1840,  1841,  1842,  1843,  1844,  1847,  1854,  1863,  1872,  1881,
+    1886,  1887,  1888,  1889,  1890,  1893,  1900,  1907,  1913,  1920,
+    1928,  1931,  1937,  1943,  1950,  1956,  1963,  1969,  1976,  1979,
+    1980,  1981
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     207,     0,    -1,    -1,   208,    -1,   209,    -1,   208,   209,
-      -1,   226,    -1,   227,    -1,   232,    -1,   233,    -1,   237,
-      -1,   241,    -1,   242,    -1,   243,    -1,   236,    -1,   234,
-      -1,   235,    -1,   229,    -1,   230,    -1,   231,    -1,   268,
-     210,    -1,   269,   212,    -1,   270,   214,    -1,   271,   216,
-      -1,   272,   218,    -1,   273,   220,    -1,   274,   222,    -1,
-     275,   224,    -1,    -1,   210,   211,    -1,   276,    -1,   277,
-      -1,   278,    -1,   305,    -1,   306,    -1,   307,    -1,   308,
-      -1,   286,    -1,   287,    -1,   314,    -1,   317,    -1,   325,
-      -1,   326,    -1,   327,    -1,   328,    -1,   332,    -1,    -1,
-     212,   213,    -1,   276,    -1,   277,    -1,   278,    -1,   305,
-      -1,   347,    -1,   314,    -1,   325,    -1,   317,    -1,   362,
-      -1,   366,    -1,   367,    -1,   356,    -1,   365,    -1,   363,
-      -1,   326,    -1,   327,    -1,   328,    -1,    -1,   214,   215,
-      -1,   276,    -1,   277,    -1,   278,    -1,   305,    -1,   314,
-      -1,   325,    -1,   317,    -1,   362,    -1,   366,    -1,   367,
-      -1,   326,    -1,   327,    -1,   328,    -1,   358,    -1,   359,
-      -1,   360,    -1,    -1,   216,   217,    -1,   276,    -1,   277,
-      -1,   278,    -1,   305,    -1,   347,    -1,   314,    -1,   325,
-      -1,   317,    -1,   362,    -1,   366,    -1,   367,    -1,   326,
-      -1,   327,    -1,   328,    -1,   219,    -1,   218,   219,    -1,
-     276,    -1,   277,    -1,   278,    -1,   305,    -1,   286,    -1,
-     288,    -1,   314,    -1,   317,    -1,   325,    -1,   326,    -1,
-     327,    -1,   328,    -1,    -1,   220,   221,    -1,   276,    -1,
-     277,    -1,   278,    -1,   314,    -1,   317,    -1,   325,    -1,
-     327,    -1,   328,    -1,   335,    -1,    -1,   222,   223,    -1,
-     276,    -1,   277,    -1,   278,    -1,   305,    -1,   347,    -1,
-     314,    -1,   325,    -1,   317,    -1,   362,    -1,   366,    -1,
-     367,    -1,   326,    -1,   327,    -1,   328,    -1,    -1,   224,
-     225,    -1,   276,    -1,   277,    -1,   278,    -1,   314,    -1,
-     305,    -1,   317,    -1,   325,    -1,   327,    -1,   328,    -1,
-     331,    -1,     8,   318,   322,   369,    -1,     8,   318,   202,
-     320,   203,   322,   369,    -1,     8,   318,   171,   202,   320,
-     203,   322,   369,    -1,     8,    11,    97,   228,    -1,    -1,
-      39,    23,    97,    -1,     8,    34,    97,   361,    -1,     8,
-      17,    -1,     8,   197,    -1,     8,     9,    89,    -1,     8,
-       9,    12,    -1,     8,     9,    12,    10,    88,    -1,     8,
-     142,   140,    89,    -1,     8,   142,   140,    89,   141,    97,
-      -1,     8,   142,   141,    97,    -1,     8,    30,    89,    -1,
-       8,    31,    89,    -1,     8,    38,    89,    -1,     8,   147,
-     238,    -1,   239,   240,    -1,   238,   239,   240,    -1,   193,
-     312,   294,   293,    -1,    -1,   191,   192,    -1,     8,    13,
-     244,   312,   285,    -1,     8,    53,   202,   323,   203,    -1,
-       8,    14,    44,    97,   246,    -1,   245,    -1,   244,   245,
-      -1,    88,   283,   284,   294,   293,    -1,    88,    44,    97,
-     283,   284,   294,   293,    -1,    -1,   246,   247,    -1,   248,
-      -1,   253,    -1,   256,    -1,   260,    -1,   252,   249,    -1,
-     251,   249,    -1,    -1,   249,   250,    -1,   257,    -1,   258,
-      -1,   259,    -1,    27,    25,    -1,    25,    27,    -1,    27,
-      26,    -1,    26,    27,    -1,   254,    -1,   255,    -1,    55,
-      25,    -1,    25,    55,    -1,    55,    26,    -1,    26,    55,
-      -1,    16,    88,    -1,    24,    89,    -1,    28,    89,    -1,
-      29,    -1,    15,    88,   204,    88,   267,    -1,    15,   205,
-      88,   267,    -1,    15,    89,    -1,    15,    19,    89,    -1,
-      15,    20,    89,    -1,    15,    22,    89,    -1,    -1,    15,
-      89,   261,   265,    -1,    -1,    15,    19,    89,   262,   265,
-      -1,    -1,    15,    20,    89,   263,   265,    -1,    -1,    15,
-      22,    89,   264,   265,    -1,    15,    88,    -1,   266,    -1,
-     265,   266,    -1,    88,    -1,    -1,    18,    -1,   110,    95,
-      38,    89,    -1,   110,    95,    41,    89,    -1,   110,    95,
-     170,    88,    -1,   110,    95,   170,    89,    -1,   112,    95,
-      41,    89,    -1,   111,    95,    41,    89,    -1,   113,    95,
-      41,    89,    -1,   114,    95,    16,    88,    -1,   115,    95,
-      -1,   116,    95,    41,    89,    -1,   117,    95,    41,    89,
-     311,    -1,    39,   279,   310,    -1,    39,   279,   280,   310,
-      -1,    40,   279,   310,    -1,    40,   279,   280,   310,    -1,
-      58,   279,   310,    -1,    58,   279,   280,   310,    -1,   281,
-      -1,   279,   281,    -1,   282,    -1,   280,   282,    -1,    88,
-      -1,    89,    -1,   145,    88,    -1,   146,    88,    -1,   145,
-      97,    -1,   146,    97,    -1,    -1,   149,    90,    -1,   149,
-      88,    -1,    -1,   150,    88,    -1,    -1,    43,    88,    -1,
-       3,     7,   289,   290,   292,   295,   312,   313,   353,     5,
-     351,   355,    -1,     3,     7,   186,   193,   315,   312,   313,
-     353,     5,   351,   355,    -1,     3,     7,   291,   292,   295,
-     312,   313,   353,     5,   351,   355,    -1,     3,     7,   177,
-     368,   309,   312,   353,     5,   351,   355,    -1,    -1,    42,
-      88,    -1,    44,    97,    -1,    54,    89,    -1,    -1,    45,
-      47,    -1,    45,    48,   294,   293,    -1,    45,    46,    -1,
-      -1,   161,    88,    -1,    -1,   158,    -1,   159,    -1,   160,
-      -1,   157,    -1,    -1,    49,    64,   303,    -1,    49,    62,
-      -1,    49,    73,    -1,    49,    75,    -1,    49,    65,    -1,
-      49,    63,   300,    -1,    49,    68,    -1,    49,    69,    -1,
-      49,    76,    -1,    49,    77,    -1,    49,    72,    -1,    49,
-      83,   298,   299,    -1,    49,    70,    -1,    49,    71,    -1,
-      49,    82,    -1,    49,    67,    -1,    49,    66,    -1,    49,
-      74,    -1,    49,    78,    -1,    49,    79,    -1,    49,    80,
-      -1,    49,    81,    -1,    49,    84,    -1,    49,    85,    -1,
-      49,    86,   302,    -1,    49,    87,    -1,   296,    -1,   297,
-      -1,   296,   297,    -1,    32,    88,    -1,    33,    88,    -1,
-      -1,   194,    90,    -1,   194,    88,    -1,    -1,   196,    97,
-      -1,    -1,   138,    89,   301,    -1,   138,    89,    59,    88,
-     301,    -1,    -1,   144,    88,    -1,   143,    88,    -1,   304,
-      -1,   303,     6,   304,    -1,    99,   348,    97,    98,    -1,
-     100,   348,    97,    98,    -1,   101,   348,    97,    98,    -1,
-     102,   348,    97,    98,    -1,   103,   348,    97,    98,    -1,
-     104,   348,    97,    98,    -1,   105,   348,    97,    98,    -1,
-     106,   348,    97,    98,    -1,   107,   348,    97,    98,    -1,
-     108,   348,    97,    98,    -1,     3,   171,   180,   353,     5,
-     351,   355,    -1,     3,   152,   188,   353,     5,   351,    -1,
-       3,   152,   189,   353,     5,   351,    -1,     3,   174,   348,
-      97,   349,   353,     5,   351,   355,    -1,    -1,    36,    97,
-      -1,    -1,    56,    97,   153,    -1,    -1,    56,    97,   153,
-      -1,    -1,    56,    97,   153,    -1,    -1,    57,    97,    -1,
-       3,    97,    58,    97,    35,     5,   351,    -1,     3,    97,
-      58,    97,    35,     5,    56,    -1,    -1,   187,   316,    88,
-      -1,   199,    -1,   198,    -1,   318,   322,   369,    -1,   318,
-     202,   320,   203,   322,   369,    -1,   318,   171,   202,   320,
-     203,   322,   369,    -1,   319,    -1,    51,    90,    -1,    52,
-      90,    -1,   321,    -1,   320,   321,    -1,   173,    -1,    59,
-      -1,    50,    -1,   187,    -1,   182,    -1,   175,    -1,   190,
-      -1,   146,    -1,   177,    -1,   148,    -1,   181,    -1,   179,
-      -1,   168,    -1,   188,    -1,   189,    -1,   121,    -1,   169,
-      -1,   120,    -1,    56,    -1,   151,    -1,   145,    -1,   174,
-      -1,    -1,    53,   202,   323,   203,    -1,   324,    -1,   323,
-     324,    -1,    91,    -1,    92,    -1,    93,    -1,    94,    -1,
-      60,    97,    35,    -1,    60,   195,    -1,    61,   195,    -1,
-     128,   129,    -1,   128,   130,    -1,   128,   131,    -1,   137,
-      96,    -1,   139,   329,    -1,   330,    -1,   329,   330,    -1,
-      95,    -1,     3,   120,   348,    97,   353,     5,   351,   355,
-      -1,     3,   333,   353,     5,   351,   355,    -1,   334,    -1,
-     333,   334,    -1,   338,    -1,   341,    -1,   343,    -1,   344,
-      -1,     3,   336,   353,     5,   351,   355,    -1,   337,    -1,
-     336,   337,    -1,   344,    -1,   341,    -1,   342,    -1,   339,
-      -1,   132,   348,    97,    98,    -1,   133,   348,    97,    98,
-      -1,   340,   348,    97,    98,    -1,   134,    -1,   135,    -1,
-     136,    -1,   122,   348,   346,   361,    -1,   122,   348,    97,
-      98,    -1,   123,   348,   346,   361,    -1,   123,   348,    97,
-      98,    -1,   127,   348,   346,   361,    -1,   127,   348,    97,
-      98,    -1,   118,   348,    97,    -1,   345,   348,   346,    -1,
-     124,    -1,   125,    -1,   126,    -1,   109,    -1,    97,    -1,
-       3,   151,   348,    97,   349,   353,     5,   351,   355,    -1,
-       3,   152,   151,   353,     5,   351,    -1,    -1,   201,    -1,
-     200,    -1,   199,    -1,   198,    -1,   152,    -1,    -1,   153,
-      -1,   154,    -1,   155,    -1,   156,    -1,    51,    -1,   175,
-     279,    -1,   175,   279,   280,    -1,    58,    -1,    39,    -1,
-      40,    -1,   176,    -1,   350,    -1,   350,    -1,    -1,    97,
-      35,    -1,    97,    97,    35,    -1,    -1,    97,    35,    -1,
-      97,    97,    35,    -1,    -1,     4,     3,   183,   354,     5,
-     352,    -1,     4,     3,   184,   354,     5,   352,    -1,     4,
-       3,   185,   354,     5,   352,    -1,     3,     7,   357,    59,
-     353,     5,   351,   355,    -1,     3,     7,   357,    59,    33,
-      88,   353,     5,   351,   355,    -1,     3,   152,   357,    59,
-     353,     5,   351,    -1,    -1,    20,    -1,    21,    -1,     3,
-     166,   348,    97,   353,     5,   351,   355,    -1,     3,   166,
-     348,    97,    98,   353,     5,   351,   355,    -1,     3,   167,
-     348,   346,   361,   353,     5,   351,   355,    -1,     3,   167,
-     348,    97,    98,   353,     5,   351,   355,    -1,     3,   152,
-     190,   353,     5,   351,    -1,    -1,   162,    -1,   163,    -1,
-     164,    -1,   165,    -1,     3,     7,   168,    97,   353,     5,
-     351,   355,    -1,     3,   364,   170,    89,   353,     5,   351,
-      -1,     3,   364,   170,    88,   353,     5,   351,    -1,   172,
-     364,   170,    89,    -1,   172,   364,   170,    88,    -1,    -1,
-     171,    -1,     3,   169,   348,    97,   361,   353,     5,   351,
-     355,    -1,     3,   152,   169,   353,     5,   351,    -1,     3,
-       7,   145,    88,   353,     5,   351,   355,    -1,     3,     7,
-     145,    97,   353,     5,   351,   355,    -1,     3,     7,   146,
-      88,   353,     5,   351,   355,    -1,     3,     7,   146,    97,
-     353,     5,   351,   355,    -1,    45,   178,    -1,    -1,    37,
-      97,    -1,    37,    97,    35,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   305,   305,   306,   309,   310,   313,   314,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   333,   334,   337,   338,
-     341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
-     351,   352,   353,   354,   355,   356,   359,   360,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   382,   383,   386,   387,   388,
-     389,   390,   391,   392,   393,   394,   395,   396,   397,   398,
-     399,   400,   401,   404,   405,   408,   409,   410,   411,   412,
-     413,   414,   415,   416,   417,   418,   419,   420,   421,   424,
-     425,   428,   429,   430,   431,   432,   433,   434,   435,   436,
-     437,   438,   439,   442,   443,   446,   447,   448,   449,   450,
-     451,   452,   453,   454,   457,   458,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     477,   478,   481,   482,   483,   484,   485,   486,   487,   488,
-     489,   490,   493,   497,   500,   506,   516,   517,   520,   525,
-     530,   537,   545,   548,   553,   556,   560,   566,   571,   576,
-     584,   587,   588,   591,   597,   598,   603,   610,   619,   625,
-     626,   629,   648,   667,   668,   671,   672,   673,   674,   677,
-     680,   691,   692,   695,   696,   697,   700,   701,   704,   705,
-     708,   709,   712,   713,   716,   717,   720,   723,   728,   736,
-     741,   744,   752,   756,   760,   764,   768,   768,   775,   775,
-     782,   782,   789,   789,   796,   804,   805,   808,   812,   813,
-     816,   819,   822,   829,   838,   843,   848,   853,   859,   871,
-     876,   883,   886,   891,   894,   900,   903,   908,   909,   912,
-     913,   916,   917,   920,   921,   922,   923,   926,   927,   928,
-     931,   932,   935,   936,   939,   946,   956,   965,   975,   981,
-     984,   987,   992,   995,   998,  1006,  1011,  1012,  1015,  1016,
-    1017,  1018,  1019,  1022,  1025,  1028,  1031,  1034,  1037,  1040,
-    1043,  1046,  1049,  1052,  1055,  1058,  1061,  1064,  1068,  1071,
-    1074,  1077,  1080,  1083,  1086,  1089,  1092,  1095,  1098,  1101,
-    1104,  1109,  1110,  1113,  1114,  1117,  1118,  1121,  1126,  1127,
-    1132,  1133,  1137,  1144,  1145,  1150,  1155,  1156,  1159,  1163,
-    1167,  1171,  1175,  1179,  1183,  1187,  1191,  1195,  1201,  1207,
-    1212,  1217,  1224,  1227,  1232,  1235,  1240,  1243,  1248,  1251,
-    1256,  1259,  1264,  1270,  1278,  1279,  1285,  1286,  1289,  1293,
-    1296,  1300,  1305,  1308,  1311,  1312,  1315,  1316,  1317,  1318,
-    1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,  1328,
-    1329,  1330,  1331,  1332,  1333,  1334,  1335,  1336,  1339,  1340,
-    1343,  1344,  1347,  1348,  1349,  1350,  1353,  1357,  1361,  1367,
-    1370,  1373,  1379,  1383,  1386,  1387,  1390,  1393,  1401,  1407,
-    1408,  1411,  1412,  1413,  1414,  1417,  1423,  1424,  1427,  1428,
-    1429,  1430,  1433,  1438,  1445,  1452,  1453,  1454,  1457,  1462,
-    1467,  1472,  1479,  1484,  1491,  1498,  1505,  1506,  1507,  1510,
-    1511,  1514,  1520,  1527,  1528,  1529,  1530,  1531,  1532,  1535,
-    1536,  1537,  1538,  1539,  1542,  1543,  1544,  1545,  1546,  1547,
-    1548,  1551,  1560,  1569,  1570,  1576,  1586,  1587,  1593,  1603,
-    1606,  1609,  1612,  1617,  1621,  1628,  1634,  1635,  1636,  1639,
-    1646,  1655,  1664,  1673,  1678,  1679,  1680,  1681,  1682,  1685,
-    1692,  1699,  1705,  1712,  1720,  1723,  1729,  1735,  1742,  1748,
-    1755,  1761,  1768,  1771,  1772,  1773
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "IF", "ELSE", "THEN", "OR", "FAILED",
-  "SET", "LOGFILE", "FACILITY", "DAEMON", "SYSLOG", "MAILSERVER", "HTTPD",
-  "ALLOW", "ADDRESS", "INIT", "READONLY", "CLEARTEXT", "MD5HASH",
-  "SHA1HASH", "CRYPT", "DELAY", "PEMFILE", "ENABLE", "DISABLE", "HTTPDSSL",
-  "CLIENTPEMFILE", "ALLOWSELFCERTIFICATION", "IDFILE", "STATEFILE", "SEND",
-  "EXPECT", "EXPECTBUFFER", "CYCLE", "COUNT", "REMINDER", "PIDFILE",
-  "START", "STOP", "PATHTOK", "HOST", "HOSTNAME", "PORT", "TYPE", "UDP",
-  "TCP", "TCPSSL", "PROTOCOL", "CONNECTION", "ALERT", "NOALERT",
-  "MAILFORMAT", "UNIXSOCKET", "SIGNATURE", "TIMEOUT", "RETRY", "RESTART",
-  "CHECKSUM", "EVERY", "NOTEVERY", "DEFAULT", "HTTP", "APACHESTATUS",
-  "FTP", "SMTP", "POP", "IMAP", "CLAMAV", "NNTP", "NTP3", "MYSQL", "DNS",
-  "SSH", "DWP", "LDAP2", "LDAP3", "RDATE", "RSYNC", "TNS", "PGSQL",
-  "POSTFIXPOLICY", "SIP", "LMTP", "GPS", "RADIUS", "MEMCACHE", "STRING",
-  "PATH", "MAILADDR", "MAILFROM", "MAILREPLYTO", "MAILSUBJECT", "MAILBODY",
-  "SERVICENAME", "STRINGNAME", "NUMBER", "PERCENT", "LOGLIMIT",
-  "CLOSELIMIT", "DNSLIMIT", "KEEPALIVELIMIT", "REPLYLIMIT", "REQUESTLIMIT",
-  "STARTLIMIT", "WAITLIMIT", "GRACEFULLIMIT", "CLEANUPLIMIT", "REAL",
-  "CHECKPROC", "CHECKFILESYS", "CHECKFILE", "CHECKDIR", "CHECKHOST",
-  "CHECKSYSTEM", "CHECKFIFO", "CHECKPROGRAM", "CHILDREN", "SYSTEM",
-  "STATUS", "RESOURCE", "MEMORY", "TOTALMEMORY", "LOADAVG1", "LOADAVG5",
-  "LOADAVG15", "SWAP", "MODE", "ACTIVE", "PASSIVE", "MANUAL", "CPU",
-  "TOTALCPU", "CPUUSER", "CPUSYSTEM", "CPUWAIT", "GROUP", "REQUEST",
-  "DEPENDS", "BASEDIR", "SLOT", "EVENTQUEUE", "SECRET", "HOSTHEADER",
-  "UID", "GID", "MMONIT", "INSTANCE", "USERNAME", "PASSWORD", "TIMESTAMP",
-  "CHANGED", "SECOND", "MINUTE", "HOUR", "DAY", "SSLAUTO", "SSLV2",
-  "SSLV3", "TLSV1", "CERTMD5", "BYTE", "KILOBYTE", "MEGABYTE", "GIGABYTE",
-  "INODE", "SPACE", "PERMISSION", "SIZE", "MATCH", "NOT", "IGNORE",
-  "ACTION", "UPTIME", "EXEC", "UNMONITOR", "ICMP", "ICMPECHO", "NONEXIST",
-  "EXIST", "INVALID", "DATA", "RECOVERED", "PASSED", "SUCCEEDED", "URL",
-  "CONTENT", "PID", "PPID", "FSFLAG", "REGISTER", "CREDENTIALS",
-  "URLOBJECT", "TARGET", "TIMESPEC", "MAXFORWARD", "FIPS", "NOTEQUAL",
-  "EQUAL", "LESS", "GREATER", "'{'", "'}'", "':'", "'@'", "$accept",
-  "cfgfile", "statement_list", "statement", "optproclist", "optproc",
-  "optfilelist", "optfile", "optfilesyslist", "optfilesys", "optdirlist",
-  "optdir", "opthostlist", "opthost", "optsystemlist", "optsystem",
-  "optfifolist", "optfifo", "optstatuslist", "optstatus", "setalert",
-  "setdaemon", "startdelay", "setexpectbuffer", "setinit", "setfips",
-  "setlog", "seteventqueue", "setidfile", "setstatefile", "setpid",
-  "setmmonits", "mmonitlist", "mmonit", "credentials", "setmailservers",
-  "setmailformat", "sethttpd", "mailserverlist", "mailserver", "httpdlist",
-  "httpdoption", "ssl", "optssllist", "optssl", "sslenable", "ssldisable",
-  "signature", "sigenable", "sigdisable", "bindaddress", "pemfile",
-  "clientpemfile", "allowselfcert", "allow", "$@1", "$@2", "$@3", "$@4",
-  "allowuserlist", "allowuser", "readonly", "checkproc", "checkfile",
-  "checkfilesys", "checkdir", "checkhost", "checksystem", "checkfifo",
-  "checkprogram", "start", "stop", "restart", "argumentlist",
+  "\"end of file\"", "error", "\"invalid token\"", "IF", "ELSE", "THEN",
+  "OR", "FAILED", "SET", "LOGFILE", "FACILITY", "DAEMON", "SYSLOG",
+  "MAILSERVER", "HTTPD", "ALLOW", "ADDRESS", "INIT", "READONLY",
+  "CLEARTEXT", "MD5HASH", "SHA1HASH", "SHA256HASH", "XXH64HASH", "CRYPT",
+  "DELAY", "PEMFILE", "ENABLE", "DISABLE", "HTTPDSSL", "CLIENTPEMFILE",
+  "ALLOWSELFCERTIFICATION", "IDFILE", "STATEFILE", "SEND", "EXPECT",
+  "EXPECTBUFFER", "CYCLE", "COUNT", "REMINDER", "PIDFILE", "START", "STOP",
+  "PATHTOK", "HOST", "HOSTNAME", "PORT", "TYPE", "UDP", "TCP", "TCPSSL",
+  "PROTOCOL", "CONNECTION", "ALERT", "NOALERT", "MAILFORMAT", "UNIXSOCKET",
+  "SIGNATURE", "TIMEOUT", "RETRY", "RESTART", "CHECKSUM", "EVERY",
+  "NOTEVERY", "DEFAULT", "HTTP", "APACHESTATUS", "FTP", "SMTP", "POP",
+  "IMAP", "CLAMAV", "NNTP", "NTP3", "MYSQL", "DNS", "SSH", "DWP", "LDAP2",
+  "LDAP3", "RDATE", "RSYNC", "TNS", "PGSQL", "POSTFIXPOLICY", "SIP",
+  "LMTP", "GPS", "RADIUS", "MEMCACHE", "STRING", "PATH", "MAILADDR",
+  "MAILFROM", "MAILREPLYTO", "MAILSUBJECT", "MAILBODY", "SERVICENAME",
+  "STRINGNAME", "NUMBER", "PERCENT", "LOGLIMIT", "CLOSELIMIT", "DNSLIMIT",
+  "KEEPALIVELIMIT", "REPLYLIMIT", "REQUESTLIMIT", "STARTLIMIT",
+  "WAITLIMIT", "GRACEFULLIMIT", "CLEANUPLIMIT", "REAL", "CHECKPROC",
+  "CHECKFILESYS", "CHECKFILE", "CHECKDIR", "CHECKHOST", "CHECKSYSTEM",
+  "CHECKFIFO", "CHECKPROGRAM", "CHILDREN", "SYSTEM", "STATUS", "RESOURCE",
+  "MEMORY", "TOTALMEMORY", "LOADAVG1", "LOADAVG5", "LOADAVG15", "SWAP",
+  "MODE", "ACTIVE", "PASSIVE", "MANUAL", "CPU", "TOTALCPU", "CPUUSER",
+  "CPUSYSTEM", "CPUWAIT", "GROUP", "REQUEST", "DEPENDS", "BASEDIR", "SLOT",
+  "EVENTQUEUE", "SECRET", "HOSTHEADER", "UID", "GID", "MMONIT", "INSTANCE",
+  "USERNAME", "PASSWORD", "TIMESTAMP", "CHANGED", "SECOND", "MINUTE",
+  "HOUR", "DAY", "SSLAUTO", "SSLV2", "SSLV3", "TLSV1", "CERTMD5", "BYTE",
+  "KILOBYTE", "MEGABYTE", "GIGABYTE", "INODE", "SPACE", "PERMISSION",
+  "SIZE", "MATCH", "NOT", "IGNORE", "ACTION", "UPTIME", "EXEC",
+  "UNMONITOR", "ICMP", "ICMPECHO", "NONEXIST", "EXIST", "INVALID", "DATA",
+  "RECOVERED", "PASSED", "SUCCEEDED", "URL", "CONTENT", "PID", "PPID",
+  "FSFLAG", "REGISTER", "CREDENTIALS", "URLOBJECT", "TARGET", "TIMESPEC",
+  "MAXFORWARD", "FIPS", "CGROUP", "CPUSTEAL", "CPUIRQ", "PRESSURECPU",
+  "PRESSUREMEMORY", "PRESSUREIO", "AVERAGE", "PERCENTILE", "SLOPE", "OVER",
+  "MILLISECOND", "RESPONSETIME", "RESOLVETIME", "CONNECTTIME", "TLSTIME",
+  "FIRSTBYTETIME", "KEEPALIVE", "PIDWATCH", "CONCURRENCY", "SESSION",
+  "FILES", "OLDEST", "NEWEST", "REFRESH", "GREATER", "LESS", "EQUAL",
+  "NOTEQUAL", "'{'", "'}'", "':'", "'@'", "$accept", "cfgfile",
+  "statement_list", "statement", "optproclist", "optproc", "optfilelist",
+  "optfile", "optfilesyslist", "optfilesys", "optdirlist", "optdir",
+  "opthostlist", "opthost", "optsystemlist", "optsystem", "optfifolist",
+  "optfifo", "optstatuslist", "optstatus", "setalert", "setdaemon",
+  "startdelay", "setexpectbuffer", "setkeepalive", "setpidwatch",
+  "setconcurrency", "setinit", "setfips", "setlog", "seteventqueue",
+  "setidfile", "setstatefile", "setpid", "setmmonits", "mmonitlist",
+  "mmonit", "credentials", "setmailservers", "setmailformat", "sethttpd",
+  "mailserverlist", "mailserver", "httpdlist", "httpdoption", "ssl",
+  "optssllist", "optssl", "sslenable", "ssldisable", "signature",
+  "sigenable", "sigdisable", "bindaddress", "controlsocket", "session",
+  "pemfile", "clientpemfile", "allowselfcert", "allow", "$@1", "$@2",
+  "$@3", "$@4", "allowuserlist", "allowuser", "readonly", "checkproc",
+  "checkfile", "checkfilesys", "checkdir", "checkhost", "checksystem",
+  "checkfifo", "checkprogram", "start", "stop", "restart", "argumentlist",
   "useroptionlist", "argument", "useroption", "username", "password",
   "hostname", "connection", "connectionunix", "icmp", "host", "port",
   "unixsocket", "type", "certmd5", "sslversion", "protocol",
@@ -1388,127 +1312,734 @@ static const char *const yytname[] =
   "nettimeout", "retry", "actionrate", "urloption", "urloperator", "alert",
   "alertmail", "noalertmail", "eventoptionlist", "eventoption",
   "formatlist", "formatoptionlist", "formatoption", "every", "mode",
-  "group", "depend", "dependlist", "dependant", "statusvalue",
+  "group", "cgroup", "depend", "dependlist", "dependant", "statusvalue",
   "resourceprocess", "resourceprocesslist", "resourceprocessopt",
   "resourcesystem", "resourcesystemlist", "resourcesystemopt",
-  "resourcecpuproc", "resourcecpu", "resourcecpuid", "resourcemem",
-  "resourceswap", "resourcechild", "resourceload", "resourceloadavg",
-  "value", "timestamp", "operator", "time", "action", "action1", "action2",
-  "rate1", "rate2", "recovery", "checksum", "hashtype", "inode", "space",
-  "fsflag", "unit", "permission", "match", "matchflagnot", "size", "uid",
-  "gid", "icmptype", "reminder", 0
+  "resourcecpuproc", "resourcecpu", "resourcecpuid", "resourcepressure",
+  "resourcepressureid", "resourcemem", "resourceswap", "resourcechild",
+  "resourceload", "resourceloadavg", "trend", "trendfunction",
+  "trendmetric", "trendlimit", "trendunit", "timing", "timingphase",
+  "timingunit", "value", "timestamp", "tree", "treerefresh", "treepattern",
+  "operator", "time", "action", "action1", "action2", "rate1", "rate2",
+  "recovery", "checksum", "hashtype", "inode", "space", "fsflag", "unit",
+  "permission", "match", "matchflagnot", "size", "uid", "gid", "icmptype",
+  "reminder", YY_NULLPTR
 };
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
 #endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+#define YYPACT_NINF (-734)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-243)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   123,   125,    58,    64
+     260,   348,   -45,   -37,   -11,     2,    70,   101,   108,   118,
+     138,   260,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,   692,  -734,  -734,  -734,    43,    47,
+      31,   127,  -734,   207,   213,    86,   215,   216,    83,    98,
+     126,   107,  -734,   270,  -734,   -38,    41,   304,   307,   321,
+     329,  -734,   324,   327,  -734,  -734,   281,   563,   697,    25,
+      58,   166,   166,   310,   166,   -56,   197,   254,   312,   303,
+     692,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+     -36,  -734,  -734,  -734,  -734,  -734,  -734,  -734,   868,   823,
+     884,   398,  -734,   380,   -33,    19,  -734,   320,  -734,  -734,
+     337,  -734,  -734,   431,   333,   330,   373,   126,   263,   342,
+     359,   208,   251,   722,   443,   395,   405,   358,   407,   415,
+     437,   432,   444,   447,   433,   482,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,    18,   406,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,   121,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,    33,   487,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,    -9,   533,   399,  -734,   522,  -734,  -734,
+    -734,  -734,  -734,  -734,   308,   235,  -734,  -734,   201,  -734,
+     201,  -734,   201,   547,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,   303,  -734,  -734,   396,   722,   443,   830,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,    49,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,   -26,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,   541,   609,  -734,
+     553,    64,   501,   555,  -734,   612,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,   -49,  -734,   520,  -734,
+     416,   263,   473,  -734,  -734,   510,   431,   722,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+     485,  -734,   571,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,   613,     6,   235,   235,   235,  -734,  -734,
+    -734,   235,   235,   248,   235,   754,  -734,  -734,  -734,  -734,
+    -734,   235,  -734,   265,   235,   129,   235,   399,   507,  -734,
+     508,   149,   481,   235,   235,   529,   513,   513,   513,   513,
+     650,   598,   643,   496,   646,   595,   597,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,   488,  -734,  -734,  -734,
+    -734,  -734,   -16,   599,   161,   177,    -4,  -734,  -734,  -734,
+      -4,  -734,    -4,  -734,  -734,  -734,   722,   536,  -734,   235,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,   846,  -734,
+    -734,   235,  -734,   235,  -734,  -734,  -734,   235,  -734,   600,
+     550,  -734,  -734,   615,   416,   548,   618,  -734,    74,  -734,
+    -734,   610,  -734,  -734,  -734,  -734,   558,  -734,  -734,  -734,
+      88,   620,   655,  -734,   679,   619,  -734,   631,   677,   632,
+     163,   203,   636,   637,   597,   597,   641,    21,  -734,   725,
+     -16,  -734,  -734,  -734,  -734,   256,   292,   642,   683,   648,
+     597,   597,   687,   654,   384,   454,   597,   657,   243,   659,
+     235,   235,   235,   235,  -734,  -734,   578,   723,   573,   664,
+     677,   727,   761,   670,  -734,  -734,   -22,   616,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,   671,   655,   252,  -734,
+     767,   676,   -16,   678,  -734,   501,  -734,   558,  -734,  -734,
+      14,   686,   140,   206,   521,   688,   524,   720,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+     691,  -734,  -734,   655,   443,  -734,   627,  -734,   492,   302,
+    -734,   684,   337,   685,   337,   689,   698,   781,   782,   472,
+    -734,   751,    69,  -734,   597,   597,   597,   597,   597,    24,
+     472,   787,   795,   597,   337,   597,   597,  -734,  -734,   797,
+     455,   705,   337,  -734,   707,   708,   709,   714,  -734,   715,
+     373,   369,   373,  -734,   302,   810,    69,   779,  -734,  -734,
+     597,  -734,   655,   443,   717,   337,    69,   728,   729,   597,
+     416,  -734,   732,   734,   739,   590,   742,   744,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,   736,   366,
+     366,  -734,   443,  -734,  -734,  -734,  -734,   416,   747,   749,
+    1010,   373,   564,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+      69,    69,  -734,  -734,  -734,  -734,   597,  -734,  -734,  -734,
+    -734,  -734,   166,  -734,  -734,   836,   838,   851,   852,   853,
+     854,   776,   862,   597,    69,    69,   863,   597,   879,   885,
+      69,   597,   886,   597,   597,   337,   597,   472,   472,  -734,
+     597,  -734,  -734,   783,   792,   373,    22,   836,   235,   889,
+     443,  -734,  -734,  -734,   836,  -734,  -734,   890,   558,   806,
+     812,   814,   817,   818,   897,   765,   832,   833,  -734,  -734,
+    -734,  -734,  -734,  -734,   558,  -734,  -734,  -734,   793,   951,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,   731,  -734,
+    -734,   789,  -734,   792,  -734,  -734,  -734,   927,   -21,   932,
+    -734,    69,    69,    69,    69,    69,   597,    69,   931,  -734,
+    -734,    69,   934,    69,    69,  -734,   935,    69,   936,   937,
+     597,   938,   597,   597,   946,  -734,   861,   597,   792,  -734,
+    -734,  -734,   -16,    69,  -734,  -734,    69,  -734,   818,   818,
+     818,   897,  -734,   818,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,   870,  -734,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   957,  -734,   211,   771,   875,  -734,   597,
+      69,   471,   229,   836,   836,   836,   836,   836,   947,   836,
+      69,  -734,    69,  -734,  -734,    69,   836,    69,    69,   971,
+      69,   972,   984,    69,  -734,   985,   597,   597,   240,   836,
+     836,   818,   818,   818,  -734,  -734,     7,   892,   893,   894,
+     899,   900,   901,   902,   903,   904,   905,   951,  -734,  -734,
+     906,  -734,  -734,  1001,   836,   909,   909,   909,  -734,  -734,
+    -734,  -734,  -734,    69,  -734,   836,   836,   836,  -734,   836,
+     836,    69,   836,    69,    69,   836,    69,  1008,  1009,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,   925,
+     926,  -734,   920,   921,   922,   924,   929,   930,   943,   944,
+     945,   962,  -734,  -734,    69,  -734,    37,  1041,  1058,  1059,
+     836,  -734,  -734,  -734,  -734,  -734,   836,  -734,   836,   836,
+    -734,   836,    69,    69,   923,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,   836,  -734,  1028,    69,
+      69,    69,  -734,  -734,  -734,  -734,  -734,   836,   836,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       2,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     3,     4,     6,     7,    17,    20,    21,    22,    18,
+      19,     8,     9,    15,    16,    14,    10,    11,    12,    13,
+      31,    52,    71,    89,     0,   123,   135,   151,     0,     0,
+       0,     0,   174,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   175,   170,   172,   408,     0,     0,     0,     0,
+       0,   258,     0,     0,     1,     5,    23,    24,    25,    26,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      27,   107,   109,   110,   111,   113,   114,   112,   115,   116,
+     408,   381,   117,   118,   119,   120,   121,   122,    28,    29,
+      30,   177,   176,   167,   277,   368,   194,     0,   182,   183,
+     550,   184,   382,     0,     0,     0,   368,   185,   189,     0,
+       0,     0,     0,     0,   569,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    32,    33,    34,    35,
+      40,    41,    36,    37,    38,    39,    42,    43,    44,    45,
+      46,    49,    47,    48,    50,    51,   560,   560,    53,    54,
+      55,    56,    57,    59,    61,    60,    68,    69,    70,    58,
+      65,    62,    67,    66,    63,    64,     0,    72,    73,    74,
+      75,    76,    77,    79,    78,    83,    84,    85,    86,    87,
+      88,    80,    81,    82,     0,     0,    90,    91,    92,    93,
+      94,    98,   100,    99,   104,   105,   106,    95,    96,    97,
+     101,   102,   103,   288,     0,     0,   468,     0,   470,   489,
+     490,   491,   492,   493,     0,   507,   271,   272,   364,   267,
+     364,   383,   364,     0,   417,   418,   419,   420,   421,   422,
+     427,   424,   425,   108,     0,     0,   569,     0,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,     0,
+     136,   137,   138,   139,   140,   142,   144,   143,   148,   149,
+     150,   141,   145,   146,   147,     0,   152,   153,   154,   155,
+     157,   156,   158,   159,   160,   161,   162,     0,     0,   166,
+       0,     0,   280,     0,   195,   282,   198,   551,   552,   553,
+     554,   169,   412,   413,   414,   415,     0,   410,   179,   181,
+     298,   189,     0,   186,   173,     0,     0,     0,   388,   404,
+     387,   403,   401,   406,   393,   395,   405,   398,   402,   386,
+     407,   391,   394,   397,   396,   390,   389,   399,   400,   392,
+       0,   384,     0,   163,   250,   251,   252,   253,   255,   254,
+     256,   257,   259,   366,   288,   507,   507,   507,   464,   465,
+     466,   507,   507,     0,   507,   527,   430,   432,   433,   434,
+     435,   507,   423,   540,   507,   540,   507,   561,     0,   561,
+       0,     0,     0,   507,   507,     0,   505,   505,   505,   505,
+       0,     0,     0,     0,     0,     0,   527,   469,   475,   473,
+     474,   476,   477,   471,   472,   478,     0,   512,   508,   509,
+     510,   511,     0,     0,     0,     0,   364,   268,   269,   261,
+     364,   263,   364,   265,   416,   426,     0,     0,   378,   507,
+     447,   448,   449,   450,   451,   453,   454,   455,   527,   437,
+     442,   507,   443,   507,   440,   441,   439,   507,   178,     0,
+     277,   279,   278,     0,   298,     0,     0,   191,   193,   192,
+     411,     0,   302,   299,   300,   301,   296,   187,   190,   171,
+       0,     0,   408,   385,   570,     0,   260,     0,   292,     0,
+       0,     0,     0,     0,   527,   527,     0,     0,   431,     0,
+       0,   541,   542,   543,   544,     0,     0,     0,     0,     0,
+     527,   527,     0,     0,     0,     0,   527,     0,     0,     0,
+     507,   507,   507,   507,   504,   289,     0,   362,   374,     0,
+     292,     0,     0,     0,   497,   496,     0,     0,   273,   275,
+     274,   276,   270,   262,   264,   266,     0,   408,     0,   438,
+       0,     0,     0,     0,   168,   280,   281,   296,   369,   283,
+       0,     0,     0,     0,     0,     0,     0,   225,   199,   200,
+     208,   208,   201,   217,   218,   202,   203,   204,   205,   180,
+       0,   188,   409,   408,   569,   571,     0,   291,     0,   303,
+     462,   497,   550,   497,   550,     0,     0,     0,     0,   513,
+     528,     0,     0,   463,   527,   527,   527,   527,   527,   527,
+     513,     0,     0,   527,   550,   527,   527,   559,   558,     0,
+     527,   497,   550,   506,     0,     0,     0,     0,   568,     0,
+     368,     0,   368,   290,   303,     0,     0,     0,   495,   494,
+     527,   365,   408,   569,   497,   550,     0,     0,     0,   527,
+     298,   196,     0,     0,     0,   244,   232,     0,   223,   214,
+     220,   216,   222,   213,   215,   224,   219,   221,     0,   207,
+     206,   297,   569,   164,   367,   295,   293,   298,     0,     0,
+       0,   368,   330,   331,   457,   456,   459,   458,   444,   445,
+       0,     0,   514,   515,   516,   517,   527,   529,   522,   523,
+     518,   521,     0,   524,   525,   533,     0,     0,     0,     0,
+       0,     0,     0,   527,     0,     0,     0,   527,     0,     0,
+       0,   527,     0,   527,   527,   550,   527,   513,   513,   363,
+     527,   376,   377,     0,   370,   368,     0,   533,   507,     0,
+     569,   379,   461,   460,   533,   446,   452,     0,   296,   233,
+     234,   235,     0,     0,   248,     0,     0,     0,   229,   209,
+     210,   211,   212,   165,   296,   333,   334,   305,   340,     0,
+     308,   320,   319,   310,   311,   316,   317,   314,   306,   321,
+     307,   312,   313,   322,   323,   324,   325,   318,   335,   326,
+     327,     0,   329,   370,   332,   359,   360,     0,   519,     0,
+     429,     0,     0,     0,     0,     0,   527,     0,     0,   499,
+     563,     0,     0,     0,     0,   549,     0,     0,     0,     0,
+     527,     0,   527,   527,     0,   375,     0,   527,   370,   373,
+     372,   358,     0,     0,   380,   436,     0,   197,     0,     0,
+       0,   248,   247,   237,   245,   249,   231,   226,   227,   228,
+     294,     0,   309,   507,   507,   507,   507,   507,   507,   507,
+     507,   507,   507,   304,   346,     0,   338,     0,   328,   527,
+       0,   520,     0,   533,   533,   533,   533,   533,     0,   533,
+       0,   539,     0,   557,   556,     0,   533,     0,     0,     0,
+       0,     0,     0,     0,   371,     0,   527,   527,   480,   533,
+     533,   239,   241,   243,   230,   246,   343,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   337,   336,
+       0,   315,   345,     0,   533,   530,   530,   530,   564,   565,
+     566,   567,   555,     0,   537,   533,   533,   533,   545,   533,
+     533,     0,   533,     0,     0,   533,     0,     0,     0,   481,
+     483,   484,   485,   486,   487,   482,   479,   488,   428,     0,
+       0,   341,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   347,   339,     0,   361,     0,     0,     0,     0,
+     533,   498,   562,   546,   548,   547,   533,   500,   533,   533,
+     287,   533,     0,     0,   343,   344,   348,   349,   350,   351,
+     352,   353,   354,   355,   356,   357,   533,   531,     0,     0,
+       0,     0,   538,   501,   502,   503,   285,   533,   533,   342,
+     286,   532,   526,   534,   535,   536,   284,   467
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -734,  -734,  -734,  1055,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,   987,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,   953,   757,  -734,  -734,
+    -734,  -734,   995,  -734,  -734,  -734,   540,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -364,  -733,   271,  -734,  -734,  -734,
+    -734,  -734,  -734,  -734,  -734,   378,   385,   503,   -72,  -226,
+    -225,  -404,   653,   559,  -734,  1039,  -734,  -734,  -734,  -734,
+    -734,   586,  -517,  -423,   483,  -734,   436,  -734,  -734,  -734,
+     125,  -734,  -734,   204,   421,  -734,  -734,  -734,  -734,  -139,
+    -734,  -115,  -726,   850,  -734,  -734,   912,  1109,  -734,  -192,
+    -303,   -82,   796,  -274,   919,   523,   928,  -734,   973,  -734,
+     872,  -734,  -734,  -734,   750,  -734,  -734,   680,  -734,  -734,
+    -734,  -734,  -734,  -237,  -734,  -734,  -224,  -734,    76,  -734,
+    -734,  -734,  -734,  1048,  -734,  -734,  -466,    96,  -734,  -734,
+     226,  -335,  -493,  -350,  -565,  -358,  -387,  -280,  -396,  -734,
+     741,  -734,  -734,  -734,  -252,    94,  -734,   960,  -734,   181,
+     210,  -734,  -235
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    10,    11,    12,    66,   136,    67,   158,    68,   177,
+      69,   196,    80,    81,    98,   248,    99,   260,   100,   276,
+      13,    14,   289,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,   117,   118,   313,    27,    28,
+      29,   105,   106,   458,   558,   559,   659,   749,   560,   561,
+     562,   563,   564,   565,   566,   567,   750,   751,   752,   568,
+     743,   828,   829,   830,   833,   834,   836,    30,    31,    32,
+      33,    34,    35,    36,    37,    82,    83,    84,   228,   416,
+     229,   418,   292,   454,   457,    85,   141,    86,   394,   520,
+     478,   579,   571,   466,   671,   672,   673,   856,   911,   842,
+     951,   858,   853,   854,    87,   143,   144,   145,   620,   419,
+     476,   295,   817,    88,   622,   723,    89,    90,    91,   340,
+     341,   124,   306,   307,    92,    93,    94,   151,    95,   241,
+     242,   286,   153,   365,   366,   257,   438,   439,   367,   440,
+     441,   442,   443,   368,   445,   369,   370,   371,    96,   224,
+     406,   887,   946,    97,   225,   630,   526,   169,   208,   209,
+     510,   412,   686,   694,   695,  1013,   489,   967,   790,   170,
+     498,   188,   189,   190,   301,   171,   172,   378,   173,   174,
+     175,   517,   343
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     230,   310,   232,   417,   420,   417,   422,   417,   246,   522,
+     444,   428,   532,   290,   582,   584,   532,   121,   532,   121,
+     479,   480,   481,   446,   593,   373,   482,   483,   194,   486,
+     641,   547,   460,   642,   643,   391,   490,   473,   644,   499,
+     381,   503,   612,   233,   302,   303,   304,   305,   507,   508,
+     391,   540,    56,   427,   413,   101,   381,   859,   590,   701,
+      57,   727,   477,   688,   689,   213,    71,    72,   949,   226,
+     227,   734,   635,   214,   997,   690,   638,   293,    47,    73,
+     819,   125,   691,   524,   126,    74,    58,    75,    76,   550,
+     551,   421,   886,   423,   538,   525,   447,   587,   588,    59,
+     895,   552,   553,   554,   645,   646,   541,   703,   542,   104,
+     688,   689,   543,   601,   602,   785,   786,   214,   291,   609,
+     591,   104,   690,   487,   473,   471,   414,   415,   381,   691,
+     555,   556,   214,   628,   102,   122,   998,   244,    64,   799,
+     800,   234,   154,   414,   415,   805,   103,   215,   214,   491,
+     492,   493,   494,   950,   451,    77,   452,   214,   895,   895,
+     895,   820,   191,   210,    78,   207,    79,    60,   473,   649,
+     392,   374,   375,   107,   258,   614,   615,   616,   617,   393,
+     459,   302,   303,   304,   305,   110,   374,   385,   629,   376,
+     123,   377,   245,   272,   393,   271,   460,   650,    61,   692,
+     693,   444,   374,   385,   386,    62,   215,   696,   697,   698,
+     699,   700,   702,   127,   446,    63,   706,   738,   708,   709,
+     214,   827,   215,   712,   812,   813,   863,   864,   865,   866,
+     867,   215,   869,   473,   536,   651,   871,   840,   873,   874,
+     114,   115,   876,   729,   754,   647,   692,   693,   195,   192,
+     211,   528,   737,   387,   388,   389,   226,   227,   889,   413,
+     529,   890,   581,   652,   216,   217,   218,   530,     1,   219,
+     220,   221,   222,   223,   525,   382,   531,   533,   193,   212,
+     273,   534,   500,   535,   134,   491,   492,   493,   494,   383,
+     384,   226,   227,   557,   215,   914,   495,   496,   108,   787,
+     501,   908,   583,   909,   109,   925,   111,   926,   112,   274,
+     927,   113,   929,   930,   525,   932,   798,   572,   935,   497,
+     802,   116,    71,    72,   806,   119,   808,   809,   120,   811,
+     675,   821,   677,   814,    47,    73,   668,   669,   825,   663,
+     939,    74,   611,    75,    76,   131,   594,   128,   414,   415,
+     129,   634,   707,   670,   525,   595,   888,    38,   970,    39,
+     714,    40,    41,   525,   130,    42,   976,   132,   978,   979,
+     133,   981,     2,     3,     4,     5,     6,     7,     8,     9,
+      43,    44,   596,   733,    45,   236,   237,   238,    46,   407,
+     574,   597,   746,   822,   235,   940,   747,   748,   731,   996,
+     240,    47,   231,    48,   941,   942,   943,   944,   287,   868,
+     239,    77,   495,   496,   915,   916,   917,  1007,  1008,   296,
+      78,   288,    79,   879,   308,   881,   882,   753,   398,   309,
+     885,   293,   399,   400,   401,   497,   316,   402,   484,   485,
+     354,   314,   403,   404,   137,   159,   178,   197,   346,   347,
+     945,   138,   160,   179,   198,   633,   312,   532,   315,   408,
+     409,   410,   411,   810,   891,   892,   893,   918,   919,   920,
+     921,   922,   913,   924,   605,   606,   249,   261,   277,   317,
+     928,   135,   342,   250,   262,   278,   344,   142,   162,   181,
+     200,   662,    49,   947,   948,   824,   345,    50,   348,   937,
+     938,   297,   298,   299,   300,   720,   349,   724,   897,   898,
+     899,   900,   901,   902,   903,   904,   905,   906,   965,   405,
+     264,   280,   351,    51,   302,   303,   304,   305,   350,   971,
+     972,   973,   214,   974,   975,   352,   977,   318,   353,   980,
+     665,   666,   667,   319,   607,   608,   320,    52,   653,   654,
+     730,   656,   657,   355,   487,   711,   783,   356,   357,   358,
+     359,   360,   861,   417,    53,    54,   156,   361,   362,   139,
+     161,   180,   199,   372,  1002,   462,   463,   464,   465,   379,
+    1003,   396,  1004,  1005,   424,  1006,   390,   363,   318,   149,
+     166,   185,   204,   395,   319,   721,   722,   320,   668,   669,
+    1010,   251,   263,   279,    71,    72,   215,   321,   322,   364,
+     818,  1016,  1017,   511,   512,   513,    47,    73,   414,   415,
+     788,   397,   268,    74,   426,    75,    76,   682,   683,   684,
+     685,   448,   323,   324,   449,   325,   968,   969,   326,   216,
+     217,   218,  1014,  1015,   219,   220,   221,   222,   223,  1012,
+    1012,  1012,   450,   453,   455,   327,   328,   456,   321,   322,
+     329,   330,   331,   461,   332,   469,   333,   468,   334,   335,
+     474,   475,   318,   506,   336,   337,   338,   339,   319,   504,
+     505,   320,   500,   323,   324,   509,   325,   514,   515,   326,
+     516,   518,   519,    77,   521,    70,   487,   523,   527,   544,
+     176,   291,    78,   548,    79,   546,   327,   328,   549,   569,
+     121,   329,   330,   331,   472,   332,   575,   333,   576,   334,
+     335,   570,   577,   318,   578,   336,   337,   338,   339,   319,
+     592,   580,   320,    71,    72,   585,   586,   157,    71,    72,
+     589,   598,   321,   322,   599,    47,    73,   600,   603,   613,
+      47,    73,    74,   604,    75,    76,   610,    74,   618,    75,
+      76,   619,   621,   623,   625,   537,   626,   323,   324,   627,
+     325,   631,   636,   326,   318,   637,   648,   639,   658,   655,
+     319,   661,   664,   320,   674,   676,   680,   681,   687,   678,
+     327,   328,   704,   321,   322,   329,   330,   331,   679,   332,
+     705,   333,   710,   334,   335,   713,   715,   716,   717,   336,
+     337,   338,   339,   718,   719,   726,   728,   732,   323,   324,
+     742,   325,    77,   739,   326,   740,   259,    77,   735,   736,
+     741,    78,  -236,    79,   744,   745,    78,   755,    79,   756,
+     789,   327,   328,   791,   321,   322,   329,   330,   331,   573,
+     332,   816,   333,   487,   334,   335,   792,   793,   794,   795,
+     336,   337,   338,   339,    71,    72,   796,   797,   801,   323,
+     324,   247,   325,   815,   355,   326,    47,    73,   356,   357,
+     358,   359,   360,    74,   803,    75,    76,   275,   361,   362,
+     804,   807,   327,   328,   823,   826,  -238,   329,   330,   331,
+     632,   332,  -240,   333,  -242,   334,   335,   831,   832,    71,
+      72,   336,   337,   338,   339,   835,   146,   163,   182,   201,
+     837,    47,    73,   838,   839,    71,    72,   855,    74,   214,
+      75,    76,   860,   841,   857,   862,   870,    47,    73,   872,
+     875,   877,   878,   880,    74,   487,    75,    76,   252,   265,
+     281,   883,   923,    77,   356,   357,   358,   359,   360,   429,
+     884,   896,    78,   907,    79,   912,   430,   431,   432,   910,
+     356,   357,   358,   359,   360,   429,   931,   933,   147,   164,
+     183,   202,   430,   431,   432,   148,   165,   184,   203,   934,
+     936,   952,   953,   954,   150,   167,   186,   205,   955,   956,
+     957,   958,   959,   960,   961,   963,   964,    78,   966,    79,
+     253,   266,   282,   982,   983,   984,   985,   254,   267,   283,
+     986,   987,   988,    78,   989,    79,   255,   269,   284,   990,
+     991,   433,   434,   435,   436,   437,   216,   217,   218,   152,
+     168,   187,   206,   992,   993,   994,   999,   433,   434,   435,
+     436,   437,   843,   844,   845,   846,   847,   848,   849,   850,
+     851,   852,   995,  1000,  1001,  1011,    65,   243,   467,   950,
+     311,   256,   270,   285,   757,   758,   759,   760,   761,   762,
+     763,   764,   765,   766,   767,   768,   769,   770,   771,   772,
+     773,   774,   775,   776,   777,   778,   779,   780,   781,   782,
+     294,   660,   894,   545,   640,   140,   624,   725,   784,  1009,
+      55,   962,   470,   425,   155,   488,   502,   380,   539
+};
+
+static const yytype_int16 yycheck[] =
+{
+      72,   116,    74,   228,   230,   230,   232,   232,    90,   396,
+     247,   246,   416,    46,   480,   481,   420,    55,   422,    55,
+     355,   356,   357,   247,   490,     7,   361,   362,     3,   364,
+     547,   454,   306,    19,    20,    44,   371,   340,    24,   374,
+       7,   376,   508,    99,    93,    94,    95,    96,   383,   384,
+      44,   438,    97,   245,    58,    12,     7,   783,    37,    35,
+      97,   626,    56,    41,    42,     7,    41,    42,    61,    90,
+      91,   636,   538,    99,    37,    53,   542,    58,    53,    54,
+      58,    40,    60,    99,    43,    60,    97,    62,    63,    15,
+      16,   230,   818,   232,   429,   111,   122,   484,   485,    97,
+     833,    27,    28,    29,    90,    91,   441,   600,   443,    90,
+      41,    42,   447,   500,   501,   680,   681,    99,   151,   506,
+      99,    90,    53,    99,   427,   317,   147,   148,     7,    60,
+      56,    57,    99,   155,    91,   173,    99,   173,     0,   704,
+     705,   197,    66,   147,   148,   710,    99,   173,    99,    20,
+      21,    22,    23,   146,    90,   130,    92,    99,   891,   892,
+     893,   726,    68,    69,   139,    69,   141,    97,   471,    29,
+     179,   153,   154,    46,    98,   510,   511,   512,   513,   188,
+     229,    93,    94,    95,    96,    99,   153,   154,   210,   171,
+     228,   173,   228,    99,   188,    99,   470,    57,    97,   177,
+     178,   438,   153,   154,   171,    97,   173,   594,   595,   596,
+     597,   598,   599,   172,   438,    97,   603,   640,   605,   606,
+      99,   738,   173,   610,   717,   718,   791,   792,   793,   794,
+     795,   173,   797,   536,   426,    29,   801,   754,   803,   804,
+     142,   143,   807,   630,   667,   231,   177,   178,   223,    68,
+      69,    90,   639,   220,   221,   222,    90,    91,   823,    58,
+      99,   826,    99,    57,   206,   207,   208,    90,     8,   211,
+     212,   213,   214,   215,   111,   154,    99,   416,    68,    69,
+      99,   420,   153,   422,     3,    20,    21,    22,    23,   168,
+     169,    90,    91,   219,   173,   860,   147,   148,    91,   686,
+     171,    90,    99,    92,    91,   870,    91,   872,    92,    99,
+     875,   228,   877,   878,   111,   880,   703,   229,   883,   170,
+     707,   195,    41,    42,   711,   218,   713,   714,    58,   716,
+     582,   727,   584,   720,    53,    54,    34,    35,   734,   574,
+     100,    60,    99,    62,    63,    16,    90,    43,   147,   148,
+      43,    99,   604,    51,   111,    99,   822,     9,   923,    11,
+     612,    13,    14,   111,    43,    17,   931,    43,   933,   934,
+      43,   936,   112,   113,   114,   115,   116,   117,   118,   119,
+      32,    33,    90,   635,    36,   131,   132,   133,    40,   154,
+     472,    99,    26,   728,   197,   155,    30,    31,   633,   964,
+      97,    53,    92,    55,   164,   165,   166,   167,    10,   796,
+      98,   130,   147,   148,   185,   186,   187,   982,   983,    99,
+     139,    41,   141,   810,    91,   812,   813,   662,   120,    99,
+     817,    58,   124,   125,   126,   170,   228,   129,   190,   191,
+       7,    99,   134,   135,    66,    67,    68,    69,    90,    91,
+     210,    66,    67,    68,    69,   537,   193,   861,    99,   224,
+     225,   226,   227,   715,   828,   829,   830,   863,   864,   865,
+     866,   867,   859,   869,    90,    91,    98,    99,   100,   228,
+     876,   200,    39,    98,    99,   100,    91,    66,    67,    68,
+      69,   573,   144,   889,   890,   730,    91,   149,    91,   886,
+     887,   164,   165,   166,   167,   620,    91,   622,   843,   844,
+     845,   846,   847,   848,   849,   850,   851,   852,   914,   211,
+      99,   100,    90,   175,    93,    94,    95,    96,    91,   925,
+     926,   927,    99,   929,   930,    91,   932,    52,    91,   935,
+      48,    49,    50,    58,    90,    91,    61,   199,    27,    28,
+     632,    27,    28,   120,    99,   100,   671,   124,   125,   126,
+     127,   128,   788,   788,   216,   217,     3,   134,   135,    66,
+      67,    68,    69,    91,   970,   159,   160,   161,   162,   173,
+     976,   182,   978,   979,    37,   981,    99,   154,    52,    66,
+      67,    68,    69,    60,    58,   226,   227,    61,    34,    35,
+     996,    98,    99,   100,    41,    42,   173,   122,   123,   176,
+     725,  1007,  1008,   387,   388,   389,    53,    54,   147,   148,
+     692,    99,    99,    60,   228,    62,    63,   155,   156,   157,
+     158,    90,   147,   148,    25,   150,   916,   917,   153,   206,
+     207,   208,  1000,  1001,   211,   212,   213,   214,   215,   999,
+    1000,  1001,    99,   152,    99,   170,   171,    45,   122,   123,
+     175,   176,   177,   143,   179,   155,   181,   194,   183,   184,
+      99,    58,    52,   192,   189,   190,   191,   192,    58,   172,
+     172,    61,   153,   147,   148,   172,   150,    37,    90,   153,
+      47,   195,    46,   130,    99,     3,    99,   209,    99,    99,
+       3,   151,   139,   155,   141,    90,   170,   171,    90,    99,
+      55,   175,   176,   177,   229,   179,    37,   181,    99,   183,
+     184,   163,    91,    52,    47,   189,   190,   191,   192,    58,
+       5,    99,    61,    41,    42,    99,    99,   174,    41,    42,
+      99,    99,   122,   123,    61,    53,    54,    99,    61,    90,
+      53,    54,    60,    99,    62,    63,    99,    60,   180,    62,
+      63,    38,   189,    99,    37,   229,     5,   147,   148,    99,
+     150,   155,     5,   153,    52,    99,    90,    99,    58,    91,
+      58,    90,   155,    61,   100,   100,     5,     5,    37,   100,
+     170,   171,     5,   122,   123,   175,   176,   177,   100,   179,
+       5,   181,     5,   183,   184,   100,    99,    99,    99,   189,
+     190,   191,   192,    99,    99,     5,    37,   100,   147,   148,
+     230,   150,   130,    91,   153,    91,     3,   130,   100,   100,
+      91,   139,    90,   141,    90,    99,   139,    90,   141,    90,
+       4,   170,   171,     5,   122,   123,   175,   176,   177,   229,
+     179,    59,   181,    99,   183,   184,     5,     5,     5,     5,
+     189,   190,   191,   192,    41,    42,    90,     5,     5,   147,
+     148,     3,   150,    90,   120,   153,    53,    54,   124,   125,
+     126,   127,   128,    60,     5,    62,    63,     3,   134,   135,
+       5,     5,   170,   171,     5,     5,    90,   175,   176,   177,
+     229,   179,    90,   181,    90,   183,   184,    90,    90,    41,
+      42,   189,   190,   191,   192,    18,    66,    67,    68,    69,
+     155,    53,    54,    91,    91,    41,    42,   196,    60,    99,
+      62,    63,     5,   140,   145,     3,     5,    53,    54,     5,
+       5,     5,     5,     5,    60,    99,    62,    63,    98,    99,
+     100,     5,     5,   130,   124,   125,   126,   127,   128,   129,
+      99,    91,   139,     6,   141,    90,   136,   137,   138,   198,
+     124,   125,   126,   127,   128,   129,     5,     5,    66,    67,
+      68,    69,   136,   137,   138,    66,    67,    68,    69,     5,
+       5,    99,    99,    99,    66,    67,    68,    69,    99,    99,
+      99,    99,    99,    99,    99,    99,     5,   139,    99,   141,
+      98,    99,   100,     5,     5,    90,    90,    98,    99,   100,
+     100,   100,   100,   139,   100,   141,    98,    99,   100,   100,
+     100,   201,   202,   203,   204,   205,   206,   207,   208,    66,
+      67,    68,    69,   100,   100,   100,     5,   201,   202,   203,
+     204,   205,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   110,   100,     5,     5,    37,    11,    80,   311,   146,
+     117,    98,    99,   100,    64,    65,    66,    67,    68,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
+     105,   561,   831,   450,   545,    66,   520,   624,   672,   984,
+       1,   907,   316,   241,    66,   365,   375,   157,   438
 };
-# endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   206,   207,   207,   208,   208,   209,   209,   209,   209,
-     209,   209,   209,   209,   209,   209,   209,   209,   209,   209,
-     209,   209,   209,   209,   209,   209,   209,   209,   210,   210,
-     211,   211,   211,   211,   211,   211,   211,   211,   211,   211,
-     211,   211,   211,   211,   211,   211,   212,   212,   213,   213,
-     213,   213,   213,   213,   213,   213,   213,   213,   213,   213,
-     213,   213,   213,   213,   213,   214,   214,   215,   215,   215,
-     215,   215,   215,   215,   215,   215,   215,   215,   215,   215,
-     215,   215,   215,   216,   216,   217,   217,   217,   217,   217,
-     217,   217,   217,   217,   217,   217,   217,   217,   217,   218,
-     218,   219,   219,   219,   219,   219,   219,   219,   219,   219,
-     219,   219,   219,   220,   220,   221,   221,   221,   221,   221,
-     221,   221,   221,   221,   222,   222,   223,   223,   223,   223,
-     223,   223,   223,   223,   223,   223,   223,   223,   223,   223,
-     224,   224,   225,   225,   225,   225,   225,   225,   225,   225,
-     225,   225,   226,   226,   226,   227,   228,   228,   229,   230,
-     231,   232,   232,   232,   233,   233,   233,   234,   235,   236,
-     237,   238,   238,   239,   240,   240,   241,   242,   243,   244,
-     244,   245,   245,   246,   246,   247,   247,   247,   247,   248,
-     248,   249,   249,   250,   250,   250,   251,   251,   252,   252,
-     253,   253,   254,   254,   255,   255,   256,   257,   258,   259,
-     260,   260,   260,   260,   260,   260,   261,   260,   262,   260,
-     263,   260,   264,   260,   260,   265,   265,   266,   267,   267,
-     268,   268,   268,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   276,   277,   277,   278,   278,   279,   279,   280,
-     280,   281,   281,   282,   282,   282,   282,   283,   283,   283,
-     284,   284,   285,   285,   286,   286,   287,   288,   289,   289,
-     290,   291,   292,   292,   292,   292,   293,   293,   294,   294,
-     294,   294,   294,   295,   295,   295,   295,   295,   295,   295,
-     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
-     295,   295,   295,   295,   295,   295,   295,   295,   295,   295,
-     295,   296,   296,   297,   297,   298,   298,   298,   299,   299,
-     300,   300,   300,   301,   301,   302,   303,   303,   304,   304,
-     304,   304,   304,   304,   304,   304,   304,   304,   305,   306,
-     307,   308,   309,   309,   310,   310,   311,   311,   312,   312,
-     313,   313,   314,   314,   315,   315,   316,   316,   317,   317,
-     317,   317,   318,   319,   320,   320,   321,   321,   321,   321,
-     321,   321,   321,   321,   321,   321,   321,   321,   321,   321,
-     321,   321,   321,   321,   321,   321,   321,   321,   322,   322,
-     323,   323,   324,   324,   324,   324,   325,   325,   325,   326,
-     326,   326,   327,   328,   329,   329,   330,   331,   332,   333,
-     333,   334,   334,   334,   334,   335,   336,   336,   337,   337,
-     337,   337,   338,   338,   339,   340,   340,   340,   341,   341,
-     341,   341,   342,   342,   343,   344,   345,   345,   345,   346,
-     346,   347,   347,   348,   348,   348,   348,   348,   348,   349,
-     349,   349,   349,   349,   350,   350,   350,   350,   350,   350,
-     350,   351,   352,   353,   353,   353,   354,   354,   354,   355,
-     355,   355,   355,   356,   356,   356,   357,   357,   357,   358,
-     358,   359,   359,   360,   361,   361,   361,   361,   361,   362,
-     363,   363,   363,   363,   364,   364,   365,   365,   366,   366,
-     367,   367,   368,   369,   369,   369
+       0,     8,   112,   113,   114,   115,   116,   117,   118,   119,
+     233,   234,   235,   252,   253,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   270,   271,   272,
+     299,   300,   301,   302,   303,   304,   305,   306,     9,    11,
+      13,    14,    17,    32,    33,    36,    40,    53,    55,   144,
+     149,   175,   199,   216,   217,   349,    97,    97,    97,    97,
+      97,    97,    97,    97,     0,   235,   236,   238,   240,   242,
+       3,    41,    42,    54,    60,    62,    63,   130,   139,   141,
+     244,   245,   307,   308,   309,   317,   319,   336,   345,   348,
+     349,   350,   356,   357,   358,   360,   380,   385,   246,   248,
+     250,    12,    91,    99,    90,   273,   274,    46,    91,    91,
+      99,    91,    92,   228,   142,   143,   195,   267,   268,   218,
+      58,    55,   173,   228,   353,    40,    43,   172,    43,    43,
+      43,    16,    43,    43,     3,   200,   237,   307,   308,   309,
+     317,   318,   336,   337,   338,   339,   345,   348,   356,   357,
+     358,   359,   360,   364,   380,   385,     3,   174,   239,   307,
+     308,   309,   336,   345,   348,   356,   357,   358,   360,   389,
+     401,   407,   408,   410,   411,   412,     3,   241,   307,   308,
+     309,   336,   345,   348,   356,   357,   358,   360,   403,   404,
+     405,   407,   411,   412,     3,   223,   243,   307,   308,   309,
+     336,   345,   348,   356,   357,   358,   360,   389,   390,   391,
+     407,   411,   412,     7,    99,   173,   206,   207,   208,   211,
+     212,   213,   214,   215,   381,   386,    90,    91,   310,   312,
+     310,    92,   310,    99,   197,   197,   131,   132,   133,    98,
+      97,   361,   362,   245,   173,   228,   353,     3,   247,   307,
+     308,   309,   345,   348,   356,   358,   360,   367,   380,     3,
+     249,   307,   308,   309,   336,   345,   348,   356,   357,   358,
+     360,   389,   407,   411,   412,     3,   251,   307,   308,   309,
+     336,   345,   348,   356,   358,   360,   363,    10,    41,   254,
+      46,   151,   314,    58,   274,   343,    99,   164,   165,   166,
+     167,   406,    93,    94,    95,    96,   354,   355,    91,    99,
+     343,   268,   193,   269,    99,    99,   228,   228,    52,    58,
+      61,   122,   123,   147,   148,   150,   153,   170,   171,   175,
+     176,   177,   179,   181,   183,   184,   189,   190,   191,   192,
+     351,   352,    39,   414,    91,    91,    90,    91,    91,    91,
+      91,    90,    91,    91,     7,   120,   124,   125,   126,   127,
+     128,   134,   135,   154,   176,   365,   366,   370,   375,   377,
+     378,   379,    91,     7,   153,   154,   171,   173,   409,   173,
+     409,     7,   154,   168,   169,   154,   171,   220,   221,   222,
+      99,    44,   179,   188,   320,    60,   182,    99,   120,   124,
+     125,   126,   129,   134,   135,   211,   382,   154,   224,   225,
+     226,   227,   393,    58,   147,   148,   311,   312,   313,   341,
+     311,   341,   311,   341,    37,   362,   228,   351,   414,   129,
+     136,   137,   138,   201,   202,   203,   204,   205,   368,   369,
+     371,   372,   373,   374,   375,   376,   378,   122,    90,    25,
+      99,    90,    92,   152,   315,    99,    45,   316,   275,   229,
+     355,   143,   159,   160,   161,   162,   325,   269,   194,   155,
+     354,   351,   229,   352,    99,    58,   342,    56,   322,   393,
+     393,   393,   393,   393,   190,   191,   393,    99,   366,   398,
+     393,    20,    21,    22,    23,   147,   148,   170,   402,   393,
+     153,   171,   402,   393,   172,   172,   192,   393,   393,   172,
+     392,   392,   392,   392,    37,    90,    47,   413,   195,    46,
+     321,    99,   398,   209,    99,   111,   388,    99,    90,    99,
+      90,    99,   313,   341,   341,   341,   351,   229,   393,   369,
+     398,   393,   393,   393,    99,   314,    90,   325,   155,    90,
+      15,    16,    27,    28,    29,    56,    57,   219,   276,   277,
+     280,   281,   282,   283,   284,   285,   286,   287,   291,    99,
+     163,   324,   229,   229,   353,    37,    99,    91,    47,   323,
+      99,    99,   388,    99,   388,    99,    99,   398,   398,    99,
+      37,    99,     5,   388,    90,    99,    90,    99,    99,    61,
+      99,   398,   398,    61,    99,    90,    91,    90,    91,   398,
+      99,    99,   388,    90,   393,   393,   393,   393,   180,    38,
+     340,   189,   346,    99,   323,    37,     5,    99,   155,   210,
+     387,   155,   229,   353,    99,   388,     5,    99,   388,    99,
+     315,   324,    19,    20,    24,    90,    91,   231,    90,    29,
+      57,    29,    57,    27,    28,    91,    27,    28,    58,   278,
+     278,    90,   353,   414,   155,    48,    49,    50,    34,    35,
+      51,   326,   327,   328,   100,   406,   100,   406,   100,   100,
+       5,     5,   155,   156,   157,   158,   394,    37,    41,    42,
+      53,    60,   177,   178,   395,   396,   398,   398,   398,   398,
+     398,    35,   398,   394,     5,     5,   398,   406,   398,   398,
+       5,   100,   398,   100,   406,    99,    99,    99,    99,    99,
+     343,   226,   227,   347,   343,   326,     5,   396,    37,   398,
+     353,   414,   100,   406,   396,   100,   100,   398,   325,    91,
+      91,    91,   230,   292,    90,    99,    26,    30,    31,   279,
+     288,   289,   290,   414,   325,    90,    90,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,   343,   328,   396,   396,   398,   310,     4,
+     400,     5,     5,     5,     5,     5,    90,     5,   398,   396,
+     396,     5,   398,     5,     5,   396,   398,     5,   398,   398,
+     406,   398,   394,   394,   398,    90,    59,   344,   343,    58,
+     396,   400,   393,     5,   414,   400,     5,   324,   293,   294,
+     295,    90,    90,   296,   297,    18,   298,   155,    91,    91,
+     324,   140,   331,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   334,   335,   196,   329,   145,   333,   344,
+       5,   311,     3,   396,   396,   396,   396,   396,   398,   396,
+       5,   396,     5,   396,   396,     5,   396,     5,     5,   398,
+       5,   398,   398,     5,    99,   398,   344,   383,   388,   396,
+     396,   296,   296,   296,   298,   297,    91,   393,   393,   393,
+     393,   393,   393,   393,   393,   393,   393,     6,    90,    92,
+     198,   330,    90,   398,   396,   185,   186,   187,   400,   400,
+     400,   400,   400,     5,   400,   396,   396,   396,   400,   396,
+     396,     5,   396,     5,     5,   396,     5,   398,   398,   100,
+     155,   164,   165,   166,   167,   210,   384,   400,   400,    61,
+     146,   332,    99,    99,    99,    99,    99,    99,    99,    99,
+      99,    99,   335,    99,     5,   400,    99,   399,   399,   399,
+     396,   400,   400,   400,   400,   400,   396,   400,   396,   396,
+     400,   396,     5,     5,    90,    90,   100,   100,   100,   100,
+     100,   100,   100,   100,   100,   100,   396,    37,    99,     5,
+       5,     5,   400,   400,   400,   400,   400,   396,   396,   332,
+     400,    37,   395,   397,   397,   397,   400,   400
 };
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   232,   233,   233,   234,   234,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   236,   236,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   238,   238,   239,   239,   239,   239,   239,   239,
+     239,   239,   239,   239,   239,   239,   239,   239,   239,   239,
+     239,   240,   240,   241,   241,   241,   241,   241,   241,   241,
+     241,   241,   241,   241,   241,   241,   241,   241,   241,   242,
+     242,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   244,   244,   245,
+     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
+     245,   245,   245,   246,   246,   247,   247,   247,   247,   247,
+     247,   247,   247,   247,   247,   248,   248,   249,   249,   249,
+     249,   249,   249,   249,   249,   249,   249,   249,   249,   249,
+     249,   250,   250,   251,   251,   251,   251,   251,   251,   251,
+     251,   251,   251,   252,   252,   252,   253,   254,   254,   255,
+     256,   256,   257,   258,   259,   260,   261,   261,   261,   262,
+     262,   262,   263,   264,   265,   266,   267,   267,   268,   269,
+     269,   270,   271,   272,   273,   273,   274,   274,   275,   275,
+     276,   276,   276,   276,   276,   276,   277,   277,   278,   278,
+     279,   279,   279,   280,   280,   281,   281,   282,   282,   283,
+     283,   284,   284,   285,   286,   287,   287,   288,   289,   290,
+     291,   291,   291,   291,   291,   291,   292,   291,   293,   291,
+     294,   291,   295,   291,   291,   296,   296,   297,   298,   298,
+     299,   299,   299,   299,   300,   301,   302,   303,   304,   305,
+     306,   307,   307,   308,   308,   309,   309,   310,   310,   311,
+     311,   312,   312,   313,   313,   313,   313,   314,   314,   314,
+     315,   315,   316,   316,   317,   317,   318,   319,   320,   320,
+     321,   322,   323,   323,   323,   323,   324,   324,   325,   325,
+     325,   325,   325,   326,   326,   326,   326,   326,   326,   326,
+     326,   326,   326,   326,   326,   326,   326,   326,   326,   326,
+     326,   326,   326,   326,   326,   326,   326,   326,   326,   326,
+     326,   327,   327,   328,   328,   329,   329,   329,   330,   330,
+     331,   331,   331,   332,   332,   333,   334,   334,   335,   335,
+     335,   335,   335,   335,   335,   335,   335,   335,   336,   337,
+     338,   339,   340,   340,   341,   341,   342,   342,   343,   343,
+     344,   344,   345,   345,   346,   346,   347,   347,   348,   348,
+     348,   348,   349,   350,   351,   351,   352,   352,   352,   352,
+     352,   352,   352,   352,   352,   352,   352,   352,   352,   352,
+     352,   352,   352,   352,   352,   352,   352,   352,   353,   353,
+     354,   354,   355,   355,   355,   355,   356,   356,   356,   357,
+     357,   357,   358,   359,   360,   361,   361,   362,   363,   364,
+     365,   365,   366,   366,   366,   366,   367,   368,   368,   369,
+     369,   369,   369,   369,   370,   370,   371,   372,   372,   372,
+     372,   372,   373,   374,   374,   374,   375,   375,   375,   375,
+     376,   376,   377,   378,   379,   379,   379,   380,   381,   381,
+     381,   382,   382,   382,   382,   382,   382,   382,   382,   383,
+     384,   384,   384,   384,   384,   384,   384,   384,   385,   386,
+     386,   386,   386,   386,   387,   387,   388,   388,   389,   389,
+     390,   390,   390,   390,   391,   392,   392,   393,   393,   393,
+     393,   393,   393,   394,   394,   394,   394,   394,   395,   395,
+     395,   395,   395,   395,   395,   396,   397,   398,   398,   398,
+     399,   399,   399,   400,   400,   400,   400,   401,   401,   401,
+     402,   402,   402,   402,   402,   403,   403,   404,   404,   405,
+     406,   406,   406,   406,   406,   407,   408,   408,   408,   408,
+     409,   409,   410,   410,   411,   411,   412,   412,   413,   414,
+     414,   414
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     1,     1,     2,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       2,     2,     2,     2,     2,     2,     2,     2,     0,     2,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     2,     1,     1,
+       1,     1,     1,     2,     2,     2,     2,     2,     2,     2,
+       2,     0,     2,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     2,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     2,     1,     1,     1,     1,     1,
+       1,     1,     0,     2,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
        2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     0,     2,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     2,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     4,     7,     8,     4,     0,     3,     4,     2,
-       2,     3,     3,     5,     4,     6,     4,     3,     3,     3,
-       3,     2,     3,     4,     0,     2,     5,     5,     5,     1,
-       2,     5,     7,     0,     2,     1,     1,     1,     1,     2,
-       2,     0,     2,     1,     1,     1,     2,     2,     2,     2,
-       1,     1,     2,     2,     2,     2,     2,     2,     2,     1,
+       1,     0,     2,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     4,     7,     8,     4,     0,     3,     4,
+       2,     5,     2,     4,     2,     2,     3,     3,     5,     4,
+       6,     4,     3,     3,     3,     3,     2,     3,     4,     0,
+       2,     5,     5,     5,     1,     2,     5,     7,     0,     2,
+       1,     1,     1,     1,     1,     1,     2,     2,     0,     2,
+       1,     1,     1,     2,     2,     2,     2,     1,     1,     2,
+       2,     2,     2,     2,     2,     1,     4,     2,     2,     1,
        5,     4,     2,     3,     3,     3,     0,     4,     0,     5,
        0,     5,     0,     5,     2,     1,     2,     1,     0,     1,
        4,     4,     4,     4,     4,     4,     4,     4,     2,     4,
@@ -1528,654 +2059,59 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
        1,     2,     1,     1,     1,     1,     3,     2,     2,     2,
-       2,     2,     2,     2,     1,     2,     1,     8,     6,     1,
-       2,     1,     1,     1,     1,     6,     1,     2,     1,     1,
-       1,     1,     4,     4,     4,     1,     1,     1,     4,     4,
-       4,     4,     4,     4,     3,     3,     1,     1,     1,     1,
-       1,     9,     6,     0,     1,     1,     1,     1,     1,     0,
-       1,     1,     1,     1,     1,     2,     3,     1,     1,     1,
-       1,     1,     1,     0,     2,     3,     0,     2,     3,     0,
-       6,     6,     6,     8,    10,     7,     0,     1,     1,     8,
-       9,     9,     9,     6,     0,     1,     1,     1,     1,     8,
-       7,     7,     4,     4,     0,     1,     9,     6,     8,     8,
-       8,     8,     2,     0,     2,     3
-};
-
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint16 yydefact[] =
-{
-       2,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     3,     4,     6,     7,    17,    18,    19,     8,     9,
-      15,    16,    14,    10,    11,    12,    13,    28,    46,    65,
-      83,     0,   113,   124,   140,     0,     0,     0,     0,   159,
-       0,     0,     0,     0,     0,     0,     0,     0,   160,   388,
-       0,     0,     0,     0,     0,   238,     0,     0,     1,     5,
-      20,    21,    22,    23,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    24,    99,   101,   102,   103,   105,
-     106,   104,   107,   108,   388,   361,   109,   110,   111,   112,
-      25,    26,    27,   162,   161,   156,   257,   348,   179,     0,
-     167,   168,   484,   169,   362,     0,     0,     0,   348,   170,
-     174,     0,     0,     0,   503,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    29,    30,    31,    32,    37,
-      38,    33,    34,    35,    36,    39,    40,    41,    42,    43,
-      44,    45,   494,   494,    47,    48,    49,    50,    51,    53,
-      55,    54,    62,    63,    64,    52,    59,    56,    61,    60,
-      57,    58,     0,    66,    67,    68,    69,    70,    71,    73,
-      72,    77,    78,    79,    80,    81,    82,    74,    75,    76,
-       0,    84,    85,    86,    87,    88,    90,    92,    91,    96,
-      97,    98,    89,    93,    94,    95,   268,     0,     0,   251,
-     252,   344,   247,   344,   363,   344,     0,   397,   398,   399,
-     400,   401,   402,   406,   403,   404,   100,     0,     0,   503,
-       0,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   125,   126,   127,   128,   129,   131,   133,   132,   137,
-     138,   139,   130,   134,   135,   136,     0,   141,   142,   143,
-     144,   146,   145,   147,   148,   149,   150,   151,     0,     0,
-     155,     0,     0,   260,     0,   180,   262,   183,   485,   486,
-     487,   488,   158,   392,   393,   394,   395,     0,   390,   164,
-     166,   278,   174,     0,   171,     0,     0,   368,   384,   367,
-     383,   381,   386,   373,   375,   385,   378,   382,   366,   387,
-     371,   374,   377,   376,   370,   369,   379,   380,   372,     0,
-     364,     0,   152,   230,   231,   232,   233,   235,   234,   236,
-     237,   239,   346,   268,   443,   443,   443,   436,   437,   438,
-     443,   443,     0,   443,   463,   409,   411,   412,   413,   414,
-     443,   476,   443,   476,   443,   495,     0,   495,     0,     0,
-       0,   443,   443,     0,     0,     0,     0,     0,     0,   463,
-       0,     0,     0,   344,   248,   249,   241,   344,   243,   344,
-     245,   396,   405,     0,     0,   358,   443,   425,   426,   427,
-     463,   416,   421,   443,   419,   420,   418,   443,   163,     0,
-     257,   259,   258,     0,   278,     0,     0,   176,   178,   177,
-     391,     0,   282,   279,   280,   281,   276,   172,   175,     0,
-       0,   388,   365,   504,     0,   240,     0,   272,   448,   447,
-     446,   445,   444,     0,     0,     0,     0,     0,   463,   463,
-       0,     0,   410,     0,     0,   477,   478,     0,     0,     0,
-       0,     0,   463,   463,     0,     0,     0,     0,   463,     0,
-       0,   269,     0,   342,   354,     0,   272,     0,     0,     0,
-     253,   255,   254,   256,   250,   242,   244,   246,     0,   388,
-       0,   417,     0,     0,     0,   157,   260,   261,   276,   349,
-     263,     0,     0,     0,     0,     0,     0,   184,   185,   191,
-     191,   186,   200,   201,   187,   188,   165,     0,   173,   389,
-     388,   503,   505,     0,   271,     0,   283,   434,   440,   439,
-     484,   440,   484,     0,     0,     0,     0,   449,   464,     0,
-       0,   440,   435,   463,   463,   463,   463,   463,   463,   449,
-       0,     0,   463,   484,   463,   463,   493,   492,     0,   463,
-     440,   484,   502,     0,   348,     0,   348,   270,   283,     0,
-       0,   345,   388,   503,   440,   484,     0,     0,   463,   278,
-     181,     0,     0,     0,   224,   212,     0,   206,   197,   203,
-     199,   205,   196,   198,   202,   204,   190,   189,   277,   503,
-     153,   347,   275,   273,   278,     0,     0,     0,   348,   310,
-     311,   429,   428,   431,   430,   422,   423,     0,     0,   450,
-     451,   452,   453,   463,   465,   458,   459,   454,   457,     0,
-     460,   461,   469,     0,     0,     0,     0,     0,     0,     0,
-     463,     0,     0,     0,   463,     0,     0,     0,   463,     0,
-     463,   463,   343,   463,   357,   356,     0,   350,   348,     0,
-     469,   503,   359,   433,   432,   469,   424,     0,   276,   213,
-     214,   215,     0,     0,   228,     0,     0,   209,   192,   193,
-     194,   195,   154,   276,   313,   314,   285,   320,     0,   288,
-     300,   299,   290,   291,   296,   297,   294,   286,   301,   287,
-     292,   293,   302,   303,   304,   305,   298,   315,   306,   307,
-       0,   309,   350,   312,   339,   340,     0,   455,     0,   408,
-       0,     0,     0,     0,     0,   463,     0,     0,   442,   497,
-       0,     0,     0,     0,   483,     0,     0,     0,     0,     0,
-     355,     0,   463,   350,   353,   352,   338,   360,   415,     0,
-     182,     0,     0,     0,   228,   227,   217,   225,   229,   211,
-     207,   208,   274,     0,   289,   443,   443,   443,   443,   443,
-     443,   443,   443,   443,   443,   284,   326,     0,   318,     0,
-     308,   463,     0,   456,     0,   469,   469,   469,   469,   469,
-       0,   469,     0,   475,     0,   491,   490,     0,   469,     0,
-       0,     0,   351,     0,   463,   469,   219,   221,   223,   210,
-     226,   323,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   317,   316,     0,   295,   325,     0,   469,
-     466,   466,   466,   498,   499,   500,   501,   489,     0,   473,
-     469,   469,   469,   479,   469,   469,   469,     0,     0,   407,
-       0,     0,   321,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   327,   319,     0,   341,     0,     0,     0,
-       0,   469,   441,   496,   480,   482,   481,   267,   469,     0,
-     323,   324,   328,   329,   330,   331,   332,   333,   334,   335,
-     336,   337,   469,   467,     0,     0,     0,     0,   474,   265,
-     469,   322,   266,   468,   462,   470,   471,   472,   264
-};
-
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,    10,    11,    12,    60,   125,    61,   144,    62,   163,
-      63,   181,    74,    75,    90,   221,    91,   231,    92,   247,
-      13,    14,   260,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,   109,   110,   284,    24,    25,    26,    97,    98,
-     398,   487,   488,   576,   658,   489,   490,   491,   492,   493,
-     494,   659,   660,   661,   495,   653,   731,   732,   733,   736,
-     737,   739,    27,    28,    29,    30,    31,    32,    33,    34,
-      76,    77,    78,   201,   363,   202,   365,   263,   394,   397,
-      79,   130,    80,   357,   456,   417,   506,   498,   406,   588,
-     589,   590,   758,   806,   744,   832,   760,   755,   756,    81,
-     132,   133,   134,   544,   366,   415,   266,   722,    82,   546,
-     636,    83,    84,    85,   309,   310,   114,   277,   278,    86,
-      87,    88,    89,   214,   215,   257,   141,   334,   335,   230,
-     380,   381,   336,   382,   383,   337,   385,   338,   339,   340,
-     510,   155,   423,   603,   611,   612,   885,   433,   848,   699,
-     156,   440,   174,   175,   176,   272,   157,   158,   346,   159,
-     160,   161,   453,   312
-};
-
-/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-   STATE-NUM.  */
-#define YYPACT_NINF -636
-static const yytype_int16 yypact[] =
-{
-     479,    53,   -53,   -36,   -10,    -3,     0,     3,    10,    16,
-     122,   479,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,   501,  -636,  -636,  -636,    32,    49,    74,   126,  -636,
-     140,   159,   154,   180,   175,    81,    62,    93,  -636,   -39,
-      14,   252,   255,   263,   305,  -636,   287,   292,  -636,  -636,
-     505,    73,   624,   670,    23,   237,   237,   241,   237,   -59,
-     147,   261,   259,   281,   501,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,   -30,  -636,  -636,  -636,  -636,  -636,
-     347,   670,   684,   361,  -636,   355,     1,    30,  -636,   300,
-    -636,  -636,   189,  -636,  -636,   368,   311,   309,   357,    93,
-     228,   234,   236,   526,   413,   364,   383,   290,   388,   400,
-     403,   409,   414,   416,   135,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,    56,   331,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,   136,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-      17,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,    -6,   448,   348,  -636,
-    -636,   110,  -636,   110,  -636,   110,   490,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,   281,  -636,  -636,   335,   526,   413,
-     632,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,   -20,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,   450,   519,
-    -636,   449,    71,   401,   457,  -636,   504,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,   -43,  -636,   417,
-    -636,   410,   228,   363,  -636,   368,   526,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,   193,
-    -636,   463,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,   508,    18,   148,   148,   148,  -636,  -636,  -636,
-     148,   148,   176,   148,   615,  -636,  -636,  -636,  -636,  -636,
-     148,    69,   148,    -2,   148,   348,   408,  -636,   411,   117,
-     389,   148,   148,   432,   496,   541,   394,   544,   502,   510,
-     512,   108,   213,     2,  -636,  -636,  -636,     2,  -636,     2,
-    -636,  -636,  -636,   526,   345,  -636,   148,  -636,  -636,  -636,
-     649,  -636,  -636,   148,  -636,  -636,  -636,   148,  -636,   517,
-     456,  -636,  -636,   527,   410,   467,   533,  -636,   597,  -636,
-    -636,   542,  -636,  -636,  -636,  -636,   469,  -636,  -636,    35,
-     429,   588,  -636,   608,   548,  -636,   561,   606,  -636,  -636,
-    -636,  -636,  -636,   559,    -1,    47,   563,   568,   510,   510,
-     569,    26,  -636,   653,    55,  -636,  -636,   220,   232,   581,
-     620,   583,   510,   510,   622,   589,   296,   314,   510,   595,
-     114,  -636,   515,   660,   511,   600,   606,   667,   699,   553,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,   480,   588,
-     169,  -636,   706,   629,   630,  -636,   401,  -636,   469,  -636,
-    -636,    21,   637,    42,    48,   384,   407,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,   644,  -636,  -636,
-     588,   413,  -636,   564,  -636,   382,   105,  -636,   636,  -636,
-     189,   645,   189,   651,   652,   746,   755,   481,  -636,   718,
-     279,  -636,  -636,   510,   510,   510,   510,   510,    20,   481,
-     757,   759,   510,   189,   510,   510,  -636,  -636,   760,   325,
-     671,   189,  -636,   673,   357,   258,   357,  -636,   105,   772,
-     279,  -636,   588,   413,   680,   189,   279,   681,   510,   410,
-    -636,   691,   692,   693,   586,   703,   704,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,   397,   397,  -636,   413,
-    -636,  -636,  -636,  -636,   410,   705,   720,   814,   357,   431,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,   279,   279,  -636,
-    -636,  -636,  -636,   510,  -636,  -636,  -636,  -636,  -636,   237,
-    -636,  -636,   810,   815,   817,   822,   823,   827,   727,   852,
-     510,   279,   279,   853,   510,   854,   855,   279,   510,   856,
-     510,   510,  -636,   510,  -636,  -636,   731,   805,   357,   276,
-     810,   413,  -636,  -636,  -636,   810,  -636,   858,   469,   777,
-     781,   782,   784,   816,   846,   813,   818,  -636,  -636,  -636,
-    -636,  -636,  -636,   469,  -636,  -636,  -636,   733,   748,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,   709,  -636,  -636,
-     762,  -636,   805,  -636,  -636,  -636,   901,   128,   905,  -636,
-     279,   279,   279,   279,   279,   510,   279,   904,  -636,  -636,
-     279,   906,   279,   279,  -636,   907,   279,   908,   909,   910,
-    -636,   819,   510,   805,  -636,  -636,  -636,  -636,  -636,   279,
-    -636,   816,   816,   816,   846,  -636,   816,  -636,  -636,  -636,
-    -636,  -636,  -636,   821,  -636,   148,   148,   148,   148,   148,
-     148,   148,   148,   148,   148,   911,  -636,   156,   722,   831,
-    -636,   510,   279,   322,   327,   810,   810,   810,   810,   810,
-     915,   810,   279,  -636,   279,  -636,  -636,   279,   810,   279,
-     279,   279,  -636,   916,   510,   810,   816,   816,   816,  -636,
-    -636,   -37,   825,   826,   828,   829,   830,   832,   833,   834,
-     835,   836,   748,  -636,  -636,   837,  -636,  -636,   919,   810,
-     838,   838,   838,  -636,  -636,  -636,  -636,  -636,   279,  -636,
-     810,   810,   810,  -636,   810,   810,   810,   279,   923,  -636,
-     848,   849,  -636,   840,   841,   842,   843,   844,   845,   847,
-     850,   851,   857,  -636,  -636,   279,  -636,    38,   939,   941,
-     942,   810,  -636,  -636,  -636,  -636,  -636,  -636,   810,   279,
-     806,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,   810,  -636,   917,   279,   279,   279,  -636,  -636,
-     810,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636
-};
-
-/* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] =
-{
-    -636,  -636,  -636,   940,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,   879,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,   859,   672,  -636,  -636,  -636,  -636,   860,
-    -636,  -636,  -636,   466,  -636,  -636,  -636,  -636,  -636,  -636,
-    -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -216,
-    -464,   224,  -636,  -636,  -636,  -636,  -636,  -636,  -636,  -636,
-     628,   726,   734,   -66,  -199,  -198,  -352,   570,   483,  -636,
-     902,  -636,  -636,  -636,  -636,  -636,   507,  -466,  -378,   418,
-    -636,   372,  -636,  -636,  -636,   104,  -636,  -636,   163,   297,
-    -636,  -636,  -636,  -636,  -176,  -636,  -107,  -635,   739,  -636,
-    -636,   743,   966,  -636,  -184,  -255,   -76,   685,  -244,   750,
-     179,   776,   783,  -636,   758,  -636,  -636,  -636,   635,  -636,
-    -636,   591,  -636,  -636,  -636,  -207,  -636,  -636,  -188,  -636,
-    -369,    67,  -305,   444,  -304,  -482,  -394,  -349,  -317,  -351,
-    -636,   631,  -636,  -636,  -636,   -32,   173,  -636,   839,  -636,
-     214,   249,  -636,  -210
-};
-
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -223
-static const yytype_int16 yytable[] =
-{
-     203,   281,   205,   364,   367,   364,   369,   364,   219,   375,
-     458,   464,   560,   384,   111,   464,   478,   464,   435,   436,
-     424,   425,   830,   111,   349,   426,   427,   368,   430,   370,
-     196,   472,   386,   400,   374,   434,   354,   441,   206,   445,
-     561,   562,    50,   563,    93,   261,   449,   450,   273,   274,
-     275,   276,   115,   618,   412,   116,   512,   761,   360,    51,
-     354,   518,    35,   341,    36,   522,    37,    38,   640,   568,
-      39,   470,   416,   873,   645,   570,   142,   197,   473,   515,
-     516,   541,   474,    40,    41,    52,   264,    42,   784,   435,
-     436,    43,    53,   530,   531,    54,   508,   569,    55,   538,
-     387,   555,   410,   571,    44,    56,    45,   831,   509,   564,
-     565,    57,    65,    66,   197,   694,   695,   431,    96,   412,
-     197,    94,    58,   519,    44,    67,   273,   274,   275,   276,
-     192,    68,   112,    69,    70,   874,   207,   585,   586,   708,
-     709,   217,   323,   349,   511,   714,    95,   361,   362,   442,
-     262,   198,   521,   197,   587,   412,   509,   725,   242,   391,
-     399,   392,    96,   113,   509,   400,   360,   443,   342,   353,
-      99,   355,   218,   384,   613,   614,   615,   616,   617,   619,
-     356,   648,   730,   623,   117,   625,   626,   465,   198,   468,
-     629,   466,   386,   467,   198,    46,   460,   742,   199,   200,
-      47,    71,   106,   107,   356,   461,   663,   342,   343,   647,
-      72,   540,    73,   412,   437,   438,   199,   200,   765,   766,
-     767,   768,   769,   509,   771,   344,   566,   345,   773,   100,
-     775,   776,   197,   197,   778,   177,   193,   439,   499,   138,
-     152,   171,   189,   287,   803,   143,   804,   785,   101,   288,
-      48,   102,   289,   324,   696,   361,   362,   325,   326,   327,
-     328,   329,   437,   438,   243,   104,   554,   330,   331,   103,
-     239,   707,   790,   361,   362,   711,   178,   194,   509,   715,
-     809,   717,   718,   105,   719,   439,   108,   332,   350,   726,
-     820,   580,   821,   118,   728,   822,   119,   824,   825,   826,
-     418,   462,   351,   352,   120,   244,   198,   198,   523,   333,
-     463,   179,   195,   290,   291,   605,   606,   524,   605,   606,
-     525,   121,   790,   790,   790,   199,   200,   607,   122,   526,
-     607,   204,   724,   123,   608,   501,   851,   608,   292,   293,
-     245,   294,   208,   642,   295,   858,   419,   420,   421,   422,
-     220,   268,   269,   270,   271,   212,   770,   131,   148,   167,
-     185,   296,   297,   872,   428,   429,   298,   299,   300,   662,
-     301,   258,   302,   783,   303,   304,   213,   880,   315,   316,
-     305,   306,   307,   308,   534,   535,    65,    66,   235,   251,
-     209,   210,   211,   553,   259,   287,   411,   267,    44,    67,
-     279,   288,   536,   537,   289,    68,   280,    69,    70,   572,
-     573,   464,   808,   264,   813,   814,   815,   816,   817,   283,
-     819,   655,   431,   628,   579,   656,   657,   823,   582,   583,
-     584,   727,   574,   575,   829,   828,   285,   633,   286,   637,
-     792,   793,   794,   795,   796,   797,   798,   799,   800,   801,
-     311,   609,   610,   313,   609,   610,   634,   635,   846,   273,
-     274,   275,   276,   585,   586,   290,   291,   361,   362,   852,
-     853,   854,   314,   855,   856,   857,   641,   317,   592,   287,
-     594,   692,   886,   887,    72,   288,    73,     1,   289,   318,
-     292,   293,   319,   294,   849,   850,   295,   320,   763,   364,
-     878,   624,   347,   321,    64,   322,   358,   879,   124,   631,
-     810,   811,   812,   296,   297,   786,   787,   788,   298,   299,
-     300,   882,   301,   644,   302,   371,   303,   304,   359,   888,
-     287,   723,   305,   306,   307,   308,   288,   373,   388,   289,
-      65,    66,   389,   697,    65,    66,   390,   396,   469,   290,
-     291,   393,    44,    67,   395,   408,    44,    67,   401,    68,
-     413,    69,    70,    68,   414,    69,    70,   402,   403,   404,
-     405,   884,   884,   884,   292,   293,   287,   294,   446,   448,
-     295,   447,   288,   442,   451,   289,   452,   454,   455,     2,
-       3,     4,     5,     6,     7,     8,     9,   296,   297,   457,
-     290,   291,   298,   299,   300,   262,   301,   431,   302,   459,
-     303,   304,   481,   482,   475,   477,   305,   306,   307,   308,
-     479,   480,   483,   484,   485,   292,   293,   162,   294,    71,
-     497,   295,   500,    71,   599,   600,   601,   602,    72,   496,
-      73,   111,    72,   502,    73,   503,   290,   291,   296,   297,
-     504,   505,   486,   298,   299,   300,   507,   301,   520,   302,
-     513,   303,   304,    65,    66,   514,   517,   305,   306,   307,
-     308,   292,   293,   180,   294,    44,    67,   295,   527,   528,
-     529,   532,    68,   552,    69,    70,   533,   246,   126,   145,
-     164,   182,   539,   542,   296,   297,   543,   547,   545,   298,
-     299,   300,   549,   301,   550,   302,   551,   303,   304,    65,
-      66,   556,   431,   305,   306,   307,   308,   581,   222,   232,
-     248,    44,    67,    65,    66,   567,   557,   558,    68,   197,
-      69,    70,   578,   324,   591,    44,    67,   325,   326,   327,
-     328,   329,    68,   593,    69,    70,   431,   330,   331,   595,
-     596,   597,    71,   604,   325,   326,   327,   328,   329,   376,
-     598,    72,   621,    73,   622,   627,   377,   378,   379,   630,
-     632,   325,   326,   327,   328,   329,   376,   639,   643,   646,
-     649,   650,   651,   377,   378,   379,   127,   146,   165,   183,
-     652,  -216,   654,   664,   128,   147,   166,   184,    71,   135,
-     149,   168,   186,   136,   150,   169,   187,    72,   665,    73,
-     137,   151,   170,   188,   698,   705,   223,   233,   249,   720,
-     700,    72,   701,    73,   224,   234,   250,   702,   703,   225,
-     236,   252,   704,   226,   237,   253,   139,   153,   172,   190,
-     227,   238,   254,   140,   154,   173,   191,   745,   746,   747,
-     748,   749,   750,   751,   752,   753,   754,   706,   710,   712,
-     713,   716,   721,   729,   738,  -218,   228,   240,   255,  -220,
-    -222,   743,   734,   229,   241,   256,   666,   667,   668,   669,
-     670,   671,   672,   673,   674,   675,   676,   677,   678,   679,
-     680,   681,   682,   683,   684,   685,   686,   687,   688,   689,
-     690,   691,   740,   757,   735,   759,   762,   741,   764,   772,
-     791,   774,   777,   779,   780,   781,   782,   802,   805,   807,
-     818,   827,   833,   834,   845,   835,   836,   837,   859,   838,
-     839,   840,   841,   842,   844,   847,   860,   861,   862,   863,
-     864,   865,   866,   867,   875,   868,   876,   877,   869,   870,
-     831,    59,   883,   216,   407,   871,   577,   265,   789,   559,
-     476,   693,   129,   548,   881,   843,   638,    49,   282,   432,
-     409,   471,   372,   620,   444,     0,     0,     0,     0,     0,
-       0,     0,   348
+       2,     2,     2,     2,     2,     1,     2,     1,     8,     6,
+       1,     2,     1,     1,     1,     1,     6,     1,     2,     1,
+       1,     1,     1,     1,     4,     4,     4,     1,     1,     1,
+       1,     1,     4,     1,     1,     1,     4,     4,     4,     4,
+       4,     4,     3,     3,     1,     1,     1,    12,     1,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       0,     1,     1,     1,     1,     1,     1,     1,     9,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     9,     6,
+       9,    10,    10,    10,     3,     0,     2,     0,     1,     1,
+       1,     1,     1,     0,     1,     1,     1,     1,     1,     2,
+       3,     1,     1,     1,     1,     1,     1,     0,     2,     3,
+       0,     2,     3,     0,     6,     6,     6,     8,    10,     7,
+       0,     1,     1,     1,     1,     8,     9,     9,     9,     6,
+       0,     1,     1,     1,     1,     8,     7,     7,     4,     4,
+       0,     1,     9,     6,     8,     8,     8,     8,     2,     0,
+       2,     3
 };
 
-#define yypact_value_is_default(yystate) \
-  ((yystate) == (-636))
 
-#define yytable_value_is_error(yytable_value) \
-  YYID (0)
+enum { YYENOMEM = -2 };
 
-static const yytype_int16 yycheck[] =
-{
-      66,   108,    68,   201,   203,   203,   205,   205,    84,   219,
-     359,   363,   478,   220,    53,   367,   394,   369,    20,    21,
-     325,   326,    59,    53,     7,   330,   331,   203,   333,   205,
-       7,   380,   220,   277,   218,   340,    42,   342,    97,   344,
-      19,    20,    95,    22,    12,    44,   351,   352,    91,    92,
-      93,    94,    38,    33,   309,    41,   425,   692,    56,    95,
-      42,    35,     9,     7,    11,   434,    13,    14,   550,    27,
-      17,   376,    54,    35,   556,    27,     3,    97,   383,   428,
-     429,   450,   387,    30,    31,    95,    56,    34,   723,    20,
-      21,    38,    95,   442,   443,    95,    97,    55,    95,   448,
-     120,   470,   286,    55,    51,    95,    53,   144,   109,    88,
-      89,    95,    39,    40,    97,   597,   598,    97,    88,   374,
-      97,    89,     0,    97,    51,    52,    91,    92,    93,    94,
-      63,    58,   171,    60,    61,    97,   195,    32,    33,   621,
-     622,   171,     7,     7,    97,   627,    97,   145,   146,   151,
-     149,   171,    97,    97,    49,   410,   109,   639,    91,    88,
-     203,    90,    88,   202,   109,   409,    56,   169,   151,   152,
-      44,   177,   202,   380,   523,   524,   525,   526,   527,   528,
-     186,   559,   648,   532,   170,   534,   535,   363,   171,   373,
-     539,   367,   380,   369,   171,   142,    88,   663,    88,    89,
-     147,   128,   140,   141,   186,    97,   584,   151,   152,   558,
-     137,    97,   139,   468,   145,   146,    88,    89,   700,   701,
-     702,   703,   704,   109,   706,   169,   205,   171,   710,    89,
-     712,   713,    97,    97,   716,    62,    63,   168,   203,    60,
-      61,    62,    63,    50,    88,   172,    90,   729,    89,    56,
-     197,    97,    59,   118,   603,   145,   146,   122,   123,   124,
-     125,   126,   145,   146,    91,    90,    97,   132,   133,    89,
-      91,   620,   736,   145,   146,   624,    62,    63,   109,   628,
-     762,   630,   631,   202,   633,   168,   193,   152,   152,   640,
-     772,   501,   774,    41,   645,   777,    41,   779,   780,   781,
-     152,    88,   166,   167,    41,    91,   171,   171,    88,   174,
-      97,    62,    63,   120,   121,    39,    40,    97,    39,    40,
-      88,    16,   786,   787,   788,    88,    89,    51,    41,    97,
-      51,    90,    56,    41,    58,   411,   818,    58,   145,   146,
-      91,   148,   195,   553,   151,   827,   198,   199,   200,   201,
-       3,   162,   163,   164,   165,    96,   705,    60,    61,    62,
-      63,   168,   169,   845,   188,   189,   173,   174,   175,   579,
-     177,    10,   179,   722,   181,   182,    95,   859,    88,    89,
-     187,   188,   189,   190,    88,    89,    39,    40,    91,    92,
-     129,   130,   131,   469,    39,    50,   203,    97,    51,    52,
-      89,    56,    88,    89,    59,    58,    97,    60,    61,    25,
-      26,   763,   761,    56,   765,   766,   767,   768,   769,   191,
-     771,    24,    97,    98,   500,    28,    29,   778,    46,    47,
-      48,   641,    25,    26,   785,   784,   202,   544,   202,   546,
-     745,   746,   747,   748,   749,   750,   751,   752,   753,   754,
-      37,   175,   176,    89,   175,   176,   198,   199,   809,    91,
-      92,    93,    94,    32,    33,   120,   121,   145,   146,   820,
-     821,   822,    89,   824,   825,   826,   552,    89,   510,    50,
-     512,   588,   876,   877,   137,    56,   139,     8,    59,    89,
-     145,   146,    89,   148,   811,   812,   151,    88,   697,   697,
-     851,   533,   171,    89,     3,    89,    58,   858,     3,   541,
-     183,   184,   185,   168,   169,   731,   732,   733,   173,   174,
-     175,   872,   177,   555,   179,    35,   181,   182,   180,   880,
-      50,   638,   187,   188,   189,   190,    56,   202,    88,    59,
-      39,    40,    23,   609,    39,    40,    97,    43,   203,   120,
-     121,   150,    51,    52,    97,   192,    51,    52,   141,    58,
-      97,    60,    61,    58,    56,    60,    61,   157,   158,   159,
-     160,   875,   876,   877,   145,   146,    50,   148,   170,   190,
-     151,   170,    56,   151,    88,    59,    45,   193,    44,   110,
-     111,   112,   113,   114,   115,   116,   117,   168,   169,    97,
-     120,   121,   173,   174,   175,   149,   177,    97,   179,    97,
-     181,   182,    15,    16,    97,    88,   187,   188,   189,   190,
-     153,    88,    25,    26,    27,   145,   146,     3,   148,   128,
-     161,   151,   203,   128,   153,   154,   155,   156,   137,    97,
-     139,    53,   137,    35,   139,    97,   120,   121,   168,   169,
-      89,    45,    55,   173,   174,   175,    97,   177,     5,   179,
-      97,   181,   182,    39,    40,    97,    97,   187,   188,   189,
-     190,   145,   146,     3,   148,    51,    52,   151,    97,    59,
-      97,    59,    58,   203,    60,    61,    97,     3,    60,    61,
-      62,    63,    97,   178,   168,   169,    36,    97,   187,   173,
-     174,   175,    35,   177,     5,   179,   153,   181,   182,    39,
-      40,     5,    97,   187,   188,   189,   190,   153,    90,    91,
-      92,    51,    52,    39,    40,    88,    97,    97,    58,    97,
-      60,    61,    88,   118,    98,    51,    52,   122,   123,   124,
-     125,   126,    58,    98,    60,    61,    97,   132,   133,    98,
-      98,     5,   128,    35,   122,   123,   124,   125,   126,   127,
-       5,   137,     5,   139,     5,     5,   134,   135,   136,    98,
-      97,   122,   123,   124,   125,   126,   127,     5,    98,    98,
-      89,    89,    89,   134,   135,   136,    60,    61,    62,    63,
-     204,    88,    88,    88,    60,    61,    62,    63,   128,    60,
-      61,    62,    63,    60,    61,    62,    63,   137,    88,   139,
-      60,    61,    62,    63,     4,    88,    90,    91,    92,    88,
-       5,   137,     5,   139,    90,    91,    92,     5,     5,    90,
-      91,    92,     5,    90,    91,    92,    60,    61,    62,    63,
-      90,    91,    92,    60,    61,    62,    63,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,     5,     5,     5,
-       5,     5,    57,     5,    18,    88,    90,    91,    92,    88,
-      88,   138,    88,    90,    91,    92,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    89,   194,    88,   143,     5,    89,     3,     5,
-      89,     5,     5,     5,     5,     5,    97,     6,   196,    88,
-       5,     5,    97,    97,     5,    97,    97,    97,     5,    97,
-      97,    97,    97,    97,    97,    97,    88,    88,    98,    98,
-      98,    98,    98,    98,     5,    98,     5,     5,    98,    98,
-     144,    11,    35,    74,   282,    98,   490,    97,   734,   476,
-     390,   589,    60,   456,   860,   802,   548,     1,   109,   334,
-     285,   380,   214,   529,   343,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   143
-};
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
-{
-       0,     8,   110,   111,   112,   113,   114,   115,   116,   117,
-     207,   208,   209,   226,   227,   229,   230,   231,   232,   233,
-     234,   235,   236,   237,   241,   242,   243,   268,   269,   270,
-     271,   272,   273,   274,   275,     9,    11,    13,    14,    17,
-      30,    31,    34,    38,    51,    53,   142,   147,   197,   318,
-      95,    95,    95,    95,    95,    95,    95,    95,     0,   209,
-     210,   212,   214,   216,     3,    39,    40,    52,    58,    60,
-      61,   128,   137,   139,   218,   219,   276,   277,   278,   286,
-     288,   305,   314,   317,   318,   319,   325,   326,   327,   328,
-     220,   222,   224,    12,    89,    97,    88,   244,   245,    44,
-      89,    89,    97,    89,    90,   202,   140,   141,   193,   238,
-     239,    53,   171,   202,   322,    38,    41,   170,    41,    41,
-      41,    16,    41,    41,     3,   211,   276,   277,   278,   286,
-     287,   305,   306,   307,   308,   314,   317,   325,   326,   327,
-     328,   332,     3,   172,   213,   276,   277,   278,   305,   314,
-     317,   325,   326,   327,   328,   347,   356,   362,   363,   365,
-     366,   367,     3,   215,   276,   277,   278,   305,   314,   317,
-     325,   326,   327,   328,   358,   359,   360,   362,   366,   367,
-       3,   217,   276,   277,   278,   305,   314,   317,   325,   326,
-     327,   328,   347,   362,   366,   367,     7,    97,   171,    88,
-      89,   279,   281,   279,    90,   279,    97,   195,   195,   129,
-     130,   131,    96,    95,   329,   330,   219,   171,   202,   322,
-       3,   221,   276,   277,   278,   314,   317,   325,   327,   328,
-     335,   223,   276,   277,   278,   305,   314,   317,   325,   326,
-     327,   328,   347,   362,   366,   367,     3,   225,   276,   277,
-     278,   305,   314,   317,   325,   327,   328,   331,    10,    39,
-     228,    44,   149,   283,    56,   245,   312,    97,   162,   163,
-     164,   165,   361,    91,    92,    93,    94,   323,   324,    89,
-      97,   312,   239,   191,   240,   202,   202,    50,    56,    59,
-     120,   121,   145,   146,   148,   151,   168,   169,   173,   174,
-     175,   177,   179,   181,   182,   187,   188,   189,   190,   320,
-     321,    37,   369,    89,    89,    88,    89,    89,    89,    89,
-      88,    89,    89,     7,   118,   122,   123,   124,   125,   126,
-     132,   133,   152,   174,   333,   334,   338,   341,   343,   344,
-     345,     7,   151,   152,   169,   171,   364,   171,   364,     7,
-     152,   166,   167,   152,    42,   177,   186,   289,    58,   180,
-      56,   145,   146,   280,   281,   282,   310,   280,   310,   280,
-     310,    35,   330,   202,   320,   369,   127,   134,   135,   136,
-     336,   337,   339,   340,   341,   342,   344,   120,    88,    23,
-      97,    88,    90,   150,   284,    97,    43,   285,   246,   203,
-     324,   141,   157,   158,   159,   160,   294,   240,   192,   323,
-     320,   203,   321,    97,    56,   311,    54,   291,   152,   198,
-     199,   200,   201,   348,   348,   348,   348,   348,   188,   189,
-     348,    97,   334,   353,   348,    20,    21,   145,   146,   168,
-     357,   348,   151,   169,   357,   348,   170,   170,   190,   348,
-     348,    88,    45,   368,   193,    44,   290,    97,   353,    97,
-      88,    97,    88,    97,   282,   310,   310,   310,   320,   203,
-     348,   337,   353,   348,   348,    97,   283,    88,   294,   153,
-      88,    15,    16,    25,    26,    27,    55,   247,   248,   251,
-     252,   253,   254,   255,   256,   260,    97,   161,   293,   203,
-     203,   322,    35,    97,    89,    45,   292,    97,    97,   109,
-     346,    97,   346,    97,    97,   353,   353,    97,    35,    97,
-       5,    97,   346,    88,    97,    88,    97,    97,    59,    97,
-     353,   353,    59,    97,    88,    89,    88,    89,   353,    97,
-      97,   346,   178,    36,   309,   187,   315,    97,   292,    35,
-       5,   153,   203,   322,    97,   346,     5,    97,    97,   284,
-     293,    19,    20,    22,    88,    89,   205,    88,    27,    55,
-      27,    55,    25,    26,    25,    26,   249,   249,    88,   322,
-     369,   153,    46,    47,    48,    32,    33,    49,   295,   296,
-     297,    98,   361,    98,   361,    98,    98,     5,     5,   153,
-     154,   155,   156,   349,    35,    39,    40,    51,    58,   175,
-     176,   350,   351,   353,   353,   353,   353,   353,    33,   353,
-     349,     5,     5,   353,   361,   353,   353,     5,    98,   353,
-      98,   361,    97,   312,   198,   199,   316,   312,   295,     5,
-     351,   322,   369,    98,   361,   351,    98,   353,   294,    89,
-      89,    89,   204,   261,    88,    24,    28,    29,   250,   257,
-     258,   259,   369,   294,    88,    88,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,   312,   297,   351,   351,   353,   279,     4,   355,
-       5,     5,     5,     5,     5,    88,     5,   353,   351,   351,
-       5,   353,     5,     5,   351,   353,     5,   353,   353,   353,
-      88,    57,   313,   312,    56,   351,   355,   369,   355,     5,
-     293,   262,   263,   264,    88,    88,   265,   266,    18,   267,
-      89,    89,   293,   138,   300,    99,   100,   101,   102,   103,
-     104,   105,   106,   107,   108,   303,   304,   194,   298,   143,
-     302,   313,     5,   280,     3,   351,   351,   351,   351,   351,
-     353,   351,     5,   351,     5,   351,   351,     5,   351,     5,
-       5,     5,    97,   353,   313,   351,   265,   265,   265,   267,
-     266,    89,   348,   348,   348,   348,   348,   348,   348,   348,
-     348,   348,     6,    88,    90,   196,   299,    88,   353,   351,
-     183,   184,   185,   355,   355,   355,   355,   355,     5,   355,
-     351,   351,   351,   355,   351,   351,   351,     5,   353,   355,
-      59,   144,   301,    97,    97,    97,    97,    97,    97,    97,
-      97,    97,    97,   304,    97,     5,   355,    97,   354,   354,
-     354,   351,   355,   355,   355,   355,   355,   355,   351,     5,
-      88,    88,    98,    98,    98,    98,    98,    98,    98,    98,
-      98,    98,   351,    35,    97,     5,     5,     5,   355,   355,
-     351,   301,   355,    35,   350,   352,   352,   352,   355
-};
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
-
-
-/* This macro is provided for backward compatibility. */
-
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
-
-
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -2185,80 +2121,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -2266,16 +2180,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
 static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -2286,63 +2192,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -2358,365 +2257,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (0, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = 0;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
 static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/* Prevent warnings from -Wmissing-prototypes.  */
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
 YYSTYPE yylval;
-
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks thru separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2724,111 +2335,107 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yytoken = 0;
-  yyss = yyssa;
-  yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-  yyssp = yyss;
-  yyvsp = yyvs;
-
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2839,18 +2446,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2878,13 +2496,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2899,14 +2517,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2919,298 +2537,306 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 152:
-
-/* Line 1806 of yacc.c  */
-#line 493 "src/p.y"
-    {
+  case 163: /* setalert: SET alertmail formatlist reminder  */
+#line 539 "src/p.y"
+                                                    {
                    mailset.events = Event_All;
-                    addmail((yyvsp[(2) - (4)].string), &mailset, &Run.maillist);
+                    addmail((yyvsp[-2].string), &mailset, &Run.maillist);
                   }
+#line 2546 "src/y.tab.c"
     break;
 
-  case 153:
-
-/* Line 1806 of yacc.c  */
-#line 497 "src/p.y"
-    {
-                    addmail((yyvsp[(2) - (7)].string), &mailset, &Run.maillist);
+  case 164: /* setalert: SET alertmail '{' eventoptionlist '}' formatlist reminder  */
+#line 543 "src/p.y"
+                                                                            {
+                    addmail((yyvsp[-5].string), &mailset, &Run.maillist);
                   }
+#line 2554 "src/y.tab.c"
     break;
 
-  case 154:
-
-/* Line 1806 of yacc.c  */
-#line 500 "src/p.y"
-    {
+  case 165: /* setalert: SET alertmail NOT '{' eventoptionlist '}' formatlist reminder  */
+#line 546 "src/p.y"
+                                                                                {
                    mailset.events = ~mailset.events;
-                   addmail((yyvsp[(2) - (8)].string), &mailset, &Run.maillist);
+                   addmail((yyvsp[-6].string), &mailset, &Run.maillist);
                   }
+#line 2563 "src/y.tab.c"
     break;
 
-  case 155:
-
-/* Line 1806 of yacc.c  */
-#line 506 "src/p.y"
-    {
+  case 166: /* setdaemon: SET DAEMON NUMBER startdelay  */
+#line 552 "src/p.y"
+                                               {
                     if (!Run.isdaemon || ihp.daemon) {
                       ihp.daemon     = TRUE;
                       Run.isdaemon   = TRUE;
-                      Run.polltime   = (yyvsp[(3) - (4)].number);
-                      Run.startdelay = (yyvsp[(4) - (4)].number);
+                      Run.polltime   = (yyvsp[-1].number);
+                      Run.startdelay = (yyvsp[0].number);
                     }
                   }
+#line 2576 "src/y.tab.c"
     break;
 
-  case 156:
+  case 167: /* startdelay: %empty  */
+#line 562 "src/p.y"
+                                     { (yyval.number) = START_DELAY; }
+#line 2582 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 516 "src/p.y"
-    { (yyval.number) = START_DELAY; }
+  case 168: /* startdelay: START DELAY NUMBER  */
+#line 563 "src/p.y"
+                                     { (yyval.number) = (yyvsp[0].number); }
+#line 2588 "src/y.tab.c"
     break;
 
-  case 157:
+  case 169: /* setexpectbuffer: SET EXPECTBUFFER NUMBER unit  */
+#line 566 "src/p.y"
+                                               {
+                    Run.expectbuffer = (yyvsp[-1].number) * (yyvsp[0].number);
+                  }
+#line 2596 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 517 "src/p.y"
-    { (yyval.number) = (yyvsp[(3) - (3)].number); }
+  case 170: /* setkeepalive: SET KEEPALIVE  */
+#line 571 "src/p.y"
+                                {
+                    Run.keepalive = KEEPALIVE_TIMEOUT;
+                  }
+#line 2604 "src/y.tab.c"
     break;
 
-  case 158:
+  case 171: /* setkeepalive: SET KEEPALIVE TIMEOUT NUMBER SECOND  */
+#line 574 "src/p.y"
+                                                      {
+                    if ((yyvsp[-1].number) < 1)
+                      yyerror2("The keepalive timeout must be at least 1 second");
+                    Run.keepalive = (yyvsp[-1].number);
+                  }
+#line 2614 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 520 "src/p.y"
-    {
-                    Run.expectbuffer = (yyvsp[(3) - (4)].number) * (yyvsp[(4) - (4)].number);
+  case 172: /* setpidwatch: SET PIDWATCH  */
+#line 581 "src/p.y"
+                               {
+                    Run.pidwatch = TRUE;
                   }
+#line 2622 "src/y.tab.c"
     break;
 
-  case 159:
+  case 173: /* setconcurrency: SET ACTION CONCURRENCY NUMBER  */
+#line 586 "src/p.y"
+                                                {
+                    if ((yyvsp[0].number) < 1)
+                      yyerror2("The action concurrency must be at least 1");
+                    Run.concurrency = (yyvsp[0].number);
+                  }
+#line 2632 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 525 "src/p.y"
-    {
+  case 174: /* setinit: SET INIT  */
+#line 593 "src/p.y"
+                           {
                     Run.init = TRUE;
                   }
+#line 2640 "src/y.tab.c"
     break;
 
-  case 160:
-
-/* Line 1806 of yacc.c  */
-#line 530 "src/p.y"
-    {
+  case 175: /* setfips: SET FIPS  */
+#line 598 "src/p.y"
+                           {
                   #ifdef OPENSSL_FIPS
                     Run.fipsEnabled = TRUE;
                   #endif
                   }
+#line 2650 "src/y.tab.c"
     break;
 
-  case 161:
-
-/* Line 1806 of yacc.c  */
-#line 537 "src/p.y"
-    {
+  case 176: /* setlog: SET LOGFILE PATH  */
+#line 605 "src/p.y"
+                                     {
                    if (!Run.logfile || ihp.logfile) {
                      ihp.logfile = TRUE;
-                     setlogfile((yyvsp[(3) - (3)].string));
+                     setlogfile((yyvsp[0].string));
                      Run.use_syslog = FALSE;
                      Run.dolog =TRUE;
                    }
                   }
+#line 2663 "src/y.tab.c"
     break;
 
-  case 162:
-
-/* Line 1806 of yacc.c  */
-#line 545 "src/p.y"
-    {
+  case 177: /* setlog: SET LOGFILE SYSLOG  */
+#line 613 "src/p.y"
+                                     {
                     setsyslog(NULL);
                   }
+#line 2671 "src/y.tab.c"
     break;
 
-  case 163:
-
-/* Line 1806 of yacc.c  */
-#line 548 "src/p.y"
-    {
-                    setsyslog((yyvsp[(5) - (5)].string)); FREE((yyvsp[(5) - (5)].string));
+  case 178: /* setlog: SET LOGFILE SYSLOG FACILITY STRING  */
+#line 616 "src/p.y"
+                                                     {
+                    setsyslog((yyvsp[0].string)); FREE((yyvsp[0].string));
                   }
+#line 2679 "src/y.tab.c"
     break;
 
-  case 164:
-
-/* Line 1806 of yacc.c  */
-#line 553 "src/p.y"
-    {
-                    Run.eventlist_dir = (yyvsp[(4) - (4)].string);
+  case 179: /* seteventqueue: SET EVENTQUEUE BASEDIR PATH  */
+#line 621 "src/p.y"
+                                              {
+                    Run.eventlist_dir = (yyvsp[0].string);
                   }
+#line 2687 "src/y.tab.c"
     break;
 
-  case 165:
-
-/* Line 1806 of yacc.c  */
-#line 556 "src/p.y"
-    {
-                    Run.eventlist_dir = (yyvsp[(4) - (6)].string);
-                    Run.eventlist_slots = (yyvsp[(6) - (6)].number);
+  case 180: /* seteventqueue: SET EVENTQUEUE BASEDIR PATH SLOT NUMBER  */
+#line 624 "src/p.y"
+                                                          {
+                    Run.eventlist_dir = (yyvsp[-2].string);
+                    Run.eventlist_slots = (yyvsp[0].number);
                   }
+#line 2696 "src/y.tab.c"
     break;
 
-  case 166:
-
-/* Line 1806 of yacc.c  */
-#line 560 "src/p.y"
-    {
+  case 181: /* seteventqueue: SET EVENTQUEUE SLOT NUMBER  */
+#line 628 "src/p.y"
+                                             {
                     Run.eventlist_dir = Str_dup(MYEVENTLISTBASE);
-                    Run.eventlist_slots = (yyvsp[(4) - (4)].number);
+                    Run.eventlist_slots = (yyvsp[0].number);
                   }
+#line 2705 "src/y.tab.c"
     break;
 
-  case 167:
-
-/* Line 1806 of yacc.c  */
-#line 566 "src/p.y"
-    {
-                    Run.idfile = (yyvsp[(3) - (3)].string);
+  case 182: /* setidfile: SET IDFILE PATH  */
+#line 634 "src/p.y"
+                                  {
+                    Run.idfile = heapstring((yyvsp[0].string));
                   }
+#line 2713 "src/y.tab.c"
     break;
 
-  case 168:
-
-/* Line 1806 of yacc.c  */
-#line 571 "src/p.y"
-    {
-                    Run.statefile = (yyvsp[(3) - (3)].string);
+  case 183: /* setstatefile: SET STATEFILE PATH  */
+#line 639 "src/p.y"
+                                     {
+                    Run.statefile = heapstring((yyvsp[0].string));
                   }
+#line 2721 "src/y.tab.c"
     break;
 
-  case 169:
-
-/* Line 1806 of yacc.c  */
-#line 576 "src/p.y"
-    {
+  case 184: /* setpid: SET PIDFILE PATH  */
+#line 644 "src/p.y"
+                                   {
                    if (!Run.pidfile || ihp.pidfile) {
                      ihp.pidfile = TRUE;
-                     setpidfile((yyvsp[(3) - (3)].string));
+                     setpidfile((yyvsp[0].string));
                    }
                  }
+#line 2732 "src/y.tab.c"
     break;
 
-  case 173:
-
-/* Line 1806 of yacc.c  */
-#line 591 "src/p.y"
-    {
-                    check_hostname(((yyvsp[(1) - (4)].url))->hostname);
-                    addmmonit((yyvsp[(1) - (4)].url), (yyvsp[(2) - (4)].number), (yyvsp[(3) - (4)].number), (yyvsp[(4) - (4)].string)); 
+  case 188: /* mmonit: URLOBJECT nettimeout sslversion certmd5  */
+#line 659 "src/p.y"
+                                                          {
+                    check_hostname(((yyvsp[-3].url))->hostname);
+                    addmmonit((yyvsp[-3].url), (yyvsp[-2].number), (yyvsp[-1].number), (yyvsp[0].string)); 
                   }
+#line 2741 "src/y.tab.c"
     break;
 
-  case 175:
-
-/* Line 1806 of yacc.c  */
-#line 598 "src/p.y"
-    {
+  case 190: /* credentials: REGISTER CREDENTIALS  */
+#line 666 "src/p.y"
+                                       {
                     Run.dommonitcredentials = FALSE;
                   }
+#line 2749 "src/y.tab.c"
     break;
 
-  case 176:
-
-/* Line 1806 of yacc.c  */
-#line 603 "src/p.y"
-    {
-                   if (((yyvsp[(4) - (5)].number)) > SMTP_TIMEOUT)
-                     Run.mailserver_timeout = (yyvsp[(4) - (5)].number);
-                   Run.mail_hostname = (yyvsp[(5) - (5)].string);
+  case 191: /* setmailservers: SET MAILSERVER mailserverlist nettimeout hostname  */
+#line 671 "src/p.y"
+                                                                    {
+                   if (((yyvsp[-1].number)) > SMTP_TIMEOUT)
+                     Run.mailserver_timeout = (yyvsp[-1].number);
+                   Run.mail_hostname = (yyvsp[0].string);
                   }
+#line 2759 "src/y.tab.c"
     break;
 
-  case 177:
-
-/* Line 1806 of yacc.c  */
-#line 610 "src/p.y"
-    {
+  case 192: /* setmailformat: SET MAILFORMAT '{' formatoptionlist '}'  */
+#line 678 "src/p.y"
+                                                          {
                    Run.MailFormat.from    = mailset.from    ?  mailset.from    : Str_dup(ALERT_FROM);
                    Run.MailFormat.replyto = mailset.replyto ?  mailset.replyto : NULL;
                    Run.MailFormat.subject = mailset.subject ?  mailset.subject : Str_dup(ALERT_SUBJECT);
                    Run.MailFormat.message = mailset.message ?  mailset.message : Str_dup(ALERT_MESSAGE);
                    reset_mailset();
                  }
+#line 2771 "src/y.tab.c"
     break;
 
-  case 178:
-
-/* Line 1806 of yacc.c  */
-#line 619 "src/p.y"
-    {
+  case 193: /* sethttpd: SET HTTPD PORT NUMBER httpdlist  */
+#line 687 "src/p.y"
+                                                  {
                    Run.dohttpd = TRUE;
-                   Run.httpdport = (yyvsp[(4) - (5)].number);
+                   Run.httpdport = (yyvsp[-1].number);
                  }
+#line 2780 "src/y.tab.c"
     break;
 
-  case 181:
-
-/* Line 1806 of yacc.c  */
-#line 629 "src/p.y"
-    {
+  case 196: /* mailserver: STRING username password sslversion certmd5  */
+#line 697 "src/p.y"
+                                                              {
                     /* Restore the current text overriden by lookahead */
                     FREE(argyytext);
-                    argyytext = Str_dup((yyvsp[(1) - (5)].string));
+                    argyytext = Str_dup((yyvsp[-4].string));
 
-                    check_hostname((yyvsp[(1) - (5)].string));
-                    mailserverset.host = (yyvsp[(1) - (5)].string);
-                    mailserverset.username = (yyvsp[(2) - (5)].string);
-                    mailserverset.password = (yyvsp[(3) - (5)].string);
-                    mailserverset.ssl.version = (yyvsp[(4) - (5)].number);
+                    check_hostname((yyvsp[-4].string));
+                    mailserverset.host = (yyvsp[-4].string);
+                    mailserverset.username = (yyvsp[-3].string);
+                    mailserverset.password = (yyvsp[-2].string);
+                    mailserverset.ssl.version = (yyvsp[-1].number);
                     if (mailserverset.ssl.version != SSL_VERSION_NONE) {
                       mailserverset.ssl.use_ssl = TRUE;
                       if (mailserverset.ssl.version == SSL_VERSION_SSLV2 ||
                          mailserverset.ssl.version == SSL_VERSION_SSLV3)
                          mailserverset.port = PORT_SMTPS;
-                      mailserverset.ssl.certmd5 = (yyvsp[(5) - (5)].string);
+                      mailserverset.ssl.certmd5 = (yyvsp[0].string);
                     }
                     addmailserver(&mailserverset);
                   }
+#line 2804 "src/y.tab.c"
     break;
 
-  case 182:
-
-/* Line 1806 of yacc.c  */
-#line 648 "src/p.y"
-    {
+  case 197: /* mailserver: STRING PORT NUMBER username password sslversion certmd5  */
+#line 716 "src/p.y"
+                                                                          {
                     /* Restore the current text overriden by lookahead */
                     FREE(argyytext);
-                    argyytext = Str_dup((yyvsp[(1) - (7)].string));
-
-                    check_hostname((yyvsp[(1) - (7)].string));
-                    mailserverset.host = (yyvsp[(1) - (7)].string);
-                    mailserverset.port = (yyvsp[(3) - (7)].number);
-                    mailserverset.username = (yyvsp[(4) - (7)].string);
-                    mailserverset.password = (yyvsp[(5) - (7)].string);
-                    mailserverset.ssl.version = (yyvsp[(6) - (7)].number);
+                    argyytext = Str_dup((yyvsp[-6].string));
+
+                    check_hostname((yyvsp[-6].string));
+                    mailserverset.host = (yyvsp[-6].string);
+                    mailserverset.port = (yyvsp[-4].number);
+                    mailserverset.username = (yyvsp[-3].string);
+                    mailserverset.password = (yyvsp[-2].string);
+                    mailserverset.ssl.version = (yyvsp[-1].number);
                     if (mailserverset.ssl.version != SSL_VERSION_NONE) {
                       mailserverset.ssl.use_ssl = TRUE;
-                      mailserverset.ssl.certmd5 = (yyvsp[(7) - (7)].string);
+                      mailserverset.ssl.certmd5 = (yyvsp[0].string);
                     }
                     addmailserver(&mailserverset);
                   }
+#line 2826 "src/y.tab.c"
     break;
 
-  case 189:
-
-/* Line 1806 of yacc.c  */
-#line 677 "src/p.y"
-    {
+  case 206: /* ssl: ssldisable optssllist  */
+#line 747 "src/p.y"
+                                        {
                     Run.httpdssl = FALSE;
                   }
+#line 2834 "src/y.tab.c"
     break;
 
-  case 190:
-
-/* Line 1806 of yacc.c  */
-#line 680 "src/p.y"
-    {
+  case 207: /* ssl: sslenable optssllist  */
+#line 750 "src/p.y"
+                                       {
                     Run.httpdssl = TRUE;                   
                     if (! have_ssl())
                       yyerror("SSL is not supported");
@@ -3219,2389 +2845,2470 @@ yyreduce:
                     else if (! file_checkStat(Run.httpsslpem, "SSL server PEM file", S_IRWXU))
                       yyerror("SSL server PEM file permissions check failed");
                   }
+#line 2848 "src/y.tab.c"
     break;
 
-  case 200:
-
-/* Line 1806 of yacc.c  */
-#line 708 "src/p.y"
-    { Run.httpdsig = TRUE; }
+  case 217: /* signature: sigenable  */
+#line 778 "src/p.y"
+                             { Run.httpdsig = TRUE; }
+#line 2854 "src/y.tab.c"
     break;
 
-  case 201:
-
-/* Line 1806 of yacc.c  */
-#line 709 "src/p.y"
-    { Run.httpdsig = FALSE; }
+  case 218: /* signature: sigdisable  */
+#line 779 "src/p.y"
+                             { Run.httpdsig = FALSE; }
+#line 2860 "src/y.tab.c"
     break;
 
-  case 206:
+  case 223: /* bindaddress: ADDRESS STRING  */
+#line 790 "src/p.y"
+                                 { Run.bind_addr = (yyvsp[0].string); }
+#line 2866 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 720 "src/p.y"
-    { Run.bind_addr = (yyvsp[(2) - (2)].string); }
+  case 224: /* controlsocket: UNIXSOCKET PATH  */
+#line 793 "src/p.y"
+                                  { Run.httpdsocket = (yyvsp[0].string); }
+#line 2872 "src/y.tab.c"
     break;
 
-  case 207:
+  case 225: /* session: SESSION  */
+#line 796 "src/p.y"
+                          { Run.httpdsession = SESSION_TIMEOUT; }
+#line 2878 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 723 "src/p.y"
-    {
-                    Run.httpsslpem = (yyvsp[(2) - (2)].string);
+  case 226: /* session: SESSION TIMEOUT NUMBER SECOND  */
+#line 797 "src/p.y"
+                                                {
+                    if ((yyvsp[-1].number) < 1)
+                      yyerror2("The session timeout must be at least 1 second");
+                    Run.httpdsession = (yyvsp[-1].number);
                   }
+#line 2888 "src/y.tab.c"
     break;
 
-  case 208:
+  case 227: /* pemfile: PEMFILE PATH  */
+#line 804 "src/p.y"
+                               {
+                    Run.httpsslpem = (yyvsp[0].string);
+                  }
+#line 2896 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 728 "src/p.y"
-    {
-                    Run.httpsslclientpem = (yyvsp[(2) - (2)].string); 
+  case 228: /* clientpemfile: CLIENTPEMFILE PATH  */
+#line 809 "src/p.y"
+                                     {
+                    Run.httpsslclientpem = (yyvsp[0].string); 
                     Run.clientssl = TRUE;
                     if (!file_checkStat(Run.httpsslclientpem, "SSL client PEM file", S_IRWXU | S_IRGRP | S_IROTH))
                       yyerror2("SSL client PEM file has too loose permissions");
                   }
+#line 2907 "src/y.tab.c"
     break;
 
-  case 209:
-
-/* Line 1806 of yacc.c  */
-#line 736 "src/p.y"
-    {   
+  case 229: /* allowselfcert: ALLOWSELFCERTIFICATION  */
+#line 817 "src/p.y"
+                                         {   
                     Run.allowselfcert = TRUE;
                   }
+#line 2915 "src/y.tab.c"
     break;
 
-  case 210:
-
-/* Line 1806 of yacc.c  */
-#line 741 "src/p.y"
-    {
-                    addcredentials((yyvsp[(2) - (5)].string),(yyvsp[(4) - (5)].string), DIGEST_CLEARTEXT, (yyvsp[(5) - (5)].number));
+  case 230: /* allow: ALLOW STRING ':' STRING readonly  */
+#line 822 "src/p.y"
+                                                 {
+                    addcredentials((yyvsp[-3].string),(yyvsp[-1].string), DIGEST_CLEARTEXT, (yyvsp[0].number));
                   }
+#line 2923 "src/y.tab.c"
     break;
 
-  case 211:
-
-/* Line 1806 of yacc.c  */
-#line 744 "src/p.y"
-    {
+  case 231: /* allow: ALLOW '@' STRING readonly  */
+#line 825 "src/p.y"
+                                           {
 #ifdef HAVE_LIBPAM
-                    addpamauth((yyvsp[(3) - (4)].string), (yyvsp[(4) - (4)].number));
+                    addpamauth((yyvsp[-1].string), (yyvsp[0].number));
 #else
                     yyerror("PAM is not supported");
-                    FREE((yyvsp[(3) - (4)].string));
+                    FREE((yyvsp[-1].string));
 #endif
                   }
+#line 2936 "src/y.tab.c"
     break;
 
-  case 212:
-
-/* Line 1806 of yacc.c  */
-#line 752 "src/p.y"
-    {
-                    addhtpasswdentry((yyvsp[(2) - (2)].string), NULL, DIGEST_CLEARTEXT);
-                    FREE((yyvsp[(2) - (2)].string));
+  case 232: /* allow: ALLOW PATH  */
+#line 833 "src/p.y"
+                             {
+                    addhtpasswdentry((yyvsp[0].string), NULL, DIGEST_CLEARTEXT);
+                    FREE((yyvsp[0].string));
                   }
+#line 2945 "src/y.tab.c"
     break;
 
-  case 213:
-
-/* Line 1806 of yacc.c  */
-#line 756 "src/p.y"
-    {
-                    addhtpasswdentry((yyvsp[(3) - (3)].string), NULL, DIGEST_CLEARTEXT);
-                    FREE((yyvsp[(3) - (3)].string));
+  case 233: /* allow: ALLOW CLEARTEXT PATH  */
+#line 837 "src/p.y"
+                                       {
+                    addhtpasswdentry((yyvsp[0].string), NULL, DIGEST_CLEARTEXT);
+                    FREE((yyvsp[0].string));
                   }
+#line 2954 "src/y.tab.c"
     break;
 
-  case 214:
-
-/* Line 1806 of yacc.c  */
-#line 760 "src/p.y"
-    {
-                    addhtpasswdentry((yyvsp[(3) - (3)].string), NULL, DIGEST_MD5);
-                    FREE((yyvsp[(3) - (3)].string));
+  case 234: /* allow: ALLOW MD5HASH PATH  */
+#line 841 "src/p.y"
+                                     {
+                    addhtpasswdentry((yyvsp[0].string), NULL, DIGEST_MD5);
+                    FREE((yyvsp[0].string));
                   }
+#line 2963 "src/y.tab.c"
     break;
 
-  case 215:
-
-/* Line 1806 of yacc.c  */
-#line 764 "src/p.y"
-    {
-                    addhtpasswdentry((yyvsp[(3) - (3)].string), NULL, DIGEST_CRYPT);
-                    FREE((yyvsp[(3) - (3)].string));
+  case 235: /* allow: ALLOW CRYPT PATH  */
+#line 845 "src/p.y"
+                                   {
+                    addhtpasswdentry((yyvsp[0].string), NULL, DIGEST_CRYPT);
+                    FREE((yyvsp[0].string));
                   }
+#line 2972 "src/y.tab.c"
     break;
 
-  case 216:
-
-/* Line 1806 of yacc.c  */
-#line 768 "src/p.y"
-    {
-                    htpasswd_file = (yyvsp[(2) - (2)].string);
+  case 236: /* $@1: %empty  */
+#line 849 "src/p.y"
+                             {
+                    htpasswd_file = (yyvsp[0].string);
                     digesttype = CLEARTEXT;
                   }
+#line 2981 "src/y.tab.c"
     break;
 
-  case 217:
-
-/* Line 1806 of yacc.c  */
-#line 772 "src/p.y"
-    {
+  case 237: /* allow: ALLOW PATH $@1 allowuserlist  */
+#line 853 "src/p.y"
+                                {
                     FREE(htpasswd_file);
                   }
+#line 2989 "src/y.tab.c"
     break;
 
-  case 218:
-
-/* Line 1806 of yacc.c  */
-#line 775 "src/p.y"
-    {
-                    htpasswd_file = (yyvsp[(3) - (3)].string);
+  case 238: /* $@2: %empty  */
+#line 856 "src/p.y"
+                                       {
+                    htpasswd_file = (yyvsp[0].string);
                     digesttype = DIGEST_CLEARTEXT;
                   }
+#line 2998 "src/y.tab.c"
     break;
 
-  case 219:
-
-/* Line 1806 of yacc.c  */
-#line 779 "src/p.y"
-    {
+  case 239: /* allow: ALLOW CLEARTEXT PATH $@2 allowuserlist  */
+#line 860 "src/p.y"
+                                {
                     FREE(htpasswd_file);
                   }
+#line 3006 "src/y.tab.c"
     break;
 
-  case 220:
-
-/* Line 1806 of yacc.c  */
-#line 782 "src/p.y"
-    {
-                    htpasswd_file = (yyvsp[(3) - (3)].string);
+  case 240: /* $@3: %empty  */
+#line 863 "src/p.y"
+                                     {
+                    htpasswd_file = (yyvsp[0].string);
                     digesttype = DIGEST_MD5;
                   }
+#line 3015 "src/y.tab.c"
     break;
 
-  case 221:
-
-/* Line 1806 of yacc.c  */
-#line 786 "src/p.y"
-    {
+  case 241: /* allow: ALLOW MD5HASH PATH $@3 allowuserlist  */
+#line 867 "src/p.y"
+                                {
                     FREE(htpasswd_file);
                   }
+#line 3023 "src/y.tab.c"
     break;
 
-  case 222:
-
-/* Line 1806 of yacc.c  */
-#line 789 "src/p.y"
-    {
-                    htpasswd_file = (yyvsp[(3) - (3)].string);
+  case 242: /* $@4: %empty  */
+#line 870 "src/p.y"
+                                   {
+                    htpasswd_file = (yyvsp[0].string);
                     digesttype = DIGEST_CRYPT;
                   }
+#line 3032 "src/y.tab.c"
     break;
 
-  case 223:
-
-/* Line 1806 of yacc.c  */
-#line 793 "src/p.y"
-    {
+  case 243: /* allow: ALLOW CRYPT PATH $@4 allowuserlist  */
+#line 874 "src/p.y"
+                                {
                     FREE(htpasswd_file);
                   }
+#line 3040 "src/y.tab.c"
     break;
 
-  case 224:
-
-/* Line 1806 of yacc.c  */
-#line 796 "src/p.y"
-    {
-                    if (! (add_net_allow((yyvsp[(2) - (2)].string)) || add_host_allow((yyvsp[(2) - (2)].string)))) {
-                      yyerror2("erroneous network or host identifier %s", (yyvsp[(2) - (2)].string)); 
+  case 244: /* allow: ALLOW STRING  */
+#line 877 "src/p.y"
+                               {
+                    if (! (add_net_allow((yyvsp[0].string)) || add_host_allow((yyvsp[0].string)))) {
+                      yyerror2("erroneous network or host identifier %s", (yyvsp[0].string)); 
                     }
-                    FREE((yyvsp[(2) - (2)].string));
+                    FREE((yyvsp[0].string));
                   }
+#line 3051 "src/y.tab.c"
     break;
 
-  case 227:
-
-/* Line 1806 of yacc.c  */
-#line 808 "src/p.y"
-    { addhtpasswdentry(htpasswd_file, (yyvsp[(1) - (1)].string), digesttype);
-                           FREE((yyvsp[(1) - (1)].string)); }
+  case 247: /* allowuser: STRING  */
+#line 889 "src/p.y"
+                         { addhtpasswdentry(htpasswd_file, (yyvsp[0].string), digesttype);
+                           FREE((yyvsp[0].string)); }
+#line 3058 "src/y.tab.c"
     break;
 
-  case 228:
-
-/* Line 1806 of yacc.c  */
-#line 812 "src/p.y"
-    { (yyval.number) = FALSE; }
+  case 248: /* readonly: %empty  */
+#line 893 "src/p.y"
+                              { (yyval.number) = FALSE; }
+#line 3064 "src/y.tab.c"
     break;
 
-  case 229:
-
-/* Line 1806 of yacc.c  */
-#line 813 "src/p.y"
-    { (yyval.number) = TRUE; }
+  case 249: /* readonly: READONLY  */
+#line 894 "src/p.y"
+                           { (yyval.number) = TRUE; }
+#line 3070 "src/y.tab.c"
     break;
 
-  case 230:
-
-/* Line 1806 of yacc.c  */
-#line 816 "src/p.y"
-    {
-                    createservice(TYPE_PROCESS, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_process);
+  case 250: /* checkproc: CHECKPROC SERVICENAME PIDFILE PATH  */
+#line 897 "src/p.y"
+                                                     {
+                    createservice(TYPE_PROCESS, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                   }
+#line 3078 "src/y.tab.c"
     break;
 
-  case 231:
-
-/* Line 1806 of yacc.c  */
-#line 819 "src/p.y"
-    {
-                    createservice(TYPE_PROCESS, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_process);
+  case 251: /* checkproc: CHECKPROC SERVICENAME PATHTOK PATH  */
+#line 900 "src/p.y"
+                                                     {
+                    createservice(TYPE_PROCESS, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                   }
+#line 3086 "src/y.tab.c"
     break;
 
-  case 232:
-
-/* Line 1806 of yacc.c  */
-#line 822 "src/p.y"
-    {
-                    createservice(TYPE_PROCESS, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_process);
+  case 252: /* checkproc: CHECKPROC SERVICENAME MATCH STRING  */
+#line 903 "src/p.y"
+                                                     {
+                    createservice(TYPE_PROCESS, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                     matchset.ignore = FALSE;
                     matchset.match_path = NULL;
-                    matchset.match_string = Str_dup((yyvsp[(4) - (4)].string));
+                    matchset.match_string = Str_dup((yyvsp[0].string));
                     addmatch(&matchset, ACTION_IGNORE, 0);
                   }
+#line 3098 "src/y.tab.c"
     break;
 
-  case 233:
-
-/* Line 1806 of yacc.c  */
-#line 829 "src/p.y"
-    {
-                    createservice(TYPE_PROCESS, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_process);
+  case 253: /* checkproc: CHECKPROC SERVICENAME MATCH PATH  */
+#line 910 "src/p.y"
+                                                   {
+                    createservice(TYPE_PROCESS, (yyvsp[-2].string), (yyvsp[0].string), check_process);
                     matchset.ignore = FALSE;
                     matchset.match_path = NULL;
-                    matchset.match_string = Str_dup((yyvsp[(4) - (4)].string));
+                    matchset.match_string = Str_dup((yyvsp[0].string));
                     addmatch(&matchset, ACTION_IGNORE, 0);
                   }
+#line 3110 "src/y.tab.c"
     break;
 
-  case 234:
-
-/* Line 1806 of yacc.c  */
-#line 838 "src/p.y"
-    {
-                    createservice(TYPE_FILE, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_file);
+  case 254: /* checkfile: CHECKFILE SERVICENAME PATHTOK PATH  */
+#line 919 "src/p.y"
+                                                     {
+                    createservice(TYPE_FILE, (yyvsp[-2].string), (yyvsp[0].string), check_file);
                   }
+#line 3118 "src/y.tab.c"
     break;
 
-  case 235:
-
-/* Line 1806 of yacc.c  */
-#line 843 "src/p.y"
-    {
-                    createservice(TYPE_FILESYSTEM, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_filesystem);
+  case 255: /* checkfilesys: CHECKFILESYS SERVICENAME PATHTOK PATH  */
+#line 924 "src/p.y"
+                                                        {
+                    createservice(TYPE_FILESYSTEM, (yyvsp[-2].string), (yyvsp[0].string), check_filesystem);
                   }
+#line 3126 "src/y.tab.c"
     break;
 
-  case 236:
-
-/* Line 1806 of yacc.c  */
-#line 848 "src/p.y"
-    {
-                    createservice(TYPE_DIRECTORY, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_directory);
+  case 256: /* checkdir: CHECKDIR SERVICENAME PATHTOK PATH  */
+#line 929 "src/p.y"
+                                                    {
+                    createservice(TYPE_DIRECTORY, (yyvsp[-2].string), (yyvsp[0].string), check_directory);
                   }
+#line 3134 "src/y.tab.c"
     break;
 
-  case 237:
-
-/* Line 1806 of yacc.c  */
-#line 853 "src/p.y"
-    {
-                    check_hostname((yyvsp[(4) - (4)].string)); 
-                    createservice(TYPE_HOST, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_remote_host);
+  case 257: /* checkhost: CHECKHOST SERVICENAME ADDRESS STRING  */
+#line 934 "src/p.y"
+                                                       {
+                    check_hostname((yyvsp[0].string)); 
+                    createservice(TYPE_HOST, (yyvsp[-2].string), (yyvsp[0].string), check_remote_host);
                   }
+#line 3143 "src/y.tab.c"
     break;
 
-  case 238:
-
-/* Line 1806 of yacc.c  */
-#line 859 "src/p.y"
-    {
+  case 258: /* checksystem: CHECKSYSTEM SERVICENAME  */
+#line 940 "src/p.y"
+                                          {
                     char hostname[STRLEN];
                     if (Util_getfqdnhostname(hostname, sizeof(hostname))) {
                       LogError("Cannot get system hostname\n");
                       cfg_errflag++;
                     }
-                    char *servicename = (yyvsp[(2) - (2)].string);
+                    char *servicename = (yyvsp[0].string);
                     Util_replaceString(&servicename, "$HOST", hostname);
                     Run.system = createservice(TYPE_SYSTEM, servicename, Str_dup(""), check_system); // The name given in the 'check system' statement overrides system hostname
                   }
+#line 3158 "src/y.tab.c"
     break;
 
-  case 239:
-
-/* Line 1806 of yacc.c  */
-#line 871 "src/p.y"
-    {
-                    createservice(TYPE_FIFO, (yyvsp[(2) - (4)].string), (yyvsp[(4) - (4)].string), check_fifo);
+  case 259: /* checkfifo: CHECKFIFO SERVICENAME PATHTOK PATH  */
+#line 952 "src/p.y"
+                                                     {
+                    createservice(TYPE_FIFO, (yyvsp[-2].string), (yyvsp[0].string), check_fifo);
                   }
+#line 3166 "src/y.tab.c"
     break;
 
-  case 240:
-
-/* Line 1806 of yacc.c  */
-#line 876 "src/p.y"
-    {
-                        check_exec((yyvsp[(4) - (5)].string));
-                        createservice(TYPE_PROGRAM, (yyvsp[(2) - (5)].string), (yyvsp[(4) - (5)].string), check_program);
-                        current->program->timeout = (yyvsp[(5) - (5)].number);
+  case 260: /* checkprogram: CHECKPROGRAM SERVICENAME PATHTOK PATH programtimeout  */
+#line 957 "src/p.y"
+                                                                        {
+                        check_exec((yyvsp[-1].string));
+                        createservice(TYPE_PROGRAM, (yyvsp[-3].string), (yyvsp[-1].string), check_program);
+                        current->program->timeout = (yyvsp[0].number);
                   }
+#line 3176 "src/y.tab.c"
     break;
 
-  case 241:
-
-/* Line 1806 of yacc.c  */
-#line 883 "src/p.y"
-    {
-                    addcommand(START, (yyvsp[(3) - (3)].number));
+  case 261: /* start: START argumentlist exectimeout  */
+#line 964 "src/p.y"
+                                                 {
+                    addcommand(START, (yyvsp[0].number));
                   }
+#line 3184 "src/y.tab.c"
     break;
 
-  case 242:
-
-/* Line 1806 of yacc.c  */
-#line 886 "src/p.y"
-    {
-                    addcommand(START, (yyvsp[(4) - (4)].number));
+  case 262: /* start: START argumentlist useroptionlist exectimeout  */
+#line 967 "src/p.y"
+                                                                {
+                    addcommand(START, (yyvsp[0].number));
                   }
+#line 3192 "src/y.tab.c"
     break;
 
-  case 243:
-
-/* Line 1806 of yacc.c  */
-#line 891 "src/p.y"
-    {
-                    addcommand(STOP, (yyvsp[(3) - (3)].number));
+  case 263: /* stop: STOP argumentlist exectimeout  */
+#line 972 "src/p.y"
+                                                {
+                    addcommand(STOP, (yyvsp[0].number));
                   }
+#line 3200 "src/y.tab.c"
     break;
 
-  case 244:
-
-/* Line 1806 of yacc.c  */
-#line 894 "src/p.y"
-    {
-                    addcommand(STOP, (yyvsp[(4) - (4)].number));
+  case 264: /* stop: STOP argumentlist useroptionlist exectimeout  */
+#line 975 "src/p.y"
+                                                               {
+                    addcommand(STOP, (yyvsp[0].number));
                   }
+#line 3208 "src/y.tab.c"
     break;
 
-  case 245:
-
-/* Line 1806 of yacc.c  */
-#line 900 "src/p.y"
-    {
-                    addcommand(RESTART, (yyvsp[(3) - (3)].number));
+  case 265: /* restart: RESTART argumentlist exectimeout  */
+#line 981 "src/p.y"
+                                                   {
+                    addcommand(RESTART, (yyvsp[0].number));
                   }
+#line 3216 "src/y.tab.c"
     break;
 
-  case 246:
-
-/* Line 1806 of yacc.c  */
-#line 903 "src/p.y"
-    {
-                    addcommand(RESTART, (yyvsp[(4) - (4)].number));
+  case 266: /* restart: RESTART argumentlist useroptionlist exectimeout  */
+#line 984 "src/p.y"
+                                                                  {
+                    addcommand(RESTART, (yyvsp[0].number));
                   }
+#line 3224 "src/y.tab.c"
     break;
 
-  case 251:
-
-/* Line 1806 of yacc.c  */
-#line 916 "src/p.y"
-    { addargument((yyvsp[(1) - (1)].string)); }
+  case 271: /* argument: STRING  */
+#line 997 "src/p.y"
+                         { addargument((yyvsp[0].string)); }
+#line 3230 "src/y.tab.c"
     break;
 
-  case 252:
-
-/* Line 1806 of yacc.c  */
-#line 917 "src/p.y"
-    { addargument((yyvsp[(1) - (1)].string)); }
+  case 272: /* argument: PATH  */
+#line 998 "src/p.y"
+                         { addargument((yyvsp[0].string)); }
+#line 3236 "src/y.tab.c"
     break;
 
-  case 253:
-
-/* Line 1806 of yacc.c  */
-#line 920 "src/p.y"
-    { addeuid( get_uid((yyvsp[(2) - (2)].string), 0) ); FREE((yyvsp[(2) - (2)].string)); }
+  case 273: /* useroption: UID STRING  */
+#line 1001 "src/p.y"
+                             { addeuid( get_uid((yyvsp[0].string), 0) ); FREE((yyvsp[0].string)); }
+#line 3242 "src/y.tab.c"
     break;
 
-  case 254:
-
-/* Line 1806 of yacc.c  */
-#line 921 "src/p.y"
-    { addegid( get_gid((yyvsp[(2) - (2)].string), 0) ); FREE((yyvsp[(2) - (2)].string)); }
+  case 274: /* useroption: GID STRING  */
+#line 1002 "src/p.y"
+                             { addegid( get_gid((yyvsp[0].string), 0) ); FREE((yyvsp[0].string)); }
+#line 3248 "src/y.tab.c"
     break;
 
-  case 255:
-
-/* Line 1806 of yacc.c  */
-#line 922 "src/p.y"
-    { addeuid( get_uid(NULL, (yyvsp[(2) - (2)].number)) ); }
+  case 275: /* useroption: UID NUMBER  */
+#line 1003 "src/p.y"
+                             { addeuid( get_uid(NULL, (yyvsp[0].number)) ); }
+#line 3254 "src/y.tab.c"
     break;
 
-  case 256:
-
-/* Line 1806 of yacc.c  */
-#line 923 "src/p.y"
-    { addegid( get_gid(NULL, (yyvsp[(2) - (2)].number)) ); }
+  case 276: /* useroption: GID NUMBER  */
+#line 1004 "src/p.y"
+                             { addegid( get_gid(NULL, (yyvsp[0].number)) ); }
+#line 3260 "src/y.tab.c"
     break;
 
-  case 257:
-
-/* Line 1806 of yacc.c  */
-#line 926 "src/p.y"
-    { (yyval.string) = NULL; }
+  case 277: /* username: %empty  */
+#line 1007 "src/p.y"
+                                  { (yyval.string) = NULL; }
+#line 3266 "src/y.tab.c"
     break;
 
-  case 258:
-
-/* Line 1806 of yacc.c  */
-#line 927 "src/p.y"
-    { (yyval.string) = (yyvsp[(2) - (2)].string); }
+  case 278: /* username: USERNAME MAILADDR  */
+#line 1008 "src/p.y"
+                                    { (yyval.string) = (yyvsp[0].string); }
+#line 3272 "src/y.tab.c"
     break;
 
-  case 259:
-
-/* Line 1806 of yacc.c  */
-#line 928 "src/p.y"
-    { (yyval.string) = (yyvsp[(2) - (2)].string); }
+  case 279: /* username: USERNAME STRING  */
+#line 1009 "src/p.y"
+                                  { (yyval.string) = (yyvsp[0].string); }
+#line 3278 "src/y.tab.c"
     break;
 
-  case 260:
-
-/* Line 1806 of yacc.c  */
-#line 931 "src/p.y"
-    { (yyval.string) = NULL; }
+  case 280: /* password: %empty  */
+#line 1012 "src/p.y"
+                                  { (yyval.string) = NULL; }
+#line 3284 "src/y.tab.c"
     break;
 
-  case 261:
-
-/* Line 1806 of yacc.c  */
-#line 932 "src/p.y"
-    { (yyval.string) = (yyvsp[(2) - (2)].string); }
+  case 281: /* password: PASSWORD STRING  */
+#line 1013 "src/p.y"
+                                  { (yyval.string) = (yyvsp[0].string); }
+#line 3290 "src/y.tab.c"
     break;
 
-  case 262:
-
-/* Line 1806 of yacc.c  */
-#line 935 "src/p.y"
-    { (yyval.string) = NULL; }
+  case 282: /* hostname: %empty  */
+#line 1016 "src/p.y"
+                                  { (yyval.string) = NULL; }
+#line 3296 "src/y.tab.c"
     break;
 
-  case 263:
-
-/* Line 1806 of yacc.c  */
-#line 936 "src/p.y"
-    { (yyval.string) = (yyvsp[(2) - (2)].string); }
+  case 283: /* hostname: HOSTNAME STRING  */
+#line 1017 "src/p.y"
+                                  { (yyval.string) = (yyvsp[0].string); }
+#line 3302 "src/y.tab.c"
     break;
 
-  case 264:
-
-/* Line 1806 of yacc.c  */
-#line 940 "src/p.y"
-    {
-                    portset.timeout = (yyvsp[(7) - (12)].number);
-                    portset.retry = (yyvsp[(8) - (12)].number);
-                    addeventaction(&(portset).action, (yyvsp[(11) - (12)].number), (yyvsp[(12) - (12)].number));
+  case 284: /* connection: IF FAILED host port type protocol nettimeout retry rate1 THEN action1 recovery  */
+#line 1021 "src/p.y"
+                                        {
+                    portset.timeout = (yyvsp[-5].number);
+                    portset.retry = (yyvsp[-4].number);
+                    addeventaction(&(portset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addport(&portset);
                   }
+#line 3313 "src/y.tab.c"
     break;
 
-  case 265:
-
-/* Line 1806 of yacc.c  */
-#line 947 "src/p.y"
-    { 
-                    prepare_urlrequest((yyvsp[(4) - (11)].url));
-                    portset.timeout = (yyvsp[(6) - (11)].number);
-                    portset.retry = (yyvsp[(7) - (11)].number);
-                    addeventaction(&(portset).action, (yyvsp[(10) - (11)].number), (yyvsp[(11) - (11)].number));
+  case 285: /* connection: IF FAILED URL URLOBJECT urloption nettimeout retry rate1 THEN action1 recovery  */
+#line 1028 "src/p.y"
+                                        { 
+                    prepare_urlrequest((yyvsp[-7].url));
+                    portset.timeout = (yyvsp[-5].number);
+                    portset.retry = (yyvsp[-4].number);
+                    addeventaction(&(portset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addport(&portset);
                   }
+#line 3325 "src/y.tab.c"
     break;
 
-  case 266:
-
-/* Line 1806 of yacc.c  */
-#line 957 "src/p.y"
-    {
-                   portset.timeout = (yyvsp[(6) - (11)].number);
-                   portset.retry = (yyvsp[(7) - (11)].number);
-                   addeventaction(&(portset).action, (yyvsp[(10) - (11)].number), (yyvsp[(11) - (11)].number));
+  case 286: /* connectionunix: IF FAILED unixsocket type protocol nettimeout retry rate1 THEN action1 recovery  */
+#line 1038 "src/p.y"
+                                        {
+                   portset.timeout = (yyvsp[-5].number);
+                   portset.retry = (yyvsp[-4].number);
+                   addeventaction(&(portset).action, (yyvsp[-1].number), (yyvsp[0].number));
                    addport(&portset);
                   }
+#line 3336 "src/y.tab.c"
     break;
 
-  case 267:
-
-/* Line 1806 of yacc.c  */
-#line 966 "src/p.y"
-    {
-                   icmpset.type = (yyvsp[(4) - (10)].number);
-                   icmpset.count = (yyvsp[(5) - (10)].number);
-                   icmpset.timeout = (yyvsp[(6) - (10)].number);
-                   addeventaction(&(icmpset).action, (yyvsp[(9) - (10)].number), (yyvsp[(10) - (10)].number));
+  case 287: /* icmp: IF FAILED ICMP icmptype icmpcount nettimeout rate1 THEN action1 recovery  */
+#line 1047 "src/p.y"
+                                        {
+                   icmpset.type = (yyvsp[-6].number);
+                   icmpset.count = (yyvsp[-5].number);
+                   icmpset.timeout = (yyvsp[-4].number);
+                   addeventaction(&(icmpset).action, (yyvsp[-1].number), (yyvsp[0].number));
                    addicmp(&icmpset);
                   }
+#line 3348 "src/y.tab.c"
     break;
 
-  case 268:
-
-/* Line 1806 of yacc.c  */
-#line 975 "src/p.y"
-    {
+  case 288: /* host: %empty  */
+#line 1056 "src/p.y"
+                              {
                     if (current->type == TYPE_HOST)
                       portset.hostname = Str_dup(current->path);
                     else
                       portset.hostname = Str_dup(LOCALHOST);
                   }
+#line 3359 "src/y.tab.c"
     break;
 
-  case 269:
-
-/* Line 1806 of yacc.c  */
-#line 981 "src/p.y"
-    { check_hostname((yyvsp[(2) - (2)].string)); portset.hostname = (yyvsp[(2) - (2)].string); }
+  case 289: /* host: HOST STRING  */
+#line 1062 "src/p.y"
+                              { check_hostname((yyvsp[0].string)); portset.hostname = (yyvsp[0].string); }
+#line 3365 "src/y.tab.c"
     break;
 
-  case 270:
-
-/* Line 1806 of yacc.c  */
-#line 984 "src/p.y"
-    { portset.port = (yyvsp[(2) - (2)].number); portset.family = AF_INET; }
+  case 290: /* port: PORT NUMBER  */
+#line 1065 "src/p.y"
+                              { portset.port = (yyvsp[0].number); portset.family = AF_INET; }
+#line 3371 "src/y.tab.c"
     break;
 
-  case 271:
-
-/* Line 1806 of yacc.c  */
-#line 987 "src/p.y"
-    {
-                    portset.pathname = (yyvsp[(2) - (2)].string); portset.family = AF_UNIX;
+  case 291: /* unixsocket: UNIXSOCKET PATH  */
+#line 1068 "src/p.y"
+                                  {
+                    portset.pathname = (yyvsp[0].string); portset.family = AF_UNIX;
                   }
+#line 3379 "src/y.tab.c"
     break;
 
-  case 272:
-
-/* Line 1806 of yacc.c  */
-#line 992 "src/p.y"
-    {
+  case 292: /* type: %empty  */
+#line 1073 "src/p.y"
+                              {
                     portset.type = SOCK_STREAM;
                   }
+#line 3387 "src/y.tab.c"
     break;
 
-  case 273:
-
-/* Line 1806 of yacc.c  */
-#line 995 "src/p.y"
-    {
+  case 293: /* type: TYPE TCP  */
+#line 1076 "src/p.y"
+                           {
                     portset.type = SOCK_STREAM;
                   }
+#line 3395 "src/y.tab.c"
     break;
 
-  case 274:
-
-/* Line 1806 of yacc.c  */
-#line 998 "src/p.y"
-    {
+  case 294: /* type: TYPE TCPSSL sslversion certmd5  */
+#line 1079 "src/p.y"
+                                                  {
                     portset.type = SOCK_STREAM;
                     portset.SSL.use_ssl = TRUE;
-                    portset.SSL.version = (yyvsp[(3) - (4)].number);
+                    portset.SSL.version = (yyvsp[-1].number);
                     if (portset.SSL.version == SSL_VERSION_NONE)
                       portset.SSL.version = SSL_VERSION_AUTO;
-                    portset.SSL.certmd5 = (yyvsp[(4) - (4)].string);
+                    portset.SSL.certmd5 = (yyvsp[0].string);
                   }
+#line 3408 "src/y.tab.c"
     break;
 
-  case 275:
-
-/* Line 1806 of yacc.c  */
-#line 1006 "src/p.y"
-    {
+  case 295: /* type: TYPE UDP  */
+#line 1087 "src/p.y"
+                           {
                     portset.type = SOCK_DGRAM;
                   }
+#line 3416 "src/y.tab.c"
     break;
 
-  case 276:
-
-/* Line 1806 of yacc.c  */
-#line 1011 "src/p.y"
-    { (yyval.string) = NULL; }
+  case 296: /* certmd5: %empty  */
+#line 1092 "src/p.y"
+                                 { (yyval.string) = NULL; }
+#line 3422 "src/y.tab.c"
     break;
 
-  case 277:
-
-/* Line 1806 of yacc.c  */
-#line 1012 "src/p.y"
-    { (yyval.string) = (yyvsp[(2) - (2)].string); }
+  case 297: /* certmd5: CERTMD5 STRING  */
+#line 1093 "src/p.y"
+                                 { (yyval.string) = (yyvsp[0].string); }
+#line 3428 "src/y.tab.c"
     break;
 
-  case 278:
-
-/* Line 1806 of yacc.c  */
-#line 1015 "src/p.y"
-    { (yyval.number) = SSL_VERSION_NONE; }
+  case 298: /* sslversion: %empty  */
+#line 1096 "src/p.y"
+                               { (yyval.number) = SSL_VERSION_NONE; }
+#line 3434 "src/y.tab.c"
     break;
 
-  case 279:
-
-/* Line 1806 of yacc.c  */
-#line 1016 "src/p.y"
-    { (yyval.number) = SSL_VERSION_SSLV2; }
+  case 299: /* sslversion: SSLV2  */
+#line 1097 "src/p.y"
+                               { (yyval.number) = SSL_VERSION_SSLV2; }
+#line 3440 "src/y.tab.c"
     break;
 
-  case 280:
-
-/* Line 1806 of yacc.c  */
-#line 1017 "src/p.y"
-    { (yyval.number) = SSL_VERSION_SSLV3; }
+  case 300: /* sslversion: SSLV3  */
+#line 1098 "src/p.y"
+                               { (yyval.number) = SSL_VERSION_SSLV3; }
+#line 3446 "src/y.tab.c"
     break;
 
-  case 281:
-
-/* Line 1806 of yacc.c  */
-#line 1018 "src/p.y"
-    { (yyval.number) = SSL_VERSION_TLS; }
+  case 301: /* sslversion: TLSV1  */
+#line 1099 "src/p.y"
+                               { (yyval.number) = SSL_VERSION_TLS; }
+#line 3452 "src/y.tab.c"
     break;
 
-  case 282:
-
-/* Line 1806 of yacc.c  */
-#line 1019 "src/p.y"
-    { (yyval.number) = SSL_VERSION_AUTO; }
+  case 302: /* sslversion: SSLAUTO  */
+#line 1100 "src/p.y"
+                               { (yyval.number) = SSL_VERSION_AUTO; }
+#line 3458 "src/y.tab.c"
     break;
 
-  case 283:
-
-/* Line 1806 of yacc.c  */
-#line 1022 "src/p.y"
-    {
+  case 303: /* protocol: %empty  */
+#line 1103 "src/p.y"
+                               {
                     portset.protocol = Protocol_get(Protocol_DEFAULT);
                   }
+#line 3466 "src/y.tab.c"
     break;
 
-  case 284:
-
-/* Line 1806 of yacc.c  */
-#line 1025 "src/p.y"
-    {
+  case 304: /* protocol: PROTOCOL APACHESTATUS apache_stat_list  */
+#line 1106 "src/p.y"
+                                                         {
                     portset.protocol = Protocol_get(Protocol_APACHESTATUS);
                   }
+#line 3474 "src/y.tab.c"
     break;
 
-  case 285:
-
-/* Line 1806 of yacc.c  */
-#line 1028 "src/p.y"
-    {
+  case 305: /* protocol: PROTOCOL DEFAULT  */
+#line 1109 "src/p.y"
+                                   {
                     portset.protocol = Protocol_get(Protocol_DEFAULT);
                   }
+#line 3482 "src/y.tab.c"
     break;
 
-  case 286:
-
-/* Line 1806 of yacc.c  */
-#line 1031 "src/p.y"
-    {
+  case 306: /* protocol: PROTOCOL DNS  */
+#line 1112 "src/p.y"
+                               {
                     portset.protocol = Protocol_get(Protocol_DNS);
                   }
+#line 3490 "src/y.tab.c"
     break;
 
-  case 287:
-
-/* Line 1806 of yacc.c  */
-#line 1034 "src/p.y"
-    {
+  case 307: /* protocol: PROTOCOL DWP  */
+#line 1115 "src/p.y"
+                                {
                     portset.protocol = Protocol_get(Protocol_DWP);
                   }
+#line 3498 "src/y.tab.c"
     break;
 
-  case 288:
-
-/* Line 1806 of yacc.c  */
-#line 1037 "src/p.y"
-    {
+  case 308: /* protocol: PROTOCOL FTP  */
+#line 1118 "src/p.y"
+                               {
                     portset.protocol = Protocol_get(Protocol_FTP);
                   }
+#line 3506 "src/y.tab.c"
     break;
 
-  case 289:
-
-/* Line 1806 of yacc.c  */
-#line 1040 "src/p.y"
-    {
+  case 309: /* protocol: PROTOCOL HTTP request  */
+#line 1121 "src/p.y"
+                                        {
                     portset.protocol = Protocol_get(Protocol_HTTP);
                   }
+#line 3514 "src/y.tab.c"
     break;
 
-  case 290:
-
-/* Line 1806 of yacc.c  */
-#line 1043 "src/p.y"
-    {
+  case 310: /* protocol: PROTOCOL IMAP  */
+#line 1124 "src/p.y"
+                                {
                     portset.protocol = Protocol_get(Protocol_IMAP);
                   }
+#line 3522 "src/y.tab.c"
     break;
 
-  case 291:
-
-/* Line 1806 of yacc.c  */
-#line 1046 "src/p.y"
-    {
+  case 311: /* protocol: PROTOCOL CLAMAV  */
+#line 1127 "src/p.y"
+                                  {
                     portset.protocol = Protocol_get(Protocol_CLAMAV);
                   }
+#line 3530 "src/y.tab.c"
     break;
 
-  case 292:
-
-/* Line 1806 of yacc.c  */
-#line 1049 "src/p.y"
-    {
+  case 312: /* protocol: PROTOCOL LDAP2  */
+#line 1130 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_LDAP2);
                   }
+#line 3538 "src/y.tab.c"
     break;
 
-  case 293:
-
-/* Line 1806 of yacc.c  */
-#line 1052 "src/p.y"
-    {
+  case 313: /* protocol: PROTOCOL LDAP3  */
+#line 1133 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_LDAP3);
                   }
+#line 3546 "src/y.tab.c"
     break;
 
-  case 294:
-
-/* Line 1806 of yacc.c  */
-#line 1055 "src/p.y"
-    {
+  case 314: /* protocol: PROTOCOL MYSQL  */
+#line 1136 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_MYSQL);
                   }
+#line 3554 "src/y.tab.c"
     break;
 
-  case 295:
-
-/* Line 1806 of yacc.c  */
-#line 1058 "src/p.y"
-    {
+  case 315: /* protocol: PROTOCOL SIP target maxforward  */
+#line 1139 "src/p.y"
+                                                 {
                     portset.protocol = Protocol_get(Protocol_SIP);
                   }
+#line 3562 "src/y.tab.c"
     break;
 
-  case 296:
-
-/* Line 1806 of yacc.c  */
-#line 1061 "src/p.y"
-    {
+  case 316: /* protocol: PROTOCOL NNTP  */
+#line 1142 "src/p.y"
+                                {
                     portset.protocol = Protocol_get(Protocol_NNTP);
                   }
+#line 3570 "src/y.tab.c"
     break;
 
-  case 297:
-
-/* Line 1806 of yacc.c  */
-#line 1064 "src/p.y"
-    {
+  case 317: /* protocol: PROTOCOL NTP3  */
+#line 1145 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_NTP3);
                     portset.type = SOCK_DGRAM;
                   }
+#line 3579 "src/y.tab.c"
     break;
 
-  case 298:
-
-/* Line 1806 of yacc.c  */
-#line 1068 "src/p.y"
-    {
+  case 318: /* protocol: PROTOCOL POSTFIXPOLICY  */
+#line 1149 "src/p.y"
+                                         {
                     portset.protocol = Protocol_get(Protocol_POSTFIXPOLICY);
                   }
+#line 3587 "src/y.tab.c"
     break;
 
-  case 299:
-
-/* Line 1806 of yacc.c  */
-#line 1071 "src/p.y"
-    {
+  case 319: /* protocol: PROTOCOL POP  */
+#line 1152 "src/p.y"
+                               {
                     portset.protocol = Protocol_get(Protocol_POP);
                   }
+#line 3595 "src/y.tab.c"
     break;
 
-  case 300:
-
-/* Line 1806 of yacc.c  */
-#line 1074 "src/p.y"
-    {
+  case 320: /* protocol: PROTOCOL SMTP  */
+#line 1155 "src/p.y"
+                                {
                     portset.protocol = Protocol_get(Protocol_SMTP);
                   }
+#line 3603 "src/y.tab.c"
     break;
 
-  case 301:
-
-/* Line 1806 of yacc.c  */
-#line 1077 "src/p.y"
-    {
+  case 321: /* protocol: PROTOCOL SSH  */
+#line 1158 "src/p.y"
+                                {
                     portset.protocol = Protocol_get(Protocol_SSH);
                   }
+#line 3611 "src/y.tab.c"
     break;
 
-  case 302:
-
-/* Line 1806 of yacc.c  */
-#line 1080 "src/p.y"
-    {
+  case 322: /* protocol: PROTOCOL RDATE  */
+#line 1161 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_RDATE);
                   }
+#line 3619 "src/y.tab.c"
     break;
 
-  case 303:
-
-/* Line 1806 of yacc.c  */
-#line 1083 "src/p.y"
-    {
+  case 323: /* protocol: PROTOCOL RSYNC  */
+#line 1164 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_RSYNC);
                   }
+#line 3627 "src/y.tab.c"
     break;
 
-  case 304:
-
-/* Line 1806 of yacc.c  */
-#line 1086 "src/p.y"
-    {
+  case 324: /* protocol: PROTOCOL TNS  */
+#line 1167 "src/p.y"
+                               {
                     portset.protocol = Protocol_get(Protocol_TNS);
                   }
+#line 3635 "src/y.tab.c"
     break;
 
-  case 305:
-
-/* Line 1806 of yacc.c  */
-#line 1089 "src/p.y"
-    {
+  case 325: /* protocol: PROTOCOL PGSQL  */
+#line 1170 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_PGSQL);
                   }
+#line 3643 "src/y.tab.c"
     break;
 
-  case 306:
-
-/* Line 1806 of yacc.c  */
-#line 1092 "src/p.y"
-    {
+  case 326: /* protocol: PROTOCOL LMTP  */
+#line 1173 "src/p.y"
+                                {
                     portset.protocol = Protocol_get(Protocol_LMTP);
                   }
+#line 3651 "src/y.tab.c"
     break;
 
-  case 307:
-
-/* Line 1806 of yacc.c  */
-#line 1095 "src/p.y"
-    {
+  case 327: /* protocol: PROTOCOL GPS  */
+#line 1176 "src/p.y"
+                               {
                     portset.protocol = Protocol_get(Protocol_GPS);
                   }
+#line 3659 "src/y.tab.c"
     break;
 
-  case 308:
-
-/* Line 1806 of yacc.c  */
-#line 1098 "src/p.y"
-    {
+  case 328: /* protocol: PROTOCOL RADIUS secret  */
+#line 1179 "src/p.y"
+                                         {
                     portset.protocol = Protocol_get(Protocol_RADIUS);
                   }
+#line 3667 "src/y.tab.c"
     break;
 
-  case 309:
-
-/* Line 1806 of yacc.c  */
-#line 1101 "src/p.y"
-    {
+  case 329: /* protocol: PROTOCOL MEMCACHE  */
+#line 1182 "src/p.y"
+                                    {
                     portset.protocol = Protocol_get(Protocol_MEMCACHE);
                   }
+#line 3675 "src/y.tab.c"
     break;
 
-  case 310:
-
-/* Line 1806 of yacc.c  */
-#line 1104 "src/p.y"
-    {
+  case 330: /* protocol: sendexpectlist  */
+#line 1185 "src/p.y"
+                                 {
                     portset.protocol = Protocol_get(Protocol_GENERIC);
                   }
+#line 3683 "src/y.tab.c"
     break;
 
-  case 313:
-
-/* Line 1806 of yacc.c  */
-#line 1113 "src/p.y"
-    { addgeneric(&portset, (yyvsp[(2) - (2)].string), NULL); FREE((yyvsp[(2) - (2)].string));}
+  case 333: /* sendexpect: SEND STRING  */
+#line 1194 "src/p.y"
+                              { addgeneric(&portset, (yyvsp[0].string), NULL); FREE((yyvsp[0].string));}
+#line 3689 "src/y.tab.c"
     break;
 
-  case 314:
-
-/* Line 1806 of yacc.c  */
-#line 1114 "src/p.y"
-    { addgeneric(&portset, NULL, (yyvsp[(2) - (2)].string)); FREE((yyvsp[(2) - (2)].string));}
+  case 334: /* sendexpect: EXPECT STRING  */
+#line 1195 "src/p.y"
+                                { addgeneric(&portset, NULL, (yyvsp[0].string)); FREE((yyvsp[0].string));}
+#line 3695 "src/y.tab.c"
     break;
 
-  case 316:
-
-/* Line 1806 of yacc.c  */
-#line 1118 "src/p.y"
-    {
-                    portset.request = (yyvsp[(2) - (2)].string);
+  case 336: /* target: TARGET MAILADDR  */
+#line 1199 "src/p.y"
+                                  {
+                    portset.request = (yyvsp[0].string);
                   }
+#line 3703 "src/y.tab.c"
     break;
 
-  case 317:
-
-/* Line 1806 of yacc.c  */
-#line 1121 "src/p.y"
-    {
-                    portset.request = (yyvsp[(2) - (2)].string);
+  case 337: /* target: TARGET STRING  */
+#line 1202 "src/p.y"
+                                {
+                    portset.request = (yyvsp[0].string);
                   }
+#line 3711 "src/y.tab.c"
     break;
 
-  case 319:
-
-/* Line 1806 of yacc.c  */
-#line 1127 "src/p.y"
-    {
-                     portset.maxforward = verifyMaxForward((yyvsp[(2) - (2)].number)); 
+  case 339: /* maxforward: MAXFORWARD NUMBER  */
+#line 1208 "src/p.y"
+                                     {
+                     portset.maxforward = verifyMaxForward((yyvsp[0].number)); 
                    }
+#line 3719 "src/y.tab.c"
     break;
 
-  case 321:
-
-/* Line 1806 of yacc.c  */
-#line 1133 "src/p.y"
-    { 
-                    portset.request = Util_urlEncode((yyvsp[(2) - (3)].string)); 
-                    FREE((yyvsp[(2) - (3)].string)); 
+  case 341: /* request: REQUEST PATH hostheader  */
+#line 1214 "src/p.y"
+                                          { 
+                    portset.request = Util_urlEncode((yyvsp[-1].string)); 
+                    FREE((yyvsp[-1].string)); 
                   }
+#line 3728 "src/y.tab.c"
     break;
 
-  case 322:
-
-/* Line 1806 of yacc.c  */
-#line 1137 "src/p.y"
-    {
-                    portset.request = Util_urlEncode((yyvsp[(2) - (5)].string));
-                    FREE((yyvsp[(2) - (5)].string));
-                    portset.request_checksum = (yyvsp[(4) - (5)].string);
+  case 342: /* request: REQUEST PATH CHECKSUM STRING hostheader  */
+#line 1218 "src/p.y"
+                                                          {
+                    portset.request = Util_urlEncode((yyvsp[-3].string));
+                    FREE((yyvsp[-3].string));
+                    portset.request_checksum = (yyvsp[-1].string);
                   }
+#line 3738 "src/y.tab.c"
     break;
 
-  case 324:
-
-/* Line 1806 of yacc.c  */
-#line 1145 "src/p.y"
-    {
-                    portset.request_hostheader = (yyvsp[(2) - (2)].string);
+  case 344: /* hostheader: HOSTHEADER STRING  */
+#line 1226 "src/p.y"
+                                    {
+                    portset.request_hostheader = (yyvsp[0].string);
                   }
+#line 3746 "src/y.tab.c"
     break;
 
-  case 325:
-
-/* Line 1806 of yacc.c  */
-#line 1150 "src/p.y"
-    { 
-                    portset.request = (yyvsp[(2) - (2)].string); 
+  case 345: /* secret: SECRET STRING  */
+#line 1231 "src/p.y"
+                                { 
+                    portset.request = (yyvsp[0].string); 
                   }
+#line 3754 "src/y.tab.c"
     break;
 
-  case 328:
-
-/* Line 1806 of yacc.c  */
-#line 1159 "src/p.y"
-    { 
-                    portset.ApacheStatus.loglimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.loglimit = (int)(yyvsp[(3) - (4)].number); 
+  case 348: /* apache_stat: LOGLIMIT operator NUMBER PERCENT  */
+#line 1240 "src/p.y"
+                                                   { 
+                    portset.ApacheStatus.loglimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.loglimit = (int)(yyvsp[-1].number); 
                   }
+#line 3763 "src/y.tab.c"
     break;
 
-  case 329:
-
-/* Line 1806 of yacc.c  */
-#line 1163 "src/p.y"
-    { 
-                    portset.ApacheStatus.closelimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.closelimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 349: /* apache_stat: CLOSELIMIT operator NUMBER PERCENT  */
+#line 1244 "src/p.y"
+                                                     { 
+                    portset.ApacheStatus.closelimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.closelimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3772 "src/y.tab.c"
     break;
 
-  case 330:
-
-/* Line 1806 of yacc.c  */
-#line 1167 "src/p.y"
-    { 
-                    portset.ApacheStatus.dnslimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.dnslimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 350: /* apache_stat: DNSLIMIT operator NUMBER PERCENT  */
+#line 1248 "src/p.y"
+                                                   { 
+                    portset.ApacheStatus.dnslimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.dnslimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3781 "src/y.tab.c"
     break;
 
-  case 331:
-
-/* Line 1806 of yacc.c  */
-#line 1171 "src/p.y"
-    { 
-                    portset.ApacheStatus.keepalivelimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.keepalivelimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 351: /* apache_stat: KEEPALIVELIMIT operator NUMBER PERCENT  */
+#line 1252 "src/p.y"
+                                                         { 
+                    portset.ApacheStatus.keepalivelimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.keepalivelimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3790 "src/y.tab.c"
     break;
 
-  case 332:
-
-/* Line 1806 of yacc.c  */
-#line 1175 "src/p.y"
-    { 
-                    portset.ApacheStatus.replylimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.replylimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 352: /* apache_stat: REPLYLIMIT operator NUMBER PERCENT  */
+#line 1256 "src/p.y"
+                                                     { 
+                    portset.ApacheStatus.replylimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.replylimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3799 "src/y.tab.c"
     break;
 
-  case 333:
-
-/* Line 1806 of yacc.c  */
-#line 1179 "src/p.y"
-    { 
-                    portset.ApacheStatus.requestlimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.requestlimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 353: /* apache_stat: REQUESTLIMIT operator NUMBER PERCENT  */
+#line 1260 "src/p.y"
+                                                       { 
+                    portset.ApacheStatus.requestlimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.requestlimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3808 "src/y.tab.c"
     break;
 
-  case 334:
-
-/* Line 1806 of yacc.c  */
-#line 1183 "src/p.y"
-    { 
-                    portset.ApacheStatus.startlimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.startlimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 354: /* apache_stat: STARTLIMIT operator NUMBER PERCENT  */
+#line 1264 "src/p.y"
+                                                     { 
+                    portset.ApacheStatus.startlimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.startlimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3817 "src/y.tab.c"
     break;
 
-  case 335:
-
-/* Line 1806 of yacc.c  */
-#line 1187 "src/p.y"
-    { 
-                    portset.ApacheStatus.waitlimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.waitlimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 355: /* apache_stat: WAITLIMIT operator NUMBER PERCENT  */
+#line 1268 "src/p.y"
+                                                    { 
+                    portset.ApacheStatus.waitlimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.waitlimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3826 "src/y.tab.c"
     break;
 
-  case 336:
-
-/* Line 1806 of yacc.c  */
-#line 1191 "src/p.y"
-    { 
-                    portset.ApacheStatus.gracefullimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.gracefullimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 356: /* apache_stat: GRACEFULLIMIT operator NUMBER PERCENT  */
+#line 1272 "src/p.y"
+                                                        { 
+                    portset.ApacheStatus.gracefullimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.gracefullimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3835 "src/y.tab.c"
     break;
 
-  case 337:
-
-/* Line 1806 of yacc.c  */
-#line 1195 "src/p.y"
-    { 
-                    portset.ApacheStatus.cleanuplimitOP = (yyvsp[(2) - (4)].number); 
-                    portset.ApacheStatus.cleanuplimit = (int)((yyvsp[(3) - (4)].number)); 
+  case 357: /* apache_stat: CLEANUPLIMIT operator NUMBER PERCENT  */
+#line 1276 "src/p.y"
+                                                       { 
+                    portset.ApacheStatus.cleanuplimitOP = (yyvsp[-2].number); 
+                    portset.ApacheStatus.cleanuplimit = (int)((yyvsp[-1].number)); 
                   }
+#line 3844 "src/y.tab.c"
     break;
 
-  case 338:
-
-/* Line 1806 of yacc.c  */
-#line 1201 "src/p.y"
-    {
-                    seteventaction(&(current)->action_NONEXIST, (yyvsp[(6) - (7)].number), (yyvsp[(7) - (7)].number));
+  case 358: /* exist: IF NOT EXIST rate1 THEN action1 recovery  */
+#line 1282 "src/p.y"
+                                                           {
+                    seteventaction(&(current)->action_NONEXIST, (yyvsp[-1].number), (yyvsp[0].number));
                   }
+#line 3852 "src/y.tab.c"
     break;
 
-  case 339:
-
-/* Line 1806 of yacc.c  */
-#line 1207 "src/p.y"
-    {
-                    seteventaction(&(current)->action_PID, (yyvsp[(6) - (6)].number), ACTION_IGNORE);
+  case 359: /* pid: IF CHANGED PID rate1 THEN action1  */
+#line 1288 "src/p.y"
+                                                    {
+                    seteventaction(&(current)->action_PID, (yyvsp[0].number), ACTION_IGNORE);
                   }
+#line 3860 "src/y.tab.c"
     break;
 
-  case 340:
-
-/* Line 1806 of yacc.c  */
-#line 1212 "src/p.y"
-    {
-                    seteventaction(&(current)->action_PPID, (yyvsp[(6) - (6)].number), ACTION_IGNORE);
+  case 360: /* ppid: IF CHANGED PPID rate1 THEN action1  */
+#line 1293 "src/p.y"
+                                                     {
+                    seteventaction(&(current)->action_PPID, (yyvsp[0].number), ACTION_IGNORE);
                   }
+#line 3868 "src/y.tab.c"
     break;
 
-  case 341:
-
-/* Line 1806 of yacc.c  */
-#line 1217 "src/p.y"
-    {
-                    uptimeset.operator = (yyvsp[(3) - (9)].number);
-                    uptimeset.uptime = ((unsigned long long)(yyvsp[(4) - (9)].number) * (yyvsp[(5) - (9)].number));
-                    addeventaction(&(uptimeset).action, (yyvsp[(8) - (9)].number), (yyvsp[(9) - (9)].number));
+  case 361: /* uptime: IF UPTIME operator NUMBER time rate1 THEN action1 recovery  */
+#line 1298 "src/p.y"
+                                                                             {
+                    uptimeset.operator = (yyvsp[-6].number);
+                    uptimeset.uptime = ((unsigned long long)(yyvsp[-5].number) * (yyvsp[-4].number));
+                    addeventaction(&(uptimeset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     adduptime(&uptimeset);
                   }
+#line 3879 "src/y.tab.c"
     break;
 
-  case 342:
-
-/* Line 1806 of yacc.c  */
-#line 1224 "src/p.y"
-    {
+  case 362: /* icmpcount: %empty  */
+#line 1305 "src/p.y"
+                              {
                    (yyval.number) = ICMP_ATTEMPT_COUNT;
                   }
+#line 3887 "src/y.tab.c"
     break;
 
-  case 343:
-
-/* Line 1806 of yacc.c  */
-#line 1227 "src/p.y"
-    {    
-                   (yyval.number) = (yyvsp[(2) - (2)].number);
+  case 363: /* icmpcount: COUNT NUMBER  */
+#line 1308 "src/p.y"
+                               {    
+                   (yyval.number) = (yyvsp[0].number);
                   }
+#line 3895 "src/y.tab.c"
     break;
 
-  case 344:
-
-/* Line 1806 of yacc.c  */
-#line 1232 "src/p.y"
-    {
+  case 364: /* exectimeout: %empty  */
+#line 1313 "src/p.y"
+                              {
                    (yyval.number) = EXEC_TIMEOUT;
                   }
+#line 3903 "src/y.tab.c"
     break;
 
-  case 345:
-
-/* Line 1806 of yacc.c  */
-#line 1235 "src/p.y"
-    {
-                   (yyval.number) = (yyvsp[(2) - (3)].number);
+  case 365: /* exectimeout: TIMEOUT NUMBER SECOND  */
+#line 1316 "src/p.y"
+                                        {
+                   (yyval.number) = (yyvsp[-1].number);
                   }
+#line 3911 "src/y.tab.c"
     break;
 
-  case 346:
-
-/* Line 1806 of yacc.c  */
-#line 1240 "src/p.y"
-    {
+  case 366: /* programtimeout: %empty  */
+#line 1321 "src/p.y"
+                              {
                    (yyval.number) = PROGRAM_TIMEOUT; // Default program status check timeout is 5 min
                   }
+#line 3919 "src/y.tab.c"
     break;
 
-  case 347:
-
-/* Line 1806 of yacc.c  */
-#line 1243 "src/p.y"
-    {
-                   (yyval.number) = (yyvsp[(2) - (3)].number);
+  case 367: /* programtimeout: TIMEOUT NUMBER SECOND  */
+#line 1324 "src/p.y"
+                                        {
+                   (yyval.number) = (yyvsp[-1].number);
                   }
+#line 3927 "src/y.tab.c"
     break;
 
-  case 348:
-
-/* Line 1806 of yacc.c  */
-#line 1248 "src/p.y"
-    {
+  case 368: /* nettimeout: %empty  */
+#line 1329 "src/p.y"
+                              {
                    (yyval.number) = NET_TIMEOUT;
                   }
+#line 3935 "src/y.tab.c"
     break;
 
-  case 349:
-
-/* Line 1806 of yacc.c  */
-#line 1251 "src/p.y"
-    {
-                   (yyval.number) = (yyvsp[(2) - (3)].number);
+  case 369: /* nettimeout: TIMEOUT NUMBER SECOND  */
+#line 1332 "src/p.y"
+                                        {
+                   (yyval.number) = (yyvsp[-1].number);
                   }
+#line 3943 "src/y.tab.c"
     break;
 
-  case 350:
-
-/* Line 1806 of yacc.c  */
-#line 1256 "src/p.y"
-    {
+  case 370: /* retry: %empty  */
+#line 1337 "src/p.y"
+                              {
                    (yyval.number) = 1;
                   }
+#line 3951 "src/y.tab.c"
     break;
 
-  case 351:
-
-/* Line 1806 of yacc.c  */
-#line 1259 "src/p.y"
-    {
-                   (yyval.number) = (yyvsp[(2) - (2)].number);
+  case 371: /* retry: RETRY NUMBER  */
+#line 1340 "src/p.y"
+                               {
+                   (yyval.number) = (yyvsp[0].number);
                   }
+#line 3959 "src/y.tab.c"
     break;
 
-  case 352:
-
-/* Line 1806 of yacc.c  */
-#line 1264 "src/p.y"
-    {
-                   actionrateset.count = (yyvsp[(2) - (7)].number);
-                   actionrateset.cycle = (yyvsp[(4) - (7)].number);
-                   addeventaction(&(actionrateset).action, (yyvsp[(7) - (7)].number), ACTION_ALERT);
+  case 372: /* actionrate: IF NUMBER RESTART NUMBER CYCLE THEN action1  */
+#line 1345 "src/p.y"
+                                                              {
+                   actionrateset.count = (yyvsp[-5].number);
+                   actionrateset.cycle = (yyvsp[-3].number);
+                   addeventaction(&(actionrateset).action, (yyvsp[0].number), ACTION_ALERT);
                    addactionrate(&actionrateset);
                  }
+#line 3970 "src/y.tab.c"
     break;
 
-  case 353:
-
-/* Line 1806 of yacc.c  */
-#line 1270 "src/p.y"
-    {
-                   actionrateset.count = (yyvsp[(2) - (7)].number);
-                   actionrateset.cycle = (yyvsp[(4) - (7)].number);
+  case 373: /* actionrate: IF NUMBER RESTART NUMBER CYCLE THEN TIMEOUT  */
+#line 1351 "src/p.y"
+                                                              {
+                   actionrateset.count = (yyvsp[-5].number);
+                   actionrateset.cycle = (yyvsp[-3].number);
                    addeventaction(&(actionrateset).action, ACTION_UNMONITOR, ACTION_ALERT);
                    addactionrate(&actionrateset);
                  }
+#line 3981 "src/y.tab.c"
     break;
 
-  case 355:
-
-/* Line 1806 of yacc.c  */
-#line 1279 "src/p.y"
-    {
-                    seturlrequest((yyvsp[(2) - (3)].number), (yyvsp[(3) - (3)].string));
-                    FREE((yyvsp[(3) - (3)].string));
+  case 375: /* urloption: CONTENT urloperator STRING  */
+#line 1360 "src/p.y"
+                                             {
+                    seturlrequest((yyvsp[-1].number), (yyvsp[0].string));
+                    FREE((yyvsp[0].string));
                   }
+#line 3990 "src/y.tab.c"
     break;
 
-  case 356:
-
-/* Line 1806 of yacc.c  */
-#line 1285 "src/p.y"
-    { (yyval.number) = OPERATOR_EQUAL; }
+  case 376: /* urloperator: EQUAL  */
+#line 1366 "src/p.y"
+                           { (yyval.number) = OPERATOR_EQUAL; }
+#line 3996 "src/y.tab.c"
     break;
 
-  case 357:
-
-/* Line 1806 of yacc.c  */
-#line 1286 "src/p.y"
-    { (yyval.number) = OPERATOR_NOTEQUAL; }
+  case 377: /* urloperator: NOTEQUAL  */
+#line 1367 "src/p.y"
+                           { (yyval.number) = OPERATOR_NOTEQUAL; }
+#line 4002 "src/y.tab.c"
     break;
 
-  case 358:
-
-/* Line 1806 of yacc.c  */
-#line 1289 "src/p.y"
-    {
+  case 378: /* alert: alertmail formatlist reminder  */
+#line 1370 "src/p.y"
+                                                {
                    mailset.events = Event_All;
-                   addmail((yyvsp[(1) - (3)].string), &mailset, &current->maillist);
+                   addmail((yyvsp[-2].string), &mailset, &current->maillist);
                   }
+#line 4011 "src/y.tab.c"
     break;
 
-  case 359:
-
-/* Line 1806 of yacc.c  */
-#line 1293 "src/p.y"
-    {
-                   addmail((yyvsp[(1) - (6)].string), &mailset, &current->maillist);
+  case 379: /* alert: alertmail '{' eventoptionlist '}' formatlist reminder  */
+#line 1374 "src/p.y"
+                                                                        {
+                   addmail((yyvsp[-5].string), &mailset, &current->maillist);
                   }
+#line 4019 "src/y.tab.c"
     break;
 
-  case 360:
-
-/* Line 1806 of yacc.c  */
-#line 1296 "src/p.y"
-    {
+  case 380: /* alert: alertmail NOT '{' eventoptionlist '}' formatlist reminder  */
+#line 1377 "src/p.y"
+                                                                            {
                    mailset.events = ~mailset.events;
-                   addmail((yyvsp[(1) - (7)].string), &mailset, &current->maillist);
+                   addmail((yyvsp[-6].string), &mailset, &current->maillist);
                   }
+#line 4028 "src/y.tab.c"
     break;
 
-  case 361:
-
-/* Line 1806 of yacc.c  */
-#line 1300 "src/p.y"
-    {
-                   addmail((yyvsp[(1) - (1)].string), &mailset, &current->maillist);
+  case 381: /* alert: noalertmail  */
+#line 1381 "src/p.y"
+                              {
+                   addmail((yyvsp[0].string), &mailset, &current->maillist);
                   }
+#line 4036 "src/y.tab.c"
     break;
 
-  case 362:
-
-/* Line 1806 of yacc.c  */
-#line 1305 "src/p.y"
-    { (yyval.string) = (yyvsp[(2) - (2)].string); }
+  case 382: /* alertmail: ALERT MAILADDR  */
+#line 1386 "src/p.y"
+                                 { (yyval.string) = (yyvsp[0].string); }
+#line 4042 "src/y.tab.c"
     break;
 
-  case 363:
-
-/* Line 1806 of yacc.c  */
-#line 1308 "src/p.y"
-    { (yyval.string) = (yyvsp[(2) - (2)].string); }
+  case 383: /* noalertmail: NOALERT MAILADDR  */
+#line 1389 "src/p.y"
+                                   { (yyval.string) = (yyvsp[0].string); }
+#line 4048 "src/y.tab.c"
     break;
 
-  case 366:
-
-/* Line 1806 of yacc.c  */
-#line 1315 "src/p.y"
-    { mailset.events |= Event_Action; }
+  case 386: /* eventoption: ACTION  */
+#line 1396 "src/p.y"
+                                  { mailset.events |= Event_Action; }
+#line 4054 "src/y.tab.c"
     break;
 
-  case 367:
-
-/* Line 1806 of yacc.c  */
-#line 1316 "src/p.y"
-    { mailset.events |= Event_Checksum; }
+  case 387: /* eventoption: CHECKSUM  */
+#line 1397 "src/p.y"
+                                  { mailset.events |= Event_Checksum; }
+#line 4060 "src/y.tab.c"
     break;
 
-  case 368:
-
-/* Line 1806 of yacc.c  */
-#line 1317 "src/p.y"
-    { mailset.events |= Event_Connection; }
+  case 388: /* eventoption: CONNECTION  */
+#line 1398 "src/p.y"
+                                  { mailset.events |= Event_Connection; }
+#line 4066 "src/y.tab.c"
     break;
 
-  case 369:
-
-/* Line 1806 of yacc.c  */
-#line 1318 "src/p.y"
-    { mailset.events |= Event_Content; }
+  case 389: /* eventoption: CONTENT  */
+#line 1399 "src/p.y"
+                                  { mailset.events |= Event_Content; }
+#line 4072 "src/y.tab.c"
     break;
 
-  case 370:
-
-/* Line 1806 of yacc.c  */
-#line 1319 "src/p.y"
-    { mailset.events |= Event_Data; }
+  case 390: /* eventoption: DATA  */
+#line 1400 "src/p.y"
+                                  { mailset.events |= Event_Data; }
+#line 4078 "src/y.tab.c"
     break;
 
-  case 371:
-
-/* Line 1806 of yacc.c  */
-#line 1320 "src/p.y"
-    { mailset.events |= Event_Exec; }
+  case 391: /* eventoption: EXEC  */
+#line 1401 "src/p.y"
+                                  { mailset.events |= Event_Exec; }
+#line 4084 "src/y.tab.c"
     break;
 
-  case 372:
-
-/* Line 1806 of yacc.c  */
-#line 1321 "src/p.y"
-    { mailset.events |= Event_Fsflag; }
+  case 392: /* eventoption: FSFLAG  */
+#line 1402 "src/p.y"
+                                  { mailset.events |= Event_Fsflag; }
+#line 4090 "src/y.tab.c"
     break;
 
-  case 373:
-
-/* Line 1806 of yacc.c  */
-#line 1322 "src/p.y"
-    { mailset.events |= Event_Gid; }
+  case 393: /* eventoption: GID  */
+#line 1403 "src/p.y"
+                                  { mailset.events |= Event_Gid; }
+#line 4096 "src/y.tab.c"
     break;
 
-  case 374:
-
-/* Line 1806 of yacc.c  */
-#line 1323 "src/p.y"
-    { mailset.events |= Event_Icmp; }
+  case 394: /* eventoption: ICMP  */
+#line 1404 "src/p.y"
+                                  { mailset.events |= Event_Icmp; }
+#line 4102 "src/y.tab.c"
     break;
 
-  case 375:
-
-/* Line 1806 of yacc.c  */
-#line 1324 "src/p.y"
-    { mailset.events |= Event_Instance; }
+  case 395: /* eventoption: INSTANCE  */
+#line 1405 "src/p.y"
+                                  { mailset.events |= Event_Instance; }
+#line 4108 "src/y.tab.c"
     break;
 
-  case 376:
-
-/* Line 1806 of yacc.c  */
-#line 1325 "src/p.y"
-    { mailset.events |= Event_Invalid; }
+  case 396: /* eventoption: INVALID  */
+#line 1406 "src/p.y"
+                                  { mailset.events |= Event_Invalid; }
+#line 4114 "src/y.tab.c"
     break;
 
-  case 377:
-
-/* Line 1806 of yacc.c  */
-#line 1326 "src/p.y"
-    { mailset.events |= Event_Nonexist; }
+  case 397: /* eventoption: NONEXIST  */
+#line 1407 "src/p.y"
+                                  { mailset.events |= Event_Nonexist; }
+#line 4120 "src/y.tab.c"
     break;
 
-  case 378:
-
-/* Line 1806 of yacc.c  */
-#line 1327 "src/p.y"
-    { mailset.events |= Event_Permission; }
+  case 398: /* eventoption: PERMISSION  */
+#line 1408 "src/p.y"
+                                  { mailset.events |= Event_Permission; }
+#line 4126 "src/y.tab.c"
     break;
 
-  case 379:
-
-/* Line 1806 of yacc.c  */
-#line 1328 "src/p.y"
-    { mailset.events |= Event_Pid; }
+  case 399: /* eventoption: PID  */
+#line 1409 "src/p.y"
+                                  { mailset.events |= Event_Pid; }
+#line 4132 "src/y.tab.c"
     break;
 
-  case 380:
-
-/* Line 1806 of yacc.c  */
-#line 1329 "src/p.y"
-    { mailset.events |= Event_PPid; }
+  case 400: /* eventoption: PPID  */
+#line 1410 "src/p.y"
+                                  { mailset.events |= Event_PPid; }
+#line 4138 "src/y.tab.c"
     break;
 
-  case 381:
-
-/* Line 1806 of yacc.c  */
-#line 1330 "src/p.y"
-    { mailset.events |= Event_Resource; }
+  case 401: /* eventoption: RESOURCE  */
+#line 1411 "src/p.y"
+                                  { mailset.events |= Event_Resource; }
+#line 4144 "src/y.tab.c"
     break;
 
-  case 382:
-
-/* Line 1806 of yacc.c  */
-#line 1331 "src/p.y"
-    { mailset.events |= Event_Size; }
+  case 402: /* eventoption: SIZE  */
+#line 1412 "src/p.y"
+                                  { mailset.events |= Event_Size; }
+#line 4150 "src/y.tab.c"
     break;
 
-  case 383:
-
-/* Line 1806 of yacc.c  */
-#line 1332 "src/p.y"
-    { mailset.events |= Event_Status; }
+  case 403: /* eventoption: STATUS  */
+#line 1413 "src/p.y"
+                                  { mailset.events |= Event_Status; }
+#line 4156 "src/y.tab.c"
     break;
 
-  case 384:
-
-/* Line 1806 of yacc.c  */
-#line 1333 "src/p.y"
-    { mailset.events |= Event_Timeout; }
+  case 404: /* eventoption: TIMEOUT  */
+#line 1414 "src/p.y"
+                                  { mailset.events |= Event_Timeout; }
+#line 4162 "src/y.tab.c"
     break;
 
-  case 385:
-
-/* Line 1806 of yacc.c  */
-#line 1334 "src/p.y"
-    { mailset.events |= Event_Timestamp; }
+  case 405: /* eventoption: TIMESTAMP  */
+#line 1415 "src/p.y"
+                                  { mailset.events |= Event_Timestamp; }
+#line 4168 "src/y.tab.c"
     break;
 
-  case 386:
-
-/* Line 1806 of yacc.c  */
-#line 1335 "src/p.y"
-    { mailset.events |= Event_Uid; }
+  case 406: /* eventoption: UID  */
+#line 1416 "src/p.y"
+                                  { mailset.events |= Event_Uid; }
+#line 4174 "src/y.tab.c"
     break;
 
-  case 387:
-
-/* Line 1806 of yacc.c  */
-#line 1336 "src/p.y"
-    { mailset.events |= Event_Uptime; }
+  case 407: /* eventoption: UPTIME  */
+#line 1417 "src/p.y"
+                                  { mailset.events |= Event_Uptime; }
+#line 4180 "src/y.tab.c"
     break;
 
-  case 392:
-
-/* Line 1806 of yacc.c  */
-#line 1347 "src/p.y"
-    { mailset.from = (yyvsp[(1) - (1)].string); }
+  case 412: /* formatoption: MAILFROM  */
+#line 1428 "src/p.y"
+                           { mailset.from = (yyvsp[0].string); }
+#line 4186 "src/y.tab.c"
     break;
 
-  case 393:
-
-/* Line 1806 of yacc.c  */
-#line 1348 "src/p.y"
-    { mailset.replyto = (yyvsp[(1) - (1)].string); }
+  case 413: /* formatoption: MAILREPLYTO  */
+#line 1429 "src/p.y"
+                              { mailset.replyto = (yyvsp[0].string); }
+#line 4192 "src/y.tab.c"
     break;
 
-  case 394:
-
-/* Line 1806 of yacc.c  */
-#line 1349 "src/p.y"
-    { mailset.subject = (yyvsp[(1) - (1)].string); }
+  case 414: /* formatoption: MAILSUBJECT  */
+#line 1430 "src/p.y"
+                              { mailset.subject = (yyvsp[0].string); }
+#line 4198 "src/y.tab.c"
     break;
 
-  case 395:
-
-/* Line 1806 of yacc.c  */
-#line 1350 "src/p.y"
-    { mailset.message = (yyvsp[(1) - (1)].string); }
+  case 415: /* formatoption: MAILBODY  */
+#line 1431 "src/p.y"
+                           { mailset.message = (yyvsp[0].string); }
+#line 4204 "src/y.tab.c"
     break;
 
-  case 396:
-
-/* Line 1806 of yacc.c  */
-#line 1353 "src/p.y"
-    {
+  case 416: /* every: EVERY NUMBER CYCLE  */
+#line 1434 "src/p.y"
+                                     {
                    current->every.type = EVERY_SKIPCYCLES;
-                   current->every.spec.cycle.number = (yyvsp[(2) - (3)].number);
+                   current->every.spec.cycle.number = (yyvsp[-1].number);
                  }
+#line 4213 "src/y.tab.c"
     break;
 
-  case 397:
-
-/* Line 1806 of yacc.c  */
-#line 1357 "src/p.y"
-    {
+  case 417: /* every: EVERY TIMESPEC  */
+#line 1438 "src/p.y"
+                                 {
                    current->every.type = EVERY_CRON;
-                   current->every.spec.cron = (yyvsp[(2) - (2)].string);
+                   current->every.spec.cron = (yyvsp[0].string);
                  }
+#line 4222 "src/y.tab.c"
     break;
 
-  case 398:
-
-/* Line 1806 of yacc.c  */
-#line 1361 "src/p.y"
-    {
+  case 418: /* every: NOTEVERY TIMESPEC  */
+#line 1442 "src/p.y"
+                                    {
                    current->every.type = EVERY_NOTINCRON;
-                   current->every.spec.cron = (yyvsp[(2) - (2)].string);
+                   current->every.spec.cron = (yyvsp[0].string);
                  }
+#line 4231 "src/y.tab.c"
     break;
 
-  case 399:
-
-/* Line 1806 of yacc.c  */
-#line 1367 "src/p.y"
-    {
+  case 419: /* mode: MODE ACTIVE  */
+#line 1448 "src/p.y"
+                               {
                     current->mode = MODE_ACTIVE;
                   }
+#line 4239 "src/y.tab.c"
     break;
 
-  case 400:
-
-/* Line 1806 of yacc.c  */
-#line 1370 "src/p.y"
-    {
+  case 420: /* mode: MODE PASSIVE  */
+#line 1451 "src/p.y"
+                               {
                     current->mode = MODE_PASSIVE;
                   }
+#line 4247 "src/y.tab.c"
     break;
 
-  case 401:
-
-/* Line 1806 of yacc.c  */
-#line 1373 "src/p.y"
-    {
+  case 421: /* mode: MODE MANUAL  */
+#line 1454 "src/p.y"
+                               {
                     current->mode = MODE_MANUAL;
                     current->monitor = MONITOR_NOT;
                   }
+#line 4256 "src/y.tab.c"
     break;
 
-  case 402:
-
-/* Line 1806 of yacc.c  */
-#line 1379 "src/p.y"
-    { addservicegroup((yyvsp[(2) - (2)].string)); FREE((yyvsp[(2) - (2)].string));}
+  case 422: /* group: GROUP STRINGNAME  */
+#line 1460 "src/p.y"
+                                   { addservicegroup((yyvsp[0].string)); FREE((yyvsp[0].string));}
+#line 4262 "src/y.tab.c"
     break;
 
-  case 406:
-
-/* Line 1806 of yacc.c  */
-#line 1390 "src/p.y"
-    { adddependant((yyvsp[(1) - (1)].string)); }
+  case 423: /* cgroup: CGROUP PATH  */
+#line 1463 "src/p.y"
+                              {
+                    FREE(current->cgroup);
+                    current->cgroup = (yyvsp[0].string);
+                  }
+#line 4271 "src/y.tab.c"
     break;
 
-  case 407:
+  case 427: /* dependant: SERVICENAME  */
+#line 1477 "src/p.y"
+                              { adddependant((yyvsp[0].string)); }
+#line 4277 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1393 "src/p.y"
-    {
-                        statusset.operator = (yyvsp[(3) - (8)].number);
-                        statusset.return_value = (yyvsp[(4) - (8)].number);
-                        addeventaction(&(statusset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+  case 428: /* statusvalue: IF STATUS operator NUMBER rate1 THEN action1 recovery  */
+#line 1480 "src/p.y"
+                                                                        {
+                        statusset.operator = (yyvsp[-5].number);
+                        statusset.return_value = (yyvsp[-4].number);
+                        addeventaction(&(statusset).action, (yyvsp[-1].number), (yyvsp[0].number));
                         addstatus(&statusset);
                    }
+#line 4288 "src/y.tab.c"
     break;
 
-  case 408:
-
-/* Line 1806 of yacc.c  */
-#line 1401 "src/p.y"
-    {
-                     addeventaction(&(resourceset).action, (yyvsp[(5) - (6)].number), (yyvsp[(6) - (6)].number));
+  case 429: /* resourceprocess: IF resourceprocesslist rate1 THEN action1 recovery  */
+#line 1488 "src/p.y"
+                                                                     {
+                     addeventaction(&(resourceset).action, (yyvsp[-1].number), (yyvsp[0].number));
                      addresource(&resourceset);
                    }
+#line 4297 "src/y.tab.c"
     break;
 
-  case 415:
-
-/* Line 1806 of yacc.c  */
-#line 1417 "src/p.y"
-    {
-                     addeventaction(&(resourceset).action, (yyvsp[(5) - (6)].number), (yyvsp[(6) - (6)].number));
+  case 436: /* resourcesystem: IF resourcesystemlist rate1 THEN action1 recovery  */
+#line 1504 "src/p.y"
+                                                                    {
+                     addeventaction(&(resourceset).action, (yyvsp[-1].number), (yyvsp[0].number));
                      addresource(&resourceset);
                    }
+#line 4306 "src/y.tab.c"
     break;
 
-  case 422:
-
-/* Line 1806 of yacc.c  */
-#line 1433 "src/p.y"
-    {
+  case 444: /* resourcecpuproc: CPU operator NUMBER PERCENT  */
+#line 1521 "src/p.y"
+                                              {
                     resourceset.resource_id = RESOURCE_ID_CPU_PERCENT;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = ((yyvsp[(3) - (4)].number) * 10); 
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = ((yyvsp[-1].number) * 10); 
                   }
+#line 4316 "src/y.tab.c"
     break;
 
-  case 423:
-
-/* Line 1806 of yacc.c  */
-#line 1438 "src/p.y"
-    {
+  case 445: /* resourcecpuproc: TOTALCPU operator NUMBER PERCENT  */
+#line 1526 "src/p.y"
+                                                   {
                     resourceset.resource_id = RESOURCE_ID_TOTAL_CPU_PERCENT;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = ((yyvsp[(3) - (4)].number) * 10); 
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = ((yyvsp[-1].number) * 10); 
                   }
+#line 4326 "src/y.tab.c"
     break;
 
-  case 424:
-
-/* Line 1806 of yacc.c  */
-#line 1445 "src/p.y"
-    {
-                    resourceset.resource_id = (yyvsp[(1) - (4)].number);
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = ((yyvsp[(3) - (4)].number) * 10); 
+  case 446: /* resourcecpu: resourcecpuid operator NUMBER PERCENT  */
+#line 1533 "src/p.y"
+                                                        {
+                    resourceset.resource_id = (yyvsp[-3].number);
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = ((yyvsp[-1].number) * 10); 
                   }
+#line 4336 "src/y.tab.c"
     break;
 
-  case 425:
+  case 447: /* resourcecpuid: CPUUSER  */
+#line 1540 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_CPUUSER; }
+#line 4342 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1452 "src/p.y"
-    { (yyval.number) = RESOURCE_ID_CPUUSER; }
+  case 448: /* resourcecpuid: CPUSYSTEM  */
+#line 1541 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_CPUSYSTEM; }
+#line 4348 "src/y.tab.c"
     break;
 
-  case 426:
+  case 449: /* resourcecpuid: CPUWAIT  */
+#line 1542 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_CPUWAIT; }
+#line 4354 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1453 "src/p.y"
-    { (yyval.number) = RESOURCE_ID_CPUSYSTEM; }
+  case 450: /* resourcecpuid: CPUSTEAL  */
+#line 1543 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_CPUSTEAL; }
+#line 4360 "src/y.tab.c"
     break;
 
-  case 427:
+  case 451: /* resourcecpuid: CPUIRQ  */
+#line 1544 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_CPUIRQ; }
+#line 4366 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1454 "src/p.y"
-    { (yyval.number) = RESOURCE_ID_CPUWAIT; }
+  case 452: /* resourcepressure: resourcepressureid operator value PERCENT  */
+#line 1547 "src/p.y"
+                                                             {
+                    resourceset.resource_id = (yyvsp[-3].number);
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = (int) ((yyvsp[-1].real) * 10.0);
+                  }
+#line 4376 "src/y.tab.c"
     break;
 
-  case 428:
+  case 453: /* resourcepressureid: PRESSURECPU  */
+#line 1554 "src/p.y"
+                                    { (yyval.number) = RESOURCE_ID_PRESSURE_CPU; }
+#line 4382 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1457 "src/p.y"
-    {
+  case 454: /* resourcepressureid: PRESSUREMEMORY  */
+#line 1555 "src/p.y"
+                                    { (yyval.number) = RESOURCE_ID_PRESSURE_MEMORY; }
+#line 4388 "src/y.tab.c"
+    break;
+
+  case 455: /* resourcepressureid: PRESSUREIO  */
+#line 1556 "src/p.y"
+                                    { (yyval.number) = RESOURCE_ID_PRESSURE_IO; }
+#line 4394 "src/y.tab.c"
+    break;
+
+  case 456: /* resourcemem: MEMORY operator value unit  */
+#line 1559 "src/p.y"
+                                             {
                     resourceset.resource_id = RESOURCE_ID_MEM_KBYTE;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = (int) ((yyvsp[(3) - (4)].real) * ((yyvsp[(4) - (4)].number) / 1024.0)); 
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = (int) ((yyvsp[-1].real) * ((yyvsp[0].number) / 1024.0)); 
                   }
+#line 4404 "src/y.tab.c"
     break;
 
-  case 429:
-
-/* Line 1806 of yacc.c  */
-#line 1462 "src/p.y"
-    {
+  case 457: /* resourcemem: MEMORY operator NUMBER PERCENT  */
+#line 1564 "src/p.y"
+                                                 {
                     resourceset.resource_id = RESOURCE_ID_MEM_PERCENT;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = ((yyvsp[(3) - (4)].number) * 10); 
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = ((yyvsp[-1].number) * 10); 
                   }
+#line 4414 "src/y.tab.c"
     break;
 
-  case 430:
-
-/* Line 1806 of yacc.c  */
-#line 1467 "src/p.y"
-    {
+  case 458: /* resourcemem: TOTALMEMORY operator value unit  */
+#line 1569 "src/p.y"
+                                                  {
                     resourceset.resource_id = RESOURCE_ID_TOTAL_MEM_KBYTE;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = (int) ((yyvsp[(3) - (4)].real) * ((yyvsp[(4) - (4)].number) / 1024.0));
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = (int) ((yyvsp[-1].real) * ((yyvsp[0].number) / 1024.0));
                   }
+#line 4424 "src/y.tab.c"
     break;
 
-  case 431:
-
-/* Line 1806 of yacc.c  */
-#line 1472 "src/p.y"
-    {
+  case 459: /* resourcemem: TOTALMEMORY operator NUMBER PERCENT  */
+#line 1574 "src/p.y"
+                                                       {
                     resourceset.resource_id = RESOURCE_ID_TOTAL_MEM_PERCENT;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = ((yyvsp[(3) - (4)].number) * 10);
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = ((yyvsp[-1].number) * 10);
                   }
+#line 4434 "src/y.tab.c"
     break;
 
-  case 432:
-
-/* Line 1806 of yacc.c  */
-#line 1479 "src/p.y"
-    {
+  case 460: /* resourceswap: SWAP operator value unit  */
+#line 1581 "src/p.y"
+                                           {
                     resourceset.resource_id = RESOURCE_ID_SWAP_KBYTE;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = (int) ((yyvsp[(3) - (4)].real) * ((yyvsp[(4) - (4)].number) / 1024.0));
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = (int) ((yyvsp[-1].real) * ((yyvsp[0].number) / 1024.0));
                   }
+#line 4444 "src/y.tab.c"
     break;
 
-  case 433:
-
-/* Line 1806 of yacc.c  */
-#line 1484 "src/p.y"
-    {
+  case 461: /* resourceswap: SWAP operator NUMBER PERCENT  */
+#line 1586 "src/p.y"
+                                               {
                     resourceset.resource_id = RESOURCE_ID_SWAP_PERCENT;
-                    resourceset.operator = (yyvsp[(2) - (4)].number);
-                    resourceset.limit = ((yyvsp[(3) - (4)].number) * 10);
+                    resourceset.operator = (yyvsp[-2].number);
+                    resourceset.limit = ((yyvsp[-1].number) * 10);
                   }
+#line 4454 "src/y.tab.c"
     break;
 
-  case 434:
-
-/* Line 1806 of yacc.c  */
-#line 1491 "src/p.y"
-    { 
+  case 462: /* resourcechild: CHILDREN operator NUMBER  */
+#line 1593 "src/p.y"
+                                           { 
                     resourceset.resource_id = RESOURCE_ID_CHILDREN;
-                    resourceset.operator = (yyvsp[(2) - (3)].number);
-                    resourceset.limit = (int) (yyvsp[(3) - (3)].number); 
+                    resourceset.operator = (yyvsp[-1].number);
+                    resourceset.limit = (int) (yyvsp[0].number); 
+                  }
+#line 4464 "src/y.tab.c"
+    break;
+
+  case 463: /* resourceload: resourceloadavg operator value  */
+#line 1600 "src/p.y"
+                                                 { 
+                    resourceset.resource_id = (yyvsp[-2].number);
+                    resourceset.operator = (yyvsp[-1].number);
+                    resourceset.limit = (int) ((yyvsp[0].real) * 10.0); 
+                  }
+#line 4474 "src/y.tab.c"
+    break;
+
+  case 464: /* resourceloadavg: LOADAVG1  */
+#line 1607 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_LOAD1; }
+#line 4480 "src/y.tab.c"
+    break;
+
+  case 465: /* resourceloadavg: LOADAVG5  */
+#line 1608 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_LOAD5; }
+#line 4486 "src/y.tab.c"
+    break;
+
+  case 466: /* resourceloadavg: LOADAVG15  */
+#line 1609 "src/p.y"
+                            { (yyval.number) = RESOURCE_ID_LOAD15; }
+#line 4492 "src/y.tab.c"
+    break;
+
+  case 467: /* trend: IF trendfunction trendmetric OVER NUMBER CYCLE operator trendlimit rate1 THEN action1 recovery  */
+#line 1612 "src/p.y"
+                                                                                                                 {
+                    trendset.cycles = (yyvsp[-7].number);
+                    trendset.operator = (yyvsp[-5].number);
+                    addeventaction(&(trendset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                    addtrend(&trendset);
+                  }
+#line 4503 "src/y.tab.c"
+    break;
+
+  case 468: /* trendfunction: AVERAGE  */
+#line 1620 "src/p.y"
+                          { trendset.function = TREND_AVERAGE; }
+#line 4509 "src/y.tab.c"
+    break;
+
+  case 469: /* trendfunction: PERCENTILE NUMBER  */
+#line 1621 "src/p.y"
+                                    {
+                    trendset.function = TREND_PERCENTILE;
+                    trendset.percentile = (yyvsp[0].number);
+                    if ((yyvsp[0].number) < 1 || (yyvsp[0].number) > 100)
+                      yyerror2("the percentile must be between 1 and 100");
                   }
+#line 4520 "src/y.tab.c"
+    break;
+
+  case 470: /* trendfunction: SLOPE  */
+#line 1627 "src/p.y"
+                        { trendset.function = TREND_SLOPE; }
+#line 4526 "src/y.tab.c"
+    break;
+
+  case 471: /* trendmetric: CPU  */
+#line 1630 "src/p.y"
+                               { trendset.metric = HISTORY_CPU; }
+#line 4532 "src/y.tab.c"
+    break;
+
+  case 472: /* trendmetric: TOTALCPU  */
+#line 1631 "src/p.y"
+                               { trendset.metric = HISTORY_TOTALCPU; }
+#line 4538 "src/y.tab.c"
+    break;
+
+  case 473: /* trendmetric: MEMORY  */
+#line 1632 "src/p.y"
+                               { trendset.metric = HISTORY_MEMORY; }
+#line 4544 "src/y.tab.c"
+    break;
+
+  case 474: /* trendmetric: TOTALMEMORY  */
+#line 1633 "src/p.y"
+                               { trendset.metric = HISTORY_TOTALMEMORY; }
+#line 4550 "src/y.tab.c"
+    break;
+
+  case 475: /* trendmetric: CHILDREN  */
+#line 1634 "src/p.y"
+                               { trendset.metric = HISTORY_CHILDREN; }
+#line 4556 "src/y.tab.c"
+    break;
+
+  case 476: /* trendmetric: LOADAVG1  */
+#line 1635 "src/p.y"
+                               { trendset.metric = HISTORY_LOADAVG; }
+#line 4562 "src/y.tab.c"
+    break;
+
+  case 477: /* trendmetric: SWAP  */
+#line 1636 "src/p.y"
+                               { trendset.metric = HISTORY_SWAP; }
+#line 4568 "src/y.tab.c"
     break;
 
-  case 435:
+  case 478: /* trendmetric: RESPONSETIME  */
+#line 1637 "src/p.y"
+                               { trendset.metric = HISTORY_RESPONSE; }
+#line 4574 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1498 "src/p.y"
-    { 
-                    resourceset.resource_id = (yyvsp[(1) - (3)].number);
-                    resourceset.operator = (yyvsp[(2) - (3)].number);
-                    resourceset.limit = (int) ((yyvsp[(3) - (3)].real) * 10.0); 
+  case 479: /* trendlimit: value trendunit  */
+#line 1640 "src/p.y"
+                                  {
+                    trendvalue = (yyvsp[-1].real);
+                    trendunit = (yyvsp[0].number);
                   }
+#line 4583 "src/y.tab.c"
+    break;
+
+  case 480: /* trendunit: %empty  */
+#line 1646 "src/p.y"
+                               { (yyval.number) = TRENDUNIT_NONE; }
+#line 4589 "src/y.tab.c"
     break;
 
-  case 436:
+  case 481: /* trendunit: PERCENT  */
+#line 1647 "src/p.y"
+                               { (yyval.number) = TRENDUNIT_PERCENT; }
+#line 4595 "src/y.tab.c"
+    break;
+
+  case 482: /* trendunit: MILLISECOND  */
+#line 1648 "src/p.y"
+                               { (yyval.number) = TRENDUNIT_MILLISECOND; }
+#line 4601 "src/y.tab.c"
+    break;
+
+  case 483: /* trendunit: SECOND  */
+#line 1649 "src/p.y"
+                               { (yyval.number) = TRENDUNIT_SECOND; }
+#line 4607 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1505 "src/p.y"
-    { (yyval.number) = RESOURCE_ID_LOAD1; }
+  case 484: /* trendunit: BYTE  */
+#line 1650 "src/p.y"
+                               { (yyval.number) = UNIT_BYTE; }
+#line 4613 "src/y.tab.c"
+    break;
+
+  case 485: /* trendunit: KILOBYTE  */
+#line 1651 "src/p.y"
+                               { (yyval.number) = UNIT_KILOBYTE; }
+#line 4619 "src/y.tab.c"
+    break;
+
+  case 486: /* trendunit: MEGABYTE  */
+#line 1652 "src/p.y"
+                               { (yyval.number) = UNIT_MEGABYTE; }
+#line 4625 "src/y.tab.c"
+    break;
+
+  case 487: /* trendunit: GIGABYTE  */
+#line 1653 "src/p.y"
+                               { (yyval.number) = UNIT_GIGABYTE; }
+#line 4631 "src/y.tab.c"
+    break;
+
+  case 488: /* timing: IF timingphase operator value timingunit rate1 THEN action1 recovery  */
+#line 1656 "src/p.y"
+                                                                                       {
+                    timingset.operator = (yyvsp[-6].number);
+                    timingset.limit = (long long)((yyvsp[-5].real) * (yyvsp[-4].number));
+                    addeventaction(&(timingset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                    addtiming(&timingset);
+                  }
+#line 4642 "src/y.tab.c"
     break;
 
-  case 437:
+  case 489: /* timingphase: RESPONSETIME  */
+#line 1664 "src/p.y"
+                                { timingset.phase = TIMING_RESPONSE; }
+#line 4648 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1506 "src/p.y"
-    { (yyval.number) = RESOURCE_ID_LOAD5; }
+  case 490: /* timingphase: RESOLVETIME  */
+#line 1665 "src/p.y"
+                                { timingset.phase = TIMING_RESOLVE; }
+#line 4654 "src/y.tab.c"
     break;
 
-  case 438:
+  case 491: /* timingphase: CONNECTTIME  */
+#line 1666 "src/p.y"
+                                { timingset.phase = TIMING_CONNECT; }
+#line 4660 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1507 "src/p.y"
-    { (yyval.number) = RESOURCE_ID_LOAD15; }
+  case 492: /* timingphase: TLSTIME  */
+#line 1667 "src/p.y"
+                                { timingset.phase = TIMING_TLS; }
+#line 4666 "src/y.tab.c"
     break;
 
-  case 439:
+  case 493: /* timingphase: FIRSTBYTETIME  */
+#line 1668 "src/p.y"
+                                { timingset.phase = TIMING_FIRSTBYTE; }
+#line 4672 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1510 "src/p.y"
-    { (yyval.real) = (yyvsp[(1) - (1)].real); }
+  case 494: /* timingunit: MILLISECOND  */
+#line 1671 "src/p.y"
+                              { (yyval.number) = 1000; }
+#line 4678 "src/y.tab.c"
     break;
 
-  case 440:
+  case 495: /* timingunit: SECOND  */
+#line 1672 "src/p.y"
+                              { (yyval.number) = 1000000; }
+#line 4684 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1511 "src/p.y"
-    { (yyval.real) = (float) (yyvsp[(1) - (1)].number); }
+  case 496: /* value: REAL  */
+#line 1675 "src/p.y"
+                       { (yyval.real) = (yyvsp[0].real); }
+#line 4690 "src/y.tab.c"
     break;
 
-  case 441:
+  case 497: /* value: NUMBER  */
+#line 1676 "src/p.y"
+                         { (yyval.real) = (float) (yyvsp[0].number); }
+#line 4696 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1514 "src/p.y"
-    {
-                    timestampset.operator = (yyvsp[(3) - (9)].number);
-                    timestampset.time = ((yyvsp[(4) - (9)].number) * (yyvsp[(5) - (9)].number));
-                    addeventaction(&(timestampset).action, (yyvsp[(8) - (9)].number), (yyvsp[(9) - (9)].number));
+  case 498: /* timestamp: IF TIMESTAMP operator NUMBER time rate1 THEN action1 recovery  */
+#line 1679 "src/p.y"
+                                                                                {
+                    timestampset.operator = (yyvsp[-6].number);
+                    timestampset.time = ((yyvsp[-5].number) * (yyvsp[-4].number));
+                    addeventaction(&(timestampset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addtimestamp(&timestampset, FALSE);
                   }
+#line 4707 "src/y.tab.c"
     break;
 
-  case 442:
-
-/* Line 1806 of yacc.c  */
-#line 1520 "src/p.y"
-    {
+  case 499: /* timestamp: IF CHANGED TIMESTAMP rate1 THEN action1  */
+#line 1685 "src/p.y"
+                                                          {
                     timestampset.test_changes = TRUE;
-                    addeventaction(&(timestampset).action, (yyvsp[(6) - (6)].number), ACTION_IGNORE);
+                    addeventaction(&(timestampset).action, (yyvsp[0].number), ACTION_IGNORE);
                     addtimestamp(&timestampset, TRUE);
                   }
+#line 4717 "src/y.tab.c"
     break;
 
-  case 443:
-
-/* Line 1806 of yacc.c  */
-#line 1527 "src/p.y"
-    { (yyval.number) = OPERATOR_EQUAL; }
+  case 500: /* tree: IF FILES treepattern operator NUMBER rate1 THEN action1 recovery  */
+#line 1692 "src/p.y"
+                                                                                   {
+                    treeset.metric = TREE_FILES;
+                    treeset.operator = (yyvsp[-5].number);
+                    treeset.limit = (yyvsp[-4].number);
+                    addeventaction(&(treeset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                    addtree(&treeset);
+                  }
+#line 4729 "src/y.tab.c"
     break;
 
-  case 444:
-
-/* Line 1806 of yacc.c  */
-#line 1528 "src/p.y"
-    { (yyval.number) = OPERATOR_GREATER; }
+  case 501: /* tree: IF SIZE treepattern operator NUMBER unit rate1 THEN action1 recovery  */
+#line 1699 "src/p.y"
+                                                                                       {
+                    treeset.metric = TREE_SIZE;
+                    treeset.operator = (yyvsp[-6].number);
+                    treeset.limit = ((unsigned long long)(yyvsp[-5].number) * (yyvsp[-4].number));
+                    addeventaction(&(treeset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                    addtree(&treeset);
+                  }
+#line 4741 "src/y.tab.c"
     break;
 
-  case 445:
-
-/* Line 1806 of yacc.c  */
-#line 1529 "src/p.y"
-    { (yyval.number) = OPERATOR_LESS; }
+  case 502: /* tree: IF OLDEST treepattern operator NUMBER time rate1 THEN action1 recovery  */
+#line 1706 "src/p.y"
+                                                                                         {
+                    treeset.metric = TREE_OLDEST;
+                    treeset.operator = (yyvsp[-6].number);
+                    treeset.limit = ((unsigned long long)(yyvsp[-5].number) * (yyvsp[-4].number));
+                    addeventaction(&(treeset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                    addtree(&treeset);
+                  }
+#line 4753 "src/y.tab.c"
     break;
 
-  case 446:
-
-/* Line 1806 of yacc.c  */
-#line 1530 "src/p.y"
-    { (yyval.number) = OPERATOR_EQUAL; }
+  case 503: /* tree: IF NEWEST treepattern operator NUMBER time rate1 THEN action1 recovery  */
+#line 1713 "src/p.y"
+                                                                                         {
+                    treeset.metric = TREE_NEWEST;
+                    treeset.operator = (yyvsp[-6].number);
+                    treeset.limit = ((unsigned long long)(yyvsp[-5].number) * (yyvsp[-4].number));
+                    addeventaction(&(treeset).action, (yyvsp[-1].number), (yyvsp[0].number));
+                    addtree(&treeset);
+                  }
+#line 4765 "src/y.tab.c"
     break;
 
-  case 447:
-
-/* Line 1806 of yacc.c  */
-#line 1531 "src/p.y"
-    { (yyval.number) = OPERATOR_NOTEQUAL; }
+  case 504: /* treerefresh: REFRESH NUMBER CYCLE  */
+#line 1722 "src/p.y"
+                                       {
+                    if ((yyvsp[-1].number) < 1)
+                      yyerror2("The directory tree refresh must be at least 1 cycle");
+                    current->treerefresh = (yyvsp[-1].number);
+                  }
+#line 4775 "src/y.tab.c"
     break;
 
-  case 448:
-
-/* Line 1806 of yacc.c  */
-#line 1532 "src/p.y"
-    { (yyval.number) = OPERATOR_NOTEQUAL; }
+  case 505: /* treepattern: %empty  */
+#line 1729 "src/p.y"
+                              { treeset.pattern = NULL; }
+#line 4781 "src/y.tab.c"
     break;
 
-  case 449:
-
-/* Line 1806 of yacc.c  */
-#line 1535 "src/p.y"
-    { (yyval.number) = TIME_SECOND; }
+  case 506: /* treepattern: MATCH STRING  */
+#line 1730 "src/p.y"
+                               { treeset.pattern = (yyvsp[0].string); }
+#line 4787 "src/y.tab.c"
     break;
 
-  case 450:
-
-/* Line 1806 of yacc.c  */
-#line 1536 "src/p.y"
-    { (yyval.number) = TIME_SECOND; }
+  case 507: /* operator: %empty  */
+#line 1733 "src/p.y"
+                              { (yyval.number) = OPERATOR_EQUAL; }
+#line 4793 "src/y.tab.c"
     break;
 
-  case 451:
-
-/* Line 1806 of yacc.c  */
-#line 1537 "src/p.y"
-    { (yyval.number) = TIME_MINUTE; }
+  case 508: /* operator: GREATER  */
+#line 1734 "src/p.y"
+                              { (yyval.number) = OPERATOR_GREATER; }
+#line 4799 "src/y.tab.c"
     break;
 
-  case 452:
-
-/* Line 1806 of yacc.c  */
-#line 1538 "src/p.y"
-    { (yyval.number) = TIME_HOUR; }
+  case 509: /* operator: LESS  */
+#line 1735 "src/p.y"
+                              { (yyval.number) = OPERATOR_LESS; }
+#line 4805 "src/y.tab.c"
     break;
 
-  case 453:
-
-/* Line 1806 of yacc.c  */
-#line 1539 "src/p.y"
-    { (yyval.number) = TIME_DAY; }
+  case 510: /* operator: EQUAL  */
+#line 1736 "src/p.y"
+                              { (yyval.number) = OPERATOR_EQUAL; }
+#line 4811 "src/y.tab.c"
     break;
 
-  case 454:
-
-/* Line 1806 of yacc.c  */
-#line 1542 "src/p.y"
-    { (yyval.number) = ACTION_ALERT; }
+  case 511: /* operator: NOTEQUAL  */
+#line 1737 "src/p.y"
+                              { (yyval.number) = OPERATOR_NOTEQUAL; }
+#line 4817 "src/y.tab.c"
     break;
 
-  case 455:
+  case 512: /* operator: CHANGED  */
+#line 1738 "src/p.y"
+                              { (yyval.number) = OPERATOR_NOTEQUAL; }
+#line 4823 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1543 "src/p.y"
-    { (yyval.number) = ACTION_EXEC; }
+  case 513: /* time: %empty  */
+#line 1741 "src/p.y"
+                              { (yyval.number) = TIME_SECOND; }
+#line 4829 "src/y.tab.c"
     break;
 
-  case 456:
+  case 514: /* time: SECOND  */
+#line 1742 "src/p.y"
+                              { (yyval.number) = TIME_SECOND; }
+#line 4835 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1544 "src/p.y"
-    { (yyval.number) = ACTION_EXEC; }
+  case 515: /* time: MINUTE  */
+#line 1743 "src/p.y"
+                              { (yyval.number) = TIME_MINUTE; }
+#line 4841 "src/y.tab.c"
     break;
 
-  case 457:
+  case 516: /* time: HOUR  */
+#line 1744 "src/p.y"
+                              { (yyval.number) = TIME_HOUR; }
+#line 4847 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1545 "src/p.y"
-    { (yyval.number) = ACTION_RESTART; }
+  case 517: /* time: DAY  */
+#line 1745 "src/p.y"
+                              { (yyval.number) = TIME_DAY; }
+#line 4853 "src/y.tab.c"
     break;
 
-  case 458:
+  case 518: /* action: ALERT  */
+#line 1748 "src/p.y"
+                                                   { (yyval.number) = ACTION_ALERT; }
+#line 4859 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1546 "src/p.y"
-    { (yyval.number) = ACTION_START; }
+  case 519: /* action: EXEC argumentlist  */
+#line 1749 "src/p.y"
+                                                   { (yyval.number) = ACTION_EXEC; }
+#line 4865 "src/y.tab.c"
     break;
 
-  case 459:
+  case 520: /* action: EXEC argumentlist useroptionlist  */
+#line 1750 "src/p.y"
+                                                   { (yyval.number) = ACTION_EXEC; }
+#line 4871 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1547 "src/p.y"
-    { (yyval.number) = ACTION_STOP; }
+  case 521: /* action: RESTART  */
+#line 1751 "src/p.y"
+                                                   { (yyval.number) = ACTION_RESTART; }
+#line 4877 "src/y.tab.c"
     break;
 
-  case 460:
+  case 522: /* action: START  */
+#line 1752 "src/p.y"
+                                                   { (yyval.number) = ACTION_START; }
+#line 4883 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1548 "src/p.y"
-    { (yyval.number) = ACTION_UNMONITOR; }
+  case 523: /* action: STOP  */
+#line 1753 "src/p.y"
+                                                   { (yyval.number) = ACTION_STOP; }
+#line 4889 "src/y.tab.c"
     break;
 
-  case 461:
+  case 524: /* action: UNMONITOR  */
+#line 1754 "src/p.y"
+                                                   { (yyval.number) = ACTION_UNMONITOR; }
+#line 4895 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1551 "src/p.y"
-    {
-                    (yyval.number) = (yyvsp[(1) - (1)].number);
-                    if ((yyvsp[(1) - (1)].number) == ACTION_EXEC && command) {
+  case 525: /* action1: action  */
+#line 1757 "src/p.y"
+                         {
+                    (yyval.number) = (yyvsp[0].number);
+                    if ((yyvsp[0].number) == ACTION_EXEC && command) {
                       command1 = command;
                       command = NULL;
                     }
                   }
+#line 4907 "src/y.tab.c"
     break;
 
-  case 462:
-
-/* Line 1806 of yacc.c  */
-#line 1560 "src/p.y"
-    {
-                    (yyval.number) = (yyvsp[(1) - (1)].number);
-                    if ((yyvsp[(1) - (1)].number) == ACTION_EXEC && command) {
+  case 526: /* action2: action  */
+#line 1766 "src/p.y"
+                         {
+                    (yyval.number) = (yyvsp[0].number);
+                    if ((yyvsp[0].number) == ACTION_EXEC && command) {
                       command2 = command;
                       command = NULL;
                     }
                   }
+#line 4919 "src/y.tab.c"
     break;
 
-  case 464:
-
-/* Line 1806 of yacc.c  */
-#line 1570 "src/p.y"
-    {
-                    rate1.count  = (yyvsp[(1) - (2)].number);
-                    rate1.cycles = (yyvsp[(1) - (2)].number);
+  case 528: /* rate1: NUMBER CYCLE  */
+#line 1776 "src/p.y"
+                               {
+                    rate1.count  = (yyvsp[-1].number);
+                    rate1.cycles = (yyvsp[-1].number);
                     if (rate1.cycles < 1 || rate1.cycles > BITMAP_MAX)
                       yyerror2("the number of cycles must be between 1 and %d", BITMAP_MAX);
                   }
+#line 4930 "src/y.tab.c"
     break;
 
-  case 465:
-
-/* Line 1806 of yacc.c  */
-#line 1576 "src/p.y"
-    {
-                    rate1.count  = (yyvsp[(1) - (3)].number);
-                    rate1.cycles = (yyvsp[(2) - (3)].number);
+  case 529: /* rate1: NUMBER NUMBER CYCLE  */
+#line 1782 "src/p.y"
+                                      {
+                    rate1.count  = (yyvsp[-2].number);
+                    rate1.cycles = (yyvsp[-1].number);
                     if (rate1.cycles < 1 || rate1.cycles > BITMAP_MAX)
                       yyerror2("the number of cycles must be between 1 and %d", BITMAP_MAX);
                     if (rate1.count < 1 || rate1.count > rate1.cycles)
                       yyerror2("the number of events must be bigger then 0 and less than poll cycles");
                   }
+#line 4943 "src/y.tab.c"
     break;
 
-  case 467:
-
-/* Line 1806 of yacc.c  */
-#line 1587 "src/p.y"
-    {
-                    rate2.count  = (yyvsp[(1) - (2)].number);
-                    rate2.cycles = (yyvsp[(1) - (2)].number);
+  case 531: /* rate2: NUMBER CYCLE  */
+#line 1793 "src/p.y"
+                               {
+                    rate2.count  = (yyvsp[-1].number);
+                    rate2.cycles = (yyvsp[-1].number);
                     if (rate2.cycles < 1 || rate2.cycles > BITMAP_MAX)
                       yyerror2("the number of cycles must be between 1 and %d", BITMAP_MAX);
                   }
+#line 4954 "src/y.tab.c"
     break;
 
-  case 468:
-
-/* Line 1806 of yacc.c  */
-#line 1593 "src/p.y"
-    {
-                    rate2.count  = (yyvsp[(1) - (3)].number);
-                    rate2.cycles = (yyvsp[(2) - (3)].number);
+  case 532: /* rate2: NUMBER NUMBER CYCLE  */
+#line 1799 "src/p.y"
+                                      {
+                    rate2.count  = (yyvsp[-2].number);
+                    rate2.cycles = (yyvsp[-1].number);
                     if (rate2.cycles < 1 || rate2.cycles > BITMAP_MAX)
                       yyerror2("the number of cycles must be between 1 and %d", BITMAP_MAX);
                     if (rate2.count < 1 || rate2.count > rate2.cycles)
                       yyerror2("the number of events must be bigger then 0 and less than poll cycles");
                   }
+#line 4967 "src/y.tab.c"
     break;
 
-  case 469:
-
-/* Line 1806 of yacc.c  */
-#line 1603 "src/p.y"
-    {
+  case 533: /* recovery: %empty  */
+#line 1809 "src/p.y"
+                              {
                     (yyval.number) = ACTION_ALERT;
                   }
+#line 4975 "src/y.tab.c"
     break;
 
-  case 470:
-
-/* Line 1806 of yacc.c  */
-#line 1606 "src/p.y"
-    {
-                    (yyval.number) = (yyvsp[(6) - (6)].number);
+  case 534: /* recovery: ELSE IF RECOVERED rate2 THEN action2  */
+#line 1812 "src/p.y"
+                                                       {
+                    (yyval.number) = (yyvsp[0].number);
                   }
+#line 4983 "src/y.tab.c"
     break;
 
-  case 471:
-
-/* Line 1806 of yacc.c  */
-#line 1609 "src/p.y"
-    {
-                    (yyval.number) = (yyvsp[(6) - (6)].number);
+  case 535: /* recovery: ELSE IF PASSED rate2 THEN action2  */
+#line 1815 "src/p.y"
+                                                    {
+                    (yyval.number) = (yyvsp[0].number);
                   }
+#line 4991 "src/y.tab.c"
     break;
 
-  case 472:
-
-/* Line 1806 of yacc.c  */
-#line 1612 "src/p.y"
-    {
-                    (yyval.number) = (yyvsp[(6) - (6)].number);
+  case 536: /* recovery: ELSE IF SUCCEEDED rate2 THEN action2  */
+#line 1818 "src/p.y"
+                                                       {
+                    (yyval.number) = (yyvsp[0].number);
                   }
+#line 4999 "src/y.tab.c"
     break;
 
-  case 473:
-
-/* Line 1806 of yacc.c  */
-#line 1617 "src/p.y"
-    {
-                    addeventaction(&(checksumset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+  case 537: /* checksum: IF FAILED hashtype CHECKSUM rate1 THEN action1 recovery  */
+#line 1823 "src/p.y"
+                                                                          {
+                    addeventaction(&(checksumset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addchecksum(&checksumset);
                   }
+#line 5008 "src/y.tab.c"
     break;
 
-  case 474:
-
-/* Line 1806 of yacc.c  */
-#line 1622 "src/p.y"
-    {
-                    snprintf(checksumset.hash, sizeof(checksumset.hash), "%s", (yyvsp[(6) - (10)].string));
-                    FREE((yyvsp[(6) - (10)].string));
-                    addeventaction(&(checksumset).action, (yyvsp[(9) - (10)].number), (yyvsp[(10) - (10)].number));
+  case 538: /* checksum: IF FAILED hashtype CHECKSUM EXPECT STRING rate1 THEN action1 recovery  */
+#line 1828 "src/p.y"
+                           {
+                    snprintf(checksumset.hash, sizeof(checksumset.hash), "%s", (yyvsp[-4].string));
+                    FREE((yyvsp[-4].string));
+                    addeventaction(&(checksumset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addchecksum(&checksumset);
                   }
+#line 5019 "src/y.tab.c"
     break;
 
-  case 475:
-
-/* Line 1806 of yacc.c  */
-#line 1628 "src/p.y"
-    {
+  case 539: /* checksum: IF CHANGED hashtype CHECKSUM rate1 THEN action1  */
+#line 1834 "src/p.y"
+                                                                  {
                     checksumset.test_changes = TRUE;
-                    addeventaction(&(checksumset).action, (yyvsp[(7) - (7)].number), ACTION_IGNORE);
+                    addeventaction(&(checksumset).action, (yyvsp[0].number), ACTION_IGNORE);
                     addchecksum(&checksumset);
                   }
+#line 5029 "src/y.tab.c"
     break;
 
-  case 476:
-
-/* Line 1806 of yacc.c  */
-#line 1634 "src/p.y"
-    { checksumset.type = HASH_UNKNOWN; }
+  case 540: /* hashtype: %empty  */
+#line 1840 "src/p.y"
+                              { checksumset.type = HASH_UNKNOWN; }
+#line 5035 "src/y.tab.c"
     break;
 
-  case 477:
-
-/* Line 1806 of yacc.c  */
-#line 1635 "src/p.y"
-    { checksumset.type = HASH_MD5; }
+  case 541: /* hashtype: MD5HASH  */
+#line 1841 "src/p.y"
+                              { checksumset.type = HASH_MD5; }
+#line 5041 "src/y.tab.c"
     break;
 
-  case 478:
+  case 542: /* hashtype: SHA1HASH  */
+#line 1842 "src/p.y"
+                              { checksumset.type = HASH_SHA1; }
+#line 5047 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1636 "src/p.y"
-    { checksumset.type = HASH_SHA1; }
+  case 543: /* hashtype: SHA256HASH  */
+#line 1843 "src/p.y"
+                              { checksumset.type = HASH_SHA256; }
+#line 5053 "src/y.tab.c"
     break;
 
-  case 479:
+  case 544: /* hashtype: XXH64HASH  */
+#line 1844 "src/p.y"
+                              { checksumset.type = HASH_XXH64; }
+#line 5059 "src/y.tab.c"
+    break;
 
-/* Line 1806 of yacc.c  */
-#line 1639 "src/p.y"
-    {
+  case 545: /* inode: IF INODE operator NUMBER rate1 THEN action1 recovery  */
+#line 1847 "src/p.y"
+                                                                       {
                     filesystemset.resource = RESOURCE_ID_INODE;
-                    filesystemset.operator = (yyvsp[(3) - (8)].number);
-                    filesystemset.limit_absolute = (yyvsp[(4) - (8)].number);
-                    addeventaction(&(filesystemset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+                    filesystemset.operator = (yyvsp[-5].number);
+                    filesystemset.limit_absolute = (yyvsp[-4].number);
+                    addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addfilesystem(&filesystemset);
                   }
+#line 5071 "src/y.tab.c"
     break;
 
-  case 480:
-
-/* Line 1806 of yacc.c  */
-#line 1646 "src/p.y"
-    {
+  case 546: /* inode: IF INODE operator NUMBER PERCENT rate1 THEN action1 recovery  */
+#line 1854 "src/p.y"
+                                                                               {
                     filesystemset.resource = RESOURCE_ID_INODE;
-                    filesystemset.operator = (yyvsp[(3) - (9)].number);
-                    filesystemset.limit_percent = (int)((yyvsp[(4) - (9)].number) * 10);
-                    addeventaction(&(filesystemset).action, (yyvsp[(8) - (9)].number), (yyvsp[(9) - (9)].number));
+                    filesystemset.operator = (yyvsp[-6].number);
+                    filesystemset.limit_percent = (int)((yyvsp[-5].number) * 10);
+                    addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addfilesystem(&filesystemset);
                   }
+#line 5083 "src/y.tab.c"
     break;
 
-  case 481:
-
-/* Line 1806 of yacc.c  */
-#line 1655 "src/p.y"
-    {
+  case 547: /* space: IF SPACE operator value unit rate1 THEN action1 recovery  */
+#line 1863 "src/p.y"
+                                                                           {
                     if (!filesystem_usage(current->inf, current->path))
                       yyerror2("cannot read usage of filesystem %s", current->path);
                     filesystemset.resource = RESOURCE_ID_SPACE;
-                    filesystemset.operator = (yyvsp[(3) - (9)].number);
-                    filesystemset.limit_absolute = (int)((float)(yyvsp[(4) - (9)].real) / (float)current->inf->priv.filesystem.f_bsize * (float)(yyvsp[(5) - (9)].number));
-                    addeventaction(&(filesystemset).action, (yyvsp[(8) - (9)].number), (yyvsp[(9) - (9)].number));
+                    filesystemset.operator = (yyvsp[-6].number);
+                    filesystemset.limit_absolute = (int)((float)(yyvsp[-5].real) / (float)current->inf->priv.filesystem.f_bsize * (float)(yyvsp[-4].number));
+                    addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addfilesystem(&filesystemset);
                   }
+#line 5097 "src/y.tab.c"
     break;
 
-  case 482:
-
-/* Line 1806 of yacc.c  */
-#line 1664 "src/p.y"
-    {
+  case 548: /* space: IF SPACE operator NUMBER PERCENT rate1 THEN action1 recovery  */
+#line 1872 "src/p.y"
+                                                                               {
                     filesystemset.resource = RESOURCE_ID_SPACE;
-                    filesystemset.operator = (yyvsp[(3) - (9)].number);
-                    filesystemset.limit_percent = (int)((yyvsp[(4) - (9)].number) * 10);
-                    addeventaction(&(filesystemset).action, (yyvsp[(8) - (9)].number), (yyvsp[(9) - (9)].number));
+                    filesystemset.operator = (yyvsp[-6].number);
+                    filesystemset.limit_percent = (int)((yyvsp[-5].number) * 10);
+                    addeventaction(&(filesystemset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addfilesystem(&filesystemset);
                   }
+#line 5109 "src/y.tab.c"
     break;
 
-  case 483:
-
-/* Line 1806 of yacc.c  */
-#line 1673 "src/p.y"
-    {
-                    seteventaction(&(current)->action_FSFLAG, (yyvsp[(6) - (6)].number), ACTION_IGNORE);
+  case 549: /* fsflag: IF CHANGED FSFLAG rate1 THEN action1  */
+#line 1881 "src/p.y"
+                                                       {
+                    seteventaction(&(current)->action_FSFLAG, (yyvsp[0].number), ACTION_IGNORE);
                   }
+#line 5117 "src/y.tab.c"
     break;
 
-  case 484:
-
-/* Line 1806 of yacc.c  */
-#line 1678 "src/p.y"
-    { (yyval.number) = UNIT_BYTE; }
+  case 550: /* unit: %empty  */
+#line 1886 "src/p.y"
+                               { (yyval.number) = UNIT_BYTE; }
+#line 5123 "src/y.tab.c"
     break;
 
-  case 485:
-
-/* Line 1806 of yacc.c  */
-#line 1679 "src/p.y"
-    { (yyval.number) = UNIT_BYTE; }
+  case 551: /* unit: BYTE  */
+#line 1887 "src/p.y"
+                               { (yyval.number) = UNIT_BYTE; }
+#line 5129 "src/y.tab.c"
     break;
 
-  case 486:
-
-/* Line 1806 of yacc.c  */
-#line 1680 "src/p.y"
-    { (yyval.number) = UNIT_KILOBYTE; }
+  case 552: /* unit: KILOBYTE  */
+#line 1888 "src/p.y"
+                               { (yyval.number) = UNIT_KILOBYTE; }
+#line 5135 "src/y.tab.c"
     break;
 
-  case 487:
-
-/* Line 1806 of yacc.c  */
-#line 1681 "src/p.y"
-    { (yyval.number) = UNIT_MEGABYTE; }
+  case 553: /* unit: MEGABYTE  */
+#line 1889 "src/p.y"
+                               { (yyval.number) = UNIT_MEGABYTE; }
+#line 5141 "src/y.tab.c"
     break;
 
-  case 488:
-
-/* Line 1806 of yacc.c  */
-#line 1682 "src/p.y"
-    { (yyval.number) = UNIT_GIGABYTE; }
+  case 554: /* unit: GIGABYTE  */
+#line 1890 "src/p.y"
+                               { (yyval.number) = UNIT_GIGABYTE; }
+#line 5147 "src/y.tab.c"
     break;
 
-  case 489:
-
-/* Line 1806 of yacc.c  */
-#line 1685 "src/p.y"
-    {
-                    permset.perm = check_perm((yyvsp[(4) - (8)].number));
-                    addeventaction(&(permset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+  case 555: /* permission: IF FAILED PERMISSION NUMBER rate1 THEN action1 recovery  */
+#line 1893 "src/p.y"
+                                                                          {
+                    permset.perm = check_perm((yyvsp[-4].number));
+                    addeventaction(&(permset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addperm(&permset);
                   }
+#line 5157 "src/y.tab.c"
     break;
 
-  case 490:
-
-/* Line 1806 of yacc.c  */
-#line 1692 "src/p.y"
-    {
+  case 556: /* match: IF matchflagnot MATCH PATH rate1 THEN action1  */
+#line 1900 "src/p.y"
+                                                                {
                     matchset.ignore = FALSE;
-                    matchset.match_path = (yyvsp[(4) - (7)].string);
+                    matchset.match_path = (yyvsp[-3].string);
                     matchset.match_string = NULL;
-                    addmatchpath(&matchset, (yyvsp[(7) - (7)].number));
-                    FREE((yyvsp[(4) - (7)].string)); 
+                    addmatchpath(&matchset, (yyvsp[0].number));
+                    FREE((yyvsp[-3].string)); 
                   }
+#line 5169 "src/y.tab.c"
     break;
 
-  case 491:
-
-/* Line 1806 of yacc.c  */
-#line 1699 "src/p.y"
-    {
+  case 557: /* match: IF matchflagnot MATCH STRING rate1 THEN action1  */
+#line 1907 "src/p.y"
+                                                                  {
                     matchset.ignore = FALSE;
                     matchset.match_path = NULL;
-                    matchset.match_string = (yyvsp[(4) - (7)].string);
-                    addmatch(&matchset, (yyvsp[(7) - (7)].number), 0);
+                    matchset.match_string = (yyvsp[-3].string);
+                    addmatch(&matchset, (yyvsp[0].number), 0);
                   }
+#line 5180 "src/y.tab.c"
     break;
 
-  case 492:
-
-/* Line 1806 of yacc.c  */
-#line 1705 "src/p.y"
-    {
+  case 558: /* match: IGNORE matchflagnot MATCH PATH  */
+#line 1913 "src/p.y"
+                                                 {
                     matchset.ignore = TRUE;
-                    matchset.match_path = (yyvsp[(4) - (4)].string);
+                    matchset.match_path = (yyvsp[0].string);
                     matchset.match_string = NULL;
                     addmatchpath(&matchset, ACTION_IGNORE);
-                    FREE((yyvsp[(4) - (4)].string)); 
+                    FREE((yyvsp[0].string)); 
                   }
+#line 5192 "src/y.tab.c"
     break;
 
-  case 493:
-
-/* Line 1806 of yacc.c  */
-#line 1712 "src/p.y"
-    {
+  case 559: /* match: IGNORE matchflagnot MATCH STRING  */
+#line 1920 "src/p.y"
+                                                   {
                     matchset.ignore = TRUE;
                     matchset.match_path = NULL;
-                    matchset.match_string = (yyvsp[(4) - (4)].string);
+                    matchset.match_string = (yyvsp[0].string);
                     addmatch(&matchset, ACTION_IGNORE, 0);
                   }
+#line 5203 "src/y.tab.c"
     break;
 
-  case 494:
-
-/* Line 1806 of yacc.c  */
-#line 1720 "src/p.y"
-    {
+  case 560: /* matchflagnot: %empty  */
+#line 1928 "src/p.y"
+                              {
                     matchset.not = FALSE;
                   }
+#line 5211 "src/y.tab.c"
     break;
 
-  case 495:
-
-/* Line 1806 of yacc.c  */
-#line 1723 "src/p.y"
-    {
+  case 561: /* matchflagnot: NOT  */
+#line 1931 "src/p.y"
+                      {
                     matchset.not = TRUE;
                   }
+#line 5219 "src/y.tab.c"
     break;
 
-  case 496:
-
-/* Line 1806 of yacc.c  */
-#line 1729 "src/p.y"
-    {
-                    sizeset.operator = (yyvsp[(3) - (9)].number);
-                    sizeset.size = ((unsigned long long)(yyvsp[(4) - (9)].number) * (yyvsp[(5) - (9)].number));
-                    addeventaction(&(sizeset).action, (yyvsp[(8) - (9)].number), (yyvsp[(9) - (9)].number));
+  case 562: /* size: IF SIZE operator NUMBER unit rate1 THEN action1 recovery  */
+#line 1937 "src/p.y"
+                                                                           {
+                    sizeset.operator = (yyvsp[-6].number);
+                    sizeset.size = ((unsigned long long)(yyvsp[-5].number) * (yyvsp[-4].number));
+                    addeventaction(&(sizeset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addsize(&sizeset);
                   }
+#line 5230 "src/y.tab.c"
     break;
 
-  case 497:
-
-/* Line 1806 of yacc.c  */
-#line 1735 "src/p.y"
-    {
+  case 563: /* size: IF CHANGED SIZE rate1 THEN action1  */
+#line 1943 "src/p.y"
+                                                     {
                     sizeset.test_changes = TRUE;
-                    addeventaction(&(sizeset).action, (yyvsp[(6) - (6)].number), ACTION_IGNORE);
+                    addeventaction(&(sizeset).action, (yyvsp[0].number), ACTION_IGNORE);
                     addsize(&sizeset);
                   }
+#line 5240 "src/y.tab.c"
     break;
 
-  case 498:
-
-/* Line 1806 of yacc.c  */
-#line 1742 "src/p.y"
-    {
-                    uidset.uid = get_uid((yyvsp[(4) - (8)].string), 0);
-                    addeventaction(&(uidset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+  case 564: /* uid: IF FAILED UID STRING rate1 THEN action1 recovery  */
+#line 1950 "src/p.y"
+                                                                   {
+                    uidset.uid = get_uid((yyvsp[-4].string), 0);
+                    addeventaction(&(uidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     adduid(&uidset);
-                    FREE((yyvsp[(4) - (8)].string));
+                    FREE((yyvsp[-4].string));
                   }
+#line 5251 "src/y.tab.c"
     break;
 
-  case 499:
-
-/* Line 1806 of yacc.c  */
-#line 1748 "src/p.y"
-    {
-                    uidset.uid = get_uid(NULL, (yyvsp[(4) - (8)].number));
-                    addeventaction(&(uidset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+  case 565: /* uid: IF FAILED UID NUMBER rate1 THEN action1 recovery  */
+#line 1956 "src/p.y"
+                                                                   {
+                    uidset.uid = get_uid(NULL, (yyvsp[-4].number));
+                    addeventaction(&(uidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     adduid(&uidset);
                   }
+#line 5261 "src/y.tab.c"
     break;
 
-  case 500:
-
-/* Line 1806 of yacc.c  */
-#line 1755 "src/p.y"
-    {
-                    gidset.gid = get_gid((yyvsp[(4) - (8)].string), 0);
-                    addeventaction(&(gidset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+  case 566: /* gid: IF FAILED GID STRING rate1 THEN action1 recovery  */
+#line 1963 "src/p.y"
+                                                                   {
+                    gidset.gid = get_gid((yyvsp[-4].string), 0);
+                    addeventaction(&(gidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addgid(&gidset);
-                    FREE((yyvsp[(4) - (8)].string));
+                    FREE((yyvsp[-4].string));
                   }
+#line 5272 "src/y.tab.c"
     break;
 
-  case 501:
-
-/* Line 1806 of yacc.c  */
-#line 1761 "src/p.y"
-    {
-                    gidset.gid = get_gid(NULL, (yyvsp[(4) - (8)].number));
-                    addeventaction(&(gidset).action, (yyvsp[(7) - (8)].number), (yyvsp[(8) - (8)].number));
+  case 567: /* gid: IF FAILED GID NUMBER rate1 THEN action1 recovery  */
+#line 1969 "src/p.y"
+                                                                   {
+                    gidset.gid = get_gid(NULL, (yyvsp[-4].number));
+                    addeventaction(&(gidset).action, (yyvsp[-1].number), (yyvsp[0].number));
                     addgid(&gidset);
                   }
+#line 5282 "src/y.tab.c"
     break;
 
-  case 502:
-
-/* Line 1806 of yacc.c  */
-#line 1768 "src/p.y"
-    { (yyval.number) = ICMP_ECHO; }
+  case 568: /* icmptype: TYPE ICMPECHO  */
+#line 1976 "src/p.y"
+                                { (yyval.number) = ICMP_ECHO; }
+#line 5288 "src/y.tab.c"
     break;
 
-  case 503:
-
-/* Line 1806 of yacc.c  */
-#line 1771 "src/p.y"
-    { mailset.reminder = 0; }
+  case 569: /* reminder: %empty  */
+#line 1979 "src/p.y"
+                                        { mailset.reminder = 0; }
+#line 5294 "src/y.tab.c"
     break;
 
-  case 504:
-
-/* Line 1806 of yacc.c  */
-#line 1772 "src/p.y"
-    { mailset.reminder = (yyvsp[(2) - (2)].number); }
+  case 570: /* reminder: REMINDER NUMBER  */
+#line 1980 "src/p.y"
+                                        { mailset.reminder = (yyvsp[0].number); }
+#line 5300 "src/y.tab.c"
     break;
 
-  case 505:
-
-/* Line 1806 of yacc.c  */
-#line 1773 "src/p.y"
-    { mailset.reminder = (yyvsp[(2) - (3)].number); }
+  case 571: /* reminder: REMINDER NUMBER CYCLE  */
+#line 1981 "src/p.y"
+                                        { mailset.reminder = (yyvsp[-1].number); }
+#line 5306 "src/y.tab.c"
     break;
 
 
+#line 5310 "src/y.tab.c"
 
-/* Line 1806 of yacc.c  */
-#line 5604 "src/y.tab.c"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -5615,96 +5322,58 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -5716,14 +5385,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -5736,39 +5404,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -5779,26 +5450,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined(yyoverflow) || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -5807,32 +5482,25 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
-
 
+  return yyresult;
+}
 
-/* Line 2067 of yacc.c  */
-#line 1776 "src/p.y"
+#line 1984 "src/p.y"
 
 
 
@@ -5934,6 +5602,13 @@ int parse(char *controlfile) {
     return FALSE;
   }
 
+  /*
+   * The configuration objects are allocated from the arena of this
+   * configuration generation, gc() releases it in one step
+   */
+  Run.arena = Arena_new();
+  Arena_use(Run.arena);
+
   currentfile = Str_dup(controlfile);
 
   /* 
@@ -5951,6 +5626,8 @@ int parse(char *controlfile) {
   if (argyytext != NULL)
     FREE(argyytext);
 
+  Arena_use(NULL);
+
   /*
    * Secure check the monitrc file. The run control file must have the
    * same uid as the REAL uid of this process, it must have permissions
@@ -5996,11 +5673,16 @@ static void preparse() {
   Run.allowselfcert       = FALSE; 
   Run.mailserver_timeout  = SMTP_TIMEOUT;
   Run.bind_addr           = NULL;
+  Run.httpdsocket         = NULL;
+  Run.httpdsession        = 0;
   Run.eventlist           = NULL;
   Run.eventlist_dir       = NULL;
   Run.eventlist_slots     = -1;
   Run.system              = NULL;
   Run.expectbuffer        = STRLEN;
+  Run.keepalive           = 0;
+  Run.pidwatch            = FALSE;
+  Run.concurrency         = 1;
   Run.mmonits             = NULL;
   Run.maillist            = NULL;
   Run.mailservers         = NULL;
@@ -6010,6 +5692,7 @@ static void preparse() {
   Run.MailFormat.message  = NULL;
   depend_list             = NULL;
   Run.handler_init        = TRUE;
+  memset(&serviceindex, 0, sizeof(serviceindex));
 #ifdef OPENSSL_FIPS  
   Run.fipsEnabled         = FALSE;
 #endif
@@ -6030,6 +5713,9 @@ static void preparse() {
   reset_rateset();
   reset_filesystemset();
   reset_resourceset();
+  reset_trendset();
+  reset_timingset();
+  reset_treeset();
   reset_checksumset();
   reset_timestampset();
   reset_actionrateset();
@@ -6072,6 +5758,11 @@ static void postparse() {
                                 cfg_errflag++;
                         }
                 }
+                /* The timing tests measure the port tests of the service */
+                if (s->timinglist && ! s->portlist) {
+                        LogError("%s: Error: service '%s' has a response time test but no port or unix socket test\n", prog, s->name);
+                        cfg_errflag++;
+                }
         }
 
         /* Add the default general system service if not specified explicitly: service name default to hostname */
@@ -6081,7 +5772,7 @@ static void postparse() {
                         LogError("Cannot get system hostname -- please add 'check system <name>'\n");
                         cfg_errflag++;
                 }
-                if (Util_existService(hostname)) {
+                if (getservice(hostname)) {
                         LogError("'check system' not defined in control file, failed to add automatic configuration (service name %s is used already) -- please add 'check system <name>' manually\n", hostname);
                         cfg_errflag++;
                 } else {
@@ -6180,6 +5871,58 @@ static void addservice(Service_T s) {
     servicelist_conf = s;
   }
   tail = s;
+  indexservice(s);
+}
+
+
+/*
+ * Hash of a service name, service names are case insensitive
+ */
+static unsigned int hashname(const char *name) {
+  unsigned int h = 2166136261U;
+  for (; *name; name++)
+    h = (h ^ tolower((unsigned char)*name)) * 16777619U;
+  return h;
+}
+
+
+/*
+ * Add the service to the name index of the services parsed so far,
+ * the index replaces scans of the service list in the duplicate and
+ * dependency checks. The index is a hash table with linear probing in
+ * the configuration arena, it is kept at most half full.
+ */
+static void indexservice(Service_T s) {
+  unsigned int i;
+
+  if (2 * (serviceindex.count + 1) > serviceindex.size) {
+    Service_T *old = serviceindex.table;
+    int oldsize = serviceindex.size;
+    serviceindex.size = oldsize ? 2 * oldsize : 1024;
+    serviceindex.table = CALLOC(serviceindex.size, sizeof(Service_T));
+    serviceindex.count = 0;
+    for (int j = 0; j < oldsize; j++)
+      if (old[j])
+        indexservice(old[j]);
+    FREE(old);
+  }
+  for (i = hashname(s->name) & (serviceindex.size - 1); serviceindex.table[i]; i = (i + 1) & (serviceindex.size - 1))
+    ;
+  serviceindex.table[i] = s;
+  serviceindex.count++;
+}
+
+
+/*
+ * Return the service with the given name from the services parsed so far
+ */
+static Service_T getservice(const char *name) {
+  if (serviceindex.size) {
+    for (unsigned int i = hashname(name) & (serviceindex.size - 1); serviceindex.table[i]; i = (i + 1) & (serviceindex.size - 1))
+      if (IS(serviceindex.table[i]->name, name))
+        return serviceindex.table[i];
+  }
+  return NULL;
 }
 
 
@@ -6283,11 +6026,7 @@ static void addport(Port_T port) {
 
   if (p->request_checksum) {
     cleanup_hash_string(p->request_checksum);
-    if (strlen(p->request_checksum) == 32)
-      p->request_hashtype = HASH_MD5;
-    else if (strlen(p->request_checksum) == 40)
-      p->request_hashtype = HASH_SHA1;
-    else
+    if ((p->request_hashtype = Digest_typeOf((int)strlen(p->request_checksum))) == HASH_UNKNOWN)
       yyerror2("invalid checksum [%s]", p->request_checksum);
   } else
     p->request_hashtype = 0;
@@ -6305,6 +6044,8 @@ static void addport(Port_T port) {
     }
   }
   p->maxforward = port->maxforward;
+  for (int i = 0; i < TIMING_PHASES; i++)
+    p->timing[i] = -1;
   p->next = current->portlist;
   current->portlist = p;
 
@@ -6335,6 +6076,151 @@ static void addresource(Resource_T rr) {
 }
 
 
+/*
+ * Add a new trend object to the current service trend list
+ */
+static void addtrend(Trend_T tt) {
+  Trend_T t;
+
+  ASSERT(tt);
+
+  if (tt->cycles < 1 || tt->cycles > HISTORY_SIZE)
+    yyerror2("the number of trend cycles must be between 1 and %d", HISTORY_SIZE);
+  switch (current->type) {
+    case TYPE_PROCESS:
+      if (tt->metric == HISTORY_LOADAVG || tt->metric == HISTORY_SWAP)
+        yyerror2("the %s trend can only be used in a check system entry", historymetricnames[tt->metric]);
+      break;
+    case TYPE_SYSTEM:
+      if (tt->metric != HISTORY_CPU && tt->metric != HISTORY_MEMORY && tt->metric != HISTORY_SWAP && tt->metric != HISTORY_LOADAVG)
+        yyerror2("the %s trend cannot be used in a check system entry", historymetricnames[tt->metric]);
+      break;
+    default:
+      if (tt->metric != HISTORY_RESPONSE)
+        yyerror2("only the response time trend can be used in a check host entry");
+      break;
+  }
+  if (tt->metric != HISTORY_RESPONSE && ! Run.doprocess)
+    yyerror("Cannot activate service check. The process status engine was disabled. On certain systems you must run monit as root to utilize this feature)\n");
+
+  /* Convert the limit to the unit of the history samples */
+  if (tt->function == TREND_SLOPE) {
+    if (trendunit != TRENDUNIT_PERCENT)
+      yyerror2("the slope limit must be given in percent");
+    tt->limit = (long long)(trendvalue * 10.);
+  } else {
+    switch (tt->metric) {
+      case HISTORY_CPU:
+      case HISTORY_TOTALCPU:
+        if (trendunit != TRENDUNIT_PERCENT)
+          yyerror2("the cpu trend limit must be given in percent");
+        tt->limit = (long long)(trendvalue * 10.);
+        break;
+      case HISTORY_MEMORY:
+      case HISTORY_TOTALMEMORY:
+      case HISTORY_SWAP:
+        if (trendunit == TRENDUNIT_NONE)
+          trendunit = UNIT_BYTE;
+        if (trendunit < UNIT_BYTE)
+          yyerror2("the %s trend limit must be given as an amount (B, kB, MB, GB)", historymetricnames[tt->metric]);
+        tt->limit = (long long)(trendvalue * (trendunit / 1024.0));
+        break;
+      case HISTORY_RESPONSE:
+        if (trendunit == TRENDUNIT_MILLISECOND)
+          tt->limit = (long long)(trendvalue * 1000.);
+        else if (trendunit == TRENDUNIT_SECOND)
+          tt->limit = (long long)(trendvalue * 1000000.);
+        else
+          yyerror2("the response time trend limit must be given in ms or seconds");
+        break;
+      case HISTORY_LOADAVG:
+        if (trendunit != TRENDUNIT_NONE)
+          yyerror2("the loadavg trend limit has no unit");
+        tt->limit = (long long)(trendvalue * 10.);
+        break;
+      default:
+        if (trendunit != TRENDUNIT_NONE)
+          yyerror2("the %s trend limit has no unit", historymetricnames[tt->metric]);
+        tt->limit = (long long)trendvalue;
+        break;
+    }
+  }
+
+  NEW(t);
+  t->metric     = tt->metric;
+  t->function   = tt->function;
+  t->percentile = tt->percentile;
+  t->cycles     = tt->cycles;
+  t->operator   = tt->operator;
+  t->limit      = tt->limit;
+  t->action     = tt->action;
+  t->next       = current->trendlist;
+
+  current->trendlist = t;
+  reset_trendset();
+}
+
+
+/*
+ * Add a new connection timing object to the current service timing list
+ */
+static void addtiming(Timing_T tt) {
+  Timing_T t;
+
+  ASSERT(tt);
+
+  if (tt->limit < 0)
+    yyerror2("the %s time limit must not be negative", timingnames[tt->phase]);
+
+  NEW(t);
+  t->phase    = tt->phase;
+  t->operator = tt->operator;
+  t->limit    = tt->limit;
+  t->action   = tt->action;
+  t->next     = current->timinglist;
+
+  current->timinglist = t;
+  reset_timingset();
+}
+
+
+/*
+ * Add a new directory tree object to the current service tree list
+ */
+static void addtree(Tree_T tt) {
+  Tree_T t;
+  int filter = 0, found = FALSE;
+
+  ASSERT(tt);
+
+  /* The rules with the same pattern share one aggregate of the scan */
+  if (tt->pattern) {
+    for (t = current->treelist; t; t = t->next) {
+      if (t->pattern && IS(t->pattern, tt->pattern)) {
+        filter = t->filter;
+        found = TRUE;
+        break;
+      }
+      filter = MAX(filter, t->filter);
+    }
+    if (! found)
+      filter++;
+  }
+
+  NEW(t);
+  t->metric   = tt->metric;
+  t->pattern  = tt->pattern;
+  t->filter   = filter;
+  t->operator = tt->operator;
+  t->limit    = tt->limit;
+  t->action   = tt->action;
+  t->next     = current->treelist;
+
+  current->treelist = t;
+  reset_treeset();
+}
+
+
 /*
  * Add a new file object to the current service timestamp list
  */
@@ -6455,7 +6341,8 @@ static void addchecksum(Checksum_T cs) {
       cs->type = DEFAULT_HASH;
     if ( !(Util_getChecksum(current->path, cs->type, cs->hash, sizeof(cs->hash)))) {
       /* If the file doesn't exist, set dummy value */
-      snprintf(cs->hash, sizeof(cs->hash), "00000000000000000000000000000000");
+      memset(cs->hash, '0', Digest_length(cs->type) * 2);
+      cs->hash[Digest_length(cs->type) * 2] = 0;
       cs->initialized = FALSE;
       yywarning2("cannot compute a checksum for file %s", current->path);
     }
@@ -6464,16 +6351,12 @@ static void addchecksum(Checksum_T cs) {
   len = cleanup_hash_string(cs->hash);
 
   if (cs->type == HASH_UNKNOWN) {
-    if (len == 32) {
-      cs->type = HASH_MD5;
-    } else if (len == 40) {
-      cs->type = HASH_SHA1;
-    } else {
+    if ((cs->type = Digest_typeOf(len)) == HASH_UNKNOWN) {
       yyerror2("unknown checksum type [%s] for file %s", cs->hash, current->path);
       reset_checksumset();
       return;
     }
-  } else if (( cs->type == HASH_MD5 && len!=32 ) || ( cs->type == HASH_SHA1 && len != 40 )) {
+  } else if (len != Digest_length(cs->type) * 2) {
     yyerror2("invalid checksum [%s] for file %s", cs->hash, current->path);
     reset_checksumset();
     return;
@@ -7063,6 +6946,19 @@ static void addegid(gid_t gid) {
 }
 
 
+/*
+ * Copy a string which outlives the configuration generation (the log,
+ * pid, id and state files are kept across reloads) to the heap
+ */
+static char *heapstring(char *s) {
+  Arena_T arena = Arena_use(NULL);
+  char *h = Str_dup(s);
+  Arena_use(arena);
+  FREE(s);
+  return h;
+}
+
+
 /*
  * Reset the logfile if changed
  */
@@ -7074,7 +6970,7 @@ static void setlogfile(char *logfile) {
     } else
       FREE(Run.logfile);
   }
-  Run.logfile = logfile;
+  Run.logfile = heapstring(logfile);
 }
 
 
@@ -7089,7 +6985,7 @@ static void setpidfile(char *pidfile) {
     } else
       FREE(Run.pidfile);
   }
-  Run.pidfile = pidfile;
+  Run.pidfile = heapstring(pidfile);
 }
 
 
@@ -7336,6 +7232,33 @@ static void reset_resourceset() {
 }
 
 
+/*
+ * Reset the Trend set to default values
+ */
+static void reset_trendset() {
+  trendset.metric = 0;
+  trendset.function = TREND_AVERAGE;
+  trendset.percentile = 0;
+  trendset.cycles = 0;
+  trendset.operator = OPERATOR_EQUAL;
+  trendset.limit = 0;
+  trendset.action = NULL;
+  trendvalue = 0.;
+  trendunit = TRENDUNIT_NONE;
+}
+
+
+/*
+ * Reset the Timing set to default values
+ */
+static void reset_timingset() {
+  timingset.phase = TIMING_RESPONSE;
+  timingset.operator = OPERATOR_EQUAL;
+  timingset.limit = 0;
+  timingset.action = NULL;
+}
+
+
 /*
  * Reset the Timestamp set to default values
  */
@@ -7368,6 +7291,19 @@ static void reset_sizeset() {
 }
 
 
+/*
+ * Reset the Tree set to default values
+ */
+static void reset_treeset() {
+  treeset.metric = TREE_FILES;
+  treeset.pattern = NULL;
+  treeset.filter = 0;
+  treeset.operator = OPERATOR_EQUAL;
+  treeset.limit = 0;
+  treeset.action = NULL;
+}
+
+
 /*
  * Reset the Uptime set to default values
  */
@@ -7470,7 +7406,7 @@ static void reset_rateset() {
 static void check_name(char *name) {
   ASSERT(name);
 
-  if (Util_existService(name) || (current && IS(name, current->name)))
+  if (getservice(name) || (current && IS(name, current->name)))
     yyerror2("service name conflict, %s already defined", name);
   if (name && *name == '/')		
           yyerror2("service name '%s' must not start with '/' -- ", name);	
@@ -7530,7 +7466,7 @@ static void check_depend() {
       done = FALSE; // still unvisited nodes
       depends_on = NULL;
       for (d = s->dependantlist; d; d = d->next) {
-        Service_T dp = Util_getService(d->dependant);
+        Service_T dp = getservice(d->dependant);
         if (!dp) {
           LogError("%s: Error: Depend service '%s' is not defined in the control file\n", prog, d->dependant);
           exit(1);
@@ -7631,4 +7567,3 @@ static command_t copycommand(command_t source) {
   return copy;
 }
 
-
@@ -0,0 +1,187 @@
+#include "config.h"
+
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "monit.h"
+#include "batch.h"
+
+// libmonit
+#include "Bootstrap.h"
+
+/**
+ * batch.c unity tests.
+ *
+ * The services of the tests and their dependencies:
+ *
+ *      db <- app <- web
+ *      db <- worker
+ *      cache
+ */
+
+
+#define SERVICES 5
+
+
+enum {Db = 0, App, Web, Worker, Cache};
+
+
+static struct myservice services[SERVICES];
+static struct myjob jobs[SERVICES];
+static struct mybatch batch = {.jobs = jobs, .count = SERVICES};
+
+
+void LogCritical(const char *s, ...) {
+        va_list ap;
+        va_start(ap, s);
+        vfprintf(stderr, s, ap);
+        va_end(ap);
+}
+
+
+static void depend(int service, const char *name) {
+        Dependant_T d;
+        NEW(d);
+        d->dependant = Str_dup(name);
+        d->next = services[service].dependantlist;
+        services[service].dependantlist = d;
+}
+
+
+/* Reset the marks as run_batch() does */
+static void reset() {
+        for (int i = 0; i < SERVICES; i++) {
+                jobs[i].stop = jobs[i].start = jobs[i].expanded = FALSE;
+                jobs[i].depth = -1;
+                services[i].visited = services[i].depend_visited = FALSE;
+        }
+}
+
+
+/* Every marked service is stopped after its dependants and started after its dependencies */
+static void verify_order() {
+        for (int i = 0; i < SERVICES; i++) {
+                for (Dependant_T d = services[i].dependantlist; d; d = d->next) {
+                        Job_T parent = Batch_getJob(&batch, d->dependant);
+                        assert(parent);
+                        assert(Batch_getDepth(&batch, &jobs[i]) > Batch_getDepth(&batch, parent));
+                        if (jobs[i].start)
+                                assert(parent->start);
+                        if (parent->stop && ! services[i].depend_visited)
+                                assert(jobs[i].stop);
+                }
+        }
+}
+
+
+int main(void) {
+        const char *names[SERVICES] = {"db", "app", "web", "worker", "cache"};
+
+        Bootstrap(); // Need to initialize library
+
+        printf("============> Start Batch Tests\n\n");
+
+        for (int i = 0; i < SERVICES; i++) {
+                services[i].name = Str_dup(names[i]);
+                jobs[i].s = &services[i];
+        }
+        depend(App, "db");
+        depend(Web, "app");
+        depend(Worker, "db");
+
+        printf("=> Test0: get job\n");
+        {
+                assert(Batch_getJob(&batch, "web") == &jobs[Web]);
+                assert(Batch_getJob(&batch, "WEB") == &jobs[Web]);
+                assert(Batch_getJob(&batch, "nosuchservice") == NULL);
+        }
+        printf("=> Test0: OK\n\n");
+
+        printf("=> Test1: depth\n");
+        {
+                reset();
+                assert(Batch_getDepth(&batch, &jobs[Web]) == 2);
+                assert(Batch_getDepth(&batch, &jobs[App]) == 1);
+                assert(Batch_getDepth(&batch, &jobs[Db]) == 0);
+                assert(Batch_getDepth(&batch, &jobs[Worker]) == 1);
+                assert(Batch_getDepth(&batch, &jobs[Cache]) == 0);
+        }
+        printf("=> Test1: OK\n\n");
+
+        printf("=> Test2: stop stops the dependants only\n");
+        {
+                reset();
+                Batch_markDependants(&batch, &jobs[Db], ACTION_STOP, FALSE);
+                jobs[Db].stop = ACTION_STOP;
+                assert(jobs[App].stop == ACTION_STOP);
+                assert(jobs[Web].stop == ACTION_STOP);
+                assert(jobs[Worker].stop == ACTION_STOP);
+                assert(! jobs[Cache].stop);
+                for (int i = 0; i < SERVICES; i++)
+                        assert(! jobs[i].start);
+                verify_order();
+        }
+        printf("=> Test2: OK\n\n");
+
+        printf("=> Test3: restart stops and starts the dependants again\n");
+        {
+                reset();
+                Batch_markDependants(&batch, &jobs[Db], ACTION_RESTART, TRUE);
+                jobs[Db].stop = ACTION_RESTART;
+                Batch_markStart(&batch, &jobs[Db]);
+                for (int i = Db; i <= Worker; i++) {
+                        assert(jobs[i].stop == ACTION_RESTART);
+                        assert(jobs[i].start);
+                }
+                assert(! jobs[Cache].stop && ! jobs[Cache].start);
+                verify_order();
+        }
+        printf("=> Test3: OK\n\n");
+
+        printf("=> Test4: start starts the dependencies\n");
+        {
+                reset();
+                Batch_markDependants(&batch, &jobs[Web], ACTION_START, TRUE);
+                Batch_markStart(&batch, &jobs[Web]);
+                assert(jobs[Web].start && jobs[App].start && jobs[Db].start);
+                assert(! jobs[Worker].start && ! jobs[Cache].start);
+                for (int i = 0; i < SERVICES; i++)
+                        assert(! jobs[i].stop);
+                verify_order();
+        }
+        printf("=> Test4: OK\n\n");
+
+        printf("=> Test5: a failed stop clears the start of the dependants\n");
+        {
+                reset();
+                Batch_markDependants(&batch, &jobs[Db], ACTION_RESTART, TRUE);
+                jobs[Db].stop = ACTION_RESTART;
+                Batch_markStart(&batch, &jobs[Db]);
+                jobs[Db].start = FALSE;
+                Batch_markDependants(&batch, &jobs[Db], 0, FALSE);
+                for (int i = 0; i < SERVICES; i++)
+                        assert(! jobs[i].start);
+                assert(jobs[Web].stop == ACTION_RESTART);
+        }
+        printf("=> Test5: OK\n\n");
+
+        printf("=> Test6: services handled already are not marked again\n");
+        {
+                reset();
+                services[App].depend_visited = TRUE;
+                services[Db].visited = TRUE;
+                Batch_markDependants(&batch, &jobs[Db], ACTION_RESTART, TRUE);
+                Batch_markStart(&batch, &jobs[Web]);
+                assert(! jobs[App].stop);
+                assert(jobs[Web].stop == ACTION_RESTART);
+                assert(jobs[Web].start && jobs[App].start);
+                assert(! jobs[Db].start);
+        }
+        printf("=> Test6: OK\n\n");
+
+        printf("============> Batch Tests: OK\n\n");
+
+        return 0;
+}